@@ -4,7 +4,10 @@
 
 #include "flutter/assets/asset_manager.h"
 
+#include <utility>
+
 #include "flutter/assets/directory_asset_bundle.h"
+#include "flutter/fml/async_mapping_resolver.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -47,6 +50,21 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   return nullptr;
 }
 
+std::vector<std::unique_ptr<fml::Mapping>> AssetManager::GetAsMappings(
+    const std::vector<std::string>& asset_names,
+    std::shared_ptr<fml::ConcurrentTaskRunner> workers) const {
+  TRACE_EVENT0("flutter", "AssetManager::GetAsMappings");
+  std::vector<fml::AsyncMappingResolver::MappingJob> jobs;
+  jobs.reserve(asset_names.size());
+  for (const auto& asset_name : asset_names) {
+    // The names vector outlives the batch, so jobs may refer to its entries.
+    jobs.emplace_back(
+        [this, &asset_name]() { return GetAsMapping(asset_name); });
+  }
+  return fml::AsyncMappingResolver(std::move(workers))
+      .ResolveBatch(std::move(jobs));
+}
+
 // |AssetResolver|
 bool AssetManager::IsValid() const {
   return resolvers_.size() > 0;
@@ -8,8 +8,10 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "flutter/assets/asset_resolver.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
 
@@ -32,6 +34,15 @@ class AssetManager final : public AssetResolver {
   std::unique_ptr<fml::Mapping> GetAsMapping(
       const std::string& asset_name) const override;
 
+  // Resolves several assets in one call. When a worker pool is supplied the
+  // per-asset opens and mappings run concurrently on it, which overlaps the
+  // syscall latency that dominates reading many small files; with a null
+  // pool the assets resolve serially on the calling thread. Results are in
+  // the order of the requested names, with nullptr for misses.
+  std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
+      const std::vector<std::string>& asset_names,
+      std::shared_ptr<fml::ConcurrentTaskRunner> workers = nullptr) const;
+
  private:
   std::deque<std::unique_ptr<AssetResolver>> resolvers_;
 
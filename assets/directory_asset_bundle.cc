@@ -12,11 +12,47 @@
 
 namespace flutter {
 
+namespace {
+
+// An asset requested this many times has its mapping retained so further
+// lookups are served without filesystem calls.
+constexpr int kCachedAssetLookupThreshold = 2;
+
+// Bounds on the mapping cache and the lookup counters. Both are cleared
+// wholesale when full; hot assets re-earn their entries immediately.
+constexpr size_t kMaxCachedAssetMappings = 16;
+constexpr size_t kMaxLookupCounts = 256;
+
+// Records the relative paths of all files under the given directory. This
+// recurses via |VisitFiles| directly (rather than |VisitFilesRecursively|)
+// because the visitor only receives names relative to the immediate parent
+// and the index needs paths relative to the bundle root.
+void IndexDirectory(const fml::UniqueFD& directory,
+                    const std::string& prefix,
+                    std::unordered_set<std::string>& index) {
+  fml::VisitFiles(directory, [&prefix, &index](const fml::UniqueFD& directory,
+                                               const std::string& filename) {
+    if (fml::IsDirectory(directory, filename.c_str())) {
+      fml::UniqueFD subdirectory =
+          fml::OpenDirectoryReadOnly(directory, filename.c_str());
+      if (subdirectory.is_valid()) {
+        IndexDirectory(subdirectory, prefix + filename + "/", index);
+      }
+    } else {
+      index.insert(prefix + filename);
+    }
+    return true;
+  });
+}
+
+}  // namespace
+
 DirectoryAssetBundle::DirectoryAssetBundle(fml::UniqueFD descriptor)
     : descriptor_(std::move(descriptor)) {
   if (!fml::IsDirectory(descriptor_)) {
     return;
   }
+  IndexDirectory(descriptor_, "", index_);
   is_valid_ = true;
 }
 
@@ -35,13 +71,51 @@ std::unique_ptr<fml::Mapping> DirectoryAssetBundle::GetAsMapping(
     return nullptr;
   }
 
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+
+  auto cached = mapping_cache_.find(asset_name);
+  if (cached != mapping_cache_.end()) {
+    // The returned mapping shares the cached mapping and keeps it alive.
+    auto mapping = cached->second;
+    return std::make_unique<fml::NonOwnedMapping>(
+        mapping->GetMapping(), mapping->GetSize(),
+        [mapping](const uint8_t* data, size_t size) {});
+  }
+
+  if (index_.count(asset_name) == 0) {
+    // The asset was not present when the directory was indexed. Probe for it
+    // anyway so files added since (a hot reload syncing new assets) are still
+    // found; a confirmed miss costs one existence check instead of a failed
+    // open and mapping attempt.
+    if (!fml::FileExists(descriptor_, asset_name.c_str())) {
+      return nullptr;
+    }
+    index_.insert(asset_name);
+  }
+
   auto mapping = std::make_unique<fml::FileMapping>(fml::OpenFile(
       descriptor_, asset_name.c_str(), false, fml::FilePermission::kRead));
 
   if (!mapping->IsValid()) {
+    // The indexed file is gone; forget it so later misses stay cheap.
+    index_.erase(asset_name);
     return nullptr;
   }
 
+  if (lookup_counts_.size() >= kMaxLookupCounts) {
+    lookup_counts_.clear();
+  }
+  if (++lookup_counts_[asset_name] >= kCachedAssetLookupThreshold) {
+    if (mapping_cache_.size() >= kMaxCachedAssetMappings) {
+      mapping_cache_.clear();
+    }
+    std::shared_ptr<fml::FileMapping> shared_mapping = std::move(mapping);
+    mapping_cache_[asset_name] = shared_mapping;
+    return std::make_unique<fml::NonOwnedMapping>(
+        shared_mapping->GetMapping(), shared_mapping->GetSize(),
+        [shared_mapping](const uint8_t* data, size_t size) {});
+  }
+
   return mapping;
 }
 
@@ -5,13 +5,34 @@
 #ifndef FLUTTER_ASSETS_DIRECTORY_ASSET_BUNDLE_H_
 #define FLUTTER_ASSETS_DIRECTORY_ASSET_BUNDLE_H_
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
 #include "flutter/assets/asset_resolver.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/unique_fd.h"
 
 namespace flutter {
 
+//------------------------------------------------------------------------------
+/// Resolves assets out of a directory on disk.
+///
+/// The directory is walked once at construction to build an index of the
+/// relative paths it contains, and assets that are requested repeatedly keep
+/// their file mappings cached. Repeated lookups of hot assets are then served
+/// as views into the cached mappings without touching the filesystem, and
+/// lookups of names the directory never contained are answered with a single
+/// existence check instead of a failed open. Files added to the directory
+/// after construction are still found (a miss against the index falls back to
+/// probing the filesystem); cached assets pin the contents first observed, as
+/// mappings handed out by this resolver do anyway. Development flows that
+/// rewrite assets in place swap in a fresh resolver on hot restart.
+///
 class DirectoryAssetBundle : public AssetResolver {
  public:
   explicit DirectoryAssetBundle(fml::UniqueFD descriptor);
@@ -22,6 +43,15 @@ class DirectoryAssetBundle : public AssetResolver {
   const fml::UniqueFD descriptor_;
   bool is_valid_ = false;
 
+  // Relative paths of the files present when the directory was indexed,
+  // plus any discovered by later lookups. Guarded by cache_mutex_ along
+  // with the caches below since lookups may come from multiple threads.
+  mutable std::mutex cache_mutex_;
+  mutable std::unordered_set<std::string> index_;
+  mutable std::map<std::string, std::shared_ptr<fml::FileMapping>>
+      mapping_cache_;
+  mutable std::map<std::string, int> lookup_counts_;
+
   // |AssetResolver|
   bool IsValid() const override;
 
@@ -0,0 +1,124 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/directory_asset_bundle.h"
+
+#include <string>
+#include <vector>
+
+#include "flutter/assets/asset_manager.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/file.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+static bool WriteAsset(const fml::UniqueFD& directory,
+                       const std::string& name,
+                       const std::string& contents) {
+  fml::DataMapping mapping{std::vector<uint8_t>{contents.begin(),
+                                                contents.end()}};
+  return fml::WriteAtomically(directory, name.c_str(), mapping);
+}
+
+static std::string ReadMapping(const fml::Mapping& mapping) {
+  return std::string{reinterpret_cast<const char*>(mapping.GetMapping()),
+                     mapping.GetSize()};
+}
+
+TEST(DirectoryAssetBundleTest, ResolvesIndexedAndNestedAssets) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  ASSERT_TRUE(WriteAsset(temp_dir.fd(), "icon.png", "icon bytes"));
+  auto nested = fml::CreateDirectory(temp_dir.fd(), {"fonts"},
+                                     fml::FilePermission::kReadWrite);
+  ASSERT_TRUE(nested.is_valid());
+  ASSERT_TRUE(WriteAsset(nested, "Roboto.ttf", "font bytes"));
+
+  DirectoryAssetBundle bundle(
+      fml::OpenDirectory(temp_dir.path().c_str(), false,
+                         fml::FilePermission::kRead));
+  AssetResolver& resolver = bundle;
+  ASSERT_TRUE(resolver.IsValid());
+
+  auto mapping = resolver.GetAsMapping("icon.png");
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(ReadMapping(*mapping), "icon bytes");
+
+  mapping = resolver.GetAsMapping("fonts/Roboto.ttf");
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(ReadMapping(*mapping), "font bytes");
+
+  ASSERT_EQ(resolver.GetAsMapping("missing.png"), nullptr);
+}
+
+TEST(DirectoryAssetBundleTest, ServesRepeatedLookupsFromTheCache) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  ASSERT_TRUE(WriteAsset(temp_dir.fd(), "strings.json", "strings"));
+
+  DirectoryAssetBundle bundle(
+      fml::OpenDirectory(temp_dir.path().c_str(), false,
+                         fml::FilePermission::kRead));
+  AssetResolver& resolver = bundle;
+  ASSERT_TRUE(resolver.IsValid());
+
+  // Second lookup caches the mapping; once cached, the asset resolves even
+  // after the backing file is removed.
+  ASSERT_NE(resolver.GetAsMapping("strings.json"), nullptr);
+  ASSERT_NE(resolver.GetAsMapping("strings.json"), nullptr);
+  ASSERT_TRUE(fml::UnlinkFile(temp_dir.fd(), "strings.json"));
+
+  auto mapping = resolver.GetAsMapping("strings.json");
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(ReadMapping(*mapping), "strings");
+}
+
+TEST(DirectoryAssetBundleTest, FindsAssetsAddedAfterConstruction) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  DirectoryAssetBundle bundle(
+      fml::OpenDirectory(temp_dir.path().c_str(), false,
+                         fml::FilePermission::kRead));
+  AssetResolver& resolver = bundle;
+  ASSERT_TRUE(resolver.IsValid());
+
+  ASSERT_EQ(resolver.GetAsMapping("late.txt"), nullptr);
+  ASSERT_TRUE(WriteAsset(temp_dir.fd(), "late.txt", "late bytes"));
+
+  auto mapping = resolver.GetAsMapping("late.txt");
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(ReadMapping(*mapping), "late bytes");
+}
+
+TEST(DirectoryAssetBundleTest, ResolvesBatchesThroughTheAssetManager) {
+  fml::ScopedTemporaryDirectory temp_dir;
+  std::vector<std::string> names;
+  for (size_t i = 0; i < 32; i++) {
+    names.push_back("asset_" + std::to_string(i));
+    ASSERT_TRUE(WriteAsset(temp_dir.fd(), names.back(), names.back()));
+  }
+  names.push_back("missing.txt");
+
+  auto asset_manager = std::make_shared<AssetManager>();
+  asset_manager->PushBack(std::make_unique<DirectoryAssetBundle>(
+      fml::OpenDirectory(temp_dir.path().c_str(), false,
+                         fml::FilePermission::kRead)));
+
+  auto loop = fml::ConcurrentMessageLoop::Create(4);
+  auto mappings = asset_manager->GetAsMappings(names, loop->GetTaskRunner());
+  ASSERT_EQ(mappings.size(), names.size());
+  for (size_t i = 0; i < 32; i++) {
+    ASSERT_NE(mappings[i], nullptr);
+    ASSERT_EQ(ReadMapping(*mappings[i]), names[i]);
+  }
+  ASSERT_EQ(mappings.back(), nullptr);
+
+  // The serial fallback resolves the same batch without a worker pool.
+  mappings = asset_manager->GetAsMappings(names);
+  ASSERT_EQ(mappings.size(), names.size());
+  ASSERT_NE(mappings[0], nullptr);
+  ASSERT_EQ(mappings.back(), nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -0,0 +1,229 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/indexed_asset_bundle.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr char kBundleMagic[4] = {'F', 'A', 'B', '1'};
+constexpr uint32_t kBundleVersion = 1;
+constexpr uint64_t kPayloadAlignment = 16;
+
+struct BundleHeader {
+  char magic[4];
+  uint32_t version;
+  uint64_t entry_count;
+};
+
+static_assert(sizeof(BundleHeader) == 16, "Bundle header must be packed.");
+
+uint64_t AlignPayloadOffset(uint64_t offset) {
+  return (offset + kPayloadAlignment - 1) & ~(kPayloadAlignment - 1);
+}
+
+// Returns true if [offset, offset + size) lies within a buffer of
+// total_size bytes without overflowing.
+bool RangeIsValid(uint64_t offset, uint64_t size, uint64_t total_size) {
+  return offset <= total_size && size <= total_size - offset;
+}
+
+}  // namespace
+
+IndexedAssetBundle::IndexedAssetBundle(
+    std::unique_ptr<fml::Mapping> bundle_mapping)
+    : bundle_mapping_(std::move(bundle_mapping)) {
+  static_assert(sizeof(Entry) == 32, "Bundle entries must be packed.");
+  if (!bundle_mapping_ || bundle_mapping_->GetMapping() == nullptr ||
+      bundle_mapping_->GetSize() < sizeof(BundleHeader)) {
+    return;
+  }
+
+  const uint8_t* bundle = bundle_mapping_->GetMapping();
+  const uint64_t bundle_size = bundle_mapping_->GetSize();
+
+  const auto* header = reinterpret_cast<const BundleHeader*>(bundle);
+  if (std::memcmp(header->magic, kBundleMagic, sizeof(kBundleMagic)) != 0 ||
+      header->version != kBundleVersion) {
+    return;
+  }
+
+  if (header->entry_count >
+      (bundle_size - sizeof(BundleHeader)) / sizeof(Entry)) {
+    return;
+  }
+
+  const auto* entries =
+      reinterpret_cast<const Entry*>(bundle + sizeof(BundleHeader));
+
+  // Verify that every key and payload lies within the bundle and that keys
+  // are sorted as the binary search in FindEntry expects.
+  std::string_view previous_key;
+  for (uint64_t i = 0; i < header->entry_count; i++) {
+    const Entry& entry = entries[i];
+    if (!RangeIsValid(entry.key_offset, entry.key_size, bundle_size) ||
+        !RangeIsValid(entry.data_offset, entry.data_size, bundle_size)) {
+      return;
+    }
+    std::string_view key(reinterpret_cast<const char*>(bundle) +
+                             entry.key_offset,
+                         entry.key_size);
+    if (i > 0 && key <= previous_key) {
+      return;
+    }
+    previous_key = key;
+  }
+
+  entries_ = entries;
+  entry_count_ = header->entry_count;
+  is_valid_ = true;
+}
+
+IndexedAssetBundle::~IndexedAssetBundle() = default;
+
+std::unique_ptr<fml::Mapping> IndexedAssetBundle::CreateBundle(
+    const std::map<std::string, const fml::Mapping*>& assets) {
+  // The std::map keeps keys in the byte order the reader binary searches in.
+  const uint64_t entry_count = assets.size();
+  const uint64_t keys_offset =
+      sizeof(BundleHeader) + entry_count * sizeof(Entry);
+
+  uint64_t key_cursor = keys_offset;
+  for (const auto& asset : assets) {
+    if (asset.second == nullptr || asset.second->GetMapping() == nullptr) {
+      return nullptr;
+    }
+    key_cursor += asset.first.size();
+  }
+
+  std::vector<Entry> entries;
+  entries.reserve(entry_count);
+
+  uint64_t key_offset = keys_offset;
+  uint64_t data_offset = key_cursor;
+  for (const auto& asset : assets) {
+    data_offset = AlignPayloadOffset(data_offset);
+    entries.push_back({
+        key_offset,            // key_offset
+        asset.first.size(),    // key_size
+        data_offset,           // data_offset
+        asset.second->GetSize()  // data_size
+    });
+    key_offset += asset.first.size();
+    data_offset += asset.second->GetSize();
+  }
+
+  std::vector<uint8_t> buffer(data_offset, 0u);
+
+  BundleHeader header = {};
+  std::memcpy(header.magic, kBundleMagic, sizeof(kBundleMagic));
+  header.version = kBundleVersion;
+  header.entry_count = entry_count;
+  std::memcpy(buffer.data(), &header, sizeof(header));
+
+  if (entry_count > 0) {
+    std::memcpy(buffer.data() + sizeof(BundleHeader), entries.data(),
+                entry_count * sizeof(Entry));
+  }
+
+  size_t index = 0;
+  for (const auto& asset : assets) {
+    const Entry& entry = entries[index++];
+    std::memcpy(buffer.data() + entry.key_offset, asset.first.data(),
+                entry.key_size);
+    std::memcpy(buffer.data() + entry.data_offset,
+                asset.second->GetMapping(), entry.data_size);
+  }
+
+  return std::make_unique<fml::DataMapping>(std::move(buffer));
+}
+
+const IndexedAssetBundle::Entry* IndexedAssetBundle::FindEntry(
+    const std::string& asset_name) const {
+  const uint8_t* bundle = bundle_mapping_->GetMapping();
+  const std::string_view name(asset_name);
+  const Entry* end = entries_ + entry_count_;
+  const Entry* entry = std::lower_bound(
+      entries_, end, name, [bundle](const Entry& entry, std::string_view key) {
+        return std::string_view(reinterpret_cast<const char*>(bundle) +
+                                    entry.key_offset,
+                                entry.key_size) < key;
+      });
+  if (entry == end ||
+      std::string_view(reinterpret_cast<const char*>(bundle) +
+                           entry->key_offset,
+                       entry->key_size) != name) {
+    return nullptr;
+  }
+  return entry;
+}
+
+// |AssetResolver|
+bool IndexedAssetBundle::IsValid() const {
+  return is_valid_;
+}
+
+// |AssetResolver|
+std::unique_ptr<fml::Mapping> IndexedAssetBundle::GetAsMapping(
+    const std::string& asset_name) const {
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset bundle was not valid.";
+    return nullptr;
+  }
+
+  const Entry* entry = FindEntry(asset_name);
+  if (entry == nullptr) {
+    return nullptr;
+  }
+
+  // The returned mapping shares the bundle mapping and keeps it alive.
+  auto bundle_mapping = bundle_mapping_;
+  return std::make_unique<fml::NonOwnedMapping>(
+      bundle_mapping_->GetMapping() + entry->data_offset, entry->data_size,
+      [bundle_mapping](const uint8_t* data, size_t size) {});
+}
+
+void IndexedAssetBundle::PrefetchAssets(
+    const std::vector<std::string>& asset_names,
+    fml::RefPtr<fml::TaskRunner> task_runner) const {
+  if (!is_valid_ || !task_runner) {
+    return;
+  }
+
+  std::vector<std::pair<uint64_t, uint64_t>> ranges;
+  ranges.reserve(asset_names.size());
+  for (const auto& asset_name : asset_names) {
+    if (const Entry* entry = FindEntry(asset_name)) {
+      ranges.emplace_back(entry->data_offset, entry->data_size);
+    }
+  }
+
+  if (ranges.empty()) {
+    return;
+  }
+
+  auto bundle_mapping = bundle_mapping_;
+  task_runner->PostTask([bundle_mapping, ranges = std::move(ranges)]() {
+    const uint8_t* bundle = bundle_mapping->GetMapping();
+    // Read one byte per page to fault the payloads into the page cache.
+    constexpr uint64_t kPageSize = 4096;
+    volatile uint8_t sink = 0;
+    for (const auto& range : ranges) {
+      for (uint64_t offset = 0; offset < range.second; offset += kPageSize) {
+        sink += bundle[range.first + offset];
+      }
+    }
+    (void)sink;
+  });
+}
+
+}  // namespace flutter
@@ -0,0 +1,89 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_ASSETS_INDEXED_ASSET_BUNDLE_H_
+#define FLUTTER_ASSETS_INDEXED_ASSET_BUNDLE_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter/assets/asset_resolver.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/task_runner.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Resolves assets out of a single indexed bundle file via one shared
+/// mapping. Unlike a directory bundle, lookups perform no filesystem calls
+/// after the bundle has been opened; each asset is served as a view into the
+/// shared mapping.
+///
+/// Bundle layout (all integers little-endian):
+///   - Header: the 4 byte magic "FAB1", a uint32_t format version, and a
+///     uint64_t entry count.
+///   - Entry table: one fixed size record per asset holding the key and
+///     payload offset/size relative to the start of the bundle. Records are
+///     sorted by key bytes so lookups can binary search the table.
+///   - Key table: concatenated key bytes.
+///   - Payloads: asset contents, each aligned to a 16 byte boundary so
+///     consumers may overlay naturally aligned structures on the mapping.
+///
+class IndexedAssetBundle : public AssetResolver {
+ public:
+  explicit IndexedAssetBundle(std::unique_ptr<fml::Mapping> bundle_mapping);
+
+  ~IndexedAssetBundle() override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Serializes the given assets into a bundle readable by this
+  ///             resolver.
+  ///
+  /// @return     The serialized bundle, or nullptr if any asset mapping was
+  ///             invalid.
+  ///
+  static std::unique_ptr<fml::Mapping> CreateBundle(
+      const std::map<std::string, const fml::Mapping*>& assets);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Touches the pages backing the named assets on the given
+  ///             task runner so that later lookups on performance sensitive
+  ///             threads do not fault against cold file backed memory.
+  ///             Unknown asset names are ignored.
+  ///
+  void PrefetchAssets(const std::vector<std::string>& asset_names,
+                      fml::RefPtr<fml::TaskRunner> task_runner) const;
+
+ private:
+  // One record in the bundle's entry table.
+  struct Entry {
+    uint64_t key_offset;
+    uint64_t key_size;
+    uint64_t data_offset;
+    uint64_t data_size;
+  };
+
+  std::shared_ptr<fml::Mapping> bundle_mapping_;
+  const Entry* entries_ = nullptr;
+  uint64_t entry_count_ = 0;
+  bool is_valid_ = false;
+
+  const Entry* FindEntry(const std::string& asset_name) const;
+
+  // |AssetResolver|
+  bool IsValid() const override;
+
+  // |AssetResolver|
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(IndexedAssetBundle);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_ASSETS_INDEXED_ASSET_BUNDLE_H_
@@ -0,0 +1,122 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/indexed_asset_bundle.h"
+
+#include <string>
+#include <vector>
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/testing/thread_test.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+using IndexedAssetBundleTest = ThreadTest;
+
+static std::unique_ptr<fml::Mapping> MakeMapping(const std::string& contents) {
+  return std::make_unique<fml::DataMapping>(
+      std::vector<uint8_t>{contents.begin(), contents.end()});
+}
+
+static std::string ReadMapping(const fml::Mapping& mapping) {
+  return std::string{reinterpret_cast<const char*>(mapping.GetMapping()),
+                     mapping.GetSize()};
+}
+
+TEST_F(IndexedAssetBundleTest, RoundTripsAssets) {
+  auto icon = MakeMapping("icon bytes");
+  auto strings = MakeMapping("localized strings");
+  auto empty = MakeMapping("");
+
+  auto bundle_mapping = IndexedAssetBundle::CreateBundle({
+      {"assets/icon.png", icon.get()},
+      {"assets/strings.json", strings.get()},
+      {"empty", empty.get()},
+  });
+  ASSERT_NE(bundle_mapping, nullptr);
+
+  IndexedAssetBundle bundle(std::move(bundle_mapping));
+  AssetResolver& resolver = bundle;
+  ASSERT_TRUE(resolver.IsValid());
+
+  auto mapping = resolver.GetAsMapping("assets/icon.png");
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(ReadMapping(*mapping), "icon bytes");
+
+  mapping = resolver.GetAsMapping("assets/strings.json");
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(ReadMapping(*mapping), "localized strings");
+
+  // Payloads are aligned within the bundle.
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(mapping->GetMapping()) % 16u, 0u);
+
+  mapping = resolver.GetAsMapping("empty");
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(mapping->GetSize(), 0u);
+
+  ASSERT_EQ(resolver.GetAsMapping("assets/missing.png"), nullptr);
+}
+
+TEST_F(IndexedAssetBundleTest, AssetsOutliveTheResolver) {
+  auto icon = MakeMapping("icon bytes");
+  std::unique_ptr<AssetResolver> resolver =
+      std::make_unique<IndexedAssetBundle>(
+          IndexedAssetBundle::CreateBundle({{"assets/icon.png", icon.get()}}));
+
+  auto mapping = resolver->GetAsMapping("assets/icon.png");
+  ASSERT_NE(mapping, nullptr);
+
+  resolver.reset();
+  ASSERT_EQ(ReadMapping(*mapping), "icon bytes");
+}
+
+TEST_F(IndexedAssetBundleTest, RejectsCorruptBundles) {
+  IndexedAssetBundle null_bundle(nullptr);
+  AssetResolver& null_resolver = null_bundle;
+  ASSERT_FALSE(null_resolver.IsValid());
+
+  auto icon = MakeMapping("icon bytes");
+  auto bundle_mapping =
+      IndexedAssetBundle::CreateBundle({{"assets/icon.png", icon.get()}});
+  ASSERT_NE(bundle_mapping, nullptr);
+
+  std::vector<uint8_t> corrupt{
+      bundle_mapping->GetMapping(),
+      bundle_mapping->GetMapping() + bundle_mapping->GetSize()};
+  corrupt[0] ^= 0xFF;  // Damage the magic.
+  IndexedAssetBundle corrupt_bundle(
+      std::make_unique<fml::DataMapping>(std::move(corrupt)));
+  AssetResolver& corrupt_resolver = corrupt_bundle;
+  ASSERT_FALSE(corrupt_resolver.IsValid());
+
+  // A bundle whose entries point outside the file is also rejected.
+  std::vector<uint8_t> truncated{
+      bundle_mapping->GetMapping(),
+      bundle_mapping->GetMapping() + bundle_mapping->GetSize() / 2};
+  IndexedAssetBundle truncated_bundle(
+      std::make_unique<fml::DataMapping>(std::move(truncated)));
+  AssetResolver& truncated_resolver = truncated_bundle;
+  ASSERT_FALSE(truncated_resolver.IsValid());
+}
+
+TEST_F(IndexedAssetBundleTest, PrefetchRunsOnTheGivenTaskRunner) {
+  auto icon = MakeMapping("icon bytes");
+  IndexedAssetBundle bundle(
+      IndexedAssetBundle::CreateBundle({{"assets/icon.png", icon.get()}}));
+
+  auto task_runner = CreateNewThread("io");
+  bundle.PrefetchAssets({"assets/icon.png", "assets/missing.png"},
+                        task_runner);
+
+  // The prefetch task was posted ahead of this event and has completed by
+  // the time the event signals.
+  fml::AutoResetWaitableEvent latch;
+  task_runner->PostTask([&latch]() { latch.Signal(); });
+  latch.Wait();
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -15,6 +15,7 @@
 
 #include "flutter/fml/closure.h"
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 #include "flutter/fml/unique_fd.h"
 
@@ -27,13 +28,39 @@ class FrameTiming {
   static constexpr Phase kPhases[kCount] = {kBuildStart, kBuildFinish,
                                             kRasterStart, kRasterFinish};
 
+  // The number of values serialized per frame in the timings reports sent to
+  // the framework: one timestamp per phase followed by the GPU duration. Must
+  // be kept in sync with the record length expected by hooks.dart.
+  static constexpr int kStatisticsCount = kCount + 1;
+
   fml::TimePoint Get(Phase phase) const { return data_[phase]; }
   fml::TimePoint Set(Phase phase, fml::TimePoint value) {
     return data_[phase] = value;
   }
 
+  // The time the GPU spent executing this frame's command buffers when the
+  // rendering backend can measure it. GPU timer results are read back
+  // asynchronously, so this is typically the measurement of a frame submitted
+  // shortly before this one. Negative when no measurement is available.
+  fml::TimeDelta GetGpuDuration() const { return gpu_duration_; }
+  void SetGpuDuration(fml::TimeDelta value) { gpu_duration_ = value; }
+
+  // The delay between a frame's submission and the compositor actually
+  // presenting it, when the rendering backend can observe presentation.
+  // The signal arrives after submission, so like the GPU duration this
+  // describes a frame presented shortly before this one. Negative when no
+  // measurement is available. Engine internal (fed to the animator's frame
+  // pacing); not part of the serialized statistics record, whose length is
+  // fixed by hooks.dart.
+  fml::TimeDelta GetPresentationDelay() const { return presentation_delay_; }
+  void SetPresentationDelay(fml::TimeDelta value) {
+    presentation_delay_ = value;
+  }
+
  private:
   fml::TimePoint data_[kCount];
+  fml::TimeDelta gpu_duration_ = fml::TimeDelta::FromMicroseconds(-1);
+  fml::TimeDelta presentation_delay_ = fml::TimeDelta::FromMicroseconds(-1);
 };
 
 using TaskObserverAdd =
@@ -97,6 +124,7 @@ struct Settings {
   bool trace_systrace = false;
   bool dump_skp_on_shader_compilation = false;
   bool cache_sksl = false;
+  bool cache_gl_program_binaries = false;
   bool endless_trace_buffer = false;
   bool enable_dart_profiling = false;
   bool disable_dart_asserts = false;
@@ -124,6 +152,14 @@ struct Settings {
   // target indicating the URL at which the VM service can be accessed.
   uint32_t observatory_port = 0;
 
+  // When true, the observatory HTTP server is not started with the service
+  // isolate. The server (socket bind included) is brought up on demand via
+  // the web server control requests understood by `dart:vmservice_io` (for
+  // example `Service.controlWebServer` from `dart:developer`). The service
+  // isolate itself is still created at VM bootstrap since the VM offers no
+  // way to create it later; only the server startup cost is deferred.
+  bool lazy_observatory = false;
+
   // Determines whether an authentication code is required to communicate with
   // the VM service.
   bool disable_service_auth_codes = true;
@@ -149,6 +185,15 @@ struct Settings {
   // associated resources.
   bool leak_vm = true;
 
+  // When |leak_vm| is false, hold the VM (and its snapshots and worker pool)
+  // alive for this many seconds after the last shell releases its reference
+  // instead of collecting it immediately. Add-to-app flows that close and
+  // reopen Flutter screens within the window then pay only the isolate
+  // launch cost on re-entry instead of a full VM and snapshot boot. Zero
+  // (the default) keeps the immediate collection behavior. A critical
+  // memory pressure notification collects a kept-alive VM early.
+  int64_t vm_keep_alive_seconds = 0;
+
   // Engine settings
   TaskObserverAdd task_observer_add;
   TaskObserverRemove task_observer_remove;
@@ -173,6 +218,11 @@ struct Settings {
   UnhandledExceptionCallback unhandled_exception_callback;
   bool enable_software_rendering = false;
   bool skia_deterministic_rendering_on_cpu = false;
+  // Prefer a 16 bit (RGB565) onscreen framebuffer over the default 32 bit
+  // one when the rendering backend offers such a configuration. Trades color
+  // depth for a halved framebuffer bandwidth, which is a significant raster
+  // speedup on memory-bandwidth-bound devices.
+  bool prefer_reduced_color_depth = false;
   bool verbose_logging = false;
   std::string log_tag = "flutter";
 
@@ -193,6 +243,76 @@ struct Settings {
   // soon as a frame is rasterized.
   FrameRasterizedCallback frame_rasterized_callback;
 
+  // The number of frames the UI thread may build ahead of the raster thread.
+  // Zero selects the platform default: two frames, or one when the platform
+  // and raster threads are the same.
+  uint32_t frame_pipeline_depth = 0;
+
+  // When the raster thread falls behind, rasterize only the most recently
+  // built layer tree and drop older queued ones. Trades displaying
+  // already-stale frames for lower latency, which generally suits scrolling
+  // content under raster pressure.
+  bool frame_pipeline_latest_wins = false;
+
+  // Wake the UI thread late within the vsync period when recent frames show
+  // that building a frame finishes well before the deadline. Sampling input
+  // closer to presentation lowers input-to-photon latency, at the cost of
+  // less headroom when a frame suddenly becomes more expensive to build.
+  bool predictive_vsync_wake = false;
+
+  // Let the animator drop to half or third frame cadence when the combined
+  // UI build and raster cost of recent frames is far below the display
+  // period, skipping no-op vsyncs on high refresh rate panels to save
+  // power. Embedders can pin a cadence regardless of this flag through
+  // |Animator::SetFrameCadenceOverride|.
+  bool frame_pacing_governor = false;
+
+  // Rasterize non-overlapping top-level layers on a pool of worker threads
+  // instead of serially on the raster thread. Only takes effect for frames
+  // that target a CPU backed surface without embedded platform views; GPU
+  // backed frames always paint serially because a GrContext is bound to the
+  // thread that created it. Scenes with texture layers should leave this
+  // disabled, as external texture sources are not required to tolerate
+  // off-thread painting.
+  bool enable_parallel_rasterization = false;
+
+  // Persist rasterized picture cache entries to disk and reload them on
+  // later runs, making first-frame raster of stable content (e.g. a kiosk
+  // style static background) nearly free. Only worthwhile for applications
+  // whose complex pictures are identical across launches; entries for
+  // content that changes between runs simply miss and are re-rasterized.
+  bool enable_persistent_raster_cache = false;
+
+  // Replay the SkPicture recordings listed in the io.flutter.warmup.json
+  // asset manifest into an offscreen surface right after the rendering
+  // surface is set up, so shader compilation happens while the platform is
+  // still showing its splash screen instead of on first interaction. Timings
+  // are surfaced through the service protocol.
+  bool warmup_skps = false;
+
+  // When non-zero, touch move and hover samples are buffered, interpolated to
+  // a single sample this many microseconds behind the newest buffered one,
+  // and delivered as one coalesced packet per frame. For devices that sample
+  // touch faster than the display refreshes; the offset trades added input
+  // latency for not burning a framework pointer callback per sample. Zero
+  // keeps the dispatcher chosen by the platform view.
+  uint32_t pointer_resampling_offset_us = 0;
+
+  // Pre-create the replacement root isolate (including isolate snapshot
+  // loading) during UI thread idle periods so that a cold restart can bind an
+  // already warm isolate instead of creating one synchronously. Costs the
+  // memory of one idle isolate and is therefore only worthwhile in workflows
+  // that restart frequently, such as development hot restarts.
+  bool prewarm_root_isolate = false;
+
+  // Let `Isolate.spawn` create lightweight isolates inside the spawning
+  // isolate's group instead of launching a full isolate group per spawn.
+  // In-group isolates share the immutable program structure of their group,
+  // so spawning skips kernel re-binding and library setup and per-request
+  // worker isolates start orders of magnitude faster. Gated on a VM
+  // experiment flag until the semantics are enabled by default in the VM.
+  bool enable_isolate_groups = false;
+
   // This data will be available to the isolate immediately on launch via the
   // Window.getPersistentIsolateData callback. This is meant for information
   // that the isolate cannot request asynchronously (platform messages can be
@@ -201,6 +321,13 @@ struct Settings {
   // the buffer must be as small as possible.
   std::shared_ptr<const fml::Mapping> persistent_isolate_data;
 
+  /// Maximum number of worker threads in the shared concurrent message
+  /// loop, or 0 for one per hardware thread. This is a cap rather than a
+  /// fixed pool size: workers are spawned on demand and exit after an idle
+  /// timeout, so lowering it bounds peak thread count and stack memory on
+  /// constrained devices without costing anything when the pool is idle.
+  size_t concurrent_worker_count = 0;
+
   /// Max size of old gen heap size in MB, or 0 for unlimited, -1 for default
   /// value.
   ///
@@ -4,16 +4,26 @@
 
 #include "flutter/flow/compositor_context.h"
 
+#include <algorithm>
+#include <thread>
+
 #include "flutter/flow/layers/layer_tree.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 
 namespace flutter {
 
 CompositorContext::CompositorContext(fml::Milliseconds frame_budget)
-    : raster_time_(frame_budget), ui_time_(frame_budget) {}
+    : raster_cache_(std::make_shared<RasterCache>()),
+      raster_time_(frame_budget),
+      ui_time_(frame_budget) {}
 
 CompositorContext::~CompositorContext() = default;
 
+void CompositorContext::ShareRasterCache(std::shared_ptr<RasterCache> cache) {
+  FML_DCHECK(cache);
+  raster_cache_ = std::move(cache);
+}
+
 void CompositorContext::BeginFrame(ScopedFrame& frame,
                                    bool enable_instrumentation) {
   if (enable_instrumentation) {
@@ -24,7 +34,7 @@ void CompositorContext::BeginFrame(ScopedFrame& frame,
 
 void CompositorContext::EndFrame(ScopedFrame& frame,
                                  bool enable_instrumentation) {
-  raster_cache_.SweepAfterFrame();
+  raster_cache_->SweepAfterFrame();
   if (enable_instrumentation) {
     raster_time_.Stop();
   }
@@ -101,14 +111,23 @@ RasterStatus CompositorContext::ScopedFrame::Raster(
   return RasterStatus::kSuccess;
 }
 
+void CompositorContext::EnableParallelRaster() {
+  if (!parallel_raster_loop_) {
+    // Half the cores: the raster thread itself paints one tile group while
+    // the workers take the rest.
+    parallel_raster_loop_ = fml::ConcurrentMessageLoop::Create(
+        std::max<size_t>(2u, std::thread::hardware_concurrency() / 2u));
+  }
+}
+
 void CompositorContext::OnGrContextCreated() {
   texture_registry_.OnGrContextCreated();
-  raster_cache_.Clear();
+  raster_cache_->Clear();
 }
 
 void CompositorContext::OnGrContextDestroyed() {
   texture_registry_.OnGrContextDestroyed();
-  raster_cache_.Clear();
+  raster_cache_->Clear();
 }
 
 }  // namespace flutter
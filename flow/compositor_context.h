@@ -12,6 +12,7 @@
 #include "flutter/flow/instrumentation.h"
 #include "flutter/flow/raster_cache.h"
 #include "flutter/flow/texture.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/raster_thread_merger.h"
 #include "third_party/skia/include/core/SkCanvas.h"
@@ -97,7 +98,21 @@ class CompositorContext {
 
   void OnGrContextDestroyed();
 
-  RasterCache& raster_cache() { return raster_cache_; }
+  RasterCache& raster_cache() { return *raster_cache_; }
+
+  // The raster cache as a shareable reference. Contexts that raster on the
+  // same thread may install one another's cache via |ShareRasterCache| so
+  // warmed entries serve all of them.
+  std::shared_ptr<RasterCache> shared_raster_cache() const {
+    return raster_cache_;
+  }
+
+  // Replaces this context's raster cache with one belonging to another
+  // context. Cache keys are derived from process-global picture and layer
+  // ids, so entries remain valid across contexts. Both contexts must raster
+  // on the same thread, and the cache must be installed before this context
+  // rasters its first frame.
+  void ShareRasterCache(std::shared_ptr<RasterCache> cache);
 
   TextureRegistry& texture_registry() { return texture_registry_; }
 
@@ -107,12 +122,29 @@ class CompositorContext {
 
   Stopwatch& ui_time() { return ui_time_; }
 
+  // Lap times are recorded from GPU timer query readbacks when the surface
+  // supports them; the stopwatch is never started or stopped.
+  Stopwatch& gpu_time() { return gpu_time_; }
+
+  // Spins up the worker pool used to rasterize independent layer subtrees
+  // concurrently. Until this is called, frames always paint serially. Safe
+  // to call multiple times; only the first call creates the pool.
+  void EnableParallelRaster();
+
+  // The worker pool for parallel rasterization, or nullptr when the mode is
+  // disabled.
+  fml::ConcurrentMessageLoop* parallel_raster_loop() const {
+    return parallel_raster_loop_.get();
+  }
+
  private:
-  RasterCache raster_cache_;
+  std::shared_ptr<RasterCache> raster_cache_;
   TextureRegistry texture_registry_;
   Counter frame_count_;
   Stopwatch raster_time_;
   Stopwatch ui_time_;
+  Stopwatch gpu_time_;
+  std::shared_ptr<fml::ConcurrentMessageLoop> parallel_raster_loop_;
 
   void BeginFrame(ScopedFrame& frame, bool enable_instrumentation);
 
@@ -0,0 +1,600 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/display_list.h"
+
+#include <cstring>
+#include <type_traits>
+
+#include "flutter/flow/layers/physical_shape_layer.h"
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+namespace {
+
+enum class OpType : uint32_t {
+  kSave,
+  kSaveLayer,
+  kRestore,
+  kTranslate,
+  kScale,
+  kRotate,
+  kSkew,
+  kTransform,
+  kClipRect,
+  kClipRRect,
+  kClipPath,
+  kDrawColor,
+  kDrawPaint,
+  kDrawLine,
+  kDrawRect,
+  kDrawRRect,
+  kDrawDRRect,
+  kDrawOval,
+  kDrawCircle,
+  kDrawArc,
+  kDrawPath,
+  kDrawImage,
+  kDrawImageRect,
+  kDrawTextBlob,
+  kDrawShadow,
+  kDrawPicture,
+};
+
+// All op records are composed exclusively of four byte scalars so that the
+// flat buffer contains no padding and byte equality of two buffers implies
+// op equality.
+struct SaveLayerRecord {
+  uint32_t has_bounds;
+  SkRect bounds;
+  uint32_t has_paint;
+  uint32_t paint;
+};
+
+struct PointPairRecord {
+  SkScalar a;
+  SkScalar b;
+};
+
+struct TransformRecord {
+  SkScalar matrix[9];
+};
+
+struct ClipRectRecord {
+  SkRect rect;
+  uint32_t clip_op;
+  uint32_t anti_alias;
+};
+
+struct ClipRRectRecord {
+  SkRRect rrect;
+  uint32_t clip_op;
+  uint32_t anti_alias;
+};
+
+struct ClipPathRecord {
+  uint32_t path;
+  uint32_t clip_op;
+  uint32_t anti_alias;
+};
+
+struct DrawColorRecord {
+  uint32_t color;
+  uint32_t blend_mode;
+};
+
+struct DrawPaintRecord {
+  uint32_t paint;
+};
+
+struct DrawLineRecord {
+  SkPoint p0;
+  SkPoint p1;
+  uint32_t paint;
+};
+
+struct DrawRectRecord {
+  SkRect rect;
+  uint32_t paint;
+};
+
+struct DrawRRectRecord {
+  SkRRect rrect;
+  uint32_t paint;
+};
+
+struct DrawDRRectRecord {
+  SkRRect outer;
+  SkRRect inner;
+  uint32_t paint;
+};
+
+struct DrawCircleRecord {
+  SkPoint center;
+  SkScalar radius;
+  uint32_t paint;
+};
+
+struct DrawArcRecord {
+  SkRect bounds;
+  SkScalar start_angle;
+  SkScalar sweep_angle;
+  uint32_t use_center;
+  uint32_t paint;
+};
+
+struct DrawPathRecord {
+  uint32_t path;
+  uint32_t paint;
+};
+
+struct DrawImageRecord {
+  uint32_t image;
+  SkPoint offset;
+  uint32_t has_paint;
+  uint32_t paint;
+};
+
+struct DrawImageRectRecord {
+  uint32_t image;
+  SkRect src;
+  SkRect dst;
+  uint32_t has_paint;
+  uint32_t paint;
+};
+
+struct DrawTextBlobRecord {
+  uint32_t blob;
+  SkPoint offset;
+  uint32_t paint;
+};
+
+struct DrawShadowRecord {
+  uint32_t path;
+  uint32_t color;
+  SkScalar elevation;
+  uint32_t transparent_occluder;
+  SkScalar device_pixel_ratio;
+};
+
+struct DrawPictureRecord {
+  uint32_t picture;
+};
+
+template <typename T>
+T ReadRecord(const std::vector<uint8_t>& buffer, size_t* offset) {
+  static_assert(std::is_trivially_copyable<T>::value, "");
+  T record;
+  std::memcpy(&record, buffer.data() + *offset, sizeof(T));
+  *offset += sizeof(T);
+  return record;
+}
+
+}  // namespace
+
+DisplayList::DisplayList() = default;
+
+DisplayList::~DisplayList() = default;
+
+void DisplayList::Dispatch(SkCanvas& canvas) const {
+  size_t offset = 0;
+  while (offset < ops_.size()) {
+    const OpType type = static_cast<OpType>(
+        ReadRecord<uint32_t>(ops_, &offset));
+    switch (type) {
+      case OpType::kSave:
+        canvas.save();
+        break;
+      case OpType::kSaveLayer: {
+        auto record = ReadRecord<SaveLayerRecord>(ops_, &offset);
+        canvas.saveLayer(record.has_bounds ? &record.bounds : nullptr,
+                         record.has_paint ? &paints_[record.paint] : nullptr);
+        break;
+      }
+      case OpType::kRestore:
+        canvas.restore();
+        break;
+      case OpType::kTranslate: {
+        auto record = ReadRecord<PointPairRecord>(ops_, &offset);
+        canvas.translate(record.a, record.b);
+        break;
+      }
+      case OpType::kScale: {
+        auto record = ReadRecord<PointPairRecord>(ops_, &offset);
+        canvas.scale(record.a, record.b);
+        break;
+      }
+      case OpType::kRotate: {
+        auto record = ReadRecord<PointPairRecord>(ops_, &offset);
+        canvas.rotate(record.a);
+        break;
+      }
+      case OpType::kSkew: {
+        auto record = ReadRecord<PointPairRecord>(ops_, &offset);
+        canvas.skew(record.a, record.b);
+        break;
+      }
+      case OpType::kTransform: {
+        auto record = ReadRecord<TransformRecord>(ops_, &offset);
+        SkMatrix matrix;
+        matrix.set9(record.matrix);
+        canvas.concat(matrix);
+        break;
+      }
+      case OpType::kClipRect: {
+        auto record = ReadRecord<ClipRectRecord>(ops_, &offset);
+        canvas.clipRect(record.rect, static_cast<SkClipOp>(record.clip_op),
+                        record.anti_alias);
+        break;
+      }
+      case OpType::kClipRRect: {
+        auto record = ReadRecord<ClipRRectRecord>(ops_, &offset);
+        canvas.clipRRect(record.rrect, static_cast<SkClipOp>(record.clip_op),
+                         record.anti_alias);
+        break;
+      }
+      case OpType::kClipPath: {
+        auto record = ReadRecord<ClipPathRecord>(ops_, &offset);
+        canvas.clipPath(paths_[record.path],
+                        static_cast<SkClipOp>(record.clip_op),
+                        record.anti_alias);
+        break;
+      }
+      case OpType::kDrawColor: {
+        auto record = ReadRecord<DrawColorRecord>(ops_, &offset);
+        canvas.drawColor(record.color,
+                         static_cast<SkBlendMode>(record.blend_mode));
+        break;
+      }
+      case OpType::kDrawPaint: {
+        auto record = ReadRecord<DrawPaintRecord>(ops_, &offset);
+        canvas.drawPaint(paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawLine: {
+        auto record = ReadRecord<DrawLineRecord>(ops_, &offset);
+        canvas.drawLine(record.p0, record.p1, paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawRect: {
+        auto record = ReadRecord<DrawRectRecord>(ops_, &offset);
+        canvas.drawRect(record.rect, paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawRRect: {
+        auto record = ReadRecord<DrawRRectRecord>(ops_, &offset);
+        canvas.drawRRect(record.rrect, paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawDRRect: {
+        auto record = ReadRecord<DrawDRRectRecord>(ops_, &offset);
+        canvas.drawDRRect(record.outer, record.inner, paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawOval: {
+        auto record = ReadRecord<DrawRectRecord>(ops_, &offset);
+        canvas.drawOval(record.rect, paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawCircle: {
+        auto record = ReadRecord<DrawCircleRecord>(ops_, &offset);
+        canvas.drawCircle(record.center, record.radius,
+                          paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawArc: {
+        auto record = ReadRecord<DrawArcRecord>(ops_, &offset);
+        canvas.drawArc(record.bounds, record.start_angle, record.sweep_angle,
+                       record.use_center, paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawPath: {
+        auto record = ReadRecord<DrawPathRecord>(ops_, &offset);
+        canvas.drawPath(paths_[record.path], paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawImage: {
+        auto record = ReadRecord<DrawImageRecord>(ops_, &offset);
+        canvas.drawImage(images_[record.image], record.offset.x(),
+                         record.offset.y(),
+                         record.has_paint ? &paints_[record.paint] : nullptr);
+        break;
+      }
+      case OpType::kDrawImageRect: {
+        auto record = ReadRecord<DrawImageRectRecord>(ops_, &offset);
+        canvas.drawImageRect(
+            images_[record.image], record.src, record.dst,
+            record.has_paint ? &paints_[record.paint] : nullptr);
+        break;
+      }
+      case OpType::kDrawTextBlob: {
+        auto record = ReadRecord<DrawTextBlobRecord>(ops_, &offset);
+        canvas.drawTextBlob(blobs_[record.blob], record.offset.x(),
+                            record.offset.y(), paints_[record.paint]);
+        break;
+      }
+      case OpType::kDrawShadow: {
+        auto record = ReadRecord<DrawShadowRecord>(ops_, &offset);
+        PhysicalShapeLayer::DrawShadow(
+            &canvas, paths_[record.path], record.color, record.elevation,
+            record.transparent_occluder, record.device_pixel_ratio);
+        break;
+      }
+      case OpType::kDrawPicture: {
+        auto record = ReadRecord<DrawPictureRecord>(ops_, &offset);
+        canvas.drawPicture(pictures_[record.picture]);
+        break;
+      }
+      default:
+        FML_DCHECK(false) << "Corrupt display list op buffer.";
+        return;
+    }
+  }
+}
+
+bool DisplayList::Equals(const DisplayList& other) const {
+  if (op_count_ != other.op_count_ || ops_ != other.ops_) {
+    return false;
+  }
+  if (paints_ != other.paints_ || paths_ != other.paths_) {
+    return false;
+  }
+  // Resources are compared by identity; replaying the same image object
+  // always produces the same pixels, while equal looking but distinct
+  // objects are treated as different content.
+  return images_ == other.images_ && blobs_ == other.blobs_ &&
+         pictures_ == other.pictures_;
+}
+
+DisplayListBuilder::DisplayListBuilder()
+    : list_(std::unique_ptr<DisplayList>(new DisplayList())) {}
+
+DisplayListBuilder::~DisplayListBuilder() = default;
+
+template <typename T>
+void DisplayListBuilder::Push(uint32_t op_type, const T& record) {
+  static_assert(std::is_trivially_copyable<T>::value, "");
+  static_assert(sizeof(T) % 4 == 0, "Op records must not contain padding.");
+  auto& ops = list_->ops_;
+  const size_t offset = ops.size();
+  ops.resize(offset + sizeof(uint32_t) + sizeof(T));
+  std::memcpy(ops.data() + offset, &op_type, sizeof(uint32_t));
+  std::memcpy(ops.data() + offset + sizeof(uint32_t), &record, sizeof(T));
+  list_->op_count_++;
+}
+
+uint32_t DisplayListBuilder::UsePaint(const SkPaint& paint) {
+  auto& paints = list_->paints_;
+  // Dart code commonly reuses one paint object across consecutive draws.
+  if (!paints.empty() && paints.back() == paint) {
+    return static_cast<uint32_t>(paints.size() - 1);
+  }
+  paints.push_back(paint);
+  return static_cast<uint32_t>(paints.size() - 1);
+}
+
+uint32_t DisplayListBuilder::UsePath(const SkPath& path) {
+  list_->paths_.push_back(path);
+  return static_cast<uint32_t>(list_->paths_.size() - 1);
+}
+
+void DisplayListBuilder::Save() {
+  Push(static_cast<uint32_t>(OpType::kSave), uint32_t{0});
+}
+
+void DisplayListBuilder::SaveLayer(const SkRect* bounds, const SkPaint* paint) {
+  SaveLayerRecord record = {};
+  record.has_bounds = bounds != nullptr;
+  record.bounds = bounds ? *bounds : SkRect::MakeEmpty();
+  record.has_paint = paint != nullptr;
+  record.paint = paint ? UsePaint(*paint) : 0;
+  Push(static_cast<uint32_t>(OpType::kSaveLayer), record);
+}
+
+void DisplayListBuilder::Restore() {
+  Push(static_cast<uint32_t>(OpType::kRestore), uint32_t{0});
+}
+
+void DisplayListBuilder::Translate(SkScalar dx, SkScalar dy) {
+  Push(static_cast<uint32_t>(OpType::kTranslate), PointPairRecord{dx, dy});
+}
+
+void DisplayListBuilder::Scale(SkScalar sx, SkScalar sy) {
+  Push(static_cast<uint32_t>(OpType::kScale), PointPairRecord{sx, sy});
+}
+
+void DisplayListBuilder::Rotate(SkScalar degrees) {
+  Push(static_cast<uint32_t>(OpType::kRotate), PointPairRecord{degrees, 0});
+}
+
+void DisplayListBuilder::Skew(SkScalar sx, SkScalar sy) {
+  Push(static_cast<uint32_t>(OpType::kSkew), PointPairRecord{sx, sy});
+}
+
+void DisplayListBuilder::Transform(const SkMatrix& matrix) {
+  TransformRecord record;
+  matrix.get9(record.matrix);
+  Push(static_cast<uint32_t>(OpType::kTransform), record);
+}
+
+void DisplayListBuilder::ClipRect(const SkRect& rect,
+                                  SkClipOp clip_op,
+                                  bool anti_alias) {
+  ClipRectRecord record = {};
+  record.rect = rect;
+  record.clip_op = static_cast<uint32_t>(clip_op);
+  record.anti_alias = anti_alias;
+  Push(static_cast<uint32_t>(OpType::kClipRect), record);
+}
+
+void DisplayListBuilder::ClipRRect(const SkRRect& rrect,
+                                   SkClipOp clip_op,
+                                   bool anti_alias) {
+  ClipRRectRecord record = {};
+  record.rrect = rrect;
+  record.clip_op = static_cast<uint32_t>(clip_op);
+  record.anti_alias = anti_alias;
+  Push(static_cast<uint32_t>(OpType::kClipRRect), record);
+}
+
+void DisplayListBuilder::ClipPath(const SkPath& path,
+                                  SkClipOp clip_op,
+                                  bool anti_alias) {
+  ClipPathRecord record = {};
+  record.path = UsePath(path);
+  record.clip_op = static_cast<uint32_t>(clip_op);
+  record.anti_alias = anti_alias;
+  Push(static_cast<uint32_t>(OpType::kClipPath), record);
+}
+
+void DisplayListBuilder::DrawColor(SkColor color, SkBlendMode blend_mode) {
+  DrawColorRecord record = {};
+  record.color = color;
+  record.blend_mode = static_cast<uint32_t>(blend_mode);
+  Push(static_cast<uint32_t>(OpType::kDrawColor), record);
+}
+
+void DisplayListBuilder::DrawPaint(const SkPaint& paint) {
+  DrawPaintRecord record = {};
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawPaint), record);
+}
+
+void DisplayListBuilder::DrawLine(const SkPoint& p0,
+                                  const SkPoint& p1,
+                                  const SkPaint& paint) {
+  DrawLineRecord record = {};
+  record.p0 = p0;
+  record.p1 = p1;
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawLine), record);
+}
+
+void DisplayListBuilder::DrawRect(const SkRect& rect, const SkPaint& paint) {
+  DrawRectRecord record = {};
+  record.rect = rect;
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawRect), record);
+}
+
+void DisplayListBuilder::DrawRRect(const SkRRect& rrect, const SkPaint& paint) {
+  DrawRRectRecord record = {};
+  record.rrect = rrect;
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawRRect), record);
+}
+
+void DisplayListBuilder::DrawDRRect(const SkRRect& outer,
+                                    const SkRRect& inner,
+                                    const SkPaint& paint) {
+  DrawDRRectRecord record = {};
+  record.outer = outer;
+  record.inner = inner;
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawDRRect), record);
+}
+
+void DisplayListBuilder::DrawOval(const SkRect& bounds, const SkPaint& paint) {
+  DrawRectRecord record = {};
+  record.rect = bounds;
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawOval), record);
+}
+
+void DisplayListBuilder::DrawCircle(const SkPoint& center,
+                                    SkScalar radius,
+                                    const SkPaint& paint) {
+  DrawCircleRecord record = {};
+  record.center = center;
+  record.radius = radius;
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawCircle), record);
+}
+
+void DisplayListBuilder::DrawArc(const SkRect& bounds,
+                                 SkScalar start_angle,
+                                 SkScalar sweep_angle,
+                                 bool use_center,
+                                 const SkPaint& paint) {
+  DrawArcRecord record = {};
+  record.bounds = bounds;
+  record.start_angle = start_angle;
+  record.sweep_angle = sweep_angle;
+  record.use_center = use_center;
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawArc), record);
+}
+
+void DisplayListBuilder::DrawPath(const SkPath& path, const SkPaint& paint) {
+  DrawPathRecord record = {};
+  record.path = UsePath(path);
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawPath), record);
+}
+
+void DisplayListBuilder::DrawImage(const sk_sp<SkImage>& image,
+                                   const SkPoint& offset,
+                                   const SkPaint* paint) {
+  DrawImageRecord record = {};
+  list_->images_.push_back(image);
+  record.image = static_cast<uint32_t>(list_->images_.size() - 1);
+  record.offset = offset;
+  record.has_paint = paint != nullptr;
+  record.paint = paint ? UsePaint(*paint) : 0;
+  Push(static_cast<uint32_t>(OpType::kDrawImage), record);
+}
+
+void DisplayListBuilder::DrawImageRect(const sk_sp<SkImage>& image,
+                                       const SkRect& src,
+                                       const SkRect& dst,
+                                       const SkPaint* paint) {
+  DrawImageRectRecord record = {};
+  list_->images_.push_back(image);
+  record.image = static_cast<uint32_t>(list_->images_.size() - 1);
+  record.src = src;
+  record.dst = dst;
+  record.has_paint = paint != nullptr;
+  record.paint = paint ? UsePaint(*paint) : 0;
+  Push(static_cast<uint32_t>(OpType::kDrawImageRect), record);
+}
+
+void DisplayListBuilder::DrawTextBlob(const sk_sp<SkTextBlob>& blob,
+                                      const SkPoint& offset,
+                                      const SkPaint& paint) {
+  DrawTextBlobRecord record = {};
+  list_->blobs_.push_back(blob);
+  record.blob = static_cast<uint32_t>(list_->blobs_.size() - 1);
+  record.offset = offset;
+  record.paint = UsePaint(paint);
+  Push(static_cast<uint32_t>(OpType::kDrawTextBlob), record);
+}
+
+void DisplayListBuilder::DrawShadow(const SkPath& path,
+                                    SkColor color,
+                                    SkScalar elevation,
+                                    bool transparent_occluder,
+                                    SkScalar device_pixel_ratio) {
+  DrawShadowRecord record = {};
+  record.path = UsePath(path);
+  record.color = color;
+  record.elevation = elevation;
+  record.transparent_occluder = transparent_occluder;
+  record.device_pixel_ratio = device_pixel_ratio;
+  Push(static_cast<uint32_t>(OpType::kDrawShadow), record);
+}
+
+void DisplayListBuilder::DrawPicture(const sk_sp<SkPicture>& picture) {
+  DrawPictureRecord record = {};
+  list_->pictures_.push_back(picture);
+  record.picture = static_cast<uint32_t>(list_->pictures_.size() - 1);
+  Push(static_cast<uint32_t>(OpType::kDrawPicture), record);
+}
+
+std::unique_ptr<DisplayList> DisplayListBuilder::Build() {
+  FML_DCHECK(list_) << "Build may only be called once per builder.";
+  return std::move(list_);
+}
+
+}  // namespace flutter
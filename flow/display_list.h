@@ -0,0 +1,144 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_DISPLAY_LIST_H_
+#define FLUTTER_FLOW_DISPLAY_LIST_H_
+
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/core/SkPaint.h"
+#include "third_party/skia/include/core/SkPath.h"
+#include "third_party/skia/include/core/SkPicture.h"
+#include "third_party/skia/include/core/SkRRect.h"
+#include "third_party/skia/include/core/SkTextBlob.h"
+
+namespace flutter {
+
+class DisplayListBuilder;
+
+//------------------------------------------------------------------------------
+/// An engine owned intermediate representation of recorded drawing commands.
+///
+/// Ops are stored in a single flat byte buffer of fixed size records, so
+/// recording a frame performs a handful of amortized vector growths instead
+/// of a heap allocation per command. Heavyweight resources (paints, paths,
+/// images, text blobs, nested pictures) live in side tables that the op
+/// records reference by index.
+///
+/// A display list can be replayed into any |SkCanvas| via |Dispatch| and
+/// compared op by op via |Equals|, which makes it suitable as a key for
+/// caching and as the basis for frame diffing in flow.
+class DisplayList {
+ public:
+  ~DisplayList();
+
+  /// Replays the recorded ops into the given canvas.
+  void Dispatch(SkCanvas& canvas) const;
+
+  /// Op level equality: the op streams must match record for record. Paints
+  /// and paths are compared by value; images, text blobs and nested pictures
+  /// by identity.
+  bool Equals(const DisplayList& other) const;
+
+  size_t op_count() const { return op_count_; }
+
+  /// The size of the flat op buffer in bytes, excluding the side tables.
+  size_t bytes() const { return ops_.size(); }
+
+ private:
+  friend class DisplayListBuilder;
+
+  DisplayList();
+
+  std::vector<uint8_t> ops_;
+  size_t op_count_ = 0;
+
+  std::vector<SkPaint> paints_;
+  std::vector<SkPath> paths_;
+  std::vector<sk_sp<SkImage>> images_;
+  std::vector<sk_sp<SkTextBlob>> blobs_;
+  std::vector<sk_sp<SkPicture>> pictures_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DisplayList);
+};
+
+//------------------------------------------------------------------------------
+/// Records drawing commands into a |DisplayList|.
+///
+/// The builder mirrors the op set used by the UI canvas bindings. |Build|
+/// finalizes the recording; the builder must not be used afterwards.
+class DisplayListBuilder {
+ public:
+  DisplayListBuilder();
+
+  ~DisplayListBuilder();
+
+  void Save();
+  void SaveLayer(const SkRect* bounds, const SkPaint* paint);
+  void Restore();
+
+  void Translate(SkScalar dx, SkScalar dy);
+  void Scale(SkScalar sx, SkScalar sy);
+  void Rotate(SkScalar degrees);
+  void Skew(SkScalar sx, SkScalar sy);
+  void Transform(const SkMatrix& matrix);
+
+  void ClipRect(const SkRect& rect, SkClipOp clip_op, bool anti_alias);
+  void ClipRRect(const SkRRect& rrect, SkClipOp clip_op, bool anti_alias);
+  void ClipPath(const SkPath& path, SkClipOp clip_op, bool anti_alias);
+
+  void DrawColor(SkColor color, SkBlendMode blend_mode);
+  void DrawPaint(const SkPaint& paint);
+  void DrawLine(const SkPoint& p0, const SkPoint& p1, const SkPaint& paint);
+  void DrawRect(const SkRect& rect, const SkPaint& paint);
+  void DrawRRect(const SkRRect& rrect, const SkPaint& paint);
+  void DrawDRRect(const SkRRect& outer,
+                  const SkRRect& inner,
+                  const SkPaint& paint);
+  void DrawOval(const SkRect& bounds, const SkPaint& paint);
+  void DrawCircle(const SkPoint& center, SkScalar radius, const SkPaint& paint);
+  void DrawArc(const SkRect& bounds,
+               SkScalar start_angle,
+               SkScalar sweep_angle,
+               bool use_center,
+               const SkPaint& paint);
+  void DrawPath(const SkPath& path, const SkPaint& paint);
+  void DrawImage(const sk_sp<SkImage>& image,
+                 const SkPoint& offset,
+                 const SkPaint* paint);
+  void DrawImageRect(const sk_sp<SkImage>& image,
+                     const SkRect& src,
+                     const SkRect& dst,
+                     const SkPaint* paint);
+  void DrawTextBlob(const sk_sp<SkTextBlob>& blob,
+                    const SkPoint& offset,
+                    const SkPaint& paint);
+  void DrawShadow(const SkPath& path,
+                  SkColor color,
+                  SkScalar elevation,
+                  bool transparent_occluder,
+                  SkScalar device_pixel_ratio);
+  void DrawPicture(const sk_sp<SkPicture>& picture);
+
+  std::unique_ptr<DisplayList> Build();
+
+ private:
+  template <typename T>
+  void Push(uint32_t op_type, const T& record);
+
+  uint32_t UsePaint(const SkPaint& paint);
+  uint32_t UsePath(const SkPath& path);
+
+  std::unique_ptr<DisplayList> list_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DisplayListBuilder);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_DISPLAY_LIST_H_
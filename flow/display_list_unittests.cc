@@ -0,0 +1,91 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/display_list.h"
+
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+namespace testing {
+
+static std::unique_ptr<DisplayList> RecordSimpleScene() {
+  DisplayListBuilder builder;
+  SkPaint paint;
+  paint.setColor(SK_ColorRED);
+  builder.Save();
+  builder.Translate(2, 2);
+  builder.DrawRect(SkRect::MakeWH(4, 4), paint);
+  builder.Restore();
+  return builder.Build();
+}
+
+TEST(DisplayList, RecordsOpsIntoAFlatBuffer) {
+  auto list = RecordSimpleScene();
+
+  ASSERT_EQ(list->op_count(), 4u);
+  ASSERT_GT(list->bytes(), 0u);
+}
+
+TEST(DisplayList, DispatchReplaysIntoACanvas) {
+  auto surface = SkSurface::MakeRasterN32Premul(8, 8);
+  surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+
+  auto list = RecordSimpleScene();
+  list->Dispatch(*surface->getCanvas());
+
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(8, 8);
+  surface->readPixels(bitmap, 0, 0);
+  ASSERT_EQ(bitmap.getColor(4, 4), SK_ColorRED);
+  ASSERT_EQ(bitmap.getColor(0, 0), SK_ColorTRANSPARENT);
+}
+
+TEST(DisplayList, IdenticalRecordingsCompareEqual) {
+  auto first = RecordSimpleScene();
+  auto second = RecordSimpleScene();
+
+  ASSERT_TRUE(first->Equals(*second));
+}
+
+TEST(DisplayList, DifferingOpsCompareUnequal) {
+  auto first = RecordSimpleScene();
+
+  DisplayListBuilder builder;
+  SkPaint paint;
+  paint.setColor(SK_ColorBLUE);  // Same ops, different paint.
+  builder.Save();
+  builder.Translate(2, 2);
+  builder.DrawRect(SkRect::MakeWH(4, 4), paint);
+  builder.Restore();
+  auto second = builder.Build();
+
+  ASSERT_FALSE(first->Equals(*second));
+}
+
+TEST(DisplayList, ResourcesCompareByIdentity) {
+  auto image_surface = SkSurface::MakeRasterN32Premul(4, 4);
+  image_surface->getCanvas()->clear(SK_ColorGREEN);
+  auto image = image_surface->makeImageSnapshot();
+
+  DisplayListBuilder first_builder;
+  first_builder.DrawImage(image, SkPoint::Make(0, 0), nullptr);
+  auto first = first_builder.Build();
+
+  DisplayListBuilder second_builder;
+  second_builder.DrawImage(image, SkPoint::Make(0, 0), nullptr);
+  auto second = second_builder.Build();
+
+  ASSERT_TRUE(first->Equals(*second));
+
+  DisplayListBuilder third_builder;
+  third_builder.DrawImage(image_surface->makeImageSnapshot(),
+                          SkPoint::Make(0, 0), nullptr);
+  auto third = third_builder.Build();
+
+  ASSERT_FALSE(first->Equals(*third));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -12,41 +12,34 @@ bool ExternalViewEmbedder::SubmitFrame(GrContext* context,
 };
 
 void MutatorsStack::PushClipRect(const SkRect& rect) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(rect);
-  vector_.push_back(element);
+  vector_.emplace_back(rect);
 };
 
 void MutatorsStack::PushClipRRect(const SkRRect& rrect) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(rrect);
-  vector_.push_back(element);
+  vector_.emplace_back(rrect);
 };
 
 void MutatorsStack::PushClipPath(const SkPath& path) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(path);
-  vector_.push_back(element);
+  vector_.emplace_back(path);
 };
 
 void MutatorsStack::PushTransform(const SkMatrix& matrix) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(matrix);
-  vector_.push_back(element);
+  vector_.emplace_back(matrix);
 };
 
 void MutatorsStack::PushOpacity(const int& alpha) {
-  std::shared_ptr<Mutator> element = std::make_shared<Mutator>(alpha);
-  vector_.push_back(element);
+  vector_.emplace_back(alpha);
 };
 
 void MutatorsStack::Pop() {
   vector_.pop_back();
 };
 
-const std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator
-MutatorsStack::Top() const {
+std::vector<Mutator>::const_reverse_iterator MutatorsStack::Top() const {
   return vector_.rend();
 };
 
-const std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator
-MutatorsStack::Bottom() const {
+std::vector<Mutator>::const_reverse_iterator MutatorsStack::Bottom() const {
   return vector_.rbegin();
 };
 
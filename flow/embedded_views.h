@@ -90,9 +90,39 @@ class Mutator {
     return false;
   }
 
+  Mutator& operator=(const Mutator& other) {
+    if (this == &other) {
+      return *this;
+    }
+    if (type_ == clip_path) {
+      delete path_;
+    }
+    type_ = other.type_;
+    switch (other.type_) {
+      case clip_rect:
+        rect_ = other.rect_;
+        break;
+      case clip_rrect:
+        rrect_ = other.rrect_;
+        break;
+      case clip_path:
+        path_ = new SkPath(*other.path_);
+        break;
+      case transform:
+        matrix_ = other.matrix_;
+        break;
+      case opacity:
+        alpha_ = other.alpha_;
+        break;
+      default:
+        break;
+    }
+    return *this;
+  }
+
   bool operator!=(const Mutator& other) const { return !operator==(other); }
 
-  bool IsClipType() {
+  bool IsClipType() const {
     return type_ == clip_rect || type_ == clip_rrect || type_ == clip_path;
   }
 
@@ -139,35 +169,17 @@ class MutatorsStack {
   void Pop();
 
   // Returns an iterator pointing to the top of the stack.
-  const std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator Top()
-      const;
+  std::vector<Mutator>::const_reverse_iterator Top() const;
   // Returns an iterator pointing to the bottom of the stack.
-  const std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator Bottom()
-      const;
+  std::vector<Mutator>::const_reverse_iterator Bottom() const;
   bool is_empty() const { return vector_.empty(); }
 
   bool operator==(const MutatorsStack& other) const {
-    if (vector_.size() != other.vector_.size()) {
-      return false;
-    }
-    for (size_t i = 0; i < vector_.size(); i++) {
-      if (*vector_[i] != *other.vector_[i]) {
-        return false;
-      }
-    }
-    return true;
+    return vector_ == other.vector_;
   }
 
   bool operator==(const std::vector<Mutator>& other) const {
-    if (vector_.size() != other.size()) {
-      return false;
-    }
-    for (size_t i = 0; i < vector_.size(); i++) {
-      if (*vector_[i] != other[i]) {
-        return false;
-      }
-    }
-    return true;
+    return vector_ == other;
   }
 
   bool operator!=(const MutatorsStack& other) const {
@@ -179,7 +191,11 @@ class MutatorsStack {
   }
 
  private:
-  std::vector<std::shared_ptr<Mutator>> vector_;
+  // Mutators are stored by value: a push is an in-place construction into
+  // the vector's storage, which is retained across pops and rebuilds, so
+  // re-populating the stack every frame for every platform view performs no
+  // heap allocations in the steady state (clip paths excepted).
+  std::vector<Mutator> vector_;
 };  // MutatorsStack
 
 class EmbeddedViewParams {
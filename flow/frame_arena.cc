@@ -0,0 +1,47 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/frame_arena.h"
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+FrameArena::FrameArena() = default;
+
+FrameArena::~FrameArena() = default;
+
+void* FrameArena::Allocate(size_t size, size_t alignment) {
+  FML_DCHECK(alignment > 0 && alignment <= alignof(std::max_align_t));
+
+  if (!slabs_.empty()) {
+    Slab& slab = slabs_.back();
+    size_t aligned_offset = (offset_ + alignment - 1) & ~(alignment - 1);
+    if (aligned_offset + size <= slab.size) {
+      offset_ = aligned_offset + size;
+      return slab.memory.get() + aligned_offset;
+    }
+  }
+
+  // Oversized requests get a dedicated slab inserted behind the bump slab so
+  // that the remaining space in the bump slab is not wasted.
+  if (size > kSlabSize) {
+    Slab slab{std::make_unique<uint8_t[]>(size), size};
+    void* memory = slab.memory.get();
+    if (slabs_.empty()) {
+      slabs_.push_back(std::move(slab));
+      // The dedicated slab is fully consumed; it must not be bumped into.
+      offset_ = size;
+    } else {
+      slabs_.insert(slabs_.end() - 1, std::move(slab));
+    }
+    return memory;
+  }
+
+  slabs_.push_back({std::make_unique<uint8_t[]>(kSlabSize), kSlabSize});
+  offset_ = size;
+  return slabs_.back().memory.get();
+}
+
+}  // namespace flutter
@@ -0,0 +1,98 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_FRAME_ARENA_H_
+#define FLUTTER_FLOW_FRAME_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+// A bump allocator for the many small objects built while describing a single
+// frame (layers and their bookkeeping). Allocations are satisfied by bumping
+// a pointer within slabs of memory; individual deallocations are no-ops and
+// all slabs are released wholesale when the arena is destroyed. This trades a
+// modest amount of slack within each slab for eliminating a malloc/free pair
+// per object on the UI thread.
+//
+// The arena itself is not thread safe; all allocations for a frame happen on
+// the UI thread while the frame is being described.
+class FrameArena {
+ public:
+  FrameArena();
+
+  ~FrameArena();
+
+  // Returns memory of at least |size| bytes aligned to |alignment|. The
+  // returned memory remains valid until the arena is destroyed. |alignment|
+  // must not exceed alignof(std::max_align_t).
+  void* Allocate(size_t size, size_t alignment);
+
+  size_t slab_count() const { return slabs_.size(); }
+
+ private:
+  static constexpr size_t kSlabSize = 64 * 1024;
+
+  struct Slab {
+    std::unique_ptr<uint8_t[]> memory;
+    size_t size;
+  };
+
+  std::vector<Slab> slabs_;
+  // Bump offset into the last slab.
+  size_t offset_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameArena);
+};
+
+// An STL compatible allocator that serves allocations from a shared
+// |FrameArena|. Every copy of the allocator (including the copies captured in
+// shared_ptr control blocks by std::allocate_shared) keeps the arena alive,
+// so objects that happen to outlive the frame (such as engine layers retained
+// by the framework) remain valid until the last of them goes away.
+template <typename T>
+class FrameArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit FrameArenaAllocator(std::shared_ptr<FrameArena> arena)
+      : arena_(std::move(arena)) {}
+
+  template <typename U>
+  FrameArenaAllocator(const FrameArenaAllocator<U>& other)
+      : arena_(other.arena()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  // Memory is reclaimed wholesale when the arena dies.
+  void deallocate(T* ptr, size_t n) {}
+
+  const std::shared_ptr<FrameArena>& arena() const { return arena_; }
+
+ private:
+  std::shared_ptr<FrameArena> arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const FrameArenaAllocator<T>& lhs,
+                const FrameArenaAllocator<U>& rhs) {
+  return lhs.arena() == rhs.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const FrameArenaAllocator<T>& lhs,
+                const FrameArenaAllocator<U>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_FRAME_ARENA_H_
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/frame_arena.h"
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(FrameArenaTest, BumpsWithinASingleSlab) {
+  FrameArena arena;
+
+  void* first = arena.Allocate(64, alignof(std::max_align_t));
+  void* second = arena.Allocate(64, alignof(std::max_align_t));
+
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  ASSERT_NE(first, second);
+  ASSERT_EQ(arena.slab_count(), 1u);
+}
+
+TEST(FrameArenaTest, RespectsAlignment) {
+  FrameArena arena;
+
+  arena.Allocate(1, 1);
+  void* aligned = arena.Allocate(8, 8);
+
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(aligned) % 8, 0u);
+}
+
+TEST(FrameArenaTest, OversizedAllocationsGetDedicatedSlabs) {
+  FrameArena arena;
+
+  void* small = arena.Allocate(16, alignof(std::max_align_t));
+  void* large = arena.Allocate(256 * 1024, alignof(std::max_align_t));
+  void* next_small = arena.Allocate(16, alignof(std::max_align_t));
+
+  ASSERT_NE(small, nullptr);
+  ASSERT_NE(large, nullptr);
+  ASSERT_NE(next_small, nullptr);
+  // The oversized request must not have disturbed the bump slab.
+  ASSERT_EQ(arena.slab_count(), 2u);
+}
+
+TEST(FrameArenaTest, AllocatorKeepsArenaAliveForOutlivingObjects) {
+  auto arena = std::make_shared<FrameArena>();
+  std::shared_ptr<int> object;
+  {
+    FrameArenaAllocator<int> allocator(arena);
+    object = std::allocate_shared<int>(allocator, 42);
+  }
+  arena.reset();
+
+  // The control block holds a copy of the allocator which in turn holds the
+  // arena, so the object remains valid.
+  ASSERT_EQ(*object, 42);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -15,12 +15,38 @@ class BackdropFilterLayer : public ContainerLayer {
  public:
   BackdropFilterLayer(sk_sp<SkImageFilter> filter);
 
+  // Tells the layer that its filter is a Gaussian blur with the given sigmas.
+  // Large blurs opt into a fast mode that captures the backdrop at reduced
+  // resolution, blurs the smaller image with a proportionally smaller sigma
+  // and scales the result back up; the heavy blur hides the resampling.
+  // Small blurs keep the exact full resolution filter.
+  void SetBlurParameters(SkScalar sigma_x, SkScalar sigma_y);
+
   void Preroll(PrerollContext* context, const SkMatrix& matrix) override;
 
   void Paint(PaintContext& context) const override;
 
+  const char* layer_type() const override { return "BackdropFilterLayer"; }
+
+  // The children composite over a filtered readback of the backdrop, so
+  // nothing in this subtree can be treated as opaque coverage.
+  bool SubtreeCanOcclude() const override { return false; }
+
+  // Two backdrop blurs with identical sigmas filter identically, so the
+  // damage diff can fall through to the readback region check instead of
+  // unconditionally repainting. Filters of unknown shape stay conservative.
+  bool CompareForDamage(const Layer& old_layer) const override;
+
+  // The filter samples everything painted beneath the layer's bounds.
+  SkRect BackdropReadbackRegion() const override { return paint_bounds(); }
+
  private:
   sk_sp<SkImageFilter> filter_;
+  // The reduced resolution filter chain, or nullptr when the exact filter
+  // should be used.
+  sk_sp<SkImageFilter> fast_blur_filter_;
+  SkScalar blur_sigma_x_ = -1;
+  SkScalar blur_sigma_y_ = -1;
 
   FML_DISALLOW_COPY_AND_ASSIGN(BackdropFilterLayer);
 };
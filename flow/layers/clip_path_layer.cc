@@ -4,6 +4,8 @@
 
 #include "flutter/flow/layers/clip_path_layer.h"
 
+#include <cstring>
+
 #if defined(OS_FUCHSIA)
 
 #include "lib/ui/scenic/cpp/commands.h"
@@ -17,6 +19,15 @@ ClipPathLayer::ClipPathLayer(const SkPath& clip_path, Clip clip_behavior)
   FML_DCHECK(clip_behavior != Clip::none);
 }
 
+bool ClipPathLayer::CompareForDamage(const Layer& old_layer) const {
+  if (strcmp(old_layer.layer_type(), layer_type()) != 0) {
+    return false;
+  }
+  const auto& old_clip_layer = static_cast<const ClipPathLayer&>(old_layer);
+  return clip_path_ == old_clip_layer.clip_path_ &&
+         clip_behavior_ == old_clip_layer.clip_behavior_;
+}
+
 void ClipPathLayer::Preroll(PrerollContext* context, const SkMatrix& matrix) {
   TRACE_EVENT0("flutter", "ClipPathLayer::Preroll");
 
@@ -63,6 +74,11 @@ void ClipPathLayer::Paint(PaintContext& context) const {
   }
 
   SkAutoCanvasRestore save(context.internal_nodes_canvas, true);
+
+  if (UsesSaveLayer() && PaintWithCachedClipMask(context)) {
+    return;
+  }
+
   context.internal_nodes_canvas->clipPath(clip_path_,
                                           clip_behavior_ != Clip::hardEdge);
 
@@ -75,4 +91,42 @@ void ClipPathLayer::Paint(PaintContext& context) const {
   }
 }
 
+bool ClipPathLayer::PaintWithCachedClipMask(PaintContext& context) const {
+  if (!context.raster_cache) {
+    return false;
+  }
+
+  // Content hashing a path of arbitrary complexity every frame could cost
+  // more than the mask saves, so paths key by generation id instead: the
+  // mask is shared across frames for a retained layer but not across
+  // distinct-yet-equal paths. The high bit separates this namespace from
+  // the rrect geometry hashes.
+  const uint64_t shape_key =
+      static_cast<uint64_t>(clip_path_.getGenerationID()) | (1ULL << 63);
+  const RasterCacheResult* mask = context.raster_cache->GetClipMask(
+      shape_key, context.gr_context,
+      RasterCache::GetIntegralTransCTM(
+          context.leaf_nodes_canvas->getTotalMatrix()),
+      clip_path_.getBounds(), [this](SkCanvas* canvas) {
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        canvas->drawPath(clip_path_, paint);
+      });
+  if (!mask) {
+    return false;
+  }
+
+  // A hard clip to the path bounds limits the offscreen; the mask then
+  // applies the anti-aliased path coverage to the finished children with a
+  // single kDstIn multiply.
+  context.internal_nodes_canvas->clipRect(clip_path_.getBounds());
+  context.internal_nodes_canvas->saveLayer(paint_bounds(), nullptr);
+  PaintChildren(context);
+  SkPaint mask_paint;
+  mask_paint.setBlendMode(SkBlendMode::kDstIn);
+  mask->draw(*context.leaf_nodes_canvas, &mask_paint);
+  context.internal_nodes_canvas->restore();
+  return true;
+}
+
 }  // namespace flutter
@@ -21,11 +21,22 @@ class ClipPathLayer : public ContainerLayer {
     return clip_behavior_ == Clip::antiAliasWithSaveLayer;
   }
 
+  const char* layer_type() const override { return "ClipPathLayer"; }
+
+  // An arbitrary clip path invalidates the children's opaque bounds claims.
+  bool SubtreeCanOcclude() const override { return false; }
+  bool CompareForDamage(const Layer& old_layer) const override;
+
 #if defined(OS_FUCHSIA)
   void UpdateScene(SceneUpdateContext& context) override;
 #endif  // defined(OS_FUCHSIA)
 
  private:
+  // Same cached-mask strategy as |ClipRRectLayer::PaintWithCachedClipMask|,
+  // but keyed by the path's generation id rather than a geometry hash: see
+  // the note at the call site.
+  bool PaintWithCachedClipMask(PaintContext& context) const;
+
   SkPath clip_path_;
   Clip clip_behavior_;
   bool children_inside_clip_ = false;
@@ -4,6 +4,8 @@
 
 #include "flutter/flow/layers/clip_rect_layer.h"
 
+#include <cstring>
+
 namespace flutter {
 
 ClipRectLayer::ClipRectLayer(const SkRect& clip_rect, Clip clip_behavior)
@@ -11,6 +13,15 @@ ClipRectLayer::ClipRectLayer(const SkRect& clip_rect, Clip clip_behavior)
   FML_DCHECK(clip_behavior != Clip::none);
 }
 
+bool ClipRectLayer::CompareForDamage(const Layer& old_layer) const {
+  if (strcmp(old_layer.layer_type(), layer_type()) != 0) {
+    return false;
+  }
+  const auto& old_clip_layer = static_cast<const ClipRectLayer&>(old_layer);
+  return clip_rect_ == old_clip_layer.clip_rect_ &&
+         clip_behavior_ == old_clip_layer.clip_behavior_;
+}
+
 void ClipRectLayer::Preroll(PrerollContext* context, const SkMatrix& matrix) {
   TRACE_EVENT0("flutter", "ClipRectLayer::Preroll");
 
@@ -20,6 +20,14 @@ class ClipRectLayer : public ContainerLayer {
     return clip_behavior_ == Clip::antiAliasWithSaveLayer;
   }
 
+  const char* layer_type() const override { return "ClipRectLayer"; }
+  bool CompareForDamage(const Layer& old_layer) const override;
+
+  bool GetChildOcclusionClip(SkRect* local_clip) const override {
+    *local_clip = clip_rect_;
+    return true;
+  }
+
 #if defined(OS_FUCHSIA)
   void UpdateScene(SceneUpdateContext& context) override;
 #endif  // defined(OS_FUCHSIA)
@@ -4,6 +4,8 @@
 
 #include "flutter/flow/layers/clip_rrect_layer.h"
 
+#include <cstring>
+
 namespace flutter {
 
 ClipRRectLayer::ClipRRectLayer(const SkRRect& clip_rrect, Clip clip_behavior)
@@ -11,6 +13,15 @@ ClipRRectLayer::ClipRRectLayer(const SkRRect& clip_rrect, Clip clip_behavior)
   FML_DCHECK(clip_behavior != Clip::none);
 }
 
+bool ClipRRectLayer::CompareForDamage(const Layer& old_layer) const {
+  if (strcmp(old_layer.layer_type(), layer_type()) != 0) {
+    return false;
+  }
+  const auto& old_clip_layer = static_cast<const ClipRRectLayer&>(old_layer);
+  return clip_rrect_ == old_clip_layer.clip_rrect_ &&
+         clip_behavior_ == old_clip_layer.clip_behavior_;
+}
+
 void ClipRRectLayer::Preroll(PrerollContext* context, const SkMatrix& matrix) {
   TRACE_EVENT0("flutter", "ClipRRectLayer::Preroll");
 
@@ -57,6 +68,11 @@ void ClipRRectLayer::Paint(PaintContext& context) const {
   }
 
   SkAutoCanvasRestore save(context.internal_nodes_canvas, true);
+
+  if (UsesSaveLayer() && PaintWithCachedClipMask(context)) {
+    return;
+  }
+
   context.internal_nodes_canvas->clipRRect(clip_rrect_,
                                            clip_behavior_ != Clip::hardEdge);
 
@@ -69,4 +85,38 @@ void ClipRRectLayer::Paint(PaintContext& context) const {
   }
 }
 
+bool ClipRRectLayer::PaintWithCachedClipMask(PaintContext& context) const {
+  if (!context.raster_cache) {
+    return false;
+  }
+
+  // RRects key by their geometry bytes, so every card sharing the same
+  // rounded rectangle resolves to the same mask entry.
+  const RasterCacheResult* mask = context.raster_cache->GetClipMask(
+      RasterCache::HashClipShape(&clip_rrect_, sizeof(clip_rrect_)),
+      context.gr_context,
+      RasterCache::GetIntegralTransCTM(
+          context.leaf_nodes_canvas->getTotalMatrix()),
+      clip_rrect_.getBounds(), [this](SkCanvas* canvas) {
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        canvas->drawRRect(clip_rrect_, paint);
+      });
+  if (!mask) {
+    return false;
+  }
+
+  // A hard clip to the shape bounds limits the offscreen; the mask then
+  // carves the rounded corners out of the finished children with a single
+  // kDstIn multiply.
+  context.internal_nodes_canvas->clipRect(clip_rrect_.getBounds());
+  context.internal_nodes_canvas->saveLayer(paint_bounds(), nullptr);
+  PaintChildren(context);
+  SkPaint mask_paint;
+  mask_paint.setBlendMode(SkBlendMode::kDstIn);
+  mask->draw(*context.leaf_nodes_canvas, &mask_paint);
+  context.internal_nodes_canvas->restore();
+  return true;
+}
+
 }  // namespace flutter
@@ -21,11 +21,25 @@ class ClipRRectLayer : public ContainerLayer {
     return clip_behavior_ == Clip::antiAliasWithSaveLayer;
   }
 
+  const char* layer_type() const override { return "ClipRRectLayer"; }
+
+  // The rounded corners cut transparent notches out of the children's
+  // opaque bounds.
+  bool SubtreeCanOcclude() const override { return false; }
+  bool CompareForDamage(const Layer& old_layer) const override;
+
 #if defined(OS_FUCHSIA)
   void UpdateScene(SceneUpdateContext& context) override;
 #endif  // defined(OS_FUCHSIA)
 
  private:
+  // Paints the children into a hard clipped saveLayer and applies a cached
+  // anti-aliased coverage mask of the rrect instead of letting the clip
+  // evaluate edge coverage per draw. Returns false when no raster cache is
+  // available or the mask could not be rasterized; the caller then falls
+  // back to the plain anti-aliased clip.
+  bool PaintWithCachedClipMask(PaintContext& context) const;
+
   SkRRect clip_rrect_;
   Clip clip_behavior_;
   bool children_inside_clip_ = false;
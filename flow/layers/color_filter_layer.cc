@@ -14,12 +14,35 @@ void ColorFilterLayer::Preroll(PrerollContext* context,
   Layer::AutoPrerollSaveLayerState save =
       Layer::AutoPrerollSaveLayerState::Create(context);
   ContainerLayer::Preroll(context, matrix);
+
+  // Cache the layer itself rather than its children so the entry holds the
+  // filtered output: a hit then skips the saveLayer as well as the subtree
+  // walk. The framework only retains this layer while both the filter and
+  // the child content are unchanged, so the |unique_id| key invalidates on
+  // either changing.
+  if (render_count_ >= kMinimumRendersBeforeCachingFilterLayer) {
+    SkMatrix ctm = matrix;
+#ifndef SUPPORT_FRACTIONAL_TRANSLATION
+    ctm = RasterCache::GetIntegralTransCTM(ctm);
+#endif
+    TryToPrepareRasterCache(context, this, ctm);
+  } else {
+    render_count_++;
+  }
 }
 
 void ColorFilterLayer::Paint(PaintContext& context) const {
   TRACE_EVENT0("flutter", "ColorFilterLayer::Paint");
   FML_DCHECK(needs_painting());
 
+  // The lookup tolerates a fractional canvas translation: the key ignores
+  // translation and the cached image is blitted at the residual sub-pixel
+  // offset.
+  if (context.raster_cache &&
+      context.raster_cache->Draw(this, *context.leaf_nodes_canvas)) {
+    return;
+  }
+
   SkPaint paint;
   paint.setColorFilter(filter_);
 
@@ -19,8 +19,19 @@ class ColorFilterLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* layer_type() const override { return "ColorFilterLayer"; }
+
+  // The filter may introduce transparency into otherwise opaque children.
+  bool SubtreeCanOcclude() const override { return false; }
+
+  // Conservative: filter equality is not tracked frame to frame.
+  bool CompareForDamage(const Layer& old_layer) const override {
+    return false;
+  }
+
  private:
   sk_sp<SkColorFilter> filter_;
+  int render_count_ = 1;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ColorFilterLayer);
 };
@@ -214,5 +214,37 @@ TEST_F(ColorFilterLayerTest, Readback) {
   EXPECT_FALSE(preroll_context()->surface_needs_readback);
 }
 
+TEST_F(ColorFilterLayerTest, CacheableAfterStableFrames) {
+  auto layer_filter = SkColorFilters::LinearToSRGBGamma();
+  auto initial_transform = SkMatrix::MakeTrans(50.0, 25.5);
+  auto other_transform = SkMatrix::MakeScale(1.0, 2.0);
+  const SkPath child_path = SkPath().addRect(SkRect::MakeWH(5.0f, 5.0f));
+  auto mock_layer = std::make_shared<MockLayer>(child_path);
+  auto layer = std::make_shared<ColorFilterLayer>(layer_filter);
+  layer->Add(mock_layer);
+
+  SkMatrix cache_ctm = initial_transform;
+  SkCanvas cache_canvas;
+  cache_canvas.setMatrix(cache_ctm);
+  SkCanvas other_canvas;
+  other_canvas.setMatrix(other_transform);
+
+  use_mock_raster_cache();
+
+  // The filtered output is not cached until the layer has rendered
+  // kMinimumRendersBeforeCachingFilterLayer times.
+  layer->Preroll(preroll_context(), initial_transform);
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_EQ(raster_cache()->GetLayerCachedEntriesCount(), (size_t)0);
+  EXPECT_FALSE(raster_cache()->Draw(layer.get(), cache_canvas));
+
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_EQ(raster_cache()->GetLayerCachedEntriesCount(), (size_t)1);
+  EXPECT_FALSE(raster_cache()->Draw(layer.get(), other_canvas));
+  EXPECT_TRUE(raster_cache()->Draw(layer.get(), cache_canvas));
+  // The child is not cached separately; the cached entry is the layer.
+  EXPECT_FALSE(raster_cache()->Draw(mock_layer.get(), cache_canvas));
+}
+
 }  // namespace testing
 }  // namespace flutter
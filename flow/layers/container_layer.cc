@@ -4,10 +4,18 @@
 
 #include "flutter/flow/layers/container_layer.h"
 
+#include <cstring>
+
 namespace flutter {
 
 ContainerLayer::ContainerLayer() {}
 
+bool ContainerLayer::CompareForDamage(const Layer& old_layer) const {
+  // A plain ContainerLayer paints nothing itself; only the type needs to
+  // match so that the children can be diffed pairwise.
+  return strcmp(old_layer.layer_type(), layer_type()) == 0;
+}
+
 void ContainerLayer::Add(std::shared_ptr<Layer> layer) {
   layers_.emplace_back(std::move(layer));
 }
@@ -29,6 +37,23 @@ void ContainerLayer::Paint(PaintContext& context) const {
 void ContainerLayer::PrerollChildren(PrerollContext* context,
                                      const SkMatrix& child_matrix,
                                      SkRect* child_paint_bounds) {
+  const bool retained = retained_this_frame_;
+  retained_this_frame_ = false;
+
+  // A subtree the framework re-added unchanged that is positioned where it
+  // was last frame needs no re-walk: the cached paint bounds still hold and
+  // raster cache entries remain keyed under the same transform. Subtrees
+  // with platform views must always walk so the embedded views are
+  // re-composited, and system composited subtrees keep their per-frame
+  // bookkeeping.
+  if (retained && has_last_preroll_info_ &&
+      child_matrix == last_preroll_matrix_ && !subtree_has_platform_view_ &&
+      !needs_system_composite()) {
+    *child_paint_bounds = last_child_paint_bounds_;
+    context->has_platform_view = false;
+    return;
+  }
+
 #if defined(OS_FUCHSIA)
   child_layer_exists_below_ = context->child_scene_layer_exists_below;
   context->child_scene_layer_exists_below = false;
@@ -64,6 +89,11 @@ void ContainerLayer::PrerollChildren(PrerollContext* context,
   context->child_scene_layer_exists_below =
       context->child_scene_layer_exists_below || child_layer_exists_below_;
 #endif
+
+  has_last_preroll_info_ = true;
+  last_preroll_matrix_ = child_matrix;
+  last_child_paint_bounds_ = *child_paint_bounds;
+  subtree_has_platform_view_ = child_has_platform_view;
 }
 
 void ContainerLayer::PaintChildren(PaintContext& context) const {
@@ -72,7 +102,7 @@ void ContainerLayer::PaintChildren(PaintContext& context) const {
   // Intentionally not tracing here as there should be no self-time
   // and the trace event on this common function has a small overhead.
   for (auto& layer : layers_) {
-    if (layer->needs_painting()) {
+    if (layer->needs_painting() && !layer->is_culled()) {
       layer->Paint(context);
     }
   }
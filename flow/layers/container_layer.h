@@ -25,6 +25,19 @@ class ContainerLayer : public Layer {
 
   const std::vector<std::shared_ptr<Layer>>& layers() const { return layers_; }
 
+  // Dirty-bit protocol for retained subtrees. |SceneBuilder::addRetained|
+  // marks a subtree root that the framework re-added unchanged. During the
+  // next |Preroll|, a marked subtree whose child matrix is unchanged since
+  // its last preroll skips the recursive walk and reuses the cached child
+  // paint bounds (and, transitively, its raster cache entries, which |Paint|
+  // keeps alive). The mark is consumed by that preroll, so a subtree must be
+  // re-marked every frame it is retained.
+  void MarkRetainedThisFrame() { retained_this_frame_ = true; }
+
+  const char* layer_type() const override { return "ContainerLayer"; }
+  bool CompareForDamage(const Layer& old_layer) const override;
+  const ContainerLayer* as_container_layer() const override { return this; }
+
  protected:
   void PrerollChildren(PrerollContext* context,
                        const SkMatrix& child_matrix,
@@ -55,6 +68,15 @@ class ContainerLayer : public Layer {
  private:
   std::vector<std::shared_ptr<Layer>> layers_;
 
+  // State captured by the last full |PrerollChildren| walk, used to decide
+  // whether a retained subtree may skip the walk and to reproduce its
+  // results when it does.
+  bool retained_this_frame_ = false;
+  bool has_last_preroll_info_ = false;
+  bool subtree_has_platform_view_ = false;
+  SkMatrix last_preroll_matrix_;
+  SkRect last_child_paint_bounds_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(ContainerLayer);
 };
 
@@ -198,5 +198,69 @@ TEST_F(ContainerLayerTest, NeedsSystemComposite) {
                                                child_path2, child_paint2}}}));
 }
 
+TEST_F(ContainerLayerTest, RetainedUnchangedSubtreeSkipsChildPreroll) {
+  SkPath child_path;
+  child_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  SkMatrix initial_transform = SkMatrix::MakeTrans(-0.5f, -0.5f);
+
+  auto mock_layer = std::make_shared<MockLayer>(child_path);
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->Add(mock_layer);
+
+  layer->MarkRetainedThisFrame();
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_EQ(layer->paint_bounds(), child_path.getBounds());
+  EXPECT_EQ(mock_layer->parent_cull_rect(), kGiantRect);
+
+  // Shrink the cull rect so a re-walk of the children would be observable.
+  preroll_context()->cull_rect = child_path.getBounds();
+  layer->MarkRetainedThisFrame();
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_EQ(layer->paint_bounds(), child_path.getBounds());
+  EXPECT_EQ(mock_layer->parent_cull_rect(), kGiantRect);  // Child not visited
+}
+
+TEST_F(ContainerLayerTest, RetainedSubtreeWithNewTransformReprerolls) {
+  SkPath child_path;
+  child_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  SkMatrix initial_transform = SkMatrix::MakeTrans(-0.5f, -0.5f);
+  SkMatrix new_transform = SkMatrix::MakeTrans(2.0f, 2.0f);
+
+  auto mock_layer = std::make_shared<MockLayer>(child_path);
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->Add(mock_layer);
+
+  layer->MarkRetainedThisFrame();
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_EQ(mock_layer->parent_matrix(), initial_transform);
+
+  layer->MarkRetainedThisFrame();
+  layer->Preroll(preroll_context(), new_transform);
+  EXPECT_EQ(mock_layer->parent_matrix(), new_transform);
+}
+
+TEST_F(ContainerLayerTest, RetainedSubtreeWithPlatformViewReprerolls) {
+  SkPath child_path;
+  child_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  SkMatrix initial_transform = SkMatrix::MakeTrans(-0.5f, -0.5f);
+
+  auto mock_layer = std::make_shared<MockLayer>(
+      child_path, SkPaint(), true /* fake_has_platform_view */);
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->Add(mock_layer);
+
+  layer->MarkRetainedThisFrame();
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_TRUE(preroll_context()->has_platform_view);
+  EXPECT_EQ(mock_layer->parent_cull_rect(), kGiantRect);
+
+  preroll_context()->has_platform_view = false;
+  preroll_context()->cull_rect = child_path.getBounds();
+  layer->MarkRetainedThisFrame();
+  layer->Preroll(preroll_context(), initial_transform);
+  EXPECT_TRUE(preroll_context()->has_platform_view);
+  EXPECT_EQ(mock_layer->parent_cull_rect(), child_path.getBounds());
+}
+
 }  // namespace testing
 }  // namespace flutter
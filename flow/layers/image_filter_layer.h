@@ -19,6 +19,16 @@ class ImageFilterLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* layer_type() const override { return "ImageFilterLayer"; }
+
+  // Filtered children may end up translucent or displaced.
+  bool SubtreeCanOcclude() const override { return false; }
+
+  // Conservative: filter equality is not tracked frame to frame.
+  bool CompareForDamage(const Layer& old_layer) const override {
+    return false;
+  }
+
  private:
   sk_sp<SkImageFilter> filter_;
   SkRect child_paint_bounds_;
@@ -4,6 +4,9 @@
 
 #include "flutter/flow/layers/layer.h"
 
+#include <algorithm>
+
+#include "flutter/flow/layers/container_layer.h"
 #include "flutter/flow/paint_utils.h"
 #include "third_party/skia/include/core/SkColorFilter.h"
 
@@ -27,6 +30,150 @@ uint64_t Layer::NextUniqueID() {
 
 void Layer::Preroll(PrerollContext* context, const SkMatrix& matrix) {}
 
+void Layer::DiffForDamage(const Layer* new_layer,
+                          const Layer* old_layer,
+                          const SkMatrix& matrix,
+                          SkRect* damage) {
+  if (new_layer == old_layer) {
+    // A retained layer: the engine guarantees that a layer reused across
+    // frames (and everything below it) is unchanged.
+    return;
+  }
+
+  if (new_layer == nullptr || old_layer == nullptr ||
+      !new_layer->CompareForDamage(*old_layer)) {
+    // The subtree was added, removed, or paints differently. Both the old
+    // and the new footprint must be repainted.
+    SkRect mapped;
+    if (new_layer != nullptr) {
+      matrix.mapRect(&mapped, new_layer->paint_bounds());
+      damage->join(mapped);
+    }
+    if (old_layer != nullptr) {
+      matrix.mapRect(&mapped, old_layer->paint_bounds());
+      damage->join(mapped);
+    }
+    return;
+  }
+
+  // The diff visits layers in paint order, so |damage| currently holds the
+  // changes of everything painted beneath this layer. A layer that samples
+  // the backdrop paints stale content if that damage reaches into its
+  // readback region, even though the layer itself is unchanged.
+  const SkRect readback = new_layer->BackdropReadbackRegion();
+  if (!readback.isEmpty()) {
+    SkRect device_readback;
+    matrix.mapRect(&device_readback, readback);
+    if (SkRect::Intersects(device_readback, *damage)) {
+      damage->join(device_readback);
+    }
+  }
+
+  const ContainerLayer* new_container = new_layer->as_container_layer();
+  const ContainerLayer* old_container = old_layer->as_container_layer();
+  if (new_container == nullptr || old_container == nullptr) {
+    // Matching leaf layers paint identical content.
+    return;
+  }
+
+  const SkMatrix child_matrix = new_layer->GetChildMatrix(matrix);
+  const auto& new_children = new_container->layers();
+  const auto& old_children = old_container->layers();
+  const size_t common = std::min(new_children.size(), old_children.size());
+  for (size_t i = 0; i < common; i++) {
+    DiffForDamage(new_children[i].get(), old_children[i].get(), child_matrix,
+                  damage);
+  }
+  for (size_t i = common; i < new_children.size(); i++) {
+    DiffForDamage(new_children[i].get(), nullptr, child_matrix, damage);
+  }
+  for (size_t i = common; i < old_children.size(); i++) {
+    DiffForDamage(nullptr, old_children[i].get(), child_matrix, damage);
+  }
+}
+
+void OcclusionTracker::Add(const SkRect& device_rect) {
+  if (device_rect.isEmpty() || Covers(device_rect)) {
+    return;
+  }
+  opaque_rects_.push_back(device_rect);
+}
+
+bool OcclusionTracker::Covers(const SkRect& device_rect) const {
+  if (device_rect.isEmpty()) {
+    return false;
+  }
+  for (const SkRect& opaque_rect : opaque_rects_) {
+    if (opaque_rect.contains(device_rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Layer::CullObscured(Layer* root, const SkMatrix& matrix) {
+  TRACE_EVENT0("flutter", "Layer::CullObscured");
+
+  OcclusionTracker tracker;
+  CullObscuredInternal(root, matrix, kGiantRect, true, &tracker);
+}
+
+void Layer::CullObscuredInternal(Layer* layer,
+                                 const SkMatrix& matrix,
+                                 const SkRect& device_clip,
+                                 bool allow_occlude,
+                                 OcclusionTracker* tracker) {
+  layer->culled_ = false;
+
+  const SkRect device_bounds = matrix.mapRect(layer->paint_bounds());
+  if (!device_bounds.isEmpty() && layer->AllowsOcclusionCulling() &&
+      !layer->needs_system_composite()) {
+    SkRect visible_bounds = device_bounds;
+    // A layer is hidden if the part of it inside the enclosing rectangular
+    // clips is covered by opaque content painted above it (or if the clips
+    // leave nothing visible at all).
+    if (!visible_bounds.intersect(device_clip) ||
+        tracker->Covers(visible_bounds)) {
+      layer->culled_ = true;
+      // The children are never painted either; their flags are refreshed
+      // the next time this subtree is visible.
+      return;
+    }
+  }
+
+  if (const ContainerLayer* container = layer->as_container_layer()) {
+    const SkMatrix child_matrix = layer->GetChildMatrix(matrix);
+    SkRect child_clip = device_clip;
+    SkRect local_clip;
+    if (layer->GetChildOcclusionClip(&local_clip) &&
+        child_matrix.rectStaysRect()) {
+      if (!child_clip.intersect(child_matrix.mapRect(local_clip))) {
+        child_clip = SkRect::MakeEmpty();
+      }
+    }
+    const bool child_allow_occlude =
+        allow_occlude && layer->SubtreeCanOcclude();
+    const auto& children = container->layers();
+    // Reverse paint order, so that when a child is tested every opaque
+    // region painted above it has already been registered.
+    for (auto it = children.rbegin(); it != children.rend(); it++) {
+      CullObscuredInternal(it->get(), child_matrix, child_clip,
+                           child_allow_occlude, tracker);
+    }
+  }
+
+  // The layer's own content paints under its children and any previously
+  // visited layer, so its contribution is registered last. Non axis aligned
+  // transforms turn mapped rectangles into bounding boxes that include
+  // unpainted pixels, so only rect preserving matrices contribute.
+  if (allow_occlude && matrix.rectStaysRect()) {
+    SkRect opaque_bounds = matrix.mapRect(layer->GetOpaqueBounds());
+    if (opaque_bounds.intersect(device_clip)) {
+      tracker->Add(opaque_bounds);
+    }
+  }
+}
+
 Layer::AutoPrerollSaveLayerState::AutoPrerollSaveLayerState(
     PrerollContext* preroll_context,
     bool save_layer_is_active,
@@ -37,8 +37,16 @@
 
 namespace flutter {
 
+class ContainerLayer;
+
 static constexpr SkRect kGiantRect = SkRect::MakeLTRB(-1E9F, -1E9F, 1E9F, 1E9F);
 
+// Filter layers (e.g. |ColorFilterLayer| and |ShaderMaskLayer|) wait this
+// many prerolls before entering their filtered output into the raster cache
+// so that filters over animating subtrees do not rasterize a throwaway image
+// every frame.
+static constexpr int kMinimumRendersBeforeCachingFilterLayer = 3;
+
 // This should be an exact copy of the Clip enum in painting.dart.
 enum Clip { none, hardEdge, antiAlias, antiAliasWithSaveLayer };
 
@@ -54,6 +62,7 @@ struct PrerollContext {
   // These allow us to paint in the end of subtree Preroll.
   const Stopwatch& raster_time;
   const Stopwatch& ui_time;
+  const Stopwatch& gpu_time;
   TextureRegistry& texture_registry;
   const bool checkerboard_offscreen_layers;
 
@@ -73,6 +82,24 @@ struct PrerollContext {
 #endif  // defined(OS_FUCHSIA)
 };
 
+// Accumulates device space rectangles known to be painted fully opaque and
+// answers whether a rectangle is completely covered by one of them. Used by
+// |Layer::CullObscured| to skip painting layers hidden behind opaque content.
+class OcclusionTracker {
+ public:
+  // Registers |device_rect| as fully opaque. No-op for empty rectangles or
+  // rectangles already covered by a registered one.
+  void Add(const SkRect& device_rect);
+
+  // True if |device_rect| lies entirely within a single registered opaque
+  // rectangle. Conservative: coverage assembled from multiple rectangles is
+  // not detected.
+  bool Covers(const SkRect& device_rect) const;
+
+ private:
+  std::vector<SkRect> opaque_rects_;
+};
+
 // Represents a single composited layer. Created on the UI thread but then
 // subquently used on the Rasterizer thread.
 class Layer {
@@ -125,6 +152,7 @@ class Layer {
     ExternalViewEmbedder* view_embedder;
     const Stopwatch& raster_time;
     const Stopwatch& ui_time;
+    const Stopwatch& gpu_time;
     TextureRegistry& texture_registry;
     const RasterCache* raster_cache;
     const bool checkerboard_offscreen_layers;
@@ -185,6 +213,80 @@ class Layer {
 
   uint64_t unique_id() const { return unique_id_; }
 
+  // A tag naming the concrete layer type, used by |DiffForDamage| to decide
+  // whether two layers from consecutive frames can be compared property by
+  // property. Every type that overrides |CompareForDamage| must return a
+  // unique tag here; types that do not override either are conservatively
+  // treated as always different.
+  virtual const char* layer_type() const { return "Layer"; }
+
+  // Returns true only if painting this layer produces output identical to
+  // painting |old_layer|, the layer occupying the same position in the
+  // previous frame's tree. Children are ignored here; they are diffed
+  // separately by |DiffForDamage|. The default reports a difference.
+  virtual bool CompareForDamage(const Layer& old_layer) const { return false; }
+
+  // The region, in this layer's coordinate space, that the layer samples
+  // from the content painted beneath it (e.g. a backdrop filter readback).
+  // |DiffForDamage| re-damages this region whenever damage accumulated from
+  // content painted earlier intersects it, since the sampled pixels are then
+  // stale. Empty for layers that do not read the backdrop.
+  virtual SkRect BackdropReadbackRegion() const { return SkRect::MakeEmpty(); }
+
+  // Non-null if this layer's children participate in |DiffForDamage|.
+  virtual const ContainerLayer* as_container_layer() const { return nullptr; }
+
+  // The matrix this layer's children are painted with, given the matrix this
+  // layer is painted with. Layers that concatenate a transform onto the
+  // canvas before painting children must override this so that damage rects
+  // computed for the children land in the right place.
+  virtual SkMatrix GetChildMatrix(const SkMatrix& matrix) const {
+    return matrix;
+  }
+
+  // Walks the tree front to back (reverse paint order) after Preroll,
+  // accumulating opaque regions and marking layers whose visible device
+  // space bounds are fully covered by content painted above them.
+  // |ContainerLayer::PaintChildren| skips marked layers. |matrix| is the
+  // root surface transformation the tree will be painted with.
+  static void CullObscured(Layer* root, const SkMatrix& matrix);
+
+  // Whether the last |CullObscured| pass found this layer to be entirely
+  // hidden behind opaque content. Only meaningful until the tree's next
+  // preroll.
+  bool is_culled() const { return culled_; }
+
+  // The portion of this layer's own painting, in its local coordinate
+  // space, guaranteed to be fully opaque. Empty for layers that make no
+  // such guarantee.
+  virtual SkRect GetOpaqueBounds() const { return SkRect::MakeEmpty(); }
+
+  // False for layers whose Paint has side effects beyond drawing pixels
+  // (e.g. platform view composition) and so must run even when obscured.
+  virtual bool AllowsOcclusionCulling() const { return true; }
+
+  // False when this layer composites its children with an effect (reduced
+  // opacity, filters, non rectangular clips) that invalidates the opaque
+  // bounds its descendants claim.
+  virtual bool SubtreeCanOcclude() const { return true; }
+
+  // Writes the rectangle, in the children's coordinate space, that this
+  // layer clips its children to. Returns false when children are not
+  // clipped to a rectangle.
+  virtual bool GetChildOcclusionClip(SkRect* local_clip) const {
+    return false;
+  }
+
+  // Joins into |damage| the area that must be repainted because |new_layer|
+  // (from the current frame) paints differently than |old_layer| (the layer
+  // at the same position in the previous frame). Either layer may be null to
+  // indicate an added or removed subtree. |matrix| maps the layers'
+  // paint bounds into the root surface coordinate space.
+  static void DiffForDamage(const Layer* new_layer,
+                            const Layer* old_layer,
+                            const SkMatrix& matrix,
+                            SkRect* damage);
+
  protected:
 #if defined(OS_FUCHSIA)
   bool child_layer_exists_below_ = false;
@@ -194,9 +296,16 @@ class Layer {
   SkRect paint_bounds_;
   uint64_t unique_id_;
   bool needs_system_composite_;
+  bool culled_ = false;
 
   static uint64_t NextUniqueID();
 
+  static void CullObscuredInternal(Layer* layer,
+                                   const SkMatrix& matrix,
+                                   const SkRect& device_clip,
+                                   bool allow_occlude,
+                                   OcclusionTracker* tracker);
+
   FML_DISALLOW_COPY_AND_ASSIGN(Layer);
 };
 
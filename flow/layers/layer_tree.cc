@@ -4,9 +4,15 @@
 
 #include "flutter/flow/layers/layer_tree.h"
 
+#include <algorithm>
+#include <atomic>
+
+#include "flutter/flow/layers/container_layer.h"
 #include "flutter/flow/layers/layer.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
+#include "third_party/skia/include/core/SkSurface.h"
 #include "third_party/skia/include/utils/SkNWayCanvas.h"
 
 namespace flutter {
@@ -28,6 +34,22 @@ void LayerTree::RecordBuildTime(fml::TimePoint build_start,
   build_finish_ = fml::TimePoint::Now();
 }
 
+SkRect LayerTree::ComputeDamage(const LayerTree* old_tree) const {
+  const SkRect frame_bounds =
+      SkRect::MakeIWH(frame_size_.width(), frame_size_.height());
+  if (old_tree == nullptr || old_tree->frame_size_ != frame_size_) {
+    return frame_bounds;
+  }
+
+  SkRect damage = SkRect::MakeEmpty();
+  Layer::DiffForDamage(root_layer_.get(), old_tree->root_layer_.get(),
+                       SkMatrix::I(), &damage);
+  if (!damage.intersect(frame_bounds)) {
+    return SkRect::MakeEmpty();
+  }
+  return damage;
+}
+
 bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
                         bool ignore_raster_cache) {
   TRACE_EVENT0("flutter", "LayerTree::Preroll");
@@ -52,12 +74,19 @@ bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
       false,
       frame.context().raster_time(),
       frame.context().ui_time(),
+      frame.context().gpu_time(),
       frame.context().texture_registry(),
       checkerboard_offscreen_layers_,
       frame_physical_depth_,
       frame_device_pixel_ratio_};
 
   root_layer_->Preroll(&context, frame.root_surface_transformation());
+
+  // With the paint bounds known, a front to back pass can mark layers fully
+  // hidden behind opaque content (e.g. the page underneath an opaque route)
+  // so the paint traversal skips them.
+  Layer::CullObscured(root_layer_.get(), frame.root_surface_transformation());
+
   return context.surface_needs_readback;
 }
 
@@ -105,6 +134,12 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
     return;
   }
 
+  if (frame.context().parallel_raster_loop() != nullptr &&
+      root_layer_->needs_painting() &&
+      TryPaintParallel(frame, ignore_raster_cache)) {
+    return;
+  }
+
   SkISize canvas_size = frame.canvas()->getBaseLayerSize();
   SkNWayCanvas internal_nodes_canvas(canvas_size.width(), canvas_size.height());
   internal_nodes_canvas.addCanvas(frame.canvas());
@@ -122,6 +157,7 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
       frame.view_embedder(),
       frame.context().raster_time(),
       frame.context().ui_time(),
+      frame.context().gpu_time(),
       frame.context().texture_registry(),
       ignore_raster_cache ? nullptr : &frame.context().raster_cache(),
       checkerboard_offscreen_layers_,
@@ -132,6 +168,158 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
     root_layer_->Paint(context);
 }
 
+bool LayerTree::TryPaintParallel(CompositorContext::ScopedFrame& frame,
+                                 bool ignore_raster_cache) const {
+  // A GrContext may only be used from the thread that created it, and
+  // overlay canvases from platform view embedding impose a strict paint
+  // order, so only CPU backed frames without embedding qualify.
+  if (frame.gr_context() != nullptr || frame.view_embedder() != nullptr ||
+      frame.canvas() == nullptr) {
+    return false;
+  }
+
+  const ContainerLayer* container = root_layer_->as_container_layer();
+  if (container == nullptr || container->needs_system_composite()) {
+    return false;
+  }
+
+  std::vector<Layer*> layers;
+  for (const auto& layer : container->layers()) {
+    if (layer->needs_system_composite()) {
+      return false;
+    }
+    if (layer->needs_painting() && !layer->is_culled()) {
+      layers.push_back(layer.get());
+    }
+  }
+  if (layers.size() < 2) {
+    return false;
+  }
+
+  // Top-level paint bounds are in root coordinates; the frame canvas matrix
+  // (the root surface transformation) maps them into device space, where the
+  // frame rectangle and tile surfaces live.
+  const SkMatrix canvas_matrix = frame.canvas()->getTotalMatrix();
+  const SkRect frame_rect = SkRect::Make(frame_size_);
+
+  struct TileGroup {
+    SkRect bounds = SkRect::MakeEmpty();
+    std::vector<size_t> layer_indexes;
+  };
+  std::vector<TileGroup> groups;
+  for (size_t i = 0; i < layers.size(); i++) {
+    SkRect device_bounds = canvas_matrix.mapRect(layers[i]->paint_bounds());
+    if (!device_bounds.intersect(frame_rect)) {
+      continue;  // Entirely off screen.
+    }
+    groups.push_back({device_bounds, {i}});
+  }
+
+  // Merge groups whose device bounds intersect until all group rectangles
+  // are pairwise disjoint. Disjoint groups never share pixels, so they can
+  // be rasterized concurrently and composited in any order; layers within a
+  // merged group keep their paint order.
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (size_t i = 0; i < groups.size() && !merged; i++) {
+      for (size_t j = i + 1; j < groups.size() && !merged; j++) {
+        if (SkRect::Intersects(groups[i].bounds, groups[j].bounds)) {
+          groups[i].bounds.join(groups[j].bounds);
+          groups[i].layer_indexes.insert(groups[i].layer_indexes.end(),
+                                         groups[j].layer_indexes.begin(),
+                                         groups[j].layer_indexes.end());
+          groups.erase(groups.begin() + j);
+          merged = true;
+        }
+      }
+    }
+  }
+  if (groups.size() < 2) {
+    return false;
+  }
+  for (TileGroup& group : groups) {
+    std::sort(group.layer_indexes.begin(), group.layer_indexes.end());
+  }
+
+  TRACE_EVENT0("flutter", "LayerTree::PaintParallel");
+
+  struct TileResult {
+    SkIRect device_bounds;
+    sk_sp<SkImage> image;
+  };
+  std::vector<TileResult> results(groups.size());
+  std::atomic<bool> all_tiles_ok = {true};
+
+  auto paint_group = [&](size_t group_index) {
+    const TileGroup& group = groups[group_index];
+    SkIRect device_bounds;
+    group.bounds.roundOut(&device_bounds);
+    auto surface = SkSurface::MakeRaster(SkImageInfo::MakeN32Premul(
+        device_bounds.width(), device_bounds.height()));
+    if (!surface) {
+      all_tiles_ok.store(false);
+      return;
+    }
+    SkCanvas* tile_canvas = surface->getCanvas();
+    tile_canvas->clear(SK_ColorTRANSPARENT);
+    tile_canvas->translate(-device_bounds.left(), -device_bounds.top());
+    tile_canvas->concat(canvas_matrix);
+
+    SkNWayCanvas internal_nodes_canvas(device_bounds.width(),
+                                       device_bounds.height());
+    internal_nodes_canvas.addCanvas(tile_canvas);
+
+    Layer::PaintContext context = {
+        static_cast<SkCanvas*>(&internal_nodes_canvas),
+        tile_canvas,
+        nullptr,  // gr_context (CPU backed frame)
+        nullptr,  // view embedder
+        frame.context().raster_time(),
+        frame.context().ui_time(),
+        frame.context().gpu_time(),
+        frame.context().texture_registry(),
+        ignore_raster_cache ? nullptr : &frame.context().raster_cache(),
+        checkerboard_offscreen_layers_,
+        frame_physical_depth_,
+        frame_device_pixel_ratio_};
+    for (size_t layer_index : group.layer_indexes) {
+      layers[layer_index]->Paint(context);
+    }
+    results[group_index] = {device_bounds, surface->makeImageSnapshot()};
+  };
+
+  // Workers take all but the first group; the raster thread paints that one
+  // itself instead of idling on the latch.
+  fml::CountDownLatch latch(groups.size() - 1);
+  auto task_runner = frame.context().parallel_raster_loop()->GetTaskRunner();
+  for (size_t i = 1; i < groups.size(); i++) {
+    task_runner->PostTask([&paint_group, &latch, i]() {
+      paint_group(i);
+      latch.CountDown();
+    });
+  }
+  paint_group(0);
+  latch.Wait();
+
+  if (!all_tiles_ok.load()) {
+    // No tile has touched the frame canvas yet; the serial path repaints
+    // everything.
+    return false;
+  }
+
+  SkCanvas* canvas = frame.canvas();
+  SkAutoCanvasRestore save(canvas, true);
+  canvas->resetMatrix();
+  for (const TileResult& result : results) {
+    if (result.image) {
+      canvas->drawImage(result.image, result.device_bounds.left(),
+                        result.device_bounds.top());
+    }
+  }
+  return true;
+}
+
 sk_sp<SkPicture> LayerTree::Flatten(const SkRect& bounds) {
   TRACE_EVENT0("flutter", "LayerTree::Flatten");
 
@@ -187,6 +375,7 @@ sk_sp<SkPicture> LayerTree::Flatten(const SkRect& bounds) {
   // picture.
   if (root_layer_) {
     root_layer_->Preroll(&preroll_context, root_surface_transformation);
+    Layer::CullObscured(root_layer_.get(), root_surface_transformation);
     // The needs painting flag may be set after the preroll. So check it after.
     if (root_layer_->needs_painting()) {
       root_layer_->Paint(paint_context);
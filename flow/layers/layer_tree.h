@@ -44,6 +44,12 @@ class LayerTree {
 
   sk_sp<SkPicture> Flatten(const SkRect& bounds);
 
+  // Computes the area of the frame that must be repainted because it paints
+  // differently than |old_tree|, in physical pixels. Returns the full frame
+  // when there is no old tree to diff against or the frame sizes differ.
+  // Both trees must have been prerolled so that paint bounds are populated.
+  SkRect ComputeDamage(const LayerTree* old_tree) const;
+
   Layer* root_layer() const { return root_layer_.get(); }
 
   void set_root_layer(std::shared_ptr<Layer> root_layer) {
@@ -82,6 +88,15 @@ class LayerTree {
   double device_pixel_ratio() const { return frame_device_pixel_ratio_; }
 
  private:
+  // Paints groups of non-overlapping top-level layers into per-group CPU
+  // surfaces on the compositor context's worker pool and composites the
+  // results onto the frame canvas. Returns false when the frame does not
+  // qualify (GPU backed canvas, embedded platform views, fewer than two
+  // independent groups), in which case nothing has been painted and the
+  // caller must fall back to the serial path.
+  bool TryPaintParallel(CompositorContext::ScopedFrame& frame,
+                        bool ignore_raster_cache) const;
+
   std::shared_ptr<Layer> root_layer_;
   fml::TimePoint build_start_;
   fml::TimePoint build_finish_;
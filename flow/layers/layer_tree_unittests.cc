@@ -5,12 +5,16 @@
 #include "flutter/flow/layers/layer_tree.h"
 
 #include "flutter/flow/compositor_context.h"
+#include "flutter/flow/layers/backdrop_filter_layer.h"
 #include "flutter/flow/layers/container_layer.h"
+#include "flutter/flow/layers/physical_shape_layer.h"
+#include "flutter/flow/layers/transform_layer.h"
 #include "flutter/flow/testing/mock_layer.h"
 #include "flutter/fml/macros.h"
 #include "flutter/testing/canvas_test.h"
 #include "flutter/testing/mock_canvas.h"
 #include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkSurface.h"
 
 namespace flutter {
 namespace testing {
@@ -203,5 +207,257 @@ TEST_F(LayerTreeTest, NeedsSystemComposite) {
                                                child_path2, child_paint2}}}));
 }
 
+TEST_F(LayerTreeTest, ParallelPaintCompositesIndependentLayers) {
+  auto surface = SkSurface::MakeRasterN32Premul(64, 64);
+  CompositorContext compositor_context(fml::kDefaultFrameBudget);
+  compositor_context.EnableParallelRaster();
+  // ScopedFrame holds the transformation by reference.
+  const SkMatrix root_matrix = SkMatrix::I();
+  auto frame =
+      compositor_context.AcquireFrame(nullptr, surface->getCanvas(), nullptr,
+                                      root_matrix, false, true, nullptr);
+
+  SkPaint red_paint;
+  red_paint.setColor(SK_ColorRED);
+  SkPaint blue_paint;
+  blue_paint.setColor(SK_ColorBLUE);
+  auto left_layer = std::make_shared<MockLayer>(
+      SkPath().addRect(SkRect::MakeXYWH(2, 2, 10, 10)), red_paint);
+  auto right_layer = std::make_shared<MockLayer>(
+      SkPath().addRect(SkRect::MakeXYWH(40, 40, 10, 10)), blue_paint);
+  auto root = std::make_shared<ContainerLayer>();
+  root->Add(left_layer);
+  root->Add(right_layer);
+
+  layer_tree().set_root_layer(root);
+  layer_tree().Preroll(*frame);
+  layer_tree().Paint(*frame);
+
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(64, 64);
+  surface->readPixels(bitmap, 0, 0);
+  EXPECT_EQ(bitmap.getColor(5, 5), SK_ColorRED);
+  EXPECT_EQ(bitmap.getColor(45, 45), SK_ColorBLUE);
+  EXPECT_EQ(bitmap.getColor(30, 30),
+            static_cast<SkColor>(SK_ColorTRANSPARENT));
+}
+
+TEST_F(LayerTreeTest, CullsLayerFullyCoveredByOpaqueShape) {
+  const SkPath covered_path = SkPath().addRect(10.0f, 10.0f, 20.0f, 20.0f);
+  const SkPath partial_path = SkPath().addRect(2.0f, 2.0f, 15.0f, 15.0f);
+  auto covered_layer = std::make_shared<MockLayer>(covered_path);
+  auto partial_layer = std::make_shared<MockLayer>(partial_path);
+  // An opaque rectangle painted over both mock layers, covering one of them
+  // entirely.
+  auto opaque_layer = std::make_shared<PhysicalShapeLayer>(
+      SK_ColorGREEN, SK_ColorBLACK, 0.0f /* elevation */,
+      SkPath().addRect(5.0f, 5.0f, 30.0f, 30.0f), Clip::none);
+  auto root = std::make_shared<ContainerLayer>();
+  root->Add(covered_layer);
+  root->Add(partial_layer);
+  root->Add(opaque_layer);
+
+  layer_tree().set_root_layer(root);
+  layer_tree().Preroll(frame());
+  EXPECT_TRUE(covered_layer->is_culled());
+  EXPECT_FALSE(partial_layer->is_culled());
+  EXPECT_FALSE(opaque_layer->is_culled());
+}
+
+TEST_F(LayerTreeTest, DoesNotCullBehindTranslucentShape) {
+  const SkPath covered_path = SkPath().addRect(10.0f, 10.0f, 20.0f, 20.0f);
+  auto covered_layer = std::make_shared<MockLayer>(covered_path);
+  auto translucent_layer = std::make_shared<PhysicalShapeLayer>(
+      SkColorSetARGB(0x80, 0x00, 0xFF, 0x00), SK_ColorBLACK,
+      0.0f /* elevation */, SkPath().addRect(5.0f, 5.0f, 30.0f, 30.0f),
+      Clip::none);
+  auto root = std::make_shared<ContainerLayer>();
+  root->Add(covered_layer);
+  root->Add(translucent_layer);
+
+  layer_tree().set_root_layer(root);
+  layer_tree().Preroll(frame());
+  EXPECT_FALSE(covered_layer->is_culled());
+}
+
+TEST_F(LayerTreeTest, CulledLayerIsNotPainted) {
+  const SkPath covered_path = SkPath().addRect(10.0f, 10.0f, 20.0f, 20.0f);
+  const SkPaint covered_paint(SkColors::kRed);
+  auto covered_layer = std::make_shared<MockLayer>(covered_path, covered_paint);
+  auto opaque_layer = std::make_shared<PhysicalShapeLayer>(
+      SK_ColorGREEN, SK_ColorBLACK, 0.0f /* elevation */,
+      SkPath().addRect(5.0f, 5.0f, 30.0f, 30.0f), Clip::none);
+  auto root = std::make_shared<ContainerLayer>();
+  root->Add(covered_layer);
+  root->Add(opaque_layer);
+
+  layer_tree().set_root_layer(root);
+  layer_tree().Preroll(frame());
+  layer_tree().Paint(frame());
+  for (const MockCanvas::DrawCall& call : mock_canvas().draw_calls()) {
+    auto* draw_path = std::get_if<MockCanvas::DrawPathData>(&call.data);
+    if (draw_path != nullptr) {
+      EXPECT_NE(draw_path->path, covered_path);
+    }
+  }
+}
+
+TEST_F(LayerTreeTest, ComputeDamageWithoutOldTreeIsFullFrame) {
+  auto layer = std::make_shared<ContainerLayer>();
+  layer_tree().set_root_layer(layer);
+
+  EXPECT_EQ(layer_tree().ComputeDamage(nullptr),
+            SkRect::MakeIWH(64, 64));
+}
+
+TEST_F(LayerTreeTest, ComputeDamageWithFrameSizeMismatchIsFullFrame) {
+  auto layer = std::make_shared<ContainerLayer>();
+  layer_tree().set_root_layer(layer);
+
+  LayerTree old_tree(SkISize::Make(32, 32), 100.0f, 1.0f);
+  old_tree.set_root_layer(layer);
+
+  EXPECT_EQ(layer_tree().ComputeDamage(&old_tree),
+            SkRect::MakeIWH(64, 64));
+}
+
+TEST_F(LayerTreeTest, ComputeDamageWithRetainedRootIsEmpty) {
+  auto layer = std::make_shared<ContainerLayer>();
+  layer->set_paint_bounds(SkRect::MakeLTRB(5.0f, 6.0f, 20.5f, 21.5f));
+  layer_tree().set_root_layer(layer);
+
+  LayerTree old_tree(SkISize::Make(64, 64), 100.0f, 1.0f);
+  old_tree.set_root_layer(layer);
+
+  EXPECT_EQ(layer_tree().ComputeDamage(&old_tree), SkRect::MakeEmpty());
+}
+
+TEST_F(LayerTreeTest, ComputeDamageForReplacedChild) {
+  const SkRect retained_bounds = SkRect::MakeLTRB(2.0f, 2.0f, 10.0f, 10.0f);
+  const SkRect old_child_bounds = SkRect::MakeLTRB(5.0f, 6.0f, 20.5f, 21.5f);
+  const SkRect new_child_bounds = SkRect::MakeLTRB(8.0f, 2.0f, 16.5f, 14.5f);
+  auto retained_child = std::make_shared<MockLayer>(SkPath());
+  retained_child->set_paint_bounds(retained_bounds);
+  auto old_child = std::make_shared<MockLayer>(SkPath());
+  old_child->set_paint_bounds(old_child_bounds);
+  auto new_child = std::make_shared<MockLayer>(SkPath());
+  new_child->set_paint_bounds(new_child_bounds);
+
+  auto old_root = std::make_shared<ContainerLayer>();
+  old_root->Add(retained_child);
+  old_root->Add(old_child);
+  auto new_root = std::make_shared<ContainerLayer>();
+  new_root->Add(retained_child);
+  new_root->Add(new_child);
+
+  LayerTree old_tree(SkISize::Make(64, 64), 100.0f, 1.0f);
+  old_tree.set_root_layer(old_root);
+  layer_tree().set_root_layer(new_root);
+
+  // Both the old and the new footprint of the replaced child are dirty; the
+  // retained sibling contributes nothing.
+  SkRect expected_damage = old_child_bounds;
+  expected_damage.join(new_child_bounds);
+  EXPECT_EQ(layer_tree().ComputeDamage(&old_tree), expected_damage);
+}
+
+TEST_F(LayerTreeTest, ComputeDamageMapsThroughTransforms) {
+  const SkRect child_bounds = SkRect::MakeLTRB(5.0f, 6.0f, 20.0f, 21.0f);
+  auto old_child = std::make_shared<MockLayer>(SkPath());
+  old_child->set_paint_bounds(child_bounds);
+  auto new_child = std::make_shared<MockLayer>(SkPath());
+  new_child->set_paint_bounds(child_bounds);
+
+  const SkMatrix transform = SkMatrix::MakeTrans(10.0f, 10.0f);
+  auto old_root = std::make_shared<TransformLayer>(transform);
+  old_root->Add(old_child);
+  auto new_root = std::make_shared<TransformLayer>(transform);
+  new_root->Add(new_child);
+
+  LayerTree old_tree(SkISize::Make(64, 64), 100.0f, 1.0f);
+  old_tree.set_root_layer(old_root);
+  layer_tree().set_root_layer(new_root);
+
+  // The transform layers match, so only the replaced child is dirty, in the
+  // transformed coordinate space.
+  EXPECT_EQ(layer_tree().ComputeDamage(&old_tree),
+            child_bounds.makeOffset(10.0f, 10.0f));
+}
+
+TEST_F(LayerTreeTest, ComputeDamageRefiltersBackdropOverChangedContent) {
+  const SkRect backdrop_bounds = SkRect::MakeLTRB(0.0f, 40.0f, 64.0f, 64.0f);
+  const SkRect old_content_bounds = SkRect::MakeLTRB(5.0f, 45.0f, 15.0f, 55.0f);
+  const SkRect new_content_bounds =
+      SkRect::MakeLTRB(20.0f, 45.0f, 30.0f, 55.0f);
+  auto old_content = std::make_shared<MockLayer>(SkPath());
+  old_content->set_paint_bounds(old_content_bounds);
+  auto new_content = std::make_shared<MockLayer>(SkPath());
+  new_content->set_paint_bounds(new_content_bounds);
+  auto retained_child = std::make_shared<MockLayer>(SkPath());
+  retained_child->set_paint_bounds(backdrop_bounds);
+
+  auto make_backdrop = [&]() {
+    auto backdrop = std::make_shared<BackdropFilterLayer>(nullptr);
+    backdrop->SetBlurParameters(10.0f, 10.0f);
+    backdrop->Add(retained_child);
+    backdrop->set_paint_bounds(backdrop_bounds);
+    return backdrop;
+  };
+  auto old_root = std::make_shared<ContainerLayer>();
+  old_root->Add(old_content);
+  old_root->Add(make_backdrop());
+  auto new_root = std::make_shared<ContainerLayer>();
+  new_root->Add(new_content);
+  new_root->Add(make_backdrop());
+
+  LayerTree old_tree(SkISize::Make(64, 64), 100.0f, 1.0f);
+  old_tree.set_root_layer(old_root);
+  layer_tree().set_root_layer(new_root);
+
+  // The content underneath the readback moved, so the filtered result is
+  // stale and the whole backdrop region joins the damage.
+  SkRect expected_damage = old_content_bounds;
+  expected_damage.join(new_content_bounds);
+  expected_damage.join(backdrop_bounds);
+  EXPECT_EQ(layer_tree().ComputeDamage(&old_tree), expected_damage);
+}
+
+TEST_F(LayerTreeTest, ComputeDamageReusesBackdropOverUnchangedContent) {
+  const SkRect backdrop_bounds = SkRect::MakeLTRB(0.0f, 40.0f, 64.0f, 64.0f);
+  const SkRect old_content_bounds = SkRect::MakeLTRB(5.0f, 5.0f, 15.0f, 15.0f);
+  const SkRect new_content_bounds =
+      SkRect::MakeLTRB(20.0f, 5.0f, 30.0f, 15.0f);
+  auto old_content = std::make_shared<MockLayer>(SkPath());
+  old_content->set_paint_bounds(old_content_bounds);
+  auto new_content = std::make_shared<MockLayer>(SkPath());
+  new_content->set_paint_bounds(new_content_bounds);
+  auto retained_child = std::make_shared<MockLayer>(SkPath());
+  retained_child->set_paint_bounds(backdrop_bounds);
+
+  auto make_backdrop = [&]() {
+    auto backdrop = std::make_shared<BackdropFilterLayer>(nullptr);
+    backdrop->SetBlurParameters(10.0f, 10.0f);
+    backdrop->Add(retained_child);
+    backdrop->set_paint_bounds(backdrop_bounds);
+    return backdrop;
+  };
+  auto old_root = std::make_shared<ContainerLayer>();
+  old_root->Add(old_content);
+  old_root->Add(make_backdrop());
+  auto new_root = std::make_shared<ContainerLayer>();
+  new_root->Add(new_content);
+  new_root->Add(make_backdrop());
+
+  LayerTree old_tree(SkISize::Make(64, 64), 100.0f, 1.0f);
+  old_tree.set_root_layer(old_root);
+  layer_tree().set_root_layer(new_root);
+
+  // The change is entirely outside the readback region, so the previously
+  // filtered pixels are still valid and the backdrop is not re-damaged.
+  SkRect expected_damage = old_content_bounds;
+  expected_damage.join(new_content_bounds);
+  EXPECT_EQ(layer_tree().ComputeDamage(&old_tree), expected_damage);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -4,6 +4,8 @@
 
 #include "flutter/flow/layers/opacity_layer.h"
 
+#include <cstring>
+
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkPaint.h"
 
@@ -25,6 +27,22 @@ void OpacityLayer::Add(std::shared_ptr<Layer> layer) {
   GetChildContainer()->Add(std::move(layer));
 }
 
+bool OpacityLayer::CompareForDamage(const Layer& old_layer) const {
+  if (strcmp(old_layer.layer_type(), layer_type()) != 0) {
+    return false;
+  }
+  const auto& old_opacity_layer = static_cast<const OpacityLayer&>(old_layer);
+  return alpha_ == old_opacity_layer.alpha_ &&
+         offset_ == old_opacity_layer.offset_;
+}
+
+SkMatrix OpacityLayer::GetChildMatrix(const SkMatrix& matrix) const {
+  // Children are painted after the canvas is translated by |offset_|.
+  SkMatrix child_matrix = matrix;
+  child_matrix.preTranslate(offset_.fX, offset_.fY);
+  return child_matrix;
+}
+
 void OpacityLayer::Preroll(PrerollContext* context, const SkMatrix& matrix) {
   TRACE_EVENT0("flutter", "OpacityLayer::Preroll");
 
@@ -72,17 +90,22 @@ void OpacityLayer::Paint(PaintContext& context) const {
   SkAutoCanvasRestore save(context.internal_nodes_canvas, true);
   context.internal_nodes_canvas->translate(offset_.fX, offset_.fY);
 
-#ifndef SUPPORT_FRACTIONAL_TRANSLATION
-  context.internal_nodes_canvas->setMatrix(RasterCache::GetIntegralTransCTM(
-      context.leaf_nodes_canvas->getTotalMatrix()));
-#endif
-
+  // Look the cache up with the fractional translation intact: the key
+  // ignores translation and RasterCacheResult::draw blits the integrally
+  // rasterized image at the residual sub-pixel offset. A fading or slowly
+  // drifting subtree therefore reuses a single full opacity rendering of the
+  // child, modulated here by the paint alpha.
   if (context.raster_cache &&
       context.raster_cache->Draw(GetCacheableChild(),
                                  *context.leaf_nodes_canvas, &paint)) {
     return;
   }
 
+#ifndef SUPPORT_FRACTIONAL_TRANSLATION
+  context.internal_nodes_canvas->setMatrix(RasterCache::GetIntegralTransCTM(
+      context.leaf_nodes_canvas->getTotalMatrix()));
+#endif
+
   // Skia may clip the content with saveLayerBounds (although it's not a
   // guaranteed clip). So we have to provide a big enough saveLayerBounds. To do
   // so, we first remove the offset from paint bounds since it's already in the
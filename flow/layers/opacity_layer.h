@@ -33,6 +33,13 @@ class OpacityLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* layer_type() const override { return "OpacityLayer"; }
+  bool CompareForDamage(const Layer& old_layer) const override;
+  SkMatrix GetChildMatrix(const SkMatrix& matrix) const override;
+
+  // Translucent children cannot hide what is painted underneath them.
+  bool SubtreeCanOcclude() const override { return alpha_ == SK_AlphaOPAQUE; }
+
 #if defined(OS_FUCHSIA)
   void UpdateScene(SceneUpdateContext& context) override;
 #endif  // defined(OS_FUCHSIA)
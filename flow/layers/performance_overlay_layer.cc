@@ -4,6 +4,8 @@
 
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
 
 #include "flutter/flow/layers/performance_overlay_layer.h"
@@ -13,6 +15,80 @@
 namespace flutter {
 namespace {
 
+// First and last characters covered by the overlay glyph atlas. The overlay
+// only renders ASCII labels and digits; strings containing anything else fall
+// back to regular text shaping.
+constexpr int kFirstAtlasChar = 32;  // space
+constexpr int kLastAtlasChar = 126;  // tilde
+constexpr int kAtlasCharCount = kLastAtlasChar - kFirstAtlasChar + 1;
+
+// A pre-shaped glyph atlas for one overlay font. The typeface is loaded and
+// the glyph ids and advances for the printable ASCII range are resolved once;
+// after that the per-frame statistics strings are assembled straight from the
+// cached glyphs rather than being pushed through typeface loading and text
+// shaping on every frame. The glyph masks themselves are rasterized into
+// Skia's strike cache the first time they are drawn and reused afterwards, so
+// steady-state overlay text costs only blob assembly and blitting.
+class OverlayGlyphAtlas {
+ public:
+  explicit OverlayGlyphAtlas(const std::string& font_path) {
+    if (font_path != "") {
+      font_ = SkFont(SkTypeface::MakeFromFile(font_path.c_str()));
+    }
+    font_.setSize(15);
+
+    char text[kAtlasCharCount];
+    for (int i = 0; i < kAtlasCharCount; i++) {
+      text[i] = static_cast<char>(kFirstAtlasChar + i);
+    }
+    font_.textToGlyphs(text, kAtlasCharCount, SkTextEncoding::kUTF8, glyphs_,
+                       kAtlasCharCount);
+    font_.getWidths(glyphs_, kAtlasCharCount, advances_);
+  }
+
+  // Builds a text blob for |text| from the cached glyphs. Glyph positions are
+  // the running sum of the cached advances, which matches what default
+  // positioned blobs from SkTextBlob::MakeFromText produce for simple
+  // left-to-right text.
+  sk_sp<SkTextBlob> MakeBlob(const std::string& text) const {
+    for (char c : text) {
+      if (c < kFirstAtlasChar || c > kLastAtlasChar) {
+        return SkTextBlob::MakeFromText(text.c_str(), text.size(), font_,
+                                        SkTextEncoding::kUTF8);
+      }
+    }
+    SkTextBlobBuilder builder;
+    const auto& run = builder.allocRunPosH(
+        font_, static_cast<int>(text.size()), 0 /* y */);
+    SkScalar x = 0;
+    for (size_t i = 0; i < text.size(); i++) {
+      const int index = text[i] - kFirstAtlasChar;
+      run.glyphs[i] = glyphs_[index];
+      run.pos[i] = x;
+      x += advances_[index];
+    }
+    return builder.make();
+  }
+
+ private:
+  SkFont font_;
+  SkGlyphID glyphs_[kAtlasCharCount];
+  SkScalar advances_[kAtlasCharCount];
+};
+
+// Returns the atlas for |font_path|, building it on first use. Performance
+// overlays are only painted from a single thread at a time so the cache does
+// not need locking.
+const OverlayGlyphAtlas& GetGlyphAtlas(const std::string& font_path) {
+  static auto* atlases =
+      new std::map<std::string, std::unique_ptr<OverlayGlyphAtlas>>();
+  auto& atlas = (*atlases)[font_path];
+  if (!atlas) {
+    atlas = std::make_unique<OverlayGlyphAtlas>(font_path);
+  }
+  return *atlas;
+}
+
 void VisualizeStopWatch(SkCanvas& canvas,
                         const Stopwatch& stopwatch,
                         SkScalar x,
@@ -40,18 +116,32 @@ void VisualizeStopWatch(SkCanvas& canvas,
   }
 }
 
+void DrawRasterCacheStatistics(SkCanvas& canvas,
+                               const RasterCache& raster_cache,
+                               const std::string& font_path,
+                               SkScalar x,
+                               SkScalar y) {
+  const auto churn = raster_cache.GetLastFrameChurn();
+  std::stringstream stream;
+  stream.setf(std::ios::fixed | std::ios::showpoint);
+  stream << std::setprecision(1);
+  stream << "RasterCache  " << churn.hits << " hit, " << churn.misses
+         << " miss, " << churn.evictions << " evict; "
+         << raster_cache.GetCachedEntriesCount() << " entries "
+         << (raster_cache.GetCachedEntriesBytes() / (1024.0 * 1024.0))
+         << " MB";
+  auto blob = GetGlyphAtlas(font_path).MakeBlob(stream.str());
+  SkPaint paint;
+  paint.setColor(SK_ColorGRAY);
+  canvas.drawTextBlob(blob, x, y, paint);
+}
+
 }  // namespace
 
 sk_sp<SkTextBlob> PerformanceOverlayLayer::MakeStatisticsText(
     const Stopwatch& stopwatch,
     const std::string& label_prefix,
     const std::string& font_path) {
-  SkFont font;
-  if (font_path != "") {
-    font = SkFont(SkTypeface::MakeFromFile(font_path.c_str()));
-  }
-  font.setSize(15);
-
   double max_ms_per_frame = stopwatch.MaxDelta().ToMillisecondsF();
   double average_ms_per_frame = stopwatch.AverageDelta().ToMillisecondsF();
   std::stringstream stream;
@@ -60,9 +150,7 @@ sk_sp<SkTextBlob> PerformanceOverlayLayer::MakeStatisticsText(
   stream << label_prefix << "  "
          << "max " << max_ms_per_frame << " ms/frame, "
          << "avg " << average_ms_per_frame << " ms/frame";
-  auto text = stream.str();
-  return SkTextBlob::MakeFromText(text.c_str(), text.size(), font,
-                                  SkTextEncoding::kUTF8);
+  return GetGlyphAtlas(font_path).MakeBlob(stream.str());
 }
 
 PerformanceOverlayLayer::PerformanceOverlayLayer(uint64_t options,
@@ -80,10 +168,18 @@ void PerformanceOverlayLayer::Paint(PaintContext& context) const {
     return;
 
   TRACE_EVENT0("flutter", "PerformanceOverlayLayer::Paint");
+  // The GPU and raster cache rows are opt-in; the overlay keeps its
+  // historical two row layout unless one of those options is requested.
+  const bool show_gpu_row =
+      options_ & (kVisualizeGpuStatistics | kDisplayGpuStatistics);
+  const bool show_cache_row = (options_ & kDisplayRasterCacheStatistics) &&
+                              context.raster_cache != nullptr;
+  const int rows = 2 + (show_gpu_row ? 1 : 0) + (show_cache_row ? 1 : 0);
+
   SkScalar x = paint_bounds().x() + padding;
   SkScalar y = paint_bounds().y() + padding;
   SkScalar width = paint_bounds().width() - (padding * 2);
-  SkScalar height = paint_bounds().height() / 2;
+  SkScalar height = paint_bounds().height() / rows;
   SkAutoCanvasRestore save(context.leaf_nodes_canvas, true);
 
   VisualizeStopWatch(
@@ -95,6 +191,22 @@ void PerformanceOverlayLayer::Paint(PaintContext& context) const {
                      width, height - padding,
                      options_ & kVisualizeEngineStatistics,
                      options_ & kDisplayEngineStatistics, "UI", font_path_);
+
+  if (show_gpu_row) {
+    VisualizeStopWatch(*context.leaf_nodes_canvas, context.gpu_time, x,
+                       y + 2 * height, width, height - padding,
+                       options_ & kVisualizeGpuStatistics,
+                       options_ & kDisplayGpuStatistics, "GPU", font_path_);
+  }
+
+  if (show_cache_row) {
+    // Mirror the stopwatch label placement: 8px in from the left edge and
+    // 10px up from the bottom of the row.
+    const SkScalar cache_row_y = y + (rows - 1) * height;
+    DrawRasterCacheStatistics(*context.leaf_nodes_canvas,
+                              *context.raster_cache, font_path_, x + 8,
+                              cache_row_y + (height - padding) - 10);
+  }
 }
 
 }  // namespace flutter
@@ -19,6 +19,13 @@ const int kDisplayRasterizerStatistics = 1 << 0;
 const int kVisualizeRasterizerStatistics = 1 << 1;
 const int kDisplayEngineStatistics = 1 << 2;
 const int kVisualizeEngineStatistics = 1 << 3;
+// GPU statistics only show meaningful numbers on surfaces whose backing API
+// exposes timer queries; elsewhere the row renders with empty laps.
+const int kDisplayGpuStatistics = 1 << 4;
+const int kVisualizeGpuStatistics = 1 << 5;
+// Shows raster cache churn for the last frame: probe hits and misses plus
+// entries evicted, alongside the retained entry count and byte size.
+const int kDisplayRasterCacheStatistics = 1 << 6;
 
 class PerformanceOverlayLayer : public Layer {
  public:
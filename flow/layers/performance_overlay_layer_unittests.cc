@@ -63,8 +63,11 @@ static void TestPerformanceOverlayLayerGold(int refresh_rate) {
 
   flutter::TextureRegistry unused_texture_registry;
   flutter::Layer::PaintContext paintContext = {
-      nullptr,        surface->getCanvas(),    nullptr, nullptr, mock_stopwatch,
-      mock_stopwatch, unused_texture_registry, nullptr, false};
+      nullptr,        surface->getCanvas(),
+      nullptr,        nullptr,
+      mock_stopwatch, mock_stopwatch,
+      mock_stopwatch, unused_texture_registry,
+      nullptr,        false};
 
   // Specify font file to ensure the same font across different operation
   // systems.
@@ -4,7 +4,12 @@
 
 #include "flutter/flow/layers/physical_shape_layer.h"
 
+#include <map>
+#include <tuple>
+
 #include "flutter/flow/paint_utils.h"
+#include "flutter/flow/raster_cache.h"
+#include "third_party/skia/include/core/SkPictureRecorder.h"
 #include "third_party/skia/include/utils/SkShadowUtils.h"
 
 namespace flutter {
@@ -66,6 +71,23 @@ void PhysicalShapeLayer::Preroll(PrerollContext* context,
     // children to it so we don't need to join the child paint bounds.
     set_paint_bounds(ComputeShadowBounds(path_.getBounds(), elevation_,
                                          context->frame_device_pixel_ratio));
+
+    if (auto* cache = context->raster_cache) {
+      // The shadow is by far the most expensive part of this layer: each
+      // SkShadowUtils::DrawShadow call tessellates and blurs the occluder
+      // geometry. Register a stable recording of it with the raster cache so
+      // steady-state frames composite a cached image instead.
+      shadow_picture_ = GetCachedShadowPicture(
+          path_, shadow_color_, elevation_, SkColorGetA(color_) != 0xff,
+          context->frame_device_pixel_ratio);
+      SkMatrix ctm = matrix;
+#ifndef SUPPORT_FRACTIONAL_TRANSLATION
+      ctm = RasterCache::GetIntegralTransCTM(ctm);
+#endif
+      cache->Prepare(context->gr_context, shadow_picture_.get(), ctm,
+                     context->dst_color_space, true /* is_complex */,
+                     false /* will_change */);
+    }
   }
 }
 
@@ -74,8 +96,23 @@ void PhysicalShapeLayer::Paint(PaintContext& context) const {
   FML_DCHECK(needs_painting());
 
   if (elevation_ != 0) {
-    DrawShadow(context.leaf_nodes_canvas, path_, shadow_color_, elevation_,
-               SkColorGetA(color_) != 0xff, context.frame_device_pixel_ratio);
+    bool shadow_drawn = false;
+    if (shadow_picture_ && context.raster_cache) {
+      SkAutoCanvasRestore save(context.leaf_nodes_canvas, true);
+#ifndef SUPPORT_FRACTIONAL_TRANSLATION
+      context.leaf_nodes_canvas->setMatrix(RasterCache::GetIntegralTransCTM(
+          context.leaf_nodes_canvas->getTotalMatrix()));
+#endif
+      shadow_drawn = context.raster_cache->Draw(*shadow_picture_,
+                                                *context.leaf_nodes_canvas);
+      if (shadow_drawn) {
+        TRACE_EVENT_INSTANT0("flutter", "shadow cache hit");
+      }
+    }
+    if (!shadow_drawn) {
+      DrawShadow(context.leaf_nodes_canvas, path_, shadow_color_, elevation_,
+                 SkColorGetA(color_) != 0xff, context.frame_device_pixel_ratio);
+    }
   }
 
   // Call drawPath without clip if possible for better performance.
@@ -115,6 +152,16 @@ void PhysicalShapeLayer::Paint(PaintContext& context) const {
   context.internal_nodes_canvas->restoreToCount(saveCount);
 }
 
+SkRect PhysicalShapeLayer::GetOpaqueBounds() const {
+  // Only the rectangular fill is a guaranteed opaque region; arbitrary
+  // paths leave uncovered pixels inside their bounds and translucent colors
+  // let the content underneath show through.
+  if (isRect_ && SkColorGetA(color_) == 0xff) {
+    return path_.getBounds();
+  }
+  return SkRect::MakeEmpty();
+}
+
 SkRect PhysicalShapeLayer::ComputeShadowBounds(const SkRect& bounds,
                                                float elevation,
                                                float pixel_ratio) {
@@ -159,6 +206,47 @@ SkRect PhysicalShapeLayer::ComputeShadowBounds(const SkRect& bounds,
   return shadow_bounds;
 }
 
+// static
+sk_sp<SkPicture> PhysicalShapeLayer::GetCachedShadowPicture(
+    const SkPath& path,
+    SkColor color,
+    float elevation,
+    bool transparentOccluder,
+    SkScalar dpr) {
+  // The key covers everything DrawShadow reads: the occluder geometry (the
+  // path generation id also changes when the path is translated, which moves
+  // the spot light relative to the shape), the tonal input color, the
+  // elevation and the device pixel ratio.
+  using ShadowPictureKey =
+      std::tuple<uint32_t, SkColor, float, bool, SkScalar>;
+  // Layer trees are rebuilt every frame, so the memo must outlive the layers;
+  // it is per thread because layers are prerolled and painted on the raster
+  // thread only. A material-heavy frame has a few dozen distinct shadows.
+  constexpr size_t kMaxCachedShadowPictures = 128;
+  static thread_local std::map<ShadowPictureKey, sk_sp<SkPicture>> memo;
+
+  ShadowPictureKey key(path.getGenerationID(), color, elevation,
+                       transparentOccluder, dpr);
+  auto found = memo.find(key);
+  if (found != memo.end()) {
+    return found->second;
+  }
+
+  SkPictureRecorder recorder;
+  SkCanvas* canvas = recorder.beginRecording(
+      ComputeShadowBounds(path.getBounds(), elevation, dpr));
+  DrawShadow(canvas, path, color, elevation, transparentOccluder, dpr);
+  sk_sp<SkPicture> picture = recorder.finishRecordingAsPicture();
+
+  if (memo.size() >= kMaxCachedShadowPictures) {
+    // Recordings are cheap to rebuild; dropping the whole memo on overflow
+    // keeps the bookkeeping trivial while bounding its footprint.
+    memo.clear();
+  }
+  memo[key] = picture;
+  return picture;
+}
+
 void PhysicalShapeLayer::DrawShadow(SkCanvas* canvas,
                                     const SkPath& path,
                                     SkColor color,
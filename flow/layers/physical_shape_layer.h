@@ -6,6 +6,7 @@
 #define FLUTTER_FLOW_LAYERS_PHYSICAL_SHAPE_LAYER_H_
 
 #include "flutter/flow/layers/container_layer.h"
+#include "third_party/skia/include/core/SkPicture.h"
 
 namespace flutter {
 
@@ -27,10 +28,30 @@ class PhysicalShapeLayer : public ContainerLayer {
                          bool transparentOccluder,
                          SkScalar dpr);
 
+  // Returns a recording of the ambient and spot shadow for the given shape
+  // parameters. Repeated calls with an unchanged path, color, elevation,
+  // occluder transparency and pixel ratio return the same SkPicture object,
+  // so its uniqueID is stable frame to frame and the raster cache can reuse
+  // the rasterized shadow instead of tessellating it every frame.
+  static sk_sp<SkPicture> GetCachedShadowPicture(const SkPath& path,
+                                                 SkColor color,
+                                                 float elevation,
+                                                 bool transparentOccluder,
+                                                 SkScalar dpr);
+
   void Preroll(PrerollContext* context, const SkMatrix& matrix) override;
 
   void Paint(PaintContext& context) const override;
 
+  SkRect GetOpaqueBounds() const override;
+
+  const char* layer_type() const override { return "PhysicalShapeLayer"; }
+
+  // Conservative: elevation shadows extend beyond the shape bounds.
+  bool CompareForDamage(const Layer& old_layer) const override {
+    return false;
+  }
+
   bool UsesSaveLayer() const {
     return clip_behavior_ == Clip::antiAliasWithSaveLayer;
   }
@@ -43,6 +64,7 @@ class PhysicalShapeLayer : public ContainerLayer {
   float elevation_ = 0.0f;
   float total_elevation_ = 0.0f;
   SkPath path_;
+  sk_sp<SkPicture> shadow_picture_;
   bool isRect_;
   SkRRect frameRRect_;
   Clip clip_behavior_;
@@ -278,5 +278,57 @@ TEST_F(PhysicalShapeLayerTest, Readback) {
   EXPECT_TRUE(ReadbackResult(context, save_layer, reader, true));
 }
 
+TEST_F(PhysicalShapeLayerTest, ShadowPictureIsMemoized) {
+  SkPath layer_path;
+  layer_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+
+  auto first = PhysicalShapeLayer::GetCachedShadowPicture(
+      layer_path, SK_ColorBLACK, 10.0f, false, 1.0f);
+  ASSERT_TRUE(first);
+
+  // The same parameters return the same recording, so its uniqueID is stable
+  // across frames and the raster cache can accumulate accesses against it.
+  auto second = PhysicalShapeLayer::GetCachedShadowPicture(
+      layer_path, SK_ColorBLACK, 10.0f, false, 1.0f);
+  EXPECT_EQ(first.get(), second.get());
+
+  // Changing the elevation or the geometry produces a fresh recording.
+  auto raised = PhysicalShapeLayer::GetCachedShadowPicture(
+      layer_path, SK_ColorBLACK, 20.0f, false, 1.0f);
+  EXPECT_NE(first.get(), raised.get());
+
+  layer_path.addCircle(10.0f, 10.0f, 2.0f);
+  auto mutated = PhysicalShapeLayer::GetCachedShadowPicture(
+      layer_path, SK_ColorBLACK, 10.0f, false, 1.0f);
+  EXPECT_NE(first.get(), mutated.get());
+}
+
+TEST_F(PhysicalShapeLayerTest, ShadowIsCachedInRasterCache) {
+  use_mock_raster_cache();
+
+  SkPath layer_path;
+  layer_path.addRect(5.0f, 6.0f, 20.5f, 21.5f);
+  auto layer =
+      std::make_shared<PhysicalShapeLayer>(SK_ColorGREEN, SK_ColorBLACK,
+                                           10.0f,  // elevation
+                                           layer_path, Clip::none);
+
+  // The shadow picture crosses the raster cache access threshold after a few
+  // frames and is then held as a cache entry.
+  layer->Preroll(preroll_context(), SkMatrix());
+  layer->Preroll(preroll_context(), SkMatrix());
+  EXPECT_EQ(raster_cache()->GetPictureCachedEntriesCount(), 0u);
+  layer->Preroll(preroll_context(), SkMatrix());
+  EXPECT_EQ(raster_cache()->GetPictureCachedEntriesCount(), 1u);
+
+  // With the entry present, Paint composites the cached shadow instead of
+  // re-tessellating it through SkShadowUtils.
+  layer->Paint(paint_context());
+  for (const auto& call : mock_canvas().draw_calls()) {
+    EXPECT_FALSE(
+        std::holds_alternative<MockCanvas::DrawShadowData>(call.data));
+  }
+}
+
 }  // namespace testing
 }  // namespace flutter
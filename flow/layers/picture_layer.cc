@@ -4,6 +4,8 @@
 
 #include "flutter/flow/layers/picture_layer.h"
 
+#include <cstring>
+
 #include "flutter/fml/logging.h"
 
 namespace flutter {
@@ -17,6 +19,21 @@ PictureLayer::PictureLayer(const SkPoint& offset,
       is_complex_(is_complex),
       will_change_(will_change) {}
 
+bool PictureLayer::CompareForDamage(const Layer& old_layer) const {
+  if (strcmp(old_layer.layer_type(), layer_type()) != 0) {
+    return false;
+  }
+  const auto& old_picture_layer = static_cast<const PictureLayer&>(old_layer);
+  if (offset_ != old_picture_layer.offset_) {
+    return false;
+  }
+  // A picture's uniqueID is stable for the lifetime of the SkPicture, so two
+  // frames referencing the same recording paint identical content.
+  SkPicture* old_picture = old_picture_layer.picture();
+  return picture() != nullptr && old_picture != nullptr &&
+         picture()->uniqueID() == old_picture->uniqueID();
+}
+
 void PictureLayer::Preroll(PrerollContext* context, const SkMatrix& matrix) {
   TRACE_EVENT0("flutter", "PictureLayer::Preroll");
 
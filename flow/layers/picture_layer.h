@@ -26,6 +26,9 @@ class PictureLayer : public Layer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* layer_type() const override { return "PictureLayer"; }
+  bool CompareForDamage(const Layer& old_layer) const override;
+
  private:
   SkPoint offset_;
   // Even though pictures themselves are not GPU resources, they may reference
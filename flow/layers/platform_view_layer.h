@@ -18,6 +18,9 @@ class PlatformViewLayer : public Layer {
   void Preroll(PrerollContext* context, const SkMatrix& matrix) override;
   void Paint(PaintContext& context) const override;
 
+  // Painting composites the embedded view even when it is not visible.
+  bool AllowsOcclusionCulling() const override { return false; }
+
  private:
   SkPoint offset_;
   SkSize size_;
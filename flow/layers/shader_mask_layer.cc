@@ -19,12 +19,32 @@ void ShaderMaskLayer::Preroll(PrerollContext* context, const SkMatrix& matrix) {
   Layer::AutoPrerollSaveLayerState save =
       Layer::AutoPrerollSaveLayerState::Create(context);
   ContainerLayer::Preroll(context, matrix);
+
+  // The masked subtree is cached as this layer so the entry captures the
+  // children already modulated by the shader, making a hit a plain blit.
+  // Retained-layer reuse keys the entry to the shader and child content
+  // staying unchanged; a stable mask (tab bar icons, faded list edges)
+  // caches after a few frames while an animating one never does.
+  if (render_count_ >= kMinimumRendersBeforeCachingFilterLayer) {
+    SkMatrix ctm = matrix;
+#ifndef SUPPORT_FRACTIONAL_TRANSLATION
+    ctm = RasterCache::GetIntegralTransCTM(ctm);
+#endif
+    TryToPrepareRasterCache(context, this, ctm);
+  } else {
+    render_count_++;
+  }
 }
 
 void ShaderMaskLayer::Paint(PaintContext& context) const {
   TRACE_EVENT0("flutter", "ShaderMaskLayer::Paint");
   FML_DCHECK(needs_painting());
 
+  if (context.raster_cache &&
+      context.raster_cache->Draw(this, *context.leaf_nodes_canvas)) {
+    return;
+  }
+
   Layer::AutoSaveLayer save =
       Layer::AutoSaveLayer::Create(context, paint_bounds(), nullptr);
   PaintChildren(context);
@@ -21,10 +21,21 @@ class ShaderMaskLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* layer_type() const override { return "ShaderMaskLayer"; }
+
+  // The mask shader modulates the children's alpha.
+  bool SubtreeCanOcclude() const override { return false; }
+
+  // Conservative: shader equality is not tracked frame to frame.
+  bool CompareForDamage(const Layer& old_layer) const override {
+    return false;
+  }
+
  private:
   sk_sp<SkShader> shader_;
   SkRect mask_rect_;
   SkBlendMode blend_mode_;
+  int render_count_ = 1;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ShaderMaskLayer);
 };
@@ -4,6 +4,8 @@
 
 #include "flutter/flow/layers/transform_layer.h"
 
+#include <cstring>
+
 namespace flutter {
 
 TransformLayer::TransformLayer(const SkMatrix& transform)
@@ -24,6 +26,21 @@ TransformLayer::TransformLayer(const SkMatrix& transform)
   }
 }
 
+bool TransformLayer::CompareForDamage(const Layer& old_layer) const {
+  if (strcmp(old_layer.layer_type(), layer_type()) != 0) {
+    return false;
+  }
+  const auto& old_transform_layer =
+      static_cast<const TransformLayer&>(old_layer);
+  return transform_ == old_transform_layer.transform_;
+}
+
+SkMatrix TransformLayer::GetChildMatrix(const SkMatrix& matrix) const {
+  SkMatrix child_matrix;
+  child_matrix.setConcat(matrix, transform_);
+  return child_matrix;
+}
+
 void TransformLayer::Preroll(PrerollContext* context, const SkMatrix& matrix) {
   TRACE_EVENT0("flutter", "TransformLayer::Preroll");
 
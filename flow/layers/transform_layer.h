@@ -19,6 +19,10 @@ class TransformLayer : public ContainerLayer {
 
   void Paint(PaintContext& context) const override;
 
+  const char* layer_type() const override { return "TransformLayer"; }
+  bool CompareForDamage(const Layer& old_layer) const override;
+  SkMatrix GetChildMatrix(const SkMatrix& matrix) const override;
+
 #if defined(OS_FUCHSIA)
   void UpdateScene(SceneUpdateContext& context) override;
 #endif  // defined(OS_FUCHSIA)
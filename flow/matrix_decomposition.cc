@@ -121,6 +121,31 @@ MatrixDecomposition::MatrixDecomposition(SkM44 matrix) : valid_(false) {
 
 MatrixDecomposition::~MatrixDecomposition() = default;
 
+// static
+std::shared_ptr<const MatrixDecomposition> MatrixDecomposition::Cached(
+    const SkMatrix& matrix) {
+  struct Entry {
+    SkMatrix key;
+    std::shared_ptr<const MatrixDecomposition> value;
+  };
+  // A handful of entries covers a frame's worth of distinct transforms; the
+  // linear key comparison (nine floats) is far cheaper than a decomposition.
+  constexpr size_t kCacheSize = 8;
+  static thread_local Entry cache[kCacheSize];
+  static thread_local size_t next_slot = 0;
+
+  for (const auto& entry : cache) {
+    if (entry.value && entry.key == matrix) {
+      return entry.value;
+    }
+  }
+
+  auto value = std::make_shared<const MatrixDecomposition>(matrix);
+  cache[next_slot] = {matrix, value};
+  next_slot = (next_slot + 1) % kCacheSize;
+  return value;
+}
+
 bool MatrixDecomposition::IsValid() const {
   return valid_;
 }
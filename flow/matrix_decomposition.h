@@ -5,6 +5,8 @@
 #ifndef FLUTTER_FLOW_MATRIX_DECOMPOSITION_H_
 #define FLUTTER_FLOW_MATRIX_DECOMPOSITION_H_
 
+#include <memory>
+
 #include "flutter/fml/macros.h"
 #include "third_party/skia/include/core/SkM44.h"
 #include "third_party/skia/include/core/SkMatrix.h"
@@ -22,6 +24,14 @@ class MatrixDecomposition {
 
   ~MatrixDecomposition();
 
+  // Returns a memoized decomposition of the given matrix. Frame-to-frame the
+  // same transforms are decomposed over and over (raster cache admission,
+  // platform view mutations), so a small per-thread cache of recent results
+  // skips the work for unchanged matrices. The cache is per thread; the
+  // returned value is immutable and safe to retain.
+  static std::shared_ptr<const MatrixDecomposition> Cached(
+      const SkMatrix& matrix);
+
   bool IsValid() const;
 
   const SkV3& translation() const { return translation_; }
@@ -157,5 +157,21 @@ TEST(MatrixDecomposition, ScaleFloatError) {
   ASSERT_FLOAT_EQ(0, decomposition3.rotation().z);
 }
 
+TEST(MatrixDecomposition, CachedResultsAreMemoizedPerMatrix) {
+  SkMatrix matrix = SkMatrix::MakeTrans(12, 34);
+  auto first = flutter::MatrixDecomposition::Cached(matrix);
+  ASSERT_TRUE(first->IsValid());
+  ASSERT_FLOAT_EQ(12, first->translation().x);
+  ASSERT_FLOAT_EQ(34, first->translation().y);
+
+  // The identical matrix returns the memoized decomposition.
+  ASSERT_EQ(flutter::MatrixDecomposition::Cached(matrix).get(), first.get());
+
+  // A different matrix decomposes independently.
+  auto other = flutter::MatrixDecomposition::Cached(SkMatrix::MakeScale(2, 2));
+  ASSERT_NE(other.get(), first.get());
+  ASSERT_FLOAT_EQ(2, other->scale().x);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -29,8 +29,8 @@ TEST(MutatorsStack, PushClipRect) {
   auto rect = SkRect::MakeEmpty();
   stack.PushClipRect(rect);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::clip_rect);
-  ASSERT_TRUE(iter->get()->GetRect() == rect);
+  ASSERT_TRUE(iter->GetType() == MutatorType::clip_rect);
+  ASSERT_TRUE(iter->GetRect() == rect);
 }
 
 TEST(MutatorsStack, PushClipRRect) {
@@ -38,8 +38,8 @@ TEST(MutatorsStack, PushClipRRect) {
   auto rrect = SkRRect::MakeEmpty();
   stack.PushClipRRect(rrect);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::clip_rrect);
-  ASSERT_TRUE(iter->get()->GetRRect() == rrect);
+  ASSERT_TRUE(iter->GetType() == MutatorType::clip_rrect);
+  ASSERT_TRUE(iter->GetRRect() == rrect);
 }
 
 TEST(MutatorsStack, PushClipPath) {
@@ -47,8 +47,8 @@ TEST(MutatorsStack, PushClipPath) {
   SkPath path;
   stack.PushClipPath(path);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == flutter::MutatorType::clip_path);
-  ASSERT_TRUE(iter->get()->GetPath() == path);
+  ASSERT_TRUE(iter->GetType() == flutter::MutatorType::clip_path);
+  ASSERT_TRUE(iter->GetPath() == path);
 }
 
 TEST(MutatorsStack, PushTransform) {
@@ -57,8 +57,8 @@ TEST(MutatorsStack, PushTransform) {
   matrix.setIdentity();
   stack.PushTransform(matrix);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::transform);
-  ASSERT_TRUE(iter->get()->GetMatrix() == matrix);
+  ASSERT_TRUE(iter->GetType() == MutatorType::transform);
+  ASSERT_TRUE(iter->GetMatrix() == matrix);
 }
 
 TEST(MutatorsStack, PushOpacity) {
@@ -66,8 +66,8 @@ TEST(MutatorsStack, PushOpacity) {
   int alpha = 240;
   stack.PushOpacity(alpha);
   auto iter = stack.Bottom();
-  ASSERT_TRUE(iter->get()->GetType() == MutatorType::opacity);
-  ASSERT_TRUE(iter->get()->GetAlpha() == 240);
+  ASSERT_TRUE(iter->GetType() == MutatorType::opacity);
+  ASSERT_TRUE(iter->GetAlpha() == 240);
 }
 
 TEST(MutatorsStack, Pop) {
@@ -94,16 +94,16 @@ TEST(MutatorsStack, Traversal) {
   while (iter != stack.Top()) {
     switch (index) {
       case 0:
-        ASSERT_TRUE(iter->get()->GetType() == MutatorType::clip_rrect);
-        ASSERT_TRUE(iter->get()->GetRRect() == rrect);
+        ASSERT_TRUE(iter->GetType() == MutatorType::clip_rrect);
+        ASSERT_TRUE(iter->GetRRect() == rrect);
         break;
       case 1:
-        ASSERT_TRUE(iter->get()->GetType() == MutatorType::clip_rect);
-        ASSERT_TRUE(iter->get()->GetRect() == rect);
+        ASSERT_TRUE(iter->GetType() == MutatorType::clip_rect);
+        ASSERT_TRUE(iter->GetRect() == rect);
         break;
       case 2:
-        ASSERT_TRUE(iter->get()->GetType() == MutatorType::transform);
-        ASSERT_TRUE(iter->get()->GetMatrix() == matrix);
+        ASSERT_TRUE(iter->GetType() == MutatorType::transform);
+        ASSERT_TRUE(iter->GetMatrix() == matrix);
         break;
       default:
         break;
@@ -4,19 +4,169 @@
 
 #include "flutter/flow/raster_cache.h"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/paint_utils.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/fml/trace_event.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkPicture.h"
 #include "third_party/skia/include/core/SkSurface.h"
+#include "third_party/skia/include/utils/SkNoDrawCanvas.h"
 
 namespace flutter {
 
+namespace {
+
+// On-disk layout of a persisted picture entry: the header immediately
+// followed by tightly packed premultiplied N32 pixel rows.
+struct PersistedEntryHeader {
+  uint32_t magic;
+  uint32_t width;
+  uint32_t height;
+  uint32_t row_bytes;
+  SkRect logical_rect;
+};
+
+constexpr uint32_t kPersistedEntryMagic = 0x46524331;  // 'FRC1'
+
+uint64_t Fnv1a64(const uint8_t* data, size_t size, uint64_t hash) {
+  constexpr uint64_t kPrime = 0x100000001b3ull;
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ data[i]) * kPrime;
+  }
+  return hash;
+}
+
+constexpr uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ull;
+
+// Op weights for the complexity score, roughly proportional to replay cost:
+// a filled path or a saveLayer is far more expensive than an axis aligned
+// rectangle. With rectangles weighing one, the old "more than five ops"
+// heuristic maps onto the trivial score floor below.
+constexpr uint32_t kRectOpCost = 1;
+constexpr uint32_t kRoundShapeOpCost = 2;
+constexpr uint32_t kImageOpCost = 2;
+constexpr uint32_t kTextOpCost = 4;
+constexpr uint32_t kPathOpCost = 10;
+constexpr uint32_t kShadowOpCost = 15;
+constexpr uint32_t kSaveLayerOpCost = 20;
+
+// Pictures scoring at or below this are cheaper to replay every frame than
+// to spend cache memory on.
+constexpr uint32_t kTrivialComplexityScore = 5;
+
+// Pictures scoring at or above this (or whose measured rasterization meets
+// |kExpensiveRasterDuration|) are expensive enough to skip most of the
+// access window and to justify evicting older entries under budget
+// pressure.
+constexpr uint32_t kExpensiveComplexityScore = 100;
+
+constexpr fml::TimeDelta kExpensiveRasterDuration =
+    fml::TimeDelta::FromMilliseconds(1);
+
+// Accumulates the op weighted complexity score of a picture played back
+// into it. Ops that are not interesting for the score (clips, transforms)
+// fall through to the no-draw base class.
+class ComplexityScoreCanvas : public SkNoDrawCanvas {
+ public:
+  ComplexityScoreCanvas(int width, int height)
+      : SkNoDrawCanvas(width, height) {}
+
+  uint32_t score() const { return score_; }
+
+ protected:
+  SaveLayerStrategy getSaveLayerStrategy(const SaveLayerRec& rec) override {
+    score_ += kSaveLayerOpCost;
+    return SkNoDrawCanvas::getSaveLayerStrategy(rec);
+  }
+
+  void onDrawPaint(const SkPaint&) override { score_ += kRectOpCost; }
+
+  void onDrawRect(const SkRect&, const SkPaint&) override {
+    score_ += kRectOpCost;
+  }
+
+  void onDrawPoints(PointMode,
+                    size_t count,
+                    const SkPoint[],
+                    const SkPaint&) override {
+    score_ += kRectOpCost;
+  }
+
+  void onDrawOval(const SkRect&, const SkPaint&) override {
+    score_ += kRoundShapeOpCost;
+  }
+
+  void onDrawArc(const SkRect&, SkScalar, SkScalar, bool, const SkPaint&)
+      override {
+    score_ += kRoundShapeOpCost;
+  }
+
+  void onDrawRRect(const SkRRect&, const SkPaint&) override {
+    score_ += kRoundShapeOpCost;
+  }
+
+  void onDrawDRRect(const SkRRect&,
+                    const SkRRect&,
+                    const SkPaint&) override {
+    score_ += kRoundShapeOpCost;
+  }
+
+  void onDrawImage(const SkImage*,
+                   SkScalar,
+                   SkScalar,
+                   const SkPaint*) override {
+    score_ += kImageOpCost;
+  }
+
+  void onDrawImageRect(const SkImage*,
+                       const SkRect*,
+                       const SkRect&,
+                       const SkPaint*,
+                       SrcRectConstraint) override {
+    score_ += kImageOpCost;
+  }
+
+  void onDrawImageNine(const SkImage*,
+                       const SkIRect&,
+                       const SkRect&,
+                       const SkPaint*) override {
+    score_ += kImageOpCost;
+  }
+
+  void onDrawTextBlob(const SkTextBlob*,
+                      SkScalar,
+                      SkScalar,
+                      const SkPaint&) override {
+    score_ += kTextOpCost;
+  }
+
+  void onDrawPath(const SkPath&, const SkPaint&) override {
+    score_ += kPathOpCost;
+  }
+
+  void onDrawVerticesObject(const SkVertices*,
+                            SkBlendMode,
+                            const SkPaint&) override {
+    score_ += kPathOpCost;
+  }
+
+  void onDrawShadowRec(const SkPath&, const SkDrawShadowRec&) override {
+    score_ += kShadowOpCost;
+  }
+
+ private:
+  uint32_t score_ = 0;
+};
+
+}  // namespace
+
 RasterCacheResult::RasterCacheResult(sk_sp<SkImage> image,
                                      const SkRect& logical_rect)
     : image_(std::move(image)), logical_rect_(logical_rect) {}
@@ -24,13 +174,31 @@ RasterCacheResult::RasterCacheResult(sk_sp<SkImage> image,
 void RasterCacheResult::draw(SkCanvas& canvas, const SkPaint* paint) const {
   TRACE_EVENT0("flutter", "RasterCacheResult::draw");
   SkAutoCanvasRestore auto_restore(&canvas, true);
-  SkIRect bounds =
-      RasterCache::GetDeviceBounds(logical_rect_, canvas.getTotalMatrix());
+
+  // Entries are rasterized under an integrally snapped translation. When the
+  // canvas still carries a residual sub-pixel translation (e.g. an animated
+  // OpacityLayer drifting between pixel boundaries), blit at the fractional
+  // position instead of discarding the residual so that translation tolerant
+  // cache keys do not cause visible stair-stepping. Callers that snap their
+  // matrix before drawing get the exact integral blit as before.
+  const SkMatrix& ctm = canvas.getTotalMatrix();
+  const SkMatrix aligned_ctm = RasterCache::GetIntegralTransCTM(ctm);
+  const SkScalar residual_x = ctm.getTranslateX() - aligned_ctm.getTranslateX();
+  const SkScalar residual_y = ctm.getTranslateY() - aligned_ctm.getTranslateY();
+
+  SkIRect bounds = RasterCache::GetDeviceBounds(logical_rect_, aligned_ctm);
   FML_DCHECK(
       std::abs(bounds.size().width() - image_->dimensions().width()) <= 1 &&
       std::abs(bounds.size().height() - image_->dimensions().height()) <= 1);
   canvas.resetMatrix();
-  canvas.drawImage(image_, bounds.fLeft, bounds.fTop, paint);
+  if (residual_x == 0 && residual_y == 0) {
+    canvas.drawImage(image_, bounds.fLeft, bounds.fTop, paint);
+    return;
+  }
+  SkPaint filtered_paint = paint ? *paint : SkPaint();
+  filtered_paint.setFilterQuality(kLow_SkFilterQuality);
+  canvas.drawImage(image_, bounds.fLeft + residual_x, bounds.fTop + residual_y,
+                   &filtered_paint);
 }
 
 RasterCache::RasterCache(size_t access_threshold,
@@ -59,9 +227,26 @@ static bool CanRasterizePicture(SkPicture* picture) {
   return true;
 }
 
-static bool IsPictureWorthRasterizing(SkPicture* picture,
-                                      bool will_change,
-                                      bool is_complex) {
+uint32_t RasterCache::GetComplexityScore(SkPicture* picture) const {
+  auto it = complexity_scores_.find(picture->uniqueID());
+  if (it != complexity_scores_.end()) {
+    return it->second;
+  }
+
+  const SkRect cull_rect = picture->cullRect();
+  ComplexityScoreCanvas canvas(SkScalarCeilToInt(cull_rect.width()),
+                               SkScalarCeilToInt(cull_rect.height()));
+  canvas.translate(-cull_rect.left(), -cull_rect.top());
+  picture->playback(&canvas);
+
+  const uint32_t score = canvas.score();
+  complexity_scores_[picture->uniqueID()] = score;
+  return score;
+}
+
+bool RasterCache::IsPictureWorthRasterizing(SkPicture* picture,
+                                            bool will_change,
+                                            bool is_complex) const {
   if (will_change) {
     // If the picture is going to change in the future, there is no point in
     // doing to extra work to rasterize.
@@ -80,9 +265,11 @@ static bool IsPictureWorthRasterizing(SkPicture* picture,
     return true;
   }
 
-  // TODO(abarth): We should find a better heuristic here that lets us avoid
-  // wasting memory on trivial layers that are easy to re-rasterize every frame.
-  return picture->approximateOpCount() > 5;
+  // A flat op count would treat a filled path and an axis aligned rectangle
+  // as equally expensive. Weigh the ops by replay cost instead, so that
+  // trivial pictures no longer occupy cache slots that expensive vector art
+  // is waiting for.
+  return GetComplexityScore(picture) > kTrivialComplexityScore;
 }
 
 /// @note Procedure doesn't copy all closures.
@@ -122,6 +309,39 @@ static std::unique_ptr<RasterCacheResult> Rasterize(
                                              logical_rect);
 }
 
+// Rasterizes an anti-aliased coverage mask for a clip shape. Unlike
+// |Rasterize| the offscreen is alpha only: an eighth of the bytes of an N32
+// target and independent of the destination color space.
+static std::unique_ptr<RasterCacheResult> RasterizeClipMask(
+    GrContext* context,
+    const SkMatrix& ctm,
+    const SkRect& logical_bounds,
+    const std::function<void(SkCanvas*)>& draw_shape) {
+  TRACE_EVENT0("flutter", "RasterCachePopulateClipMask");
+  SkIRect cache_rect = RasterCache::GetDeviceBounds(logical_bounds, ctm);
+
+  const SkImageInfo image_info =
+      SkImageInfo::MakeA8(cache_rect.width(), cache_rect.height());
+
+  sk_sp<SkSurface> surface =
+      context
+          ? SkSurface::MakeRenderTarget(context, SkBudgeted::kYes, image_info)
+          : SkSurface::MakeRaster(image_info);
+
+  if (!surface) {
+    return nullptr;
+  }
+
+  SkCanvas* canvas = surface->getCanvas();
+  canvas->clear(SK_ColorTRANSPARENT);
+  canvas->translate(-cache_rect.left(), -cache_rect.top());
+  canvas->concat(ctm);
+  draw_shape(canvas);
+
+  return std::make_unique<RasterCacheResult>(surface->makeImageSnapshot(),
+                                             logical_bounds);
+}
+
 std::unique_ptr<RasterCacheResult> RasterCache::RasterizePicture(
     SkPicture* picture,
     GrContext* context,
@@ -140,8 +360,13 @@ void RasterCache::Prepare(PrerollContext* context,
   Entry& entry = layer_cache_[cache_key];
   entry.access_count++;
   entry.used_this_frame = true;
+  entry.last_access = ++access_clock_;
   if (!entry.image) {
     entry.image = RasterizeLayer(context, layer, ctm, checkerboard_images_);
+    if (entry.image) {
+      total_cache_bytes_ += entry.image->image_bytes();
+      EvictToFitBudget();
+    }
   }
 }
 
@@ -164,6 +389,7 @@ std::unique_ptr<RasterCacheResult> RasterCache::RasterizeLayer(
             nullptr,                            // view_embedder
             context->raster_time,
             context->ui_time,
+            context->gpu_time,
             context->texture_registry,
             context->has_platform_view ? nullptr : context->raster_cache,
             context->checkerboard_offscreen_layers,
@@ -175,6 +401,125 @@ std::unique_ptr<RasterCacheResult> RasterCache::RasterizeLayer(
       });
 }
 
+void RasterCache::SetAsyncTaskRunner(
+    std::shared_ptr<fml::ConcurrentTaskRunner> runner) {
+  async_task_runner_ = std::move(runner);
+}
+
+void RasterCache::SetPersistentStore(std::shared_ptr<RasterCacheStore> store) {
+  persistent_store_ = std::move(store);
+}
+
+uint64_t RasterCache::GetPersistentKey(SkPicture* picture,
+                                       const SkMatrix& ctm) const {
+  uint64_t content_hash;
+  auto it = stable_picture_keys_.find(picture->uniqueID());
+  if (it != stable_picture_keys_.end()) {
+    content_hash = it->second;
+  } else {
+    // Picture unique ids are process local, so the stable component of the
+    // key is a hash of the serialized picture. Serialization happens at most
+    // once per picture per run, and only for cache-worthy pictures.
+    sk_sp<SkData> serialized = picture->serialize();
+    content_hash =
+        serialized
+            ? Fnv1a64(serialized->bytes(), serialized->size(), kFnvOffsetBasis)
+            : 0;
+    stable_picture_keys_[picture->uniqueID()] = content_hash;
+  }
+  if (content_hash == 0) {
+    return 0;
+  }
+
+  // Fold in the transform the same way the in-memory key does: integral
+  // translation does not affect the rasterized pixels.
+  SkMatrix matrix = ctm;
+  matrix[SkMatrix::kMTransX] = 0;
+  matrix[SkMatrix::kMTransY] = 0;
+  SkScalar matrix_values[9];
+  matrix.get9(matrix_values);
+  return Fnv1a64(reinterpret_cast<const uint8_t*>(matrix_values),
+                 sizeof(matrix_values), content_hash);
+}
+
+std::unique_ptr<RasterCacheResult> RasterCache::LoadPersistentEntry(
+    uint64_t key,
+    GrContext* context) const {
+  std::unique_ptr<fml::Mapping> mapping = persistent_store_->Load(key);
+  if (!mapping || mapping->GetSize() < sizeof(PersistedEntryHeader)) {
+    return nullptr;
+  }
+
+  PersistedEntryHeader header;
+  memcpy(&header, mapping->GetMapping(), sizeof(header));
+  const size_t pixel_bytes =
+      static_cast<size_t>(header.row_bytes) * header.height;
+  if (header.magic != kPersistedEntryMagic || pixel_bytes == 0 ||
+      mapping->GetSize() < sizeof(header) + pixel_bytes) {
+    return nullptr;
+  }
+
+  // Wrap the mapped pixels without copying; the SkData keeps the mapping
+  // (and with it the pages) alive via the release proc.
+  fml::Mapping* leaked_mapping = mapping.release();
+  sk_sp<SkData> pixels = SkData::MakeWithProc(
+      leaked_mapping->GetMapping() + sizeof(header), pixel_bytes,
+      [](const void* ptr, void* context) {
+        delete reinterpret_cast<fml::Mapping*>(context);
+      },
+      leaked_mapping);
+
+  const SkImageInfo info =
+      SkImageInfo::MakeN32Premul(header.width, header.height);
+  sk_sp<SkImage> image =
+      SkImage::MakeRasterData(info, std::move(pixels), header.row_bytes);
+  if (!image) {
+    return nullptr;
+  }
+
+  if (context) {
+    // Upload straight to a texture so the first draw does not pay for it.
+    sk_sp<SkImage> texture_image = image->makeTextureImage(context);
+    if (texture_image) {
+      image = std::move(texture_image);
+    }
+  }
+
+  return std::make_unique<RasterCacheResult>(std::move(image),
+                                             header.logical_rect);
+}
+
+void RasterCache::PersistEntry(uint64_t key,
+                               const RasterCacheResult& result) const {
+  sk_sp<SkImage> image = result.image();
+  if (!image) {
+    return;
+  }
+
+  const SkImageInfo info =
+      SkImageInfo::MakeN32Premul(image->width(), image->height());
+  const size_t row_bytes = info.minRowBytes();
+  const size_t pixel_bytes = info.computeByteSize(row_bytes);
+
+  sk_sp<SkData> data =
+      SkData::MakeUninitialized(sizeof(PersistedEntryHeader) + pixel_bytes);
+  auto* bytes = reinterpret_cast<uint8_t*>(data->writable_data());
+
+  PersistedEntryHeader header = {
+      kPersistedEntryMagic, static_cast<uint32_t>(image->width()),
+      static_cast<uint32_t>(image->height()), static_cast<uint32_t>(row_bytes),
+      result.logical_rect()};
+  memcpy(bytes, &header, sizeof(header));
+
+  // One-time readback per newly rasterized entry; GPU-backed images incur a
+  // synchronous download here.
+  if (!image->readPixels(info, bytes + sizeof(header), row_bytes, 0, 0)) {
+    return;
+  }
+
+  persistent_store_->Store(key, std::move(data));
+}
+
 bool RasterCache::Prepare(GrContext* context,
                           SkPicture* picture,
                           const SkMatrix& transformation_matrix,
@@ -193,28 +538,118 @@ bool RasterCache::Prepare(GrContext* context,
     return false;
   }
 
-  // Decompose the matrix (once) for all subsequent operations. We want to make
-  // sure to avoid volumetric distortions while accounting for scaling.
-  const MatrixDecomposition matrix(transformation_matrix);
+  // Decompose the matrix (once) for all subsequent operations. We want to
+  // make sure to avoid volumetric distortions while accounting for scaling.
+  // Stable transforms (anything that is not mid-animation) hit the memo
+  // cache and skip the decomposition entirely.
+  const auto matrix = MatrixDecomposition::Cached(transformation_matrix);
 
-  if (!matrix.IsValid()) {
+  if (!matrix->IsValid()) {
     // The matrix was singular. No point in going further.
     return false;
   }
 
   PictureRasterCacheKey cache_key(picture->uniqueID(), transformation_matrix);
 
+  // A picture that is known to be expensive — by its op weighted score or by
+  // a rasterization measured in an earlier cache generation — skips most of
+  // the access window. Waiting out the full window replays the expensive
+  // picture for several frames, and scrolling content may never stay visible
+  // long enough to reach it.
+  const auto duration_it = raster_durations_.find(picture->uniqueID());
+  const bool known_expensive =
+      (duration_it != raster_durations_.end() &&
+       duration_it->second >= kExpensiveRasterDuration) ||
+      GetComplexityScore(picture) >= kExpensiveComplexityScore;
+
+  size_t effective_threshold = access_threshold_;
+  if (known_expensive && effective_threshold > 1) {
+    effective_threshold = 1;
+  }
+
   // Creates an entry, if not present prior.
   Entry& entry = picture_cache_[cache_key];
-  if (entry.access_count < access_threshold_) {
+  entry.last_access = ++access_clock_;
+  if (entry.access_count < effective_threshold) {
     // Frame threshold has not yet been reached.
     return false;
   }
 
   if (!entry.image) {
+    // When a byte budget is set and this entry would push the cache over it,
+    // only admit pictures that are genuinely expensive (or that the caller
+    // explicitly marked complex); rasterizing a modest picture would merely
+    // churn out older entries that earn their keep.
+    if (cache_byte_budget_ != 0 && !is_complex && !known_expensive) {
+      const SkIRect device_bounds =
+          GetDeviceBounds(picture->cullRect(), transformation_matrix);
+      const size_t entry_bytes = static_cast<size_t>(device_bounds.width()) *
+                                 device_bounds.height() * 4;
+      if (total_cache_bytes_ + entry_bytes > cache_byte_budget_) {
+        return false;
+      }
+    }
+
+    // A disk-backed tier can satisfy the entry without rasterizing at all;
+    // loads are memory mapped and therefore cheap enough to do inline.
+    uint64_t persistent_key = 0;
+    if (persistent_store_ && !checkerboard_images_) {
+      persistent_key = GetPersistentKey(picture, transformation_matrix);
+      if (persistent_key != 0) {
+        entry.image = LoadPersistentEntry(persistent_key, context);
+        if (entry.image) {
+          total_cache_bytes_ += entry.image->image_bytes();
+          EvictToFitBudget();
+          return true;
+        }
+      }
+    }
+
+    // Rasterizations that do not need the GrContext can be produced on a
+    // worker; the result is adopted in SweepAfterFrame. The GrContext is
+    // bound to the raster thread, so GPU-backed population stays here.
+    if (async_task_runner_ && context == nullptr) {
+      if (!entry.pending) {
+        entry.pending = true;
+        picture_cached_this_frame_++;
+        sk_sp<SkPicture> shared_picture = sk_ref_sp(picture);
+        sk_sp<SkColorSpace> shared_color_space = sk_ref_sp(dst_color_space);
+        const bool checkerboard = checkerboard_images_;
+        std::shared_ptr<AsyncResultQueue> queue = async_result_queue_;
+        async_task_runner_->PostTask([queue, shared_picture, cache_key,
+                                      transformation_matrix,
+                                      shared_color_space, checkerboard]() {
+          const fml::TimePoint rasterize_start = fml::TimePoint::Now();
+          auto image = Rasterize(nullptr, transformation_matrix,
+                                 shared_color_space.get(), checkerboard,
+                                 shared_picture->cullRect(),
+                                 [&shared_picture](SkCanvas* canvas) {
+                                   canvas->drawPicture(shared_picture);
+                                 });
+          const fml::TimeDelta raster_duration =
+              fml::TimePoint::Now() - rasterize_start;
+          std::scoped_lock lock(queue->mutex);
+          queue->results.push_back({cache_key, std::move(image),
+                                    raster_duration});
+        });
+      }
+      return false;
+    }
+    const fml::TimePoint rasterize_start = fml::TimePoint::Now();
     entry.image = RasterizePicture(picture, context, transformation_matrix,
                                    dst_color_space, checkerboard_images_);
+    // The measured cost informs the admission decision the next time this
+    // picture needs caching, e.g. after being swept while off screen.
+    raster_durations_[picture->uniqueID()] =
+        fml::TimePoint::Now() - rasterize_start;
     picture_cached_this_frame_++;
+    if (entry.image) {
+      total_cache_bytes_ += entry.image->image_bytes();
+      if (persistent_store_ && persistent_key != 0 && !checkerboard_images_) {
+        PersistEntry(persistent_key, *entry.image);
+      }
+      EvictToFitBudget();
+    }
   }
   return true;
 }
@@ -223,18 +658,22 @@ bool RasterCache::Draw(const SkPicture& picture, SkCanvas& canvas) const {
   PictureRasterCacheKey cache_key(picture.uniqueID(), canvas.getTotalMatrix());
   auto it = picture_cache_.find(cache_key);
   if (it == picture_cache_.end()) {
+    RecordPictureProbe(picture, false);
     return false;
   }
 
   Entry& entry = it->second;
   entry.access_count++;
   entry.used_this_frame = true;
+  entry.last_access = ++access_clock_;
 
   if (entry.image) {
+    RecordPictureProbe(picture, true);
     entry.image->draw(canvas);
     return true;
   }
 
+  RecordPictureProbe(picture, false);
   return false;
 }
 
@@ -250,6 +689,7 @@ bool RasterCache::Draw(const Layer* layer,
   Entry& entry = it->second;
   entry.access_count++;
   entry.used_this_frame = true;
+  entry.last_access = ++access_clock_;
 
   if (entry.image) {
     entry.image->draw(canvas, paint);
@@ -259,20 +699,227 @@ bool RasterCache::Draw(const Layer* layer,
   return false;
 }
 
+void RasterCache::AdoptCompletedAsyncResults() {
+  std::vector<CompletedAsyncResult> results;
+  {
+    std::scoped_lock lock(async_result_queue_->mutex);
+    std::swap(results, async_result_queue_->results);
+  }
+
+  for (auto& result : results) {
+    auto it = picture_cache_.find(result.key);
+    if (it == picture_cache_.end()) {
+      // The entry was swept while the rasterization was in flight.
+      continue;
+    }
+    Entry& entry = it->second;
+    entry.pending = false;
+    if (result.image && !entry.image) {
+      entry.image = std::move(result.image);
+      total_cache_bytes_ += entry.image->image_bytes();
+      raster_durations_[result.key.id()] = result.raster_duration;
+    }
+  }
+  EvictToFitBudget();
+}
+
+uint64_t RasterCache::HashClipShape(const void* data, size_t size) {
+  // FNV-1a; the key space is tiny (distinct clip shapes on screen) so a
+  // cheap byte hash is plenty.
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+const RasterCacheResult* RasterCache::GetClipMask(
+    uint64_t shape_key,
+    GrContext* gr_context,
+    const SkMatrix& ctm,
+    const SkRect& logical_bounds,
+    const std::function<void(SkCanvas*)>& draw_shape) {
+  ClipShapeRasterCacheKey cache_key(shape_key, ctm);
+  Entry& entry = clip_mask_cache_[cache_key];
+  entry.access_count++;
+  entry.used_this_frame = true;
+  entry.last_access = ++access_clock_;
+  if (!entry.image) {
+    entry.image = RasterizeClipMask(gr_context, ctm, logical_bounds,
+                                    draw_shape);
+    if (entry.image) {
+      total_cache_bytes_ += entry.image->image_bytes();
+      EvictToFitBudget();
+    }
+  }
+  return entry.image.get();
+}
+
 void RasterCache::SweepAfterFrame() {
-  SweepOneCacheAfterFrame(picture_cache_);
-  SweepOneCacheAfterFrame(layer_cache_);
+  AdoptCompletedAsyncResults();
+  size_t bytes_freed = SweepOneCacheAfterFrame(picture_cache_);
+  bytes_freed += SweepOneCacheAfterFrame(layer_cache_);
+  bytes_freed += SweepOneCacheAfterFrame(clip_mask_cache_);
+  FML_DCHECK(bytes_freed <= total_cache_bytes_);
+  total_cache_bytes_ -= bytes_freed;
+  EvictToFitBudget();
   picture_cached_this_frame_ = 0;
+  last_frame_churn_ = frame_churn_;
+  frame_churn_ = FrameChurn();
   TraceStatsToTimeline();
 }
 
+void RasterCache::RecordEviction(const PictureRasterCacheKey& key) {
+  frame_churn_.evictions++;
+  if (!churn_instrumentation_enabled_) {
+    return;
+  }
+  auto it = churn_stats_.find(key.id());
+  if (it != churn_stats_.end()) {
+    it->second.eviction_count++;
+  }
+}
+
+void RasterCache::RecordPictureProbe(const SkPicture& picture,
+                                     bool hit) const {
+  if (hit) {
+    frame_churn_.hits++;
+  } else {
+    frame_churn_.misses++;
+  }
+  if (!churn_instrumentation_enabled_) {
+    return;
+  }
+  ChurnStats& stats = churn_stats_[picture.uniqueID()];
+  if (stats.picture_id == 0) {
+    stats.picture_id = picture.uniqueID();
+    stats.op_count = picture.approximateOpCount();
+  }
+  if (hit) {
+    stats.hit_count++;
+    stats.current_miss_streak = 0;
+  } else {
+    stats.miss_count++;
+    stats.current_miss_streak++;
+    stats.longest_miss_streak =
+        std::max(stats.longest_miss_streak, stats.current_miss_streak);
+  }
+}
+
+void RasterCache::SetChurnInstrumentationEnabled(bool enabled) {
+  if (churn_instrumentation_enabled_ == enabled) {
+    return;
+  }
+  churn_instrumentation_enabled_ = enabled;
+  churn_stats_.clear();
+}
+
+bool RasterCache::IsChurnInstrumentationEnabled() const {
+  return churn_instrumentation_enabled_;
+}
+
+std::vector<RasterCache::ChurnStats> RasterCache::GetChurnStats() const {
+  std::vector<ChurnStats> stats;
+  stats.reserve(churn_stats_.size());
+  for (const auto& item : churn_stats_) {
+    stats.push_back(item.second);
+    // Raster durations live in their own memo so the measurement survives
+    // entry eviction; stitch them in at export time.
+    const auto duration_it = raster_durations_.find(item.first);
+    if (duration_it != raster_durations_.end()) {
+      stats.back().last_raster_duration = duration_it->second;
+    }
+  }
+  return stats;
+}
+
+RasterCache::FrameChurn RasterCache::GetLastFrameChurn() const {
+  return last_frame_churn_;
+}
+
 void RasterCache::Clear() {
   picture_cache_.clear();
   layer_cache_.clear();
+  clip_mask_cache_.clear();
+  total_cache_bytes_ = 0;
+}
+
+void RasterCache::SetCacheByteBudget(size_t budget_bytes) {
+  cache_byte_budget_ = budget_bytes;
+  EvictToFitBudget();
+}
+
+size_t RasterCache::GetCacheByteBudget() const {
+  return cache_byte_budget_;
+}
+
+size_t RasterCache::GetCachedEntriesBytes() const {
+  return total_cache_bytes_;
+}
+
+void RasterCache::EvictToFitBudget() {
+  if (cache_byte_budget_ == 0 || total_cache_bytes_ <= cache_byte_budget_) {
+    return;
+  }
+
+  struct EvictionCandidate {
+    size_t last_access;
+    size_t bytes;
+    const PictureRasterCacheKey* picture_key;
+    const LayerRasterCacheKey* layer_key;
+    const ClipShapeRasterCacheKey* clip_key;
+  };
+
+  std::vector<EvictionCandidate> candidates;
+  candidates.reserve(picture_cache_.size() + layer_cache_.size() +
+                     clip_mask_cache_.size());
+  for (const auto& item : picture_cache_) {
+    if (item.second.image) {
+      candidates.push_back({item.second.last_access,
+                            static_cast<size_t>(item.second.image->image_bytes()),
+                            &item.first, nullptr, nullptr});
+    }
+  }
+  for (const auto& item : layer_cache_) {
+    if (item.second.image) {
+      candidates.push_back({item.second.last_access,
+                            static_cast<size_t>(item.second.image->image_bytes()),
+                            nullptr, &item.first, nullptr});
+    }
+  }
+  for (const auto& item : clip_mask_cache_) {
+    if (item.second.image) {
+      candidates.push_back({item.second.last_access,
+                            static_cast<size_t>(item.second.image->image_bytes()),
+                            nullptr, nullptr, &item.first});
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [](const EvictionCandidate& a, const EvictionCandidate& b) {
+              return a.last_access < b.last_access;
+            });
+
+  for (const auto& candidate : candidates) {
+    if (total_cache_bytes_ <= cache_byte_budget_) {
+      break;
+    }
+    if (candidate.picture_key) {
+      RecordEviction(*candidate.picture_key);
+      picture_cache_.erase(*candidate.picture_key);
+    } else if (candidate.layer_key) {
+      layer_cache_.erase(*candidate.layer_key);
+    } else {
+      clip_mask_cache_.erase(*candidate.clip_key);
+    }
+    total_cache_bytes_ -= candidate.bytes;
+  }
 }
 
 size_t RasterCache::GetCachedEntriesCount() const {
-  return layer_cache_.size() + picture_cache_.size();
+  return layer_cache_.size() + picture_cache_.size() +
+         clip_mask_cache_.size();
 }
 
 size_t RasterCache::GetLayerCachedEntriesCount() const {
@@ -283,6 +930,10 @@ size_t RasterCache::GetPictureCachedEntriesCount() const {
   return picture_cache_.size();
 }
 
+size_t RasterCache::GetClipMaskCachedEntriesCount() const {
+  return clip_mask_cache_.size();
+}
+
 void RasterCache::SetCheckboardCacheImages(bool checkerboard) {
   if (checkerboard_images_ == checkerboard) {
     return;
@@ -5,13 +5,19 @@
 #ifndef FLUTTER_FLOW_RASTER_CACHE_H_
 #define FLUTTER_FLOW_RASTER_CACHE_H_
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "flutter/flow/instrumentation.h"
 #include "flutter/flow/raster_cache_key.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/fml/memory/weak_ptr.h"
+#include "flutter/fml/time/time_delta.h"
+#include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkSize.h"
 
@@ -35,11 +41,33 @@ class RasterCacheResult {
                   : 0;
   };
 
+  sk_sp<SkImage> image() const { return image_; }
+
+  const SkRect& logical_rect() const { return logical_rect_; }
+
  private:
   sk_sp<SkImage> image_;
   SkRect logical_rect_;
 };
 
+// A disk-backed tier for rasterized picture images that survives process
+// restarts. Implemented by the shell on top of its persistent cache
+// directory machinery; the raster cache serializes newly rasterized picture
+// entries into it and consults it before rasterizing on later runs.
+class RasterCacheStore {
+ public:
+  virtual ~RasterCacheStore() = default;
+
+  // Returns the serialized entry for the key, or nullptr on a miss. The
+  // mapping is typically memory mapped so a load does not copy pixel data.
+  // Called on the raster thread.
+  virtual std::unique_ptr<fml::Mapping> Load(uint64_t key) = 0;
+
+  // Persists a serialized entry. Implementations are expected to write
+  // asynchronously; the call must not block on disk IO.
+  virtual void Store(uint64_t key, sk_sp<SkData> data) = 0;
+};
+
 struct PrerollContext;
 
 class RasterCache {
@@ -144,6 +172,25 @@ class RasterCache {
 
   void Prepare(PrerollContext* context, Layer* layer, const SkMatrix& ctm);
 
+  // Hashes the raw geometry bytes of a clip shape into a
+  // |ClipShapeRasterCacheKey| id. Shapes with identical bytes share a key, so
+  // equal rounded rectangles on different layers resolve to one cached mask.
+  static uint64_t HashClipShape(const void* data, size_t size);
+
+  // Returns the anti-aliased coverage mask for a clip shape, rasterizing one
+  // on a miss. The mask is an alpha-only image of |logical_bounds| under the
+  // scale and skew of |ctm| (the key ignores translation, so the 20 cards of
+  // a list share one mask); |draw_shape| paints the shape, anti-aliased and
+  // opaque, in the logical coordinate space. The caller composites the mask
+  // over a hard clipped saveLayer with |SkBlendMode::kDstIn|. Masks sweep
+  // and evict like other entries. Returns nullptr if rasterization fails.
+  const RasterCacheResult* GetClipMask(
+      uint64_t shape_key,
+      GrContext* gr_context,
+      const SkMatrix& ctm,
+      const SkRect& logical_bounds,
+      const std::function<void(SkCanvas*)>& draw_shape);
+
   // Find the raster cache for the picture and draw it to the canvas.
   //
   // Return true if it's found and drawn.
@@ -165,22 +212,92 @@ class RasterCache {
 
   void SetCheckboardCacheImages(bool checkerboard);
 
+  // Sets the task runner used to populate picture cache entries off the
+  // raster thread. Only rasterizations that do not require a GrContext
+  // (the software backend) are performed asynchronously; GPU-backed
+  // population stays on the raster thread, which owns the context.
+  // Asynchronously produced images are adopted during |SweepAfterFrame|.
+  void SetAsyncTaskRunner(std::shared_ptr<fml::ConcurrentTaskRunner> runner);
+
+  // Sets the disk-backed tier used to persist rasterized pictures across
+  // runs. Only picture entries participate: pictures have serializable
+  // content from which a stable key can be derived, while layers do not
+  // keep their identity across processes. Pictures whose serialized form is
+  // not stable across runs (e.g. those embedding typefaces with process
+  // local ids) simply miss and are re-rasterized as usual.
+  void SetPersistentStore(std::shared_ptr<RasterCacheStore> store);
+
+  // Sets the maximum number of bytes of rasterized images this cache may
+  // retain. A budget of zero (the default) leaves the cache unbounded.
+  // When an insertion or sweep leaves the cache over budget, the least
+  // recently used entries are evicted first.
+  void SetCacheByteBudget(size_t budget_bytes);
+
+  size_t GetCacheByteBudget() const;
+
+  // The bytes of all rasterized images currently retained by this cache.
+  size_t GetCachedEntriesBytes() const;
+
   size_t GetCachedEntriesCount() const;
 
   size_t GetLayerCachedEntriesCount() const;
 
   size_t GetPictureCachedEntriesCount() const;
 
+  size_t GetClipMaskCachedEntriesCount() const;
+
+  // Per picture churn statistics recorded while churn instrumentation is
+  // enabled. Attributed to the picture unique id rather than the matrix
+  // qualified cache key: scrolling changes the transform every frame, so
+  // matrix qualified keys are themselves the churn being diagnosed and
+  // would scatter one picture's history over hundreds of rows.
+  struct ChurnStats {
+    uint32_t picture_id = 0;
+    int op_count = 0;
+    size_t hit_count = 0;
+    size_t miss_count = 0;
+    size_t eviction_count = 0;
+    size_t current_miss_streak = 0;
+    size_t longest_miss_streak = 0;
+    fml::TimeDelta last_raster_duration;
+  };
+
+  // Per frame aggregate churn counters; tracked unconditionally since they
+  // are three counter bumps per cache probe. The counts describe the most
+  // recently swept frame.
+  struct FrameChurn {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+  };
+
+  // Enables or disables per picture churn recording. Enabling discards any
+  // stats recorded by a previous instrumentation session.
+  void SetChurnInstrumentationEnabled(bool enabled);
+
+  bool IsChurnInstrumentationEnabled() const;
+
+  std::vector<ChurnStats> GetChurnStats() const;
+
+  FrameChurn GetLastFrameChurn() const;
+
  private:
   struct Entry {
     bool used_this_frame = false;
+    // True while an asynchronous rasterization of this entry is in flight.
+    bool pending = false;
     size_t access_count = 0;
+    // The value of |access_clock_| the last time this entry was prepared
+    // or drawn; used for least-recently-used eviction.
+    size_t last_access = 0;
     std::unique_ptr<RasterCacheResult> image;
   };
 
+  // Returns the bytes of the rasterized images that were swept.
   template <class Cache>
-  static void SweepOneCacheAfterFrame(Cache& cache) {
+  size_t SweepOneCacheAfterFrame(Cache& cache) {
     std::vector<typename Cache::iterator> dead;
+    size_t bytes_freed = 0;
 
     for (auto it = cache.begin(); it != cache.end(); ++it) {
       Entry& entry = it->second;
@@ -191,17 +308,110 @@ class RasterCache {
     }
 
     for (auto it : dead) {
+      if (it->second.image) {
+        bytes_freed += it->second.image->image_bytes();
+        RecordEviction(it->first);
+      }
       cache.erase(it);
     }
+
+    return bytes_freed;
   }
 
+  // Churn bookkeeping for entries leaving the cache. Only picture entries
+  // are attributed; layer identity is process local and not actionable.
+  void RecordEviction(const PictureRasterCacheKey& key);
+  void RecordEviction(const LayerRasterCacheKey& key) {}
+
+  // Records the outcome of a picture cache probe made by |Draw|.
+  void RecordPictureProbe(const SkPicture& picture, bool hit) const;
+
+  // Returns the op-type weighted complexity score of the picture: paths,
+  // shadows and saveLayers weigh far more than axis aligned rectangles.
+  // Scoring replays the picture once into a no-draw canvas; the result is
+  // memoized by picture unique id.
+  uint32_t GetComplexityScore(SkPicture* picture) const;
+
+  // Whether the picture is worth spending cache memory on at all, combining
+  // the caller's hints with the complexity score.
+  bool IsPictureWorthRasterizing(SkPicture* picture,
+                                 bool will_change,
+                                 bool is_complex) const;
+
+  // Evicts least recently used entries until the cache fits within
+  // |cache_byte_budget_|. No-op while the budget is zero.
+  void EvictToFitBudget();
+
+  // Moves the results of completed asynchronous rasterizations into their
+  // cache entries. Called once per frame from |SweepAfterFrame|.
+  void AdoptCompletedAsyncResults();
+
+  // Returns the persistent store key for the picture under the given
+  // transform, or zero when no stable key can be derived. The content hash
+  // component is computed once per picture and memoized by unique id.
+  uint64_t GetPersistentKey(SkPicture* picture, const SkMatrix& ctm) const;
+
+  // Deserializes a persisted entry, uploading the pixels to a texture when
+  // a GrContext is available. Returns nullptr on a miss or a corrupt entry.
+  std::unique_ptr<RasterCacheResult> LoadPersistentEntry(
+      uint64_t key,
+      GrContext* context) const;
+
+  // Serializes a freshly rasterized entry into the persistent store.
+  void PersistEntry(uint64_t key, const RasterCacheResult& result) const;
+
   const size_t access_threshold_;
   const size_t picture_cache_limit_per_frame_;
   size_t picture_cached_this_frame_ = 0;
+  size_t cache_byte_budget_ = 0;
+  size_t total_cache_bytes_ = 0;
+  mutable size_t access_clock_ = 0;
   mutable PictureRasterCacheKey::Map<Entry> picture_cache_;
   mutable LayerRasterCacheKey::Map<Entry> layer_cache_;
+  mutable ClipShapeRasterCacheKey::Map<Entry> clip_mask_cache_;
   bool checkerboard_images_;
 
+  std::shared_ptr<fml::ConcurrentTaskRunner> async_task_runner_;
+
+  std::shared_ptr<RasterCacheStore> persistent_store_;
+
+  // Memoized content hashes keyed by process local picture unique id.
+  mutable std::unordered_map<uint32_t, uint64_t> stable_picture_keys_;
+
+  // Memoized complexity scores keyed by picture unique id.
+  mutable std::unordered_map<uint32_t, uint32_t> complexity_scores_;
+
+  // Per picture churn stats, populated only while churn instrumentation is
+  // enabled. Mutable because cache probes happen in the const |Draw|.
+  bool churn_instrumentation_enabled_ = false;
+  mutable std::unordered_map<uint32_t, ChurnStats> churn_stats_;
+
+  // Churn counters for the frame being built and the last swept frame.
+  mutable FrameChurn frame_churn_;
+  FrameChurn last_frame_churn_;
+
+  // Measured rasterization durations keyed by picture unique id. Durations
+  // outlive their cache entries, so a picture that proved expensive in an
+  // earlier cache generation is readmitted without waiting out the full
+  // access window again.
+  std::unordered_map<uint32_t, fml::TimeDelta> raster_durations_;
+
+  struct CompletedAsyncResult {
+    PictureRasterCacheKey key;
+    std::unique_ptr<RasterCacheResult> image;
+    fml::TimeDelta raster_duration;
+  };
+
+  // The hand-off point between worker threads and the raster thread.
+  // Shared with the worker tasks so in-flight rasterizations stay safe if
+  // the cache is torn down before they finish.
+  struct AsyncResultQueue {
+    std::mutex mutex;
+    std::vector<CompletedAsyncResult> results;
+  };
+  std::shared_ptr<AsyncResultQueue> async_result_queue_ =
+      std::make_shared<AsyncResultQueue>();
+
   void TraceStatsToTimeline() const;
 
   FML_DISALLOW_COPY_AND_ASSIGN(RasterCache);
@@ -56,6 +56,10 @@ class Layer;
 // The ID is the uint64_t layer unique_id
 using LayerRasterCacheKey = RasterCacheKey<uint64_t>;
 
+// The ID is a hash of the clip shape's geometry, so identical shapes (e.g.
+// the rounded rectangle shared by every card in a list) map to one entry.
+using ClipShapeRasterCacheKey = RasterCacheKey<uint64_t>;
+
 }  // namespace flutter
 
 #endif  // FLUTTER_FLOW_RASTER_CACHE_KEY_H_
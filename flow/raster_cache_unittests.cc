@@ -4,9 +4,16 @@
 
 #include "flutter/flow/raster_cache.h"
 
+#include <chrono>
+#include <map>
+#include <thread>
+
+#include "flutter/fml/concurrent_message_loop.h"
 #include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkPath.h"
 #include "third_party/skia/include/core/SkPicture.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
+#include "third_party/skia/include/core/SkRRect.h"
 
 namespace flutter {
 namespace testing {
@@ -22,6 +29,59 @@ sk_sp<SkPicture> GetSamplePicture() {
   return recorder.finishRecordingAsPicture();
 }
 
+// A picture above the trivial complexity floor but nowhere near expensive.
+sk_sp<SkPicture> GetModestSamplePicture() {
+  SkPictureRecorder recorder;
+  SkCanvas* canvas = recorder.beginRecording(SkRect::MakeWH(150, 100));
+  SkPaint paint;
+  paint.setColor(SK_ColorBLUE);
+  for (int i = 0; i < 10; i++) {
+    canvas->drawRect(SkRect::MakeXYWH(i * 10, 10, 8, 80), paint);
+  }
+  return recorder.finishRecordingAsPicture();
+}
+
+// A path-heavy picture whose op weighted score marks it as expensive.
+sk_sp<SkPicture> GetExpensiveSamplePicture() {
+  SkPictureRecorder recorder;
+  SkCanvas* canvas = recorder.beginRecording(SkRect::MakeWH(150, 100));
+  SkPaint paint;
+  paint.setColor(SK_ColorGREEN);
+  for (int i = 0; i < 20; i++) {
+    SkPath path;
+    path.moveTo(10, 10 + i * 4);
+    path.quadTo(75, 90, 140, 10 + i * 4);
+    canvas->drawPath(path, paint);
+  }
+  return recorder.finishRecordingAsPicture();
+}
+
+// In-memory RasterCacheStore standing in for the shell's disk tier.
+class FakeRasterCacheStore : public RasterCacheStore {
+ public:
+  // |RasterCacheStore|
+  std::unique_ptr<fml::Mapping> Load(uint64_t key) override {
+    load_count++;
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+      return nullptr;
+    }
+    const auto* bytes = it->second->bytes();
+    return std::make_unique<fml::DataMapping>(
+        std::vector<uint8_t>{bytes, bytes + it->second->size()});
+  }
+
+  // |RasterCacheStore|
+  void Store(uint64_t key, sk_sp<SkData> data) override {
+    store_count++;
+    entries[key] = std::move(data);
+  }
+
+  std::map<uint64_t, sk_sp<SkData>> entries;
+  size_t load_count = 0;
+  size_t store_count = 0;
+};
+
 }  // namespace
 
 TEST(RasterCache, SimpleInitialization) {
@@ -101,6 +161,209 @@ TEST(RasterCache, PictureCacheLimitPerFrameIsRespectedWhenZero) {
   ASSERT_FALSE(cache.Draw(*picture, dummy_canvas));
 }
 
+TEST(RasterCache, ByteBudgetEvictsLeastRecentlyUsed) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  // Room for one 150x100 N32 rasterization (60000 bytes) but not two.
+  cache.SetCacheByteBudget(70000u);
+
+  SkMatrix matrix = SkMatrix::I();
+  auto picture1 = GetSamplePicture();
+  auto picture2 = GetSamplePicture();
+  SkCanvas dummy_canvas;
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+
+  // Reach the access threshold for both pictures.
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture1.get(), matrix, srgb.get(), true, false));
+  ASSERT_FALSE(cache.Draw(*picture1, dummy_canvas));
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture2.get(), matrix, srgb.get(), true, false));
+  ASSERT_FALSE(cache.Draw(*picture2, dummy_canvas));
+  cache.SweepAfterFrame();
+
+  // Cache both; the second insertion must push the first, least recently
+  // used, entry out of the budget.
+  ASSERT_TRUE(
+      cache.Prepare(NULL, picture1.get(), matrix, srgb.get(), true, false));
+  ASSERT_TRUE(
+      cache.Prepare(NULL, picture2.get(), matrix, srgb.get(), true, false));
+
+  ASSERT_LE(cache.GetCachedEntriesBytes(), 70000u);
+  ASSERT_FALSE(cache.Draw(*picture1, dummy_canvas));
+  ASSERT_TRUE(cache.Draw(*picture2, dummy_canvas));
+
+  cache.Clear();
+  ASSERT_EQ(cache.GetCachedEntriesBytes(), 0u);
+}
+
+TEST(RasterCache, ChurnInstrumentationAttributesProbesToPictures) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  cache.SetChurnInstrumentationEnabled(true);
+
+  auto picture = GetSamplePicture();
+
+  SkMatrix matrix = SkMatrix::I();
+  SkCanvas canvas(100, 100, nullptr);
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+  ASSERT_FALSE(cache.Draw(*picture, canvas));
+  cache.SweepAfterFrame();
+
+  ASSERT_TRUE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+  ASSERT_TRUE(cache.Draw(*picture, canvas));
+  cache.SweepAfterFrame();
+
+  // The most recently swept frame saw one successful probe.
+  EXPECT_EQ(cache.GetLastFrameChurn().hits, 1u);
+  EXPECT_EQ(cache.GetLastFrameChurn().misses, 0u);
+
+  auto stats = cache.GetChurnStats();
+  ASSERT_EQ(stats.size(), 1u);
+  EXPECT_EQ(stats[0].picture_id, picture->uniqueID());
+  EXPECT_EQ(stats[0].hit_count, 1u);
+  EXPECT_EQ(stats[0].miss_count, 1u);
+  EXPECT_EQ(stats[0].longest_miss_streak, 1u);
+  EXPECT_EQ(stats[0].current_miss_streak, 0u);
+
+  // Re-enabling starts a fresh measurement session.
+  cache.SetChurnInstrumentationEnabled(false);
+  cache.SetChurnInstrumentationEnabled(true);
+  EXPECT_TRUE(cache.GetChurnStats().empty());
+}
+
+TEST(RasterCache, ZeroByteBudgetLeavesCacheUnbounded) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  ASSERT_EQ(cache.GetCacheByteBudget(), 0u);
+
+  SkMatrix matrix = SkMatrix::I();
+  auto picture = GetSamplePicture();
+  SkCanvas dummy_canvas;
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+  ASSERT_FALSE(cache.Draw(*picture, dummy_canvas));
+  cache.SweepAfterFrame();
+
+  ASSERT_TRUE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+  ASSERT_GT(cache.GetCachedEntriesBytes(), 0u);
+  ASSERT_TRUE(cache.Draw(*picture, dummy_canvas));
+}
+
+TEST(RasterCache, ExpensivePictureSkipsMostOfTheAccessWindow) {
+  flutter::RasterCache cache(3);
+
+  SkMatrix matrix = SkMatrix::I();
+  auto picture = GetExpensiveSamplePicture();
+  SkCanvas dummy_canvas;
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), false, false));
+  // 1st access.
+  ASSERT_FALSE(cache.Draw(*picture, dummy_canvas));
+  cache.SweepAfterFrame();
+
+  // The op weighted score marks the picture expensive, so the second frame
+  // already caches it instead of waiting out the full three frame window.
+  ASSERT_TRUE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), false, false));
+  ASSERT_TRUE(cache.Draw(*picture, dummy_canvas));
+}
+
+TEST(RasterCache, ModestPictureStillWaitsOutTheAccessWindow) {
+  flutter::RasterCache cache(3);
+
+  SkMatrix matrix = SkMatrix::I();
+  auto picture = GetModestSamplePicture();
+  SkCanvas dummy_canvas;
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+
+  for (int access = 0; access < 3; access++) {
+    ASSERT_FALSE(
+        cache.Prepare(NULL, picture.get(), matrix, srgb.get(), false, false));
+    ASSERT_FALSE(cache.Draw(*picture, dummy_canvas));
+    cache.SweepAfterFrame();
+  }
+
+  ASSERT_TRUE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), false, false));
+  ASSERT_TRUE(cache.Draw(*picture, dummy_canvas));
+}
+
+TEST(RasterCache, ByteBudgetAdmissionPrefersExpensivePictures) {
+  flutter::RasterCache cache(1);
+  // Far smaller than any 150x100 N32 rasterization (60000 bytes).
+  cache.SetCacheByteBudget(1024u);
+
+  SkMatrix matrix = SkMatrix::I();
+  auto modest = GetModestSamplePicture();
+  auto expensive = GetExpensiveSamplePicture();
+  SkCanvas dummy_canvas;
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+
+  ASSERT_FALSE(
+      cache.Prepare(NULL, modest.get(), matrix, srgb.get(), false, false));
+  ASSERT_FALSE(cache.Draw(*modest, dummy_canvas));
+  cache.SweepAfterFrame();
+
+  // The modest picture cleared the access threshold, but it is not worth
+  // evicting older entries over budget for.
+  ASSERT_FALSE(
+      cache.Prepare(NULL, modest.get(), matrix, srgb.get(), false, false));
+
+  ASSERT_FALSE(
+      cache.Prepare(NULL, expensive.get(), matrix, srgb.get(), false, false));
+  ASSERT_FALSE(cache.Draw(*expensive, dummy_canvas));
+  cache.SweepAfterFrame();
+
+  // The expensive picture is admitted despite the budget pressure.
+  ASSERT_TRUE(
+      cache.Prepare(NULL, expensive.get(), matrix, srgb.get(), false, false));
+}
+
+TEST(RasterCache, AsyncPopulationProducesUsableEntries) {
+  auto loop = fml::ConcurrentMessageLoop::Create(2u);
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+  cache.SetAsyncTaskRunner(loop->GetTaskRunner());
+
+  SkMatrix matrix = SkMatrix::I();
+  auto picture = GetSamplePicture();
+  SkCanvas dummy_canvas;
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+  ASSERT_FALSE(cache.Draw(*picture, dummy_canvas));
+  cache.SweepAfterFrame();
+
+  // Population is asynchronous: this Prepare only schedules the
+  // rasterization on a worker.
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+
+  // The result is adopted at sweep time once the worker is done.
+  bool drawn = false;
+  for (int i = 0; i < 500; i++) {
+    cache.SweepAfterFrame();
+    if (cache.Draw(*picture, dummy_canvas)) {
+      drawn = true;
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  ASSERT_TRUE(drawn);
+  ASSERT_GT(cache.GetCachedEntriesBytes(), 0u);
+}
+
 TEST(RasterCache, SweepsRemoveUnusedFrames) {
   size_t threshold = 1;
   flutter::RasterCache cache(threshold);
@@ -133,6 +396,42 @@ TEST(RasterCache, SweepsRemoveUnusedFrames) {
 // Construct a cache result whose device target rectangle rounds out to be one
 // pixel wider than the cached image.  Verify that it can be drawn without
 // triggering any assertions.
+TEST(RasterCache, PersistentStoreRoundTrip) {
+  auto store = std::make_shared<FakeRasterCacheStore>();
+  SkMatrix matrix = SkMatrix::I();
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+  SkCanvas dummy_canvas;
+
+  {
+    flutter::RasterCache cache(1);
+    cache.SetPersistentStore(store);
+    auto picture = GetSamplePicture();
+    ASSERT_FALSE(
+        cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+    ASSERT_FALSE(cache.Draw(*picture, dummy_canvas));
+    cache.SweepAfterFrame();
+    ASSERT_TRUE(
+        cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+    ASSERT_EQ(store->store_count, 1u);
+  }
+
+  // A fresh cache with a re-recorded (but identical) picture, as after a
+  // relaunch: the entry is satisfied from the store without a second
+  // rasterization and store write.
+  flutter::RasterCache cache(1);
+  cache.SetPersistentStore(store);
+  auto picture = GetSamplePicture();
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+  ASSERT_FALSE(cache.Draw(*picture, dummy_canvas));
+  cache.SweepAfterFrame();
+  ASSERT_TRUE(
+      cache.Prepare(NULL, picture.get(), matrix, srgb.get(), true, false));
+  ASSERT_GT(store->load_count, 0u);
+  ASSERT_EQ(store->store_count, 1u);
+  ASSERT_TRUE(cache.Draw(*picture, dummy_canvas));
+}
+
 TEST(RasterCache, DeviceRectRoundOut) {
   size_t threshold = 1;
   flutter::RasterCache cache(threshold);
@@ -162,5 +461,91 @@ TEST(RasterCache, DeviceRectRoundOut) {
   ASSERT_TRUE(cache.Draw(*picture, canvas));
 }
 
+TEST(RasterCache, FractionalTranslationReusesCachedEntry) {
+  size_t threshold = 1;
+  flutter::RasterCache cache(threshold);
+
+  auto picture = GetSamplePicture();
+
+  const SkMatrix prepared_ctm =
+      RasterCache::GetIntegralTransCTM(SkMatrix::MakeTrans(100.4f, 100.6f));
+
+  SkCanvas canvas(300, 300, nullptr);
+
+  sk_sp<SkColorSpace> srgb = SkColorSpace::MakeSRGB();
+  ASSERT_FALSE(
+      cache.Prepare(NULL, picture.get(), prepared_ctm, srgb.get(), true,
+                    false));
+  cache.SweepAfterFrame();
+  ASSERT_TRUE(cache.Prepare(NULL, picture.get(), prepared_ctm, srgb.get(),
+                            true, false));
+
+  // Cache keys ignore translation, so the integrally rasterized entry is
+  // reused as the content drifts between pixel boundaries; the residual
+  // sub-pixel offset is applied at blit time.
+  canvas.setMatrix(SkMatrix::MakeTrans(100.4f, 100.6f));
+  ASSERT_TRUE(cache.Draw(*picture, canvas));
+
+  canvas.setMatrix(SkMatrix::MakeTrans(100.75f, 100.25f));
+  ASSERT_TRUE(cache.Draw(*picture, canvas));
+}
+
+TEST(RasterCache, ClipMaskSharedAcrossIdenticalShapes) {
+  flutter::RasterCache cache;
+
+  const SkRRect rrect =
+      SkRRect::MakeRectXY(SkRect::MakeWH(100, 80), 12, 12);
+  auto draw_shape = [&rrect](SkCanvas* canvas) {
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    canvas->drawRRect(rrect, paint);
+  };
+  const uint64_t key = RasterCache::HashClipShape(&rrect, sizeof(rrect));
+
+  // Twenty cards at different offsets of the same shape share one mask: the
+  // key ignores translation.
+  const RasterCacheResult* first = cache.GetClipMask(
+      key, nullptr, SkMatrix::MakeTrans(0, 0), rrect.getBounds(), draw_shape);
+  ASSERT_NE(first, nullptr);
+  ASSERT_EQ(cache.GetClipMaskCachedEntriesCount(), 1u);
+
+  const RasterCacheResult* second =
+      cache.GetClipMask(key, nullptr, SkMatrix::MakeTrans(0, 90),
+                        rrect.getBounds(), draw_shape);
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(cache.GetClipMaskCachedEntriesCount(), 1u);
+
+  // A different scale rasterizes at a different device size.
+  ASSERT_NE(cache.GetClipMask(key, nullptr, SkMatrix::MakeScale(2, 2),
+                              rrect.getBounds(), draw_shape),
+            nullptr);
+  ASSERT_EQ(cache.GetClipMaskCachedEntriesCount(), 2u);
+}
+
+TEST(RasterCache, ClipMaskSweptWhenUnused) {
+  flutter::RasterCache cache;
+
+  const SkRRect rrect = SkRRect::MakeRectXY(SkRect::MakeWH(50, 50), 8, 8);
+  auto draw_shape = [&rrect](SkCanvas* canvas) {
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    canvas->drawRRect(rrect, paint);
+  };
+  const uint64_t key = RasterCache::HashClipShape(&rrect, sizeof(rrect));
+
+  ASSERT_NE(cache.GetClipMask(key, nullptr, SkMatrix::I(), rrect.getBounds(),
+                              draw_shape),
+            nullptr);
+  ASSERT_EQ(cache.GetClipMaskCachedEntriesCount(), 1u);
+  ASSERT_GT(cache.GetCachedEntriesBytes(), 0u);
+
+  cache.SweepAfterFrame();   // Used this frame; retained.
+  ASSERT_EQ(cache.GetClipMaskCachedEntriesCount(), 1u);
+
+  cache.SweepAfterFrame();   // Unused for a frame; evicted.
+  ASSERT_EQ(cache.GetClipMaskCachedEntriesCount(), 0u);
+  ASSERT_EQ(cache.GetCachedEntriesBytes(), 0u);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -4,6 +4,8 @@
 
 #include "rtree.h"
 
+#include <algorithm>
+#include <cmath>
 #include <list>
 
 #include "flutter/fml/logging.h"
@@ -11,13 +13,153 @@
 
 namespace flutter {
 
-RTree::RTree() : bbh_{SkRTreeFactory{}()}, all_ops_count_(0) {}
+namespace {
+
+template <typename T>
+SkScalar CenterX(const T& entry) {
+  return entry.bounds.centerX();
+}
+
+template <typename T>
+SkScalar CenterY(const T& entry) {
+  return entry.bounds.centerY();
+}
+
+// Orders |entries| with the Sort-Tile-Recursive tiling for one tree level:
+// entries are sorted into vertical slices by center x, then by center y
+// within each slice, so that consecutive runs of |max_children| entries form
+// spatially compact nodes.
+template <typename T>
+void SortTileRecursive(std::vector<T>* entries, size_t max_children) {
+  const size_t node_count =
+      (entries->size() + max_children - 1) / max_children;
+  const size_t slices =
+      static_cast<size_t>(std::ceil(std::sqrt(node_count)));
+  const size_t slice_entries = slices * max_children;
+
+  std::sort(entries->begin(), entries->end(), [](const T& a, const T& b) {
+    return CenterX(a) < CenterX(b);
+  });
+  for (size_t start = 0; start < entries->size(); start += slice_entries) {
+    const size_t end = std::min(start + slice_entries, entries->size());
+    std::sort(entries->begin() + start, entries->begin() + end,
+              [](const T& a, const T& b) { return CenterY(a) < CenterY(b); });
+  }
+}
+
+}  // namespace
+
+PackedRTree::PackedRTree() = default;
+
+void PackedRTree::Build(const SkRect rects[], int N) {
+  nodes_.clear();
+  leaf_rects_.clear();
+  leaf_indices_.clear();
+
+  struct LeafEntry {
+    SkRect bounds;
+    int index;
+  };
+  std::vector<LeafEntry> leaves;
+  leaves.reserve(N);
+  for (int i = 0; i < N; i++) {
+    if (rects[i].isFinite() && !rects[i].isEmpty()) {
+      leaves.push_back({rects[i], i});
+    }
+  }
+  if (leaves.empty()) {
+    return;
+  }
+
+  SortTileRecursive(&leaves, kMaxChildren);
+  leaf_rects_.reserve(leaves.size());
+  leaf_indices_.reserve(leaves.size());
+  for (const LeafEntry& leaf : leaves) {
+    leaf_rects_.push_back(leaf.bounds);
+    leaf_indices_.push_back(leaf.index);
+  }
+
+  // Group the leaves into the bottom node level, then keep grouping nodes
+  // until a single root remains. Each level is retiled, appended to |nodes_|
+  // in its sorted order, and referenced from the level above by index, which
+  // keeps every node's children contiguous.
+  std::vector<Node> current;
+  for (size_t start = 0; start < leaf_rects_.size(); start += kMaxChildren) {
+    const size_t count =
+        std::min<size_t>(kMaxChildren, leaf_rects_.size() - start);
+    SkRect bounds = leaf_rects_[start];
+    for (size_t i = 1; i < count; i++) {
+      bounds.join(leaf_rects_[start + i]);
+    }
+    current.push_back({bounds, static_cast<uint32_t>(start),
+                       static_cast<uint16_t>(count), 1u});
+  }
+
+  while (true) {
+    SortTileRecursive(&current, kMaxChildren);
+    const uint32_t base = static_cast<uint32_t>(nodes_.size());
+    nodes_.insert(nodes_.end(), current.begin(), current.end());
+    if (current.size() == 1) {
+      break;  // That was the root.
+    }
+    std::vector<Node> parents;
+    for (size_t start = 0; start < current.size(); start += kMaxChildren) {
+      const size_t count =
+          std::min<size_t>(kMaxChildren, current.size() - start);
+      SkRect bounds = current[start].bounds;
+      for (size_t i = 1; i < count; i++) {
+        bounds.join(current[start + i].bounds);
+      }
+      parents.push_back({bounds, base + static_cast<uint32_t>(start),
+                         static_cast<uint16_t>(count), 0u});
+    }
+    current = std::move(parents);
+  }
+}
+
+void PackedRTree::Search(const SkRect& query,
+                         std::vector<int>* results) const {
+  if (nodes_.empty()) {
+    return;
+  }
+  // Deep enough for a full tree of 2^32 rects: each of the at most
+  // log16(2^32) = 8 levels contributes at most kMaxChildren entries.
+  uint32_t stack[256];
+  size_t stack_size = 0;
+  stack[stack_size++] = static_cast<uint32_t>(nodes_.size() - 1);
+  while (stack_size > 0) {
+    const Node& node = nodes_[stack[--stack_size]];
+    if (!SkRect::Intersects(node.bounds, query)) {
+      continue;
+    }
+    if (node.is_leaf) {
+      for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        if (SkRect::Intersects(leaf_rects_[i], query)) {
+          results->push_back(leaf_indices_[i]);
+        }
+      }
+    } else {
+      for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        FML_DCHECK(stack_size < sizeof(stack) / sizeof(stack[0]));
+        stack[stack_size++] = i;
+      }
+    }
+  }
+}
+
+size_t PackedRTree::BytesUsed() const {
+  return sizeof(PackedRTree) + nodes_.size() * sizeof(Node) +
+         leaf_rects_.size() * sizeof(SkRect) +
+         leaf_indices_.size() * sizeof(int);
+}
+
+RTree::RTree() : all_ops_count_(0) {}
 
 void RTree::insert(const SkRect boundsArray[],
                    const SkBBoxHierarchy::Metadata metadata[],
                    int N) {
   FML_DCHECK(0 == all_ops_count_);
-  bbh_->insert(boundsArray, metadata, N);
+  packed_tree_.Build(boundsArray, N);
   for (int i = 0; i < N; i++) {
     if (metadata != nullptr && metadata[i].isDraw) {
       draw_op_[i] = boundsArray[i];
@@ -31,7 +173,10 @@ void RTree::insert(const SkRect boundsArray[], int N) {
 }
 
 void RTree::search(const SkRect& query, std::vector<int>* results) const {
-  bbh_->search(query, results);
+  packed_tree_.Search(query, results);
+  // The packed tree returns hits in tree order; playback expects operation
+  // order.
+  std::sort(results->begin(), results->end());
 }
 
 std::list<SkRect> RTree::searchNonOverlappingDrawnRects(
@@ -82,7 +227,7 @@ std::list<SkRect> RTree::searchNonOverlappingDrawnRects(
 }
 
 size_t RTree::bytesUsed() const {
-  return bbh_->bytesUsed();
+  return packed_tree_.BytesUsed();
 }
 
 RTreeFactory::RTreeFactory() {
@@ -5,15 +5,66 @@
 #ifndef FLUTTER_FLOW_RTREE_H_
 #define FLUTTER_FLOW_RTREE_H_
 
+#include <cstdint>
 #include <list>
 #include <map>
+#include <vector>
 
 #include "third_party/skia/include/core/SkBBHFactory.h"
 #include "third_party/skia/include/core/SkTypes.h"
 
 namespace flutter {
+
+/**
+ * An R-tree over a fixed set of rects, bulk-loaded with the
+ * Sort-Tile-Recursive (STR) algorithm.
+ *
+ * All nodes live in a single contiguous array and reference their children
+ * by index, so queries walk sequential memory with an explicit stack instead
+ * of recursing through heap-allocated nodes. The leaf bounds are likewise
+ * packed into one contiguous array that is scanned linearly per leaf node.
+ * The tree is immutable once built, which matches how the compositor uses
+ * it: a picture is recorded once and queried every frame.
+ */
+class PackedRTree {
+ public:
+  PackedRTree();
+
+  // Builds the tree over |N| rects, discarding any previous contents.
+  // Empty and non-finite rects are never returned by |Search|.
+  void Build(const SkRect rects[], int N);
+
+  // Appends the indices (into the rect array given to |Build|) of all rects
+  // that intersect |query| to |results|, in tree order. The caller sorts if
+  // insertion order is required.
+  void Search(const SkRect& query, std::vector<int>* results) const;
+
+  size_t BytesUsed() const;
+
+ private:
+  // With a fanout of 16, the child bounds inspected while visiting a node
+  // occupy four consecutive cache lines.
+  static constexpr int kMaxChildren = 16;
+
+  struct Node {
+    SkRect bounds;
+    // Index of the first child in |nodes_|, or of the first entry in
+    // |leaf_rects_| when |is_leaf| is set. Children are contiguous.
+    uint32_t first;
+    uint16_t count;
+    uint16_t is_leaf;
+  };
+
+  // Nodes are appended level by level, leaves first; the root is the last
+  // element.
+  std::vector<Node> nodes_;
+  // Leaf bounds in STR order, and the original rect indices they came from.
+  std::vector<SkRect> leaf_rects_;
+  std::vector<int> leaf_indices_;
+};
+
 /**
- * An R-Tree implementation that forwards calls to an SkRTree.
+ * An R-Tree implementation backed by a bulk-loaded PackedRTree.
  *
  * This implementation provides a searchNonOverlappingDrawnRects method,
  * which can be used to query the rects for the operations recorded in the tree.
@@ -44,7 +95,7 @@ class RTree : public SkBBoxHierarchy {
   // A map containing the draw operation rects keyed off the operation index
   // in the insert call.
   std::map<int, SkRect> draw_op_;
-  sk_sp<SkBBoxHierarchy> bbh_;
+  PackedRTree packed_tree_;
   int all_ops_count_;
 };
 
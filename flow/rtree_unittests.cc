@@ -231,5 +231,56 @@ TEST(RTree, searchNonOverlappingDrawnRects_JoinRectsWhenIntersectedCase3) {
   ASSERT_EQ(*hits.begin(), SkRect::MakeLTRB(50, 50, 620, 300));
 }
 
+TEST(RTree, searchMatchesLinearScanOnLargeSets) {
+  // Exercises the packed tree across multiple node levels and verifies the
+  // results against a brute-force scan, including the sorted-result
+  // contract that picture playback relies on.
+  constexpr int kRectCount = 2000;
+  std::vector<SkRect> rects;
+  rects.reserve(kRectCount);
+  for (int i = 0; i < kRectCount; i++) {
+    // A deterministic pseudo-random scatter of small rects.
+    const SkScalar x = static_cast<SkScalar>((i * 373) % 997);
+    const SkScalar y = static_cast<SkScalar>((i * 761) % 983);
+    rects.push_back(SkRect::MakeXYWH(x, y, 5 + i % 17, 5 + i % 23));
+  }
+
+  auto r_tree = sk_make_sp<RTree>();
+  r_tree->insert(rects.data(), kRectCount);
+
+  const SkRect queries[] = {
+      SkRect::MakeLTRB(0, 0, 50, 50),
+      SkRect::MakeLTRB(400, 300, 600, 700),
+      SkRect::MakeLTRB(0, 0, 1000, 1000),
+      SkRect::MakeLTRB(-100, -100, -1, -1),
+  };
+  for (const SkRect& query : queries) {
+    std::vector<int> expected;
+    for (int i = 0; i < kRectCount; i++) {
+      if (SkRect::Intersects(rects[i], query)) {
+        expected.push_back(i);
+      }
+    }
+    std::vector<int> actual;
+    r_tree->search(query, &actual);
+    ASSERT_EQ(expected, actual);
+  }
+}
+
+TEST(RTree, searchSkipsEmptyRects) {
+  const SkRect rects[] = {
+      SkRect::MakeLTRB(10, 10, 20, 20),
+      SkRect::MakeEmpty(),
+      SkRect::MakeLTRB(15, 15, 25, 25),
+  };
+
+  auto r_tree = sk_make_sp<RTree>();
+  r_tree->insert(rects, 3);
+
+  std::vector<int> results;
+  r_tree->search(SkRect::MakeLTRB(0, 0, 100, 100), &results);
+  ASSERT_EQ(results, (std::vector<int>{0, 2}));
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -50,6 +50,38 @@ static void SetEntityNodeClipPlanes(scenic::EntityNode& entity_node,
   entity_node.SetClipPlanes(std::move(clip_planes));
 }
 
+// Fingerprints everything that determines the pixels a paint task produces.
+// Layers the framework retains across frames keep their unique ids, so a
+// static card hashes to the same value every frame; a rebuilt subtree gets
+// fresh ids and therefore a fresh signature. Returns a non-zero value as 0
+// is reserved for "not fingerprinted".
+static uint64_t ComputePaintContentSignature(
+    SkColor background_color,
+    SkScalar scale_x,
+    SkScalar scale_y,
+    const SkRect& paint_bounds,
+    const std::vector<Layer*>& layers) {
+  // FNV-1a, folding in the raw bits of each field.
+  uint64_t hash = 0xcbf29ce484222325ull;
+  auto fold = [&hash](const void* data, size_t length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++) {
+      hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+  };
+  fold(&background_color, sizeof(background_color));
+  fold(&scale_x, sizeof(scale_x));
+  fold(&scale_y, sizeof(scale_y));
+  fold(&paint_bounds, sizeof(paint_bounds));
+  for (Layer* layer : layers) {
+    uint64_t unique_id = layer->unique_id();
+    fold(&unique_id, sizeof(unique_id));
+    SkRect bounds = layer->paint_bounds();
+    fold(&bounds, sizeof(bounds));
+  }
+  return hash == 0 ? 1 : hash;
+}
+
 SceneUpdateContext::SceneUpdateContext(scenic::Session* session,
                                        SurfaceProducer* surface_producer)
     : session_(session), surface_producer_(surface_producer) {
@@ -176,6 +208,9 @@ scenic::Image* SceneUpdateContext::GenerateImageIfNeeded(
 
   auto image = surface->GetImage();
 
+  const uint64_t content_signature = ComputePaintContentSignature(
+      color, scale_x, scale_y, paint_bounds, paint_layers);
+
   // Enqueue the paint task.
   paint_tasks_.push_back({.surface = std::move(surface),
                           .left = paint_bounds.left(),
@@ -183,7 +218,8 @@ scenic::Image* SceneUpdateContext::GenerateImageIfNeeded(
                           .scale_x = scale_x,
                           .scale_y = scale_y,
                           .background_color = color,
-                          .layers = std::move(paint_layers)});
+                          .layers = std::move(paint_layers),
+                          .content_signature = content_signature});
   return image;
 }
 
@@ -194,6 +230,16 @@ SceneUpdateContext::ExecutePaintTasks(CompositorContext::ScopedFrame& frame) {
   std::vector<std::unique_ptr<SurfaceProducerSurface>> surfaces_to_submit;
   for (auto& task : paint_tasks_) {
     FML_DCHECK(task.surface);
+    // If the pool handed back a surface that already holds exactly these
+    // pixels from a prior frame, re-present it without rasterizing. Static
+    // content keeps cycling through the same few buffers, so this turns the
+    // steady state for an unchanged card into a pure re-present.
+    if (task.content_signature != 0 &&
+        task.surface->GetContentSignature() == task.content_signature) {
+      TRACE_EVENT_INSTANT0("flutter", "paint task content unchanged");
+      surfaces_to_submit.emplace_back(std::move(task.surface));
+      continue;
+    }
     SkCanvas* canvas = task.surface->GetSkiaSurface()->getCanvas();
     Layer::PaintContext context = {canvas,
                                    canvas,
@@ -201,6 +247,7 @@ SceneUpdateContext::ExecutePaintTasks(CompositorContext::ScopedFrame& frame) {
                                    nullptr,
                                    frame.context().raster_time(),
                                    frame.context().ui_time(),
+                                   frame.context().gpu_time(),
                                    frame.context().texture_registry(),
                                    &frame.context().raster_cache(),
                                    false,
@@ -214,6 +261,7 @@ SceneUpdateContext::ExecutePaintTasks(CompositorContext::ScopedFrame& frame) {
     for (Layer* layer : task.layers) {
       layer->Paint(context);
     }
+    task.surface->SetContentSignature(task.content_signature);
     surfaces_to_submit.emplace_back(std::move(task.surface));
   }
   paint_tasks_.clear();
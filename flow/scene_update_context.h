@@ -52,6 +52,15 @@ class SceneUpdateContext {
     virtual scenic::Image* GetImage() = 0;
 
     virtual sk_sp<SkSurface> GetSkiaSurface() const = 0;
+
+    // The signature of the content last painted into this surface, or 0 if
+    // unknown. When a recycled surface comes back with the signature the
+    // current frame is about to paint, the paint is skipped and the buffer
+    // is re-presented as is. Backends that cannot guarantee their pixels
+    // survive recycling must keep returning 0.
+    virtual uint64_t GetContentSignature() const { return 0; }
+
+    virtual void SetContentSignature(uint64_t signature) {}
   };
 
   class SurfaceProducer {
@@ -213,6 +222,9 @@ class SceneUpdateContext {
     SkScalar scale_y;
     SkColor background_color;
     std::vector<Layer*> layers;
+    // Hash of everything that determines the painted pixels; 0 when the
+    // content cannot be fingerprinted. See |ExecutePaintTasks|.
+    uint64_t content_signature;
   };
 
   // Setup the entity_node as a frame that materialize all the paint_layers. In
@@ -14,18 +14,20 @@ SkiaUnrefQueue::SkiaUnrefQueue(fml::RefPtr<fml::TaskRunner> task_runner,
                                fml::WeakPtr<GrContext> context)
     : task_runner_(std::move(task_runner)),
       drain_delay_(delay),
-      drain_pending_(false),
       context_(context) {}
 
 SkiaUnrefQueue::~SkiaUnrefQueue() {
-  FML_DCHECK(objects_.empty());
+  FML_DCHECK(head_.load(std::memory_order_acquire) == nullptr);
 }
 
 void SkiaUnrefQueue::Unref(SkRefCnt* object) {
-  std::scoped_lock lock(mutex_);
-  objects_.push_back(object);
-  if (!drain_pending_) {
-    drain_pending_ = true;
+  UnrefNode* node =
+      new UnrefNode{object, head_.load(std::memory_order_relaxed)};
+  while (!head_.compare_exchange_weak(node->next, node,
+                                      std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+  }
+  if (!drain_pending_.exchange(true, std::memory_order_acq_rel)) {
     task_runner_->PostDelayedTask(
         [strong = fml::Ref(this)]() { strong->Drain(); }, drain_delay_);
   }
@@ -33,20 +35,32 @@ void SkiaUnrefQueue::Unref(SkRefCnt* object) {
 
 void SkiaUnrefQueue::Drain() {
   TRACE_EVENT0("flutter", "SkiaUnrefQueue::Drain");
-  std::deque<SkRefCnt*> skia_objects;
-  {
-    std::scoped_lock lock(mutex_);
-    objects_.swap(skia_objects);
-    drain_pending_ = false;
-  }
+  // Clear the pending flag before taking the list so that objects queued
+  // concurrently with this drain schedule a new one instead of stalling.
+  drain_pending_.store(false, std::memory_order_release);
+  UnrefNode* node = head_.exchange(nullptr, std::memory_order_acquire);
 
-  for (SkRefCnt* skia_object : skia_objects) {
-    skia_object->unref();
+  size_t drained = 0;
+  while (node) {
+    node->object->unref();
+    UnrefNode* next = node->next;
+    delete node;
+    node = next;
+    drained++;
   }
 
-  if (context_ && skia_objects.size() > 0) {
+  // One deferred cleanup services the entire batch of unrefs.
+  if (context_ && drained > 0) {
     context_->performDeferredCleanup(std::chrono::milliseconds(0));
   }
+
+  // Close the race where a producer saw the stale pending flag after this
+  // drain already took the list: any such leftovers get a fresh drain.
+  if (head_.load(std::memory_order_acquire) != nullptr &&
+      !drain_pending_.exchange(true, std::memory_order_acq_rel)) {
+    task_runner_->PostDelayedTask(
+        [strong = fml::Ref(this)]() { strong->Drain(); }, drain_delay_);
+  }
 }
 
 }  // namespace flutter
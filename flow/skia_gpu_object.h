@@ -5,8 +5,7 @@
 #ifndef FLUTTER_FLOW_SKIA_GPU_OBJECT_H_
 #define FLUTTER_FLOW_SKIA_GPU_OBJECT_H_
 
-#include <mutex>
-#include <queue>
+#include <atomic>
 
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/weak_ptr.h"
@@ -18,6 +17,11 @@ namespace flutter {
 
 // A queue that holds Skia objects that must be destructed on the given task
 // runner.
+//
+// Unref may be called from any thread and is lock-free: pending objects are
+// pushed onto an atomic intrusive stack, so hundreds of image releases per
+// frame from the UI and raster threads never contend on a mutex. Drains run
+// on the queue's task runner, which is the single consumer.
 class SkiaUnrefQueue : public fml::RefCountedThreadSafe<SkiaUnrefQueue> {
  public:
   void Unref(SkRefCnt* object);
@@ -26,15 +30,21 @@ class SkiaUnrefQueue : public fml::RefCountedThreadSafe<SkiaUnrefQueue> {
   // shutdown (when the platform side reference to the OpenGL context is about
   // to go away), we may need to pre-emptively drain the unref queue. It is the
   // responsibility of the caller to ensure that no further unrefs are queued
-  // after this call.
+  // after this call. The drain is also invoked on memory pressure so that
+  // queued GPU resources are returned to Skia ahead of the delay.
   void Drain();
 
  private:
+  // A link in the lock-free stack of objects awaiting an unref.
+  struct UnrefNode {
+    SkRefCnt* object;
+    UnrefNode* next;
+  };
+
   const fml::RefPtr<fml::TaskRunner> task_runner_;
   const fml::TimeDelta drain_delay_;
-  std::mutex mutex_;
-  std::deque<SkRefCnt*> objects_;
-  bool drain_pending_;
+  std::atomic<UnrefNode*> head_ = {nullptr};
+  std::atomic<bool> drain_pending_ = {false};
   fml::WeakPtr<GrContext> context_;
 
   // The `GrContext* context` is only used for signaling Skia to
@@ -11,7 +11,10 @@
 #include "gtest/gtest.h"
 #include "third_party/skia/include/core/SkRefCnt.h"
 
+#include <atomic>
 #include <future>
+#include <thread>
+#include <vector>
 
 namespace flutter {
 namespace testing {
@@ -111,6 +114,53 @@ TEST_F(SkiaGpuObjectTest, ObjectReset) {
   ASSERT_EQ(dtor_task_queue_id, unref_task_runner()->GetTaskQueueId());
 }
 
+TEST_F(SkiaGpuObjectTest, ConcurrentUnrefs) {
+  constexpr int kThreadCount = 4;
+  constexpr int kObjectsPerThread = 250;
+
+  std::shared_ptr<std::atomic<int>> destroyed =
+      std::make_shared<std::atomic<int>>(0);
+  std::shared_ptr<fml::AutoResetWaitableEvent> latch =
+      std::make_shared<fml::AutoResetWaitableEvent>();
+
+  class CountingSkObject : public SkRefCnt {
+   public:
+    CountingSkObject(std::shared_ptr<std::atomic<int>> destroyed,
+                     std::shared_ptr<fml::AutoResetWaitableEvent> latch,
+                     int expected)
+        : destroyed_(std::move(destroyed)),
+          latch_(std::move(latch)),
+          expected_(expected) {}
+
+    ~CountingSkObject() {
+      if (++(*destroyed_) == expected_) {
+        latch_->Signal();
+      }
+    }
+
+   private:
+    std::shared_ptr<std::atomic<int>> destroyed_;
+    std::shared_ptr<fml::AutoResetWaitableEvent> latch_;
+    int expected_;
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreadCount; i++) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < kObjectsPerThread; j++) {
+        unref_queue()->Unref(new CountingSkObject(
+            destroyed, latch, kThreadCount * kObjectsPerThread));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  latch->Wait();
+  ASSERT_EQ(destroyed->load(), kThreadCount * kObjectsPerThread);
+}
+
 TEST_F(SkiaGpuObjectTest, ObjectResetTwice) {
   std::shared_ptr<fml::AutoResetWaitableEvent> latch =
       std::make_shared<fml::AutoResetWaitableEvent>();
@@ -46,7 +46,7 @@ class LayerTestBase : public CanvasTestBase<BaseT> {
             mutators_stack_, TestT::mock_canvas().imageInfo().colorSpace(),
             kGiantRect, /* cull_rect */
             false,      /* layer reads from surface */
-            raster_time_, ui_time_, texture_registry_,
+            raster_time_, ui_time_, gpu_time_, texture_registry_,
             false,  /* checkerboard_offscreen_layers */
             100.0f, /* frame_physical_depth */
             1.0f,   /* frame_device_pixel_ratio */
@@ -58,7 +58,7 @@ class LayerTestBase : public CanvasTestBase<BaseT> {
             &TestT::mock_canvas(),                  /* leaf_nodes_canvas */
             nullptr,                                /* gr_context */
             nullptr,                                /* external_view_embedder */
-            raster_time_, ui_time_, texture_registry_,
+            raster_time_, ui_time_, gpu_time_, texture_registry_,
             nullptr, /* raster_cache */
             false,   /* checkerboard_offscreen_layers */
             100.0f,  /* frame_physical_depth */
@@ -130,6 +130,7 @@ class LayerTestBase : public CanvasTestBase<BaseT> {
 
   Stopwatch raster_time_;
   Stopwatch ui_time_;
+  Stopwatch gpu_time_;
   MutatorsStack mutators_stack_;
   TextureRegistry texture_registry_;
 
@@ -4,45 +4,101 @@
 
 #include "flutter/flow/texture.h"
 
+#include <utility>
+
+#include "third_party/skia/include/gpu/GrContext.h"
+
 namespace flutter {
 
 Texture::Texture(int64_t id) : id_(id) {}
 
 Texture::~Texture() = default;
 
-TextureRegistry::TextureRegistry() = default;
+bool Texture::SupportsAheadOfRasterUpload() const {
+  return false;
+}
+
+std::unique_ptr<TextureFrame> Texture::UploadFrame(
+    GrContext* resource_context) {
+  return nullptr;
+}
+
+void Texture::PublishFrame(std::unique_ptr<TextureFrame> frame) {
+  std::scoped_lock lock(published_frame_mutex_);
+  published_frame_ = std::move(frame);
+}
+
+std::unique_ptr<TextureFrame> Texture::ConsumePublishedFrame() {
+  std::scoped_lock lock(published_frame_mutex_);
+  return std::move(published_frame_);
+}
+
+// static
+void Texture::WaitOnReadyFence(GrContext* context, const TextureFrame& frame) {
+  if (context && frame.has_ready_fence) {
+    context->wait(1, &frame.ready_fence);
+  }
+}
+
+TextureRegistry::TextureRegistry()
+    : mapping_(std::make_shared<const Mapping>()) {}
+
+std::shared_ptr<const TextureRegistry::Mapping> TextureRegistry::GetMapping()
+    const {
+  return std::atomic_load(&mapping_);
+}
 
 void TextureRegistry::RegisterTexture(std::shared_ptr<Texture> texture) {
   if (!texture) {
     return;
   }
-  mapping_[texture->Id()] = texture;
+  std::scoped_lock lock(write_mutex_);
+  auto updated = std::make_shared<Mapping>(*mapping_);
+  (*updated)[texture->Id()] = std::move(texture);
+  std::atomic_store(&mapping_,
+                    std::shared_ptr<const Mapping>(std::move(updated)));
 }
 
 void TextureRegistry::UnregisterTexture(int64_t id) {
-  auto found = mapping_.find(id);
-  if (found == mapping_.end()) {
-    return;
+  std::shared_ptr<Texture> unregistered;
+  {
+    std::scoped_lock lock(write_mutex_);
+    auto found = mapping_->find(id);
+    if (found == mapping_->end()) {
+      return;
+    }
+    unregistered = found->second;
+    auto updated = std::make_shared<Mapping>(*mapping_);
+    updated->erase(id);
+    std::atomic_store(&mapping_,
+                      std::shared_ptr<const Mapping>(std::move(updated)));
   }
-  found->second->OnTextureUnregistered();
-  mapping_.erase(found);
+  // Readers holding an older snapshot keep the texture alive until they
+  // release it; the callback itself fires on the unregistering thread as
+  // before.
+  unregistered->OnTextureUnregistered();
 }
 
 void TextureRegistry::OnGrContextCreated() {
-  for (auto& it : mapping_) {
+  auto mapping = GetMapping();
+  for (const auto& it : *mapping) {
     it.second->OnGrContextCreated();
   }
 }
 
 void TextureRegistry::OnGrContextDestroyed() {
-  for (auto& it : mapping_) {
+  // The sweep walks its own snapshot, so concurrent lookups and mutations
+  // proceed unimpeded while each texture drops its GPU resources.
+  auto mapping = GetMapping();
+  for (const auto& it : *mapping) {
     it.second->OnGrContextDestroyed();
   }
 }
 
 std::shared_ptr<Texture> TextureRegistry::GetTexture(int64_t id) {
-  auto it = mapping_.find(id);
-  return it != mapping_.end() ? it->second : nullptr;
+  auto mapping = GetMapping();
+  auto it = mapping->find(id);
+  return it != mapping->end() ? it->second : nullptr;
 }
 
 }  // namespace flutter
@@ -6,13 +6,27 @@
 #define FLUTTER_FLOW_TEXTURE_H_
 
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "third_party/skia/include/core/SkCanvas.h"
+#include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/gpu/GrBackendSemaphore.h"
 
 namespace flutter {
 
+// A frame resolved ahead of raster by a texture source on the IO context.
+// The image is backed by the resource context; when |has_ready_fence| is
+// set, the raster context must wait on |ready_fence| before sampling the
+// image so that the upload is visible to it.
+struct TextureFrame {
+  sk_sp<SkImage> image;
+  GrBackendSemaphore ready_fence;
+  bool has_ready_fence = false;
+};
+
 class Texture {
  public:
   Texture(int64_t id);  // Called from UI or raster thread.
@@ -36,14 +50,52 @@ class Texture {
   // Called on raster thread.
   virtual void OnTextureUnregistered() = 0;
 
+  // Whether this texture resolves its frames on the IO context via
+  // |UploadFrame| instead of synchronously during |Paint|. Sources that
+  // return true here have their uploads scheduled on the IO task runner
+  // whenever a new frame is marked available.
+  virtual bool SupportsAheadOfRasterUpload() const;
+
+  // Called on the IO task runner for textures that support ahead of raster
+  // uploads. Implementations resolve their latest frame into an image backed
+  // by the resource context, flush the context with a signal semaphore
+  // recorded in the frame's ready fence and return the frame. Returning
+  // nullptr skips publication, e.g. when no new frame is pending.
+  virtual std::unique_ptr<TextureFrame> UploadFrame(
+      GrContext* resource_context);
+
+  // Makes an uploaded frame available to the raster thread. Only the most
+  // recently published frame is retained. Called on the IO task runner.
+  void PublishFrame(std::unique_ptr<TextureFrame> frame);
+
+  // Takes ownership of the most recently published frame, or returns nullptr
+  // if nothing has been published since the last call. Implementations of
+  // |Paint| hold on to the consumed frame so it can be redrawn until the
+  // next one arrives. Called from raster thread.
+  std::unique_ptr<TextureFrame> ConsumePublishedFrame();
+
   int64_t Id() { return id_; }
 
+ protected:
+  // Blocks the raster context on a published frame's ready fence, if any.
+  static void WaitOnReadyFence(GrContext* context, const TextureFrame& frame);
+
  private:
   int64_t id_;
 
+  std::mutex published_frame_mutex_;
+  std::unique_ptr<TextureFrame> published_frame_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(Texture);
 };
 
+// The registry is copy-on-write: mutations build a fresh immutable map and
+// publish it with an atomic swap, while readers grab the current snapshot
+// without taking a lock. Raster work that resolves textures mid-frame can
+// therefore never stall behind a register/unregister burst (a scrolling
+// grid of videos produces plenty) or behind a context-lost sweep. A texture
+// unregistered while a reader still holds a snapshot stays alive until that
+// snapshot is released.
 class TextureRegistry {
  public:
   TextureRegistry();
@@ -54,7 +106,7 @@ class TextureRegistry {
   // Called from raster thread.
   void UnregisterTexture(int64_t id);
 
-  // Called from raster thread.
+  // Lock free; called from raster thread.
   std::shared_ptr<Texture> GetTexture(int64_t id);
 
   // Called from raster thread.
@@ -64,7 +116,15 @@ class TextureRegistry {
   void OnGrContextDestroyed();
 
  private:
-  std::map<int64_t, std::shared_ptr<Texture>> mapping_;
+  using Mapping = std::map<int64_t, std::shared_ptr<Texture>>;
+
+  // Returns the current snapshot; never null.
+  std::shared_ptr<const Mapping> GetMapping() const;
+
+  // Loaded and stored atomically. Mutators copy the current snapshot under
+  // |write_mutex_| and swap the new one in.
+  std::shared_ptr<const Mapping> mapping_;
+  std::mutex write_mutex_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(TextureRegistry);
 };
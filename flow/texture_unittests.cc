@@ -5,6 +5,8 @@
 #include "flutter/flow/testing/mock_texture.h"
 #include "flutter/flow/texture.h"
 
+#include <thread>
+
 #include "gtest/gtest.h"
 
 namespace flutter {
@@ -95,5 +97,46 @@ TEST(TextureRegistryTest, ReuseSameTextureSlot) {
   ASSERT_TRUE(mock_texture2->unregistered());
 }
 
+TEST(TextureRegistryTest, LookupsProceedDuringMutationBursts) {
+  TextureRegistry registry;
+  auto pinned = std::make_shared<MockTexture>(-1);
+  registry.RegisterTexture(pinned);
+
+  // Churn registrations the way a scrolling grid of textures does while a
+  // reader resolves continuously; every lookup must observe a coherent
+  // snapshot.
+  std::thread mutator([&registry] {
+    for (int64_t i = 0; i < 500; i++) {
+      registry.RegisterTexture(std::make_shared<MockTexture>(i % 5));
+      registry.UnregisterTexture(i % 5);
+    }
+  });
+  std::thread reader([&registry, &pinned] {
+    for (int i = 0; i < 500; i++) {
+      ASSERT_EQ(registry.GetTexture(-1), pinned);
+      registry.GetTexture(i % 5);
+    }
+  });
+  mutator.join();
+  reader.join();
+}
+
+TEST(TextureTest, PublishedFramesAreConsumedNewestFirst) {
+  MockTexture texture(0);
+  ASSERT_FALSE(texture.SupportsAheadOfRasterUpload());
+  ASSERT_EQ(texture.ConsumePublishedFrame(), nullptr);
+
+  auto first = std::make_unique<TextureFrame>();
+  auto second = std::make_unique<TextureFrame>();
+  const TextureFrame* second_frame = second.get();
+  texture.PublishFrame(std::move(first));
+  texture.PublishFrame(std::move(second));
+
+  // Only the most recently published frame is retained, and consuming it
+  // empties the slot.
+  ASSERT_EQ(texture.ConsumePublishedFrame().get(), second_frame);
+  ASSERT_EQ(texture.ConsumePublishedFrame(), nullptr);
+}
+
 }  // namespace testing
 }  // namespace flutter
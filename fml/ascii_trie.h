@@ -5,12 +5,21 @@
 #ifndef FLUTTER_FML_ASCIITRIE_H_
 #define FLUTTER_FML_ASCIITRIE_H_
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace fml {
 
 /// A trie for looking for ASCII prefixes.
+///
+/// Queries run against a flattened layout: nodes live in one contiguous
+/// array and each node's edge labels are stored back to back, so a lookup
+/// tests eight candidate labels per 64-bit word instead of chasing one
+/// child pointer per label. The first character is additionally screened
+/// against a 128-bit bitmap of the root's edges, which rejects most
+/// non-matching queries without touching the node array at all.
 class AsciiTrie {
  public:
   struct TrieNode;
@@ -23,7 +32,15 @@ class AsciiTrie {
 
   /// Returns true if \p argument is prefixed by the contents of the trie.
   inline bool Query(const char* argument) {
-    return !node_ || Query(node_.get(), argument);
+    if (nodes_.empty()) {
+      return true;
+    }
+    int ch = static_cast<uint8_t>(argument[0]);
+    if (ch >= kMaxAsciiValue ||
+        !(root_bitmap_[ch >> 6] & (1ull << (ch & 63)))) {
+      return false;
+    }
+    return QueryFlat(argument);
   }
 
   struct TrieNode {
@@ -31,8 +48,20 @@ class AsciiTrie {
   };
 
  private:
-  static bool Query(TrieNode* trie, const char* query);
-  TrieNodePtr node_;
+  /// A node in the flattened trie. Its outgoing edge labels occupy
+  /// |edge_labels_[first_edge .. first_edge + edge_count)| with the
+  /// matching child indices at the same offsets in |edge_targets_|.
+  struct FlatNode {
+    uint32_t first_edge;
+    uint32_t edge_count;
+  };
+
+  bool QueryFlat(const char* query) const;
+
+  std::vector<FlatNode> nodes_;
+  std::vector<uint8_t> edge_labels_;
+  std::vector<uint32_t> edge_targets_;
+  uint64_t root_bitmap_[2] = {0, 0};
 };
 }  // namespace fml
 
@@ -34,3 +34,16 @@ TEST(AsciiTableTest, MultipleEntries) {
   ASSERT_TRUE(trie.Query("foozzz"));
   ASSERT_TRUE(trie.Query("barzzz"));
 }
+
+TEST(AsciiTableTest, ManyEntries) {
+  // More than eight edges at one node exercises the second label chunk of
+  // the word-at-a-time edge scan.
+  AsciiTrie trie;
+  auto entries = std::vector<std::string>{"aa", "bb", "cc", "dd", "ee", "ff",
+                                          "gg", "hh", "ii", "jj", "kk", "ll"};
+  trie.Fill(entries);
+  ASSERT_TRUE(trie.Query("kkx"));
+  ASSERT_TRUE(trie.Query("ll"));
+  ASSERT_FALSE(trie.Query("zz"));
+  ASSERT_FALSE(trie.Query(""));
+}
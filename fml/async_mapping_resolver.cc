@@ -0,0 +1,54 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/async_mapping_resolver.h"
+
+#include <utility>
+
+#include "flutter/fml/synchronization/count_down_latch.h"
+
+namespace fml {
+
+AsyncMappingResolver::AsyncMappingResolver(
+    std::shared_ptr<ConcurrentTaskRunner> workers)
+    : workers_(std::move(workers)) {}
+
+AsyncMappingResolver::~AsyncMappingResolver() = default;
+
+std::vector<std::unique_ptr<Mapping>> AsyncMappingResolver::ResolveBatch(
+    std::vector<MappingJob> jobs) const {
+  std::vector<std::unique_ptr<Mapping>> results(jobs.size());
+
+  if (jobs.empty()) {
+    return results;
+  }
+
+  if (!workers_ || jobs.size() == 1) {
+    for (size_t i = 0; i < jobs.size(); ++i) {
+      if (jobs[i]) {
+        results[i] = jobs[i]();
+      }
+    }
+    return results;
+  }
+
+  // The jobs, results and latch all outlive the wait below, so the posted
+  // tasks may refer to them by pointer.
+  CountDownLatch latch(jobs.size());
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    MappingJob* job = &jobs[i];
+    std::unique_ptr<Mapping>* result = &results[i];
+    workers_->PostTask([job, result, &latch]() {
+      if (*job) {
+        *result = (*job)();
+      }
+      latch.CountDown();
+    });
+  }
+  latch.Wait();
+
+  return results;
+}
+
+}  // namespace fml
@@ -0,0 +1,51 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_ASYNC_MAPPING_RESOLVER_H_
+#define FLUTTER_FML_ASYNC_MAPPING_RESOLVER_H_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace fml {
+
+/// Resolves batches of file mappings concurrently. Opening and mapping a
+/// file is dominated by per-call syscall and page fault latency, so reading
+/// many small files one after another from a single thread serializes those
+/// stalls. This helper fans a batch of mapping jobs out to a concurrent
+/// worker pool so the stalls overlap, and degrades to inline execution when
+/// no pool is available.
+class AsyncMappingResolver {
+ public:
+  /// Produces one mapping, or nullptr for a miss. Jobs may run on worker
+  /// threads concurrently with one another and must be safe to invoke off
+  /// the submitting thread.
+  using MappingJob = std::function<std::unique_ptr<Mapping>()>;
+
+  /// The workers may be null, in which case every batch runs inline on the
+  /// submitting thread.
+  explicit AsyncMappingResolver(std::shared_ptr<ConcurrentTaskRunner> workers);
+
+  ~AsyncMappingResolver();
+
+  /// Runs all jobs and blocks until every one has finished. Results are
+  /// returned in submission order. Single-job batches run inline since
+  /// there is nothing to overlap.
+  std::vector<std::unique_ptr<Mapping>> ResolveBatch(
+      std::vector<MappingJob> jobs) const;
+
+ private:
+  std::shared_ptr<ConcurrentTaskRunner> workers_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AsyncMappingResolver);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_ASYNC_MAPPING_RESOLVER_H_
@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/async_mapping_resolver.h"
+
+#include <atomic>
+#include <string>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+
+static AsyncMappingResolver::MappingJob MakeJob(const std::string& contents) {
+  return [contents]() -> std::unique_ptr<Mapping> {
+    return std::make_unique<DataMapping>(contents);
+  };
+}
+
+static std::string ReadMapping(const Mapping& mapping) {
+  return std::string{reinterpret_cast<const char*>(mapping.GetMapping()),
+                     mapping.GetSize()};
+}
+
+TEST(AsyncMappingResolver, PreservesSubmissionOrderOnWorkers) {
+  auto loop = ConcurrentMessageLoop::Create(4);
+  AsyncMappingResolver resolver(loop->GetTaskRunner());
+
+  std::vector<AsyncMappingResolver::MappingJob> jobs;
+  for (size_t i = 0; i < 64; i++) {
+    jobs.push_back(MakeJob(std::to_string(i)));
+  }
+  jobs.push_back([]() -> std::unique_ptr<Mapping> { return nullptr; });
+
+  auto results = resolver.ResolveBatch(std::move(jobs));
+  ASSERT_EQ(results.size(), 65u);
+  for (size_t i = 0; i < 64; i++) {
+    ASSERT_NE(results[i], nullptr);
+    ASSERT_EQ(ReadMapping(*results[i]), std::to_string(i));
+  }
+  ASSERT_EQ(results[64], nullptr);
+}
+
+TEST(AsyncMappingResolver, RunsInlineWithoutWorkers) {
+  AsyncMappingResolver resolver(nullptr);
+
+  std::atomic_size_t ran{0};
+  std::vector<AsyncMappingResolver::MappingJob> jobs;
+  for (size_t i = 0; i < 3; i++) {
+    jobs.push_back([&ran]() -> std::unique_ptr<Mapping> {
+      ran++;
+      return std::make_unique<DataMapping>("inline");
+    });
+  }
+
+  auto results = resolver.ResolveBatch(std::move(jobs));
+  ASSERT_EQ(ran, 3u);
+  ASSERT_EQ(results.size(), 3u);
+  for (const auto& result : results) {
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(ReadMapping(*result), "inline");
+  }
+
+  ASSERT_TRUE(resolver.ResolveBatch({}).empty());
+}
+
+}  // namespace fml
@@ -11,31 +11,36 @@
 
 namespace fml {
 
+constexpr std::chrono::milliseconds
+    ConcurrentMessageLoop::kDefaultWorkerIdleTimeout;
+
 std::shared_ptr<ConcurrentMessageLoop> ConcurrentMessageLoop::Create(
-    size_t worker_count) {
+    size_t worker_count,
+    std::chrono::milliseconds idle_timeout) {
   return std::shared_ptr<ConcurrentMessageLoop>{
-      new ConcurrentMessageLoop(worker_count)};
+      new ConcurrentMessageLoop(worker_count, idle_timeout)};
 }
 
-ConcurrentMessageLoop::ConcurrentMessageLoop(size_t worker_count)
-    : worker_count_(std::max<size_t>(worker_count, 1ul)) {
+ConcurrentMessageLoop::ConcurrentMessageLoop(
+    size_t worker_count,
+    std::chrono::milliseconds idle_timeout)
+    : worker_count_(std::max<size_t>(worker_count, 1ul)),
+      idle_timeout_(idle_timeout) {
+  // Only the queue slots are created up front; threads are spawned as tasks
+  // arrive. Keeping the full complement of slots means worker indices stay
+  // stable for affinity tasks and stealing regardless of which threads
+  // happen to be alive.
   for (size_t i = 0; i < worker_count_; ++i) {
-    workers_.emplace_back([i, this]() {
-      fml::Thread::SetCurrentThreadName(
-          std::string{"io.flutter.worker." + std::to_string(i + 1)});
-      WorkerMain();
-    });
-  }
-
-  for (const auto& worker : workers_) {
-    worker_thread_ids_.emplace_back(worker.get_id());
+    worker_queues_.emplace_back(std::make_unique<Worker>());
   }
 }
 
 ConcurrentMessageLoop::~ConcurrentMessageLoop() {
   Terminate();
-  for (auto& worker : workers_) {
-    worker.join();
+  for (auto& worker : worker_queues_) {
+    if (worker->thread.joinable()) {
+      worker->thread.join();
+    }
   }
 }
 
@@ -43,84 +48,253 @@ size_t ConcurrentMessageLoop::GetWorkerCount() const {
   return worker_count_;
 }
 
+size_t ConcurrentMessageLoop::GetLiveWorkerCount() const {
+  std::scoped_lock lock(lifecycle_mutex_);
+  return live_worker_count_;
+}
+
+size_t ConcurrentMessageLoop::GetIdleWorkerCount() const {
+  std::scoped_lock lock(idle_mutex_);
+  return idle_workers_.size();
+}
+
+size_t ConcurrentMessageLoop::GetTotalWorkersSpawned() const {
+  std::scoped_lock lock(lifecycle_mutex_);
+  return total_workers_spawned_;
+}
+
 std::shared_ptr<ConcurrentTaskRunner> ConcurrentMessageLoop::GetTaskRunner() {
   return std::make_shared<ConcurrentTaskRunner>(weak_from_this());
 }
 
-void ConcurrentMessageLoop::PostTask(const fml::closure& task) {
+void ConcurrentMessageLoop::PostTask(const fml::closure& task,
+                                     TaskPriority priority) {
   if (!task) {
     return;
   }
 
-  std::unique_lock lock(tasks_mutex_);
-
   // Don't just drop tasks on the floor in case of shutdown.
   if (shutdown_) {
     FML_DLOG(WARNING)
         << "Tried to post a task to shutdown concurrent message "
            "loop. The task will be executed on the callers thread.";
-    lock.unlock();
     task();
     return;
   }
 
-  tasks_.push(task);
+  // Distribute tasks round-robin so that stealing only has to correct for
+  // imbalance caused by long-running tasks.
+  const size_t worker_index = next_worker_++ % worker_count_;
+  Worker& worker = *worker_queues_[worker_index];
+  {
+    std::scoped_lock lock(worker.mutex);
+    // High priority tasks jump the worker's own queue. The owner drains the
+    // front while thieves take from the back, so they are also the last to
+    // be stolen away.
+    if (priority == TaskPriority::kHigh) {
+      worker.tasks.push_front(task);
+    } else {
+      worker.tasks.push_back(task);
+    }
+  }
 
-  // Unlock the mutex before notifying the condition variable because that mutex
-  // has to be acquired on the other thread anyway. Waiting in this scope till
-  // it is acquired there is a pessimization.
-  lock.unlock();
+  EnsureWorkerRunning(worker_index);
 
-  tasks_condition_.notify_one();
+  // Wake at most one idle worker. If none are idle, every worker is busy
+  // and one of them will find this task before going to sleep.
+  WakeIdleWorker();
 }
 
-void ConcurrentMessageLoop::WorkerMain() {
-  while (true) {
-    std::unique_lock lock(tasks_mutex_);
-    tasks_condition_.wait(lock, [&]() {
-      return tasks_.size() > 0 || shutdown_ || HasThreadTasksLocked();
-    });
-
-    // Shutdown cannot be read with the task mutex unlocked.
-    bool shutdown_now = shutdown_;
-    fml::closure task;
-    std::vector<fml::closure> thread_tasks;
-
-    if (tasks_.size() != 0) {
-      task = tasks_.front();
-      tasks_.pop();
+void ConcurrentMessageLoop::PostTaskToWorker(size_t worker_index,
+                                             const fml::closure& task) {
+  FML_DCHECK(worker_index < worker_count_);
+  if (!task || worker_index >= worker_count_) {
+    return;
+  }
+
+  if (shutdown_) {
+    FML_DLOG(WARNING)
+        << "Tried to post a task to shutdown concurrent message "
+           "loop. The task will be executed on the callers thread.";
+    task();
+    return;
+  }
+
+  Worker& worker = *worker_queues_[worker_index];
+  {
+    std::scoped_lock lock(worker.mutex);
+    worker.affinity_tasks.push_back(task);
+    worker.notified = true;
+  }
+  EnsureWorkerRunning(worker_index);
+  worker.condition.notify_one();
+}
+
+void ConcurrentMessageLoop::EnsureWorkerRunning(size_t worker_index) {
+  Worker& worker = *worker_queues_[worker_index];
+  std::scoped_lock lock(lifecycle_mutex_);
+  if (shutdown_ || worker.thread_running) {
+    return;
+  }
+  // The slot may hold a thread that retired earlier; it has already left
+  // its run loop, so reaping it here only waits for the final return.
+  if (worker.thread.joinable()) {
+    worker.thread.join();
+  }
+  worker.thread_running = true;
+  live_worker_count_++;
+  total_workers_spawned_++;
+  worker.thread = std::thread([worker_index, this]() {
+    fml::Thread::SetCurrentThreadName(
+        std::string{"io.flutter.worker." + std::to_string(worker_index + 1)});
+    WorkerMain(worker_index);
+  });
+}
+
+bool ConcurrentMessageLoop::RetireWorker(Worker& worker) {
+  // Lock order matters: once the lifecycle lock is held, a poster either
+  // already pushed its task (which the re-check below will see) or is
+  // blocked in EnsureWorkerRunning and will observe the vacated slot.
+  std::scoped_lock lifecycle_lock(lifecycle_mutex_);
+  std::scoped_lock queue_lock(worker.mutex);
+  if (!worker.tasks.empty() || !worker.affinity_tasks.empty() ||
+      worker.notified) {
+    return false;
+  }
+  worker.thread_running = false;
+  live_worker_count_--;
+  return true;
+}
+
+fml::InlineTask ConcurrentMessageLoop::TakeTask(size_t worker_index) {
+  {
+    Worker& worker = *worker_queues_[worker_index];
+    std::scoped_lock lock(worker.mutex);
+    if (!worker.tasks.empty()) {
+      auto task = std::move(worker.tasks.front());
+      worker.tasks.pop_front();
+      return task;
     }
+  }
 
-    if (HasThreadTasksLocked()) {
-      thread_tasks = GetThreadTasksLocked();
-      FML_DCHECK(!HasThreadTasksLocked());
+  // The worker's own deque is empty. Steal from the back of another
+  // worker's deque, starting with the next worker over.
+  for (size_t i = 1; i < worker_count_; ++i) {
+    Worker& victim = *worker_queues_[(worker_index + i) % worker_count_];
+    std::scoped_lock lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      auto task = std::move(victim.tasks.back());
+      victim.tasks.pop_back();
+      return task;
     }
+  }
 
-    // Don't hold onto the mutex while tasks are being executed as they could
-    // themselves try to post more tasks to the message loop.
-    lock.unlock();
+  return nullptr;
+}
 
-    TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
-    // Execute the primary task we woke up for.
-    if (task) {
-      task();
+void ConcurrentMessageLoop::WakeIdleWorker() {
+  Worker* idle_worker = nullptr;
+  {
+    std::scoped_lock lock(idle_mutex_);
+    if (idle_workers_.empty()) {
+      return;
+    }
+    idle_worker = idle_workers_.back();
+    idle_workers_.pop_back();
+  }
+  {
+    std::scoped_lock lock(idle_worker->mutex);
+    idle_worker->notified = true;
+  }
+  idle_worker->condition.notify_one();
+}
+
+void ConcurrentMessageLoop::WorkerMain(size_t worker_index) {
+  Worker& worker = *worker_queues_[worker_index];
+  while (true) {
+    fml::InlineTask task = TakeTask(worker_index);
+
+    std::vector<fml::InlineTask> affinity_tasks;
+    {
+      std::scoped_lock lock(worker.mutex);
+      std::swap(affinity_tasks, worker.affinity_tasks);
     }
 
-    // Execute any thread tasks.
-    for (const auto& thread_task : thread_tasks) {
-      thread_task();
+    if (task || !affinity_tasks.empty()) {
+      TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
+      if (task) {
+        task();
+      }
+      for (const auto& affinity_task : affinity_tasks) {
+        affinity_task();
+      }
+      continue;
     }
 
-    if (shutdown_now) {
+    if (shutdown_) {
       break;
     }
+
+    // No work anywhere. Advertise idleness before re-scanning the queues so
+    // a concurrent post either becomes visible to the scan or finds this
+    // worker on the idle stack and wakes it.
+    {
+      std::scoped_lock lock(idle_mutex_);
+      idle_workers_.push_back(&worker);
+    }
+
+    task = TakeTask(worker_index);
+
+    bool timed_out = false;
+    {
+      std::unique_lock lock(worker.mutex);
+      if (!task && !shutdown_) {
+        timed_out = !worker.condition.wait_for(lock, idle_timeout_, [&]() {
+          return worker.notified || !worker.tasks.empty() ||
+                 !worker.affinity_tasks.empty() || shutdown_;
+        });
+      }
+      worker.notified = false;
+    }
+
+    {
+      std::scoped_lock lock(idle_mutex_);
+      auto found =
+          std::find(idle_workers_.begin(), idle_workers_.end(), &worker);
+      if (found != idle_workers_.end()) {
+        idle_workers_.erase(found);
+      }
+    }
+
+    if (task) {
+      TRACE_EVENT0("flutter", "ConcurrentWorkerWake");
+      task();
+      continue;
+    }
+
+    // Nothing arrived during the idle wait. Retire the thread unless a task
+    // raced in after the wait timed out, in which case the next loop
+    // iteration picks it up.
+    if (timed_out && !shutdown_ && RetireWorker(worker)) {
+      return;
+    }
   }
+
+  // Shutting down: vacate the slot so the lifecycle counters stay accurate.
+  std::scoped_lock lock(lifecycle_mutex_);
+  worker.thread_running = false;
+  live_worker_count_--;
 }
 
 void ConcurrentMessageLoop::Terminate() {
-  std::scoped_lock lock(tasks_mutex_);
   shutdown_ = true;
-  tasks_condition_.notify_all();
+  for (auto& worker : worker_queues_) {
+    {
+      std::scoped_lock lock(worker->mutex);
+      worker->notified = true;
+    }
+    worker->condition.notify_one();
+  }
 }
 
 void ConcurrentMessageLoop::PostTaskToAllWorkers(fml::closure task) {
@@ -128,24 +302,9 @@ void ConcurrentMessageLoop::PostTaskToAllWorkers(fml::closure task) {
     return;
   }
 
-  std::scoped_lock lock(tasks_mutex_);
-  for (const auto& worker_thread_id : worker_thread_ids_) {
-    thread_tasks_[worker_thread_id].emplace_back(task);
+  for (size_t i = 0; i < worker_count_; ++i) {
+    PostTaskToWorker(i, task);
   }
-  tasks_condition_.notify_all();
-}
-
-bool ConcurrentMessageLoop::HasThreadTasksLocked() const {
-  return thread_tasks_.count(std::this_thread::get_id()) > 0;
-}
-
-std::vector<fml::closure> ConcurrentMessageLoop::GetThreadTasksLocked() {
-  auto found = thread_tasks_.find(std::this_thread::get_id());
-  FML_DCHECK(found != thread_tasks_.end());
-  std::vector<fml::closure> pending_tasks;
-  std::swap(pending_tasks, found->second);
-  thread_tasks_.erase(found);
-  return pending_tasks;
 }
 
 ConcurrentTaskRunner::ConcurrentTaskRunner(
@@ -154,13 +313,15 @@ ConcurrentTaskRunner::ConcurrentTaskRunner(
 
 ConcurrentTaskRunner::~ConcurrentTaskRunner() = default;
 
-void ConcurrentTaskRunner::PostTask(const fml::closure& task) {
+void ConcurrentTaskRunner::PostTask(
+    const fml::closure& task,
+    ConcurrentMessageLoop::TaskPriority priority) {
   if (!task) {
     return;
   }
 
   if (auto loop = weak_loop_.lock()) {
-    loop->PostTask(task);
+    loop->PostTask(task, priority);
     return;
   }
 
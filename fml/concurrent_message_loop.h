@@ -5,12 +5,16 @@
 #ifndef FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 #define FLUTTER_FML_CONCURRENT_MESSAGE_LOOP_H_
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
-#include <map>
-#include <queue>
+#include <deque>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include "flutter/fml/closure.h"
+#include "flutter/fml/inline_task.h"
 #include "flutter/fml/macros.h"
 
 namespace fml {
@@ -20,40 +24,122 @@ class ConcurrentTaskRunner;
 class ConcurrentMessageLoop
     : public std::enable_shared_from_this<ConcurrentMessageLoop> {
  public:
+  // The lane a task is posted to. High priority tasks on a worker are taken
+  // ahead of normal priority tasks queued before them. Work stealing drains
+  // the normal end of a victim's queue first, so high priority tasks also
+  // tend to run on the worker they were assigned to.
+  enum class TaskPriority {
+    kNormal,
+    kHigh,
+  };
+
+  // How long a worker waits for new work before its thread exits. Retired
+  // threads are respawned on demand, so the only cost of a short timeout is
+  // thread churn under bursty loads.
+  static constexpr std::chrono::milliseconds kDefaultWorkerIdleTimeout{4000};
+
+  // |worker_count| is a cap rather than a fixed pool size: worker threads
+  // are spawned as tasks arrive and exit again after |idle_timeout| without
+  // work, so an idle loop holds no threads at all.
   static std::shared_ptr<ConcurrentMessageLoop> Create(
-      size_t worker_count = std::thread::hardware_concurrency());
+      size_t worker_count = std::thread::hardware_concurrency(),
+      std::chrono::milliseconds idle_timeout = kDefaultWorkerIdleTimeout);
 
   ~ConcurrentMessageLoop();
 
   size_t GetWorkerCount() const;
 
+  // The number of worker threads currently alive. At most
+  // |GetWorkerCount|; zero when the loop has been idle longer than the
+  // idle timeout.
+  size_t GetLiveWorkerCount() const;
+
+  // The number of live worker threads currently parked waiting for work.
+  size_t GetIdleWorkerCount() const;
+
+  // The total number of worker threads spawned over the lifetime of the
+  // loop. Grows past |GetWorkerCount| when idle workers retire and are
+  // later replaced; the difference measures pool churn.
+  size_t GetTotalWorkersSpawned() const;
+
   std::shared_ptr<ConcurrentTaskRunner> GetTaskRunner();
 
   void Terminate();
 
+  // Runs the task once on every worker in the pool, spawning any worker
+  // threads that are not currently alive.
   void PostTaskToAllWorkers(fml::closure task);
 
+  // Posts a task that will only ever run on the worker with the given
+  // index (which must be less than |GetWorkerCount|). Unlike regular
+  // tasks, affinity tasks are never stolen by other workers.
+  void PostTaskToWorker(size_t worker_index, const fml::closure& task);
+
  private:
   friend ConcurrentTaskRunner;
 
+  // The queues and wakeup machinery of a single worker. Each worker owns a
+  // deque of stealable tasks and a vector of affinity tasks that only it
+  // may run. Both are guarded by the worker's own mutex so that posting to
+  // one worker never contends with another worker draining its queue.
+  // Tasks are stored as move-only |InlineTask|s so enqueueing them does not
+  // generate allocator traffic; |fml::closure| remains the type at the
+  // posting interfaces.
+  struct Worker {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<fml::InlineTask> tasks;
+    std::vector<fml::InlineTask> affinity_tasks;
+    bool notified = false;
+    // The slot's thread, if one has ever been spawned. Retired threads are
+    // reaped when the slot is respawned or when the loop is torn down.
+    // Guarded by |lifecycle_mutex_| along with |thread_running|.
+    std::thread thread;
+    bool thread_running = false;
+  };
+
   size_t worker_count_ = 0;
-  std::vector<std::thread> workers_;
-  std::mutex tasks_mutex_;
-  std::condition_variable tasks_condition_;
-  std::queue<fml::closure> tasks_;
-  std::vector<std::thread::id> worker_thread_ids_;
-  std::map<std::thread::id, std::vector<fml::closure>> thread_tasks_;
-  bool shutdown_ = false;
+  std::chrono::milliseconds idle_timeout_;
+  std::vector<std::unique_ptr<Worker>> worker_queues_;
+  std::atomic_size_t next_worker_ = {0};
+  std::atomic_bool shutdown_ = {false};
+
+  // Guards the spawn and retire transitions of worker threads and the
+  // counters that track them.
+  mutable std::mutex lifecycle_mutex_;
+  size_t live_worker_count_ = 0;
+  size_t total_workers_spawned_ = 0;
+
+  // Guards |idle_workers_|, the stack of workers that have drained every
+  // queue and are waiting on their condition variables. Posting a task
+  // wakes at most one of these instead of broadcasting to all workers.
+  mutable std::mutex idle_mutex_;
+  std::vector<Worker*> idle_workers_;
+
+  ConcurrentMessageLoop(size_t worker_count,
+                        std::chrono::milliseconds idle_timeout);
+
+  void WorkerMain(size_t worker_index);
 
-  ConcurrentMessageLoop(size_t worker_count);
+  // Spawns a thread for the given worker slot if one is not already
+  // running. Callers must enqueue their task before calling this so that a
+  // concurrently retiring thread either sees the task or vacates the slot
+  // for the replacement thread to claim.
+  void EnsureWorkerRunning(size_t worker_index);
 
-  void WorkerMain();
+  // Marks the worker's slot vacant and returns true if the worker still
+  // has no work; returns false if a task raced in, in which case the
+  // worker must keep running.
+  bool RetireWorker(Worker& worker);
 
-  void PostTask(const fml::closure& task);
+  void PostTask(const fml::closure& task,
+                TaskPriority priority = TaskPriority::kNormal);
 
-  bool HasThreadTasksLocked() const;
+  // Takes a task from the front of the given worker's own deque or, failing
+  // that, steals one from the back of another worker's deque.
+  fml::InlineTask TakeTask(size_t worker_index);
 
-  std::vector<fml::closure> GetThreadTasksLocked();
+  void WakeIdleWorker();
 
   FML_DISALLOW_COPY_AND_ASSIGN(ConcurrentMessageLoop);
 };
@@ -64,7 +150,9 @@ class ConcurrentTaskRunner {
 
   ~ConcurrentTaskRunner();
 
-  void PostTask(const fml::closure& task);
+  void PostTask(const fml::closure& task,
+                ConcurrentMessageLoop::TaskPriority priority =
+                    ConcurrentMessageLoop::TaskPriority::kNormal);
 
  private:
   friend ConcurrentMessageLoop;
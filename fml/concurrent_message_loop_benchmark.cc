@@ -0,0 +1,34 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+
+namespace fml {
+namespace benchmarking {
+
+// Measures task throughput of the concurrent worker pool as the worker count
+// grows, exposing contention on the shared queues and the cost of work
+// stealing. The benchmark argument is the worker cap passed to the loop.
+static void BM_ConcurrentMessageLoopThroughput(benchmark::State& state) {
+  const size_t worker_count = static_cast<size_t>(state.range(0));
+  auto loop = fml::ConcurrentMessageLoop::Create(worker_count);
+  auto task_runner = loop->GetTaskRunner();
+
+  constexpr int tasks_per_batch = 1000;
+  while (state.KeepRunning()) {
+    fml::CountDownLatch latch(tasks_per_batch);
+    for (int i = 0; i < tasks_per_batch; i++) {
+      task_runner->PostTask([&latch]() { latch.CountDown(); });
+    }
+    latch.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * tasks_per_batch);
+}
+
+BENCHMARK(BM_ConcurrentMessageLoopThroughput)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+}  // namespace benchmarking
+}  // namespace fml
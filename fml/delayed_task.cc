@@ -6,21 +6,30 @@
 
 #include "flutter/fml/delayed_task.h"
 
+#include <algorithm>
+#include <functional>
+
 namespace fml {
 
 DelayedTask::DelayedTask(size_t order,
-                         const fml::closure& task,
+                         fml::InlineTask task,
                          fml::TimePoint target_time)
-    : order_(order), task_(task), target_time_(target_time) {}
+    : order_(order), task_(std::move(task)), target_time_(target_time) {}
+
+DelayedTask::DelayedTask(DelayedTask&& other) = default;
 
-DelayedTask::DelayedTask(const DelayedTask& other) = default;
+DelayedTask& DelayedTask::operator=(DelayedTask&& other) = default;
 
 DelayedTask::~DelayedTask() = default;
 
-const fml::closure& DelayedTask::GetTask() const {
+const fml::InlineTask& DelayedTask::GetTask() const {
   return task_;
 }
 
+fml::InlineTask DelayedTask::TakeTask() {
+  return std::move(task_);
+}
+
 fml::TimePoint DelayedTask::GetTargetTime() const {
   return target_time_;
 }
@@ -32,4 +41,58 @@ bool DelayedTask::operator>(const DelayedTask& other) const {
   return target_time_ > other.target_time_;
 }
 
+void DelayedTaskQueue::push(DelayedTask task) {
+  heap_.push_back(std::move(task));
+  std::push_heap(heap_.begin(), heap_.end(), std::greater<DelayedTask>());
+}
+
+const DelayedTask& DelayedTaskQueue::top() const {
+  return heap_.front();
+}
+
+DelayedTask DelayedTaskQueue::pop() {
+  std::pop_heap(heap_.begin(), heap_.end(), std::greater<DelayedTask>());
+  DelayedTask task = std::move(heap_.back());
+  heap_.pop_back();
+  return task;
+}
+
+bool DelayedTaskQueue::empty() const {
+  return heap_.empty();
+}
+
+size_t DelayedTaskQueue::size() const {
+  return heap_.size();
+}
+
+DelayedTaskSource::~DelayedTaskSource() = default;
+
+DelayedTaskHeap::DelayedTaskHeap() = default;
+
+DelayedTaskHeap::~DelayedTaskHeap() = default;
+
+void DelayedTaskHeap::Push(DelayedTask task) {
+  queue_.push(std::move(task));
+}
+
+const DelayedTask& DelayedTaskHeap::Top() const {
+  return queue_.top();
+}
+
+DelayedTask DelayedTaskHeap::Pop() {
+  return queue_.pop();
+}
+
+bool DelayedTaskHeap::IsEmpty() const {
+  return queue_.empty();
+}
+
+size_t DelayedTaskHeap::GetSize() const {
+  return queue_.size();
+}
+
+void DelayedTaskHeap::Clear() {
+  queue_ = DelayedTaskQueue();
+}
+
 }  // namespace fml
@@ -5,24 +5,28 @@
 #ifndef FLUTTER_FML_DELAYED_TASK_H_
 #define FLUTTER_FML_DELAYED_TASK_H_
 
-#include "flutter/fml/closure.h"
+#include "flutter/fml/inline_task.h"
 #include "flutter/fml/time/time_point.h"
 
-#include <queue>
+#include <vector>
 
 namespace fml {
 
 class DelayedTask {
  public:
-  DelayedTask(size_t order,
-              const fml::closure& task,
-              fml::TimePoint target_time);
+  DelayedTask(size_t order, fml::InlineTask task, fml::TimePoint target_time);
 
-  DelayedTask(const DelayedTask& other);
+  DelayedTask(DelayedTask&& other);
+
+  DelayedTask& operator=(DelayedTask&& other);
 
   ~DelayedTask();
 
-  const fml::closure& GetTask() const;
+  const fml::InlineTask& GetTask() const;
+
+  // Moves the task out of this entry; used when handing the task over to the
+  // invocation batch after the entry has been popped.
+  fml::InlineTask TakeTask();
 
   fml::TimePoint GetTargetTime() const;
 
@@ -30,13 +34,77 @@ class DelayedTask {
 
  private:
   size_t order_;
-  fml::closure task_;
+  fml::InlineTask task_;
   fml::TimePoint target_time_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DelayedTask);
+};
+
+// A min-heap of delayed tasks ordered by target time then registration
+// order. A drop-in replacement for std::priority_queue that supports the
+// move-only |DelayedTask|: |pop| returns the removed task by value.
+class DelayedTaskQueue {
+ public:
+  void push(DelayedTask task);
+
+  const DelayedTask& top() const;
+
+  DelayedTask pop();
+
+  bool empty() const;
+
+  size_t size() const;
+
+ private:
+  std::vector<DelayedTask> heap_;
+};
+
+// The storage backend for the delayed tasks of a single task queue. The
+// default implementation is |DelayedTaskHeap|; timer-heavy queues can opt
+// into the hashed timer wheel in fml/timer_wheel.h instead.
+class DelayedTaskSource {
+ public:
+  virtual ~DelayedTaskSource();
+
+  virtual void Push(DelayedTask task) = 0;
+
+  // The earliest pending task. May only be called when |IsEmpty| returns
+  // false. The reference is invalidated by the next |Push| or |Pop|.
+  virtual const DelayedTask& Top() const = 0;
+
+  // Removes and returns the task returned by |Top|.
+  virtual DelayedTask Pop() = 0;
+
+  virtual bool IsEmpty() const = 0;
+
+  virtual size_t GetSize() const = 0;
+
+  virtual void Clear() = 0;
 };
 
-using DelayedTaskQueue = std::priority_queue<DelayedTask,
-                                             std::deque<DelayedTask>,
-                                             std::greater<DelayedTask>>;
+// A min-heap of delayed tasks ordered by target time. O(log n) insert and
+// pop with exact FIFO ordering of tasks that share a target time.
+class DelayedTaskHeap final : public DelayedTaskSource {
+ public:
+  DelayedTaskHeap();
+
+  ~DelayedTaskHeap() override;
+
+  void Push(DelayedTask task) override;
+
+  const DelayedTask& Top() const override;
+
+  DelayedTask Pop() override;
+
+  bool IsEmpty() const override;
+
+  size_t GetSize() const override;
+
+  void Clear() override;
+
+ private:
+  DelayedTaskQueue queue_;
+};
 
 }  // namespace fml
 
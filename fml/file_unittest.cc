@@ -269,6 +269,52 @@ TEST(FileTest, EmptyMappingTest) {
   ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "my_contents"));
 }
 
+TEST(FileTest, MappingAcceptsAccessAdvice) {
+  fml::ScopedTemporaryDirectory dir;
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "advised", true,
+                              fml::FilePermission::kReadWrite);
+    ASSERT_TRUE(WriteStringToFile(file, "some contents to page in"));
+
+    fml::FileMapping mapping(file);
+    ASSERT_TRUE(mapping.IsValid());
+#if OS_POSIX
+    ASSERT_TRUE(mapping.Advise(fml::FileMapping::Advice::kSequential));
+    ASSERT_TRUE(mapping.Advise(fml::FileMapping::Advice::kWillNeed));
+    ASSERT_TRUE(mapping.Advise(fml::FileMapping::Advice::kRandom));
+#else
+    // Hints are best effort and unsupported here; they must still be safe.
+    mapping.Advise(fml::FileMapping::Advice::kWillNeed);
+#endif  // OS_POSIX
+    ASSERT_EQ(ReadStringFromFile(file), "some contents to page in");
+  }
+
+  ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "advised"));
+}
+
+TEST(FileTest, LockedMappingServesTheSameBytes) {
+  fml::ScopedTemporaryDirectory dir;
+
+  {
+    auto file = fml::OpenFile(dir.fd(), "locked", true,
+                              fml::FilePermission::kReadWrite);
+    ASSERT_TRUE(WriteStringToFile(file, "pinned contents"));
+
+    std::unique_ptr<const fml::Mapping> mapping =
+        std::make_unique<fml::FileMapping>(file);
+    // Whether or not the platform grants the lock, the mapping comes back
+    // readable and unchanged.
+    auto locked = fml::LockedMapping::Lock(std::move(mapping));
+    ASSERT_NE(locked, nullptr);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(locked->GetMapping()),
+                          locked->GetSize()),
+              "pinned contents");
+  }
+
+  ASSERT_TRUE(fml::UnlinkFile(dir.fd(), "locked"));
+}
+
 TEST(FileTest, FileTestsWork) {
   fml::ScopedTemporaryDirectory dir;
   ASSERT_TRUE(dir.fd().is_valid());
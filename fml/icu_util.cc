@@ -4,6 +4,7 @@
 
 #include "flutter/fml/icu_util.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 
@@ -19,8 +20,20 @@ namespace icu {
 
 class ICUContext {
  public:
-  ICUContext(const std::string& icu_data_path) : valid_(false) {
-    valid_ = SetupMapping(icu_data_path) && SetupICU();
+  ICUContext(const std::string& icu_data_path, bool defer_setup)
+      : valid_(false) {
+    if (!SetupMapping(icu_data_path)) {
+      return;
+    }
+    if (defer_setup) {
+      // The mapping is established (and cheap to keep around); the table
+      // registration is what costs milliseconds and is left for
+      // |EnsureSetup|.
+      setup_pending_ = true;
+      valid_ = true;
+    } else {
+      valid_ = SetupICU();
+    }
   }
 
   ICUContext(std::unique_ptr<Mapping> mapping) : mapping_(std::move(mapping)) {
@@ -60,6 +73,10 @@ class ICUContext {
         std::make_unique<FileMapping>(fd, std::move(protection));
 
     if (file_mapping->GetSize() != 0) {
+      // ICU chases offsets around its data file rather than scanning it;
+      // without this hint readahead faults in megabytes of tables the
+      // process never touches.
+      file_mapping->Advise(FileMapping::Advice::kRandom);
       mapping_ = std::move(file_mapping);
       return true;
     }
@@ -77,6 +94,18 @@ class ICUContext {
     return (err_code == U_ZERO_ERROR);
   }
 
+  // Performs any setup deferred at construction. Safe to call from multiple
+  // threads; only the first call does work.
+  bool EnsureSetup() {
+    std::call_once(setup_flag_, [this]() {
+      if (setup_pending_) {
+        setup_pending_ = false;
+        valid_ = SetupICU();
+      }
+    });
+    return valid_;
+  }
+
   const uint8_t* GetMapping() const {
     return mapping_ ? mapping_->GetMapping() : nullptr;
   }
@@ -87,15 +116,23 @@ class ICUContext {
 
  private:
   bool valid_;
+  bool setup_pending_ = false;
+  std::once_flag setup_flag_;
   std::unique_ptr<Mapping> mapping_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ICUContext);
 };
 
+// Published by the various initialization entry points (each guarded by
+// |g_icu_init_flag|) and read by |EnsureICUInitialized|, possibly from
+// another thread.
+static std::atomic<ICUContext*> g_icu_context = {nullptr};
+
 void InitializeICUOnce(const std::string& icu_data_path) {
-  static ICUContext* context = new ICUContext(icu_data_path);
+  auto* context = new ICUContext(icu_data_path, /*defer_setup=*/false);
   FML_CHECK(context->IsValid())
       << "Must be able to initialize the ICU context. Tried: " << icu_data_path;
+  g_icu_context = context;
 }
 
 std::once_flag g_icu_init_flag;
@@ -104,10 +141,33 @@ void InitializeICU(const std::string& icu_data_path) {
                  [&icu_data_path]() { InitializeICUOnce(icu_data_path); });
 }
 
+void InitializeICULazilyOnce(const std::string& icu_data_path) {
+  auto* context = new ICUContext(icu_data_path, /*defer_setup=*/true);
+  FML_CHECK(context->IsValid())
+      << "Must be able to map the ICU data. Tried: " << icu_data_path;
+  g_icu_context = context;
+}
+
+void InitializeICULazily(const std::string& icu_data_path) {
+  std::call_once(g_icu_init_flag, [&icu_data_path]() {
+    InitializeICULazilyOnce(icu_data_path);
+  });
+}
+
+void EnsureICUInitialized() {
+  auto* context = g_icu_context.load();
+  if (context == nullptr) {
+    return;
+  }
+  FML_CHECK(context->EnsureSetup())
+      << "Must be able to initialize the ICU context.";
+}
+
 void InitializeICUFromMappingOnce(std::unique_ptr<Mapping> mapping) {
-  static ICUContext* context = new ICUContext(std::move(mapping));
+  auto* context = new ICUContext(std::move(mapping));
   FML_CHECK(context->IsValid())
       << "Unable to initialize the ICU context from a mapping.";
+  g_icu_context = context;
 }
 
 void InitializeICUFromMapping(std::unique_ptr<Mapping> mapping) {
@@ -15,6 +15,20 @@ namespace icu {
 
 void InitializeICU(const std::string& icu_data_path = "");
 
+// Like |InitializeICU|, but only maps the data file (with a random access
+// hint so untouched tables are never paged in) and defers the expensive
+// common data registration to |EnsureICUInitialized|. Use this to keep ICU
+// setup off the engine launch critical path.
+void InitializeICULazily(const std::string& icu_data_path = "");
+
+// Completes a deferred initialization started by |InitializeICULazily|.
+// Idempotent and safe to call from any thread; a no-op when ICU was
+// initialized eagerly or no data source was registered. Must have returned
+// before the first break iterator or other ICU API use.
+void EnsureICUInitialized();
+
+// The first registered data source wins process-wide, so an embedder hosting
+// multiple engines can pre-warm one mapping and share it across all of them.
 void InitializeICUFromMapping(std::unique_ptr<Mapping> mapping);
 
 }  // namespace icu
@@ -0,0 +1,141 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_INLINE_TASK_H_
+#define FLUTTER_FML_INLINE_TASK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/macros.h"
+
+namespace fml {
+
+// A move-only callable of signature void() for the message loop hot paths.
+// Callables whose size fits |kInlineStorageSize| are stored inline; larger
+// ones fall back to a single heap allocation. Unlike |fml::closure|
+// (std::function), enqueueing a small lambda costs no allocator traffic and
+// move-only captures (e.g. a std::unique_ptr) are supported directly without
+// the |MakeCopyable| ref-counting detour.
+//
+// |fml::closure| remains the type at the public task runner interfaces; this
+// type is the storage format inside the task queues.
+class InlineTask {
+ public:
+  // Sized to hold a typical posted lambda (a handful of pointers or weak
+  // pointers) and a moved-in std::function without spilling to the heap.
+  static constexpr size_t kInlineStorageSize = 64;
+
+  InlineTask() = default;
+
+  InlineTask(std::nullptr_t) {}
+
+  template <typename Callable,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<Callable>, InlineTask>>>
+  InlineTask(Callable&& callable) {
+    using T = std::decay_t<Callable>;
+    static_assert(std::is_invocable_r_v<void, T&>,
+                  "The callable must be invocable with no arguments.");
+    // Null callable wrappers (e.g. a default constructed fml::closure) decay
+    // to a null task instead of a task that would crash when invoked.
+    if constexpr (std::is_constructible_v<bool, const T&>) {
+      if (!static_cast<bool>(callable)) {
+        return;
+      }
+    }
+    if constexpr (sizeof(T) <= kInlineStorageSize &&
+                  alignof(T) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible_v<T>) {
+      new (storage_) T(std::forward<Callable>(callable));
+      ops_ = &InlineOps<T>::kOps;
+    } else {
+      *reinterpret_cast<T**>(storage_) =
+          new T(std::forward<Callable>(callable));
+      ops_ = &HeapOps<T>::kOps;
+    }
+  }
+
+  InlineTask(InlineTask&& other) noexcept { MoveFrom(std::move(other)); }
+
+  InlineTask& operator=(InlineTask&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(std::move(other));
+    }
+    return *this;
+  }
+
+  ~InlineTask() { Reset(); }
+
+  explicit operator bool() const { return ops_ != nullptr; }
+
+  // Like std::function, invocation is const qualified even though the stored
+  // callable may mutate its own captures.
+  void operator()() const {
+    FML_DCHECK(ops_ != nullptr) << "Invoked a null task.";
+    ops_->invoke(const_cast<uint8_t*>(storage_));
+  }
+
+ private:
+  struct Ops {
+    void (*invoke)(void* storage);
+    // Move-constructs the callable from |from| into |to| and destroys the
+    // source. |to| is uninitialized storage of |kInlineStorageSize| bytes.
+    void (*relocate)(void* from, void* to);
+    void (*destroy)(void* storage);
+  };
+
+  template <typename T>
+  struct InlineOps {
+    static void Invoke(void* storage) { (*reinterpret_cast<T*>(storage))(); }
+    static void Relocate(void* from, void* to) {
+      T* source = reinterpret_cast<T*>(from);
+      new (to) T(std::move(*source));
+      source->~T();
+    }
+    static void Destroy(void* storage) { reinterpret_cast<T*>(storage)->~T(); }
+    static constexpr Ops kOps = {&Invoke, &Relocate, &Destroy};
+  };
+
+  template <typename T>
+  struct HeapOps {
+    static T* Pointer(void* storage) {
+      return *reinterpret_cast<T**>(storage);
+    }
+    static void Invoke(void* storage) { (*Pointer(storage))(); }
+    static void Relocate(void* from, void* to) {
+      *reinterpret_cast<T**>(to) = Pointer(from);
+    }
+    static void Destroy(void* storage) { delete Pointer(storage); }
+    static constexpr Ops kOps = {&Invoke, &Relocate, &Destroy};
+  };
+
+  void MoveFrom(InlineTask&& other) {
+    if (other.ops_ != nullptr) {
+      ops_ = other.ops_;
+      ops_->relocate(other.storage_, storage_);
+      other.ops_ = nullptr;
+    }
+  }
+
+  void Reset() {
+    if (ops_ != nullptr) {
+      ops_->destroy(storage_);
+      ops_ = nullptr;
+    }
+  }
+
+  alignas(alignof(std::max_align_t)) uint8_t storage_[kInlineStorageSize];
+  const Ops* ops_ = nullptr;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(InlineTask);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_INLINE_TASK_H_
@@ -0,0 +1,83 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/inline_task.h"
+
+#include <array>
+#include <memory>
+
+#include "flutter/fml/closure.h"
+#include "gtest/gtest.h"
+
+namespace fml {
+
+TEST(InlineTask, DefaultConstructedIsNull) {
+  InlineTask task;
+  ASSERT_FALSE(task);
+  InlineTask null_task = nullptr;
+  ASSERT_FALSE(null_task);
+}
+
+TEST(InlineTask, InvokesSmallCallablesInline) {
+  bool invoked = false;
+  InlineTask task([&invoked]() { invoked = true; });
+  ASSERT_TRUE(task);
+  task();
+  ASSERT_TRUE(invoked);
+}
+
+TEST(InlineTask, SupportsMoveOnlyCaptures) {
+  auto value = std::make_unique<int>(42);
+  int observed = 0;
+  InlineTask task(
+      [value = std::move(value), &observed]() { observed = *value; });
+  InlineTask moved = std::move(task);
+  ASSERT_FALSE(task);
+  ASSERT_TRUE(moved);
+  moved();
+  ASSERT_EQ(observed, 42);
+}
+
+TEST(InlineTask, LargeCapturesSpillToTheHeap) {
+  // Larger than the inline buffer by construction.
+  std::array<uint8_t, InlineTask::kInlineStorageSize * 2> payload;
+  payload.fill(0xAB);
+  uint8_t observed = 0;
+  InlineTask task([payload, &observed]() { observed = payload.back(); });
+  InlineTask moved = std::move(task);
+  moved();
+  ASSERT_EQ(observed, 0xAB);
+}
+
+TEST(InlineTask, DestroysCaptureExactlyOnce) {
+  auto tracker = std::make_shared<int>(0);
+  {
+    InlineTask task([tracker]() {});
+    ASSERT_EQ(tracker.use_count(), 2);
+    InlineTask moved = std::move(task);
+    ASSERT_EQ(tracker.use_count(), 2);
+  }
+  ASSERT_EQ(tracker.use_count(), 1);
+}
+
+TEST(InlineTask, NullClosureDecaysToNullTask) {
+  fml::closure null_closure;
+  InlineTask task(null_closure);
+  ASSERT_FALSE(task);
+
+  fml::closure real_closure = []() {};
+  InlineTask real_task(real_closure);
+  ASSERT_TRUE(real_task);
+}
+
+TEST(InlineTask, MoveAssignmentReleasesThePreviousCallable) {
+  auto tracker = std::make_shared<int>(0);
+  InlineTask task([tracker]() {});
+  ASSERT_EQ(tracker.use_count(), 2);
+  task = InlineTask([]() {});
+  ASSERT_EQ(tracker.use_count(), 1);
+  ASSERT_TRUE(task);
+}
+
+}  // namespace fml
@@ -3,7 +3,14 @@
 // found in the LICENSE file.
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/log_settings.h"
@@ -41,6 +48,123 @@ const char* StripPath(const char* path) {
     return path;
 }
 
+// Writes one formatted message to the platform log. This is the blocking
+// part of logging (console, logcat or syslog) that the drain thread keeps
+// off the threads doing the logging.
+void WriteLogToPlatform(LogSeverity severity, const std::string& message) {
+#if defined(OS_ANDROID)
+  android_LogPriority priority =
+      (severity < 0) ? ANDROID_LOG_VERBOSE : ANDROID_LOG_UNKNOWN;
+  switch (severity) {
+    case LOG_INFO:
+      priority = ANDROID_LOG_INFO;
+      break;
+    case LOG_WARNING:
+      priority = ANDROID_LOG_WARN;
+      break;
+    case LOG_ERROR:
+      priority = ANDROID_LOG_ERROR;
+      break;
+    case LOG_FATAL:
+      priority = ANDROID_LOG_FATAL;
+      break;
+  }
+  __android_log_write(priority, "flutter", message.c_str());
+#elif defined(OS_IOS)
+  syslog(LOG_ALERT, "%s", message.c_str());
+#else
+  std::cerr << message;
+  std::cerr.flush();
+#endif
+}
+
+std::atomic<bool> gAsyncLoggingEnabled = {true};
+
+// A bounded ring of formatted messages serviced by a single drain thread.
+// Enqueueing only moves a string under a mutex; the platform write happens
+// on the drain thread. The instance is intentionally leaked so messages
+// logged during static destruction still have somewhere to go.
+class AsyncLogSink {
+ public:
+  static AsyncLogSink* Get() {
+    static AsyncLogSink* sink = new AsyncLogSink();
+    return sink;
+  }
+
+  static bool IsCreated() { return created_.load(std::memory_order_acquire); }
+
+  // Hands the message to the drain thread. Returns false without consuming
+  // the message if the ring is full; the caller must then write it
+  // synchronously.
+  bool Enqueue(LogSeverity severity, std::string* message) {
+    {
+      std::scoped_lock lock(mutex_);
+      if (count_ == kBufferSize) {
+        return false;
+      }
+      records_[head_].severity = severity;
+      records_[head_].message = std::move(*message);
+      head_ = (head_ + 1) % kBufferSize;
+      count_++;
+    }
+    pending_cv_.notify_one();
+    return true;
+  }
+
+  // Blocks until every message enqueued so far has been written.
+  void Flush() {
+    std::unique_lock lock(mutex_);
+    drained_cv_.wait(lock, [this]() { return count_ == 0 && !writing_; });
+  }
+
+ private:
+  struct Record {
+    LogSeverity severity = LOG_INFO;
+    std::string message;
+  };
+
+  static constexpr size_t kBufferSize = 512;
+
+  static std::atomic<bool> created_;
+
+  AsyncLogSink() {
+    created_.store(true, std::memory_order_release);
+    std::atexit([]() { FlushPendingLogs(); });
+    std::thread([this]() { DrainLoop(); }).detach();
+  }
+
+  void DrainLoop() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+      pending_cv_.wait(lock, [this]() { return count_ > 0; });
+      Record record = std::move(records_[tail_]);
+      tail_ = (tail_ + 1) % kBufferSize;
+      count_--;
+      writing_ = true;
+      lock.unlock();
+      WriteLogToPlatform(record.severity, record.message);
+      lock.lock();
+      writing_ = false;
+      if (count_ == 0) {
+        drained_cv_.notify_all();
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable pending_cv_;
+  std::condition_variable drained_cv_;
+  Record records_[kBufferSize];
+  size_t head_ = 0;
+  size_t tail_ = 0;
+  size_t count_ = 0;
+  bool writing_ = false;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(AsyncLogSink);
+};
+
+std::atomic<bool> AsyncLogSink::created_ = {false};
+
 }  // namespace
 
 LogMessage::LogMessage(LogSeverity severity,
@@ -62,35 +186,20 @@ LogMessage::LogMessage(LogSeverity severity,
 
 LogMessage::~LogMessage() {
   stream_ << std::endl;
-
-#if defined(OS_ANDROID)
-  android_LogPriority priority =
-      (severity_ < 0) ? ANDROID_LOG_VERBOSE : ANDROID_LOG_UNKNOWN;
-  switch (severity_) {
-    case LOG_INFO:
-      priority = ANDROID_LOG_INFO;
-      break;
-    case LOG_WARNING:
-      priority = ANDROID_LOG_WARN;
-      break;
-    case LOG_ERROR:
-      priority = ANDROID_LOG_ERROR;
-      break;
-    case LOG_FATAL:
-      priority = ANDROID_LOG_FATAL;
-      break;
-  }
-  __android_log_write(priority, "flutter", stream_.str().c_str());
-#elif defined(OS_IOS)
-  syslog(LOG_ALERT, "%s", stream_.str().c_str());
-#else
-  std::cerr << stream_.str();
-  std::cerr.flush();
-#endif
+  std::string message = stream_.str();
 
   if (severity_ >= LOG_FATAL) {
+    // Land everything logged before the crash first so the fatal message
+    // shows up last and in order.
+    FlushPendingLogs();
+    WriteLogToPlatform(severity_, message);
     abort();
   }
+
+  if (!IsAsyncLoggingEnabled() ||
+      !AsyncLogSink::Get()->Enqueue(severity_, &message)) {
+    WriteLogToPlatform(severity_, message);
+  }
 }
 
 int GetVlogVerbosity() {
@@ -101,4 +210,24 @@ bool ShouldCreateLogMessage(LogSeverity severity) {
   return severity >= GetMinLogLevel();
 }
 
+void SetAsyncLoggingEnabled(bool enabled) {
+  const bool was_enabled = gAsyncLoggingEnabled.exchange(enabled);
+  if (was_enabled && !enabled) {
+    // Messages already handed to the drain thread must not trail messages
+    // written synchronously from here on.
+    FlushPendingLogs();
+  }
+}
+
+bool IsAsyncLoggingEnabled() {
+  return gAsyncLoggingEnabled.load(std::memory_order_relaxed);
+}
+
+void FlushPendingLogs() {
+  if (!AsyncLogSink::IsCreated()) {
+    return;
+  }
+  AsyncLogSink::Get()->Flush();
+}
+
 }  // namespace fml
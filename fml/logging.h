@@ -43,6 +43,20 @@ int GetVlogVerbosity();
 // LOG_FATAL and above is always true.
 bool ShouldCreateLogMessage(LogSeverity severity);
 
+// Controls whether messages below LOG_FATAL are handed to a background
+// drain thread instead of being written to the platform log on the thread
+// that logged them. Enabled by default so that incidental logging never
+// blocks a latency sensitive thread on console or syslog I/O. LOG_FATAL
+// messages are always written synchronously before the process is killed.
+void SetAsyncLoggingEnabled(bool enabled);
+
+bool IsAsyncLoggingEnabled();
+
+// Blocks until every message handed to the drain thread so far has been
+// written to the platform log. Called automatically before a LOG_FATAL
+// message is written and at process exit.
+void FlushPendingLogs();
+
 }  // namespace fml
 
 #define FML_LOG_STREAM(severity) \
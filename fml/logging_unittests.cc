@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/logging.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace {
+
+TEST(LoggingTest, AsyncLoggingIsEnabledByDefault) {
+  ASSERT_TRUE(IsAsyncLoggingEnabled());
+}
+
+TEST(LoggingTest, FlushWaitsForMessagesLoggedFromManyThreads) {
+  constexpr size_t kThreadCount = 4;
+  constexpr size_t kMessagesPerThread = 64;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreadCount; t++) {
+    threads.emplace_back([t]() {
+      for (size_t i = 0; i < kMessagesPerThread; i++) {
+        LogMessage(LOG_INFO, __FILE__, __LINE__, nullptr).stream()
+            << "async log test " << t << "/" << i;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // Every message has been handed to the drain thread; this must return
+  // once they have all been written rather than hang or crash.
+  FlushPendingLogs();
+}
+
+TEST(LoggingTest, DisablingAsyncLoggingDrainsAndFallsBackToSync) {
+  LogMessage(LOG_INFO, __FILE__, __LINE__, nullptr).stream()
+      << "queued before disable";
+  // Disabling flushes the queue so synchronous messages cannot overtake
+  // queued ones.
+  SetAsyncLoggingEnabled(false);
+  ASSERT_FALSE(IsAsyncLoggingEnabled());
+  LogMessage(LOG_INFO, __FILE__, __LINE__, nullptr).stream()
+      << "written synchronously";
+  SetAsyncLoggingEnabled(true);
+  ASSERT_TRUE(IsAsyncLoggingEnabled());
+}
+
+}  // namespace
+}  // namespace fml
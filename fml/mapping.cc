@@ -7,6 +7,12 @@
 #include <algorithm>
 #include <sstream>
 
+#include "flutter/fml/build_config.h"
+
+#if OS_POSIX
+#include <sys/mman.h>
+#endif  // OS_POSIX
+
 namespace fml {
 
 // FileMapping
@@ -64,6 +70,44 @@ std::unique_ptr<FileMapping> FileMapping::CreateReadExecute(
   return mapping;
 }
 
+// Locked Mapping
+
+std::unique_ptr<const Mapping> LockedMapping::Lock(
+    std::unique_ptr<const Mapping> mapping) {
+  if (mapping == nullptr || mapping->GetSize() == 0 ||
+      mapping->GetMapping() == nullptr) {
+    return mapping;
+  }
+#if OS_POSIX
+  // mlock rounds the range out to the enclosing page boundaries itself. The
+  // lock commonly fails on the default RLIMIT_MEMLOCK budget; that is an
+  // expected soft failure, not an error worth logging.
+  if (::mlock(mapping->GetMapping(), mapping->GetSize()) != 0) {
+    return mapping;
+  }
+  return std::unique_ptr<const Mapping>(new LockedMapping(std::move(mapping)));
+#else   // OS_POSIX
+  return mapping;
+#endif  // OS_POSIX
+}
+
+LockedMapping::LockedMapping(std::unique_ptr<const Mapping> mapping)
+    : mapping_(std::move(mapping)) {}
+
+LockedMapping::~LockedMapping() {
+#if OS_POSIX
+  ::munlock(mapping_->GetMapping(), mapping_->GetSize());
+#endif  // OS_POSIX
+}
+
+size_t LockedMapping::GetSize() const {
+  return mapping_->GetSize();
+}
+
+const uint8_t* LockedMapping::GetMapping() const {
+  return mapping_->GetMapping();
+}
+
 // Data Mapping
 
 DataMapping::DataMapping(std::vector<uint8_t> data) : data_(std::move(data)) {}
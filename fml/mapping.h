@@ -40,6 +40,22 @@ class FileMapping final : public Mapping {
     kExecute,
   };
 
+  // Access hints forwarded to the kernel for an established mapping. These
+  // only affect paging behavior, never correctness, and platforms that
+  // cannot express a hint simply report failure.
+  enum class Advice {
+    // The mapping will be read front to back; prefer aggressive readahead.
+    kSequential,
+    // The whole mapping will be needed soon; queue readahead now.
+    kWillNeed,
+    // Accesses will jump around the mapping (index and table lookups);
+    // disable readahead so untouched pages are never faulted in.
+    kRandom,
+    // Back the mapping with huge pages where the kernel supports it, cutting
+    // TLB pressure for large, hot ranges such as instruction snapshots.
+    kHugePage,
+  };
+
   FileMapping(const fml::UniqueFD& fd,
               std::initializer_list<Protection> protection = {
                   Protection::kRead});
@@ -69,6 +85,11 @@ class FileMapping final : public Mapping {
 
   bool IsValid() const;
 
+  // Forwards the given access hint to the kernel for the mapped range.
+  // Returns whether the platform accepted the hint; failure is always safe
+  // to ignore.
+  bool Advise(Advice advice);
+
  private:
   bool valid_ = false;
   size_t size_ = 0;
@@ -82,6 +103,32 @@ class FileMapping final : public Mapping {
   FML_DISALLOW_COPY_AND_ASSIGN(FileMapping);
 };
 
+class LockedMapping final : public Mapping {
+ public:
+  // Takes ownership of the given mapping and attempts to pin its pages into
+  // physical memory so hot ranges (typically instruction snapshots) are
+  // never paged out. When the platform refuses the lock, for example because
+  // the memlock resource limit is exhausted, the original mapping is handed
+  // back unwrapped; the bytes remain readable either way.
+  static std::unique_ptr<const Mapping> Lock(
+      std::unique_ptr<const Mapping> mapping);
+
+  ~LockedMapping() override;
+
+  // |Mapping|
+  size_t GetSize() const override;
+
+  // |Mapping|
+  const uint8_t* GetMapping() const override;
+
+ private:
+  explicit LockedMapping(std::unique_ptr<const Mapping> mapping);
+
+  std::unique_ptr<const Mapping> mapping_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(LockedMapping);
+};
+
 class DataMapping final : public Mapping {
  public:
   DataMapping(std::vector<uint8_t> data);
@@ -80,14 +80,21 @@ class WeakPtr {
   // The following methods should only be called on the same thread as the
   // "originating" |WeakPtrFactory|.
 
+  // The checker dispatch below is debug-only: in release builds, validity is
+  // a single relaxed atomic load of the shared flag with no virtual call.
+
   explicit operator bool() const {
+#ifndef NDEBUG
     CheckThreadSafety();
+#endif
     return flag_ && flag_->is_valid();
   }
 
   T* get() const {
+#ifndef NDEBUG
     CheckThreadSafety();
-    return *this ? ptr_ : nullptr;
+#endif
+    return flag_ && flag_->is_valid() ? ptr_ : nullptr;
   }
 
   // TODO(gw280): Remove all remaining usages of getUnsafe().
@@ -103,13 +110,11 @@ class WeakPtr {
   }
 
   T& operator*() const {
-    CheckThreadSafety();
     FML_DCHECK(*this);
     return *get();
   }
 
   T* operator->() const {
-    CheckThreadSafety();
     FML_DCHECK(*this);
     return get();
   }
@@ -172,6 +177,42 @@ class TaskRunnerAffineWeakPtr : public WeakPtr<T> {
   TaskRunnerAffineWeakPtr<T>& operator=(TaskRunnerAffineWeakPtr<T>&& r) =
       default;
 
+  // Unchecked access to a weak pointer that was validated once at the start
+  // of a task. Tasks on the originating task runner cannot interleave with
+  // the factory's destruction, so a pointer that was valid when the task
+  // began stays valid until the task returns; repeated dereferences through
+  // this accessor skip the flag load and the debug checker entirely.
+  //
+  // Must not outlive the task it was created in.
+  class BatchAccess {
+   public:
+    explicit operator bool() const { return ptr_ != nullptr; }
+
+    T* get() const { return ptr_; }
+
+    T& operator*() const {
+      FML_DCHECK(ptr_);
+      return *ptr_;
+    }
+
+    T* operator->() const {
+      FML_DCHECK(ptr_);
+      return ptr_;
+    }
+
+   private:
+    friend class TaskRunnerAffineWeakPtr<T>;
+
+    explicit BatchAccess(T* ptr) : ptr_(ptr) {}
+
+    T* ptr_;
+  };
+
+  // Validates this weak pointer once - one flag load, plus the task runner
+  // check in debug builds - and returns an accessor whose dereferences are
+  // free for the remainder of the current task.
+  BatchAccess GetForCurrentTask() const { return BatchAccess(this->get()); }
+
  protected:
   void CheckThreadSafety() const override {
     FML_DCHECK_TASK_RUNNER_IS_CURRENT(checker_.checker);
@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/memory/weak_ptr.h"
+
+namespace fml {
+namespace benchmarking {
+
+namespace {
+
+struct Object {
+  int value = 42;
+};
+
+}  // namespace
+
+// Measures the validity check plus dereference, the pattern every task
+// captured with a weak pointer performs before touching its target.
+static void BM_WeakPtrDereference(benchmark::State& state) {
+  Object object;
+  fml::WeakPtrFactory<Object> factory(&object);
+  fml::WeakPtr<Object> weak = factory.GetWeakPtr();
+
+  int accumulated = 0;
+  while (state.KeepRunning()) {
+    if (weak) {
+      accumulated += weak->value;
+    }
+  }
+  benchmark::DoNotOptimize(accumulated);
+}
+
+BENCHMARK(BM_WeakPtrDereference);
+
+// Measures copying a weak pointer, which every capture into a posted task
+// pays: a flag ref-count bump rather than a plain pointer copy.
+static void BM_WeakPtrCopy(benchmark::State& state) {
+  Object object;
+  fml::WeakPtrFactory<Object> factory(&object);
+  fml::WeakPtr<Object> weak = factory.GetWeakPtr();
+
+  while (state.KeepRunning()) {
+    fml::WeakPtr<Object> copy = weak;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+BENCHMARK(BM_WeakPtrCopy);
+
+}  // namespace benchmarking
+}  // namespace fml
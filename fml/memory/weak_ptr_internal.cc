@@ -18,8 +18,8 @@ WeakPtrFlag::~WeakPtrFlag() {
 
 void WeakPtrFlag::Invalidate() {
   // Invalidation should happen exactly once.
-  FML_DCHECK(is_valid_);
-  is_valid_ = false;
+  FML_DCHECK(is_valid());
+  is_valid_.store(false, std::memory_order_relaxed);
 }
 
 }  // namespace internal
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_FML_MEMORY_WEAK_PTR_INTERNAL_H_
 #define FLUTTER_FML_MEMORY_WEAK_PTR_INTERNAL_H_
 
+#include <atomic>
+
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
 
@@ -25,12 +27,15 @@ class WeakPtrFlag : public fml::RefCountedThreadSafe<WeakPtrFlag> {
 
   ~WeakPtrFlag();
 
-  bool is_valid() const { return is_valid_; }
+  // A single relaxed load: dereferences and invalidation are already ordered
+  // by the owning thread or task runner, so the flag only needs atomicity,
+  // not synchronization.
+  bool is_valid() const { return is_valid_.load(std::memory_order_relaxed); }
 
   void Invalidate();
 
  private:
-  bool is_valid_;
+  std::atomic<bool> is_valid_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(WeakPtrFlag);
 };
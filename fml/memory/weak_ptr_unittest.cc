@@ -229,5 +229,31 @@ TEST(TaskRunnerAffineWeakPtrTest, ShouldNotCrashIfRunningOnTheSameTaskRunner) {
   thread2.join();
 }
 
+TEST(TaskRunnerAffineWeakPtrTest, BatchAccessDereferencesWithoutRechecking) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  int data = 42;
+  TaskRunnerAffineWeakPtrFactory<int> factory(&data);
+  TaskRunnerAffineWeakPtr<int> ptr = factory.GetWeakPtr();
+
+  auto batch = ptr.GetForCurrentTask();
+  EXPECT_TRUE(batch);
+  EXPECT_EQ(&data, batch.get());
+  EXPECT_EQ(42, *batch);
+}
+
+TEST(TaskRunnerAffineWeakPtrTest, BatchAccessOfInvalidatedPointerIsNull) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  int data = 42;
+  TaskRunnerAffineWeakPtr<int> ptr;
+  {
+    TaskRunnerAffineWeakPtrFactory<int> factory(&data);
+    ptr = factory.GetWeakPtr();
+  }
+
+  auto batch = ptr.GetForCurrentTask();
+  EXPECT_FALSE(batch);
+  EXPECT_EQ(nullptr, batch.get());
+}
+
 }  // namespace
 }  // namespace fml
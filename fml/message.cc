@@ -14,7 +14,46 @@ size_t MessageSerializable::GetSerializableTag() const {
 
 Message::Message() = default;
 
-Message::~Message() = default;
+Message::~Message() {
+  if (buffer_ != inline_buffer_) {
+    ::free(buffer_);
+  }
+}
+
+Message::Message(Message&& other) {
+  *this = std::move(other);
+}
+
+Message& Message::operator=(Message&& other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  if (buffer_ != inline_buffer_) {
+    ::free(buffer_);
+  }
+
+  if (other.buffer_ == other.inline_buffer_) {
+    // Small messages live in the inline buffer and must be copied. The
+    // payload is at most |kInlineBufferSize| bytes.
+    ::memcpy(inline_buffer_, other.inline_buffer_, other.data_length_);
+    buffer_ = inline_buffer_;
+    buffer_length_ = kInlineBufferSize;
+  } else {
+    buffer_ = other.buffer_;
+    buffer_length_ = other.buffer_length_;
+  }
+
+  data_length_ = other.data_length_;
+  size_read_ = other.size_read_;
+
+  other.buffer_ = other.inline_buffer_;
+  other.buffer_length_ = kInlineBufferSize;
+  other.data_length_ = 0;
+  other.size_read_ = 0;
+
+  return *this;
+}
 
 static uint32_t NextPowerOfTwoSize(uint32_t x) {
   if (x == 0) {
@@ -56,14 +95,16 @@ bool Message::Reserve(size_t size) {
 }
 
 bool Message::Resize(size_t size) {
-  if (buffer_ == nullptr) {
-    // This is the initial resize where we have no previous buffer.
-    FML_DCHECK(buffer_length_ == 0);
+  FML_DCHECK(size > buffer_length_);
 
+  if (buffer_ == inline_buffer_) {
+    // The message has outgrown the inline storage and must spill into a
+    // heap allocation.
     void* buffer = ::malloc(size);
     const bool success = buffer != nullptr;
 
     if (success) {
+      ::memcpy(buffer, inline_buffer_, data_length_);
       buffer_ = static_cast<uint8_t*>(buffer);
       buffer_length_ = size;
     }
@@ -71,8 +112,6 @@ bool Message::Resize(size_t size) {
     return success;
   }
 
-  FML_DCHECK(size > buffer_length_);
-
   void* resized = ::realloc(buffer_, size);
 
   const bool success = resized != nullptr;
@@ -97,7 +136,9 @@ uint8_t* Message::PrepareEncode(size_t size) {
 }
 
 uint8_t* Message::PrepareDecode(size_t size) {
-  if ((size + size_read_) > buffer_length_) {
+  // Reads are bounded by the encoded data, not the buffer capacity, since
+  // the inline buffer is always at least |kInlineBufferSize| bytes.
+  if ((size + size_read_) > data_length_) {
     return nullptr;
   }
   auto* buffer = buffer_ + size_read_;
@@ -67,12 +67,30 @@ struct Serializable : public std::integral_constant<
 
 // Utility class to encode and decode |Serializable| types to and from a buffer.
 // Elements have to be read back into the same order they were written.
+//
+// Messages up to |kInlineBufferSize| bytes are encoded into inline storage
+// without touching the heap; larger messages spill into a single heap
+// allocation. Messages are movable so encoded payloads can be handed off
+// without copying the heap buffer.
 class Message {
  public:
+  // Messages at or below this size are stored inline without any heap
+  // allocations.
+  static constexpr size_t kInlineBufferSize = 256;
+
   Message();
 
   ~Message();
 
+  Message(Message&& other);
+
+  Message& operator=(Message&& other);
+
+  // Reserves capacity for at least |size| bytes of encoded data. Callers that
+  // can precompute the encoded size of a message avoid repeated buffer growth
+  // on the encode path by reserving it up front.
+  [[nodiscard]] bool Reserve(size_t size);
+
   const uint8_t* GetBuffer() const;
 
   size_t GetBufferSize() const;
@@ -179,13 +197,12 @@ class Message {
   }
 
  private:
-  uint8_t* buffer_ = nullptr;
-  size_t buffer_length_ = 0;
+  uint8_t inline_buffer_[kInlineBufferSize];
+  uint8_t* buffer_ = inline_buffer_;
+  size_t buffer_length_ = kInlineBufferSize;
   size_t data_length_ = 0;
   size_t size_read_ = 0;
 
-  [[nodiscard]] bool Reserve(size_t size);
-
   [[nodiscard]] bool Resize(size_t size);
 
   [[nodiscard]] uint8_t* PrepareEncode(size_t size);
@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/message.h"
+
+namespace fml {
+namespace benchmarking {
+
+namespace {
+
+struct TrivialPayload {
+  int64_t id = 0;
+  double scale = 1.0;
+  char label[16] = {};
+};
+
+static_assert(sizeof(TrivialPayload) == 32, "Payload size drives the args.");
+
+}  // namespace
+
+// Measures encoding a run of trivially copyable values. The argument is the
+// value count: 8 payloads fit the inline buffer, 64 spill to the heap.
+static void BM_MessageEncode(benchmark::State& state) {
+  const int64_t value_count = state.range(0);
+  const TrivialPayload payload = {7, 0.5, "benchmark"};
+
+  while (state.KeepRunning()) {
+    fml::Message message;
+    for (int64_t i = 0; i < value_count; i++) {
+      FML_CHECK(message.Encode(payload));
+    }
+    benchmark::DoNotOptimize(message.GetDataLength());
+  }
+  state.SetBytesProcessed(state.iterations() * value_count *
+                          sizeof(TrivialPayload));
+}
+
+BENCHMARK(BM_MessageEncode)->Arg(8)->Arg(64);
+
+// Measures decoding the same run of values back out of an encoded message.
+static void BM_MessageDecode(benchmark::State& state) {
+  const int64_t value_count = state.range(0);
+  const TrivialPayload payload = {7, 0.5, "benchmark"};
+
+  fml::Message message;
+  for (int64_t i = 0; i < value_count; i++) {
+    FML_CHECK(message.Encode(payload));
+  }
+
+  while (state.KeepRunning()) {
+    message.ResetRead();
+    TrivialPayload decoded;
+    for (int64_t i = 0; i < value_count; i++) {
+      FML_CHECK(message.Decode(decoded));
+    }
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetBytesProcessed(state.iterations() * value_count *
+                          sizeof(TrivialPayload));
+}
+
+BENCHMARK(BM_MessageDecode)->Arg(8)->Arg(64);
+
+}  // namespace benchmarking
+}  // namespace fml
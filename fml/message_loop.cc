@@ -73,6 +73,10 @@ void MessageLoop::RunExpiredTasksNow() {
   loop_->RunExpiredTasksNow();
 }
 
+fml::TimePoint MessageLoop::GetLastTaskStartTime() const {
+  return loop_->GetLastTaskStartTime();
+}
+
 TaskQueueId MessageLoop::GetCurrentTaskQueueId() {
   auto* loop = tls_message_loop.get();
   FML_CHECK(loop != nullptr)
@@ -7,6 +7,7 @@
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_point.h"
 
 namespace fml {
 
@@ -34,6 +35,12 @@ class MessageLoop {
   // instead of dedicating a thread to the message loop.
   void RunExpiredTasksNow();
 
+  // The time captured once at the start of the task batch currently being
+  // flushed. A cheap alternative to |fml::TimePoint::Now| for tasks that
+  // only need to know roughly when they began running. Only meaningful
+  // while called from a task on this loop.
+  fml::TimePoint GetLastTaskStartTime() const;
+
   static void EnsureInitializedForCurrentThread();
 
   static bool IsInitializedForCurrentThread();
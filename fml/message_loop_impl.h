@@ -46,6 +46,10 @@ class MessageLoopImpl : public Wakeable,
 
   virtual TaskQueueId GetTaskQueueId() const;
 
+  // The time captured once at the start of the current (or most recent)
+  // batch of task invocations. Only meaningful on the loop's own thread.
+  fml::TimePoint GetLastTaskStartTime() const;
+
  protected:
   // Exposed for the embedder shell which allows clients to poll for events
   // instead of dedicating a thread to the message loop.
@@ -64,6 +68,10 @@ class MessageLoopImpl : public Wakeable,
 
   std::atomic_bool terminated_;
 
+  // Written at the start of each task flush and read by tasks on the same
+  // thread; no synchronization is necessary.
+  fml::TimePoint last_task_start_time_;
+
   void FlushTasks(FlushType type);
 
   FML_DISALLOW_COPY_AND_ASSIGN(MessageLoopImpl);
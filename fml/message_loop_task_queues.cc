@@ -5,10 +5,14 @@
 #define FML_USED_ON_EMBEDDER
 
 #include "flutter/fml/message_loop_task_queues.h"
+
+#include <climits>
+#include <limits>
+#include <memory>
+
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/message_loop_impl.h"
-
-#include <iostream>
+#include "flutter/fml/timer_wheel.h"
 
 namespace fml {
 
@@ -18,11 +22,59 @@ const size_t TaskQueueId::kUnmerged = ULONG_MAX;
 
 fml::RefPtr<MessageLoopTaskQueues> MessageLoopTaskQueues::instance_;
 
+// Locks the task queue components of an owner queue and, if that owner has
+// subsumed another queue, of the subsumed queue as well. The meta mutex must
+// be held (at least shared) for the lifetime of this object so that the merge
+// state cannot change while the entry locks are held. Entry locks are always
+// acquired in ascending |TaskQueueId| order to avoid deadlocks.
+class MessageLoopTaskQueues::MergedQueuesRunner {
+ public:
+  MergedQueuesRunner(const MessageLoopTaskQueues& task_queues,
+                     TaskQueueId owner) {
+    const auto& owner_entry = task_queues.queue_entries_.at(owner);
+    const TaskQueueId subsumed = owner_entry->owner_of;
+    std::mutex* first = &owner_entry->mutex;
+    std::mutex* second = nullptr;
+    if (subsumed != _kUnmerged) {
+      second = &task_queues.queue_entries_.at(subsumed)->mutex;
+      if (subsumed < owner) {
+        std::swap(first, second);
+      }
+    }
+    first->lock();
+    first_ = first;
+    if (second) {
+      second->lock();
+      second_ = second;
+    }
+  }
+
+  ~MergedQueuesRunner() {
+    if (second_) {
+      second_->unlock();
+    }
+    first_->unlock();
+  }
+
+ private:
+  std::mutex* first_ = nullptr;
+  std::mutex* second_ = nullptr;
+
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(MergedQueuesRunner);
+};
+
+// Sentinel for |TaskQueueEntry::last_wake_ticks| meaning no wake is armed.
+// Wakes with this target time are never coalesced, only recorded, so a
+// sentinel collision can cause a redundant wake but never a missed one.
+static constexpr int64_t kNoWakeArmed = std::numeric_limits<int64_t>::min();
+
 TaskQueueEntry::TaskQueueEntry()
     : owner_of(_kUnmerged), subsumed_by(_kUnmerged) {
   wakeable = NULL;
   task_observers = TaskObservers();
-  delayed_tasks = DelayedTaskQueue();
+  delayed_tasks = std::make_unique<DelayedTaskHeap>();
+  wake_coalescing_enabled = false;
+  last_wake_ticks = kNoWakeArmed;
 }
 
 fml::RefPtr<MessageLoopTaskQueues> MessageLoopTaskQueues::GetInstance() {
@@ -34,7 +86,7 @@ fml::RefPtr<MessageLoopTaskQueues> MessageLoopTaskQueues::GetInstance() {
 }
 
 TaskQueueId MessageLoopTaskQueues::CreateTaskQueue() {
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*queue_meta_mutex_);
   TaskQueueId loop_id = TaskQueueId(task_queue_id_counter_);
   ++task_queue_id_counter_;
   queue_entries_[loop_id] = std::make_unique<TaskQueueEntry>();
@@ -42,12 +94,14 @@ TaskQueueId MessageLoopTaskQueues::CreateTaskQueue() {
 }
 
 MessageLoopTaskQueues::MessageLoopTaskQueues()
-    : task_queue_id_counter_(0), order_(0) {}
+    : queue_meta_mutex_(fml::SharedMutex::Create()),
+      task_queue_id_counter_(0),
+      order_(0) {}
 
 MessageLoopTaskQueues::~MessageLoopTaskQueues() = default;
 
 void MessageLoopTaskQueues::Dispose(TaskQueueId queue_id) {
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*queue_meta_mutex_);
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == _kUnmerged);
   TaskQueueId subsumed = queue_entry->owner_of;
@@ -58,41 +112,72 @@ void MessageLoopTaskQueues::Dispose(TaskQueueId queue_id) {
 }
 
 void MessageLoopTaskQueues::DisposeTasks(TaskQueueId queue_id) {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*queue_meta_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   const auto& queue_entry = queue_entries_.at(queue_id);
   FML_DCHECK(queue_entry->subsumed_by == _kUnmerged);
   TaskQueueId subsumed = queue_entry->owner_of;
-  queue_entry->delayed_tasks = {};
+  queue_entry->delayed_tasks->Clear();
   if (subsumed != _kUnmerged) {
-    queue_entries_.at(subsumed)->delayed_tasks = {};
+    queue_entries_.at(subsumed)->delayed_tasks->Clear();
+  }
+}
+
+void MessageLoopTaskQueues::SetDelayedTaskBackend(
+    TaskQueueId queue_id,
+    DelayedTaskBackend backend) {
+  fml::UniqueLock lock(*queue_meta_mutex_);
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  FML_CHECK(queue_entry->delayed_tasks->IsEmpty())
+      << "The delayed task backend can only be changed while the queue is "
+         "empty.";
+  switch (backend) {
+    case DelayedTaskBackend::kHeap:
+      queue_entry->delayed_tasks = std::make_unique<DelayedTaskHeap>();
+      break;
+    case DelayedTaskBackend::kTimerWheel:
+      queue_entry->delayed_tasks = std::make_unique<TimerWheel>();
+      break;
   }
 }
 
 void MessageLoopTaskQueues::RegisterTask(TaskQueueId queue_id,
-                                         const fml::closure& task,
+                                         fml::InlineTask task,
                                          fml::TimePoint target_time) {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*queue_meta_mutex_);
   size_t order = order_++;
   const auto& queue_entry = queue_entries_.at(queue_id);
-  queue_entry->delayed_tasks.push({order, task, target_time});
+  fml::TimePoint top_time;
+  {
+    std::scoped_lock entry_lock(queue_entry->mutex);
+    queue_entry->delayed_tasks->Push({order, std::move(task), target_time});
+    top_time = queue_entry->delayed_tasks->Top().GetTargetTime();
+  }
   TaskQueueId loop_to_wake = queue_id;
   if (queue_entry->subsumed_by != _kUnmerged) {
     loop_to_wake = queue_entry->subsumed_by;
   }
-  WakeUpUnlocked(loop_to_wake,
-                 queue_entry->delayed_tasks.top().GetTargetTime());
+  WakeUpUnlocked(loop_to_wake, top_time);
 }
 
 bool MessageLoopTaskQueues::HasPendingTasks(TaskQueueId queue_id) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*queue_meta_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
   return HasPendingTasksUnlocked(queue_id);
 }
 
 void MessageLoopTaskQueues::GetTasksToRunNow(
     TaskQueueId queue_id,
     FlushType type,
-    std::vector<fml::closure>& invocations) {
-  std::lock_guard guard(queue_mutex_);
+    std::vector<fml::InlineTask>& invocations) {
+  fml::SharedLock lock(*queue_meta_mutex_);
+  MergedQueuesRunner merged_queues(*this, queue_id);
+
+  // Reaching a flush consumes whatever wake was armed for this queue, so the
+  // re-arm below must not be coalesced away even if its target time matches
+  // the wake that just fired.
+  queue_entries_.at(queue_id)->last_wake_ticks = kNoWakeArmed;
+
   if (!HasPendingTasksUnlocked(queue_id)) {
     return;
   }
@@ -105,8 +190,8 @@ void MessageLoopTaskQueues::GetTasksToRunNow(
     if (top.GetTargetTime() > now) {
       break;
     }
-    invocations.emplace_back(top.GetTask());
-    queue_entries_.at(top_queue)->delayed_tasks.pop();
+    invocations.emplace_back(
+        queue_entries_.at(top_queue)->delayed_tasks->Pop().TakeTask());
     if (type == FlushType::kSingle) {
       break;
     }
@@ -121,25 +206,38 @@ void MessageLoopTaskQueues::GetTasksToRunNow(
 
 void MessageLoopTaskQueues::WakeUpUnlocked(TaskQueueId queue_id,
                                            fml::TimePoint time) const {
-  if (queue_entries_.at(queue_id)->wakeable) {
-    queue_entries_.at(queue_id)->wakeable->WakeUp(time);
+  const auto& entry = queue_entries_.at(queue_id);
+  if (!entry->wakeable) {
+    return;
   }
+  if (entry->wake_coalescing_enabled) {
+    const int64_t ticks = time.ToEpochDelta().ToNanoseconds();
+    if (ticks != kNoWakeArmed &&
+        entry->last_wake_ticks.exchange(ticks) == ticks) {
+      // A wake with the same deadline has already been delivered and has not
+      // been consumed by a flush yet. Arming the timer again is redundant.
+      return;
+    }
+  }
+  entry->wakeable->WakeUp(time);
 }
 
 size_t MessageLoopTaskQueues::GetNumPendingTasks(TaskQueueId queue_id) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*queue_meta_mutex_);
   const auto& queue_entry = queue_entries_.at(queue_id);
   if (queue_entry->subsumed_by != _kUnmerged) {
     return 0;
   }
 
+  MergedQueuesRunner merged_queues(*this, queue_id);
+
   size_t total_tasks = 0;
-  total_tasks += queue_entry->delayed_tasks.size();
+  total_tasks += queue_entry->delayed_tasks->GetSize();
 
   TaskQueueId subsumed = queue_entry->owner_of;
   if (subsumed != _kUnmerged) {
     const auto& subsumed_entry = queue_entries_.at(subsumed);
-    total_tasks += subsumed_entry->delayed_tasks.size();
+    total_tasks += subsumed_entry->delayed_tasks->GetSize();
   }
   return total_tasks;
 }
@@ -147,26 +245,32 @@ size_t MessageLoopTaskQueues::GetNumPendingTasks(TaskQueueId queue_id) const {
 void MessageLoopTaskQueues::AddTaskObserver(TaskQueueId queue_id,
                                             intptr_t key,
                                             const fml::closure& callback) {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*queue_meta_mutex_);
   FML_DCHECK(callback != nullptr) << "Observer callback must be non-null.";
-  queue_entries_.at(queue_id)->task_observers[key] = callback;
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  std::scoped_lock entry_lock(queue_entry->mutex);
+  queue_entry->task_observers[key] = callback;
 }
 
 void MessageLoopTaskQueues::RemoveTaskObserver(TaskQueueId queue_id,
                                                intptr_t key) {
-  std::lock_guard guard(queue_mutex_);
-  queue_entries_.at(queue_id)->task_observers.erase(key);
+  fml::SharedLock lock(*queue_meta_mutex_);
+  const auto& queue_entry = queue_entries_.at(queue_id);
+  std::scoped_lock entry_lock(queue_entry->mutex);
+  queue_entry->task_observers.erase(key);
 }
 
 std::vector<fml::closure> MessageLoopTaskQueues::GetObserversToNotify(
     TaskQueueId queue_id) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*queue_meta_mutex_);
   std::vector<fml::closure> observers;
 
   if (queue_entries_.at(queue_id)->subsumed_by != _kUnmerged) {
     return observers;
   }
 
+  MergedQueuesRunner merged_queues(*this, queue_id);
+
   for (const auto& observer : queue_entries_.at(queue_id)->task_observers) {
     observers.push_back(observer.second);
   }
@@ -183,17 +287,25 @@ std::vector<fml::closure> MessageLoopTaskQueues::GetObserversToNotify(
 
 void MessageLoopTaskQueues::SetWakeable(TaskQueueId queue_id,
                                         fml::Wakeable* wakeable) {
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*queue_meta_mutex_);
   FML_CHECK(!queue_entries_.at(queue_id)->wakeable)
       << "Wakeable can only be set once.";
   queue_entries_.at(queue_id)->wakeable = wakeable;
 }
 
+void MessageLoopTaskQueues::SetWakeCoalescing(TaskQueueId queue_id,
+                                              bool enabled) {
+  fml::UniqueLock lock(*queue_meta_mutex_);
+  const auto& entry = queue_entries_.at(queue_id);
+  entry->wake_coalescing_enabled = enabled;
+  entry->last_wake_ticks = kNoWakeArmed;
+}
+
 bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
   if (owner == subsumed) {
     return true;
   }
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*queue_meta_mutex_);
   auto& owner_entry = queue_entries_.at(owner);
   auto& subsumed_entry = queue_entries_.at(subsumed);
 
@@ -222,7 +334,7 @@ bool MessageLoopTaskQueues::Merge(TaskQueueId owner, TaskQueueId subsumed) {
 }
 
 bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner) {
-  std::lock_guard guard(queue_mutex_);
+  fml::UniqueLock lock(*queue_meta_mutex_);
   const auto& owner_entry = queue_entries_.at(owner);
   const TaskQueueId subsumed = owner_entry->owner_of;
   if (subsumed == _kUnmerged) {
@@ -245,7 +357,7 @@ bool MessageLoopTaskQueues::Unmerge(TaskQueueId owner) {
 
 bool MessageLoopTaskQueues::Owns(TaskQueueId owner,
                                  TaskQueueId subsumed) const {
-  std::lock_guard guard(queue_mutex_);
+  fml::SharedLock lock(*queue_meta_mutex_);
   return subsumed == queue_entries_.at(owner)->owner_of || owner == subsumed;
 }
 
@@ -259,7 +371,7 @@ bool MessageLoopTaskQueues::HasPendingTasksUnlocked(
     return false;
   }
 
-  if (!entry->delayed_tasks.empty()) {
+  if (!entry->delayed_tasks->IsEmpty()) {
     return true;
   }
 
@@ -268,7 +380,7 @@ bool MessageLoopTaskQueues::HasPendingTasksUnlocked(
     // this is not an owner and queue is empty.
     return false;
   } else {
-    return !queue_entries_.at(subsumed)->delayed_tasks.empty();
+    return !queue_entries_.at(subsumed)->delayed_tasks->IsEmpty();
   }
 }
 
@@ -286,18 +398,18 @@ const DelayedTask& MessageLoopTaskQueues::PeekNextTaskUnlocked(
   const TaskQueueId subsumed = entry->owner_of;
   if (subsumed == _kUnmerged) {
     top_queue_id = owner;
-    return entry->delayed_tasks.top();
+    return entry->delayed_tasks->Top();
   }
 
-  const auto& owner_tasks = entry->delayed_tasks;
-  const auto& subsumed_tasks = queue_entries_.at(subsumed)->delayed_tasks;
+  const auto& owner_tasks = *entry->delayed_tasks;
+  const auto& subsumed_tasks = *queue_entries_.at(subsumed)->delayed_tasks;
 
   // we are owning another task queue
-  const bool subsumed_has_task = !subsumed_tasks.empty();
-  const bool owner_has_task = !owner_tasks.empty();
+  const bool subsumed_has_task = !subsumed_tasks.IsEmpty();
+  const bool owner_has_task = !owner_tasks.IsEmpty();
   if (owner_has_task && subsumed_has_task) {
-    const auto owner_task = owner_tasks.top();
-    const auto subsumed_task = subsumed_tasks.top();
+    const auto owner_task = owner_tasks.Top();
+    const auto subsumed_task = subsumed_tasks.Top();
     if (owner_task > subsumed_task) {
       top_queue_id = subsumed;
     } else {
@@ -308,7 +420,7 @@ const DelayedTask& MessageLoopTaskQueues::PeekNextTaskUnlocked(
   } else {
     top_queue_id = subsumed;
   }
-  return queue_entries_.at(top_queue_id)->delayed_tasks.top();
+  return queue_entries_.at(top_queue_id)->delayed_tasks->Top();
 }
 
 }  // namespace fml
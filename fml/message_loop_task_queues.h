@@ -5,7 +5,9 @@
 #ifndef FLUTTER_FML_MESSAGE_LOOP_TASK_QUEUES_H_
 #define FLUTTER_FML_MESSAGE_LOOP_TASK_QUEUES_H_
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -39,7 +41,23 @@ class TaskQueueEntry {
   using TaskObservers = std::map<intptr_t, fml::closure>;
   Wakeable* wakeable;
   TaskObservers task_observers;
-  DelayedTaskQueue delayed_tasks;
+  std::unique_ptr<DelayedTaskSource> delayed_tasks;
+
+  // Guards |task_observers| and |delayed_tasks|. The merge state
+  // (|owner_of| and |subsumed_by|) as well as |wakeable| are guarded by
+  // the meta mutex in |MessageLoopTaskQueues| so that they can be read
+  // while holding only this queue's lock.
+  mutable std::mutex mutex;
+
+  // When true, wake requests whose target time matches the one most recently
+  // delivered to |wakeable| are dropped instead of re-arming the platform
+  // timer. Guarded by the meta mutex, like |wakeable|.
+  bool wake_coalescing_enabled;
+
+  // The target time of the last wake delivered to |wakeable|, in nanosecond
+  // ticks, or the sentinel used by the implementation when no wake is armed.
+  // Atomic because concurrent |RegisterTask| calls race to record it.
+  std::atomic<int64_t> last_wake_ticks;
 
   // Note: Both of these can be _kUnmerged, which indicates that
   // this queue has not been merged or subsumed. OR exactly one
@@ -59,6 +77,14 @@ enum class FlushType {
   kAll,
 };
 
+// Selects the storage backend for a task queue's delayed tasks. The heap
+// keeps exact ordering with O(log n) insertion; the timer wheel provides
+// O(1) insertion for queues that schedule large numbers of short timers.
+enum class DelayedTaskBackend {
+  kHeap,
+  kTimerWheel,
+};
+
 // This class keeps track of all the tasks and observers that
 // need to be run on it's MessageLoopImpl. This also wakes up the
 // loop at the required times.
@@ -75,17 +101,24 @@ class MessageLoopTaskQueues
 
   void DisposeTasks(TaskQueueId queue_id);
 
+  // Replaces the delayed task backend of the given queue. May only be
+  // called while the queue has no pending tasks.
+  void SetDelayedTaskBackend(TaskQueueId queue_id, DelayedTaskBackend backend);
+
   // Tasks methods.
 
+  // The task is stored as a move-only |InlineTask|; posting a small callable
+  // (or moving in a move-only one) does not touch the heap. `fml::closure`
+  // arguments at the task runner interfaces convert implicitly.
   void RegisterTask(TaskQueueId queue_id,
-                    const fml::closure& task,
+                    fml::InlineTask task,
                     fml::TimePoint target_time);
 
   bool HasPendingTasks(TaskQueueId queue_id) const;
 
   void GetTasksToRunNow(TaskQueueId queue_id,
                         FlushType type,
-                        std::vector<fml::closure>& invocations);
+                        std::vector<fml::InlineTask>& invocations);
 
   size_t GetNumPendingTasks(TaskQueueId queue_id) const;
 
@@ -103,6 +136,13 @@ class MessageLoopTaskQueues
 
   void SetWakeable(TaskQueueId queue_id, fml::Wakeable* wakeable);
 
+  // Enables or disables wake coalescing for the given queue. While enabled,
+  // registering a task that does not change the time of the next wake does
+  // not call into the |Wakeable| again, so a burst of posts before the next
+  // wake arms the platform timer once instead of once per post. Draining the
+  // queue always re-arms the wakeable with the next pending target time.
+  void SetWakeCoalescing(TaskQueueId queue_id, bool enabled);
+
   // Invariants for merge and un-merge
   //  1. RegisterTask will always submit to the queue_id that is passed
   //     to it. It is not aware of whether a queue is merged or not. Same with
@@ -143,7 +183,13 @@ class MessageLoopTaskQueues
   static std::mutex creation_mutex_;
   static fml::RefPtr<MessageLoopTaskQueues> instance_;
 
-  mutable std::mutex queue_mutex_;
+  // Guards the structure of |queue_entries_| along with the merge state and
+  // wakeable of every entry. Operations scoped to individual queues acquire
+  // this shared and then take the per-entry locks they need, so registering
+  // a task on one |TaskQueueId| never contends with draining another. Only
+  // operations that create or dispose queues, change merge relationships or
+  // set wakeables acquire this exclusively.
+  mutable std::unique_ptr<fml::SharedMutex> queue_meta_mutex_;
   std::map<TaskQueueId, std::unique_ptr<TaskQueueEntry>> queue_entries_;
 
   size_t task_queue_id_counter_;
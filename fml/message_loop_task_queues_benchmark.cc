@@ -39,7 +39,7 @@ static void BM_RegisterAndGetTasks(benchmark::State& state) {
         }
         tasks_registered.CountDown();
         tasks_registered.Wait();
-        std::vector<fml::closure> invocations;
+        std::vector<fml::InlineTask> invocations;
         task_queue->GetTasksToRunNow(TaskQueueId(task_runner_id),
                                      fml::FlushType::kAll, invocations);
         assert(invocations.size() == num_tasks_per_queue);
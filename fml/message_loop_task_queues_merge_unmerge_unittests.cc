@@ -127,7 +127,7 @@ TEST(MessageLoopTaskQueueMergeUnmerge, MergeInvokesBothWakeables) {
 
   task_queue->Merge(queue_id_1, queue_id_2);
 
-  std::vector<fml::closure> invocations;
+  std::vector<fml::InlineTask> invocations;
   task_queue->GetTasksToRunNow(queue_id_1, fml::FlushType::kAll, invocations);
 
   latch.Wait();
@@ -157,7 +157,7 @@ TEST(MessageLoopTaskQueueMergeUnmerge,
   task_queue->Merge(queue_id_1, queue_id_2);
   task_queue->Unmerge(queue_id_1);
 
-  std::vector<fml::closure> invocations;
+  std::vector<fml::InlineTask> invocations;
 
   task_queue->GetTasksToRunNow(queue_id_1, fml::FlushType::kAll, invocations);
   latch_1.Wait();
@@ -184,7 +184,7 @@ TEST(MessageLoopTaskQueueMergeUnmerge, GetTasksToRunNowBlocksMerge) {
                           }));
 
   std::thread tasks_to_run_now_thread([&]() {
-    std::vector<fml::closure> invocations;
+    std::vector<fml::InlineTask> invocations;
     task_queue->GetTasksToRunNow(queue_id_1, fml::FlushType::kAll, invocations);
   });
 
@@ -69,7 +69,7 @@ TEST(MessageLoopTaskQueue, PreserveTaskOrdering) {
   task_queue->RegisterTask(
       queue_id, [&test_val]() { test_val = 2; }, fml::TimePoint::Now());
 
-  std::vector<fml::closure> invocations;
+  std::vector<fml::InlineTask> invocations;
   task_queue->GetTasksToRunNow(queue_id, fml::FlushType::kAll, invocations);
 
   int expected_value = 1;
@@ -124,6 +124,59 @@ TEST(MessageLoopTaskQueue, WakeUpIndependentOfTime) {
   ASSERT_TRUE(num_wakes == 2);
 }
 
+TEST(MessageLoopTaskQueue, CoalescedWakesArmTheTimerOnce) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+  task_queue->SetWakeCoalescing(queue_id, true);
+
+  int num_wakes = 0;
+  task_queue->SetWakeable(
+      queue_id, new TestWakeable(
+                    [&num_wakes](fml::TimePoint wake_time) { ++num_wakes; }));
+
+  const auto now = fml::TimePoint::Now();
+  task_queue->RegisterTask(
+      queue_id, []() {}, now);
+  // These tasks do not move the next wake earlier, so no further wakes are
+  // delivered.
+  task_queue->RegisterTask(
+      queue_id, []() {}, now + fml::TimeDelta::FromMilliseconds(8));
+  task_queue->RegisterTask(
+      queue_id, []() {}, now + fml::TimeDelta::FromMilliseconds(16));
+  ASSERT_EQ(num_wakes, 1);
+
+  // An earlier task changes the deadline and must re-arm the timer.
+  task_queue->RegisterTask(
+      queue_id, []() {}, now - fml::TimeDelta::FromMilliseconds(1));
+  ASSERT_EQ(num_wakes, 2);
+}
+
+TEST(MessageLoopTaskQueue, FlushRearmsCoalescedWake) {
+  auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
+  auto queue_id = task_queue->CreateTaskQueue();
+  task_queue->SetWakeCoalescing(queue_id, true);
+
+  int num_wakes = 0;
+  task_queue->SetWakeable(
+      queue_id, new TestWakeable(
+                    [&num_wakes](fml::TimePoint wake_time) { ++num_wakes; }));
+
+  const auto now = fml::TimePoint::Now();
+  task_queue->RegisterTask(
+      queue_id, []() {}, now);
+  task_queue->RegisterTask(
+      queue_id, []() {}, now);
+  ASSERT_EQ(num_wakes, 1);
+
+  // Flushing a single task consumes the armed wake; the trailing re-arm for
+  // the remaining task must be delivered even though its target time matches
+  // the wake that just fired.
+  std::vector<fml::InlineTask> invocations;
+  task_queue->GetTasksToRunNow(queue_id, fml::FlushType::kSingle, invocations);
+  ASSERT_EQ(invocations.size(), 1u);
+  ASSERT_EQ(num_wakes, 2);
+}
+
 TEST(MessageLoopTaskQueue, WokenUpWithNewerTime) {
   auto task_queue = fml::MessageLoopTaskQueues::GetInstance();
   auto queue_id = task_queue->CreateTaskQueue();
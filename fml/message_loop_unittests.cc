@@ -315,3 +315,87 @@ TEST(MessageLoop, CanCreateConcurrentMessageLoop) {
   latch.Wait();
   ASSERT_GE(thread_ids.size(), 1u);
 }
+
+TEST(MessageLoop, LastTaskStartTimeIsCapturedPerTaskBatch) {
+  fml::MessageLoop* loop = nullptr;
+  fml::AutoResetWaitableEvent latch;
+  std::thread thread([&]() {
+    fml::MessageLoop::EnsureInitializedForCurrentThread();
+    loop = &fml::MessageLoop::GetCurrent();
+    latch.Signal();
+    loop->Run();
+  });
+  latch.Wait();
+  fml::TimePoint task_start;
+  loop->GetTaskRunner()->PostTask([&]() {
+    task_start = fml::MessageLoop::GetCurrent().GetLastTaskStartTime();
+    fml::MessageLoop::GetCurrent().Terminate();
+  });
+  thread.join();
+  ASSERT_NE(task_start, fml::TimePoint());
+  ASSERT_LE(task_start, fml::TimePoint::Now());
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopSpawnsWorkersOnDemand) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  ASSERT_EQ(loop->GetLiveWorkerCount(), 0u);
+  ASSERT_EQ(loop->GetTotalWorkersSpawned(), 0u);
+  fml::AutoResetWaitableEvent latch;
+  loop->GetTaskRunner()->PostTask([&]() { latch.Signal(); });
+  latch.Wait();
+  ASSERT_GE(loop->GetTotalWorkersSpawned(), 1u);
+  ASSERT_LE(loop->GetLiveWorkerCount(), 4u);
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopRetiresAndReplacesIdleWorkers) {
+  auto loop =
+      fml::ConcurrentMessageLoop::Create(2u, std::chrono::milliseconds(20));
+  fml::AutoResetWaitableEvent latch;
+  loop->GetTaskRunner()->PostTask([&]() { latch.Signal(); });
+  latch.Wait();
+  // Workers exit after the idle timeout. Poll instead of assuming exact
+  // timing.
+  while (loop->GetLiveWorkerCount() != 0u) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  // The pool must grow again on demand after retiring its threads.
+  loop->GetTaskRunner()->PostTask([&]() { latch.Signal(); });
+  latch.Wait();
+  ASSERT_GE(loop->GetTotalWorkersSpawned(), 2u);
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopAffinityTasksRunOnOneWorker) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  const size_t kCount = 16;
+  fml::CountDownLatch latch(kCount);
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  for (size_t i = 0; i < kCount; ++i) {
+    loop->PostTaskToWorker(1u, [&]() {
+      std::scoped_lock lock(thread_ids_mutex);
+      thread_ids.insert(std::this_thread::get_id());
+      latch.CountDown();
+    });
+  }
+  latch.Wait();
+  ASSERT_EQ(thread_ids.size(), 1u);
+}
+
+TEST(MessageLoop, ConcurrentMessageLoopDistributesTasksAcrossWorkers) {
+  auto loop = fml::ConcurrentMessageLoop::Create(4u);
+  auto task_runner = loop->GetTaskRunner();
+  const size_t kCount = 8;
+  fml::CountDownLatch latch(kCount);
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+  for (size_t i = 0; i < kCount; ++i) {
+    task_runner->PostTask([&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      std::scoped_lock lock(thread_ids_mutex);
+      thread_ids.insert(std::this_thread::get_id());
+      latch.CountDown();
+    });
+  }
+  latch.Wait();
+  ASSERT_GT(thread_ids.size(), 1u);
+}
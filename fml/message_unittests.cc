@@ -64,4 +64,95 @@ TEST(MessageTest, CanDecodeTriviallyCopyableTypes) {
   ASSERT_EQ(message.GetDataLength(), message.GetSizeRead());
 }
 
+TEST(MessageTest, SmallMessagesStayInline) {
+  Message message;
+  const uint8_t* initial_buffer = message.GetBuffer();
+  for (int i = 0; i < 32; i++) {
+    ASSERT_TRUE(message.Encode(i));
+  }
+  // No reallocation took place for a payload under the inline buffer size.
+  ASSERT_LE(message.GetDataLength(), Message::kInlineBufferSize);
+  ASSERT_EQ(message.GetBuffer(), initial_buffer);
+
+  for (int i = 0; i < 32; i++) {
+    int value = -1;
+    ASSERT_TRUE(message.Decode(value));
+    ASSERT_EQ(value, i);
+  }
+}
+
+TEST(MessageTest, LargeMessagesSpillToTheHeap) {
+  Message message;
+  const uint8_t* initial_buffer = message.GetBuffer();
+  const size_t count = Message::kInlineBufferSize;
+  for (size_t i = 0; i < count; i++) {
+    ASSERT_TRUE(message.Encode(i));
+  }
+  ASSERT_GT(message.GetDataLength(), Message::kInlineBufferSize);
+  ASSERT_NE(message.GetBuffer(), initial_buffer);
+
+  for (size_t i = 0; i < count; i++) {
+    size_t value = 0;
+    ASSERT_TRUE(message.Decode(value));
+    ASSERT_EQ(value, i);
+  }
+}
+
+TEST(MessageTest, CannotDecodePastEncodedData) {
+  Message message;
+  ASSERT_TRUE(message.Encode(12));
+  int value = 0;
+  ASSERT_TRUE(message.Decode(value));
+  ASSERT_FALSE(message.Decode(value));
+}
+
+TEST(MessageTest, CanReserveSizeUpFront) {
+  Message message;
+  ASSERT_TRUE(message.Reserve(4096u));
+  const uint8_t* reserved_buffer = message.GetBuffer();
+  ASSERT_GE(message.GetBufferSize(), 4096u);
+  for (size_t i = 0; i < 512; i++) {
+    ASSERT_TRUE(message.Encode(i));
+  }
+  // The reservation covered all encodes without another allocation.
+  ASSERT_EQ(message.GetBuffer(), reserved_buffer);
+}
+
+TEST(MessageTest, CanMoveMessages) {
+  Message message;
+  ASSERT_TRUE(message.Encode(12));
+  ASSERT_TRUE(message.Encode(11.0f));
+
+  Message moved = std::move(message);
+  ASSERT_EQ(message.GetDataLength(), 0u);
+
+  int int1 = 0;
+  ASSERT_TRUE(moved.Decode(int1));
+  ASSERT_EQ(int1, 12);
+
+  float float1 = 0.0f;
+  ASSERT_TRUE(moved.Decode(float1));
+  ASSERT_EQ(float1, 11.0f);
+}
+
+TEST(MessageTest, MovingLargeMessagesHandsOffTheBuffer) {
+  Message message;
+  const size_t count = Message::kInlineBufferSize;
+  for (size_t i = 0; i < count; i++) {
+    ASSERT_TRUE(message.Encode(i));
+  }
+  const uint8_t* heap_buffer = message.GetBuffer();
+
+  Message moved = std::move(message);
+  // The heap buffer was stolen instead of copied.
+  ASSERT_EQ(moved.GetBuffer(), heap_buffer);
+  ASSERT_EQ(message.GetDataLength(), 0u);
+
+  for (size_t i = 0; i < count; i++) {
+    size_t value = 0;
+    ASSERT_TRUE(moved.Decode(value));
+    ASSERT_EQ(value, i);
+  }
+}
+
 }  // namespace fml
@@ -83,11 +83,14 @@ void MessageLoopAndroid::Terminate() {
 }
 
 void MessageLoopAndroid::WakeUp(fml::TimePoint time_point) {
-  bool result = TimerRearm(timer_fd_.get(), time_point);
+  bool result = timer_rearmer_.Rearm(timer_fd_.get(), time_point);
   FML_DCHECK(result);
 }
 
 void MessageLoopAndroid::OnEventFired() {
+  // Mark the timer disarmed before running tasks so any deadline the tasks
+  // post programs the timer afresh.
+  timer_rearmer_.OnTimerFired();
   if (TimerDrain(timer_fd_.get())) {
     RunExpiredTasksNow();
   }
@@ -11,6 +11,7 @@
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/message_loop_impl.h"
+#include "flutter/fml/platform/linux/timerfd.h"
 #include "flutter/fml/unique_fd.h"
 
 namespace fml {
@@ -25,6 +26,9 @@ class MessageLoopAndroid : public MessageLoopImpl {
  private:
   fml::UniqueObject<ALooper*, UniqueLooperTraits> looper_;
   fml::UniqueFD timer_fd_;
+  // Skips timerfd_settime calls that would not move the armed expiry by more
+  // than its slack; task posting bursts wake the looper only once.
+  CoalescingTimerRearmer timer_rearmer_;
   bool running_;
 
   MessageLoopAndroid();
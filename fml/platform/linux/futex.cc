@@ -0,0 +1,30 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/platform/linux/futex.h"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace fml {
+
+// There is no glibc/bionic wrapper for futex(2); both route callers through
+// syscall(2). The PRIVATE variants skip the shared-mapping lookup in the
+// kernel, which is valid here because these words are never placed in
+// cross-process shared memory.
+
+int FutexWait(std::atomic<uint32_t>* address,
+              uint32_t expected_value,
+              const struct timespec* timeout) {
+  return syscall(SYS_futex, reinterpret_cast<uint32_t*>(address),
+                 FUTEX_WAIT_PRIVATE, expected_value, timeout, nullptr, 0);
+}
+
+void FutexWakeOne(std::atomic<uint32_t>* address) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(address), FUTEX_WAKE_PRIVATE,
+          1, nullptr, nullptr, 0);
+}
+
+}  // namespace fml
@@ -0,0 +1,33 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_PLATFORM_LINUX_FUTEX_H_
+#define FLUTTER_FML_PLATFORM_LINUX_FUTEX_H_
+
+#include <time.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace fml {
+
+/// Parks the calling thread on |address| until |FutexWakeOne| is called on the
+/// same address, as long as the word at |address| still contains
+/// |expected_value| when the kernel examines it. |timeout| is relative and may
+/// be null to wait indefinitely.
+///
+/// Returns 0 when woken and -1 with errno set otherwise (EAGAIN if the word no
+/// longer held |expected_value|, ETIMEDOUT on timeout, EINTR on signal
+/// delivery). Wakeups may be spurious; callers must re-check their predicate.
+int FutexWait(std::atomic<uint32_t>* address,
+              uint32_t expected_value,
+              const struct timespec* timeout);
+
+/// Wakes at most one thread parked in |FutexWait| on |address|. A no-op if no
+/// thread is parked there.
+void FutexWakeOne(std::atomic<uint32_t>* address);
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_PLATFORM_LINUX_FUTEX_H_
@@ -9,6 +9,7 @@
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/message_loop_impl.h"
+#include "flutter/fml/platform/linux/timerfd.h"
 #include "flutter/fml/unique_fd.h"
 
 namespace fml {
@@ -17,6 +18,9 @@ class MessageLoopLinux : public MessageLoopImpl {
  private:
   fml::UniqueFD epoll_fd_;
   fml::UniqueFD timer_fd_;
+  // Elides the timerfd_settime storm of rapid task posting; wake-ups within
+  // its slack ride the expiry that is already armed.
+  CoalescingTimerRearmer timer_rearmer_;
   bool running_;
 
   MessageLoopLinux();
@@ -51,6 +51,35 @@ bool TimerRearm(int fd, fml::TimePoint time_point) {
   return result == 0;
 }
 
+CoalescingTimerRearmer::CoalescingTimerRearmer(TimeDelta slack)
+    : slack_nanos_(slack.ToNanoseconds()) {}
+
+bool CoalescingTimerRearmer::Rearm(int fd, TimePoint time_point) {
+  int64_t requested_nanos = time_point.ToEpochDelta().ToNanoseconds();
+  // |TimerRearm| clamps this the same way; mirroring it here keeps the
+  // recorded deadline equal to the one actually armed.
+  if (requested_nanos < 1) {
+    requested_nanos = 1;
+  }
+
+  std::scoped_lock lock(mutex_);
+  if (armed_deadline_nanos_ != kUnarmed &&
+      armed_deadline_nanos_ <= requested_nanos &&
+      requested_nanos - armed_deadline_nanos_ <= slack_nanos_) {
+    return true;
+  }
+  if (!TimerRearm(fd, time_point)) {
+    return false;
+  }
+  armed_deadline_nanos_ = requested_nanos;
+  return true;
+}
+
+void CoalescingTimerRearmer::OnTimerFired() {
+  std::scoped_lock lock(mutex_);
+  armed_deadline_nanos_ = kUnarmed;
+}
+
 bool TimerDrain(int fd) {
   // 8 bytes must be read from a signaled timer file descriptor when signaled.
   uint64_t fire_count = 0;
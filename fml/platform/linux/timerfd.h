@@ -5,6 +5,10 @@
 #ifndef FLUTTER_FML_PLATFORM_LINUX_TIMER_FD_H_
 #define FLUTTER_FML_PLATFORM_LINUX_TIMER_FD_H_
 
+#include <mutex>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 
 // clang-format off
@@ -51,6 +55,34 @@ bool TimerRearm(int fd, fml::TimePoint time_point);
 /// timer expiry.
 bool TimerDrain(int fd);
 
+/// Arms a timerfd while eliding redundant timerfd_settime syscalls. A re-arm
+/// is skipped when the timer is already set to fire no later than the
+/// requested deadline and within the configured slack before it; the rapid
+/// deadline updates of task posting bursts then coalesce into the expiry
+/// that is already armed. Waking early by up to the slack is safe for
+/// message loops: an early wake simply finds no expired tasks and re-arms.
+class CoalescingTimerRearmer {
+ public:
+  explicit CoalescingTimerRearmer(
+      TimeDelta slack = TimeDelta::FromMicroseconds(100));
+
+  /// Like |TimerRearm|, possibly skipping the syscall per the class comment.
+  bool Rearm(int fd, TimePoint time_point);
+
+  /// Must be called when the timer fires so the next deadline re-arms.
+  void OnTimerFired();
+
+ private:
+  static constexpr int64_t kUnarmed = -1;
+
+  const int64_t slack_nanos_;
+  std::mutex mutex_;
+  // Nanoseconds since the epoch of the armed expiry, or |kUnarmed|.
+  int64_t armed_deadline_nanos_ = kUnarmed;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(CoalescingTimerRearmer);
+};
+
 }  // namespace fml
 
 #endif  // FLUTTER_FML_PLATFORM_LINUX_TIMER_FD_H_
@@ -104,4 +104,32 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::Advise(Advice advice) {
+  if (mapping_ == nullptr || size_ == 0) {
+    return false;
+  }
+  int posix_advice = 0;
+  switch (advice) {
+    case Advice::kSequential:
+      posix_advice = MADV_SEQUENTIAL;
+      break;
+    case Advice::kWillNeed:
+      posix_advice = MADV_WILLNEED;
+      break;
+    case Advice::kRandom:
+      posix_advice = MADV_RANDOM;
+      break;
+    case Advice::kHugePage:
+#if defined(MADV_HUGEPAGE)
+      posix_advice = MADV_HUGEPAGE;
+      break;
+#else   // defined(MADV_HUGEPAGE)
+      // Transparent huge pages are a Linux extension.
+      return false;
+#endif  // defined(MADV_HUGEPAGE)
+  }
+  // mmap returns page aligned addresses, so the range needs no adjustment.
+  return ::madvise(mapping_, size_, posix_advice) == 0;
+}
+
 }  // namespace fml
@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/thread.h"
+
+#include <pthread.h>
+
+#include "flutter/fml/build_config.h"
+#include "flutter/fml/logging.h"
+
+#if defined(OS_LINUX) || defined(OS_ANDROID)
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(OS_MACOSX)
+#include <pthread/qos.h>
+#endif
+
+namespace fml {
+
+namespace {
+
+#if defined(OS_LINUX) || defined(OS_ANDROID)
+
+int NiceValueForPriority(ThreadPriority priority) {
+  switch (priority) {
+    case ThreadPriority::kBackground:
+      return 10;
+    case ThreadPriority::kNormal:
+      return 0;
+    case ThreadPriority::kDisplay:
+    case ThreadPriority::kRaster:
+      return -5;
+  }
+  return 0;
+}
+
+void SetCurrentThreadAffinityMask(uint64_t affinity_mask) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu) {
+    if (affinity_mask & (1ull << cpu)) {
+      CPU_SET(cpu, &cpu_set);
+    }
+  }
+  // A pid of zero binds the calling thread rather than the whole process.
+  if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+    FML_DLOG(ERROR) << "Could not apply the thread affinity mask.";
+  }
+}
+
+#endif  // defined(OS_LINUX) || defined(OS_ANDROID)
+
+}  // namespace
+
+void Thread::SetCurrentThreadConfig(const ThreadConfig& config) {
+#if defined(OS_LINUX) || defined(OS_ANDROID)
+  if (setpriority(PRIO_PROCESS, syscall(SYS_gettid),
+                  NiceValueForPriority(config.priority)) != 0) {
+    FML_DLOG(ERROR) << "Could not set the thread priority.";
+  }
+  if (config.policy == ThreadPolicy::kFifo) {
+    struct sched_param param = {};
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+      // Real-time policies commonly require elevated privileges; keep the
+      // default time-sharing policy in that case.
+      FML_DLOG(INFO) << "Could not apply the FIFO scheduling policy.";
+    }
+  }
+  if (config.affinity_mask != 0) {
+    SetCurrentThreadAffinityMask(config.affinity_mask);
+  }
+#elif defined(OS_MACOSX)
+  qos_class_t qos_class = QOS_CLASS_DEFAULT;
+  switch (config.priority) {
+    case ThreadPriority::kBackground:
+      qos_class = QOS_CLASS_UTILITY;
+      break;
+    case ThreadPriority::kNormal:
+      qos_class = QOS_CLASS_DEFAULT;
+      break;
+    case ThreadPriority::kDisplay:
+    case ThreadPriority::kRaster:
+      qos_class = QOS_CLASS_USER_INTERACTIVE;
+      break;
+  }
+  pthread_set_qos_class_self_np(qos_class, 0);
+  if (config.affinity_mask != 0) {
+    // Darwin schedulers only take affinity hints; there is no hard mask.
+    FML_DLOG(INFO) << "Thread affinity masks are unsupported on this platform.";
+  }
+#else
+  FML_DLOG(INFO) << "Could not configure the thread priority or affinity on "
+                    "this platform.";
+#endif
+}
+
+}  // namespace fml
@@ -119,4 +119,10 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::Advise(Advice advice) {
+  // There is no madvise analog for file mapping views on Windows; callers
+  // treat hints as best effort.
+  return false;
+}
+
 }  // namespace fml
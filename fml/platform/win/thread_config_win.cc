@@ -0,0 +1,43 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/thread.h"
+
+#include <windows.h>
+
+#include "flutter/fml/logging.h"
+
+namespace fml {
+
+void Thread::SetCurrentThreadConfig(const ThreadConfig& config) {
+  int priority = THREAD_PRIORITY_NORMAL;
+  switch (config.priority) {
+    case ThreadPriority::kBackground:
+      priority = THREAD_PRIORITY_BELOW_NORMAL;
+      break;
+    case ThreadPriority::kNormal:
+      priority = THREAD_PRIORITY_NORMAL;
+      break;
+    case ThreadPriority::kDisplay:
+      priority = THREAD_PRIORITY_ABOVE_NORMAL;
+      break;
+    case ThreadPriority::kRaster:
+      priority = THREAD_PRIORITY_HIGHEST;
+      break;
+  }
+  if (!SetThreadPriority(GetCurrentThread(), priority)) {
+    FML_DLOG(ERROR) << "Could not set the thread priority.";
+  }
+  // Scheduling policies are a POSIX concept; the priority class above is the
+  // closest equivalent here.
+  if (config.affinity_mask != 0) {
+    if (SetThreadAffinityMask(GetCurrentThread(),
+                              static_cast<DWORD_PTR>(config.affinity_mask)) ==
+        0) {
+      FML_DLOG(ERROR) << "Could not apply the thread affinity mask.";
+    }
+  }
+}
+
+}  // namespace fml
@@ -5,12 +5,24 @@
 #define FML_USED_ON_EMBEDDER
 
 #include "flutter/fml/raster_thread_merger.h"
+
+#include <algorithm>
+
 #include "flutter/fml/message_loop_impl.h"
 
 namespace fml {
 
 const int RasterThreadMerger::kLeaseNotSet = -1;
 
+// Cap on the lease multiplier so a pathological embedder cannot pin the
+// threads together indefinitely.
+const int RasterThreadMerger::kMaxLeaseExtensionFactor = 8;
+
+// A re-merge within this window of the previous un-merge is considered
+// premature and lengthens subsequent leases.
+static const fml::TimeDelta kReMergeHysteresisWindow =
+    fml::TimeDelta::FromMilliseconds(250);
+
 RasterThreadMerger::RasterThreadMerger(fml::TaskQueueId platform_queue_id,
                                        fml::TaskQueueId gpu_queue_id)
     : platform_queue_id_(platform_queue_id),
@@ -23,8 +35,15 @@ RasterThreadMerger::RasterThreadMerger(fml::TaskQueueId platform_queue_id,
 void RasterThreadMerger::MergeWithLease(size_t lease_term) {
   FML_DCHECK(lease_term > 0) << "lease_term should be positive.";
   if (!is_merged_) {
+    if (has_unmerged_ &&
+        fml::TimePoint::Now() - last_unmerge_time_ < kReMergeHysteresisWindow) {
+      lease_extension_factor_ =
+          std::min(lease_extension_factor_ * 2, kMaxLeaseExtensionFactor);
+    } else {
+      lease_extension_factor_ = 1;
+    }
     is_merged_ = task_queues_->Merge(platform_queue_id_, gpu_queue_id_);
-    lease_term_ = lease_term;
+    lease_term_ = lease_term * lease_extension_factor_;
   }
 }
 
@@ -48,6 +67,10 @@ bool RasterThreadMerger::IsMerged() const {
   return is_merged_;
 }
 
+void RasterThreadMerger::SetPreUnmergeCallback(const fml::closure& callback) {
+  pre_unmerge_callback_ = callback;
+}
+
 RasterThreadStatus RasterThreadMerger::DecrementLease() {
   if (!is_merged_) {
     return RasterThreadStatus::kRemainsUnmerged;
@@ -62,9 +85,14 @@ RasterThreadStatus RasterThreadMerger::DecrementLease() {
       << "lease_term should always be positive when merged.";
   lease_term_--;
   if (lease_term_ == 0) {
+    if (pre_unmerge_callback_) {
+      pre_unmerge_callback_();
+    }
     bool success = task_queues_->Unmerge(platform_queue_id_);
     FML_CHECK(success) << "Unable to un-merge the raster and platform threads.";
     is_merged_ = false;
+    last_unmerge_time_ = fml::TimePoint::Now();
+    has_unmerged_ = true;
     return RasterThreadStatus::kUnmergedNow;
   }
 
@@ -5,9 +5,11 @@
 #ifndef FML_SHELL_COMMON_TASK_RUNNER_MERGER_H_
 #define FML_SHELL_COMMON_TASK_RUNNER_MERGER_H_
 
+#include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/message_loop_task_queues.h"
+#include "flutter/fml/time/time_point.h"
 
 namespace fml {
 
@@ -28,6 +30,12 @@ class RasterThreadMerger
   // When the caller merges with a lease term of say 2. The threads
   // are going to remain merged until 2 invocations of |DecreaseLease|,
   // unless an |ExtendLeaseTo| gets called.
+  //
+  // The lease term is scaled by an internal hysteresis factor: if the
+  // threads are re-merged shortly after the previous un-merge, the merge
+  // was probably premature (e.g. a platform view blinking in and out
+  // during a scroll) and subsequent leases are lengthened to avoid
+  // thrashing the task queues.
   void MergeWithLease(size_t lease_term);
 
   void ExtendLeaseTo(size_t lease_term);
@@ -36,6 +44,12 @@ class RasterThreadMerger
   // splitting the raster and platform threads. Reduces the lease term by 1.
   RasterThreadStatus DecrementLease();
 
+  // Sets a callback that is invoked on the rasterizing thread just before
+  // the threads are un-merged. This gives the rasterizer a chance to flush
+  // pending GPU work (acting as a barrier) while the merged thread still
+  // owns the raster task queue.
+  void SetPreUnmergeCallback(const fml::closure& callback);
+
   bool IsMerged() const;
 
   RasterThreadMerger(fml::TaskQueueId platform_queue_id,
@@ -48,11 +62,20 @@ class RasterThreadMerger
 
  private:
   static const int kLeaseNotSet;
+  static const int kMaxLeaseExtensionFactor;
   fml::TaskQueueId platform_queue_id_;
   fml::TaskQueueId gpu_queue_id_;
   fml::RefPtr<fml::MessageLoopTaskQueues> task_queues_;
   std::atomic_int lease_term_;
   bool is_merged_;
+  // Multiplier applied to requested lease terms; doubled (up to
+  // |kMaxLeaseExtensionFactor|) on each premature re-merge and reset once
+  // an un-merge sticks.
+  int lease_extension_factor_ = 1;
+  // Time of the last un-merge; used to detect premature re-merges.
+  fml::TimePoint last_unmerge_time_;
+  bool has_unmerged_ = false;
+  fml::closure pre_unmerge_callback_;
 
   FML_FRIEND_REF_COUNTED_THREAD_SAFE(RasterThreadMerger);
   FML_FRIEND_MAKE_REF_COUNTED(RasterThreadMerger);
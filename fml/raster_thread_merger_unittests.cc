@@ -61,6 +61,104 @@ TEST(RasterThreadMerger, RemainMergedTillLeaseExpires) {
   thread2.join();
 }
 
+TEST(RasterThreadMerger, PrematureReMergeExtendsLease) {
+  fml::MessageLoop* loop1 = nullptr;
+  fml::AutoResetWaitableEvent latch1;
+  fml::AutoResetWaitableEvent term1;
+  std::thread thread1([&loop1, &latch1, &term1]() {
+    fml::MessageLoop::EnsureInitializedForCurrentThread();
+    loop1 = &fml::MessageLoop::GetCurrent();
+    latch1.Signal();
+    term1.Wait();
+  });
+
+  fml::MessageLoop* loop2 = nullptr;
+  fml::AutoResetWaitableEvent latch2;
+  fml::AutoResetWaitableEvent term2;
+  std::thread thread2([&loop2, &latch2, &term2]() {
+    fml::MessageLoop::EnsureInitializedForCurrentThread();
+    loop2 = &fml::MessageLoop::GetCurrent();
+    latch2.Signal();
+    term2.Wait();
+  });
+
+  latch1.Wait();
+  latch2.Wait();
+
+  fml::TaskQueueId qid1 = loop1->GetTaskRunner()->GetTaskQueueId();
+  fml::TaskQueueId qid2 = loop2->GetTaskRunner()->GetTaskQueueId();
+  const auto raster_thread_merger_ =
+      fml::MakeRefCounted<fml::RasterThreadMerger>(qid1, qid2);
+
+  raster_thread_merger_->MergeWithLease(1);
+  ASSERT_TRUE(raster_thread_merger_->IsMerged());
+  raster_thread_merger_->DecrementLease();
+  ASSERT_FALSE(raster_thread_merger_->IsMerged());
+
+  // Re-merging right after the un-merge doubles the requested lease, so the
+  // threads stay merged for one extra decrement.
+  raster_thread_merger_->MergeWithLease(1);
+  ASSERT_TRUE(raster_thread_merger_->IsMerged());
+  raster_thread_merger_->DecrementLease();
+  ASSERT_TRUE(raster_thread_merger_->IsMerged());
+  raster_thread_merger_->DecrementLease();
+  ASSERT_FALSE(raster_thread_merger_->IsMerged());
+
+  term1.Signal();
+  term2.Signal();
+  thread1.join();
+  thread2.join();
+}
+
+TEST(RasterThreadMerger, PreUnmergeCallbackRunsBeforeUnmerge) {
+  fml::MessageLoop* loop1 = nullptr;
+  fml::AutoResetWaitableEvent latch1;
+  fml::AutoResetWaitableEvent term1;
+  std::thread thread1([&loop1, &latch1, &term1]() {
+    fml::MessageLoop::EnsureInitializedForCurrentThread();
+    loop1 = &fml::MessageLoop::GetCurrent();
+    latch1.Signal();
+    term1.Wait();
+  });
+
+  fml::MessageLoop* loop2 = nullptr;
+  fml::AutoResetWaitableEvent latch2;
+  fml::AutoResetWaitableEvent term2;
+  std::thread thread2([&loop2, &latch2, &term2]() {
+    fml::MessageLoop::EnsureInitializedForCurrentThread();
+    loop2 = &fml::MessageLoop::GetCurrent();
+    latch2.Signal();
+    term2.Wait();
+  });
+
+  latch1.Wait();
+  latch2.Wait();
+
+  fml::TaskQueueId qid1 = loop1->GetTaskRunner()->GetTaskQueueId();
+  fml::TaskQueueId qid2 = loop2->GetTaskRunner()->GetTaskQueueId();
+  const auto raster_thread_merger_ =
+      fml::MakeRefCounted<fml::RasterThreadMerger>(qid1, qid2);
+
+  int callback_count = 0;
+  raster_thread_merger_->SetPreUnmergeCallback([&]() {
+    // The threads must still be merged while the callback runs.
+    ASSERT_TRUE(raster_thread_merger_->IsMerged());
+    callback_count++;
+  });
+
+  raster_thread_merger_->MergeWithLease(2);
+  raster_thread_merger_->DecrementLease();
+  ASSERT_EQ(callback_count, 0);
+  raster_thread_merger_->DecrementLease();
+  ASSERT_EQ(callback_count, 1);
+  ASSERT_FALSE(raster_thread_merger_->IsMerged());
+
+  term1.Signal();
+  term2.Signal();
+  thread1.join();
+  thread2.join();
+}
+
 TEST(RasterThreadMerger, IsNotOnRasterizingThread) {
   fml::MessageLoop* loop1 = nullptr;
   fml::AutoResetWaitableEvent latch1;
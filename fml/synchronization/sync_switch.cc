@@ -20,10 +20,11 @@ SyncSwitch::Handlers& SyncSwitch::Handlers::SetIfFalse(
 
 SyncSwitch::SyncSwitch() : SyncSwitch(false) {}
 
-SyncSwitch::SyncSwitch(bool value) : value_(value) {}
+SyncSwitch::SyncSwitch(bool value)
+    : mutex_(SharedMutex::Create()), value_(value) {}
 
 void SyncSwitch::Execute(const SyncSwitch::Handlers& handlers) {
-  std::scoped_lock guard(mutex_);
+  SharedLock lock(*mutex_);
   if (value_) {
     handlers.true_handler();
   } else {
@@ -32,7 +33,7 @@ void SyncSwitch::Execute(const SyncSwitch::Handlers& handlers) {
 }
 
 void SyncSwitch::SetSwitch(bool value) {
-  std::scoped_lock guard(mutex_);
+  UniqueLock lock(*mutex_);
   value_ = value;
 }
 
@@ -7,17 +7,21 @@
 
 #include <forward_list>
 #include <functional>
-#include <mutex>
+#include <memory>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/synchronization/shared_mutex.h"
 
 namespace fml {
 
 /// A threadsafe structure that allows you to switch between 2 different
 /// execution paths.
 ///
-/// Execution and setting the switch is exclusive, i.e. only one will happen
-/// at a time.
+/// Execution and setting the switch is exclusive, i.e. a set never happens
+/// while a handler is running. Executions do not exclude each other: reads
+/// vastly outnumber the rare lifecycle writes (the GPU availability switch
+/// is consulted on the raster path every frame), so they take the reader
+/// side of a shared mutex and proceed concurrently without contending.
 class SyncSwitch {
  public:
   /// Represents the 2 code paths available when calling |SyncSwitch::Execute|.
@@ -56,7 +60,7 @@ class SyncSwitch {
   void SetSwitch(bool value);
 
  private:
-  std::mutex mutex_;
+  std::unique_ptr<SharedMutex> mutex_;
   bool value_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(SyncSwitch);
@@ -4,6 +4,9 @@
 
 #include "flutter/fml/synchronization/sync_switch.h"
 
+#include <thread>
+
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "gtest/gtest.h"
 
 using fml::SyncSwitch;
@@ -28,3 +31,19 @@ TEST(SyncSwitchTest, NoopIfUndefined) {
   syncSwitch.Execute(SyncSwitch::Handlers());
   EXPECT_FALSE(switchValue);
 }
+
+TEST(SyncSwitchTest, ExecutionsDoNotExcludeEachOther) {
+  SyncSwitch syncSwitch;
+  // Both handlers park inside Execute until the other has arrived. This
+  // only completes if two executions can hold the switch concurrently.
+  fml::CountDownLatch latch(2);
+  auto handlers = SyncSwitch::Handlers().SetIfFalse([&latch] {
+    latch.CountDown();
+    latch.Wait();
+  });
+
+  std::thread first([&] { syncSwitch.Execute(handlers); });
+  std::thread second([&] { syncSwitch.Execute(handlers); });
+  first.join();
+  second.join();
+}
@@ -11,6 +11,10 @@
 #include <errno.h>
 #include <time.h>
 
+#if OS_LINUX || OS_ANDROID
+#include "flutter/fml/platform/linux/futex.h"
+#endif
+
 namespace fml {
 
 // Waits with a timeout on |condition()|. Returns true on timeout, or false if
@@ -54,6 +58,101 @@ bool WaitWithTimeoutImpl(std::unique_lock<std::mutex>* locker,
 
 // AutoResetWaitableEvent ------------------------------------------------------
 
+#if OS_LINUX || OS_ANDROID
+
+namespace {
+
+// Values of |AutoResetWaitableEvent::state_|.
+constexpr uint32_t kUnsignaled = 0u;
+constexpr uint32_t kSignaled = 1u;
+// Unsignaled, with at least one waiter parked in the kernel. |Signal()| only
+// issues the wake syscall after observing this value.
+constexpr uint32_t kParked = 2u;
+
+// How many times a waiter re-checks the state in user space before parking.
+// Signal/wait handshakes on these events are frequently sub-microsecond
+// (platform message latches, thread mergers), so a short spin routinely
+// catches the signal for the cost of a few cache line reads instead of a
+// park/wake syscall pair.
+constexpr int kSpinCount = 100;
+
+}  // namespace
+
+void AutoResetWaitableEvent::Signal() {
+  if (state_.exchange(kSignaled, std::memory_order_release) == kParked) {
+    FutexWakeOne(&state_);
+  }
+}
+
+void AutoResetWaitableEvent::Reset() {
+  // Only perform the signaled -> unsignaled transition, and keep the parked
+  // marker when doing so: a waiter may already be in the kernel behind the
+  // signaled state, and overwriting the marker with |kUnsignaled| would make
+  // every future |Signal()| skip the wake it needs. The marker costs at most
+  // one spurious wake syscall on the next |Signal()| if no waiter remains.
+  uint32_t expected = kSignaled;
+  state_.compare_exchange_strong(expected, kParked);
+}
+
+void AutoResetWaitableEvent::Wait() {
+  for (int i = 0; i < kSpinCount; ++i) {
+    uint32_t expected = kSignaled;
+    if (state_.compare_exchange_weak(expected, kUnsignaled,
+                                     std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+      return;
+    }
+  }
+
+  // Park. An |exchange| rather than a CAS back to |kUnsignaled| so that the
+  // parked marker survives a successful consume: other waiters may still be
+  // in the kernel, and the marker is what makes the next |Signal()| wake one
+  // of them. The marker can outlive the last waiter, which costs at most one
+  // spurious wake syscall on a later |Signal()|.
+  while (state_.exchange(kParked, std::memory_order_acquire) != kSignaled) {
+    FutexWait(&state_, kParked, nullptr);
+  }
+}
+
+bool AutoResetWaitableEvent::WaitWithTimeout(TimeDelta timeout) {
+  uint32_t expected = kSignaled;
+  if (state_.compare_exchange_strong(expected, kUnsignaled,
+                                     std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+    return false;
+  }
+
+  TimePoint start = TimePoint::Now();
+  while (true) {
+    // See |Wait()| for why this is an exchange and not a CAS.
+    if (state_.exchange(kParked, std::memory_order_acquire) == kSignaled) {
+      return false;
+    }
+
+    TimePoint now = TimePoint::Now();
+    FML_DCHECK(now >= start);
+    TimeDelta elapsed = now - start;
+    if (elapsed >= timeout) {
+      return true;
+    }
+
+    // FUTEX_WAIT takes a relative timeout. Spurious or interrupted returns
+    // simply re-enter the loop with a recomputed remainder.
+    TimeDelta wait_remaining = timeout - elapsed;
+    struct timespec ts;
+    ts.tv_sec = static_cast<time_t>(wait_remaining.ToSeconds());
+    ts.tv_nsec = static_cast<long>(wait_remaining.ToNanoseconds() %
+                                   (1000 * 1000 * 1000));
+    FutexWait(&state_, kParked, &ts);
+  }
+}
+
+bool AutoResetWaitableEvent::IsSignaledForTest() {
+  return state_.load(std::memory_order_acquire) == kSignaled;
+}
+
+#else  // OS_LINUX || OS_ANDROID
+
 void AutoResetWaitableEvent::Signal() {
   std::scoped_lock locker(mutex_);
   signaled_ = true;
@@ -114,6 +213,8 @@ bool AutoResetWaitableEvent::IsSignaledForTest() {
   return signaled_;
 }
 
+#endif  // OS_LINUX || OS_ANDROID
+
 // ManualResetWaitableEvent ----------------------------------------------------
 
 void ManualResetWaitableEvent::Signal() {
@@ -10,9 +10,11 @@
 #ifndef FLUTTER_FML_SYNCHRONIZATION_WAITABLE_EVENT_H_
 #define FLUTTER_FML_SYNCHRONIZATION_WAITABLE_EVENT_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 
+#include "flutter/fml/build_config.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/time/time_delta.h"
 
@@ -62,11 +64,20 @@ class AutoResetWaitableEvent final {
   bool IsSignaledForTest();
 
  private:
+#if OS_LINUX || OS_ANDROID
+  // Futex-backed state word: 0 is unsignaled, 1 is signaled and 2 is
+  // unsignaled with at least one waiter parked in the kernel. Signal/wait
+  // pairs that race closely resolve entirely in user space with a single
+  // atomic operation on each side; the futex syscalls are only issued once a
+  // waiter actually has to park.
+  std::atomic<uint32_t> state_{0u};
+#else
   std::condition_variable cv_;
   std::mutex mutex_;
 
   // True if this event is in the signaled state.
   bool signaled_ = false;
+#endif
 
   FML_DISALLOW_COPY_AND_ASSIGN(AutoResetWaitableEvent);
 };
@@ -0,0 +1,56 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+#include <thread>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+
+namespace fml {
+namespace benchmarking {
+
+// Measures the uncontended fast path: the event is already signaled when the
+// wait begins, so no thread ever blocks.
+static void BM_AutoResetWaitableEventSignalThenWait(benchmark::State& state) {
+  fml::AutoResetWaitableEvent event;
+  while (state.KeepRunning()) {
+    event.Signal();
+    event.Wait();
+  }
+}
+
+BENCHMARK(BM_AutoResetWaitableEventSignalThenWait);
+
+// Measures a cross-thread signal/wait round trip, the pattern used all over
+// the shell to block one thread on work performed by another.
+static void BM_AutoResetWaitableEventRoundTrip(benchmark::State& state) {
+  fml::AutoResetWaitableEvent ping;
+  fml::AutoResetWaitableEvent pong;
+  std::atomic_bool done{false};
+
+  std::thread responder([&ping, &pong, &done]() {
+    while (true) {
+      ping.Wait();
+      if (done) {
+        break;
+      }
+      pong.Signal();
+    }
+  });
+
+  while (state.KeepRunning()) {
+    ping.Signal();
+    pong.Wait();
+  }
+
+  done = true;
+  ping.Signal();
+  responder.join();
+}
+
+BENCHMARK(BM_AutoResetWaitableEventRoundTrip);
+
+}  // namespace benchmarking
+}  // namespace fml
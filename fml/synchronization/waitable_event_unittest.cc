@@ -123,6 +123,31 @@ TEST(AutoResetWaitableEventTest, MultipleWaiters) {
   }
 }
 
+// Rapid signal/wait round trips between two threads. This drives both the
+// user-space fast path (when the signaler gets ahead of the waiter) and the
+// park/wake slow path, in tight alternation.
+TEST(AutoResetWaitableEventTest, PingPong) {
+  constexpr size_t kIterations = 10000u;
+  AutoResetWaitableEvent ping;
+  AutoResetWaitableEvent pong;
+
+  std::thread responder([&ping, &pong]() {
+    for (size_t i = 0u; i < kIterations; i++) {
+      ping.Wait();
+      pong.Signal();
+    }
+  });
+
+  for (size_t i = 0u; i < kIterations; i++) {
+    ping.Signal();
+    pong.Wait();
+  }
+
+  responder.join();
+  EXPECT_FALSE(ping.IsSignaledForTest());
+  EXPECT_FALSE(pong.IsSignaledForTest());
+}
+
 // ManualResetWaitableEvent ----------------------------------------------------
 
 TEST(ManualResetWaitableEventTest, Basic) {
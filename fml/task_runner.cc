@@ -22,7 +22,12 @@ TaskRunner::TaskRunner(fml::RefPtr<MessageLoopImpl> loop)
 TaskRunner::~TaskRunner() = default;
 
 void TaskRunner::PostTask(const fml::closure& task) {
-  loop_->PostTask(task, fml::TimePoint::Now());
+  // An immediate task only needs a target time at or before the actual
+  // present: ties between equal target times are broken by registration
+  // order, so the coarse clock cannot reorder posts. This is the hottest
+  // clock read in the engine. Delayed posts below keep the precise clock
+  // since their deadline accuracy depends on it.
+  loop_->PostTask(task, fml::TimePoint::CoarseNow());
 }
 
 void TaskRunner::PostTaskForTime(const fml::closure& task,
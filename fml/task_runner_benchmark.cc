@@ -0,0 +1,49 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/thread.h"
+
+namespace fml {
+namespace benchmarking {
+
+// Measures the end-to-end latency of posting a task to a loop on another
+// thread and having it run: enqueue, wakeup, dequeue and invocation.
+static void BM_PostTaskRoundTrip(benchmark::State& state) {
+  fml::Thread thread("benchmark.task_runner");
+  auto task_runner = thread.GetTaskRunner();
+
+  fml::AutoResetWaitableEvent latch;
+  while (state.KeepRunning()) {
+    task_runner->PostTask([&latch]() { latch.Signal(); });
+    latch.Wait();
+  }
+}
+
+BENCHMARK(BM_PostTaskRoundTrip);
+
+// Measures sustained task throughput when the poster does not wait for each
+// task individually, amortizing the loop wakeup across a batch.
+static void BM_PostTaskThroughput(benchmark::State& state) {
+  fml::Thread thread("benchmark.task_runner");
+  auto task_runner = thread.GetTaskRunner();
+
+  constexpr int tasks_per_batch = 1000;
+  while (state.KeepRunning()) {
+    fml::CountDownLatch latch(tasks_per_batch);
+    for (int i = 0; i < tasks_per_batch; i++) {
+      task_runner->PostTask([&latch]() { latch.CountDown(); });
+    }
+    latch.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * tasks_per_batch);
+}
+
+BENCHMARK(BM_PostTaskThroughput);
+
+}  // namespace benchmarking
+}  // namespace fml
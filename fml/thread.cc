@@ -22,11 +22,14 @@
 
 namespace fml {
 
-Thread::Thread(const std::string& name) : joined_(false) {
+Thread::Thread(const std::string& name) : Thread(ThreadConfig(name)) {}
+
+Thread::Thread(const ThreadConfig& config) : joined_(false) {
   fml::AutoResetWaitableEvent latch;
   fml::RefPtr<fml::TaskRunner> runner;
-  thread_ = std::make_unique<std::thread>([&latch, &runner, name]() -> void {
-    SetCurrentThreadName(name);
+  thread_ = std::make_unique<std::thread>([&latch, &runner, config]() -> void {
+    SetCurrentThreadName(config.name);
+    SetCurrentThreadConfig(config);
     fml::MessageLoop::EnsureInitializedForCurrentThread();
     auto& loop = MessageLoop::GetCurrent();
     runner = loop.GetTaskRunner();
@@ -45,6 +48,10 @@ fml::RefPtr<fml::TaskRunner> Thread::GetTaskRunner() const {
   return task_runner_;
 }
 
+void Thread::UpdateConfig(const ThreadConfig& config) {
+  task_runner_->PostTask([config]() { SetCurrentThreadConfig(config); });
+}
+
 void Thread::Join() {
   if (joined_) {
     return;
@@ -14,18 +14,80 @@
 
 namespace fml {
 
+/// The priority class a thread should run at. How a class maps onto the
+/// operating system scheduler is platform specific.
+enum class ThreadPriority {
+  /// Suitable for threads that shouldn't disrupt high priority work.
+  kBackground,
+  /// Default priority level.
+  kNormal,
+  /// Suitable for threads which generate data for the display.
+  kDisplay,
+  /// Suitable for thread which raster data.
+  kRaster,
+};
+
+/// The scheduling policy a thread should request from the operating system.
+enum class ThreadPolicy {
+  /// Use the platform default time-sharing policy.
+  kDefault,
+  /// Request a first-in-first-out real-time policy where the platform
+  /// supports one. Falls back to the default policy if the request is
+  /// denied.
+  kFifo,
+};
+
+/// The name, priority class, scheduling policy and core-affinity mask a
+/// thread should be created with (or rebalanced to at runtime).
+struct ThreadConfig {
+  ThreadConfig() = default;
+
+  explicit ThreadConfig(
+      std::string thread_name,
+      ThreadPriority thread_priority = ThreadPriority::kNormal,
+      ThreadPolicy thread_policy = ThreadPolicy::kDefault,
+      uint64_t thread_affinity_mask = 0)
+      : name(std::move(thread_name)),
+        priority(thread_priority),
+        policy(thread_policy),
+        affinity_mask(thread_affinity_mask) {}
+
+  std::string name;
+
+  ThreadPriority priority = ThreadPriority::kNormal;
+
+  ThreadPolicy policy = ThreadPolicy::kDefault;
+
+  /// Bitmask of the CPU cores the thread may be scheduled on, where bit N
+  /// allows core N. Zero leaves the platform default mask in place.
+  uint64_t affinity_mask = 0;
+};
+
 class Thread {
  public:
   explicit Thread(const std::string& name = "");
 
+  explicit Thread(const ThreadConfig& config);
+
   ~Thread();
 
   fml::RefPtr<fml::TaskRunner> GetTaskRunner() const;
 
   void Join();
 
+  /// Rebalancing hook: re-applies the priority, policy and affinity mask of
+  /// the given config on the thread itself. Embedders may call this at
+  /// runtime, for example to pin the raster thread to big cores for the
+  /// duration of an animation.
+  void UpdateConfig(const ThreadConfig& config);
+
   static void SetCurrentThreadName(const std::string& name);
 
+  /// Applies the priority, policy and affinity mask of the config to the
+  /// calling thread. The name is not applied; use |SetCurrentThreadName|.
+  /// Implemented by the per-platform backends in //flutter/fml/platform.
+  static void SetCurrentThreadConfig(const ThreadConfig& config);
+
  private:
   std::unique_ptr<std::thread> thread_;
   fml::RefPtr<fml::TaskRunner> task_runner_;
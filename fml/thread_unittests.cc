@@ -24,3 +24,21 @@ TEST(Thread, HasARunningMessageLoop) {
   thread.Join();
   ASSERT_TRUE(done);
 }
+
+TEST(Thread, CanStartWithAConfig) {
+  fml::Thread thread(fml::ThreadConfig("config_test",
+                                       fml::ThreadPriority::kRaster,
+                                       fml::ThreadPolicy::kDefault, 0));
+  ASSERT_TRUE(thread.GetTaskRunner());
+  thread.Join();
+}
+
+TEST(Thread, CanUpdateConfigAtRuntime) {
+  fml::Thread thread("rebalance_test");
+  thread.UpdateConfig(
+      fml::ThreadConfig("rebalance_test", fml::ThreadPriority::kBackground));
+  bool done = false;
+  thread.GetTaskRunner()->PostTask([&done]() { done = true; });
+  thread.Join();
+  ASSERT_TRUE(done);
+}
@@ -26,6 +26,14 @@ class TimePoint {
 
   static TimePoint Now();
 
+  // A cheaper read of the same timeline as |Now| on platforms that publish
+  // a low-resolution snapshot of the monotonic clock. The returned value
+  // may lag |Now| by a scheduler tick (typically 1-10ms), so it is only
+  // suitable for consumers that tolerate coarse timestamps, such as
+  // ordering checks over long windows. Falls back to |Now| where no coarse
+  // clock is available.
+  static TimePoint CoarseNow();
+
   static constexpr TimePoint Min() {
     return TimePoint(std::numeric_limits<int64_t>::min());
   }
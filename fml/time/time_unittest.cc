@@ -20,6 +20,16 @@ TEST(Time, Now) {
   }
 }
 
+TEST(Time, CoarseNowSharesTheMonotonicTimeline) {
+  auto before = TimePoint::Now();
+  auto coarse = TimePoint::CoarseNow();
+  auto after = TimePoint::Now();
+  // The coarse clock may lag the precise one by a scheduler tick but never
+  // runs ahead of it.
+  EXPECT_LE(coarse, after);
+  EXPECT_GE(coarse, before - TimeDelta::FromMilliseconds(100));
+}
+
 TEST(Time, IntConversions) {
   // Integer conversions should all truncate, not round.
   TimeDelta delta = TimeDelta::FromNanoseconds(102304506708ll);
@@ -0,0 +1,115 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/timer_wheel.h"
+
+#include "flutter/fml/logging.h"
+
+namespace fml {
+
+TimerWheel::TimerWheel() = default;
+
+TimerWheel::~TimerWheel() = default;
+
+size_t TimerWheel::BucketIndexForTime(fml::TimePoint target_time) const {
+  const int64_t micros = target_time.ToEpochDelta().ToMicroseconds();
+  return static_cast<size_t>(micros / kBucketWidthMicros) % kNumBuckets;
+}
+
+bool TimerWheel::IsWithinHorizon(fml::TimePoint target_time) const {
+  const auto horizon =
+      fml::TimePoint::Now() +
+      fml::TimeDelta::FromMicroseconds(kBucketWidthMicros * kNumBuckets);
+  return target_time < horizon;
+}
+
+void TimerWheel::Push(DelayedTask task) {
+  if (!IsWithinHorizon(task.GetTargetTime())) {
+    overflow_.push(std::move(task));
+    return;
+  }
+
+  Bucket& bucket = buckets_[BucketIndexForTime(task.GetTargetTime())];
+  bucket.emplace_back(std::move(task));
+  if (min_valid_ && buckets_[min_bucket_][min_index_] > bucket.back()) {
+    min_bucket_ = BucketIndexForTime(bucket.back().GetTargetTime());
+    min_index_ = bucket.size() - 1;
+  }
+  ++wheel_size_;
+}
+
+void TimerWheel::FindWheelMin() const {
+  FML_DCHECK(wheel_size_ > 0);
+  const DelayedTask* min_task = nullptr;
+  for (size_t bucket_index = 0; bucket_index < kNumBuckets; ++bucket_index) {
+    const Bucket& bucket = buckets_[bucket_index];
+    for (size_t task_index = 0; task_index < bucket.size(); ++task_index) {
+      if (min_task == nullptr || *min_task > bucket[task_index]) {
+        min_task = &bucket[task_index];
+        min_bucket_ = bucket_index;
+        min_index_ = task_index;
+      }
+    }
+  }
+  min_valid_ = true;
+}
+
+bool TimerWheel::TopIsInOverflow() const {
+  if (wheel_size_ == 0) {
+    return true;
+  }
+  if (overflow_.empty()) {
+    return false;
+  }
+  if (!min_valid_) {
+    FindWheelMin();
+  }
+  return buckets_[min_bucket_][min_index_] > overflow_.top();
+}
+
+const DelayedTask& TimerWheel::Top() const {
+  FML_DCHECK(!IsEmpty());
+  if (TopIsInOverflow()) {
+    return overflow_.top();
+  }
+  if (!min_valid_) {
+    FindWheelMin();
+  }
+  return buckets_[min_bucket_][min_index_];
+}
+
+DelayedTask TimerWheel::Pop() {
+  FML_DCHECK(!IsEmpty());
+  if (TopIsInOverflow()) {
+    return overflow_.pop();
+  }
+  if (!min_valid_) {
+    FindWheelMin();
+  }
+  Bucket& bucket = buckets_[min_bucket_];
+  DelayedTask task = std::move(bucket[min_index_]);
+  bucket.erase(bucket.begin() + min_index_);
+  --wheel_size_;
+  min_valid_ = false;
+  return task;
+}
+
+bool TimerWheel::IsEmpty() const {
+  return wheel_size_ == 0 && overflow_.empty();
+}
+
+size_t TimerWheel::GetSize() const {
+  return wheel_size_ + overflow_.size();
+}
+
+void TimerWheel::Clear() {
+  for (auto& bucket : buckets_) {
+    bucket.clear();
+  }
+  wheel_size_ = 0;
+  overflow_ = DelayedTaskQueue();
+  min_valid_ = false;
+}
+
+}  // namespace fml
@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_TIMER_WHEEL_H_
+#define FLUTTER_FML_TIMER_WHEEL_H_
+
+#include <array>
+#include <vector>
+
+#include "flutter/fml/delayed_task.h"
+#include "flutter/fml/macros.h"
+
+namespace fml {
+
+// A hashed timer wheel backend for delayed tasks. Tasks due within the
+// wheel horizon are hashed into fixed-width buckets with O(1) insertion;
+// tasks further out land in an overflow min-heap and only pay the heap
+// cost that far-future timers can afford. This trades the strict ordering
+// of |DelayedTaskHeap| within a bucket width for constant-time insertion,
+// which matters on queues that register thousands of short animation
+// timers per second. Tasks that share a bucket are still returned in
+// target-time (then registration) order.
+class TimerWheel final : public DelayedTaskSource {
+ public:
+  TimerWheel();
+
+  ~TimerWheel() override;
+
+  void Push(DelayedTask task) override;
+
+  const DelayedTask& Top() const override;
+
+  DelayedTask Pop() override;
+
+  bool IsEmpty() const override;
+
+  size_t GetSize() const override;
+
+  void Clear() override;
+
+ private:
+  // 512 buckets of 1ms cover roughly half a second of pending timers,
+  // which comfortably spans several frames of animation churn.
+  static constexpr size_t kNumBuckets = 512;
+  static constexpr int64_t kBucketWidthMicros = 1000;
+
+  using Bucket = std::vector<DelayedTask>;
+
+  size_t BucketIndexForTime(fml::TimePoint target_time) const;
+
+  bool IsWithinHorizon(fml::TimePoint target_time) const;
+
+  // Re-establishes |min_bucket_| and |min_index_| by scanning the wheel.
+  void FindWheelMin() const;
+
+  // True if |Top| currently resolves to the overflow heap rather than the
+  // wheel. Must only be called when the wheel is not empty overall.
+  bool TopIsInOverflow() const;
+
+  std::array<Bucket, kNumBuckets> buckets_;
+  size_t wheel_size_ = 0;
+
+  // Tasks beyond the wheel horizon. Never promoted into the wheel; |Top|
+  // compares against the heap top directly, which keeps eviction correct
+  // without periodic cascades.
+  DelayedTaskQueue overflow_;
+
+  // Cached location of the earliest task in the wheel. Kept valid across
+  // |Push| (a new minimum just replaces the cache) and invalidated by
+  // |Pop|, which removes the cached element.
+  mutable bool min_valid_ = false;
+  mutable size_t min_bucket_ = 0;
+  mutable size_t min_index_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TimerWheel);
+};
+
+}  // namespace fml
+
+#endif  // FLUTTER_FML_TIMER_WHEEL_H_
@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#define FML_USED_ON_EMBEDDER
+
+#include "flutter/fml/timer_wheel.h"
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace {
+
+DelayedTask MakeTask(size_t order, fml::TimeDelta delay) {
+  return DelayedTask(order, []() {}, fml::TimePoint::Now() + delay);
+}
+
+}  // namespace
+
+TEST(TimerWheel, StartsEmpty) {
+  TimerWheel wheel;
+  ASSERT_TRUE(wheel.IsEmpty());
+  ASSERT_EQ(wheel.GetSize(), 0u);
+}
+
+TEST(TimerWheel, ReturnsTasksInTargetTimeOrder) {
+  TimerWheel wheel;
+  wheel.Push(MakeTask(0, fml::TimeDelta::FromMilliseconds(30)));
+  wheel.Push(MakeTask(1, fml::TimeDelta::FromMilliseconds(10)));
+  wheel.Push(MakeTask(2, fml::TimeDelta::FromMilliseconds(20)));
+  ASSERT_EQ(wheel.GetSize(), 3u);
+
+  auto first = wheel.Top().GetTargetTime();
+  wheel.Pop();
+  auto second = wheel.Top().GetTargetTime();
+  wheel.Pop();
+  auto third = wheel.Top().GetTargetTime();
+  wheel.Pop();
+
+  ASSERT_LE(first, second);
+  ASSERT_LE(second, third);
+  ASSERT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, TasksBeyondHorizonAreStillOrdered) {
+  TimerWheel wheel;
+  // Far beyond the wheel horizon: lands in the overflow heap.
+  wheel.Push(MakeTask(0, fml::TimeDelta::FromSeconds(10)));
+  wheel.Push(MakeTask(1, fml::TimeDelta::FromMilliseconds(5)));
+  ASSERT_EQ(wheel.GetSize(), 2u);
+
+  auto first = wheel.Top().GetTargetTime();
+  wheel.Pop();
+  auto second = wheel.Top().GetTargetTime();
+  wheel.Pop();
+
+  ASSERT_LT(first, second);
+  ASSERT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, TasksWithSameTargetTimeRunInRegistrationOrder) {
+  TimerWheel wheel;
+  const auto time = fml::TimePoint::Now() + fml::TimeDelta::FromMilliseconds(5);
+  bool first_ran = false;
+  wheel.Push(DelayedTask(0, [&first_ran]() { first_ran = true; }, time));
+  wheel.Push(DelayedTask(1, []() {}, time));
+
+  wheel.Top().GetTask()();
+  ASSERT_TRUE(first_ran);
+}
+
+TEST(TimerWheel, ClearDropsAllTasks) {
+  TimerWheel wheel;
+  wheel.Push(MakeTask(0, fml::TimeDelta::FromMilliseconds(1)));
+  wheel.Push(MakeTask(1, fml::TimeDelta::FromSeconds(10)));
+  wheel.Clear();
+  ASSERT_TRUE(wheel.IsEmpty());
+  ASSERT_EQ(wheel.GetSize(), 0u);
+}
+
+}  // namespace fml
@@ -11,6 +11,7 @@
 #include "flutter/fml/ascii_trie.h"
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/trace_ring_buffer.h"
 
 #if (FLUTTER_RELEASE && !defined(OS_FUCHSIA))
 #define TIMELINE_ENABLED 0
@@ -21,6 +22,43 @@
 namespace fml {
 namespace tracing {
 
+namespace {
+
+TraceRecordType ToTraceRecordType(Dart_Timeline_Event_Type type) {
+  switch (type) {
+    case Dart_Timeline_Event_Begin:
+      return TraceRecordType::kBegin;
+    case Dart_Timeline_Event_End:
+      return TraceRecordType::kEnd;
+    case Dart_Timeline_Event_Counter:
+      return TraceRecordType::kCounter;
+    case Dart_Timeline_Event_Async_Begin:
+      return TraceRecordType::kAsyncBegin;
+    case Dart_Timeline_Event_Async_End:
+      return TraceRecordType::kAsyncEnd;
+    case Dart_Timeline_Event_Flow_Begin:
+      return TraceRecordType::kFlowBegin;
+    case Dart_Timeline_Event_Flow_Step:
+      return TraceRecordType::kFlowStep;
+    case Dart_Timeline_Event_Flow_End:
+      return TraceRecordType::kFlowEnd;
+    default:
+      return TraceRecordType::kInstant;
+  }
+}
+
+// Arguments are not representable in the fixed-width binary records and
+// are dropped.
+inline void RecordToRingBuffer(const char* label,
+                               Dart_Timeline_Event_Type type,
+                               int64_t id) {
+  if (TraceRingBufferIsEnabled()) {
+    TraceRingBufferRecord(label, ToTraceRecordType(type), id);
+  }
+}
+
+}  // namespace
+
 #if TIMELINE_ENABLED
 
 namespace {
@@ -33,6 +71,7 @@ inline void FlutterTimelineEvent(const char* label,
                                  intptr_t argument_count,
                                  const char** argument_names,
                                  const char** argument_values) {
+  RecordToRingBuffer(label, type, timestamp1_or_async_id);
   if (gWhitelist.Query(label)) {
     Dart_TimelineEvent(label, timestamp0, timestamp1_or_async_id, type,
                        argument_count, argument_names, argument_values);
@@ -295,7 +334,8 @@ void TraceEventFlowEnd0(TraceArg category_group, TraceArg name, TraceIDArg id) {
 void TraceSetWhitelist(const std::vector<std::string>& whitelist) {}
 
 size_t TraceNonce() {
-  return 0;
+  static std::atomic_size_t gLastItem;
+  return ++gLastItem;
 }
 
 void TraceTimelineEvent(TraceArg category_group,
@@ -304,30 +344,42 @@ void TraceTimelineEvent(TraceArg category_group,
                         TraceIDArg identifier,
                         Dart_Timeline_Event_Type type,
                         const std::vector<const char*>& c_names,
-                        const std::vector<std::string>& values) {}
+                        const std::vector<std::string>& values) {
+  RecordToRingBuffer(name, type, identifier);
+}
 
 void TraceTimelineEvent(TraceArg category_group,
                         TraceArg name,
                         TraceIDArg identifier,
                         Dart_Timeline_Event_Type type,
                         const std::vector<const char*>& c_names,
-                        const std::vector<std::string>& values) {}
+                        const std::vector<std::string>& values) {
+  RecordToRingBuffer(name, type, identifier);
+}
 
-void TraceEvent0(TraceArg category_group, TraceArg name) {}
+void TraceEvent0(TraceArg category_group, TraceArg name) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Begin, 0);
+}
 
 void TraceEvent1(TraceArg category_group,
                  TraceArg name,
                  TraceArg arg1_name,
-                 TraceArg arg1_val) {}
+                 TraceArg arg1_val) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Begin, 0);
+}
 
 void TraceEvent2(TraceArg category_group,
                  TraceArg name,
                  TraceArg arg1_name,
                  TraceArg arg1_val,
                  TraceArg arg2_name,
-                 TraceArg arg2_val) {}
+                 TraceArg arg2_val) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Begin, 0);
+}
 
-void TraceEventEnd(TraceArg name) {}
+void TraceEventEnd(TraceArg name) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_End, 0);
+}
 
 void TraceEventAsyncComplete(TraceArg category_group,
                              TraceArg name,
@@ -336,47 +388,66 @@ void TraceEventAsyncComplete(TraceArg category_group,
 
 void TraceEventAsyncBegin0(TraceArg category_group,
                            TraceArg name,
-                           TraceIDArg id) {}
+                           TraceIDArg id) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Async_Begin, id);
+}
 
 void TraceEventAsyncEnd0(TraceArg category_group,
                          TraceArg name,
-                         TraceIDArg id) {}
+                         TraceIDArg id) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Async_End, id);
+}
 
 void TraceEventAsyncBegin1(TraceArg category_group,
                            TraceArg name,
                            TraceIDArg id,
                            TraceArg arg1_name,
-                           TraceArg arg1_val) {}
+                           TraceArg arg1_val) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Async_Begin, id);
+}
 
 void TraceEventAsyncEnd1(TraceArg category_group,
                          TraceArg name,
                          TraceIDArg id,
                          TraceArg arg1_name,
-                         TraceArg arg1_val) {}
+                         TraceArg arg1_val) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Async_End, id);
+}
 
-void TraceEventInstant0(TraceArg category_group, TraceArg name) {}
+void TraceEventInstant0(TraceArg category_group, TraceArg name) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Instant, 0);
+}
 
 void TraceEventInstant1(TraceArg category_group,
                         TraceArg name,
                         TraceArg arg1_name,
-                        TraceArg arg1_val) {}
+                        TraceArg arg1_val) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Instant, 0);
+}
 
 void TraceEventInstant2(TraceArg category_group,
                         TraceArg name,
                         TraceArg arg1_name,
                         TraceArg arg1_val,
                         TraceArg arg2_name,
-                        TraceArg arg2_val) {}
+                        TraceArg arg2_val) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Instant, 0);
+}
 
 void TraceEventFlowBegin0(TraceArg category_group,
                           TraceArg name,
-                          TraceIDArg id) {}
+                          TraceIDArg id) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Flow_Begin, id);
+}
 
 void TraceEventFlowStep0(TraceArg category_group,
                          TraceArg name,
-                         TraceIDArg id) {}
+                         TraceIDArg id) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Flow_Step, id);
+}
 
 void TraceEventFlowEnd0(TraceArg category_group, TraceArg name, TraceIDArg id) {
+  RecordToRingBuffer(name, Dart_Timeline_Event_Flow_End, id);
 }
 
 #endif  // TIMELINE_ENABLED
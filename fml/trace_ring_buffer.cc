@@ -0,0 +1,121 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_ring_buffer.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+#include "flutter/fml/time/time_point.h"
+
+namespace fml {
+namespace tracing {
+
+namespace {
+
+std::atomic_bool gRingBufferEnabled = {false};
+
+// Keeps every thread's buffer alive (and drainable) past thread exit. The
+// mutex is only taken when a thread records for the first time or when the
+// buffers are collected, never on the record fast path.
+std::mutex& RegistryMutex() {
+  static std::mutex* mutex = new std::mutex();
+  return *mutex;
+}
+
+std::vector<std::shared_ptr<TraceRingBuffer>>& Registry() {
+  static auto* registry = new std::vector<std::shared_ptr<TraceRingBuffer>>();
+  return *registry;
+}
+
+TraceRingBuffer* ThreadLocalBuffer() {
+  static thread_local std::shared_ptr<TraceRingBuffer> buffer;
+  if (!buffer) {
+    buffer = std::make_shared<TraceRingBuffer>();
+    std::scoped_lock lock(RegistryMutex());
+    Registry().push_back(buffer);
+  }
+  return buffer.get();
+}
+
+}  // namespace
+
+TraceRingBuffer::TraceRingBuffer() = default;
+
+TraceRingBuffer::~TraceRingBuffer() = default;
+
+void TraceRingBuffer::Record(const char* label,
+                             TraceRecordType type,
+                             int64_t id) {
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  TraceRecord& record = records_[head % kCapacity];
+  record.label = label;
+  record.timestamp_micros =
+      fml::TimePoint::Now().ToEpochDelta().ToMicroseconds();
+  record.id = id;
+  record.type = type;
+  head_.store(head + 1, std::memory_order_release);
+}
+
+std::vector<TraceRecord> TraceRingBuffer::Snapshot() const {
+  const uint64_t head_before = head_.load(std::memory_order_acquire);
+  const uint64_t available = std::min<uint64_t>(head_before, kCapacity);
+  const uint64_t start = head_before - available;
+
+  std::vector<TraceRecord> records;
+  records.reserve(available);
+  for (uint64_t i = start; i < head_before; i++) {
+    records.push_back(records_[i % kCapacity]);
+  }
+
+  // Discard any records the writer may have overwritten while the copy was
+  // in progress.
+  const uint64_t head_after = head_.load(std::memory_order_acquire);
+  const uint64_t overwritten_below =
+      head_after > kCapacity ? head_after - kCapacity : 0;
+  if (overwritten_below > start) {
+    const uint64_t torn =
+        std::min<uint64_t>(overwritten_below - start, records.size());
+    records.erase(records.begin(), records.begin() + torn);
+  }
+  return records;
+}
+
+void TraceRingBufferSetEnabled(bool enabled) {
+  gRingBufferEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool TraceRingBufferIsEnabled() {
+  return gRingBufferEnabled.load(std::memory_order_relaxed);
+}
+
+void TraceRingBufferRecord(const char* label,
+                           TraceRecordType type,
+                           int64_t id) {
+  ThreadLocalBuffer()->Record(label, type, id);
+}
+
+std::vector<TraceRecord> TraceRingBufferCollect() {
+  std::vector<std::shared_ptr<TraceRingBuffer>> buffers;
+  {
+    std::scoped_lock lock(RegistryMutex());
+    buffers = Registry();
+  }
+
+  std::vector<TraceRecord> records;
+  for (const auto& buffer : buffers) {
+    auto snapshot = buffer->Snapshot();
+    records.insert(records.end(), snapshot.begin(), snapshot.end());
+  }
+
+  std::sort(records.begin(), records.end(),
+            [](const TraceRecord& a, const TraceRecord& b) {
+              return a.timestamp_micros < b.timestamp_micros;
+            });
+  return records;
+}
+
+}  // namespace tracing
+}  // namespace fml
@@ -0,0 +1,91 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FML_TRACE_RING_BUFFER_H_
+#define FLUTTER_FML_TRACE_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace fml {
+namespace tracing {
+
+// The kind of a binary trace record. Mirrors the subset of timeline event
+// types that can be represented without heap-allocated argument strings.
+enum class TraceRecordType : uint8_t {
+  kBegin,
+  kEnd,
+  kInstant,
+  kAsyncBegin,
+  kAsyncEnd,
+  kFlowBegin,
+  kFlowStep,
+  kFlowEnd,
+  kCounter,
+};
+
+// A compact, fixed-width trace record. Labels passed to the trace macros
+// are string literals, so only the pointer is stored; no strings are copied
+// on the hot path.
+struct TraceRecord {
+  const char* label;
+  int64_t timestamp_micros;
+  int64_t id;
+  TraceRecordType type;
+};
+
+// A fixed-size binary ring buffer of trace records written by exactly one
+// thread. Writes are wait-free: a record is filled in place and the head
+// counter is published with a release store. Readers snapshot the buffer
+// from any thread and discard records that may have been overwritten while
+// the snapshot was taken. The oldest records are overwritten once the
+// buffer wraps.
+class TraceRingBuffer {
+ public:
+  static constexpr size_t kCapacity = 4096;
+
+  TraceRingBuffer();
+
+  ~TraceRingBuffer();
+
+  // Must only be called by the owning thread.
+  void Record(const char* label, TraceRecordType type, int64_t id);
+
+  // Copies the records currently in the buffer, oldest first. Safe to call
+  // from any thread while the owning thread keeps writing.
+  std::vector<TraceRecord> Snapshot() const;
+
+ private:
+  TraceRecord records_[kCapacity];
+  std::atomic<uint64_t> head_ = {0};
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TraceRingBuffer);
+};
+
+// Enables or disables recording of trace events into per-thread ring
+// buffers. Disabled by default. In release builds, where the Dart timeline
+// is compiled out, this is the only trace backend; in other builds records
+// are captured in addition to the timeline.
+void TraceRingBufferSetEnabled(bool enabled);
+
+bool TraceRingBufferIsEnabled();
+
+// Records into the calling thread's ring buffer, creating and registering
+// it on first use. Must only be called while recording is enabled.
+void TraceRingBufferRecord(const char* label,
+                           TraceRecordType type,
+                           int64_t id);
+
+// Snapshots the ring buffers of every thread that has recorded so far and
+// returns the records sorted by timestamp.
+std::vector<TraceRecord> TraceRingBufferCollect();
+
+}  // namespace tracing
+}  // namespace fml
+
+#endif  // FLUTTER_FML_TRACE_RING_BUFFER_H_
@@ -0,0 +1,62 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_ring_buffer.h"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace tracing {
+
+TEST(TraceRingBuffer, RecordsAndSnapshots) {
+  TraceRingBuffer buffer;
+  buffer.Record("a", TraceRecordType::kBegin, 0);
+  buffer.Record("a", TraceRecordType::kEnd, 0);
+
+  auto records = buffer.Snapshot();
+  ASSERT_EQ(records.size(), 2u);
+  ASSERT_STREQ(records[0].label, "a");
+  ASSERT_EQ(records[0].type, TraceRecordType::kBegin);
+  ASSERT_EQ(records[1].type, TraceRecordType::kEnd);
+  ASSERT_LE(records[0].timestamp_micros, records[1].timestamp_micros);
+}
+
+TEST(TraceRingBuffer, OverwritesOldestRecordsWhenFull) {
+  TraceRingBuffer buffer;
+  for (size_t i = 0; i < TraceRingBuffer::kCapacity + 10; i++) {
+    buffer.Record("event", TraceRecordType::kInstant, static_cast<int64_t>(i));
+  }
+
+  auto records = buffer.Snapshot();
+  ASSERT_EQ(records.size(), TraceRingBuffer::kCapacity);
+  // The 10 oldest records must have been overwritten.
+  ASSERT_EQ(records.front().id, 10);
+  ASSERT_EQ(records.back().id,
+            static_cast<int64_t>(TraceRingBuffer::kCapacity) + 9);
+}
+
+TEST(TraceRingBuffer, CollectGathersRecordsFromMultipleThreads) {
+  TraceRingBufferSetEnabled(true);
+  std::thread thread1(
+      []() { TraceRingBufferRecord("thread1", TraceRecordType::kInstant, 1); });
+  std::thread thread2(
+      []() { TraceRingBufferRecord("thread2", TraceRecordType::kInstant, 2); });
+  thread1.join();
+  thread2.join();
+  TraceRingBufferSetEnabled(false);
+
+  auto records = TraceRingBufferCollect();
+  size_t matches = 0;
+  for (const auto& record : records) {
+    if (record.id == 1 || record.id == 2) {
+      matches++;
+    }
+  }
+  ASSERT_GE(matches, 2u);
+}
+
+}  // namespace tracing
+}  // namespace fml
@@ -8,8 +8,10 @@
 #include <stdint.h>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
+#include "flutter/flow/frame_arena.h"
 #include "flutter/flow/layers/container_layer.h"
 #include "flutter/lib/ui/compositing/scene.h"
 #include "flutter/lib/ui/dart_wrapper.h"
@@ -50,7 +52,7 @@ class SceneBuilder : public RefCountedDartWrappable<SceneBuilder> {
                      const RRect& rrect,
                      int clipBehavior);
   void pushClipPath(Dart_Handle layer_handle,
-                    const CanvasPath* path,
+                    CanvasPath* path,
                     int clipBehavior);
   void pushOpacity(Dart_Handle layer_handle,
                    int alpha,
@@ -69,7 +71,7 @@ class SceneBuilder : public RefCountedDartWrappable<SceneBuilder> {
                       double maskRectBottom,
                       int blendMode);
   void pushPhysicalShape(Dart_Handle layer_handle,
-                         const CanvasPath* path,
+                         CanvasPath* path,
                          double elevation,
                          int color,
                          int shadowColor,
@@ -124,6 +126,17 @@ class SceneBuilder : public RefCountedDartWrappable<SceneBuilder> {
   void PushLayer(std::shared_ptr<ContainerLayer> layer);
   void PopLayer();
 
+  // Allocates a layer out of the per-frame arena. The arena is kept alive by
+  // every layer allocated from it, so layers the framework retains across
+  // frames (via |EngineLayer|) stay valid; in the common case the memory is
+  // released wholesale once the built scene retires after rasterization.
+  template <typename T, typename... Args>
+  std::shared_ptr<T> MakeLayer(Args&&... args) {
+    return std::allocate_shared<T>(FrameArenaAllocator<T>(arena_),
+                                   std::forward<Args>(args)...);
+  }
+
+  std::shared_ptr<FrameArena> arena_ = std::make_shared<FrameArena>();
   std::vector<std::shared_ptr<ContainerLayer>> layer_stack_;
   int rasterizer_tracing_threshold_ = 0;
   bool checkerboard_raster_cache_images_ = false;
@@ -16,6 +16,7 @@
 #include "flutter/lib/ui/painting/frame_info.h"
 #include "flutter/lib/ui/painting/gradient.h"
 #include "flutter/lib/ui/painting/image.h"
+#include "flutter/lib/ui/painting/image_descriptor.h"
 #include "flutter/lib/ui/painting/image_filter.h"
 #include "flutter/lib/ui/painting/image_shader.h"
 #include "flutter/lib/ui/painting/path.h"
@@ -69,6 +70,7 @@ void DartUI::InitForGlobal() {
     EngineLayer::RegisterNatives(g_natives);
     FontCollection::RegisterNatives(g_natives);
     FrameInfo::RegisterNatives(g_natives);
+    ImageDescriptor::RegisterNatives(g_natives);
     ImageFilter::RegisterNatives(g_natives);
     ImageShader::RegisterNatives(g_natives);
     IsolateNameServerNatives::RegisterNatives(g_natives);
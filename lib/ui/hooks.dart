@@ -211,10 +211,14 @@ void _beginFrame(int/*!*/ microseconds) {
 @pragma('vm:entry-point')
 // ignore: unused_element
 void _reportTimings(List<int/*!*/>/*!*/ timings) {
-  assert(timings.length % FramePhase.values.length == 0);
+  // Each frame record holds one timestamp per phase followed by the GPU
+  // duration. Must be kept in sync with FrameTiming::kStatisticsCount in
+  // common/settings.h.
+  const int recordLength = FramePhase.values.length + 1;
+  assert(timings.length % recordLength == 0);
   final List<FrameTiming> frameTimings = <FrameTiming>[];
-  for (int i = 0; i < timings.length; i += FramePhase.values.length) {
-    frameTimings.add(FrameTiming(timings.sublist(i, i + FramePhase.values.length)));
+  for (int i = 0; i < timings.length; i += recordLength) {
+    frameTimings.add(FrameTiming(timings.sublist(i, i + recordLength)));
   }
   _invoke1(window.onReportTimings, window._onReportTimingsZone, frameTimings);
 }
@@ -11,6 +11,10 @@
 #include "third_party/skia/include/gpu/GrContext.h"
 
 namespace flutter {
+
+class DecodedFrameCache;
+class DecodedImageCache;
+
 // Interface for methods that manage access to the resource GrContext and Skia
 // unref queue.  Meant to be implemented by the owner of the resource GrContext,
 // i.e. the shell's IOManager.
@@ -25,6 +29,14 @@ class IOManager {
   virtual fml::RefPtr<flutter::SkiaUnrefQueue> GetSkiaUnrefQueue() const = 0;
 
   virtual std::shared_ptr<fml::SyncSwitch> GetIsGpuDisabledSyncSwitch() = 0;
+
+  // The cache of decoded animation frames shared by all multi-frame codecs
+  // attached to this IO manager.
+  virtual std::shared_ptr<DecodedFrameCache> GetDecodedFrameCache() = 0;
+
+  // The cache of decoded still images, keyed by content hash, shared by all
+  // image decoders attached to this IO manager.
+  virtual std::shared_ptr<DecodedImageCache> GetDecodedImageCache() = 0;
 };
 
 }  // namespace flutter
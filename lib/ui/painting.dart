@@ -1611,18 +1611,34 @@ class Image extends NativeFieldWrapperClass2 {
   /// The [format] argument specifies the format in which the bytes will be
   /// returned.
   ///
+  /// If [onProgress] is provided, it is invoked with values from 0.0 to 1.0
+  /// while the image is being compressed. Progress is only reported
+  /// incrementally for compressed formats such as [ImageByteFormat.png];
+  /// uncompressed formats complete in a single step.
+  ///
+  /// If [cancellationToken] is provided, calling
+  /// [ImageEncodeCancellationToken.cancel] on it abandons the encode and the
+  /// returned future completes with an error.
+  ///
   /// Returns a future that completes with the binary image data or an error
-  /// if encoding fails.
-  Future<ByteData> toByteData({ImageByteFormat format = ImageByteFormat.rawRgba}) {
+  /// if encoding fails or is canceled.
+  Future<ByteData> toByteData({ImageByteFormat format = ImageByteFormat.rawRgba,
+                               ImageEncodeProgressCallback onProgress,
+                               ImageEncodeCancellationToken cancellationToken}) {
     return _futurize((_Callback<ByteData> callback) {
       return _toByteData(format.index, (Uint8List encoded) {
         callback(encoded?.buffer?.asByteData());
-      });
+      }, onProgress == null ? null : (double progress) {
+        onProgress(progress);
+      }, cancellationToken?._id ?? 0);
     });
   }
 
   /// Returns an error message on failure, null on success.
-  String _toByteData(int format, _Callback<Uint8List> callback) native 'Image_toByteData';
+  String _toByteData(int format, _Callback<Uint8List> callback,
+      _Callback<double> onProgress, int encodeId) native 'Image_toByteData';
+
+  static void _cancelEncode(int encodeId) native 'Image_cancelEncode';
 
   /// Release the resources used by this object. The object is no longer usable
   /// after this method is called.
@@ -1632,6 +1648,40 @@ class Image extends NativeFieldWrapperClass2 {
   String toString() => '[$width\u00D7$height]';
 }
 
+/// Signature of callbacks that report the progress of an [Image.toByteData]
+/// call as a value from 0.0 to 1.0.
+typedef ImageEncodeProgressCallback = void Function(double progress);
+
+/// A handle that can cancel an in-flight [Image.toByteData] call.
+///
+/// Pass a token to [Image.toByteData] and call [cancel] to stop the encode
+/// before it finishes, for example when the user navigates away from an
+/// export flow. Each token may only be used with a single [Image.toByteData]
+/// call.
+class ImageEncodeCancellationToken {
+  static int _nextId = 1;
+
+  final int _id = _nextId++;
+
+  bool _canceled = false;
+
+  /// Whether [cancel] has been called on this token.
+  bool get isCanceled => _canceled;
+
+  /// Requests that the encode associated with this token stop as soon as
+  /// possible.
+  ///
+  /// The future returned by the associated [Image.toByteData] call completes
+  /// with an error. Calling this after the encode has completed has no
+  /// effect.
+  void cancel() {
+    if (!_canceled) {
+      _canceled = true;
+      Image._cancelEncode(_id);
+    }
+  }
+}
+
 /// Callback signature for [decodeImageFromList].
 typedef ImageDecoderCallback = void Function(Image result);
 
@@ -1713,14 +1763,18 @@ class Codec extends NativeFieldWrapperClass2 {
 /// is specified, the omitted dimension will remain its original size. If both are
 /// not specified, then the image maintains its real size.
 ///
+/// If [prefetch] is true, the decode is speculative: it is queued at a lower
+/// priority so that decodes for images that are already visible run first.
+///
 /// The returned future can complete with an error if the image decoding has
 /// failed.
 Future<Codec> instantiateImageCodec(Uint8List list, {
   int targetWidth,
   int targetHeight,
+  bool prefetch = false,
 }) {
   return _futurize(
-    (_Callback<Codec> callback) => _instantiateImageCodec(list, callback, null, targetWidth ?? _kDoNotResizeDimension, targetHeight ?? _kDoNotResizeDimension)
+    (_Callback<Codec> callback) => _instantiateImageCodec(list, callback, null, targetWidth ?? _kDoNotResizeDimension, targetHeight ?? _kDoNotResizeDimension, prefetch)
   );
 }
 
@@ -1735,7 +1789,7 @@ Future<Codec> instantiateImageCodec(Uint8List list, {
 /// If both are equal to [_kDoNotResizeDimension], then the image maintains its real size.
 ///
 /// Returns an error message if the instantiation has failed, null otherwise.
-String _instantiateImageCodec(Uint8List list, _Callback<Codec> callback, _ImageInfo imageInfo, int targetWidth, int targetHeight)
+String _instantiateImageCodec(Uint8List list, _Callback<Codec> callback, _ImageInfo imageInfo, int targetWidth, int targetHeight, bool prefetch)
   native 'instantiateImageCodec';
 
 /// Loads a single image frame from a byte array into an [Image] object.
@@ -1777,12 +1831,69 @@ void decodeImageFromPixels(
 ) {
   final _ImageInfo imageInfo = _ImageInfo(width, height, format.index, rowBytes);
   final Future<Codec> codecFuture = _futurize(
-    (_Callback<Codec> callback) => _instantiateImageCodec(pixels, callback, imageInfo, targetWidth ?? _kDoNotResizeDimension, targetHeight ?? _kDoNotResizeDimension)
+    (_Callback<Codec> callback) => _instantiateImageCodec(pixels, callback, imageInfo, targetWidth ?? _kDoNotResizeDimension, targetHeight ?? _kDoNotResizeDimension, false)
   );
   codecFuture.then((Codec codec) => codec.getNextFrame())
       .then((FrameInfo frameInfo) => callback(frameInfo.image));
 }
 
+/// A descriptor of an encoded image whose container has been parsed once.
+///
+/// Construction sniffs the image format and reads the container headers,
+/// after which the dimensions and frame count are available without decoding
+/// any pixels. Multiple codecs at different target sizes can be instantiated
+/// from the retained encoded bytes without re-parsing, which makes this the
+/// preferred entry point when the same image is decoded more than once (for
+/// example at a placeholder size and again at its final size).
+class ImageDescriptor extends NativeFieldWrapperClass2 {
+  /// Parses the encoded image in [list].
+  ///
+  /// Throws an exception if the bytes cannot be identified as an image.
+  ImageDescriptor.encoded(Uint8List list) {
+    final String error = _initEncoded(list);
+    if (error != null)
+      throw Exception(error);
+  }
+  String _initEncoded(Uint8List list) native 'ImageDescriptor_initEncoded';
+
+  /// The intrinsic width of the image, in pixels.
+  int get width native 'ImageDescriptor_width';
+
+  /// The intrinsic height of the image, in pixels.
+  int get height native 'ImageDescriptor_height';
+
+  /// The number of frames in the image.
+  int get frameCount native 'ImageDescriptor_frameCount';
+
+  /// Creates a [Codec] decoding this image at the given target dimensions.
+  ///
+  /// The arguments have the same meaning as on [instantiateImageCodec], but
+  /// no container parsing takes place: still images go straight to the
+  /// decoder with the retained bytes. May be called any number of times with
+  /// different target sizes.
+  Codec instantiateCodec({
+    int targetWidth,
+    int targetHeight,
+    bool prefetch = false,
+  }) {
+    final Codec codec = _instantiateCodec(
+        targetWidth ?? _kDoNotResizeDimension,
+        targetHeight ?? _kDoNotResizeDimension,
+        prefetch);
+    if (codec == null)
+      throw Exception('Could not instantiate codec.');
+    return codec;
+  }
+  Codec _instantiateCodec(int targetWidth, int targetHeight, bool prefetch)
+      native 'ImageDescriptor_instantiateCodec';
+
+  /// Releases the retained encoded bytes.
+  ///
+  /// The descriptor is unusable afterwards; codecs already instantiated from
+  /// it keep their own reference to the bytes and are unaffected.
+  void dispose() native 'ImageDescriptor_dispose';
+}
+
 /// Determines the winding rule that decides how the interior of a [Path] is
 /// calculated.
 ///
@@ -3296,6 +3407,44 @@ class Vertices extends NativeFieldWrapperClass2 {
              Float32List textureCoordinates,
              Int32List colors,
              Uint16List indices) native 'Vertices_init';
+
+  /// Overwrites a contiguous range of vertices with new attribute values,
+  /// using the encoding methods of [new Vertices.raw].
+  ///
+  /// The range starts at the vertex with index [startVertex] and covers one
+  /// vertex for every pair of x,y coordinates in [positions]; it must lie
+  /// within the mesh. Only the changed range is transferred to the engine,
+  /// which makes per-frame updates of a small part of a large mesh much
+  /// cheaper than constructing a new [Vertices] object.
+  ///
+  /// The [textureCoordinates] and [colors] parameters may only be provided
+  /// if the mesh was constructed with texture coordinates or colors
+  /// respectively, and must describe the same range as [positions]. The
+  /// topology of the mesh ([VertexMode], vertex count and indices) cannot be
+  /// changed by an update.
+  void update(
+    int startVertex,
+    Float32List positions, {
+    Float32List textureCoordinates,
+    Int32List colors,
+  }) {
+    assert(startVertex != null);
+    assert(positions != null);
+    if (positions.length.isOdd)
+      throw ArgumentError('"positions" must contain pairs of x,y coordinates.');
+    if (textureCoordinates != null && textureCoordinates.length != positions.length)
+      throw ArgumentError('"positions" and "textureCoordinates" lengths must match.');
+    if (colors != null && colors.length * 2 != positions.length)
+      throw ArgumentError('"positions" and "colors" lengths must match.');
+
+    if (!_update(startVertex, positions, textureCoordinates, colors))
+      throw ArgumentError('Invalid update for vertices.');
+  }
+
+  bool _update(int startVertex,
+               Float32List positions,
+               Float32List textureCoordinates,
+               Int32List colors) native 'Vertices_update';
 }
 
 /// Defines how a list of points is interpreted when drawing a set of points.
@@ -175,14 +175,14 @@ void Canvas::clipRRect(const RRect& rrect, bool doAntiAlias) {
   canvas_->clipRRect(rrect.sk_rrect, doAntiAlias);
 }
 
-void Canvas::clipPath(const CanvasPath* path, bool doAntiAlias) {
+void Canvas::clipPath(CanvasPath* path, bool doAntiAlias) {
   if (!canvas_)
     return;
   if (!path)
     Dart_ThrowException(
         ToDart("Canvas.clipPath called with non-genuine Path."));
   external_allocation_size_ += path->path().approximateBytesUsed();
-  canvas_->clipPath(path->path(), doAntiAlias);
+  canvas_->clipPath(path->GetPathForDraw(), doAntiAlias);
 }
 
 void Canvas::drawColor(SkColor color, SkBlendMode blend_mode) {
@@ -273,7 +273,7 @@ void Canvas::drawArc(double left,
                    useCenter, *paint.paint());
 }
 
-void Canvas::drawPath(const CanvasPath* path,
+void Canvas::drawPath(CanvasPath* path,
                       const Paint& paint,
                       const PaintData& paint_data) {
   if (!canvas_)
@@ -282,7 +282,7 @@ void Canvas::drawPath(const CanvasPath* path,
     Dart_ThrowException(
         ToDart("Canvas.drawPath called with non-genuine Path."));
   external_allocation_size_ += path->path().approximateBytesUsed();
-  canvas_->drawPath(path->path(), *paint.paint());
+  canvas_->drawPath(path->GetPathForDraw(), *paint.paint());
 }
 
 void Canvas::drawImage(const CanvasImage* image,
@@ -418,7 +418,7 @@ void Canvas::drawAtlas(const Paint& paint,
       paint.paint());
 }
 
-void Canvas::drawShadow(const CanvasPath* path,
+void Canvas::drawShadow(CanvasPath* path,
                         SkColor color,
                         double elevation,
                         bool transparentOccluder) {
@@ -428,7 +428,8 @@ void Canvas::drawShadow(const CanvasPath* path,
   SkScalar dpr =
       UIDartState::Current()->window()->viewport_metrics().device_pixel_ratio;
   external_allocation_size_ += path->path().approximateBytesUsed();
-  flutter::PhysicalShapeLayer::DrawShadow(canvas_, path->path(), color,
+  flutter::PhysicalShapeLayer::DrawShadow(canvas_,
+                                          path->GetPathForDraw(), color,
                                           elevation, transparentOccluder, dpr);
 }
 
@@ -60,7 +60,7 @@ class Canvas : public RefCountedDartWrappable<Canvas> {
                 SkClipOp clipOp,
                 bool doAntiAlias = true);
   void clipRRect(const RRect& rrect, bool doAntiAlias = true);
-  void clipPath(const CanvasPath* path, bool doAntiAlias = true);
+  void clipPath(CanvasPath* path, bool doAntiAlias = true);
 
   void drawColor(SkColor color, SkBlendMode blend_mode);
   void drawLine(double x1,
@@ -103,7 +103,7 @@ class Canvas : public RefCountedDartWrappable<Canvas> {
                bool useCenter,
                const Paint& paint,
                const PaintData& paint_data);
-  void drawPath(const CanvasPath* path,
+  void drawPath(CanvasPath* path,
                 const Paint& paint,
                 const PaintData& paint_data);
   void drawImage(const CanvasImage* image,
@@ -159,7 +159,7 @@ class Canvas : public RefCountedDartWrappable<Canvas> {
                  SkBlendMode blend_mode,
                  const tonic::Float32List& cull_rect);
 
-  void drawShadow(const CanvasPath* path,
+  void drawShadow(CanvasPath* path,
                   SkColor color,
                   double elevation,
                   bool transparentOccluder);
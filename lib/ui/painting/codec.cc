@@ -10,6 +10,7 @@
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/painting/codec_registry.h"
 #include "flutter/lib/ui/painting/frame_info.h"
 #include "flutter/lib/ui/painting/multi_frame_codec.h"
 #include "flutter/lib/ui/painting/single_frame_codec.h"
@@ -39,6 +40,8 @@ enum PixelFormat {
   kBGRA8888,
 };
 
+}  // anonymous namespace
+
 #if OS_ANDROID
 
 // Compressed image buffers are allocated on the UI thread but are deleted on a
@@ -82,8 +85,6 @@ sk_sp<SkData> MakeSkDataWithCopy(const void* data, size_t length) {
 
 #endif  // OS_ANDROID
 
-}  // anonymous namespace
-
 static std::variant<ImageDecoder::ImageInfo, std::string> ConvertImageInfo(
     Dart_Handle image_info_handle,
     Dart_NativeArguments args) {
@@ -195,11 +196,19 @@ static void InstantiateImageCodec(Dart_NativeArguments args) {
       tonic::DartConverter<int>::FromDart(Dart_GetNativeArgument(args, 3));
   const int targetHeight =
       tonic::DartConverter<int>::FromDart(Dart_GetNativeArgument(args, 4));
+  const bool prefetch =
+      tonic::DartConverter<bool>::FromDart(Dart_GetNativeArgument(args, 5));
 
   std::unique_ptr<SkCodec> codec;
   bool single_frame;
   if (image_info) {
     single_frame = true;
+  } else if (ImageFormatIsAlwaysSingleFrame(DetectImageFormat(*buffer))) {
+    // Formats that cannot animate never need an SkCodec here: the frame
+    // count is known and |SingleFrameCodec| decodes from the descriptor.
+    // Buffers with a valid signature but a corrupt stream are caught at
+    // decode time instead, matching the decompressed-image-info path.
+    single_frame = true;
   } else {
     codec = SkCodec::MakeFromData(buffer);
     if (!codec) {
@@ -222,6 +231,7 @@ static void InstantiateImageCodec(Dart_NativeArguments args) {
       descriptor.target_height = targetHeight;
     }
     descriptor.data = std::move(buffer);
+    descriptor.is_prefetch = prefetch;
 
     ui_codec = fml::MakeRefCounted<SingleFrameCodec>(std::move(descriptor));
   } else {
@@ -247,7 +257,7 @@ void Codec::dispose() {
 
 void Codec::RegisterNatives(tonic::DartLibraryNatives* natives) {
   natives->Register({
-      {"instantiateImageCodec", InstantiateImageCodec, 5, true},
+      {"instantiateImageCodec", InstantiateImageCodec, 6, true},
   });
   natives->Register({FOR_EACH_BINDING(DART_REGISTER_NATIVE)});
 }
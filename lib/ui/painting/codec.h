@@ -9,6 +9,7 @@
 #include "flutter/lib/ui/painting/frame_info.h"
 #include "third_party/skia/include/codec/SkCodec.h"
 #include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
 
 using tonic::DartPersistentValue;
@@ -19,6 +20,12 @@ class DartLibraryNatives;
 
 namespace flutter {
 
+// Copies |data| into an SkData suitable for handoff to the decoder worker
+// threads. On Android the copy is backed by an anonymous mapping so freeing
+// it from a different thread than the one that allocated it does not grow
+// the native heap.
+sk_sp<SkData> MakeSkDataWithCopy(const void* data, size_t length);
+
 // A handle to an SkCodec object.
 //
 // Doesn't mirror SkCodec's API but provides a simple sequential access API.
@@ -32,7 +39,9 @@ class Codec : public RefCountedDartWrappable<Codec> {
 
   virtual Dart_Handle getNextFrame(Dart_Handle callback_handle) = 0;
 
-  void dispose();
+  // Subclasses may override to abandon in-flight work; they must call the
+  // base implementation to release the Dart wrapper.
+  virtual void dispose();
 
   static void RegisterNatives(tonic::DartLibraryNatives* natives);
 };
@@ -0,0 +1,131 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/codec_registry.h"
+
+#include <cstring>
+
+namespace flutter {
+namespace {
+
+bool MatchesMagic(const SkData& data,
+                  size_t offset,
+                  const char* magic,
+                  size_t length) {
+  if (data.size() < offset + length) {
+    return false;
+  }
+  return ::memcmp(data.bytes() + offset, magic, length) == 0;
+}
+
+}  // namespace
+
+ImageFormat DetectImageFormat(const SkData& data) {
+  if (MatchesMagic(data, 0, "\xFF\xD8\xFF", 3)) {
+    return ImageFormat::kJPEG;
+  }
+  if (MatchesMagic(data, 0, "\x89PNG\r\n\x1A\n", 8)) {
+    return ImageFormat::kPNG;
+  }
+  if (MatchesMagic(data, 0, "GIF87a", 6) ||
+      MatchesMagic(data, 0, "GIF89a", 6)) {
+    return ImageFormat::kGIF;
+  }
+  if (MatchesMagic(data, 0, "RIFF", 4) && MatchesMagic(data, 8, "WEBP", 4)) {
+    return ImageFormat::kWebP;
+  }
+  if (MatchesMagic(data, 0, "BM", 2)) {
+    return ImageFormat::kBMP;
+  }
+  if (MatchesMagic(data, 0, "\x00\x00\x01\x00", 4)) {
+    return ImageFormat::kICO;
+  }
+  return ImageFormat::kUnknown;
+}
+
+bool ImageFormatIsAlwaysSingleFrame(ImageFormat format) {
+  switch (format) {
+    case ImageFormat::kJPEG:
+    case ImageFormat::kPNG:
+    case ImageFormat::kBMP:
+      return true;
+    case ImageFormat::kGIF:
+    case ImageFormat::kWebP:
+    case ImageFormat::kICO:
+    case ImageFormat::kUnknown:
+      return false;
+  }
+  return false;
+}
+
+CodecRegistry& CodecRegistry::GetForProcess() {
+  // Deliberately leaked: decoder workers may race process teardown.
+  static CodecRegistry* registry = new CodecRegistry();
+  return *registry;
+}
+
+CodecRegistry::CodecRegistry() = default;
+
+CodecRegistry::~CodecRegistry() = default;
+
+void CodecRegistry::RegisterDecoder(ImageFormat format,
+                                    ExternalDecoder decoder,
+                                    size_t max_concurrent_decodes) {
+  if (!decoder || format == ImageFormat::kUnknown) {
+    return;
+  }
+  std::scoped_lock lock(mutex_);
+  auto& record = decoders_[format];
+  record.decoder = std::move(decoder);
+  record.max_concurrent_decodes = max_concurrent_decodes;
+}
+
+void CodecRegistry::UnregisterDecoder(ImageFormat format) {
+  std::scoped_lock lock(mutex_);
+  decoders_.erase(format);
+}
+
+bool CodecRegistry::HasDecoder(ImageFormat format) const {
+  std::scoped_lock lock(mutex_);
+  return decoders_.count(format) > 0;
+}
+
+sk_sp<SkImage> CodecRegistry::Decode(ImageFormat format,
+                                     sk_sp<SkData> data,
+                                     std::optional<uint32_t> target_width,
+                                     std::optional<uint32_t> target_height) {
+  ExternalDecoder decoder;
+  {
+    std::scoped_lock lock(mutex_);
+    auto found = decoders_.find(format);
+    if (found == decoders_.end()) {
+      return nullptr;
+    }
+    auto& record = found->second;
+    if (record.max_concurrent_decodes != 0 &&
+        record.active_decodes >= record.max_concurrent_decodes) {
+      // The backend is saturated. Fall back to the software path rather
+      // than queueing behind it; the worker is already on a decode thread.
+      return nullptr;
+    }
+    record.active_decodes++;
+    decoder = record.decoder;
+  }
+
+  // The backend is invoked outside the lock so concurrent decodes of other
+  // formats (and further decodes of this one, budget permitting) proceed.
+  auto image = decoder(std::move(data), target_width, target_height);
+
+  {
+    std::scoped_lock lock(mutex_);
+    auto found = decoders_.find(format);
+    if (found != decoders_.end() && found->second.active_decodes > 0) {
+      found->second.active_decodes--;
+    }
+  }
+
+  return image;
+}
+
+}  // namespace flutter
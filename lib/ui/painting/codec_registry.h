@@ -0,0 +1,102 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_CODEC_REGISTRY_H_
+#define FLUTTER_LIB_UI_PAINTING_CODEC_REGISTRY_H_
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkImage.h"
+
+namespace flutter {
+
+// Image container formats the engine can identify from their leading magic
+// bytes without constructing an SkCodec.
+enum class ImageFormat {
+  kUnknown,
+  kJPEG,
+  kPNG,
+  kGIF,
+  kWebP,
+  kBMP,
+  kICO,
+};
+
+// Identifies the container format of an encoded image buffer by its magic
+// bytes. Returns |ImageFormat::kUnknown| for buffers whose leading bytes do
+// not match any known format; such buffers may still be decodable by Skia
+// (e.g. WBMP has no reliable signature), so callers must treat kUnknown as
+// "probe inconclusive" rather than "invalid".
+ImageFormat DetectImageFormat(const SkData& data);
+
+// Returns true if every valid image in |format| contains exactly one frame.
+// Such images never need an SkCodec at instantiation time since the frame
+// count is known up front.
+bool ImageFormatIsAlwaysSingleFrame(ImageFormat format);
+
+// A process-wide registry of external (typically hardware accelerated) image
+// decoder backends, keyed by container format. Decodes dispatched through
+// |ImageDecoder::Decode| probe the buffer format and route to a registered
+// backend when one is available and within its concurrency budget; otherwise
+// they fall back to the Skia software path. Embedders register backends at
+// startup (for example, a platform JPEG decode unit).
+class CodecRegistry {
+ public:
+  // Decodes an encoded buffer to a CPU raster image at (or near) the
+  // requested target dimensions. Returns nullptr if the backend cannot
+  // decode this particular buffer, in which case the caller falls back to
+  // the software decoder. May be called concurrently from decoder workers.
+  using ExternalDecoder =
+      std::function<sk_sp<SkImage>(sk_sp<SkData> data,
+                                   std::optional<uint32_t> target_width,
+                                   std::optional<uint32_t> target_height)>;
+
+  static CodecRegistry& GetForProcess();
+
+  // Registers |decoder| as the backend for |format|, replacing any previous
+  // registration. |max_concurrent_decodes| bounds the number of decoder
+  // worker threads that may be inside the backend at once; requests beyond
+  // the budget fall back to the software path instead of queueing. Zero
+  // means unbounded.
+  void RegisterDecoder(ImageFormat format,
+                       ExternalDecoder decoder,
+                       size_t max_concurrent_decodes);
+
+  void UnregisterDecoder(ImageFormat format);
+
+  bool HasDecoder(ImageFormat format) const;
+
+  // Attempts to decode |data| through the backend registered for |format|.
+  // Returns nullptr if no backend is registered, the backend's concurrency
+  // budget is exhausted, or the backend declined the buffer.
+  sk_sp<SkImage> Decode(ImageFormat format,
+                        sk_sp<SkData> data,
+                        std::optional<uint32_t> target_width,
+                        std::optional<uint32_t> target_height);
+
+ private:
+  struct DecoderRecord {
+    ExternalDecoder decoder;
+    size_t max_concurrent_decodes = 0;
+    size_t active_decodes = 0;
+  };
+
+  CodecRegistry();
+
+  ~CodecRegistry();
+
+  mutable std::mutex mutex_;
+  std::map<ImageFormat, DecoderRecord> decoders_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(CodecRegistry);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_CODEC_REGISTRY_H_
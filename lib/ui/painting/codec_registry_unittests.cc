@@ -0,0 +1,117 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/codec_registry.h"
+
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<SkData> MakeData(std::initializer_list<uint8_t> bytes) {
+  return SkData::MakeWithCopy(std::data(bytes), bytes.size());
+}
+
+static sk_sp<SkImage> MakeTestImage() {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(4, 4);
+  bitmap.eraseColor(SK_ColorRED);
+  bitmap.setImmutable();
+  return SkImage::MakeFromBitmap(bitmap);
+}
+
+TEST(CodecRegistryTest, DetectsFormatsFromMagicBytes) {
+  ASSERT_EQ(DetectImageFormat(*MakeData({0xFF, 0xD8, 0xFF, 0xE0})),
+            ImageFormat::kJPEG);
+  ASSERT_EQ(DetectImageFormat(
+                *MakeData({0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'})),
+            ImageFormat::kPNG);
+  ASSERT_EQ(DetectImageFormat(*MakeData({'G', 'I', 'F', '8', '9', 'a'})),
+            ImageFormat::kGIF);
+  ASSERT_EQ(DetectImageFormat(*MakeData({'R', 'I', 'F', 'F', 0, 0, 0, 0,  //
+                                         'W', 'E', 'B', 'P'})),
+            ImageFormat::kWebP);
+  ASSERT_EQ(DetectImageFormat(*MakeData({'B', 'M', 0, 0})),
+            ImageFormat::kBMP);
+  ASSERT_EQ(DetectImageFormat(*MakeData({0x00, 0x00, 0x01, 0x00})),
+            ImageFormat::kICO);
+  ASSERT_EQ(DetectImageFormat(*MakeData({0xDE, 0xAD, 0xBE, 0xEF})),
+            ImageFormat::kUnknown);
+  // Truncated signatures must not match.
+  ASSERT_EQ(DetectImageFormat(*MakeData({0xFF})), ImageFormat::kUnknown);
+}
+
+TEST(CodecRegistryTest, RoutesDecodesToTheRegisteredBackend) {
+  auto& registry = CodecRegistry::GetForProcess();
+  ASSERT_FALSE(registry.HasDecoder(ImageFormat::kJPEG));
+
+  size_t decode_count = 0;
+  registry.RegisterDecoder(
+      ImageFormat::kJPEG,
+      [&decode_count](sk_sp<SkData> data, std::optional<uint32_t> width,
+                      std::optional<uint32_t> height) -> sk_sp<SkImage> {
+        decode_count++;
+        return MakeTestImage();
+      },
+      0u);
+  ASSERT_TRUE(registry.HasDecoder(ImageFormat::kJPEG));
+
+  auto data = MakeData({0xFF, 0xD8, 0xFF, 0xE0});
+  auto image = registry.Decode(ImageFormat::kJPEG, data, std::nullopt,
+                               std::nullopt);
+  ASSERT_TRUE(image);
+  ASSERT_EQ(decode_count, 1u);
+
+  // Formats without a backend are declined so callers fall back to Skia.
+  ASSERT_FALSE(
+      registry.Decode(ImageFormat::kPNG, data, std::nullopt, std::nullopt));
+
+  registry.UnregisterDecoder(ImageFormat::kJPEG);
+  ASSERT_FALSE(registry.HasDecoder(ImageFormat::kJPEG));
+  ASSERT_FALSE(
+      registry.Decode(ImageFormat::kJPEG, data, std::nullopt, std::nullopt));
+}
+
+TEST(CodecRegistryTest, SaturatedBackendDeclinesInsteadOfQueueing) {
+  auto& registry = CodecRegistry::GetForProcess();
+
+  // A budget of one with a re-entrant probe: while the backend is busy with
+  // the outer decode, a second request must be declined.
+  bool inner_declined = false;
+  registry.RegisterDecoder(
+      ImageFormat::kBMP,
+      [&registry, &inner_declined](
+          sk_sp<SkData> data, std::optional<uint32_t> width,
+          std::optional<uint32_t> height) -> sk_sp<SkImage> {
+        inner_declined = !registry.Decode(ImageFormat::kBMP, data,
+                                          std::nullopt, std::nullopt);
+        return MakeTestImage();
+      },
+      1u);
+
+  auto data = MakeData({'B', 'M', 0, 0});
+  auto image =
+      registry.Decode(ImageFormat::kBMP, data, std::nullopt, std::nullopt);
+  ASSERT_TRUE(image);
+  ASSERT_TRUE(inner_declined);
+
+  // The budget slot is released once the decode returns.
+  ASSERT_TRUE(
+      registry.Decode(ImageFormat::kBMP, data, std::nullopt, std::nullopt));
+
+  registry.UnregisterDecoder(ImageFormat::kBMP);
+}
+
+TEST(CodecRegistryTest, SingleFrameFormatsAreKnownUpFront) {
+  ASSERT_TRUE(ImageFormatIsAlwaysSingleFrame(ImageFormat::kJPEG));
+  ASSERT_TRUE(ImageFormatIsAlwaysSingleFrame(ImageFormat::kPNG));
+  ASSERT_TRUE(ImageFormatIsAlwaysSingleFrame(ImageFormat::kBMP));
+  ASSERT_FALSE(ImageFormatIsAlwaysSingleFrame(ImageFormat::kGIF));
+  ASSERT_FALSE(ImageFormatIsAlwaysSingleFrame(ImageFormat::kWebP));
+  ASSERT_FALSE(ImageFormatIsAlwaysSingleFrame(ImageFormat::kUnknown));
+}
+
+}  // namespace testing
+}  // namespace flutter
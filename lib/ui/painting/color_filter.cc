@@ -4,6 +4,11 @@
 
 #include "flutter/lib/ui/painting/color_filter.h"
 
+#include <algorithm>
+#include <array>
+#include <map>
+#include <utility>
+
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
@@ -12,6 +17,34 @@
 
 namespace flutter {
 
+namespace {
+
+// Color filters are value objects that widget rebuilds recreate with the
+// same parameters every frame. Skia caches filtered results by instance, so
+// identical filters are interned per UI thread to keep those caches warm
+// across frames. The tables are reset rather than aged when they fill.
+constexpr size_t kMaxCachedFilters = 64;
+
+using ModeKey = std::pair<int, int>;
+thread_local std::map<ModeKey, sk_sp<SkColorFilter>> tls_mode_filters;
+
+using MatrixKey = std::array<float, 20>;
+thread_local std::map<MatrixKey, sk_sp<SkColorFilter>> tls_matrix_filters;
+
+template <typename Map, typename Key, typename Factory>
+sk_sp<SkColorFilter> InternFilter(Map& map, const Key& key, Factory factory) {
+  auto it = map.find(key);
+  if (it == map.end()) {
+    if (map.size() >= kMaxCachedFilters) {
+      map.clear();
+    }
+    it = map.emplace(key, factory()).first;
+  }
+  return it->second;
+}
+
+}  // namespace
+
 static void ColorFilter_constructor(Dart_NativeArguments args) {
   UIDartState::ThrowIfUIOperationsProhibited();
   DartCallConstructor(&ColorFilter::Create, args);
@@ -38,8 +71,10 @@ fml::RefPtr<ColorFilter> ColorFilter::Create() {
 }
 
 void ColorFilter::initMode(int color, int blend_mode) {
-  filter_ = SkColorFilters::Blend(static_cast<SkColor>(color),
-                                  static_cast<SkBlendMode>(blend_mode));
+  filter_ = InternFilter(tls_mode_filters, ModeKey(color, blend_mode), [&]() {
+    return SkColorFilters::Blend(static_cast<SkColor>(color),
+                                 static_cast<SkBlendMode>(blend_mode));
+  });
 }
 
 sk_sp<SkColorFilter> ColorFilter::MakeColorMatrixFilter255(
@@ -56,15 +91,25 @@ sk_sp<SkColorFilter> ColorFilter::MakeColorMatrixFilter255(
 void ColorFilter::initMatrix(const tonic::Float32List& color_matrix) {
   FML_CHECK(color_matrix.num_elements() == 20);
 
-  filter_ = MakeColorMatrixFilter255(color_matrix.data());
+  MatrixKey key;
+  std::copy(color_matrix.data(), color_matrix.data() + key.size(),
+            key.begin());
+  filter_ = InternFilter(tls_matrix_filters, key, [&]() {
+    return MakeColorMatrixFilter255(color_matrix.data());
+  });
 }
 
 void ColorFilter::initLinearToSrgbGamma() {
-  filter_ = SkColorFilters::LinearToSRGBGamma();
+  // The gamma filters take no parameters; one instance per thread suffices.
+  thread_local sk_sp<SkColorFilter> filter =
+      SkColorFilters::LinearToSRGBGamma();
+  filter_ = filter;
 }
 
 void ColorFilter::initSrgbToLinearGamma() {
-  filter_ = SkColorFilters::SRGBToLinearGamma();
+  thread_local sk_sp<SkColorFilter> filter =
+      SkColorFilters::SRGBToLinearGamma();
+  filter_ = filter;
 }
 
 ColorFilter::~ColorFilter() = default;
@@ -0,0 +1,87 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_frame_cache.h"
+
+namespace flutter {
+
+DecodedFrameCache::DecodedFrameCache(size_t byte_budget)
+    : byte_budget_(byte_budget) {}
+
+DecodedFrameCache::~DecodedFrameCache() = default;
+
+size_t DecodedFrameCache::FrameByteSize(const Frame& frame) {
+  size_t size = frame.image ? frame.image->imageInfo().computeMinByteSize() : 0;
+  if (frame.bitmap) {
+    size += frame.bitmap->computeByteSize();
+  }
+  return size;
+}
+
+std::optional<DecodedFrameCache::Frame> DecodedFrameCache::Get(
+    uintptr_t codec_id,
+    int frame_index) {
+  std::scoped_lock lock(mutex_);
+  auto found = index_.find({codec_id, frame_index});
+  if (found == index_.end()) {
+    return std::nullopt;
+  }
+  entries_.splice(entries_.begin(), entries_, found->second);
+  return found->second->frame;
+}
+
+void DecodedFrameCache::Put(uintptr_t codec_id, int frame_index, Frame frame) {
+  const size_t byte_size = FrameByteSize(frame);
+  if (byte_size == 0 || byte_size > byte_budget_) {
+    return;
+  }
+
+  std::scoped_lock lock(mutex_);
+
+  const Key key = {codec_id, frame_index};
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    cached_bytes_ -= found->second->byte_size;
+    entries_.erase(found->second);
+    index_.erase(found);
+  }
+
+  while (cached_bytes_ + byte_size > byte_budget_ && !entries_.empty()) {
+    const Entry& oldest = entries_.back();
+    cached_bytes_ -= oldest.byte_size;
+    index_.erase(oldest.key);
+    entries_.pop_back();
+  }
+
+  entries_.push_front({key, std::move(frame), byte_size});
+  index_[key] = entries_.begin();
+  cached_bytes_ += byte_size;
+}
+
+void DecodedFrameCache::Evict(uintptr_t codec_id) {
+  std::scoped_lock lock(mutex_);
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->key.first == codec_id) {
+      cached_bytes_ -= it->byte_size;
+      index_.erase(it->key);
+      it = entries_.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
+
+void DecodedFrameCache::Clear() {
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  cached_bytes_ = 0;
+}
+
+size_t DecodedFrameCache::GetCachedBytes() const {
+  std::scoped_lock lock(mutex_);
+  return cached_bytes_;
+}
+
+}  // namespace flutter
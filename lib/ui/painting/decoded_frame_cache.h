@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_DECODED_FRAME_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_DECODED_FRAME_CACHE_H_
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkImage.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// A cache of decoded animation frames shared by all multi-frame codecs in a
+/// shell. Looping animations re-request identical frames every cycle; after
+/// the first cycle, short loops whose frames fit in the byte budget are
+/// served from this cache instead of being decoded again on the IO thread.
+///
+/// Frames are keyed by a codec identifier and frame index and evicted least
+/// recently used once the byte budget is exceeded, so one large animation
+/// cannot starve the others. The shell's IO manager owns one instance per
+/// shell and hands it to every codec, which is what makes the budget global.
+class DecodedFrameCache {
+ public:
+  //----------------------------------------------------------------------------
+  /// A cached frame. Frames that later frames depend on also carry the
+  /// decoded bitmap so that a cache hit can restore the codec's required
+  /// frame state for subsequent cache misses.
+  struct Frame {
+    sk_sp<SkImage> image;
+    std::optional<SkBitmap> bitmap;
+  };
+
+  static constexpr size_t kDefaultByteBudget = 32 * (1 << 20);  // 32 MB
+
+  explicit DecodedFrameCache(size_t byte_budget = kDefaultByteBudget);
+
+  ~DecodedFrameCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Fetch a previously cached frame and mark it most recently
+  ///             used.
+  ///
+  /// @param[in]  codec_id     The identifier the frame was stored under.
+  /// @param[in]  frame_index  The index of the frame within its animation.
+  ///
+  /// @return     The cached frame, or `std::nullopt` on a miss.
+  std::optional<Frame> Get(uintptr_t codec_id, int frame_index);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Store a decoded frame, evicting least recently used frames
+  ///             as necessary to stay within the byte budget. Frames larger
+  ///             than the entire budget are not stored.
+  void Put(uintptr_t codec_id, int frame_index, Frame frame);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Remove all frames stored under the given identifier. Called
+  ///             when a codec is collected so its frames do not linger until
+  ///             budget pressure pushes them out.
+  void Evict(uintptr_t codec_id);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Remove all cached frames. Called when the resource context
+  ///             the cached images were uploaded with is replaced.
+  void Clear();
+
+  size_t GetCachedBytes() const;
+
+  size_t GetByteBudget() const { return byte_budget_; }
+
+ private:
+  using Key = std::pair<uintptr_t, int>;
+
+  struct Entry {
+    Key key;
+    Frame frame;
+    size_t byte_size;
+  };
+
+  static size_t FrameByteSize(const Frame& frame);
+
+  mutable std::mutex mutex_;
+  // Most recently used frames at the front.
+  std::list<Entry> entries_;
+  std::map<Key, std::list<Entry>::iterator> index_;
+  size_t cached_bytes_ = 0;
+  const size_t byte_budget_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DecodedFrameCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_DECODED_FRAME_CACHE_H_
@@ -0,0 +1,79 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_frame_cache.h"
+
+#include "flutter/testing/testing.h"
+
+namespace flutter {
+namespace testing {
+
+static DecodedFrameCache::Frame MakeFrame(int width, int height) {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(width, height);
+  bitmap.eraseColor(SK_ColorGREEN);
+  bitmap.setImmutable();
+  DecodedFrameCache::Frame frame;
+  frame.image = SkImage::MakeFromBitmap(bitmap);
+  return frame;
+}
+
+TEST(DecodedFrameCacheTest, CachesAndReturnsFrames) {
+  DecodedFrameCache cache;
+  ASSERT_FALSE(cache.Get(1, 0).has_value());
+
+  auto frame = MakeFrame(10, 10);
+  auto image = frame.image;
+  cache.Put(1, 0, std::move(frame));
+
+  auto cached = cache.Get(1, 0);
+  ASSERT_TRUE(cached.has_value());
+  ASSERT_EQ(cached->image, image);
+
+  // Frames are keyed by codec as well as index.
+  ASSERT_FALSE(cache.Get(2, 0).has_value());
+}
+
+TEST(DecodedFrameCacheTest, EvictsLeastRecentlyUsedWhenOverBudget) {
+  // Budget fits two 10x10 N32 frames but not three.
+  DecodedFrameCache cache(2 * 10 * 10 * 4);
+
+  cache.Put(1, 0, MakeFrame(10, 10));
+  cache.Put(1, 1, MakeFrame(10, 10));
+
+  // Touch frame 0 so that frame 1 is the eviction candidate.
+  ASSERT_TRUE(cache.Get(1, 0).has_value());
+
+  cache.Put(1, 2, MakeFrame(10, 10));
+
+  ASSERT_TRUE(cache.Get(1, 0).has_value());
+  ASSERT_FALSE(cache.Get(1, 1).has_value());
+  ASSERT_TRUE(cache.Get(1, 2).has_value());
+}
+
+TEST(DecodedFrameCacheTest, RejectsFramesLargerThanTheBudget) {
+  DecodedFrameCache cache(10 * 10 * 4);
+
+  cache.Put(1, 0, MakeFrame(100, 100));
+
+  ASSERT_FALSE(cache.Get(1, 0).has_value());
+  ASSERT_EQ(cache.GetCachedBytes(), 0u);
+}
+
+TEST(DecodedFrameCacheTest, EvictRemovesOnlyTheGivenCodec) {
+  DecodedFrameCache cache;
+
+  cache.Put(1, 0, MakeFrame(10, 10));
+  cache.Put(1, 1, MakeFrame(10, 10));
+  cache.Put(2, 0, MakeFrame(10, 10));
+
+  cache.Evict(1);
+
+  ASSERT_FALSE(cache.Get(1, 0).has_value());
+  ASSERT_FALSE(cache.Get(1, 1).has_value());
+  ASSERT_TRUE(cache.Get(2, 0).has_value());
+}
+
+}  // namespace testing
+}  // namespace flutter
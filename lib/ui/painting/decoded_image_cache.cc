@@ -0,0 +1,81 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+namespace flutter {
+
+DecodedImageCache::DecodedImageCache(size_t byte_budget)
+    : byte_budget_(byte_budget) {}
+
+DecodedImageCache::~DecodedImageCache() = default;
+
+DecodedImageCache::Key DecodedImageCache::MakeKey(
+    const SkData& data,
+    std::optional<uint32_t> target_width,
+    std::optional<uint32_t> target_height) {
+  // FNV-1a over the encoded bytes. One pass over the compressed data is cheap
+  // compared to the decode it stands in for.
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  const uint8_t* bytes = data.bytes();
+  for (size_t i = 0; i < data.size(); i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+  }
+  return {hash, target_width.value_or(0), target_height.value_or(0)};
+}
+
+sk_sp<SkImage> DecodedImageCache::Get(const Key& key) {
+  std::scoped_lock lock(mutex_);
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, found->second);
+  return found->second->image;
+}
+
+void DecodedImageCache::Put(const Key& key, sk_sp<SkImage> image) {
+  if (!image) {
+    return;
+  }
+
+  const size_t byte_size = image->imageInfo().computeMinByteSize();
+  if (byte_size == 0 || byte_size > byte_budget_) {
+    return;
+  }
+
+  std::scoped_lock lock(mutex_);
+
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    cached_bytes_ -= found->second->byte_size;
+    entries_.erase(found->second);
+    index_.erase(found);
+  }
+
+  while (cached_bytes_ + byte_size > byte_budget_ && !entries_.empty()) {
+    const Entry& oldest = entries_.back();
+    cached_bytes_ -= oldest.byte_size;
+    index_.erase(oldest.key);
+    entries_.pop_back();
+  }
+
+  entries_.push_front({key, std::move(image), byte_size});
+  index_[key] = entries_.begin();
+  cached_bytes_ += byte_size;
+}
+
+void DecodedImageCache::Clear() {
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  cached_bytes_ = 0;
+}
+
+size_t DecodedImageCache::GetCachedBytes() const {
+  std::scoped_lock lock(mutex_);
+  return cached_bytes_;
+}
+
+}  // namespace flutter
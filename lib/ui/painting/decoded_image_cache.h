@@ -0,0 +1,105 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkImage.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// A cache of decoded, GPU-resident images keyed by the content of their
+/// encoded bytes. The framework-side image cache only holds Dart handles, so
+/// once those are collected, navigating back to a screen decodes and uploads
+/// the same asset bytes all over again. Keying by a content hash (plus the
+/// requested target dimensions, since those change the decoded pixels) lets
+/// the engine serve such repeat decodes from textures it already uploaded.
+///
+/// Entries are evicted least recently used once the byte budget is exceeded.
+/// The shell's IO manager owns one instance per shell; the budget therefore
+/// spans every image decoder attached to that shell, and the shell clears the
+/// cache wholesale on memory pressure notifications.
+class DecodedImageCache {
+ public:
+  //----------------------------------------------------------------------------
+  /// Identifies one decode request: a hash of the encoded bytes and the
+  /// requested target dimensions. A dimension is zero when the caller did not
+  /// constrain it and the intrinsic size was used.
+  struct Key {
+    uint64_t content_hash = 0;
+    uint32_t target_width = 0;
+    uint32_t target_height = 0;
+
+    bool operator<(const Key& other) const {
+      return std::tie(content_hash, target_width, target_height) <
+             std::tie(other.content_hash, other.target_width,
+                      other.target_height);
+    }
+  };
+
+  static constexpr size_t kDefaultByteBudget = 32 * (1 << 20);  // 32 MB
+
+  //----------------------------------------------------------------------------
+  /// @brief      Build the cache key for one decode request by hashing the
+  ///             encoded bytes. Safe to call on any thread.
+  static Key MakeKey(const SkData& data,
+                     std::optional<uint32_t> target_width,
+                     std::optional<uint32_t> target_height);
+
+  explicit DecodedImageCache(size_t byte_budget = kDefaultByteBudget);
+
+  ~DecodedImageCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Fetch a previously decoded image and mark it most recently
+  ///             used.
+  ///
+  /// @return     The cached image, or null on a miss.
+  sk_sp<SkImage> Get(const Key& key);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Store a decoded image, evicting least recently used images
+  ///             as necessary to stay within the byte budget. Images larger
+  ///             than the entire budget are not stored.
+  void Put(const Key& key, sk_sp<SkImage> image);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Remove all cached images. Called on memory pressure and when
+  ///             the resource context the images were uploaded with is
+  ///             replaced.
+  void Clear();
+
+  size_t GetCachedBytes() const;
+
+  size_t GetByteBudget() const { return byte_budget_; }
+
+ private:
+  struct Entry {
+    Key key;
+    sk_sp<SkImage> image;
+    size_t byte_size;
+  };
+
+  mutable std::mutex mutex_;
+  // Most recently used images at the front.
+  std::list<Entry> entries_;
+  std::map<Key, std::list<Entry>::iterator> index_;
+  size_t cached_bytes_ = 0;
+  const size_t byte_budget_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DecodedImageCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
@@ -0,0 +1,96 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<SkImage> MakeImage(int width, int height) {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(width, height);
+  bitmap.eraseColor(SK_ColorBLUE);
+  bitmap.setImmutable();
+  return SkImage::MakeFromBitmap(bitmap);
+}
+
+TEST(DecodedImageCacheTest, CachesAndReturnsImages) {
+  DecodedImageCache cache;
+  const DecodedImageCache::Key key = {1, 0, 0};
+  ASSERT_EQ(cache.Get(key), nullptr);
+
+  auto image = MakeImage(10, 10);
+  cache.Put(key, image);
+
+  ASSERT_EQ(cache.Get(key), image);
+
+  // Target dimensions are part of the key; the same bytes decoded to a
+  // different size are a different entry.
+  ASSERT_EQ(cache.Get({1, 5, 5}), nullptr);
+}
+
+TEST(DecodedImageCacheTest, MakeKeyHashesContentAndDimensions) {
+  auto data = SkData::MakeWithCString("some encoded bytes");
+  auto other_data = SkData::MakeWithCString("other encoded bytes");
+
+  auto key = DecodedImageCache::MakeKey(*data, 10, 20);
+  auto same_key = DecodedImageCache::MakeKey(*data, 10, 20);
+  ASSERT_FALSE(key < same_key);
+  ASSERT_FALSE(same_key < key);
+
+  auto other_content = DecodedImageCache::MakeKey(*other_data, 10, 20);
+  ASSERT_NE(key.content_hash, other_content.content_hash);
+
+  auto other_dimensions =
+      DecodedImageCache::MakeKey(*data, std::nullopt, std::nullopt);
+  ASSERT_EQ(key.content_hash, other_dimensions.content_hash);
+  ASSERT_EQ(other_dimensions.target_width, 0u);
+  ASSERT_EQ(other_dimensions.target_height, 0u);
+}
+
+TEST(DecodedImageCacheTest, EvictsLeastRecentlyUsedWhenOverBudget) {
+  // Budget fits two 10x10 N32 images but not three.
+  DecodedImageCache cache(2 * 10 * 10 * 4);
+
+  cache.Put({1, 0, 0}, MakeImage(10, 10));
+  cache.Put({2, 0, 0}, MakeImage(10, 10));
+
+  // Touch the first image so that the second is the eviction candidate.
+  ASSERT_NE(cache.Get({1, 0, 0}), nullptr);
+
+  cache.Put({3, 0, 0}, MakeImage(10, 10));
+
+  ASSERT_NE(cache.Get({1, 0, 0}), nullptr);
+  ASSERT_EQ(cache.Get({2, 0, 0}), nullptr);
+  ASSERT_NE(cache.Get({3, 0, 0}), nullptr);
+}
+
+TEST(DecodedImageCacheTest, RejectsImagesLargerThanTheBudget) {
+  DecodedImageCache cache(10 * 10 * 4);
+
+  cache.Put({1, 0, 0}, MakeImage(100, 100));
+
+  ASSERT_EQ(cache.Get({1, 0, 0}), nullptr);
+  ASSERT_EQ(cache.GetCachedBytes(), 0u);
+}
+
+TEST(DecodedImageCacheTest, ClearEmptiesTheCache) {
+  DecodedImageCache cache;
+
+  cache.Put({1, 0, 0}, MakeImage(10, 10));
+  cache.Put({2, 0, 0}, MakeImage(10, 10));
+  ASSERT_GT(cache.GetCachedBytes(), 0u);
+
+  cache.Clear();
+
+  ASSERT_EQ(cache.Get({1, 0, 0}), nullptr);
+  ASSERT_EQ(cache.Get({2, 0, 0}), nullptr);
+  ASSERT_EQ(cache.GetCachedBytes(), 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -6,12 +6,46 @@
 
 #include "flutter/lib/ui/painting/gradient.h"
 
+#include "flutter/lib/ui/painting/shader_interner.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/dart_library_natives.h"
 
 namespace flutter {
+namespace {
+
+// Discriminates gradient kinds within an interning key so two kinds with
+// coincidentally identical parameter bytes never collide.
+enum class GradientKind : uint8_t {
+  kLinear,
+  kRadial,
+  kSweep,
+  kTwoPointConical,
+};
+
+// The colors, stops and matrix are variable length, so each is prefixed
+// with its element count to keep key byte streams unambiguous.
+void AppendGradientCommon(ShaderInterner::Key& key,
+                          const tonic::Int32List& colors,
+                          const tonic::Float32List& color_stops,
+                          SkTileMode tile_mode,
+                          bool has_matrix,
+                          const SkMatrix& sk_matrix) {
+  key.AppendValue<int32_t>(colors.num_elements());
+  key.Append(colors.data(), colors.num_elements() * sizeof(int32_t));
+  key.AppendValue<int32_t>(color_stops.num_elements());
+  if (color_stops.data() != nullptr) {
+    key.Append(color_stops.data(), color_stops.num_elements() * sizeof(float));
+  }
+  key.AppendValue(tile_mode);
+  key.AppendValue(has_matrix);
+  if (has_matrix) {
+    key.AppendValue(sk_matrix);
+  }
+}
+
+}  // namespace
 
 typedef CanvasGradient
     Gradient;  // Because the C++ name doesn't match the Dart name.
@@ -60,10 +94,20 @@ void CanvasGradient::initLinear(const tonic::Float32List& end_points,
     sk_matrix = ToSkMatrix(matrix4);
   }
 
-  set_shader(UIDartState::CreateGPUObject(SkGradientShader::MakeLinear(
-      reinterpret_cast<const SkPoint*>(end_points.data()),
-      reinterpret_cast<const SkColor*>(colors.data()), color_stops.data(),
-      colors.num_elements(), tile_mode, 0, has_matrix ? &sk_matrix : nullptr)));
+  ShaderInterner::Key key;
+  key.AppendValue(GradientKind::kLinear);
+  key.Append(end_points.data(), 4 * sizeof(float));
+  AppendGradientCommon(key, colors, color_stops, tile_mode, has_matrix,
+                       sk_matrix);
+
+  set_shader(UIDartState::CreateGPUObject(
+      ShaderInterner::Instance().GetOrCreate(key, [&]() {
+        return SkGradientShader::MakeLinear(
+            reinterpret_cast<const SkPoint*>(end_points.data()),
+            reinterpret_cast<const SkColor*>(colors.data()),
+            color_stops.data(), colors.num_elements(), tile_mode, 0,
+            has_matrix ? &sk_matrix : nullptr);
+      })));
 }
 
 void CanvasGradient::initRadial(double center_x,
@@ -85,10 +129,22 @@ void CanvasGradient::initRadial(double center_x,
     sk_matrix = ToSkMatrix(matrix4);
   }
 
-  set_shader(UIDartState::CreateGPUObject(SkGradientShader::MakeRadial(
-      SkPoint::Make(center_x, center_y), radius,
-      reinterpret_cast<const SkColor*>(colors.data()), color_stops.data(),
-      colors.num_elements(), tile_mode, 0, has_matrix ? &sk_matrix : nullptr)));
+  ShaderInterner::Key key;
+  key.AppendValue(GradientKind::kRadial);
+  key.AppendValue(center_x);
+  key.AppendValue(center_y);
+  key.AppendValue(radius);
+  AppendGradientCommon(key, colors, color_stops, tile_mode, has_matrix,
+                       sk_matrix);
+
+  set_shader(UIDartState::CreateGPUObject(
+      ShaderInterner::Instance().GetOrCreate(key, [&]() {
+        return SkGradientShader::MakeRadial(
+            SkPoint::Make(center_x, center_y), radius,
+            reinterpret_cast<const SkColor*>(colors.data()),
+            color_stops.data(), colors.num_elements(), tile_mode, 0,
+            has_matrix ? &sk_matrix : nullptr);
+      })));
 }
 
 void CanvasGradient::initSweep(double center_x,
@@ -111,11 +167,24 @@ void CanvasGradient::initSweep(double center_x,
     sk_matrix = ToSkMatrix(matrix4);
   }
 
-  set_shader(UIDartState::CreateGPUObject(SkGradientShader::MakeSweep(
-      center_x, center_y, reinterpret_cast<const SkColor*>(colors.data()),
-      color_stops.data(), colors.num_elements(), tile_mode,
-      start_angle * 180.0 / M_PI, end_angle * 180.0 / M_PI, 0,
-      has_matrix ? &sk_matrix : nullptr)));
+  ShaderInterner::Key key;
+  key.AppendValue(GradientKind::kSweep);
+  key.AppendValue(center_x);
+  key.AppendValue(center_y);
+  key.AppendValue(start_angle);
+  key.AppendValue(end_angle);
+  AppendGradientCommon(key, colors, color_stops, tile_mode, has_matrix,
+                       sk_matrix);
+
+  set_shader(UIDartState::CreateGPUObject(
+      ShaderInterner::Instance().GetOrCreate(key, [&]() {
+        return SkGradientShader::MakeSweep(
+            center_x, center_y,
+            reinterpret_cast<const SkColor*>(colors.data()),
+            color_stops.data(), colors.num_elements(), tile_mode,
+            start_angle * 180.0 / M_PI, end_angle * 180.0 / M_PI, 0,
+            has_matrix ? &sk_matrix : nullptr);
+      })));
 }
 
 void CanvasGradient::initTwoPointConical(double start_x,
@@ -140,11 +209,26 @@ void CanvasGradient::initTwoPointConical(double start_x,
     sk_matrix = ToSkMatrix(matrix4);
   }
 
-  set_shader(UIDartState::CreateGPUObject(SkGradientShader::MakeTwoPointConical(
-      SkPoint::Make(start_x, start_y), start_radius,
-      SkPoint::Make(end_x, end_y), end_radius,
-      reinterpret_cast<const SkColor*>(colors.data()), color_stops.data(),
-      colors.num_elements(), tile_mode, 0, has_matrix ? &sk_matrix : nullptr)));
+  ShaderInterner::Key key;
+  key.AppendValue(GradientKind::kTwoPointConical);
+  key.AppendValue(start_x);
+  key.AppendValue(start_y);
+  key.AppendValue(start_radius);
+  key.AppendValue(end_x);
+  key.AppendValue(end_y);
+  key.AppendValue(end_radius);
+  AppendGradientCommon(key, colors, color_stops, tile_mode, has_matrix,
+                       sk_matrix);
+
+  set_shader(UIDartState::CreateGPUObject(
+      ShaderInterner::Instance().GetOrCreate(key, [&]() {
+        return SkGradientShader::MakeTwoPointConical(
+            SkPoint::Make(start_x, start_y), start_radius,
+            SkPoint::Make(end_x, end_y), end_radius,
+            reinterpret_cast<const SkColor*>(colors.data()),
+            color_stops.data(), colors.num_elements(), tile_mode, 0,
+            has_matrix ? &sk_matrix : nullptr);
+      })));
 }
 
 CanvasGradient::CanvasGradient() = default;
@@ -24,7 +24,14 @@ IMPLEMENT_WRAPPERTYPEINFO(ui, Image);
 
 FOR_EACH_BINDING(DART_NATIVE_CALLBACK)
 
+static void CancelEncode(Dart_NativeArguments args) {
+  tonic::DartCallStatic(&CancelImageEncode, args);
+}
+
 void CanvasImage::RegisterNatives(tonic::DartLibraryNatives* natives) {
+  natives->Register({
+      {"Image_cancelEncode", CancelEncode, 1, true},
+  });
   natives->Register({FOR_EACH_BINDING(DART_REGISTER_NATIVE)});
 }
 
@@ -32,8 +39,11 @@ CanvasImage::CanvasImage() = default;
 
 CanvasImage::~CanvasImage() = default;
 
-Dart_Handle CanvasImage::toByteData(int format, Dart_Handle callback) {
-  return EncodeImage(this, format, callback);
+Dart_Handle CanvasImage::toByteData(int format,
+                                    Dart_Handle callback,
+                                    Dart_Handle progress_callback,
+                                    int64_t encode_id) {
+  return EncodeImage(this, format, callback, progress_callback, encode_id);
 }
 
 void CanvasImage::dispose() {
@@ -30,7 +30,10 @@ class CanvasImage final : public RefCountedDartWrappable<CanvasImage> {
 
   int height() { return image_.get()->height(); }
 
-  Dart_Handle toByteData(int format, Dart_Handle callback);
+  Dart_Handle toByteData(int format,
+                         Dart_Handle callback,
+                         Dart_Handle progress_callback,
+                         int64_t encode_id);
 
   void dispose();
 
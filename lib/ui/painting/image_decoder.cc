@@ -7,6 +7,9 @@
 #include <algorithm>
 
 #include "flutter/fml/make_copyable.h"
+#include "flutter/lib/ui/painting/codec_registry.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+#include "third_party/skia/include/codec/SkAndroidCodec.h"
 #include "third_party/skia/include/codec/SkCodec.h"
 #include "third_party/skia/src/codec/SkCodecImageGenerator.h"
 
@@ -15,6 +18,10 @@ namespace {
 
 constexpr double kAspectRatioChangedThreshold = 0.01;
 
+bool IsCancelled(const ImageDecoder::CancellationToken& token) {
+  return token && token->load();
+}
+
 }  // namespace
 
 ImageDecoder::ImageDecoder(
@@ -66,11 +73,19 @@ static SkISize GetResizedDimensions(SkISize current_size,
   return current_size;
 }
 
-static sk_sp<SkImage> ResizeRasterImage(sk_sp<SkImage> image,
-                                        const SkISize& resized_dimensions,
-                                        const fml::tracing::TraceFlow& flow) {
+static sk_sp<SkImage> ResizeRasterImage(
+    sk_sp<SkImage> image,
+    const SkISize& resized_dimensions,
+    const fml::tracing::TraceFlow& flow,
+    const ImageDecoder::CancellationToken& cancellation_token = {}) {
   FML_DCHECK(!image->isTextureBacked());
 
+  if (IsCancelled(cancellation_token)) {
+    // The consumer abandoned this decode between the decompress and the
+    // resize; wind the job down instead of scaling pixels nobody will see.
+    return nullptr;
+  }
+
   TRACE_EVENT0("flutter", __FUNCTION__);
   flow.Step(__FUNCTION__);
 
@@ -140,7 +155,8 @@ static sk_sp<SkImage> ImageFromDecompressedData(
     ImageDecoder::ImageInfo info,
     std::optional<uint32_t> target_width,
     std::optional<uint32_t> target_height,
-    const fml::tracing::TraceFlow& flow) {
+    const fml::tracing::TraceFlow& flow,
+    const ImageDecoder::CancellationToken& cancellation_token = {}) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   flow.Step(__FUNCTION__);
   auto image = SkImage::MakeRasterData(info.sk_info, data, info.row_bytes);
@@ -158,16 +174,100 @@ static sk_sp<SkImage> ImageFromDecompressedData(
   auto resized_dimensions =
       GetResizedDimensions(image->dimensions(), target_width, target_height);
 
-  return ResizeRasterImage(std::move(image), resized_dimensions, flow);
+  return ResizeRasterImage(std::move(image), resized_dimensions, flow,
+                           cancellation_token);
+}
+
+// Decodes the image while skipping rows and columns via `SkAndroidCodec`
+// sampling. This is the fallback for codecs whose `getScaledDimensions` cannot
+// reduce the output (e.g. PNG); sampling still avoids materializing the
+// full-resolution bitmap. The sampled bitmap may be slightly larger than the
+// target, so the caller is expected to perform the final exact resize.
+static sk_sp<SkImage> ImageFromSampledDecode(
+    sk_sp<SkData> data,
+    const SkISize& resized_dimensions,
+    const fml::tracing::TraceFlow& flow) {
+  TRACE_EVENT0("flutter", __FUNCTION__);
+  flow.Step(__FUNCTION__);
+
+  auto codec = SkAndroidCodec::MakeFromData(std::move(data));
+  if (codec == nullptr) {
+    return nullptr;
+  }
+
+  const auto source_dimensions = codec->getInfo().dimensions();
+  if (source_dimensions.isEmpty() || resized_dimensions.isEmpty()) {
+    return nullptr;
+  }
+
+  // The sampled dimensions must not undershoot the target in either direction
+  // or the final resize would upscale.
+  const int sample_size =
+      std::min(source_dimensions.width() / resized_dimensions.width(),
+               source_dimensions.height() / resized_dimensions.height());
+  if (sample_size < 2) {
+    // Sampling cannot reduce this image; there is nothing to gain over a full
+    // decode.
+    return nullptr;
+  }
+
+  auto sampled_dimensions = codec->getSampledDimensions(sample_size);
+  if (sampled_dimensions == source_dimensions) {
+    return nullptr;
+  }
+
+  // The raster upload path expects premultiplied alpha.
+  auto sampled_image_info = codec->getInfo()
+                                .makeDimensions(sampled_dimensions)
+                                .makeAlphaType(kPremul_SkAlphaType);
+
+  SkBitmap sampled_bitmap;
+  if (!sampled_bitmap.tryAllocPixels(sampled_image_info)) {
+    FML_LOG(ERROR) << "Failed to allocate memory for bitmap of size "
+                   << sampled_image_info.computeMinByteSize() << "B";
+    return nullptr;
+  }
+
+  SkAndroidCodec::AndroidOptions options;
+  options.fSampleSize = sample_size;
+  if (codec->getAndroidPixels(sampled_image_info, sampled_bitmap.getPixels(),
+                              sampled_bitmap.rowBytes(),
+                              &options) != SkCodec::kSuccess) {
+    return nullptr;
+  }
+
+  // Marking this as immutable makes the MakeFromBitmap call share the pixels
+  // instead of copying.
+  sampled_bitmap.setImmutable();
+
+  return SkImage::MakeFromBitmap(sampled_bitmap);
 }
 
-sk_sp<SkImage> ImageFromCompressedData(sk_sp<SkData> data,
-                                       std::optional<uint32_t> target_width,
-                                       std::optional<uint32_t> target_height,
-                                       const fml::tracing::TraceFlow& flow) {
+sk_sp<SkImage> ImageFromCompressedData(
+    sk_sp<SkData> data,
+    std::optional<uint32_t> target_width,
+    std::optional<uint32_t> target_height,
+    const fml::tracing::TraceFlow& flow,
+    const ImageDecoder::CancellationToken& cancellation_token) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   flow.Step(__FUNCTION__);
 
+  // Route to a registered external decoder backend (e.g. a hardware decode
+  // unit) when one is available for this format and within its concurrency
+  // budget. A null result falls through to the Skia software path.
+  if (auto external_image = CodecRegistry::GetForProcess().Decode(
+          DetectImageFormat(*data), data, target_width, target_height)) {
+    TRACE_EVENT0("flutter", "ExternalImageDecode");
+    FML_DCHECK(!external_image->isTextureBacked());
+    auto external_dimensions = GetResizedDimensions(
+        external_image->dimensions(), target_width, target_height);
+    if (external_dimensions == external_image->dimensions()) {
+      return external_image->makeRasterImage();
+    }
+    return ResizeRasterImage(std::move(external_image), external_dimensions,
+                             flow, cancellation_token);
+  }
+
   if (!target_width && !target_height) {
     // No resizing requested. Just decode & rasterize the image.
     return SkImage::MakeFromEncoded(data)->makeRasterImage();
@@ -232,7 +332,19 @@ sk_sp<SkImage> ImageFromCompressedData(sk_sp<SkData> data,
         return nullptr;
       }
       return ResizeRasterImage(std::move(decoded_image), resized_dimensions,
-                               flow);
+                               flow, cancellation_token);
+    }
+  }
+
+  // The codec reported no native scaling support. Sample during the decode
+  // instead of decoding at full resolution and throwing most of the pixels
+  // away in the resize. Sampling does not apply EXIF orientation, so images
+  // whose orientation swaps their dimensions must take the full decode below.
+  if (source_dimensions == codec_ptr->dimensions()) {
+    if (auto sampled_image =
+            ImageFromSampledDecode(data, resized_dimensions, flow)) {
+      return ResizeRasterImage(std::move(sampled_image), resized_dimensions,
+                               flow, cancellation_token);
     }
   }
 
@@ -241,7 +353,8 @@ sk_sp<SkImage> ImageFromCompressedData(sk_sp<SkData> data,
     return nullptr;
   }
 
-  return ResizeRasterImage(std::move(image), resized_dimensions, flow);
+  return ResizeRasterImage(std::move(image), resized_dimensions, flow,
+                           cancellation_token);
 }
 
 static SkiaGPUObject<SkImage> UploadRasterImage(
@@ -327,69 +440,151 @@ void ImageDecoder::Decode(ImageDescriptor descriptor,
     return;
   }
 
+  // Decodes for visible images take the high priority lane so that a
+  // backlog of prefetch decodes cannot delay them.
+  const auto priority = descriptor.is_prefetch
+                            ? fml::ConcurrentMessageLoop::TaskPriority::kNormal
+                            : fml::ConcurrentMessageLoop::TaskPriority::kHigh;
+
   concurrent_task_runner_->PostTask(
-      fml::MakeCopyable([descriptor,                              //
-                         io_manager = io_manager_,                //
-                         io_runner = runners_.GetIOTaskRunner(),  //
-                         result,                                  //
-                         flow = std::move(flow)                   //
+      fml::MakeCopyable([descriptor,                               //
+                         io_manager = io_manager_,                 //
+                         io_runner = runners_.GetIOTaskRunner(),   //
+                         worker_runner = concurrent_task_runner_,  //
+                         priority,                                 //
+                         result,                                   //
+                         flow = std::move(flow)                    //
   ]() mutable {
-        // Step 1: Decompress the image.
+        // Step 1: Compute the cache key for this request.
         // On Worker.
+        //
+        // Pre-decompressed pixel buffers are not cached: their bytes are
+        // unlikely to recur, and hashing them costs nearly as much as the
+        // copy the cache would save.
+        std::optional<DecodedImageCache::Key> cache_key;
+        if (!descriptor.decompressed_image_info) {
+          cache_key = DecodedImageCache::MakeKey(*descriptor.data,
+                                                 descriptor.target_width,
+                                                 descriptor.target_height);
+        }
 
-        auto decompressed =
-            descriptor.decompressed_image_info
-                ? ImageFromDecompressedData(
-                      std::move(descriptor.data),                  //
-                      descriptor.decompressed_image_info.value(),  //
-                      descriptor.target_width,                     //
-                      descriptor.target_height,                    //
-                      flow                                         //
-                      )
-                : ImageFromCompressedData(std::move(descriptor.data),  //
-                                          descriptor.target_width,     //
-                                          descriptor.target_height,    //
-                                          flow);
-
-        if (!decompressed) {
-          FML_LOG(ERROR) << "Could not decompress image.";
-          result({}, std::move(flow));
+        // Steps 3 & 4: Decompress the image on a worker and upload the result
+        // to the GPU on the IO thread, caching the uploaded image on the way
+        // out so later decodes of the same bytes skip both steps.
+        auto decode_task = fml::MakeCopyable(
+            [descriptor = std::move(descriptor), io_manager, io_runner, result,
+             cache_key](fml::tracing::TraceFlow flow) mutable {
+              auto cancellation_token = descriptor.cancellation_token;
+              if (IsCancelled(cancellation_token)) {
+                result({}, std::move(flow));
+                return;
+              }
+
+              auto decompressed =
+                  descriptor.decompressed_image_info
+                      ? ImageFromDecompressedData(
+                            std::move(descriptor.data),                  //
+                            descriptor.decompressed_image_info.value(),  //
+                            descriptor.target_width,                     //
+                            descriptor.target_height,                    //
+                            flow,                                        //
+                            cancellation_token                           //
+                            )
+                      : ImageFromCompressedData(
+                            std::move(descriptor.data),   //
+                            descriptor.target_width,      //
+                            descriptor.target_height,     //
+                            flow,                         //
+                            cancellation_token);
+
+              if (!decompressed) {
+                if (!IsCancelled(cancellation_token)) {
+                  FML_LOG(ERROR) << "Could not decompress image.";
+                }
+                result({}, std::move(flow));
+                return;
+              }
+
+              io_runner->PostTask(fml::MakeCopyable(
+                  [io_manager, decompressed, result, cache_key,
+                   cancellation_token, flow = std::move(flow)]() mutable {
+                    if (!io_manager) {
+                      FML_LOG(ERROR) << "Could not acquire IO manager.";
+                      return result({}, std::move(flow));
+                    }
+
+                    if (IsCancelled(cancellation_token)) {
+                      result({}, std::move(flow));
+                      return;
+                    }
+
+                    auto cache =
+                        cache_key ? io_manager->GetDecodedImageCache()
+                                  : nullptr;
+
+                    // If the IO manager does not have a resource context, the
+                    // caller might not have set one or a software backend
+                    // could be in use. Either way, just return the image
+                    // as-is.
+                    if (!io_manager->GetResourceContext()) {
+                      if (cache) {
+                        cache->Put(cache_key.value(), decompressed);
+                      }
+                      result({std::move(decompressed),
+                              io_manager->GetSkiaUnrefQueue()},
+                             std::move(flow));
+                      return;
+                    }
+
+                    auto uploaded = UploadRasterImage(std::move(decompressed),
+                                                      io_manager, flow);
+
+                    if (!uploaded.get()) {
+                      FML_LOG(ERROR) << "Could not upload image to the GPU.";
+                      result({}, std::move(flow));
+                      return;
+                    }
+
+                    if (cache) {
+                      cache->Put(cache_key.value(), uploaded.get());
+                    }
+
+                    // Finally, all done.
+                    result(std::move(uploaded), std::move(flow));
+                  }));
+            });
+
+        if (!cache_key.has_value()) {
+          decode_task(std::move(flow));
           return;
         }
 
-        // Step 2: Update the image to the GPU.
-        // On IO Thread.
-
-        io_runner->PostTask(fml::MakeCopyable([io_manager, decompressed, result,
-                                               flow =
-                                                   std::move(flow)]() mutable {
-          if (!io_manager) {
-            FML_LOG(ERROR) << "Could not acquire IO manager.";
-            return result({}, std::move(flow));
-          }
-
-          // If the IO manager does not have a resource context, the caller
-          // might not have set one or a software backend could be in use.
-          // Either way, just return the image as-is.
-          if (!io_manager->GetResourceContext()) {
-            result({std::move(decompressed), io_manager->GetSkiaUnrefQueue()},
-                   std::move(flow));
-            return;
-          }
-
-          auto uploaded =
-              UploadRasterImage(std::move(decompressed), io_manager, flow);
-
-          if (!uploaded.get()) {
-            FML_LOG(ERROR) << "Could not upload image to the GPU.";
-            result({}, std::move(flow));
-            return;
-          }
-
-          // Finally, all done.
-          result(std::move(uploaded), std::move(flow));
-        }));
-      }));
+        // Step 2: Probe the cache for a previous decode of the same bytes.
+        // On IO Thread (the only thread the IO manager may be accessed on).
+        io_runner->PostTask(fml::MakeCopyable(
+            [cache_key, io_manager, worker_runner, priority,
+             decode_task = std::move(decode_task), result,
+             flow = std::move(flow)]() mutable {
+              if (io_manager) {
+                if (auto cache = io_manager->GetDecodedImageCache()) {
+                  if (auto cached_image = cache->Get(cache_key.value())) {
+                    flow.Step("DecodedImageCacheHit");
+                    result({std::move(cached_image),
+                            io_manager->GetSkiaUnrefQueue()},
+                           std::move(flow));
+                    return;
+                  }
+                }
+              }
+              worker_runner->PostTask(
+                  fml::MakeCopyable([decode_task = std::move(decode_task),
+                                     flow = std::move(flow)]() mutable {
+                    decode_task(std::move(flow));
+                  }),
+                  priority);
+            }));
+      }),
+      priority);
 }
 
 fml::WeakPtr<ImageDecoder> ImageDecoder::GetWeakPtr() const {
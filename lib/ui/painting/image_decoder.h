@@ -5,6 +5,7 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_DECODER_H_
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_DECODER_H_
 
+#include <atomic>
 #include <memory>
 #include <optional>
 
@@ -42,11 +43,22 @@ class ImageDecoder {
     size_t row_bytes = 0;
   };
 
+  // A shared flag a caller may set to abandon a decode it no longer needs.
+  // Cancellation is cooperative: a stage that is already running completes,
+  // and the job stops at the next stage boundary (decode, resize, upload),
+  // delivering a null image through the result callback.
+  using CancellationToken = std::shared_ptr<std::atomic_bool>;
+
   struct ImageDescriptor {
     sk_sp<SkData> data;
     std::optional<ImageInfo> decompressed_image_info;
     std::optional<uint32_t> target_width;
     std::optional<uint32_t> target_height;
+    // Optional; a null token means the decode cannot be cancelled.
+    CancellationToken cancellation_token;
+    // Prefetch decodes ride the normal worker lane so that decodes for
+    // visible images (the default) can preempt them in the queue.
+    bool is_prefetch = false;
   };
 
   using ImageResult = std::function<void(SkiaGPUObject<SkImage>)>;
@@ -54,8 +66,13 @@ class ImageDecoder {
   // Takes an image descriptor and returns a handle to a texture resident on the
   // GPU. All image decompression and resizes are done on a worker thread
   // concurrently. Texture upload is done on the IO thread and the result
-  // returned back on the UI thread. On error, the texture is null but the
-  // callback is guaranteed to return on the UI thread.
+  // returned back on the UI thread. Requests whose encoded bytes and target
+  // dimensions match a previous decode may be served from the IO manager's
+  // decoded image cache without decoding again. Jobs carrying a cancellation
+  // token stop at the next stage boundary once the token is set, and
+  // prefetch jobs yield the worker queue to decodes for visible images. On
+  // error or cancellation, the texture is null but the callback is
+  // guaranteed to return on the UI thread.
   void Decode(ImageDescriptor descriptor, const ImageResult& result);
 
   fml::WeakPtr<ImageDecoder> GetWeakPtr() const;
@@ -69,10 +86,12 @@ class ImageDecoder {
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoder);
 };
 
-sk_sp<SkImage> ImageFromCompressedData(sk_sp<SkData> data,
-                                       std::optional<uint32_t> target_width,
-                                       std::optional<uint32_t> target_height,
-                                       const fml::tracing::TraceFlow& flow);
+sk_sp<SkImage> ImageFromCompressedData(
+    sk_sp<SkData> data,
+    std::optional<uint32_t> target_width,
+    std::optional<uint32_t> target_height,
+    const fml::tracing::TraceFlow& flow,
+    const ImageDecoder::CancellationToken& cancellation_token = {});
 
 }  // namespace flutter
 
@@ -5,6 +5,7 @@
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/lib/ui/painting/image_decoder.h"
 #include "flutter/lib/ui/painting/image_decoder_test.h"
 #include "flutter/lib/ui/painting/multi_frame_codec.h"
@@ -75,6 +76,16 @@ class TestIOManager final : public IOManager {
     return is_gpu_disabled_sync_switch_;
   }
 
+  // |IOManager|
+  std::shared_ptr<DecodedFrameCache> GetDecodedFrameCache() override {
+    return decoded_frame_cache_;
+  }
+
+  // |IOManager|
+  std::shared_ptr<DecodedImageCache> GetDecodedImageCache() override {
+    return decoded_image_cache_;
+  }
+
   bool did_access_is_gpu_disabled_sync_switch_ = false;
 
  private:
@@ -86,6 +97,10 @@ class TestIOManager final : public IOManager {
   fml::RefPtr<fml::TaskRunner> runner_;
   fml::WeakPtrFactory<TestIOManager> weak_factory_;
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
+  std::shared_ptr<DecodedFrameCache> decoded_frame_cache_ =
+      std::make_shared<DecodedFrameCache>();
+  std::shared_ptr<DecodedImageCache> decoded_image_cache_ =
+      std::make_shared<DecodedImageCache>();
 
   FML_DISALLOW_COPY_AND_ASSIGN(TestIOManager);
 };
@@ -219,6 +234,39 @@ TEST_F(ImageDecoderFixtureTest, ValidImageResultsInSuccess) {
   latch.Wait();
 }
 
+TEST_F(ImageDecoderFixtureTest, CancelledDecodeResultsInNullImage) {
+  auto loop = fml::ConcurrentMessageLoop::Create();
+  auto thread_task_runner = CreateNewThread();
+  TaskRunners runners(GetCurrentTestName(),  // label
+                      thread_task_runner,    // platform
+                      thread_task_runner,    // raster
+                      thread_task_runner,    // ui
+                      thread_task_runner     // io
+  );
+
+  fml::AutoResetWaitableEvent latch;
+  thread_task_runner->PostTask([&]() {
+    TestIOManager manager(runners.GetIOTaskRunner());
+    ImageDecoder decoder(runners, loop->GetTaskRunner(),
+                         manager.GetWeakIOManager());
+
+    ImageDecoder::ImageDescriptor image_descriptor;
+    image_descriptor.data = OpenFixtureAsSkData("DashInNooglerHat.jpg");
+    image_descriptor.cancellation_token =
+        std::make_shared<std::atomic_bool>(true);
+
+    ASSERT_TRUE(image_descriptor.data);
+
+    ImageDecoder::ImageResult callback = [&](SkiaGPUObject<SkImage> image) {
+      ASSERT_TRUE(runners.GetUITaskRunner()->RunsTasksOnCurrentThread());
+      ASSERT_FALSE(image.get());
+      latch.Signal();
+    };
+    decoder.Decode(std::move(image_descriptor), callback);
+  });
+  latch.Wait();
+}
+
 TEST_F(ImageDecoderFixtureTest, ExifDataIsRespectedOnDecode) {
   auto loop = fml::ConcurrentMessageLoop::Create();
   TaskRunners runners(GetCurrentTestName(),         // label
@@ -535,6 +583,19 @@ TEST(ImageDecoderTest, VerifySimpleDecoding) {
             SkISize::Make(6, 2));
 }
 
+TEST(ImageDecoderTest, VerifySampledDecodingWithoutNativeCodecScaling) {
+  auto data = OpenFixtureAsSkData("Horizontal.png");
+  auto image = SkImage::MakeFromEncoded(data);
+  ASSERT_TRUE(image != nullptr);
+  ASSERT_EQ(SkISize::Make(300, 100), image->dimensions());
+
+  // PNG reports no native scaling support, so this exercises the sampled
+  // decode fallback.
+  ASSERT_EQ(ImageFromCompressedData(data, 150, 50, fml::tracing::TraceFlow(""))
+                ->dimensions(),
+            SkISize::Make(150, 50));
+}
+
 TEST(ImageDecoderTest, VerifySubpixelDecodingPreservesExifOrientation) {
   auto data = OpenFixtureAsSkData("Horizontal.jpg");
   auto image = SkImage::MakeFromEncoded(data);
@@ -0,0 +1,115 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/image_descriptor.h"
+
+#include "flutter/lib/ui/painting/multi_frame_codec.h"
+#include "flutter/lib/ui/painting/single_frame_codec.h"
+#include "flutter/lib/ui/ui_dart_state.h"
+#include "third_party/skia/include/codec/SkCodec.h"
+#include "third_party/tonic/converter/dart_converter.h"
+#include "third_party/tonic/dart_binding_macros.h"
+#include "third_party/tonic/dart_library_natives.h"
+#include "third_party/tonic/typed_data/typed_list.h"
+
+namespace flutter {
+
+IMPLEMENT_WRAPPERTYPEINFO(ui, ImageDescriptor);
+
+static void InitEncoded(Dart_NativeArguments args) {
+  UIDartState::ThrowIfUIOperationsProhibited();
+  Dart_Handle descriptor_handle = Dart_GetNativeArgument(args, 0);
+
+  Dart_Handle exception = nullptr;
+  tonic::Uint8List list =
+      tonic::DartConverter<tonic::Uint8List>::FromArguments(args, 1,
+                                                            exception);
+  if (exception) {
+    Dart_SetReturnValue(args, exception);
+    return;
+  }
+
+  sk_sp<SkData> buffer = MakeSkDataWithCopy(list.data(), list.num_elements());
+
+  // A single container parse gathers everything later instantiations need.
+  std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(buffer);
+  if (!codec) {
+    Dart_SetReturnValue(
+        args, tonic::ToDart("Could not parse the encoded image data."));
+    return;
+  }
+
+  const ImageFormat format = DetectImageFormat(*buffer);
+  const auto& info = codec->getInfo();
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(
+      std::move(buffer), format, info.width(), info.height(),
+      codec->getFrameCount());
+  descriptor->AssociateWithDartWrapper(descriptor_handle);
+}
+
+ImageDescriptor::ImageDescriptor(sk_sp<SkData> buffer,
+                                 ImageFormat format,
+                                 int width,
+                                 int height,
+                                 int frame_count)
+    : buffer_(std::move(buffer)),
+      format_(format),
+      width_(width),
+      height_(height),
+      frame_count_(frame_count) {}
+
+ImageDescriptor::~ImageDescriptor() = default;
+
+fml::RefPtr<Codec> ImageDescriptor::instantiateCodec(int target_width,
+                                                     int target_height,
+                                                     bool prefetch) {
+  if (frame_count_ == 1) {
+    ImageDecoder::ImageDescriptor descriptor;
+    descriptor.data = buffer_;
+    if (target_width > 0) {
+      descriptor.target_width = target_width;
+    }
+    if (target_height > 0) {
+      descriptor.target_height = target_height;
+    }
+    descriptor.is_prefetch = prefetch;
+    return fml::MakeRefCounted<SingleFrameCodec>(std::move(descriptor));
+  }
+
+  // Animated images need their own SkCodec since frame iteration state lives
+  // on it. The container format is already known; only its parse is repeated.
+  std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(buffer_);
+  if (!codec) {
+    return nullptr;
+  }
+  return fml::MakeRefCounted<MultiFrameCodec>(std::move(codec));
+}
+
+void ImageDescriptor::dispose() {
+  buffer_.reset();
+  ClearDartWrapper();
+}
+
+size_t ImageDescriptor::GetAllocationSize() const {
+  const auto buffer_byte_size = buffer_ ? buffer_->size() : 0;
+  return buffer_byte_size + sizeof(this);
+}
+
+#define FOR_EACH_BINDING(V)            \
+  V(ImageDescriptor, width)            \
+  V(ImageDescriptor, height)           \
+  V(ImageDescriptor, frameCount)       \
+  V(ImageDescriptor, instantiateCodec) \
+  V(ImageDescriptor, dispose)
+
+FOR_EACH_BINDING(DART_NATIVE_CALLBACK)
+
+void ImageDescriptor::RegisterNatives(tonic::DartLibraryNatives* natives) {
+  natives->Register({
+      {"ImageDescriptor_initEncoded", InitEncoded, 2, true},
+  });
+  natives->Register({FOR_EACH_BINDING(DART_REGISTER_NATIVE)});
+}
+
+}  // namespace flutter
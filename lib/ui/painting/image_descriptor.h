@@ -0,0 +1,69 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_DESCRIPTOR_H_
+#define FLUTTER_LIB_UI_PAINTING_IMAGE_DESCRIPTOR_H_
+
+#include "flutter/lib/ui/dart_wrapper.h"
+#include "flutter/lib/ui/painting/codec.h"
+#include "flutter/lib/ui/painting/codec_registry.h"
+#include "third_party/skia/include/core/SkData.h"
+
+namespace tonic {
+class DartLibraryNatives;
+}  // namespace tonic
+
+namespace flutter {
+
+// A parsed description of an encoded image buffer: container format,
+// dimensions and frame count. The expensive probing (format sniffing and
+// container header parsing) happens once at construction; any number of
+// codecs at different target sizes can then be instantiated from the
+// retained compressed buffer without re-probing.
+class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
+  DEFINE_WRAPPERTYPEINFO();
+  FML_FRIEND_MAKE_REF_COUNTED(ImageDescriptor);
+
+ public:
+  ~ImageDescriptor() override;
+
+  int width() const { return width_; }
+
+  int height() const { return height_; }
+
+  int frameCount() const { return frame_count_; }
+
+  // Creates a codec decoding the retained buffer at the given target
+  // dimensions (use zero or negative values to keep the intrinsic size).
+  // Still images skip container probing entirely; animated images create a
+  // fresh SkCodec from the retained buffer since each codec owns its frame
+  // iteration state. Returns null if the codec could not be created.
+  fml::RefPtr<Codec> instantiateCodec(int target_width,
+                                      int target_height,
+                                      bool prefetch);
+
+  void dispose();
+
+  // |DartWrappable|
+  size_t GetAllocationSize() const override;
+
+  static void RegisterNatives(tonic::DartLibraryNatives* natives);
+
+ private:
+  ImageDescriptor(sk_sp<SkData> buffer,
+                  ImageFormat format,
+                  int width,
+                  int height,
+                  int frame_count);
+
+  sk_sp<SkData> buffer_;
+  ImageFormat format_;
+  int width_;
+  int height_;
+  int frame_count_;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_IMAGE_DESCRIPTOR_H_
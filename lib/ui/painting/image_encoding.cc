@@ -4,11 +4,17 @@
 
 #include "flutter/lib/ui/painting/image_encoding.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/build_config.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/painting/image.h"
@@ -16,7 +22,9 @@
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkEncodedImageFormat.h"
 #include "third_party/skia/include/core/SkImage.h"
+#include "third_party/skia/include/core/SkStream.h"
 #include "third_party/skia/include/core/SkSurface.h"
+#include "third_party/skia/include/encode/SkPngEncoder.h"
 #include "third_party/tonic/dart_persistent_value.h"
 #include "third_party/tonic/logging/dart_invoke.h"
 #include "third_party/tonic/typed_data/typed_list.h"
@@ -35,6 +43,44 @@ enum ImageByteFormat {
   kPNG,
 };
 
+// Reports encode progress in the [0.0, 1.0] range. Invoked on an encode
+// worker; implementations are responsible for re-posting to the UI thread.
+using EncodeProgressCallback = std::function<void(double)>;
+
+// Cancellation flags for encodes that were started with a non-zero identifier,
+// keyed by that identifier. Entries are added on the UI thread when the encode
+// is requested and removed by the worker that finishes (or abandons) it.
+std::mutex g_active_encodes_mutex;
+std::unordered_map<int64_t, std::shared_ptr<std::atomic_bool>>
+    g_active_encodes;
+
+std::shared_ptr<std::atomic_bool> RegisterActiveEncode(int64_t encode_id) {
+  auto canceled = std::make_shared<std::atomic_bool>(false);
+  if (encode_id != 0) {
+    std::scoped_lock lock(g_active_encodes_mutex);
+    g_active_encodes[encode_id] = canceled;
+  }
+  return canceled;
+}
+
+void UnregisterActiveEncode(int64_t encode_id) {
+  if (encode_id == 0) {
+    return;
+  }
+  std::scoped_lock lock(g_active_encodes_mutex);
+  g_active_encodes.erase(encode_id);
+}
+
+// The worker pool that runs image compression. Rasterization stays on the IO
+// runner (it may need the resource context) but the CPU-bound compression of
+// batched exports fans out here instead of serializing behind texture uploads.
+// Shared by every engine in the process and created on first use.
+std::shared_ptr<fml::ConcurrentTaskRunner> GetEncodingTaskRunner() {
+  static std::shared_ptr<fml::ConcurrentMessageLoop> loop =
+      fml::ConcurrentMessageLoop::Create();
+  return loop->GetTaskRunner();
+}
+
 void InvokeDataCallback(std::unique_ptr<DartPersistentValue> callback,
                         sk_sp<SkData> buffer) {
   std::shared_ptr<tonic::DartState> dart_state = callback->dart_state().lock();
@@ -175,21 +221,64 @@ sk_sp<SkData> CopyImageByteData(sk_sp<SkImage> raster_image,
   return SkData::MakeWithCopy(pixmap.addr(), pixmap.computeByteSize());
 }
 
-sk_sp<SkData> EncodeImage(sk_sp<SkImage> raster_image, ImageByteFormat format) {
+// Encodes the image as PNG in scanline chunks so that cancellation takes
+// effect promptly and progress can be reported between chunks.
+sk_sp<SkData> EncodePNG(sk_sp<SkImage> raster_image,
+                        const std::shared_ptr<std::atomic_bool>& canceled,
+                        const EncodeProgressCallback& progress) {
+  SkPixmap pixmap;
+  if (!raster_image->peekPixels(&pixmap)) {
+    // The pixels are not directly addressable. Fall back to the one-shot
+    // encoder; progress is only reported on completion in that case.
+    return raster_image->encodeToData(SkEncodedImageFormat::kPNG, 0);
+  }
+
+  SkDynamicMemoryWStream stream;
+  auto encoder = SkPngEncoder::Make(&stream, pixmap, SkPngEncoder::Options());
+  if (!encoder) {
+    FML_LOG(ERROR) << "Could not create the PNG encoder.";
+    return nullptr;
+  }
+
+  // Large enough to keep the per-chunk overhead negligible while still
+  // checking for cancellation several times on typical screenshot sizes.
+  constexpr int kRowsPerChunk = 64;
+  const int total_rows = pixmap.height();
+  int encoded_rows = 0;
+  while (encoded_rows < total_rows) {
+    if (canceled->load()) {
+      return nullptr;
+    }
+    const int chunk = std::min(kRowsPerChunk, total_rows - encoded_rows);
+    if (!encoder->encodeRows(chunk)) {
+      FML_LOG(ERROR) << "Could not convert raster image to PNG.";
+      return nullptr;
+    }
+    encoded_rows += chunk;
+    if (progress) {
+      progress(static_cast<double>(encoded_rows) / total_rows);
+    }
+  }
+
+  return stream.detachAsData();
+}
+
+sk_sp<SkData> EncodeImage(sk_sp<SkImage> raster_image,
+                          ImageByteFormat format,
+                          const std::shared_ptr<std::atomic_bool>& canceled,
+                          const EncodeProgressCallback& progress) {
   TRACE_EVENT0("flutter", __FUNCTION__);
 
-  if (!raster_image) {
+  if (!raster_image || canceled->load()) {
     return nullptr;
   }
 
   switch (format) {
     case kPNG: {
-      auto png_image =
-          raster_image->encodeToData(SkEncodedImageFormat::kPNG, 0);
+      auto png_image = EncodePNG(std::move(raster_image), canceled, progress);
 
-      if (png_image == nullptr) {
+      if (png_image == nullptr && !canceled->load()) {
         FML_LOG(ERROR) << "Could not convert raster image to PNG.";
-        return nullptr;
       };
       return png_image;
     } break;
@@ -205,13 +294,28 @@ sk_sp<SkData> EncodeImage(sk_sp<SkImage> raster_image, ImageByteFormat format) {
   return nullptr;
 }
 
+void InvokeProgressCallback(
+    const std::shared_ptr<DartPersistentValue>& callback,
+    double progress) {
+  std::shared_ptr<tonic::DartState> dart_state = callback->dart_state().lock();
+  if (!dart_state) {
+    return;
+  }
+  tonic::DartState::Scope scope(dart_state);
+  DartInvoke(callback->value(), {ToDart(progress)});
+}
+
 void EncodeImageAndInvokeDataCallback(
     sk_sp<SkImage> image,
     std::unique_ptr<DartPersistentValue> callback,
+    std::shared_ptr<DartPersistentValue> progress_callback,
     ImageByteFormat format,
+    int64_t encode_id,
+    std::shared_ptr<std::atomic_bool> canceled,
     fml::RefPtr<fml::TaskRunner> ui_task_runner,
     fml::RefPtr<fml::TaskRunner> raster_task_runner,
     fml::RefPtr<fml::TaskRunner> io_task_runner,
+    std::shared_ptr<fml::ConcurrentTaskRunner> encoding_task_runner,
     GrContext* resource_context,
     fml::WeakPtr<SnapshotDelegate> snapshot_delegate) {
   auto callback_task = fml::MakeCopyable(
@@ -219,12 +323,34 @@ void EncodeImageAndInvokeDataCallback(
         InvokeDataCallback(std::move(callback), std::move(encoded));
       });
 
+  EncodeProgressCallback progress;
+  if (progress_callback) {
+    progress = [progress_callback, ui_task_runner](double fraction) {
+      ui_task_runner->PostTask([progress_callback, fraction]() {
+        InvokeProgressCallback(progress_callback, fraction);
+      });
+    };
+  }
+
+  // Compression is CPU bound and can take tens of milliseconds per image, so
+  // it runs on the concurrent encode workers rather than the IO runner. That
+  // way batched exports compress in parallel and do not hold up texture
+  // uploads.
   auto encode_task = [callback_task = std::move(callback_task), format,
-                      ui_task_runner](sk_sp<SkImage> raster_image) {
-    sk_sp<SkData> encoded = EncodeImage(std::move(raster_image), format);
-    ui_task_runner->PostTask(
-        [callback_task = std::move(callback_task),
-         encoded = std::move(encoded)] { callback_task(encoded); });
+                      encode_id, canceled = std::move(canceled),
+                      progress = std::move(progress), ui_task_runner,
+                      encoding_task_runner](sk_sp<SkImage> raster_image) {
+    encoding_task_runner->PostTask([callback_task, format, encode_id, canceled,
+                                    progress, ui_task_runner,
+                                    raster_image =
+                                        std::move(raster_image)]() mutable {
+      sk_sp<SkData> encoded =
+          EncodeImage(std::move(raster_image), format, canceled, progress);
+      UnregisterActiveEncode(encode_id);
+      ui_task_runner->PostTask(
+          [callback_task = std::move(callback_task),
+           encoded = std::move(encoded)] { callback_task(encoded); });
+    });
   };
 
   ConvertImageToRaster(std::move(image), encode_task, raster_task_runner,
@@ -235,36 +361,68 @@ void EncodeImageAndInvokeDataCallback(
 
 Dart_Handle EncodeImage(CanvasImage* canvas_image,
                         int format,
-                        Dart_Handle callback_handle) {
+                        Dart_Handle callback_handle,
+                        Dart_Handle progress_callback_handle,
+                        int64_t encode_id) {
   if (!canvas_image)
     return ToDart("encode called with non-genuine Image.");
 
   if (!Dart_IsClosure(callback_handle))
     return ToDart("Callback must be a function.");
 
+  if (!Dart_IsNull(progress_callback_handle) &&
+      !Dart_IsClosure(progress_callback_handle))
+    return ToDart("Progress callback must be a function.");
+
   ImageByteFormat image_format = static_cast<ImageByteFormat>(format);
 
   auto callback = std::make_unique<DartPersistentValue>(
       tonic::DartState::Current(), callback_handle);
 
+  std::shared_ptr<DartPersistentValue> progress_callback;
+  if (!Dart_IsNull(progress_callback_handle)) {
+    progress_callback = std::make_shared<DartPersistentValue>(
+        tonic::DartState::Current(), progress_callback_handle);
+  }
+
+  auto canceled = RegisterActiveEncode(encode_id);
+
   const auto& task_runners = UIDartState::Current()->GetTaskRunners();
 
   task_runners.GetIOTaskRunner()->PostTask(fml::MakeCopyable(
-      [callback = std::move(callback), image = canvas_image->image(),
-       image_format, ui_task_runner = task_runners.GetUITaskRunner(),
+      [callback = std::move(callback),
+       progress_callback = std::move(progress_callback),
+       image = canvas_image->image(), image_format, encode_id,
+       canceled = std::move(canceled),
+       ui_task_runner = task_runners.GetUITaskRunner(),
        raster_task_runner = task_runners.GetRasterTaskRunner(),
        io_task_runner = task_runners.GetIOTaskRunner(),
+       encoding_task_runner = GetEncodingTaskRunner(),
        io_manager = UIDartState::Current()->GetIOManager(),
        snapshot_delegate =
            UIDartState::Current()->GetSnapshotDelegate()]() mutable {
         EncodeImageAndInvokeDataCallback(
-            std::move(image), std::move(callback), image_format,
-            std::move(ui_task_runner), std::move(raster_task_runner),
-            std::move(io_task_runner), io_manager->GetResourceContext().get(),
+            std::move(image), std::move(callback),
+            std::move(progress_callback), image_format, encode_id,
+            std::move(canceled), std::move(ui_task_runner),
+            std::move(raster_task_runner), std::move(io_task_runner),
+            std::move(encoding_task_runner),
+            io_manager->GetResourceContext().get(),
             std::move(snapshot_delegate));
       }));
 
   return Dart_Null();
 }
 
+void CancelImageEncode(int64_t encode_id) {
+  if (encode_id == 0) {
+    return;
+  }
+  std::scoped_lock lock(g_active_encodes_mutex);
+  auto found = g_active_encodes.find(encode_id);
+  if (found != g_active_encodes.end()) {
+    found->second->store(true);
+  }
+}
+
 }  // namespace flutter
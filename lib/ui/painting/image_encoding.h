@@ -5,6 +5,8 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_IMAGE_ENCODING_H_
 #define FLUTTER_LIB_UI_PAINTING_IMAGE_ENCODING_H_
 
+#include <cstdint>
+
 #include "third_party/tonic/dart_library_natives.h"
 
 namespace flutter {
@@ -13,7 +15,15 @@ class CanvasImage;
 
 Dart_Handle EncodeImage(CanvasImage* canvas_image,
                         int format,
-                        Dart_Handle callback_handle);
+                        Dart_Handle callback_handle,
+                        Dart_Handle progress_callback_handle,
+                        int64_t encode_id);
+
+// Requests that the in-flight encode started with the given non-zero
+// identifier stop at its next opportunity. The pending data callback is
+// invoked with null once the encode is abandoned. Safe to call with an
+// identifier that has already completed.
+void CancelImageEncode(int64_t encode_id);
 
 }  // namespace flutter
 
@@ -4,6 +4,12 @@
 
 #include "flutter/lib/ui/painting/image_filter.h"
 
+#include <algorithm>
+#include <array>
+#include <map>
+#include <tuple>
+#include <utility>
+
 #include "flutter/lib/ui/painting/matrix.h"
 #include "third_party/skia/include/effects/SkBlurImageFilter.h"
 #include "third_party/skia/include/effects/SkImageSource.h"
@@ -15,6 +21,36 @@
 
 namespace flutter {
 
+namespace {
+
+// Widget rebuilds recreate identical filters every frame, and Skia's
+// filter-result caches key on instance identity, so a fresh SkImageFilter
+// per rebuild can never hit them. Parameterized filters are therefore
+// interned per UI thread. Image and picture sourced filters are excluded:
+// caching them would pin their (large) inputs alive. The tables are reset
+// rather than aged when they fill.
+constexpr size_t kMaxCachedFilters = 64;
+
+using BlurKey = std::tuple<double, double>;
+thread_local std::map<BlurKey, sk_sp<SkImageFilter>> tls_blur_filters;
+
+using MatrixKey = std::pair<std::array<double, 16>, int>;
+thread_local std::map<MatrixKey, sk_sp<SkImageFilter>> tls_matrix_filters;
+
+template <typename Map, typename Key, typename Factory>
+sk_sp<SkImageFilter> InternFilter(Map& map, const Key& key, Factory factory) {
+  auto it = map.find(key);
+  if (it == map.end()) {
+    if (map.size() >= kMaxCachedFilters) {
+      map.clear();
+    }
+    it = map.emplace(key, factory()).first;
+  }
+  return it->second;
+}
+
+}  // namespace
+
 static void ImageFilter_constructor(Dart_NativeArguments args) {
   UIDartState::ThrowIfUIOperationsProhibited();
   DartCallConstructor(&ImageFilter::Create, args);
@@ -53,15 +89,27 @@ void ImageFilter::initPicture(Picture* picture) {
 }
 
 void ImageFilter::initBlur(double sigma_x, double sigma_y) {
-  filter_ = SkBlurImageFilter::Make(sigma_x, sigma_y, nullptr, nullptr,
-                                    SkBlurImageFilter::kClamp_TileMode);
+  filter_ =
+      InternFilter(tls_blur_filters, BlurKey(sigma_x, sigma_y), [&]() {
+        return SkBlurImageFilter::Make(sigma_x, sigma_y, nullptr, nullptr,
+                                       SkBlurImageFilter::kClamp_TileMode);
+      });
+  is_blur_ = true;
+  blur_sigma_x_ = sigma_x;
+  blur_sigma_y_ = sigma_y;
 }
 
 void ImageFilter::initMatrix(const tonic::Float64List& matrix4,
                              int filterQuality) {
-  filter_ = SkImageFilter::MakeMatrixFilter(
-      ToSkMatrix(matrix4), static_cast<SkFilterQuality>(filterQuality),
-      nullptr);
+  MatrixKey key;
+  std::copy(matrix4.data(), matrix4.data() + key.first.size(),
+            key.first.begin());
+  key.second = filterQuality;
+  filter_ = InternFilter(tls_matrix_filters, key, [&]() {
+    return SkImageFilter::MakeMatrixFilter(
+        ToSkMatrix(matrix4), static_cast<SkFilterQuality>(filterQuality),
+        nullptr);
+  });
 }
 
 }  // namespace flutter
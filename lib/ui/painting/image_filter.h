@@ -28,12 +28,23 @@ class ImageFilter : public RefCountedDartWrappable<ImageFilter> {
 
   const sk_sp<SkImageFilter>& filter() const { return filter_; }
 
+  // True when the filter was constructed through |initBlur|. SkImageFilter
+  // does not expose its parameters, so the sigmas are remembered here for
+  // consumers that can special case Gaussian blurs (e.g. the backdrop filter
+  // layer's fast blur mode).
+  bool is_blur() const { return is_blur_; }
+  double blur_sigma_x() const { return blur_sigma_x_; }
+  double blur_sigma_y() const { return blur_sigma_y_; }
+
   static void RegisterNatives(tonic::DartLibraryNatives* natives);
 
  private:
   ImageFilter();
 
   sk_sp<SkImageFilter> filter_;
+  bool is_blur_ = false;
+  double blur_sigma_x_ = 0;
+  double blur_sigma_y_ = 0;
 };
 
 }  // namespace flutter
@@ -4,6 +4,7 @@
 
 #include "flutter/lib/ui/painting/image_shader.h"
 
+#include "flutter/lib/ui/painting/shader_interner.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_args.h"
@@ -43,8 +44,20 @@ void ImageShader::initWithImage(CanvasImage* image,
         ToDart("ImageShader constructor called with non-genuine Image."));
   }
   SkMatrix sk_matrix = ToSkMatrix(matrix4);
+
+  // SkImage uniqueIDs are process wide, so identical shaders built over the
+  // same decoded image intern to one instance across frames and isolates.
+  sk_sp<SkImage> sk_image = image->image();
+  ShaderInterner::Key key;
+  key.AppendValue(sk_image->uniqueID());
+  key.AppendValue(tmx);
+  key.AppendValue(tmy);
+  key.AppendValue(sk_matrix);
+
   set_shader(UIDartState::CreateGPUObject(
-      image->image()->makeShader(tmx, tmy, &sk_matrix)));
+      ShaderInterner::Instance().GetOrCreate(key, [&]() {
+        return sk_image->makeShader(tmx, tmy, &sk_matrix);
+      })));
 }
 
 ImageShader::ImageShader() = default;
@@ -22,6 +22,12 @@ MultiFrameCodec::State::State(std::unique_ptr<SkCodec> codec)
       repetitionCount_(codec_->getRepetitionCount()),
       nextFrameIndex_(0) {}
 
+MultiFrameCodec::State::~State() {
+  if (frame_cache_) {
+    frame_cache_->Evict(reinterpret_cast<uintptr_t>(this));
+  }
+}
+
 static void InvokeNextFrameCallback(
     fml::RefPtr<FrameInfo> frameInfo,
     std::unique_ptr<DartPersistentValue> callback,
@@ -74,7 +80,23 @@ static bool CopyToBitmap(SkBitmap* dst,
 }
 
 sk_sp<SkImage> MultiFrameCodec::State::GetNextFrameImage(
-    fml::WeakPtr<GrContext> resourceContext) {
+    fml::WeakPtr<GrContext> resourceContext,
+    std::shared_ptr<DecodedFrameCache> frame_cache) {
+  frame_cache_ = std::move(frame_cache);
+  const auto codec_id = reinterpret_cast<uintptr_t>(this);
+
+  if (frame_cache_) {
+    if (auto cached = frame_cache_->Get(codec_id, nextFrameIndex_)) {
+      // A hit on a frame that later frames depend on must also restore the
+      // decoder state that a subsequent miss would read.
+      if (cached->bitmap) {
+        lastRequiredFrame_ = std::make_unique<SkBitmap>(cached->bitmap.value());
+        lastRequiredFrameIndex_ = nextFrameIndex_;
+      }
+      return cached->image;
+    }
+  }
+
   SkBitmap bitmap = SkBitmap();
   SkImageInfo info = codec_->getInfo().makeColorType(kN32_SkColorType);
   if (info.alphaType() == kUnpremul_SkAlphaType) {
@@ -118,27 +140,42 @@ sk_sp<SkImage> MultiFrameCodec::State::GetNextFrameImage(
     lastRequiredFrameIndex_ = nextFrameIndex_;
   }
 
+  sk_sp<SkImage> image;
   if (resourceContext) {
     SkPixmap pixmap(bitmap.info(), bitmap.pixelRef()->pixels(),
                     bitmap.pixelRef()->rowBytes());
-    return SkImage::MakeCrossContextFromPixmap(resourceContext.get(), pixmap,
-                                               true);
+    image = SkImage::MakeCrossContextFromPixmap(resourceContext.get(), pixmap,
+                                                true);
   } else {
     // Defer decoding until time of draw later on the raster thread. Can happen
     // when GL operations are currently forbidden such as in the background
     // on iOS.
-    return SkImage::MakeFromBitmap(bitmap);
+    image = SkImage::MakeFromBitmap(bitmap);
+  }
+
+  if (frame_cache_ && image) {
+    DecodedFrameCache::Frame frame;
+    frame.image = image;
+    if (frameInfo.fDisposalMethod == SkCodecAnimation::DisposalMethod::kKeep) {
+      frame.bitmap = bitmap;
+    }
+    frame_cache_->Put(codec_id, nextFrameIndex_, std::move(frame));
   }
+
+  return image;
 }
 
 void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
     std::unique_ptr<DartPersistentValue> callback,
     fml::RefPtr<fml::TaskRunner> ui_task_runner,
+    fml::RefPtr<fml::TaskRunner> io_task_runner,
     fml::WeakPtr<GrContext> resourceContext,
     fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue,
+    std::shared_ptr<DecodedFrameCache> frame_cache,
     size_t trace_id) {
   fml::RefPtr<FrameInfo> frameInfo = NULL;
-  sk_sp<SkImage> skImage = GetNextFrameImage(resourceContext);
+  sk_sp<SkImage> skImage =
+      GetNextFrameImage(resourceContext, std::move(frame_cache));
   if (skImage) {
     fml::RefPtr<CanvasImage> image = CanvasImage::Create();
     image->set_image({skImage, std::move(unref_queue)});
@@ -148,6 +185,11 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
         fml::MakeRefCounted<FrameInfo>(std::move(image), skFrameInfo.fDuration);
   }
   nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
+  if (nextFrameIndex_ == 0) {
+    completedLoopCount_++;
+  }
+
+  ScheduleDecodeAhead(std::move(io_task_runner), resourceContext);
 
   ui_task_runner->PostTask(fml::MakeCopyable(
       [callback = std::move(callback), frameInfo, trace_id]() mutable {
@@ -155,6 +197,47 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
       }));
 }
 
+void MultiFrameCodec::State::ScheduleDecodeAhead(
+    fml::RefPtr<fml::TaskRunner> io_task_runner,
+    fml::WeakPtr<GrContext> resourceContext) {
+  if (!frame_cache_ || frameCount_ <= 1 || decodeAheadPending_ ||
+      !io_task_runner) {
+    return;
+  }
+
+  // Do not speculate past the end of a finite animation: once the final
+  // repetition has played through, the framework stops asking for frames.
+  if (nextFrameIndex_ == 0 && repetitionCount_ >= 0 &&
+      completedLoopCount_ > repetitionCount_) {
+    return;
+  }
+
+  // A frame that cannot fit in the cache would be decoded and thrown away;
+  // stick with decoding on demand instead of doubling the decode work.
+  if (codec_->getInfo().computeMinByteSize() > frame_cache_->GetByteBudget()) {
+    return;
+  }
+
+  // The decode runs on the IO task runner rather than a concurrent worker:
+  // SkCodec is not thread safe and all decoder state is IO thread affine, and
+  // queueing behind this task keeps speculative work ordered before the next
+  // getNextFrame request so that request becomes a cache hit.
+  decodeAheadPending_ = true;
+  io_task_runner->PostTask(
+      [weak_state = std::weak_ptr<MultiFrameCodec::State>(shared_from_this()),
+       resourceContext]() {
+        auto state = weak_state.lock();
+        if (!state) {
+          return;
+        }
+        state->decodeAheadPending_ = false;
+        // Decodes (or revalidates) the upcoming frame straight into the
+        // frame cache; the image itself is dropped here and re-fetched from
+        // the cache when Dart asks for the frame.
+        state->GetNextFrameImage(resourceContext, state->frame_cache_);
+      });
+}
+
 Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
   static size_t trace_counter = 1;
   const size_t trace_id = trace_counter++;
@@ -172,6 +255,7 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
            tonic::DartState::Current(), callback_handle),
        weak_state = std::weak_ptr<MultiFrameCodec::State>(state_), trace_id,
        ui_task_runner = task_runners.GetUITaskRunner(),
+       io_task_runner = task_runners.GetIOTaskRunner(),
        io_manager = dart_state->GetIOManager()]() mutable {
         auto state = weak_state.lock();
         if (!state) {
@@ -181,7 +265,8 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
         }
         state->GetNextFrameAndInvokeCallback(
             std::move(callback), std::move(ui_task_runner),
-            io_manager->GetResourceContext(), io_manager->GetSkiaUnrefQueue(),
+            std::move(io_task_runner), io_manager->GetResourceContext(),
+            io_manager->GetSkiaUnrefQueue(), io_manager->GetDecodedFrameCache(),
             trace_id);
       }));
 
@@ -5,8 +5,11 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_MUTLI_FRAME_CODEC_H_
 #define FLUTTER_LIB_UI_PAINTING_MUTLI_FRAME_CODEC_H_
 
+#include <memory>
+
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/codec.h"
+#include "flutter/lib/ui/painting/decoded_frame_cache.h"
 
 namespace flutter {
 
@@ -35,9 +38,11 @@ class MultiFrameCodec : public Codec {
   // Instead, the MultiFrameCodec creates this object when it is constructed,
   // shares it with the IO task runner's decoding work, and sets the live_
   // member to false when it is destructed.
-  struct State {
+  struct State : std::enable_shared_from_this<State> {
     State(std::unique_ptr<SkCodec> codec);
 
+    ~State();
+
     const std::unique_ptr<SkCodec> codec_;
     const int frameCount_;
     const int repetitionCount_;
@@ -46,20 +51,40 @@ class MultiFrameCodec : public Codec {
     // to on the IO thread. They are not safe to access or write on the UI
     // thread.
     int nextFrameIndex_;
+    // The number of times the animation has wrapped back to its first frame.
+    // Used to stop decode-ahead once a finite repetition count is exhausted.
+    int completedLoopCount_ = 0;
+    // Whether a speculative decode of the upcoming frame is already queued on
+    // the IO task runner.
+    bool decodeAheadPending_ = false;
     // The last decoded frame that's required to decode any subsequent frames.
     std::unique_ptr<SkBitmap> lastRequiredFrame_;
 
     // The index of the last decoded required frame.
     int lastRequiredFrameIndex_ = -1;
 
-    sk_sp<SkImage> GetNextFrameImage(fml::WeakPtr<GrContext> resourceContext);
+    // The shell-wide cache of decoded frames. Retained so that this codec's
+    // frames can be evicted when the state is collected. The cache itself is
+    // thread safe.
+    std::shared_ptr<DecodedFrameCache> frame_cache_;
+
+    sk_sp<SkImage> GetNextFrameImage(
+        fml::WeakPtr<GrContext> resourceContext,
+        std::shared_ptr<DecodedFrameCache> frame_cache);
 
     void GetNextFrameAndInvokeCallback(
         std::unique_ptr<DartPersistentValue> callback,
         fml::RefPtr<fml::TaskRunner> ui_task_runner,
+        fml::RefPtr<fml::TaskRunner> io_task_runner,
         fml::WeakPtr<GrContext> resourceContext,
         fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue,
+        std::shared_ptr<DecodedFrameCache> frame_cache,
         size_t trace_id);
+
+    // Queues a speculative decode of the upcoming frame into the frame cache
+    // so the next getNextFrame call is a cache hit instead of a full decode.
+    void ScheduleDecodeAhead(fml::RefPtr<fml::TaskRunner> io_task_runner,
+                             fml::WeakPtr<GrContext> resourceContext);
   };
 
   // Shared across the UI and IO task runners.
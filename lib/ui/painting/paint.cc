@@ -4,6 +4,8 @@
 
 #include "flutter/lib/ui/painting/paint.h"
 
+#include <cstring>
+
 #include "flutter/fml/logging.h"
 #include "flutter/lib/ui/painting/color_filter.h"
 #include "flutter/lib/ui/painting/image_filter.h"
@@ -65,11 +67,34 @@ constexpr float invert_colors[20] = {
 // Must be kept in sync with the MaskFilter private constants in painting.dart.
 enum MaskFilterType { Null, Blur };
 
+namespace {
+
+// Recording-heavy frames decode tens of thousands of paints, but almost all
+// of them repeat a handful of configurations. The framework has no dirty
+// bits to tell us which fields changed, so instead the decoder memoizes the
+// last fully-decoded paint against its raw 56 byte encoding: a memcmp hit
+// replaces the whole branchy field-by-field decode (including mask filter
+// construction) with a refcounted SkPaint copy. Paints that reference Dart
+// objects (shaders, filters) are skipped since their identity lives outside
+// the byte data. One cache per UI thread, as each engine decodes paints on
+// its own thread.
+struct DecodedPaintCache {
+  bool has_value = false;
+  uint8_t encoded[kDataByteCount];
+  SkPaint paint;
+};
+
+thread_local DecodedPaintCache tls_last_decoded_paint;
+
+}  // namespace
+
 Paint::Paint(Dart_Handle paint_objects, Dart_Handle paint_data) {
   is_null_ = Dart_IsNull(paint_data);
   if (is_null_)
     return;
 
+  bool has_objects = false;
+
   Dart_Handle values[kObjectCount];
   if (!Dart_IsNull(paint_objects)) {
     FML_DCHECK(Dart_IsList(paint_objects));
@@ -84,6 +109,7 @@ Paint::Paint(Dart_Handle paint_objects, Dart_Handle paint_data) {
     if (!Dart_IsNull(shader)) {
       Shader* decoded = tonic::DartConverter<Shader*>::FromDart(shader);
       paint_.setShader(decoded->shader());
+      has_objects = true;
     }
 
     Dart_Handle color_filter = values[kColorFilterIndex];
@@ -91,6 +117,7 @@ Paint::Paint(Dart_Handle paint_objects, Dart_Handle paint_data) {
       ColorFilter* decoded_color_filter =
           tonic::DartConverter<ColorFilter*>::FromDart(color_filter);
       paint_.setColorFilter(decoded_color_filter->filter());
+      has_objects = true;
     }
 
     Dart_Handle image_filter = values[kImageFilterIndex];
@@ -98,12 +125,21 @@ Paint::Paint(Dart_Handle paint_objects, Dart_Handle paint_data) {
       ImageFilter* decoded =
           tonic::DartConverter<ImageFilter*>::FromDart(image_filter);
       paint_.setImageFilter(decoded->filter());
+      has_objects = true;
     }
   }
 
   tonic::DartByteData byte_data(paint_data);
   FML_CHECK(byte_data.length_in_bytes() == kDataByteCount);
 
+  const bool cacheable = !has_objects;
+  DecodedPaintCache& cache = tls_last_decoded_paint;
+  if (cacheable && cache.has_value &&
+      memcmp(cache.encoded, byte_data.data(), kDataByteCount) == 0) {
+    paint_ = cache.paint;
+    return;
+  }
+
   const uint32_t* uint_data = static_cast<const uint32_t*>(byte_data.data());
   const float* float_data = static_cast<const float*>(byte_data.data());
 
@@ -169,6 +205,12 @@ Paint::Paint(Dart_Handle paint_objects, Dart_Handle paint_data) {
       paint_.setMaskFilter(SkMaskFilter::MakeBlur(blur_style, sigma));
       break;
   }
+
+  if (cacheable) {
+    cache.has_value = true;
+    memcpy(cache.encoded, byte_data.data(), kDataByteCount);
+    cache.paint = paint_;
+  }
 }
 
 }  // namespace flutter
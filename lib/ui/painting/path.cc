@@ -7,6 +7,8 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 
+#include <unordered_map>
+
 #include "flutter/lib/ui/painting/matrix.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -68,7 +70,77 @@ void CanvasPath::RegisterNatives(tonic::DartLibraryNatives* natives) {
                      FOR_EACH_BINDING(DART_REGISTER_NATIVE)});
 }
 
-CanvasPath::CanvasPath() {}
+namespace {
+
+// A path must be drawn this many times with unchanged geometry before it is
+// assumed to be retained (an icon, a clip) and promoted to cacheable.
+constexpr int kDrawsBeforeCaching = 3;
+
+// Promoted paths are interned per thread (paths are built and consumed on
+// their engine's UI thread). The cache is reset rather than aged when it
+// fills; retained icon sets stay well below this bound.
+constexpr size_t kMaxInternedPaths = 256;
+
+thread_local std::unordered_map<uint64_t, SkPath> tls_interned_paths;
+
+// An FNV-1a hash of the fill type, verbs, points and conic weights; the
+// structural identity that Skia's GPU caches would key on if they could see
+// through generation ids.
+uint64_t ComputePathHash(const SkPath& path) {
+  constexpr uint64_t kPrime = 0x100000001b3ull;
+  uint64_t hash = 0xcbf29ce484222325ull;
+  auto mix = [&hash](const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+      hash = (hash ^ bytes[i]) * kPrime;
+    }
+  };
+
+  const uint8_t fill_type = static_cast<uint8_t>(path.getFillType());
+  mix(&fill_type, sizeof(fill_type));
+
+  SkPath::RawIter iter(path);
+  SkPoint points[4];
+  SkPath::Verb verb;
+  while ((verb = iter.next(points)) != SkPath::kDone_Verb) {
+    const uint8_t verb_byte = static_cast<uint8_t>(verb);
+    mix(&verb_byte, sizeof(verb_byte));
+    int point_count = 0;
+    switch (verb) {
+      case SkPath::kMove_Verb:
+        point_count = 1;
+        break;
+      case SkPath::kLine_Verb:
+        point_count = 2;
+        break;
+      case SkPath::kQuad_Verb:
+        point_count = 3;
+        break;
+      case SkPath::kConic_Verb: {
+        point_count = 3;
+        const SkScalar weight = iter.conicWeight();
+        mix(&weight, sizeof(weight));
+        break;
+      }
+      case SkPath::kCubic_Verb:
+        point_count = 4;
+        break;
+      case SkPath::kClose_Verb:
+      default:
+        break;
+    }
+    mix(points, point_count * sizeof(SkPoint));
+  }
+  return hash;
+}
+
+}  // namespace
+
+CanvasPath::CanvasPath() {
+  // Until it proves otherwise by being drawn repeatedly, a path is assumed
+  // to be one-shot geometry that Skia should not cache masks for.
+  path_.setIsVolatile(true);
+}
 
 CanvasPath::~CanvasPath() {}
 
@@ -297,6 +369,38 @@ void CanvasPath::clone(Dart_Handle path_handle) {
   path->path_ = path_;
 }
 
+const SkPath& CanvasPath::GetPathForDraw() {
+  const uint32_t generation = path_.getGenerationID();
+  if (generation != tracked_generation_) {
+    // The geometry changed since the last draw; start over as one-shot.
+    path_.setIsVolatile(true);
+    tracked_generation_ = path_.getGenerationID();
+    stable_draw_count_ = 1;
+  } else if (++stable_draw_count_ == kDrawsBeforeCaching) {
+    PromoteToStable();
+  }
+  return path_;
+}
+
+void CanvasPath::PromoteToStable() {
+  path_.setIsVolatile(false);
+
+  const uint64_t hash = ComputePathHash(path_);
+  auto it = tls_interned_paths.find(hash);
+  if (it != tls_interned_paths.end()) {
+    // Compare for real before sharing; the hash alone is not proof.
+    if (it->second == path_) {
+      path_ = it->second;
+    }
+  } else {
+    if (tls_interned_paths.size() >= kMaxInternedPaths) {
+      tls_interned_paths.clear();
+    }
+    tls_interned_paths.emplace(hash, path_);
+  }
+  tracked_generation_ = path_.getGenerationID();
+}
+
 // This is doomed to be called too early, since Paths are mutable.
 // However, it can help for some of the clone/shift/transform type methods
 // where the resultant path will initially have a meaningful size.
@@ -37,6 +37,8 @@ class CanvasPath : public RefCountedDartWrappable<CanvasPath> {
                                             const SkPath& src) {
     fml::RefPtr<CanvasPath> path = CanvasPath::Create(path_handle);
     path->path_ = src;
+    // Derived geometry starts over as one-shot, like a freshly built path.
+    path->path_.setIsVolatile(true);
     return path;
   }
 
@@ -110,6 +112,14 @@ class CanvasPath : public RefCountedDartWrappable<CanvasPath> {
 
   const SkPath& path() const { return path_; }
 
+  //----------------------------------------------------------------------------
+  /// Returns the path for rendering and tracks its reuse. Freshly built or
+  /// mutated paths are volatile so Skia does not fill its GPU caches with
+  /// one-shot geometry; a path drawn repeatedly without mutating is promoted
+  /// to cacheable and interned so structurally identical paths share one
+  /// generation id (and therefore the same cache entries).
+  const SkPath& GetPathForDraw();
+
   size_t GetAllocationSize() const override;
 
   static void RegisterNatives(tonic::DartLibraryNatives* natives);
@@ -117,7 +127,16 @@ class CanvasPath : public RefCountedDartWrappable<CanvasPath> {
  private:
   CanvasPath();
 
+  // Promotes the path to cacheable geometry, replacing it with an interned
+  // structurally identical path if one exists.
+  void PromoteToStable();
+
   SkPath path_;
+
+  // The generation id last seen by |GetPathForDraw| and the number of draws
+  // since it changed.
+  uint32_t tracked_generation_ = 0;
+  int stable_draw_count_ = 0;
 };
 
 }  // namespace flutter
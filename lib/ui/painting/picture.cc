@@ -4,8 +4,11 @@
 
 #include "flutter/lib/ui/painting/picture.h"
 
+#include <mutex>
+
 #include "flutter/fml/make_copyable.h"
 #include "flutter/lib/ui/painting/canvas.h"
+#include "flutter/lib/ui/snapshot_delegate.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/tonic/converter/dart_converter.h"
@@ -16,6 +19,29 @@
 #include "third_party/tonic/logging/dart_invoke.h"
 
 namespace flutter {
+namespace {
+
+// Picture.toImage requests waiting to be rasterized. Requests made while a
+// drain is already queued on the raster task runner (a feature snapshotting
+// a dozen pictures in one synchronous loop) are folded into that drain and
+// rasterized together through |SnapshotDelegate::MakeRasterSnapshots|, which
+// packs them into one shared surface with a single context flush.
+struct PendingRasterSnapshots {
+  std::mutex mutex;
+  bool drain_scheduled = false;
+  // The isolate whose requests are queued. Requests from another isolate are
+  // not coalesced since they resolve through a different snapshot delegate.
+  UIDartState* owner = nullptr;
+  std::vector<PictureSnapshotRequest> requests;
+  std::vector<std::function<void(sk_sp<SkImage>)>> callbacks;
+};
+
+PendingRasterSnapshots* GetPendingRasterSnapshots() {
+  static PendingRasterSnapshots* pending = new PendingRasterSnapshots();
+  return pending;
+}
+
+}  // namespace
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, Picture);
 
@@ -120,17 +146,62 @@ Dart_Handle Picture::RasterizeToImage(sk_sp<SkPicture> picture,
     delete image_callback;
   });
 
-  // Kick things off on the raster rask runner.
-  fml::TaskRunner::RunNowOrPostTask(
-      raster_task_runner,
-      [ui_task_runner, snapshot_delegate, picture, picture_bounds, ui_task] {
-        sk_sp<SkImage> raster_image =
-            snapshot_delegate->MakeRasterSnapshot(picture, picture_bounds);
-
-        fml::TaskRunner::RunNowOrPostTask(
-            ui_task_runner,
-            [ui_task, raster_image]() { ui_task(raster_image); });
-      });
+  auto deliver = [ui_task_runner, ui_task](sk_sp<SkImage> raster_image) {
+    fml::TaskRunner::RunNowOrPostTask(
+        ui_task_runner, [ui_task, raster_image]() { ui_task(raster_image); });
+  };
+
+  // Queue the request; all requests queued by this isolate before the drain
+  // below reaches the raster thread are rasterized as one batch.
+  auto* pending = GetPendingRasterSnapshots();
+  bool enqueued = false;
+  bool schedule_drain = false;
+  {
+    std::scoped_lock lock(pending->mutex);
+    if (pending->requests.empty() || pending->owner == dart_state) {
+      pending->owner = dart_state;
+      pending->requests.push_back({picture, picture_bounds});
+      pending->callbacks.push_back(deliver);
+      enqueued = true;
+      if (!pending->drain_scheduled) {
+        pending->drain_scheduled = true;
+        schedule_drain = true;
+      }
+    }
+  }
+
+  if (!enqueued) {
+    // Another isolate's batch is in flight; snapshot standalone.
+    fml::TaskRunner::RunNowOrPostTask(
+        raster_task_runner, [snapshot_delegate, picture, picture_bounds,
+                             deliver = std::move(deliver)] {
+          deliver(snapshot_delegate->MakeRasterSnapshot(picture,
+                                                        picture_bounds));
+        });
+    return Dart_Null();
+  }
+
+  if (schedule_drain) {
+    // Kick things off on the raster rask runner.
+    fml::TaskRunner::RunNowOrPostTask(raster_task_runner, [snapshot_delegate] {
+      auto* pending = GetPendingRasterSnapshots();
+      std::vector<PictureSnapshotRequest> requests;
+      std::vector<std::function<void(sk_sp<SkImage>)>> callbacks;
+      {
+        std::scoped_lock lock(pending->mutex);
+        requests.swap(pending->requests);
+        callbacks.swap(pending->callbacks);
+        pending->drain_scheduled = false;
+      }
+
+      auto raster_images =
+          snapshot_delegate->MakeRasterSnapshots(std::move(requests));
+
+      for (size_t i = 0; i < callbacks.size(); i++) {
+        callbacks[i](raster_images[i]);
+      }
+    });
+  }
 
   return Dart_Null();
 }
@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/shader_interner.h"
+
+namespace flutter {
+
+ShaderInterner& ShaderInterner::Instance() {
+  static ShaderInterner* interner = new ShaderInterner();
+  return *interner;
+}
+
+ShaderInterner::ShaderInterner() = default;
+
+ShaderInterner::~ShaderInterner() = default;
+
+void ShaderInterner::Key::Append(const void* data, size_t size) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  bytes_.insert(bytes_.end(), bytes, bytes + size);
+}
+
+size_t ShaderInterner::Key::Hash() const {
+  // FNV-1a over the appended parameter bytes.
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (uint8_t byte : bytes_) {
+    hash = (hash ^ byte) * 0x100000001b3ULL;
+  }
+  return static_cast<size_t>(hash);
+}
+
+sk_sp<SkShader> ShaderInterner::GetOrCreate(
+    const Key& key,
+    const std::function<sk_sp<SkShader>()>& create) {
+  {
+    std::scoped_lock lock(mutex_);
+    auto found = shaders_.find(key);
+    if (found != shaders_.end()) {
+      return found->second;
+    }
+  }
+
+  // Built outside the lock: shader construction may be expensive and must
+  // not serialize unrelated isolates. A racing miss on the same key builds
+  // twice and the first insertion wins.
+  sk_sp<SkShader> shader = create();
+  if (!shader) {
+    return nullptr;
+  }
+
+  std::scoped_lock lock(mutex_);
+  if (shaders_.size() >= kMaxCachedShaders) {
+    // Shaders are cheap to rebuild relative to the bookkeeping an LRU would
+    // add to every lookup; dropping the whole table on overflow keeps the
+    // hit path to one hash probe.
+    shaders_.clear();
+  }
+  auto inserted = shaders_.insert({key, std::move(shader)});
+  return inserted.first->second;
+}
+
+size_t ShaderInterner::GetCachedShaderCount() const {
+  std::scoped_lock lock(mutex_);
+  return shaders_.size();
+}
+
+void ShaderInterner::Clear() {
+  std::scoped_lock lock(mutex_);
+  shaders_.clear();
+}
+
+}  // namespace flutter
@@ -0,0 +1,82 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_SHADER_INTERNER_H_
+#define FLUTTER_LIB_UI_PAINTING_SHADER_INTERNER_H_
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkShader.h"
+
+namespace flutter {
+
+// Interns immutable SkShader instances by the parameters they were built
+// from. Rebuild-heavy screens construct identical gradient and image shader
+// objects every frame; handing back the same SkShader instance lets Skia
+// reuse its cached GPU program and gradient textures by identity instead of
+// re-deriving them per frame. SkShaders are immutable and safe to share
+// across threads, so the cache is process wide and serves all isolates.
+class ShaderInterner {
+ public:
+  static ShaderInterner& Instance();
+
+  // A value key covering every input that went into building a shader.
+  // Callers append the raw parameter bytes in a fixed order; keys compare
+  // by content.
+  class Key {
+   public:
+    void Append(const void* data, size_t size);
+
+    template <typename T>
+    void AppendValue(const T& value) {
+      static_assert(std::is_trivially_copyable<T>::value,
+                    "Key components must be raw bytes.");
+      Append(&value, sizeof(T));
+    }
+
+    bool operator==(const Key& other) const { return bytes_ == other.bytes_; }
+
+    size_t Hash() const;
+
+   private:
+    std::vector<uint8_t> bytes_;
+  };
+
+  // Returns the interned shader for the key, invoking |create| only on a
+  // miss. A null shader returned by |create| is not cached.
+  sk_sp<SkShader> GetOrCreate(const Key& key,
+                              const std::function<sk_sp<SkShader>()>& create);
+
+  size_t GetCachedShaderCount() const;
+
+  void Clear();
+
+ private:
+  ShaderInterner();
+
+  ~ShaderInterner();
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return key.Hash(); }
+  };
+
+  // Bounds the strong references the interner itself pins. Shaders handed
+  // out earlier stay valid through their own references after eviction.
+  static constexpr size_t kMaxCachedShaders = 256;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<Key, sk_sp<SkShader>, KeyHash> shaders_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ShaderInterner);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_SHADER_INTERNER_H_
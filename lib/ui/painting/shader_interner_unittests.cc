@@ -0,0 +1,93 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/shader_interner.h"
+
+#include "gtest/gtest.h"
+#include "third_party/skia/include/effects/SkGradientShader.h"
+
+namespace flutter {
+namespace testing {
+
+static sk_sp<SkShader> MakeTestGradient(SkColor from, SkColor to) {
+  const SkPoint points[2] = {SkPoint::Make(0, 0), SkPoint::Make(0, 100)};
+  const SkColor colors[2] = {from, to};
+  return SkGradientShader::MakeLinear(points, colors, nullptr, 2,
+                                      SkTileMode::kClamp);
+}
+
+TEST(ShaderInternerTest, IdenticalKeysShareOneShader) {
+  ShaderInterner::Instance().Clear();
+
+  ShaderInterner::Key key;
+  key.AppendValue<uint32_t>(42);
+  key.AppendValue(SK_ColorRED);
+
+  size_t factory_runs = 0;
+  auto create = [&factory_runs]() {
+    factory_runs++;
+    return MakeTestGradient(SK_ColorRED, SK_ColorBLUE);
+  };
+
+  auto first = ShaderInterner::Instance().GetOrCreate(key, create);
+  auto second = ShaderInterner::Instance().GetOrCreate(key, create);
+
+  ASSERT_TRUE(first);
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_EQ(factory_runs, 1u);
+  EXPECT_EQ(ShaderInterner::Instance().GetCachedShaderCount(), 1u);
+}
+
+TEST(ShaderInternerTest, DistinctKeysBuildDistinctShaders) {
+  ShaderInterner::Instance().Clear();
+
+  ShaderInterner::Key red_key;
+  red_key.AppendValue(SK_ColorRED);
+  ShaderInterner::Key green_key;
+  green_key.AppendValue(SK_ColorGREEN);
+
+  auto red = ShaderInterner::Instance().GetOrCreate(red_key, []() {
+    return MakeTestGradient(SK_ColorRED, SK_ColorBLUE);
+  });
+  auto green = ShaderInterner::Instance().GetOrCreate(green_key, []() {
+    return MakeTestGradient(SK_ColorGREEN, SK_ColorBLUE);
+  });
+
+  EXPECT_NE(red.get(), green.get());
+  EXPECT_EQ(ShaderInterner::Instance().GetCachedShaderCount(), 2u);
+}
+
+TEST(ShaderInternerTest, NullShadersAreNotCached) {
+  ShaderInterner::Instance().Clear();
+
+  ShaderInterner::Key key;
+  key.AppendValue<uint32_t>(7);
+
+  auto shader = ShaderInterner::Instance().GetOrCreate(
+      key, []() -> sk_sp<SkShader> { return nullptr; });
+
+  EXPECT_FALSE(shader);
+  EXPECT_EQ(ShaderInterner::Instance().GetCachedShaderCount(), 0u);
+}
+
+TEST(ShaderInternerTest, OverflowingTheCacheResetsIt) {
+  ShaderInterner::Instance().Clear();
+
+  for (uint32_t i = 0; i < 300; i++) {
+    ShaderInterner::Key key;
+    key.AppendValue(i);
+    ShaderInterner::Instance().GetOrCreate(key, []() {
+      return MakeTestGradient(SK_ColorRED, SK_ColorBLUE);
+    });
+  }
+
+  // The table is dropped on overflow, so the count stays bounded rather than
+  // growing with every distinct shader the process ever built.
+  EXPECT_LE(ShaderInterner::Instance().GetCachedShaderCount(), 256u);
+
+  ShaderInterner::Instance().Clear();
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -11,7 +11,11 @@
 namespace flutter {
 
 SingleFrameCodec::SingleFrameCodec(ImageDecoder::ImageDescriptor descriptor)
-    : status_(Status::kNew), descriptor_(std::move(descriptor)) {}
+    : status_(Status::kNew),
+      descriptor_(std::move(descriptor)),
+      cancellation_token_(std::make_shared<std::atomic_bool>(false)) {
+  descriptor_.cancellation_token = cancellation_token_;
+}
 
 SingleFrameCodec::~SingleFrameCodec() = default;
 
@@ -101,6 +105,14 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
   return Dart_Null();
 }
 
+void SingleFrameCodec::dispose() {
+  // The framework disposes codecs for images that scrolled out of view. An
+  // in-flight decode will observe the token at its next stage boundary and
+  // return a null frame, which the completion callback tolerates.
+  cancellation_token_->store(true);
+  Codec::dispose();
+}
+
 size_t SingleFrameCodec::GetAllocationSize() const {
   const auto& data = descriptor_.data;
   const auto data_byte_size = data ? data->size() : 0;
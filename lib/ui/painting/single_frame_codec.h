@@ -27,6 +27,9 @@ class SingleFrameCodec : public Codec {
   // |Codec|
   Dart_Handle getNextFrame(Dart_Handle args) override;
 
+  // |Codec|
+  void dispose() override;
+
   // |DartWrappable|
   size_t GetAllocationSize() const override;
 
@@ -34,6 +37,9 @@ class SingleFrameCodec : public Codec {
   enum class Status { kNew, kInProgress, kComplete };
   Status status_;
   ImageDecoder::ImageDescriptor descriptor_;
+  // Set when the codec is disposed so an in-flight decode stops at its next
+  // stage boundary instead of finishing work nobody will consume.
+  ImageDecoder::CancellationToken cancellation_token_;
   fml::RefPtr<FrameInfo> cached_frame_;
   std::vector<DartPersistentValue> pending_callbacks_;
 
@@ -5,31 +5,25 @@
 #include "flutter/lib/ui/painting/vertices.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 
-#include <algorithm>
+#include <cstring>
 
 #include "third_party/tonic/dart_binding_macros.h"
 #include "third_party/tonic/dart_library_natives.h"
 
 namespace flutter {
 
-namespace {
-
-void DecodePoints(const tonic::Float32List& coords, SkPoint* points) {
-  for (int i = 0; i < coords.num_elements(); i += 2)
-    points[i / 2] = SkPoint::Make(coords[i], coords[i + 1]);
-}
-
-template <typename T>
-void DecodeInts(const tonic::Int32List& ints, T* out) {
-  for (int i = 0; i < ints.num_elements(); i++)
-    out[i] = ints[i];
-}
-
-}  // namespace
+// The encoded typed data lists share their memory layout with the Skia
+// types, so attributes can be copied in bulk instead of element by element.
+static_assert(sizeof(SkPoint) == 2 * sizeof(float),
+              "SkPoint must match a pair of encoded floats.");
+static_assert(sizeof(SkColor) == sizeof(int32_t),
+              "SkColor must match an encoded 32 bit color.");
 
 IMPLEMENT_WRAPPERTYPEINFO(ui, Vertices);
 
-#define FOR_EACH_BINDING(V) V(Vertices, init)
+#define FOR_EACH_BINDING(V) \
+  V(Vertices, init)         \
+  V(Vertices, update)
 
 FOR_EACH_BINDING(DART_NATIVE_CALLBACK)
 
@@ -48,48 +42,125 @@ bool Vertices::init(Dart_Handle vertices_handle,
                     const tonic::Int32List& colors,
                     const tonic::Uint16List& indices) {
   UIDartState::ThrowIfUIOperationsProhibited();
-  uint32_t builderFlags = 0;
-  if (texture_coordinates.data())
-    builderFlags |= SkVertices::kHasTexCoords_BuilderFlag;
-  if (colors.data())
-    builderFlags |= SkVertices::kHasColors_BuilderFlag;
-
-  SkVertices::Builder builder(vertex_mode, positions.num_elements() / 2,
-                              indices.num_elements(), builderFlags);
-
-  if (!builder.isValid())
-    return false;
 
   // positions are required for SkVertices::Builder
   FML_DCHECK(positions.data());
-  if (positions.data())
-    DecodePoints(positions, builder.positions());
+  if (!positions.data()) {
+    return false;
+  }
+  const size_t vertex_count = positions.num_elements() / 2;
+
+  auto vertices = fml::MakeRefCounted<Vertices>();
+  vertices->mode_ = vertex_mode;
+  vertices->positions_.assign(
+      reinterpret_cast<const SkPoint*>(positions.data()),
+      reinterpret_cast<const SkPoint*>(positions.data()) + vertex_count);
 
   if (texture_coordinates.data()) {
     // SkVertices::Builder assumes equal numbers of elements
     FML_DCHECK(positions.num_elements() == texture_coordinates.num_elements());
-    DecodePoints(texture_coordinates, builder.texCoords());
+    vertices->texture_coordinates_.assign(
+        reinterpret_cast<const SkPoint*>(texture_coordinates.data()),
+        reinterpret_cast<const SkPoint*>(texture_coordinates.data()) +
+            vertex_count);
   }
   if (colors.data()) {
     // SkVertices::Builder assumes equal numbers of elements
     FML_DCHECK(positions.num_elements() / 2 == colors.num_elements());
-    DecodeInts<SkColor>(colors, builder.colors());
+    vertices->colors_.assign(
+        reinterpret_cast<const SkColor*>(colors.data()),
+        reinterpret_cast<const SkColor*>(colors.data()) + vertex_count);
   }
-
   if (indices.data()) {
-    std::copy(indices.data(), indices.data() + indices.num_elements(),
-              builder.indices());
+    vertices->indices_.assign(indices.data(),
+                              indices.data() + indices.num_elements());
   }
 
-  auto vertices = fml::MakeRefCounted<Vertices>();
-  vertices->vertices_ = builder.detach();
+  if (!vertices->RebuildVertices()) {
+    return false;
+  }
   vertices->AssociateWithDartWrapper(vertices_handle);
 
   return true;
 }
 
+bool Vertices::update(int start_vertex,
+                      const tonic::Float32List& positions,
+                      const tonic::Float32List& texture_coordinates,
+                      const tonic::Int32List& colors) {
+  UIDartState::ThrowIfUIOperationsProhibited();
+
+  if (!positions.data() || positions.num_elements() % 2 != 0) {
+    return false;
+  }
+  const size_t vertex_count = positions.num_elements() / 2;
+  if (start_vertex < 0 ||
+      static_cast<size_t>(start_vertex) + vertex_count > positions_.size()) {
+    return false;
+  }
+  if (texture_coordinates.data() &&
+      (texture_coordinates_.empty() ||
+       texture_coordinates.num_elements() != positions.num_elements())) {
+    return false;
+  }
+  if (colors.data() &&
+      (colors_.empty() ||
+       static_cast<size_t>(colors.num_elements()) != vertex_count)) {
+    return false;
+  }
+
+  memcpy(positions_.data() + start_vertex, positions.data(),
+         vertex_count * sizeof(SkPoint));
+  if (texture_coordinates.data()) {
+    memcpy(texture_coordinates_.data() + start_vertex,
+           texture_coordinates.data(), vertex_count * sizeof(SkPoint));
+  }
+  if (colors.data()) {
+    memcpy(colors_.data() + start_vertex, colors.data(),
+           vertex_count * sizeof(SkColor));
+  }
+
+  return RebuildVertices();
+}
+
+bool Vertices::RebuildVertices() {
+  uint32_t builderFlags = 0;
+  if (!texture_coordinates_.empty())
+    builderFlags |= SkVertices::kHasTexCoords_BuilderFlag;
+  if (!colors_.empty())
+    builderFlags |= SkVertices::kHasColors_BuilderFlag;
+
+  SkVertices::Builder builder(mode_, positions_.size(), indices_.size(),
+                              builderFlags);
+
+  if (!builder.isValid())
+    return false;
+
+  memcpy(builder.positions(), positions_.data(),
+         positions_.size() * sizeof(SkPoint));
+  if (!texture_coordinates_.empty()) {
+    memcpy(builder.texCoords(), texture_coordinates_.data(),
+           texture_coordinates_.size() * sizeof(SkPoint));
+  }
+  if (!colors_.empty()) {
+    memcpy(builder.colors(), colors_.data(),
+           colors_.size() * sizeof(SkColor));
+  }
+  if (!indices_.empty()) {
+    memcpy(builder.indices(), indices_.data(),
+           indices_.size() * sizeof(uint16_t));
+  }
+
+  vertices_ = builder.detach();
+  return true;
+}
+
 size_t Vertices::GetAllocationSize() const {
-  return sizeof(Vertices) + vertices_->approximateSize();
+  return sizeof(Vertices) + vertices_->approximateSize() +
+         positions_.size() * sizeof(SkPoint) +
+         texture_coordinates_.size() * sizeof(SkPoint) +
+         colors_.size() * sizeof(SkColor) +
+         indices_.size() * sizeof(uint16_t);
 }
 
 }  // namespace flutter
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_VERTICES_H_
 #define FLUTTER_LIB_UI_PAINTING_VERTICES_H_
 
+#include <vector>
+
 #include "flutter/lib/ui/dart_wrapper.h"
 #include "third_party/skia/include/core/SkVertices.h"
 #include "third_party/tonic/typed_data/typed_list.h"
@@ -31,6 +33,17 @@ class Vertices : public RefCountedDartWrappable<Vertices> {
                    const tonic::Int32List& colors,
                    const tonic::Uint16List& indices);
 
+  //----------------------------------------------------------------------------
+  /// Overwrites the attributes of the vertices starting at |start_vertex|
+  /// with the given encoded values and rebuilds the SkVertices. Only the
+  /// changed range crosses the Dart boundary; the retained attributes cover
+  /// the rest of the mesh. Attributes the mesh was built without cannot be
+  /// introduced by an update.
+  bool update(int start_vertex,
+              const tonic::Float32List& positions,
+              const tonic::Float32List& texture_coordinates,
+              const tonic::Int32List& colors);
+
   const sk_sp<SkVertices>& vertices() const { return vertices_; }
 
   size_t GetAllocationSize() const override;
@@ -38,7 +51,18 @@ class Vertices : public RefCountedDartWrappable<Vertices> {
  private:
   Vertices();
 
+  // Rebuilds |vertices_| from the retained attribute arrays.
+  bool RebuildVertices();
+
   sk_sp<SkVertices> vertices_;
+
+  // The decoded attributes are retained so |update| can overwrite a
+  // subrange and rebuild the (immutable) SkVertices from the rest.
+  SkVertices::VertexMode mode_ = SkVertices::kTriangles_VertexMode;
+  std::vector<SkPoint> positions_;
+  std::vector<SkPoint> texture_coordinates_;
+  std::vector<SkColor> colors_;
+  std::vector<uint16_t> indices_;
 };
 
 }  // namespace flutter
@@ -0,0 +1,48 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/scratch_arena.h"
+
+namespace flutter {
+
+namespace {
+
+size_t AlignUp(size_t size) {
+  const size_t alignment = alignof(std::max_align_t);
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+ScratchArena::ScratchArena()
+    : block_(std::make_unique<uint8_t[]>(kInitialBlockSize)),
+      block_size_(kInitialBlockSize) {}
+
+ScratchArena::~ScratchArena() = default;
+
+void* ScratchArena::Allocate(size_t size) {
+  size = AlignUp(size);
+  if (block_used_ + size <= block_size_) {
+    void* result = block_.get() + block_used_;
+    block_used_ += size;
+    return result;
+  }
+  // The primary block is exhausted; take a one-off allocation and remember
+  // the shortfall so |Reset| can size the next block to fit the whole turn.
+  overflow_.push_back(std::make_unique<uint8_t[]>(size));
+  overflow_bytes_ += size;
+  return overflow_.back().get();
+}
+
+void ScratchArena::Reset() {
+  if (!overflow_.empty()) {
+    block_size_ = AlignUp(block_size_ + overflow_bytes_);
+    block_ = std::make_unique<uint8_t[]>(block_size_);
+    overflow_.clear();
+    overflow_bytes_ = 0;
+  }
+  block_used_ = 0;
+}
+
+}  // namespace flutter
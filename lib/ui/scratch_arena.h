@@ -0,0 +1,70 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_SCRATCH_ARENA_H_
+#define FLUTTER_LIB_UI_SCRATCH_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+
+namespace flutter {
+
+// A bump allocator for buffers that only live for the duration of a single
+// Dart native call. Bindings decode typed data and strings into transient
+// buffers on every call into the engine; carving those out of a reusable
+// block keeps the allocator out of the hottest Dart-to-engine paths.
+//
+// Allocations are never freed individually. The owner (|UIDartState|) resets
+// the arena at the end of each message loop turn, after which all pointers
+// handed out during the turn are invalid. Do not store arena pointers in
+// anything that outlives the current native call.
+//
+// This class is not thread safe; each instance must only be used from the
+// thread that owns it.
+class ScratchArena {
+ public:
+  ScratchArena();
+
+  ~ScratchArena();
+
+  // Returns |size| bytes aligned for any fundamental type. The bytes are not
+  // zeroed. Valid until the next |Reset|.
+  void* Allocate(size_t size);
+
+  // Typed convenience wrapper over |Allocate|. The elements are not
+  // constructed; this is only suitable for trivially constructible types.
+  template <typename T>
+  T* AllocateFor(size_t count) {
+    return static_cast<T*>(Allocate(count * sizeof(T)));
+  }
+
+  // Invalidates all outstanding allocations. The primary block is retained
+  // (and grown to cover the high-water mark of the previous turn) so steady
+  // state turns perform no heap allocations at all.
+  void Reset();
+
+  // True when no allocations are outstanding, i.e. |Reset| would be a no-op.
+  // Lets per-task bookkeeping skip the reset on turns that never allocated.
+  bool IsClean() const { return block_used_ == 0 && overflow_.empty(); }
+
+ private:
+  static constexpr size_t kInitialBlockSize = 16 * 1024;
+
+  std::unique_ptr<uint8_t[]> block_;
+  size_t block_size_;
+  size_t block_used_ = 0;
+  // Allocations that did not fit in the primary block; freed on |Reset|.
+  std::vector<std::unique_ptr<uint8_t[]>> overflow_;
+  size_t overflow_bytes_ = 0;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ScratchArena);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_SCRATCH_ARENA_H_
@@ -14,6 +14,12 @@ SemanticsNode::SemanticsNode() = default;
 
 SemanticsNode::SemanticsNode(const SemanticsNode& other) = default;
 
+SemanticsNode& SemanticsNode::operator=(const SemanticsNode& other) = default;
+
+SemanticsNode::SemanticsNode(SemanticsNode&& other) = default;
+
+SemanticsNode& SemanticsNode::operator=(SemanticsNode&& other) = default;
+
 SemanticsNode::~SemanticsNode() = default;
 
 bool SemanticsNode::HasAction(SemanticsAction action) const {
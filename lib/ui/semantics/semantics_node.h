@@ -83,6 +83,13 @@ struct SemanticsNode {
   SemanticsNode();
 
   SemanticsNode(const SemanticsNode& other);
+  SemanticsNode& operator=(const SemanticsNode& other);
+
+  // Moves matter here: updates carrying hundreds of nodes are handed across
+  // the runtime and shell by value, and without these every hop would copy
+  // each node's strings and child lists.
+  SemanticsNode(SemanticsNode&& other);
+  SemanticsNode& operator=(SemanticsNode&& other);
 
   ~SemanticsNode();
 
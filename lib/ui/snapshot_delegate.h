@@ -5,16 +5,32 @@
 #ifndef FLUTTER_LIB_UI_SNAPSHOT_DELEGATE_H_
 #define FLUTTER_LIB_UI_SNAPSHOT_DELEGATE_H_
 
+#include <vector>
+
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkPicture.h"
 
 namespace flutter {
 
+// One picture in a batched snapshot request. See
+// |SnapshotDelegate::MakeRasterSnapshots|.
+struct PictureSnapshotRequest {
+  sk_sp<SkPicture> picture;
+  SkISize size = SkISize::MakeEmpty();
+};
+
 class SnapshotDelegate {
  public:
   virtual sk_sp<SkImage> MakeRasterSnapshot(sk_sp<SkPicture> picture,
                                             SkISize picture_size) = 0;
 
+  // Rasterizes several pictures in one pass, packing them into a shared
+  // atlas surface so the batch costs a single surface allocation and context
+  // flush instead of one per picture. The returned images correspond to the
+  // requests by index; individual entries may be null on failure.
+  virtual std::vector<sk_sp<SkImage>> MakeRasterSnapshots(
+      std::vector<PictureSnapshotRequest> requests) = 0;
+
   virtual sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) = 0;
 };
 
@@ -64,6 +64,16 @@ void AssetManagerFontProvider::RegisterAsset(std::string family_name,
   family_it->second->registerAsset(asset);
 }
 
+std::vector<sk_sp<AssetManagerFontStyleSet>>
+AssetManagerFontProvider::GetFontStyleSets() const {
+  std::vector<sk_sp<AssetManagerFontStyleSet>> style_sets;
+  style_sets.reserve(registered_families_.size());
+  for (const auto& family : registered_families_) {
+    style_sets.push_back(family.second);
+  }
+  return style_sets;
+}
+
 AssetManagerFontStyleSet::AssetManagerFontStyleSet(
     std::shared_ptr<AssetManager> asset_manager,
     std::string family_name)
@@ -75,6 +85,15 @@ void AssetManagerFontStyleSet::registerAsset(std::string asset) {
   assets_.emplace_back(asset);
 }
 
+void AssetManagerFontStyleSet::PreloadTypefaces() {
+  std::lock_guard<std::mutex> lock(typefaces_mutex_);
+  for (auto& asset : assets_) {
+    if (!asset.typeface) {
+      asset.typeface = LoadTypefaceAsset(asset.asset);
+    }
+  }
+}
+
 int AssetManagerFontStyleSet::count() {
   return assets_.size();
 }
@@ -99,22 +118,10 @@ SkTypeface* AssetManagerFontStyleSet::createTypeface(int i) {
   if (index >= assets_.size())
     return nullptr;
 
+  std::lock_guard<std::mutex> lock(typefaces_mutex_);
   TypefaceAsset& asset = assets_[index];
   if (!asset.typeface) {
-    std::unique_ptr<fml::Mapping> asset_mapping =
-        asset_manager_->GetAsMapping(asset.asset);
-    if (asset_mapping == nullptr) {
-      return nullptr;
-    }
-
-    fml::Mapping* asset_mapping_ptr = asset_mapping.release();
-    sk_sp<SkData> asset_data = SkData::MakeWithProc(
-        asset_mapping_ptr->GetMapping(), asset_mapping_ptr->GetSize(),
-        MappingReleaseProc, asset_mapping_ptr);
-    std::unique_ptr<SkMemoryStream> stream = SkMemoryStream::Make(asset_data);
-
-    // Ownership of the stream is transferred.
-    asset.typeface = SkTypeface::MakeFromStream(std::move(stream));
+    asset.typeface = LoadTypefaceAsset(asset.asset);
     if (!asset.typeface)
       return nullptr;
   }
@@ -122,6 +129,26 @@ SkTypeface* AssetManagerFontStyleSet::createTypeface(int i) {
   return SkRef(asset.typeface.get());
 }
 
+sk_sp<SkTypeface> AssetManagerFontStyleSet::LoadTypefaceAsset(
+    const std::string& asset) {
+  std::unique_ptr<fml::Mapping> asset_mapping =
+      asset_manager_->GetAsMapping(asset);
+  if (asset_mapping == nullptr) {
+    return nullptr;
+  }
+
+  // The underlying mapping (a memory map for file based asset stores) is
+  // adopted by the SkData rather than copied into it.
+  fml::Mapping* asset_mapping_ptr = asset_mapping.release();
+  sk_sp<SkData> asset_data = SkData::MakeWithProc(
+      asset_mapping_ptr->GetMapping(), asset_mapping_ptr->GetSize(),
+      MappingReleaseProc, asset_mapping_ptr);
+  std::unique_ptr<SkMemoryStream> stream = SkMemoryStream::Make(asset_data);
+
+  // Ownership of the stream is transferred.
+  return SkTypeface::MakeFromStream(std::move(stream));
+}
+
 SkTypeface* AssetManagerFontStyleSet::matchStyle(const SkFontStyle& pattern) {
   return matchStyleCSS3(pattern);
 }
@@ -6,6 +6,7 @@
 #define FLUTTER_LIB_UI_TEXT_ASSET_MANAGER_FONT_PROVIDER_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -27,6 +28,11 @@ class AssetManagerFontStyleSet : public SkFontStyleSet {
 
   void registerAsset(std::string asset);
 
+  // Loads every registered font asset that has not been turned into a
+  // typeface yet. Safe to call from a background thread; a typeface
+  // requested concurrently through |createTypeface| is only created once.
+  void PreloadTypefaces();
+
   // |SkFontStyleSet|
   int count() override;
 
@@ -53,6 +59,13 @@ class AssetManagerFontStyleSet : public SkFontStyleSet {
     std::string asset;
     sk_sp<SkTypeface> typeface;
   };
+
+  sk_sp<SkTypeface> LoadTypefaceAsset(const std::string& asset);
+
+  // Guards the |typeface| members of |assets_| since typefaces may be
+  // created lazily on the UI thread while a preload runs on the IO thread.
+  // The vector itself is not resized after registration completes.
+  std::mutex typefaces_mutex_;
   std::vector<TypefaceAsset> assets_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(AssetManagerFontStyleSet);
@@ -66,6 +79,11 @@ class AssetManagerFontProvider : public txt::FontAssetProvider {
 
   void RegisterAsset(std::string family_name, std::string asset);
 
+  // The style sets for every registered family. The sets are reference
+  // counted so callers may retain them past the lifetime of this provider,
+  // for example to preload their typefaces on another thread.
+  std::vector<sk_sp<AssetManagerFontStyleSet>> GetFontStyleSets() const;
+
   // |FontAssetProvider|
   size_t GetFamilyCount() const override;
 
@@ -6,6 +6,8 @@
 
 #include <mutex>
 
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/text/asset_manager_font_provider.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/window.h"
@@ -43,6 +45,17 @@ void _LoadFontFromList(Dart_NativeArguments args) {
   tonic::DartCallStatic(LoadFontFromList, args);
 }
 
+uint64_t HashFontManifest(const fml::Mapping& mapping) {
+  constexpr uint64_t kPrime = 0x100000001b3ull;
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const uint8_t* data = mapping.GetMapping();
+  const size_t size = mapping.GetSize();
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ data[i]) * kPrime;
+  }
+  return hash;
+}
+
 }  // namespace
 
 FontCollection::FontCollection()
@@ -79,6 +92,16 @@ void FontCollection::RegisterFonts(
     return;
   }
 
+  // A hot restart hands in a freshly opened asset bundle. When the manifest
+  // bytes are unchanged, the font provider built from them (and every
+  // typeface it has loaded) is still valid: an unchanged manifest names an
+  // unchanged set of font assets. Keep it rather than parse and fill the
+  // collection again.
+  const uint64_t manifest_hash = HashFontManifest(*manifest_mapping);
+  if (has_registered_manifest_ && manifest_hash == registered_manifest_hash_) {
+    return;
+  }
+
   rapidjson::Document document;
   static_assert(sizeof(decltype(document)::Ch) == sizeof(uint8_t), "");
   document.Parse(reinterpret_cast<const decltype(document)::Ch*>(
@@ -127,8 +150,30 @@ void FontCollection::RegisterFonts(
     }
   }
 
+  preloadable_style_sets_ = font_provider->GetFontStyleSets();
+
   collection_->SetAssetFontManager(
       sk_make_sp<txt::AssetFontManager>(std::move(font_provider)));
+
+  registered_manifest_hash_ = manifest_hash;
+  has_registered_manifest_ = true;
+}
+
+void FontCollection::StartPreloadingTypefaces(
+    fml::RefPtr<fml::TaskRunner> task_runner) {
+  if (!task_runner || preloadable_style_sets_.empty()) {
+    return;
+  }
+  // The style sets are reference counted, so the preload is unaffected by
+  // the fonts being re-registered (or the collection dying) while it runs.
+  task_runner->PostTask(
+      fml::MakeCopyable([style_sets = std::move(preloadable_style_sets_)]() {
+        TRACE_EVENT0("flutter", "FontCollection::PreloadTypefaces");
+        for (const auto& style_set : style_sets) {
+          style_set->PreloadTypefaces();
+        }
+      }));
+  preloadable_style_sets_.clear();
 }
 
 void FontCollection::RegisterTestFonts() {
@@ -11,6 +11,8 @@
 #include "flutter/assets/asset_manager.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/lib/ui/text/asset_manager_font_provider.h"
 #include "txt/font_collection.h"
 
 namespace tonic {
@@ -31,8 +33,18 @@ class FontCollection {
 
   void SetupDefaultFontManager();
 
+  // Registers the fonts named by the asset manager's FontManifest.json.
+  // Re-registering with a byte-identical manifest (e.g. during a hot
+  // restart) keeps the previously built font provider and its loaded
+  // typefaces instead of parsing and filling the collection again.
   void RegisterFonts(std::shared_ptr<AssetManager> asset_manager);
 
+  // Loads the typefaces of the fonts registered by the last call to
+  // |RegisterFonts| on the given task runner so that the first text frame
+  // does not pay for the font I/O. A typeface requested by text layout
+  // before the preload reaches it is loaded on demand as before.
+  void StartPreloadingTypefaces(fml::RefPtr<fml::TaskRunner> task_runner);
+
   void RegisterTestFonts();
 
   void LoadFontFromList(const uint8_t* font_data,
@@ -42,6 +54,11 @@ class FontCollection {
  private:
   std::shared_ptr<txt::FontCollection> collection_;
   sk_sp<txt::DynamicFontManager> dynamic_font_manager_;
+  std::vector<sk_sp<AssetManagerFontStyleSet>> preloadable_style_sets_;
+  // Hash of the manifest the current asset font manager was built from;
+  // meaningful only while |has_registered_manifest_| is true.
+  uint64_t registered_manifest_hash_ = 0;
+  bool has_registered_manifest_ = false;
 
   FML_DISALLOW_COPY_AND_ASSIGN(FontCollection);
 };
@@ -6,6 +6,7 @@
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/fml/icu_util.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/task_runner.h"
 #include "flutter/lib/ui/text/font_collection.h"
@@ -160,6 +161,10 @@ fml::RefPtr<ParagraphBuilder> ParagraphBuilder::create(
     double height,
     const std::u16string& ellipsis,
     const std::string& locale) {
+  // Text layout is the first ICU consumer; join any initialization that the
+  // shell deferred off its launch critical path before minikin needs break
+  // iterators.
+  fml::icu::EnsureICUInitialized();
   return fml::MakeRefCounted<ParagraphBuilder>(encoded, strutData, fontFamily,
                                                strutFontFamilies, fontSize,
                                                height, ellipsis, locale);
@@ -196,10 +201,13 @@ void decodeStrut(Dart_Handle strut_data,
         static_cast<txt::FontStyle>(uint8_data[byte_count++]);
   }
 
-  std::vector<float> float_data;
-  float_data.resize((byte_data.length_in_bytes() - byte_count) / 4);
-  memcpy(float_data.data(),
-         static_cast<const char*>(byte_data.data()) + byte_count,
+  // The remaining fields are floats that may be misaligned in the byte data;
+  // stage them in per-turn scratch space rather than a heap vector since they
+  // are only read within this call.
+  ScratchArena& arena = UIDartState::Current()->scratch_arena();
+  float* float_data = arena.AllocateFor<float>(
+      (byte_data.length_in_bytes() - byte_count) / 4);
+  memcpy(float_data, static_cast<const char*>(byte_data.data()) + byte_count,
          byte_data.length_in_bytes() - byte_count);
   size_t float_count = 0;
   if (mask & sFontSizeMask) {
@@ -297,8 +305,16 @@ ParagraphBuilder::ParagraphBuilder(
 #define FLUTTER_PARAGRAPH_BUILDER txt::ParagraphBuilder::CreateTxtBuilder
 #endif
 
-  m_paragraphBuilder =
-      FLUTTER_PARAGRAPH_BUILDER(style, font_collection.GetFontCollection());
+  // Prefer a recycled builder from the isolate's pool; it keeps its font
+  // collection binding and internal buffers across paragraphs, which avoids
+  // builder allocation churn while the framework is laying out lists.
+  m_paragraphBuilder = UIDartState::Current()->TakeParagraphBuilder();
+  if (m_paragraphBuilder) {
+    m_paragraphBuilder->Reset(style);
+  } else {
+    m_paragraphBuilder =
+        FLUTTER_PARAGRAPH_BUILDER(style, font_collection.GetFontCollection());
+  }
 }
 
 ParagraphBuilder::~ParagraphBuilder() = default;
@@ -361,6 +377,10 @@ void ParagraphBuilder::pushStyle(tonic::Int32List& encoded,
                                  Dart_Handle font_features_data) {
   FML_DCHECK(encoded.num_elements() == 8);
 
+  if (!m_paragraphBuilder) {
+    return;
+  }
+
   int32_t mask = encoded[0];
 
   // Set to use the properties of the previous style if the property is not
@@ -459,10 +479,16 @@ void ParagraphBuilder::pushStyle(tonic::Int32List& encoded,
 }
 
 void ParagraphBuilder::pop() {
+  if (!m_paragraphBuilder) {
+    return;
+  }
   m_paragraphBuilder->Pop();
 }
 
 Dart_Handle ParagraphBuilder::addText(const std::u16string& text) {
+  if (!m_paragraphBuilder)
+    return tonic::ToDart("ParagraphBuilder cannot be used after build");
+
   if (text.empty())
     return Dart_Null();
 
@@ -485,6 +511,9 @@ Dart_Handle ParagraphBuilder::addPlaceholder(double width,
                                              unsigned alignment,
                                              double baseline_offset,
                                              unsigned baseline) {
+  if (!m_paragraphBuilder)
+    return tonic::ToDart("ParagraphBuilder cannot be used after build");
+
   txt::PlaceholderRun placeholder_run(
       width, height, static_cast<txt::PlaceholderAlignment>(alignment),
       static_cast<txt::TextBaseline>(baseline), baseline_offset);
@@ -495,7 +524,14 @@ Dart_Handle ParagraphBuilder::addPlaceholder(double width,
 }
 
 void ParagraphBuilder::build(Dart_Handle paragraph_handle) {
+  if (!m_paragraphBuilder) {
+    return;
+  }
   Paragraph::Create(paragraph_handle, m_paragraphBuilder->Build());
+  // The Dart-side builder contract is single use; hand the native builder
+  // back to the isolate's pool so the next paragraph can reuse it.
+  UIDartState::Current()->RecycleParagraphBuilder(
+      std::move(m_paragraphBuilder));
 }
 
 }  // namespace flutter
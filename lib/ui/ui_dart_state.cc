@@ -6,6 +6,7 @@
 
 #include "flutter/fml/message_loop.h"
 #include "flutter/lib/ui/window/window.h"
+#include "flutter/third_party/txt/src/txt/paragraph_builder.h"
 #include "third_party/tonic/converter/dart_converter.h"
 #include "third_party/tonic/dart_message_handler.h"
 
@@ -13,6 +14,10 @@ using tonic::ToDart;
 
 namespace flutter {
 
+// Paragraphs are built one at a time on the UI thread; a small pool covers
+// the occasional builder that is still alive while the next one is created.
+static constexpr size_t kMaxPooledParagraphBuilders = 4;
+
 UIDartState::UIDartState(
     TaskRunners task_runners,
     TaskObserverAdd add_callback,
@@ -47,6 +52,24 @@ UIDartState::~UIDartState() {
   AddOrRemoveTaskObserver(false /* remove */);
 }
 
+std::unique_ptr<txt::ParagraphBuilder> UIDartState::TakeParagraphBuilder() {
+  if (paragraph_builder_pool_.empty()) {
+    return nullptr;
+  }
+  auto builder = std::move(paragraph_builder_pool_.back());
+  paragraph_builder_pool_.pop_back();
+  return builder;
+}
+
+void UIDartState::RecycleParagraphBuilder(
+    std::unique_ptr<txt::ParagraphBuilder> builder) {
+  if (!builder ||
+      paragraph_builder_pool_.size() >= kMaxPooledParagraphBuilders) {
+    return;
+  }
+  paragraph_builder_pool_.push_back(std::move(builder));
+}
+
 const std::string& UIDartState::GetAdvisoryScriptURI() const {
   return advisory_script_uri_;
 }
@@ -120,8 +143,20 @@ void UIDartState::AddOrRemoveTaskObserver(bool add) {
   }
   FML_DCHECK(add_callback_ && remove_callback_);
   if (add) {
-    add_callback_(reinterpret_cast<intptr_t>(this),
-                  [this]() { this->FlushMicrotasksNow(); });
+    add_callback_(reinterpret_cast<intptr_t>(this), [this]() {
+      // This observer runs after every task on the UI loop, hundreds of
+      // times per frame, and most turns queue no microtasks and allocate
+      // nothing. Check the dirty state here instead of paying for an empty
+      // flush and reset on each of them.
+      if (this->microtask_queue_.HasMicrotasks()) {
+        this->FlushMicrotasksNow();
+      }
+      if (!this->scratch_arena_.IsClean()) {
+        // The turn is over; any scratch buffers handed out to bindings
+        // during it (including the microtasks above) are now dead.
+        this->scratch_arena_.Reset();
+      }
+    });
   } else {
     remove_callback_(reinterpret_cast<intptr_t>(this));
   }
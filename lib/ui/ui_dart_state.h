@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
@@ -18,6 +19,7 @@
 #include "flutter/lib/ui/io_manager.h"
 #include "flutter/lib/ui/isolate_name_server/isolate_name_server.h"
 #include "flutter/lib/ui/painting/image_decoder.h"
+#include "flutter/lib/ui/scratch_arena.h"
 #include "flutter/lib/ui/snapshot_delegate.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 #include "third_party/skia/include/gpu/GrContext.h"
@@ -25,6 +27,10 @@
 #include "third_party/tonic/dart_persistent_value.h"
 #include "third_party/tonic/dart_state.h"
 
+namespace txt {
+class ParagraphBuilder;
+}  // namespace txt
+
 namespace flutter {
 class FontSelector;
 class Window;
@@ -62,6 +68,20 @@ class UIDartState : public tonic::DartState {
 
   fml::WeakPtr<ImageDecoder> GetImageDecoder() const;
 
+  // Scratch space for transient buffers inside native bindings; reset at the
+  // end of every message loop turn. See |ScratchArena| for the lifetime
+  // rules.
+  ScratchArena& scratch_arena() { return scratch_arena_; }
+
+  // Takes a recycled paragraph builder from the per-isolate pool, or returns
+  // nullptr if the pool is empty. The caller must |Reset| the builder before
+  // use.
+  std::unique_ptr<txt::ParagraphBuilder> TakeParagraphBuilder();
+
+  // Returns a paragraph builder to the pool so a subsequent paragraph can
+  // reuse its allocations. Builders beyond the pool capacity are destroyed.
+  void RecycleParagraphBuilder(std::unique_ptr<txt::ParagraphBuilder> builder);
+
   std::shared_ptr<IsolateNameServer> GetIsolateNameServer() const;
 
   tonic::DartErrorHandleType GetLastError();
@@ -121,6 +141,8 @@ class UIDartState : public tonic::DartState {
   std::string debug_name_;
   std::unique_ptr<Window> window_;
   tonic::DartMicrotaskQueue microtask_queue_;
+  ScratchArena scratch_arena_;
+  std::vector<std::unique_ptr<txt::ParagraphBuilder>> paragraph_builder_pool_;
   UnhandledExceptionCallback unhandled_exception_callback_;
   const std::shared_ptr<IsolateNameServer> isolate_name_server_;
 
@@ -84,13 +84,16 @@ enum FramePhase {
 class FrameTiming {
   /// Construct [FrameTiming] with raw timestamps in microseconds.
   ///
-  /// List [timestamps] must have the same number of elements as
-  /// [FramePhase.values].
+  /// List [timestamps] must have one element per [FramePhase.values], and may
+  /// carry one extra trailing element holding the GPU duration reported by the
+  /// engine (see [gpuDuration]).
   ///
   /// This constructor is usually only called by the Flutter engine, or a test.
   /// To get the [FrameTiming] of your app, see [Window.onReportTimings].
   FrameTiming(List<int/*!*/>/*!*/ timestamps)
-      : assert(timestamps.length == FramePhase.values.length), _timestamps = timestamps;
+      : assert(timestamps.length == FramePhase.values.length ||
+               timestamps.length == FramePhase.values.length + 1),
+        _timestamps = timestamps;
 
   /// This is a raw timestamp in microseconds from some epoch. The epoch in all
   /// [FrameTiming] is the same, but it may not match [DateTime]'s epoch.
@@ -130,6 +133,20 @@ class FrameTiming {
   /// See also [buildDuration] and [rasterDuration].
   Duration/*!*/ get totalSpan => _rawDuration(FramePhase.rasterFinish) - _rawDuration(FramePhase.buildStart);
 
+  /// The time the GPU spent executing this frame's commands, or null when the
+  /// rendering backend cannot measure it.
+  ///
+  /// GPU timer query results are read back asynchronously, so this is
+  /// typically the measurement of a frame presented shortly before this one
+  /// rather than of this exact frame.
+  Duration/*?*/ get gpuDuration {
+    if (_timestamps.length <= FramePhase.values.length) {
+      return null;
+    }
+    final int micros = _timestamps[FramePhase.values.length];
+    return micros < 0 ? null : Duration(microseconds: micros);
+  }
+
   final List<int/*!*/>/*!*/ _timestamps;  // in microseconds
 
   String _formatMS(Duration duration) => '${duration.inMicroseconds * 0.001}ms';
@@ -1161,6 +1178,33 @@ class Window {
                               PlatformMessageResponseCallback/*?*/ callback,
                               ByteData/*?*/ data) native 'Window_sendPlatformMessage';
 
+  /// Routes incoming platform messages on the channel `name` to `port`
+  /// instead of [onPlatformMessage].
+  ///
+  /// The [SendPort] typically belongs to a [ReceivePort] created by a worker
+  /// isolate, whose port was handed to the main isolate during the usual
+  /// [Isolate.spawn] handshake. Messages on a registered channel are posted
+  /// to the port directly from the platform thread, so they are handled on
+  /// the worker isolate without ever waking the UI isolate. This suits
+  /// high-rate fire-and-forget channels such as sensor feeds.
+  ///
+  /// Each message arrives on the port as a [ByteData]-compatible list of
+  /// bytes (or null for messages without a payload). Messages delivered this
+  /// way cannot carry a reply callback; if the platform side expects a
+  /// response, it receives an empty one, and any actual reply must be sent
+  /// with an ordinary platform channel message from the worker isolate.
+  ///
+  /// Pass null for `port` to unregister the channel and restore delivery to
+  /// [onPlatformMessage].
+  void registerBackgroundPlatformChannel(String/*!*/ name, SendPort/*?*/ port) {
+    final String error = _registerBackgroundPlatformChannel(name, port);
+    if (error != null)
+      throw Exception(error);
+  }
+  String _registerBackgroundPlatformChannel(String/*!*/ name,
+                                            SendPort/*?*/ port)
+      native 'Window_registerBackgroundPlatformChannel';
+
   /// Called whenever this window receives a message from a platform-specific
   /// plugin.
   ///
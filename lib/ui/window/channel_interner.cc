@@ -0,0 +1,36 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/window/channel_interner.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace flutter {
+
+size_t ChannelInterner::GetId(const std::string& channel) {
+  static std::mutex mutex;
+  static std::unordered_map<std::string, size_t> ids = {
+      {"flutter/assets", kAssetChannelId},
+      {"flutter/lifecycle", kLifecycleChannelId},
+      {"flutter/navigation", kNavigationChannelId},
+      {"flutter/localization", kLocalizationChannelId},
+      {"flutter/settings", kSettingsChannelId},
+      {"flutter/isolate", kIsolateChannelId},
+      {"flutter/skia", kSkiaChannelId},
+      {"flutter/system", kSystemChannelId},
+  };
+  static size_t next_id = kFirstDynamicChannelId;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto found = ids.find(channel);
+  if (found != ids.end()) {
+    return found->second;
+  }
+  const size_t id = next_id++;
+  ids[channel] = id;
+  return id;
+}
+
+}  // namespace flutter
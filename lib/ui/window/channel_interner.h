@@ -0,0 +1,44 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_WINDOW_CHANNEL_INTERNER_H_
+#define FLUTTER_LIB_UI_WINDOW_CHANNEL_INTERNER_H_
+
+#include <cstddef>
+#include <string>
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Maps platform channel names to stable process-wide integer ids. A channel
+/// name is hashed once, when a |PlatformMessage| is constructed; routing code
+/// then compares ids instead of re-comparing channel strings on every message,
+/// which matters for busy plugin channels that deliver thousands of messages
+/// per second.
+///
+class ChannelInterner {
+ public:
+  /// The channels the engine itself routes on have fixed ids so dispatch
+  /// code can switch on compile time constants.
+  static constexpr size_t kAssetChannelId = 0;
+  static constexpr size_t kLifecycleChannelId = 1;
+  static constexpr size_t kNavigationChannelId = 2;
+  static constexpr size_t kLocalizationChannelId = 3;
+  static constexpr size_t kSettingsChannelId = 4;
+  static constexpr size_t kIsolateChannelId = 5;
+  static constexpr size_t kSkiaChannelId = 6;
+  static constexpr size_t kSystemChannelId = 7;
+
+  /// The first id handed out to channels without a fixed assignment.
+  static constexpr size_t kFirstDynamicChannelId = 8;
+
+  /// Returns the id for the given channel, assigning the next free dynamic
+  /// id the first time a name is seen. Ids are never reused within a
+  /// process. Safe to call from any thread.
+  static size_t GetId(const std::string& channel);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_WINDOW_CHANNEL_INTERNER_H_
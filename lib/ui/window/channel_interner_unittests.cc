@@ -0,0 +1,47 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/window/channel_interner.h"
+
+#include "flutter/lib/ui/window/platform_message.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(ChannelInternerTest, AssignsFixedIdsToEngineChannels) {
+  ASSERT_EQ(ChannelInterner::GetId("flutter/assets"),
+            ChannelInterner::kAssetChannelId);
+  ASSERT_EQ(ChannelInterner::GetId("flutter/lifecycle"),
+            ChannelInterner::kLifecycleChannelId);
+  ASSERT_EQ(ChannelInterner::GetId("flutter/navigation"),
+            ChannelInterner::kNavigationChannelId);
+  ASSERT_EQ(ChannelInterner::GetId("flutter/settings"),
+            ChannelInterner::kSettingsChannelId);
+  ASSERT_EQ(ChannelInterner::GetId("flutter/skia"),
+            ChannelInterner::kSkiaChannelId);
+}
+
+TEST(ChannelInternerTest, AssignsStableDistinctDynamicIds) {
+  const size_t first = ChannelInterner::GetId("plugins.test/one");
+  const size_t second = ChannelInterner::GetId("plugins.test/two");
+  ASSERT_GE(first, ChannelInterner::kFirstDynamicChannelId);
+  ASSERT_NE(first, second);
+  ASSERT_EQ(ChannelInterner::GetId("plugins.test/one"), first);
+  ASSERT_EQ(ChannelInterner::GetId("plugins.test/two"), second);
+}
+
+TEST(ChannelInternerTest, PlatformMessagesCarryTheirChannelId) {
+  auto message =
+      fml::MakeRefCounted<PlatformMessage>("flutter/lifecycle", nullptr);
+  ASSERT_EQ(message->channel_id(), ChannelInterner::kLifecycleChannelId);
+
+  auto plugin_message =
+      fml::MakeRefCounted<PlatformMessage>("plugins.test/three", nullptr);
+  ASSERT_EQ(plugin_message->channel_id(),
+            ChannelInterner::GetId("plugins.test/three"));
+}
+
+}  // namespace testing
+}  // namespace flutter
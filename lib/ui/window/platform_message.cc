@@ -6,20 +6,29 @@
 
 #include <utility>
 
+#include "flutter/lib/ui/window/channel_interner.h"
+
 namespace flutter {
 
 PlatformMessage::PlatformMessage(std::string channel,
-                                 std::vector<uint8_t> data,
+                                 std::unique_ptr<fml::Mapping> data,
                                  fml::RefPtr<PlatformMessageResponse> response)
     : channel_(std::move(channel)),
+      channel_id_(ChannelInterner::GetId(channel_)),
       data_(std::move(data)),
-      hasData_(true),
+      response_(std::move(response)) {}
+PlatformMessage::PlatformMessage(std::string channel,
+                                 std::vector<uint8_t> data,
+                                 fml::RefPtr<PlatformMessageResponse> response)
+    : channel_(std::move(channel)),
+      channel_id_(ChannelInterner::GetId(channel_)),
+      data_(std::make_unique<fml::DataMapping>(std::move(data))),
       response_(std::move(response)) {}
 PlatformMessage::PlatformMessage(std::string channel,
                                  fml::RefPtr<PlatformMessageResponse> response)
     : channel_(std::move(channel)),
-      data_(),
-      hasData_(false),
+      channel_id_(ChannelInterner::GetId(channel_)),
+      data_(nullptr),
       response_(std::move(response)) {}
 
 PlatformMessage::~PlatformMessage() = default;
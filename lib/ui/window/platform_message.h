@@ -5,9 +5,11 @@
 #ifndef FLUTTER_LIB_UI_PLATFORM_PLATFORM_MESSAGE_H_
 #define FLUTTER_LIB_UI_PLATFORM_PLATFORM_MESSAGE_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "flutter/fml/mapping.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/ref_ptr.h"
 #include "flutter/lib/ui/window/platform_message_response.h"
@@ -20,14 +22,29 @@ class PlatformMessage : public fml::RefCountedThreadSafe<PlatformMessage> {
 
  public:
   const std::string& channel() const { return channel_; }
-  const std::vector<uint8_t>& data() const { return data_; }
-  bool hasData() { return hasData_; }
+
+  // The interned id of channel(), resolved once at construction. Routing
+  // code compares this instead of the channel string; see |ChannelInterner|.
+  size_t channel_id() const { return channel_id_; }
+
+  // Only valid if hasData() is true.
+  const fml::Mapping& data() const { return *data_; }
+
+  bool hasData() { return data_ != nullptr; }
+
+  // Transfers ownership of the payload to the caller, for handing the bytes
+  // to their final consumer (e.g. as external typed data in Dart) without a
+  // copy. hasData() is false afterwards.
+  std::unique_ptr<fml::Mapping> releaseData() { return std::move(data_); }
 
   const fml::RefPtr<PlatformMessageResponse>& response() const {
     return response_;
   }
 
  private:
+  PlatformMessage(std::string channel,
+                  std::unique_ptr<fml::Mapping> data,
+                  fml::RefPtr<PlatformMessageResponse> response);
   PlatformMessage(std::string channel,
                   std::vector<uint8_t> data,
                   fml::RefPtr<PlatformMessageResponse> response);
@@ -36,8 +53,8 @@ class PlatformMessage : public fml::RefCountedThreadSafe<PlatformMessage> {
   ~PlatformMessage();
 
   std::string channel_;
-  std::vector<uint8_t> data_;
-  bool hasData_;
+  size_t channel_id_;
+  std::unique_ptr<fml::Mapping> data_;
   fml::RefPtr<PlatformMessageResponse> response_;
 };
 
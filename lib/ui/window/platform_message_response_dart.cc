@@ -4,9 +4,13 @@
 
 #include "flutter/lib/ui/window/platform_message_response_dart.h"
 
+#include <map>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 #include "flutter/common/task_runners.h"
+#include "flutter/fml/closure.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/lib/ui/window/window.h"
 #include "third_party/tonic/dart_state.h"
@@ -38,11 +42,84 @@ Dart_Handle WrapByteData(std::vector<uint8_t> data) {
 }
 
 Dart_Handle WrapByteData(std::unique_ptr<fml::Mapping> mapping) {
-  std::vector<uint8_t> data(mapping->GetSize());
-  memcpy(data.data(), mapping->GetMapping(), mapping->GetSize());
-  return WrapByteData(std::move(data));
+  if (mapping->GetSize() < kMessageCopyThreshold) {
+    // Small payloads are cheaper to copy than to track as external typed
+    // data.
+    std::vector<uint8_t> data(mapping->GetMapping(),
+                              mapping->GetMapping() + mapping->GetSize());
+    return ToByteData(data);
+  }
+  return ToByteData(std::move(mapping));
 }
 
+// Coalesces response completions destined for the same UI task runner into
+// one posted task per loop turn. High-frequency channels complete hundreds
+// of responses per second from the platform thread; only the first response
+// of a burst pays for a cross-thread task post, and the rest ride along in
+// the drain that task performs. Completions for a given runner still run in
+// the order they were enqueued.
+//
+// The batcher is process-wide and leaked: responses may outlive any one
+// engine, and the pending map is keyed per task runner so engines do not
+// share queues. Each entry holds a reference to its task runner, so a live
+// entry can never alias a later runner allocated at the same address; if a
+// runner's queue is torn down with a drain still queued, the entry (and the
+// reference pinning it) persists harmlessly until process exit.
+class ResponseBatcher {
+ public:
+  static ResponseBatcher& Shared() {
+    static ResponseBatcher* batcher = new ResponseBatcher();
+    return *batcher;
+  }
+
+  void Enqueue(fml::RefPtr<fml::TaskRunner> ui_task_runner,
+               fml::closure response) {
+    bool needs_post = false;
+    auto* key = ui_task_runner.get();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& batch = pending_[key];
+      if (!batch.runner) {
+        batch.runner = ui_task_runner;
+      }
+      needs_post = batch.responses.empty();
+      batch.responses.push_back(std::move(response));
+    }
+    if (needs_post) {
+      ui_task_runner->PostTask([this, key]() { Drain(key); });
+    }
+  }
+
+ private:
+  struct PendingBatch {
+    // Keeps the task runner alive while responses are pending so the raw
+    // pointer key stays unique for the lifetime of the entry.
+    fml::RefPtr<fml::TaskRunner> runner;
+    std::vector<fml::closure> responses;
+  };
+
+  ResponseBatcher() = default;
+
+  void Drain(fml::TaskRunner* key) {
+    std::vector<fml::closure> responses;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto found = pending_.find(key);
+      if (found == pending_.end()) {
+        return;
+      }
+      responses = std::move(found->second.responses);
+      pending_.erase(found);
+    }
+    for (auto& response : responses) {
+      response();
+    }
+  }
+
+  std::mutex mutex_;
+  std::map<fml::TaskRunner*, PendingBatch> pending_;
+};
+
 }  // anonymous namespace
 
 PlatformMessageResponseDart::PlatformMessageResponseDart(
@@ -53,8 +130,10 @@ PlatformMessageResponseDart::PlatformMessageResponseDart(
 
 PlatformMessageResponseDart::~PlatformMessageResponseDart() {
   if (!callback_.is_empty()) {
-    ui_task_runner_->PostTask(fml::MakeCopyable(
-        [callback = std::move(callback_)]() mutable { callback.Clear(); }));
+    ResponseBatcher::Shared().Enqueue(
+        ui_task_runner_,
+        fml::MakeCopyable(
+            [callback = std::move(callback_)]() mutable { callback.Clear(); }));
   }
 }
 
@@ -63,17 +142,19 @@ void PlatformMessageResponseDart::Complete(std::unique_ptr<fml::Mapping> data) {
     return;
   FML_DCHECK(!is_complete_);
   is_complete_ = true;
-  ui_task_runner_->PostTask(fml::MakeCopyable(
-      [callback = std::move(callback_), data = std::move(data)]() mutable {
-        std::shared_ptr<tonic::DartState> dart_state =
-            callback.dart_state().lock();
-        if (!dart_state)
-          return;
-        tonic::DartState::Scope scope(dart_state);
-
-        Dart_Handle byte_buffer = WrapByteData(std::move(data));
-        tonic::DartInvoke(callback.Release(), {byte_buffer});
-      }));
+  ResponseBatcher::Shared().Enqueue(
+      ui_task_runner_,
+      fml::MakeCopyable(
+          [callback = std::move(callback_), data = std::move(data)]() mutable {
+            std::shared_ptr<tonic::DartState> dart_state =
+                callback.dart_state().lock();
+            if (!dart_state)
+              return;
+            tonic::DartState::Scope scope(dart_state);
+
+            Dart_Handle byte_buffer = WrapByteData(std::move(data));
+            tonic::DartInvoke(callback.Release(), {byte_buffer});
+          }));
 }
 
 void PlatformMessageResponseDart::CompleteEmpty() {
@@ -81,7 +162,10 @@ void PlatformMessageResponseDart::CompleteEmpty() {
     return;
   FML_DCHECK(!is_complete_);
   is_complete_ = true;
-  ui_task_runner_->PostTask(
+  // Empty completions are the common ack case; the batch entry is just the
+  // callback invoked with a null payload, with no buffer wrapping at all.
+  ResponseBatcher::Shared().Enqueue(
+      ui_task_runner_,
       fml::MakeCopyable([callback = std::move(callback_)]() mutable {
         std::shared_ptr<tonic::DartState> dart_state =
             callback.dart_state().lock();
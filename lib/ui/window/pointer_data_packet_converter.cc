@@ -9,35 +9,140 @@
 
 namespace flutter {
 
+namespace {
+
+// Initial slot count of the device state cache. Most sessions never see more
+// than a handful of simultaneous devices.
+constexpr size_t kInitialSlotCount = 8;
+
+// Fibonacci hashing spreads the small, often sequential device ids that
+// platforms hand out across the table.
+constexpr uint64_t kHashMultiplier = 0x9E3779B97F4A7C15ull;
+
+}  // namespace
+
+DeviceStateCache::DeviceStateCache() : slots_(kInitialSlotCount) {}
+
+size_t DeviceStateCache::SlotIndex(int64_t device) const {
+  return (static_cast<uint64_t>(device) * kHashMultiplier) &
+         (slots_.size() - 1);
+}
+
+DeviceStateCache::Slot* DeviceStateCache::Probe(int64_t device) {
+  size_t index = SlotIndex(device);
+  Slot* insertion_slot = nullptr;
+  while (true) {
+    Slot& slot = slots_[index];
+    switch (slot.use) {
+      case SlotUse::kEmpty:
+        // The device is not in the table; reuse a tombstone passed along the
+        // way if there was one.
+        return insertion_slot ? insertion_slot : &slot;
+      case SlotUse::kTombstone:
+        if (insertion_slot == nullptr) {
+          insertion_slot = &slot;
+        }
+        break;
+      case SlotUse::kOccupied:
+        if (slot.device == device) {
+          return &slot;
+        }
+        break;
+    }
+    index = (index + 1) & (slots_.size() - 1);
+  }
+}
+
+PointerState* DeviceStateCache::Find(int64_t device) {
+  if (last_slot_ != nullptr && last_slot_->use == SlotUse::kOccupied &&
+      last_slot_->device == device) {
+    return &last_slot_->state;
+  }
+  Slot* slot = Probe(device);
+  if (slot->use != SlotUse::kOccupied) {
+    return nullptr;
+  }
+  last_slot_ = slot;
+  return &slot->state;
+}
+
+PointerState& DeviceStateCache::Insert(int64_t device,
+                                       const PointerState& state) {
+  Slot* slot = Probe(device);
+  if (slot->use != SlotUse::kOccupied) {
+    if (slot->use == SlotUse::kEmpty && (used_ + 1) * 4 >= slots_.size() * 3) {
+      Grow();
+      slot = Probe(device);
+    }
+    if (slot->use == SlotUse::kEmpty) {
+      used_++;
+    }
+    slot->use = SlotUse::kOccupied;
+    slot->device = device;
+    occupied_++;
+  }
+  slot->state = state;
+  last_slot_ = slot;
+  return slot->state;
+}
+
+void DeviceStateCache::Erase(int64_t device) {
+  Slot* slot = Probe(device);
+  if (slot->use != SlotUse::kOccupied) {
+    return;
+  }
+  slot->use = SlotUse::kTombstone;
+  occupied_--;
+  last_slot_ = nullptr;
+}
+
+void DeviceStateCache::Grow() {
+  std::vector<Slot> old_slots(slots_.size() * 2);
+  old_slots.swap(slots_);
+  // Rehashing drops the tombstones along with the old table.
+  occupied_ = 0;
+  used_ = 0;
+  last_slot_ = nullptr;
+  for (const Slot& slot : old_slots) {
+    if (slot.use == SlotUse::kOccupied) {
+      Insert(slot.device, slot.state);
+    }
+  }
+}
+
 PointerDataPacketConverter::PointerDataPacketConverter() : pointer_(0) {}
 
 PointerDataPacketConverter::~PointerDataPacketConverter() = default;
 
 std::unique_ptr<PointerDataPacket> PointerDataPacketConverter::Convert(
     std::unique_ptr<PointerDataPacket> packet) {
-  size_t kBytesPerPointerData = kPointerDataFieldCount * kBytesPerField;
-  auto buffer = packet->data();
-  size_t buffer_length = buffer.size();
+  const auto& buffer = packet->data();
+  const size_t pointer_count =
+      buffer.size() / (kPointerDataFieldCount * kBytesPerField);
 
   std::vector<PointerData> converted_pointers;
-  // Converts each pointer data in the buffer and stores it in the
-  // converted_pointers.
-  for (size_t i = 0; i < buffer_length / kBytesPerPointerData; i++) {
-    PointerData pointer_data;
-    memcpy(&pointer_data, &buffer[i * kBytesPerPointerData],
-           sizeof(PointerData));
-    ConvertPointerData(pointer_data, converted_pointers);
+  // Most packets need no synthesis at all, so reserving the input size
+  // avoids regrowth on the hot path without overcommitting.
+  converted_pointers.reserve(pointer_count);
+
+  // PointerData is 8 byte aligned and packed to exactly
+  // kPointerDataFieldCount fields (hooks.dart unpacks the same layout), so
+  // the events can be read in place rather than copied out one at a time.
+  const PointerData* pointers =
+      reinterpret_cast<const PointerData*>(buffer.data());
+  for (size_t i = 0; i < pointer_count; i++) {
+    ConvertPointerData(pointers[i], converted_pointers);
   }
 
-  // Writes converted_pointers into converted_packet.
-  auto converted_packet =
-      std::make_unique<flutter::PointerDataPacket>(converted_pointers.size());
-  size_t count = 0;
-  for (auto& converted_pointer : converted_pointers) {
-    converted_packet->SetPointerData(count++, converted_pointer);
+  if (converted_pointers.empty()) {
+    return std::make_unique<flutter::PointerDataPacket>(0);
   }
 
-  return converted_packet;
+  // The converted events are contiguous, so a single copy builds the
+  // outgoing packet.
+  return std::make_unique<flutter::PointerDataPacket>(
+      reinterpret_cast<uint8_t*>(converted_pointers.data()),
+      converted_pointers.size() * sizeof(PointerData));
 }
 
 void PointerDataPacketConverter::ConvertPointerData(
@@ -50,151 +155,137 @@ void PointerDataPacketConverter::ConvertPointerData(
         // to a non-existing pointer. Drops the cancel if pointer
         // is not previously added.
         // https://github.com/flutter/flutter/issues/20517
-        auto iter = states_.find(pointer_data.device);
-        if (iter != states_.end()) {
-          PointerState state = iter->second;
-          FML_DCHECK(state.isDown);
-          UpdatePointerIdentifier(pointer_data, state, false);
+        PointerState* state = states_.Find(pointer_data.device);
+        if (state != nullptr) {
+          FML_DCHECK(state->isDown);
+          UpdatePointerIdentifier(pointer_data, *state, false);
 
-          if (LocationNeedsUpdate(pointer_data, state)) {
+          if (LocationNeedsUpdate(pointer_data, *state)) {
             // Synthesizes a move event if the location does not match.
             PointerData synthesized_move_event = pointer_data;
             synthesized_move_event.change = PointerData::Change::kMove;
             synthesized_move_event.synthesized = 1;
 
-            UpdateDeltaAndState(synthesized_move_event, state);
+            UpdateDeltaAndState(synthesized_move_event, *state);
             converted_pointers.push_back(synthesized_move_event);
           }
 
-          state.isDown = false;
-          states_[pointer_data.device] = state;
+          state->isDown = false;
           converted_pointers.push_back(pointer_data);
         }
         break;
       }
       case PointerData::Change::kAdd: {
-        FML_DCHECK(states_.find(pointer_data.device) == states_.end());
+        FML_DCHECK(states_.Find(pointer_data.device) == nullptr);
         EnsurePointerState(pointer_data);
         converted_pointers.push_back(pointer_data);
         break;
       }
       case PointerData::Change::kRemove: {
         // Makes sure we have an existing pointer
-        auto iter = states_.find(pointer_data.device);
-        FML_DCHECK(iter != states_.end());
-        PointerState state = iter->second;
+        PointerState* state = states_.Find(pointer_data.device);
+        FML_DCHECK(state != nullptr);
 
-        if (state.isDown) {
+        if (state->isDown) {
           // Synthesizes cancel event if the pointer is down.
           PointerData synthesized_cancel_event = pointer_data;
           synthesized_cancel_event.change = PointerData::Change::kCancel;
           synthesized_cancel_event.synthesized = 1;
-          UpdatePointerIdentifier(synthesized_cancel_event, state, false);
+          UpdatePointerIdentifier(synthesized_cancel_event, *state, false);
 
-          state.isDown = false;
-          states_[synthesized_cancel_event.device] = state;
+          state->isDown = false;
           converted_pointers.push_back(synthesized_cancel_event);
         }
 
-        if (LocationNeedsUpdate(pointer_data, state)) {
+        if (LocationNeedsUpdate(pointer_data, *state)) {
           // Synthesizes a hover event if the location does not match.
           PointerData synthesized_hover_event = pointer_data;
           synthesized_hover_event.change = PointerData::Change::kHover;
           synthesized_hover_event.synthesized = 1;
 
-          UpdateDeltaAndState(synthesized_hover_event, state);
+          UpdateDeltaAndState(synthesized_hover_event, *state);
           converted_pointers.push_back(synthesized_hover_event);
         }
 
-        states_.erase(pointer_data.device);
+        states_.Erase(pointer_data.device);
         converted_pointers.push_back(pointer_data);
         break;
       }
       case PointerData::Change::kHover: {
-        auto iter = states_.find(pointer_data.device);
-        PointerState state;
-        if (iter == states_.end()) {
+        PointerState* state = states_.Find(pointer_data.device);
+        if (state == nullptr) {
           // Synthesizes add event if the pointer is not previously added.
           PointerData synthesized_add_event = pointer_data;
           synthesized_add_event.change = PointerData::Change::kAdd;
           synthesized_add_event.synthesized = 1;
-          state = EnsurePointerState(synthesized_add_event);
+          state = &EnsurePointerState(synthesized_add_event);
           converted_pointers.push_back(synthesized_add_event);
-        } else {
-          state = iter->second;
         }
 
-        FML_DCHECK(!state.isDown);
-        if (LocationNeedsUpdate(pointer_data, state)) {
-          UpdateDeltaAndState(pointer_data, state);
+        FML_DCHECK(!state->isDown);
+        if (LocationNeedsUpdate(pointer_data, *state)) {
+          UpdateDeltaAndState(pointer_data, *state);
           converted_pointers.push_back(pointer_data);
         }
         break;
       }
       case PointerData::Change::kDown: {
-        auto iter = states_.find(pointer_data.device);
-        PointerState state;
-        if (iter == states_.end()) {
+        PointerState* state = states_.Find(pointer_data.device);
+        if (state == nullptr) {
           // Synthesizes a add event if the pointer is not previously added.
           PointerData synthesized_add_event = pointer_data;
           synthesized_add_event.change = PointerData::Change::kAdd;
           synthesized_add_event.synthesized = 1;
-          state = EnsurePointerState(synthesized_add_event);
+          state = &EnsurePointerState(synthesized_add_event);
           converted_pointers.push_back(synthesized_add_event);
-        } else {
-          state = iter->second;
         }
 
-        FML_DCHECK(!state.isDown);
-        if (LocationNeedsUpdate(pointer_data, state)) {
+        FML_DCHECK(!state->isDown);
+        if (LocationNeedsUpdate(pointer_data, *state)) {
           // Synthesizes a hover event if the location does not match.
           PointerData synthesized_hover_event = pointer_data;
           synthesized_hover_event.change = PointerData::Change::kHover;
           synthesized_hover_event.synthesized = 1;
 
-          UpdateDeltaAndState(synthesized_hover_event, state);
+          UpdateDeltaAndState(synthesized_hover_event, *state);
           converted_pointers.push_back(synthesized_hover_event);
         }
 
-        UpdatePointerIdentifier(pointer_data, state, true);
-        state.isDown = true;
-        states_[pointer_data.device] = state;
+        UpdatePointerIdentifier(pointer_data, *state, true);
+        state->isDown = true;
         converted_pointers.push_back(pointer_data);
         break;
       }
       case PointerData::Change::kMove: {
         // Makes sure we have an existing pointer in down state
-        auto iter = states_.find(pointer_data.device);
-        FML_DCHECK(iter != states_.end());
-        PointerState state = iter->second;
-        FML_DCHECK(state.isDown);
+        PointerState* state = states_.Find(pointer_data.device);
+        FML_DCHECK(state != nullptr);
+        FML_DCHECK(state->isDown);
 
-        UpdatePointerIdentifier(pointer_data, state, false);
-        UpdateDeltaAndState(pointer_data, state);
+        UpdatePointerIdentifier(pointer_data, *state, false);
+        UpdateDeltaAndState(pointer_data, *state);
         converted_pointers.push_back(pointer_data);
         break;
       }
       case PointerData::Change::kUp: {
         // Makes sure we have an existing pointer in down state
-        auto iter = states_.find(pointer_data.device);
-        FML_DCHECK(iter != states_.end());
-        PointerState state = iter->second;
-        FML_DCHECK(state.isDown);
+        PointerState* state = states_.Find(pointer_data.device);
+        FML_DCHECK(state != nullptr);
+        FML_DCHECK(state->isDown);
 
-        UpdatePointerIdentifier(pointer_data, state, false);
+        UpdatePointerIdentifier(pointer_data, *state, false);
 
-        if (LocationNeedsUpdate(pointer_data, state)) {
+        if (LocationNeedsUpdate(pointer_data, *state)) {
           // Synthesizes a move event if the location does not match.
           PointerData synthesized_move_event = pointer_data;
           synthesized_move_event.change = PointerData::Change::kMove;
           synthesized_move_event.synthesized = 1;
 
-          UpdateDeltaAndState(synthesized_move_event, state);
+          UpdateDeltaAndState(synthesized_move_event, *state);
           converted_pointers.push_back(synthesized_move_event);
         }
 
-        state.isDown = false;
-        states_[pointer_data.device] = state;
+        state->isDown = false;
         converted_pointers.push_back(pointer_data);
         break;
       }
@@ -207,19 +298,18 @@ void PointerDataPacketConverter::ConvertPointerData(
     switch (pointer_data.signal_kind) {
       case PointerData::SignalKind::kScroll: {
         // Makes sure we have an existing pointer
-        auto iter = states_.find(pointer_data.device);
-        FML_DCHECK(iter != states_.end());
+        PointerState* state = states_.Find(pointer_data.device);
+        FML_DCHECK(state != nullptr);
 
-        PointerState state = iter->second;
-        if (LocationNeedsUpdate(pointer_data, state)) {
-          if (state.isDown) {
+        if (LocationNeedsUpdate(pointer_data, *state)) {
+          if (state->isDown) {
             // Synthesizes a move event if the pointer is down.
             PointerData synthesized_move_event = pointer_data;
             synthesized_move_event.signal_kind = PointerData::SignalKind::kNone;
             synthesized_move_event.change = PointerData::Change::kMove;
             synthesized_move_event.synthesized = 1;
 
-            UpdateDeltaAndState(synthesized_move_event, state);
+            UpdateDeltaAndState(synthesized_move_event, *state);
             converted_pointers.push_back(synthesized_move_event);
           } else {
             // Synthesizes a hover event if the pointer is up.
@@ -229,7 +319,7 @@ void PointerDataPacketConverter::ConvertPointerData(
             synthesized_hover_event.change = PointerData::Change::kHover;
             synthesized_hover_event.synthesized = 1;
 
-            UpdateDeltaAndState(synthesized_hover_event, state);
+            UpdateDeltaAndState(synthesized_hover_event, *state);
             converted_pointers.push_back(synthesized_hover_event);
           }
         }
@@ -245,15 +335,14 @@ void PointerDataPacketConverter::ConvertPointerData(
   }
 }
 
-PointerState PointerDataPacketConverter::EnsurePointerState(
-    PointerData pointer_data) {
+PointerState& PointerDataPacketConverter::EnsurePointerState(
+    const PointerData& pointer_data) {
   PointerState state;
   state.pointer_identifier = 0;
   state.isDown = false;
   state.physical_x = pointer_data.physical_x;
   state.physical_y = pointer_data.physical_y;
-  states_[pointer_data.device] = state;
-  return state;
+  return states_.Insert(pointer_data.device, state);
 }
 
 void PointerDataPacketConverter::UpdateDeltaAndState(PointerData& pointer_data,
@@ -262,12 +351,11 @@ void PointerDataPacketConverter::UpdateDeltaAndState(PointerData& pointer_data,
   pointer_data.physical_delta_y = pointer_data.physical_y - state.physical_y;
   state.physical_x = pointer_data.physical_x;
   state.physical_y = pointer_data.physical_y;
-  states_[pointer_data.device] = state;
 }
 
 bool PointerDataPacketConverter::LocationNeedsUpdate(
-    const PointerData pointer_data,
-    const PointerState state) {
+    const PointerData& pointer_data,
+    const PointerState& state) {
   return state.physical_x != pointer_data.physical_x ||
          state.physical_y != pointer_data.physical_y;
 }
@@ -278,7 +366,6 @@ void PointerDataPacketConverter::UpdatePointerIdentifier(
     bool start_new_pointer) {
   if (start_new_pointer) {
     state.pointer_identifier = ++pointer_;
-    states_[pointer_data.device] = state;
   }
   pointer_data.pointer_identifier = state.pointer_identifier;
 }
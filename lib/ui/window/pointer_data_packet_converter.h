@@ -7,7 +7,6 @@
 
 #include <string.h>
 
-#include <map>
 #include <memory>
 #include <vector>
 
@@ -28,6 +27,70 @@ struct PointerState {
   double physical_y;
 };
 
+//------------------------------------------------------------------------------
+/// An open addressed hash table mapping device ids to their PointerState.
+///
+/// Every event in a packet needs its device state, and packets arrive at
+/// input rates (a stylus alone reports at up to 240Hz). States therefore
+/// live in a flat, power-of-two sized slot array probed linearly instead of
+/// a node based associative container, and consecutive events from the same
+/// device hit a single entry fast path without hashing at all.
+///
+class DeviceStateCache {
+ public:
+  DeviceStateCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Looks up the state for a device.
+  ///
+  /// @param[in]  device  The device id.
+  ///
+  /// @return     The stored state, or nullptr if the device is unknown. The
+  ///             pointer stays valid until the next call to Insert or Erase.
+  ///
+  PointerState* Find(int64_t device);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Inserts (or replaces) the state for a device.
+  ///
+  /// @return     A reference to the stored copy, valid until the next call
+  ///             to Insert or Erase.
+  ///
+  PointerState& Insert(int64_t device, const PointerState& state);
+
+  void Erase(int64_t device);
+
+ private:
+  enum class SlotUse : uint8_t {
+    kEmpty,
+    kOccupied,
+    // Erased slots cannot revert to empty without breaking probe chains
+    // that stepped over them; they stay reusable for insertions instead.
+    kTombstone,
+  };
+
+  struct Slot {
+    SlotUse use = SlotUse::kEmpty;
+    int64_t device = 0;
+    PointerState state;
+  };
+
+  size_t SlotIndex(int64_t device) const;
+  Slot* Probe(int64_t device);
+  void Grow();
+
+  std::vector<Slot> slots_;
+  size_t occupied_ = 0;
+  // Slots that are not empty (occupied or tombstones); this is what bounds
+  // probe lengths, so it is what drives rehashing.
+  size_t used_ = 0;
+  // The slot the previous lookup resolved to; input packets are dominated
+  // by runs of events from a single device.
+  Slot* last_slot_ = nullptr;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DeviceStateCache);
+};
+
 //------------------------------------------------------------------------------
 /// Converter to convert the raw pointer data packet from the platforms.
 ///
@@ -85,14 +148,14 @@ class PointerDataPacketConverter {
       std::unique_ptr<PointerDataPacket> packet);
 
  private:
-  std::map<int64_t, PointerState> states_;
+  DeviceStateCache states_;
 
   int64_t pointer_;
 
   void ConvertPointerData(PointerData pointer_data,
                           std::vector<PointerData>& converted_pointers);
 
-  PointerState EnsurePointerState(PointerData pointer_data);
+  PointerState& EnsurePointerState(const PointerData& pointer_data);
 
   void UpdateDeltaAndState(PointerData& pointer_data, PointerState& state);
 
@@ -100,8 +163,8 @@ class PointerDataPacketConverter {
                                PointerState& state,
                                bool start_new_pointer);
 
-  bool LocationNeedsUpdate(const PointerData pointer_data,
-                           const PointerState state);
+  bool LocationNeedsUpdate(const PointerData& pointer_data,
+                           const PointerState& state);
 
   FML_DISALLOW_COPY_AND_ASSIGN(PointerDataPacketConverter);
 };
@@ -0,0 +1,121 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/lib/ui/window/pointer_data_packet_converter.h"
+
+namespace flutter {
+
+namespace {
+
+PointerData CreatePointerData(PointerData::Change change,
+                              int64_t device,
+                              double dx,
+                              double dy) {
+  PointerData data;
+  data.Clear();
+  data.change = change;
+  data.kind = PointerData::DeviceKind::kTouch;
+  data.signal_kind = PointerData::SignalKind::kNone;
+  data.device = device;
+  data.physical_x = dx;
+  data.physical_y = dy;
+  return data;
+}
+
+// Puts the devices into the down state expected by move events.
+void PressDevices(PointerDataPacketConverter& converter, int64_t device_count) {
+  auto setup = std::make_unique<PointerDataPacket>(device_count * 2);
+  for (int64_t device = 0; device < device_count; device++) {
+    setup->SetPointerData(
+        device * 2, CreatePointerData(PointerData::Change::kAdd, device, 0, 0));
+    setup->SetPointerData(
+        device * 2 + 1,
+        CreatePointerData(PointerData::Change::kDown, device, 0, 0));
+  }
+  converter.Convert(std::move(setup));
+}
+
+std::unique_ptr<PointerDataPacket> CreateMovePacket(size_t event_count,
+                                                    int64_t device_count,
+                                                    size_t iteration) {
+  auto packet = std::make_unique<PointerDataPacket>(event_count);
+  for (size_t i = 0; i < event_count; i++) {
+    const double position = static_cast<double>(iteration * event_count + i);
+    packet->SetPointerData(
+        i, CreatePointerData(PointerData::Change::kMove, i % device_count,
+                             position, position));
+  }
+  return packet;
+}
+
+}  // namespace
+
+// The hot path: a single device streaming move events, as a 240Hz stylus
+// does. Every event takes one state lookup and no synthesis.
+static void BM_ConvertSingleDeviceMoves(benchmark::State& state) {
+  PointerDataPacketConverter converter;
+  PressDevices(converter, 1);
+
+  constexpr size_t kEventsPerPacket = 240;
+  size_t iteration = 0;
+  while (state.KeepRunning()) {
+    std::unique_ptr<PointerDataPacket> packet;
+    {
+      benchmarking::ScopedPauseTiming pause(state);
+      packet = CreateMovePacket(kEventsPerPacket, 1, iteration++);
+    }
+    auto converted = converter.Convert(std::move(packet));
+    benchmark::DoNotOptimize(converted);
+  }
+}
+BENCHMARK(BM_ConvertSingleDeviceMoves);
+
+// Multitouch: interleaved move events from ten devices defeat the single
+// entry fast path and exercise the probing.
+static void BM_ConvertMultiDeviceMoves(benchmark::State& state) {
+  PointerDataPacketConverter converter;
+  constexpr int64_t kDeviceCount = 10;
+  PressDevices(converter, kDeviceCount);
+
+  constexpr size_t kEventsPerPacket = 240;
+  size_t iteration = 0;
+  while (state.KeepRunning()) {
+    std::unique_ptr<PointerDataPacket> packet;
+    {
+      benchmarking::ScopedPauseTiming pause(state);
+      packet = CreateMovePacket(kEventsPerPacket, kDeviceCount, iteration++);
+    }
+    auto converted = converter.Convert(std::move(packet));
+    benchmark::DoNotOptimize(converted);
+  }
+}
+BENCHMARK(BM_ConvertMultiDeviceMoves);
+
+// Hover events from unseen devices synthesize an add per device, the worst
+// case for both the state cache and the output packet.
+static void BM_ConvertHoverWithAddSynthesis(benchmark::State& state) {
+  constexpr size_t kEventsPerPacket = 240;
+  while (state.KeepRunning()) {
+    std::unique_ptr<PointerDataPacketConverter> converter;
+    std::unique_ptr<PointerDataPacket> packet;
+    {
+      benchmarking::ScopedPauseTiming pause(state);
+      converter = std::make_unique<PointerDataPacketConverter>();
+      packet = std::make_unique<PointerDataPacket>(kEventsPerPacket);
+      for (size_t i = 0; i < kEventsPerPacket; i++) {
+        packet->SetPointerData(
+            i, CreatePointerData(PointerData::Change::kHover, i, i * 1.0,
+                                 i * 1.0));
+      }
+    }
+    auto converted = converter->Convert(std::move(packet));
+    benchmark::DoNotOptimize(converted);
+  }
+}
+BENCHMARK(BM_ConvertHoverWithAddSynthesis);
+
+}  // namespace flutter
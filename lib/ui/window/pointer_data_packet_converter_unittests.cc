@@ -570,5 +570,66 @@ TEST(PointerDataPacketConverterTest, CanConvetScroll) {
   ASSERT_EQ(result[6].scroll_delta_y, 0.0);
 }
 
+TEST(PointerDataPacketConverterTest, CanHandleManyDevicesComingAndGoing) {
+  PointerDataPacketConverter converter;
+  // Enough devices to force the device state cache to rehash, removed and
+  // re-added so erased slots get reused.
+  const int64_t device_count = 40;
+  PointerData data;
+
+  for (int64_t device = 0; device < device_count; device++) {
+    auto packet = std::make_unique<PointerDataPacket>(3);
+    CreateSimulatedPointerData(data, PointerData::Change::kAdd, device,
+                               device * 1.0, 0.0);
+    packet->SetPointerData(0, data);
+    CreateSimulatedPointerData(data, PointerData::Change::kDown, device,
+                               device * 1.0, 0.0);
+    packet->SetPointerData(1, data);
+    CreateSimulatedPointerData(data, PointerData::Change::kMove, device,
+                               device * 1.0, 5.0);
+    packet->SetPointerData(2, data);
+
+    std::vector<PointerData> result;
+    UnpackPointerPacket(result, converter.Convert(std::move(packet)));
+
+    ASSERT_EQ(result.size(), (size_t)3);
+    ASSERT_EQ(result[2].change, PointerData::Change::kMove);
+    ASSERT_EQ(result[2].device, device);
+    ASSERT_EQ(result[2].pointer_identifier, device + 1);
+    ASSERT_EQ(result[2].physical_delta_y, 5.0);
+  }
+
+  for (int64_t device = 0; device < device_count; device++) {
+    auto packet = std::make_unique<PointerDataPacket>(2);
+    CreateSimulatedPointerData(data, PointerData::Change::kUp, device,
+                               device * 1.0, 5.0);
+    packet->SetPointerData(0, data);
+    CreateSimulatedPointerData(data, PointerData::Change::kRemove, device,
+                               device * 1.0, 5.0);
+    packet->SetPointerData(1, data);
+
+    std::vector<PointerData> result;
+    UnpackPointerPacket(result, converter.Convert(std::move(packet)));
+
+    ASSERT_EQ(result.size(), (size_t)2);
+    ASSERT_EQ(result[1].change, PointerData::Change::kRemove);
+    ASSERT_EQ(result[1].device, device);
+  }
+
+  // Re-added devices start from a clean state.
+  auto packet = std::make_unique<PointerDataPacket>(1);
+  CreateSimulatedPointerData(data, PointerData::Change::kDown, 7, 1.0, 1.0);
+  packet->SetPointerData(0, data);
+
+  std::vector<PointerData> result;
+  UnpackPointerPacket(result, converter.Convert(std::move(packet)));
+
+  ASSERT_EQ(result.size(), (size_t)2);
+  ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
+  ASSERT_EQ(result[0].synthesized, 1);
+  ASSERT_EQ(result[1].change, PointerData::Change::kDown);
+  ASSERT_EQ(result[1].pointer_identifier, device_count + 1);
+}
+
 }  // namespace testing
 }  // namespace flutter
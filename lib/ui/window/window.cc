@@ -150,6 +150,34 @@ void _RespondToPlatformMessage(Dart_NativeArguments args) {
   tonic::DartCallStatic(&RespondToPlatformMessage, args);
 }
 
+Dart_Handle RegisterBackgroundPlatformChannel(Dart_Handle window,
+                                              const std::string& name,
+                                              Dart_Handle port_handle) {
+  UIDartState* dart_state = UIDartState::Current();
+
+  if (!dart_state->window()) {
+    return tonic::ToDart(
+        "Background channels can only be registered from the main isolate");
+  }
+
+  Dart_Port port = ILLEGAL_PORT;
+  if (!Dart_IsNull(port_handle)) {
+    Dart_Handle result = Dart_SendPortGetId(port_handle, &port);
+    if (Dart_IsError(result)) {
+      return tonic::ToDart("Expected a SendPort");
+    }
+  }
+
+  dart_state->window()->client()->RegisterBackgroundPlatformChannel(name,
+                                                                    port);
+
+  return Dart_Null();
+}
+
+void _RegisterBackgroundPlatformChannel(Dart_NativeArguments args) {
+  tonic::DartCallStatic(&RegisterBackgroundPlatformChannel, args);
+}
+
 void GetPersistentIsolateData(Dart_NativeArguments args) {
   UIDartState::ThrowIfUIOperationsProhibited();
 
@@ -168,6 +196,30 @@ void GetPersistentIsolateData(Dart_NativeArguments args) {
 
 }  // namespace
 
+Dart_Handle ToByteData(std::unique_ptr<fml::Mapping> mapping) {
+  if (!mapping || mapping->GetSize() == 0) {
+    // External typed data must be backed by a live allocation.
+    return Dart_NewTypedData(Dart_TypedData_kByteData, 0);
+  }
+
+  // Hand the payload to Dart as external typed data so the bytes are not
+  // copied crossing into the isolate. The mapping is kept alive by the
+  // finalizer for as long as Dart can reach the data.
+  fml::Mapping* peer = mapping.release();
+  Dart_Handle data_handle = Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kByteData,
+      const_cast<uint8_t*>(peer->GetMapping()),  // data
+      peer->GetSize(),                           // length
+      peer,                                      // peer
+      peer->GetSize(),                           // external allocation size
+      [](void* isolate_callback_data, Dart_WeakPersistentHandle handle,
+         void* peer) { delete reinterpret_cast<fml::Mapping*>(peer); });
+  if (Dart_IsError(data_handle)) {
+    delete peer;
+  }
+  return data_handle;
+}
+
 Dart_Handle ToByteData(const std::vector<uint8_t>& buffer) {
   Dart_Handle data_handle =
       Dart_NewTypedData(Dart_TypedData_kByteData, buffer.size());
@@ -307,7 +359,7 @@ void Window::DispatchPlatformMessage(fml::RefPtr<PlatformMessage> message) {
   }
   tonic::DartState::Scope scope(dart_state);
   Dart_Handle data_handle =
-      (message->hasData()) ? ToByteData(message->data()) : Dart_Null();
+      (message->hasData()) ? ToByteData(message->releaseData()) : Dart_Null();
   if (Dart_IsError(data_handle)) {
     FML_DLOG(WARNING)
         << "Dropping platform message because of a Dart error on channel: "
@@ -431,6 +483,8 @@ void Window::RegisterNatives(tonic::DartLibraryNatives* natives) {
       {"Window_scheduleFrame", ScheduleFrame, 1, true},
       {"Window_sendPlatformMessage", _SendPlatformMessage, 4, true},
       {"Window_respondToPlatformMessage", _RespondToPlatformMessage, 3, true},
+      {"Window_registerBackgroundPlatformChannel",
+       _RegisterBackgroundPlatformChannel, 3, true},
       {"Window_render", Render, 2, true},
       {"Window_updateSemantics", UpdateSemantics, 2, true},
       {"Window_setIsolateDebugName", SetIsolateDebugName, 2, true},
@@ -37,6 +37,11 @@ class Scene;
 
 Dart_Handle ToByteData(const std::vector<uint8_t>& buffer);
 
+// Hands the mapping to Dart as external typed data without copying the
+// payload. The mapping is released to a finalizer that keeps the bytes alive
+// as long as Dart can reach them.
+Dart_Handle ToByteData(std::unique_ptr<fml::Mapping> mapping);
+
 // Must match the AccessibilityFeatureFlag enum in window.dart.
 enum class AccessibilityFeatureFlag : int32_t {
   kAccessibleNavigation = 1 << 0,
@@ -54,6 +59,10 @@ class WindowClient {
   virtual void Render(Scene* scene) = 0;
   virtual void UpdateSemantics(SemanticsUpdate* update) = 0;
   virtual void HandlePlatformMessage(fml::RefPtr<PlatformMessage> message) = 0;
+  // Routes incoming messages on |name| to the native |port| instead of the
+  // root isolate. ILLEGAL_PORT removes the registration.
+  virtual void RegisterBackgroundPlatformChannel(const std::string& name,
+                                                 Dart_Port port) = 0;
   virtual FontCollection& GetFontCollection() = 0;
   virtual void UpdateIsolateDescription(const std::string isolate_name,
                                         int64_t isolate_port) = 0;
@@ -50,7 +50,9 @@ class SkAnimatedImage implements ui.Image {
 
   @override
   Future<ByteData> toByteData(
-      {ui.ImageByteFormat format = ui.ImageByteFormat.rawRgba}) {
+      {ui.ImageByteFormat format = ui.ImageByteFormat.rawRgba,
+      ui.ImageEncodeProgressCallback onProgress,
+      ui.ImageEncodeCancellationToken cancellationToken}) {
     throw 'unimplemented';
   }
 }
@@ -75,7 +77,9 @@ class SkImage implements ui.Image {
 
   @override
   Future<ByteData> toByteData(
-      {ui.ImageByteFormat format = ui.ImageByteFormat.rawRgba}) {
+      {ui.ImageByteFormat format = ui.ImageByteFormat.rawRgba,
+      ui.ImageEncodeProgressCallback onProgress,
+      ui.ImageEncodeCancellationToken cancellationToken}) {
     throw 'unimplemented';
   }
 }
@@ -142,4 +142,42 @@ class SkVertices implements ui.Vertices {
   Float32List get textureCoordinates => _textureCoordinates;
 
   Uint16List get indices => _indices;
+
+  @override
+  void update(
+    int startVertex,
+    Float32List positions, {
+    Float32List textureCoordinates,
+    Int32List colors,
+  }) {
+    assert(startVertex != null);
+    assert(positions != null);
+    if (positions.length.isOdd)
+      throw ArgumentError('"positions" must contain pairs of x,y coordinates.');
+    if (textureCoordinates != null &&
+        textureCoordinates.length != positions.length)
+      throw ArgumentError(
+          '"positions" and "textureCoordinates" lengths must match.');
+    if (colors != null && colors.length * 2 != positions.length)
+      throw ArgumentError('"positions" and "colors" lengths must match.');
+    if (startVertex < 0 ||
+        startVertex * 2 + positions.length > _positions.length ||
+        (textureCoordinates != null && _textureCoordinates == null) ||
+        (colors != null && _colors == null))
+      throw ArgumentError('Invalid update for vertices.');
+
+    _positions.setRange(
+        startVertex * 2, startVertex * 2 + positions.length, positions);
+    if (textureCoordinates != null)
+      _textureCoordinates.setRange(startVertex * 2,
+          startVertex * 2 + textureCoordinates.length, textureCoordinates);
+    if (colors != null)
+      _colors.setRange(startVertex, startVertex + colors.length, colors);
+
+    // CanvasKit vertices are immutable; rebuild the SkVertices from the
+    // updated attribute arrays.
+    skVertices.callMethod('delete');
+    if (!_init(_mode, _positions, _textureCoordinates, _colors, _indices))
+      throw ArgumentError('Invalid update for vertices.');
+  }
 }
@@ -134,7 +134,9 @@ class HtmlImage implements ui.Image {
 
   @override
   Future<ByteData> toByteData(
-      {ui.ImageByteFormat format = ui.ImageByteFormat.rawRgba}) {
+      {ui.ImageByteFormat format = ui.ImageByteFormat.rawRgba,
+      ui.ImageEncodeProgressCallback onProgress,
+      ui.ImageEncodeCancellationToken cancellationToken}) {
     return futurize((Callback<ByteData> callback) {
       return _toByteData(format.index, (Uint8List encoded) {
         callback(encoded?.buffer?.asByteData());
@@ -177,6 +177,49 @@ class Vertices {
   Float32List get positions => _positions;
   Float32List get textureCoordinates => _textureCoordinates;
   Uint16List get indices => _indices;
+
+  /// Overwrites a contiguous range of vertices with new attribute values,
+  /// using the encoding methods of [new Vertices.raw].
+  ///
+  /// The range starts at the vertex with index [startVertex] and covers one
+  /// vertex for every pair of x,y coordinates in [positions]; it must lie
+  /// within the mesh.
+  ///
+  /// The [textureCoordinates] and [colors] parameters may only be provided
+  /// if the mesh was constructed with texture coordinates or colors
+  /// respectively, and must describe the same range as [positions]. The
+  /// topology of the mesh ([VertexMode], vertex count and indices) cannot be
+  /// changed by an update.
+  void update(
+    int startVertex,
+    Float32List positions, {
+    Float32List textureCoordinates,
+    Int32List colors,
+  }) {
+    assert(startVertex != null);
+    assert(positions != null);
+    if (positions.length.isOdd)
+      throw ArgumentError('"positions" must contain pairs of x,y coordinates.');
+    if (textureCoordinates != null &&
+        textureCoordinates.length != positions.length)
+      throw ArgumentError(
+          '"positions" and "textureCoordinates" lengths must match.');
+    if (colors != null && colors.length * 2 != positions.length)
+      throw ArgumentError('"positions" and "colors" lengths must match.');
+    if (startVertex < 0 ||
+        startVertex * 2 + positions.length > _positions.length ||
+        (textureCoordinates != null && _textureCoordinates == null) ||
+        (colors != null && _colors == null))
+      throw ArgumentError('Invalid update for vertices.');
+
+    _positions.setRange(
+        startVertex * 2, startVertex * 2 + positions.length, positions);
+    if (textureCoordinates != null)
+      _textureCoordinates.setRange(startVertex * 2,
+          startVertex * 2 + textureCoordinates.length, textureCoordinates);
+    if (colors != null)
+      _colors.setRange(startVertex, startVertex + colors.length, colors);
+  }
 }
 
 /// Records a [Picture] containing a sequence of graphical operations.
@@ -1204,10 +1204,17 @@ abstract class Image {
   /// The [format] argument specifies the format in which the bytes will be
   /// returned.
   ///
+  /// The [onProgress] and [cancellationToken] arguments are accepted for
+  /// compatibility with `dart:ui`. Encoding completes in a single step on
+  /// the web, so no incremental progress is reported and cancellation has no
+  /// effect.
+  ///
   /// Returns a future that completes with the binary image data or an error
   /// if encoding fails.
   Future<ByteData> toByteData(
-      {ImageByteFormat format = ImageByteFormat.rawRgba});
+      {ImageByteFormat format = ImageByteFormat.rawRgba,
+      ImageEncodeProgressCallback onProgress,
+      ImageEncodeCancellationToken cancellationToken});
 
   /// Release the resources used by this object. The object is no longer usable
   /// after this method is called.
@@ -1217,6 +1224,30 @@ abstract class Image {
   String toString() => '[$width\u00D7$height]';
 }
 
+/// Signature of callbacks that report the progress of an [Image.toByteData]
+/// call as a value from 0.0 to 1.0.
+typedef ImageEncodeProgressCallback = void Function(double progress);
+
+/// A handle that can cancel an in-flight [Image.toByteData] call.
+///
+/// Image encoding completes in a single step on the web, so by the time user
+/// code could call [cancel] the encode has already finished; the token only
+/// records that cancellation was requested.
+class ImageEncodeCancellationToken {
+  bool _canceled = false;
+
+  /// Whether [cancel] has been called on this token.
+  bool get isCanceled => _canceled;
+
+  /// Requests that the encode associated with this token stop as soon as
+  /// possible.
+  ///
+  /// Has no effect on the web beyond marking the token as canceled.
+  void cancel() {
+    _canceled = true;
+  }
+}
+
 /// A description of a color filter to apply when drawing a shape or compositing
 /// a layer with a particular [Paint]. A color filter is a function that takes
 /// two colors, and outputs one color. When applied during compositing, it is
@@ -1570,12 +1601,16 @@ class Codec {
 ///
 /// The following image formats are supported: {@macro flutter.dart:ui.imageFormats}
 ///
+/// The [prefetch] flag is accepted for compatibility with `dart:ui` and is
+/// ignored on the web, where decoding is driven by the browser.
+///
 /// The returned future can complete with an error if the image decoding has
 /// failed.
 Future<Codec> instantiateImageCodec(
   Uint8List list, {
   int targetWidth,
   int targetHeight,
+  bool prefetch = false,
 }) {
   return engine.futurize((engine.Callback<Codec> callback) =>
       // TODO: Implement targetWidth and targetHeight support.
@@ -1615,6 +1650,68 @@ String _instantiateImageCodecFromUrl(
   return null;
 }
 
+/// A descriptor of an encoded image whose container has been parsed once.
+///
+/// On the web the browser owns image decoding, so the container is not
+/// sniffed up front; the descriptor simply retains the encoded bytes so that
+/// [instantiateCodec] can create any number of codecs from them without
+/// copying the data again.
+class ImageDescriptor {
+  /// Retains the encoded image in [list].
+  ImageDescriptor.encoded(Uint8List list)
+      : assert(list != null),
+        _list = list;
+
+  Uint8List _list;
+
+  /// The intrinsic width of the image, in pixels.
+  ///
+  /// Always zero on the web, where the dimensions are not known until a
+  /// frame has been decoded.
+  int get width => 0;
+
+  /// The intrinsic height of the image, in pixels.
+  ///
+  /// Always zero on the web, where the dimensions are not known until a
+  /// frame has been decoded.
+  int get height => 0;
+
+  /// The number of frames in the image.
+  ///
+  /// Always zero on the web, where the frame count is not known until the
+  /// image has been decoded.
+  int get frameCount => 0;
+
+  /// Creates a [Codec] decoding this image at the given target dimensions.
+  ///
+  /// The arguments have the same meaning as on [instantiateImageCodec]. The
+  /// [prefetch] flag is ignored on the web, where decoding is driven by the
+  /// browser.
+  Codec instantiateCodec({
+    int targetWidth,
+    int targetHeight,
+    bool prefetch = false,
+  }) {
+    if (_list == null) {
+      throw Exception('Cannot instantiate a codec from a disposed descriptor.');
+    }
+    Codec codec;
+    // TODO: Implement targetWidth and targetHeight support.
+    _instantiateImageCodec(_list, (Codec result) {
+      codec = result;
+    }, null);
+    return codec;
+  }
+
+  /// Releases the retained encoded bytes.
+  ///
+  /// The descriptor is unusable afterwards; codecs already instantiated from
+  /// it are unaffected.
+  void dispose() {
+    _list = null;
+  }
+}
+
 /// Loads a single image frame from a byte array into an [Image] object.
 ///
 /// This is a convenience wrapper around [instantiateImageCodec].
@@ -849,6 +849,17 @@ abstract class Window {
 
   String/*!*/ get initialLifecycleState => 'AppLifecycleState.resumed';
 
+  /// Registers a platform channel whose messages are delivered directly to a
+  /// background isolate.
+  ///
+  /// The web has no isolates (`dart:isolate` is unavailable, so `port` is
+  /// typed [Object] here instead of `SendPort`), and all platform messages
+  /// are delivered to [onPlatformMessage]. This always throws.
+  void registerBackgroundPlatformChannel(String/*!*/ name, Object/*?*/ port) {
+    throw Exception(
+        'Background platform channels are not supported on the web.');
+  }
+
   void setIsolateDebugName(String/*!*/ name) {}
 
   ByteData/*?*/ getPersistentIsolateData() => null;
@@ -1097,6 +1108,12 @@ class FrameTiming {
       _rawDuration(FramePhase.rasterFinish) -
       _rawDuration(FramePhase.buildStart);
 
+  /// The time the GPU spent executing this frame's commands, or null when the
+  /// rendering backend cannot measure it.
+  ///
+  /// The web does not expose GPU timer queries, so this is always null.
+  Duration/*?*/ get gpuDuration => null;
+
   final List<int/*!*/>/*!*/ _timestamps; // in microseconds
 
   String _formatMS(Duration duration) => '${duration.inMicroseconds * 0.001}ms';
@@ -312,6 +312,35 @@ bool DartIsolate::PrepareForRunningFromPrecompiledCode() {
   return true;
 }
 
+bool DartIsolate::PrepareForRunningInExistingGroup() {
+  TRACE_EVENT0("flutter", "DartIsolate::PrepareForRunningInExistingGroup");
+  if (phase_ != Phase::LibrariesSetup) {
+    return false;
+  }
+
+  tonic::DartState::Scope scope(this);
+
+  // The program structure (including the root library) is shared with the
+  // group this isolate was spawned into. There is no kernel to bind and no
+  // precompiled code to verify.
+  if (Dart_IsNull(Dart_RootLibrary())) {
+    return false;
+  }
+
+  if (!MarkIsolateRunnable()) {
+    return false;
+  }
+
+  const fml::closure& isolate_create_callback =
+      GetIsolateGroupData().GetIsolateCreateCallback();
+  if (isolate_create_callback) {
+    isolate_create_callback();
+  }
+
+  phase_ = Phase::Ready;
+  return true;
+}
+
 bool DartIsolate::LoadKernel(std::shared_ptr<const fml::Mapping> mapping,
                              bool last_piece) {
   if (!Dart_IsKernel(mapping->GetMapping(), mapping->GetSize())) {
@@ -625,7 +654,8 @@ Dart_Isolate DartIsolate::DartCreateAndStartServiceIsolate(
           settings.disable_service_auth_codes,  // disable VM service auth codes
           settings.enable_service_port_fallback,  // enable fallback to port 0
                                                   // when bind fails.
-          error                                   // error (out)
+          settings.lazy_observatory,  // defer the HTTP server start
+          error                       // error (out)
           )) {
     // Error is populated by call to startup.
     FML_DLOG(ERROR) << *error;
@@ -748,7 +778,8 @@ bool DartIsolate::DartIsolateInitializeCallback(void** child_callback_data,
           false)));                             // is_root_isolate
 
   // root isolate should have been created via CreateRootIsolate
-  if (!InitializeIsolate(*embedder_isolate, isolate, error)) {
+  if (!InitializeIsolate(*embedder_isolate, isolate, error,
+                         /*is_spawning_in_existing_group=*/true)) {
     return false;
   }
 
@@ -794,7 +825,8 @@ Dart_Isolate DartIsolate::CreateDartIsolateGroup(
 bool DartIsolate::InitializeIsolate(
     std::shared_ptr<DartIsolate> embedder_isolate,
     Dart_Isolate isolate,
-    char** error) {
+    char** error,
+    bool is_spawning_in_existing_group) {
   TRACE_EVENT0("flutter", "DartIsolate::InitializeIsolate");
   if (!embedder_isolate->Initialize(isolate)) {
     *error = fml::strdup("Embedder could not initialize the Dart isolate.");
@@ -813,6 +845,20 @@ bool DartIsolate::InitializeIsolate(
   // also a root isolate) by the utility routines in the VM. However, secondary
   // isolates will be run by the VM if they are marked as runnable.
   if (!embedder_isolate->IsRootIsolate()) {
+    // Isolates spawned into an existing group share the already loaded and
+    // finalized program structure of that group. Running the child isolate
+    // preparer for them would needlessly re-bind the kernel; all they need is
+    // to be marked runnable.
+    if (is_spawning_in_existing_group) {
+      if (!embedder_isolate->PrepareForRunningInExistingGroup()) {
+        *error = fml::strdup(
+            "Could not prepare the isolate spawned into an existing group to "
+            "run.");
+        FML_DLOG(ERROR) << *error;
+        return false;
+      }
+      return true;
+    }
     auto child_isolate_preparer =
         embedder_isolate->GetIsolateGroupData().GetChildIsolatePreparer();
     FML_DCHECK(child_isolate_preparer);
@@ -42,6 +42,31 @@ TEST_F(DartLifecycleTest, CanStartAndShutdownVMOverAndOver) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
 }
 
+TEST_F(DartLifecycleTest, KeepAliveWindowHoldsVMAfterLastReference) {
+  auto settings = CreateSettingsForFixture();
+  settings.leak_vm = false;
+  settings.enable_observatory = false;
+  // A window far longer than the test; the collection below is explicit.
+  settings.vm_keep_alive_seconds = 3600;
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+  auto count = DartVM::GetVMLaunchCount();
+  {
+    auto vm_ref = DartVMRef::Create(settings);
+    ASSERT_TRUE(DartVMRef::IsInstanceRunning());
+  }
+  // The keep-alive reference outlives the last shell reference.
+  ASSERT_TRUE(DartVMRef::IsInstanceRunning());
+  {
+    // Re-entry within the window reuses the running VM instead of booting a
+    // new one.
+    auto vm_ref = DartVMRef::Create(settings);
+    ASSERT_EQ(DartVM::GetVMLaunchCount(), count + 1);
+  }
+  // The memory pressure override collects the kept-alive VM early.
+  DartVMRef::CollectKeepAliveVM();
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+}
+
 static std::shared_ptr<DartIsolate> CreateAndRunRootIsolate(
     const Settings& settings,
     const DartVMData& vm,
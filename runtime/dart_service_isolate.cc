@@ -132,6 +132,7 @@ bool DartServiceIsolate::Startup(std::string server_ip,
                                  bool disable_origin_check,
                                  bool disable_service_auth_codes,
                                  bool enable_service_port_fallback,
+                                 bool deferred_server_start,
                                  char** error) {
   Dart_Isolate isolate = Dart_CurrentIsolate();
   FML_CHECK(isolate);
@@ -176,8 +177,11 @@ bool DartServiceIsolate::Startup(std::string server_ip,
   result = Dart_SetField(library, Dart_NewStringFromCString("_ip"),
                          Dart_NewStringFromCString(server_ip.c_str()));
   SHUTDOWN_ON_ERROR(result);
-  // If we have a port specified, start the server immediately.
-  bool auto_start = server_port >= 0;
+  // If we have a port specified, start the server immediately unless the
+  // embedder asked for a deferred start. In the deferred case the isolate
+  // keeps the requested port and binds the server on the first web server
+  // control request, keeping the startup cost off the launch path.
+  bool auto_start = server_port >= 0 && !deferred_server_start;
   if (server_port < 0) {
     // Adjust server_port to port 0 which will result in the first available
     // port when the HTTP server is started.
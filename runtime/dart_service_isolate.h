@@ -51,6 +51,10 @@ class DartServiceIsolate {
   ///                                           enabled.
   /// @param[in]  enable_service_port_fallback  If fallback to port 0 must be
   ///                                           enabled when the bind fails.
+  /// @param[in]  deferred_server_start         If the observatory HTTP server
+  ///                                           must not be started with the
+  ///                                           isolate but on the first web
+  ///                                           server control request instead.
   /// @param      error                         The error when this method
   ///                                           returns false. This string must
   ///                                           be freed by the caller using
@@ -65,6 +69,7 @@ class DartServiceIsolate {
                       bool disable_origin_check,
                       bool disable_service_auth_codes,
                       bool enable_service_port_fallback,
+                      bool deferred_server_start,
                       char** error);
 
   //----------------------------------------------------------------------------
@@ -4,14 +4,24 @@
 
 #include "flutter/runtime/dart_snapshot.h"
 
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <utility>
 
+#include "flutter/fml/build_config.h"
 #include "flutter/fml/native_library.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/lib/snapshot/snapshot.h"
+#include "flutter/runtime/dart_snapshot_compression.h"
 #include "flutter/runtime/dart_vm.h"
 
+#if OS_POSIX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // OS_POSIX
+
 namespace flutter {
 
 const char* DartSnapshot::kVMDataSymbol = "kDartVmSnapshotData";
@@ -32,10 +42,24 @@ static std::unique_ptr<const fml::Mapping> GetFileMapping(
     const std::string& path,
     bool executable) {
   if (executable) {
-    return fml::FileMapping::CreateReadExecute(path);
-  } else {
-    return fml::FileMapping::CreateReadOnly(path);
+    auto mapping = fml::FileMapping::CreateReadExecute(path);
+    if (mapping) {
+      // Instruction snapshots are large, hot and read for the lifetime of
+      // the process. Huge page backing cuts iTLB pressure on kernels that
+      // support it, and pinning the pages keeps the VM's code from being
+      // evicted under memory pressure. Both are best effort.
+      mapping->Advise(fml::FileMapping::Advice::kHugePage);
+      return fml::LockedMapping::Lock(std::move(mapping));
+    }
+    return mapping;
   }
+  auto mapping = fml::FileMapping::CreateReadOnly(path);
+  if (mapping) {
+    // Heap snapshots are deserialized in one forward pass during isolate
+    // startup.
+    mapping->Advise(fml::FileMapping::Advice::kSequential);
+  }
+  return mapping;
 }
 
 // The first party embedders don't yet use the stable embedder API and depend on
@@ -98,13 +122,15 @@ static std::shared_ptr<const fml::Mapping> ResolveVMData(
 #if DART_SNAPSHOT_STATIC_LINK
   return std::make_unique<fml::NonOwnedMapping>(kDartVmSnapshotData, 0);
 #else   // DART_SNAPSHOT_STATIC_LINK
-  return SearchMapping(
+  // Data sections may ship compressed; instructions never do since they are
+  // executed straight out of their mapping.
+  return DecompressSnapshotIfNeeded(SearchMapping(
       settings.vm_snapshot_data,          // embedder_mapping_callback
       settings.vm_snapshot_data_path,     // file_path
       settings.application_library_path,  // native_library_path
       DartSnapshot::kVMDataSymbol,        // native_library_symbol_name
       false                               // is_executable
-  );
+      ));
 #endif  // DART_SNAPSHOT_STATIC_LINK
 }
 
@@ -128,13 +154,13 @@ static std::shared_ptr<const fml::Mapping> ResolveIsolateData(
 #if DART_SNAPSHOT_STATIC_LINK
   return std::make_unique<fml::NonOwnedMapping>(kDartIsolateSnapshotData, 0);
 #else   // DART_SNAPSHOT_STATIC_LINK
-  return SearchMapping(
+  return DecompressSnapshotIfNeeded(SearchMapping(
       settings.isolate_snapshot_data,       // embedder_mapping_callback
       settings.isolate_snapshot_data_path,  // file_path
       settings.application_library_path,    // native_library_path
       DartSnapshot::kIsolateDataSymbol,     // native_library_symbol_name
       false                                 // is_executable
-  );
+      ));
 #endif  // DART_SNAPSHOT_STATIC_LINK
 }
 
@@ -170,19 +196,72 @@ fml::RefPtr<DartSnapshot> DartSnapshot::VMSnapshotFromSettings(
 fml::RefPtr<DartSnapshot> DartSnapshot::IsolateSnapshotFromSettings(
     const Settings& settings) {
   TRACE_EVENT0("flutter", "DartSnapshot::IsolateSnapshotFromSettings");
-  auto snapshot =
-      fml::MakeRefCounted<DartSnapshot>(ResolveIsolateData(settings),         //
-                                        ResolveIsolateInstructions(settings)  //
-      );
-  if (snapshot->IsValid()) {
-    return snapshot;
+  auto data = ResolveIsolateData(settings);
+  auto instructions = ResolveIsolateInstructions(settings);
+
+  // Engines launched from the same embedder-provided AOT data resolve to the
+  // same underlying buffers. Hand all of them one snapshot instance instead of
+  // a wrapper per engine so runtime bookkeeping (and the prefetch pass in the
+  // constructor) happens once per distinct snapshot. Entries whose only
+  // remaining reference is the registry are pruned on the next lookup, so a
+  // buffer address cannot be matched after its last user is gone.
+  static std::mutex registry_mutex;
+  static auto& registry = *new std::map<
+      std::pair<const uint8_t*, const uint8_t*>, fml::RefPtr<DartSnapshot>>();
+
+  const uint8_t* data_key = data ? data->GetMapping() : nullptr;
+  const uint8_t* instructions_key =
+      instructions ? instructions->GetMapping() : nullptr;
+
+  std::scoped_lock lock(registry_mutex);
+  for (auto it = registry.begin(); it != registry.end();) {
+    it = it->second->HasOneRef() ? registry.erase(it) : ++it;
   }
-  return nullptr;
+
+  if (data_key != nullptr) {
+    auto found = registry.find({data_key, instructions_key});
+    if (found != registry.end()) {
+      return found->second;
+    }
+  }
+
+  auto snapshot = fml::MakeRefCounted<DartSnapshot>(std::move(data),
+                                                    std::move(instructions));
+  if (!snapshot->IsValid()) {
+    return nullptr;
+  }
+  if (data_key != nullptr) {
+    registry[{data_key, instructions_key}] = snapshot;
+  }
+  return snapshot;
+}
+
+// Instruction snapshots are touched almost in their entirety while the VM
+// boots, one page fault at a time. Ask the kernel to queue readahead for the
+// whole range up front so those faults hit warm pages instead of going to
+// disk serially.
+static void PrefetchInstructions(const fml::Mapping* instructions) {
+#if OS_POSIX
+  if (instructions == nullptr || instructions->GetSize() == 0) {
+    return;
+  }
+  auto address = reinterpret_cast<uintptr_t>(instructions->GetMapping());
+  if (address == 0) {
+    return;
+  }
+  // Symbol mappings land mid-page; advise from the enclosing page boundary.
+  const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+  const uintptr_t aligned = address & ~(page_size - 1);
+  ::madvise(reinterpret_cast<void*>(aligned),
+            instructions->GetSize() + (address - aligned), MADV_WILLNEED);
+#endif  // OS_POSIX
 }
 
 DartSnapshot::DartSnapshot(std::shared_ptr<const fml::Mapping> data,
                            std::shared_ptr<const fml::Mapping> instructions)
-    : data_(std::move(data)), instructions_(std::move(instructions)) {}
+    : data_(std::move(data)), instructions_(std::move(instructions)) {
+  PrefetchInstructions(instructions_.get());
+}
 
 DartSnapshot::~DartSnapshot() = default;
 
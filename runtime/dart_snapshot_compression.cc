@@ -0,0 +1,228 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/dart_snapshot_compression.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+const char kSnapshotContainerMagic[4] = {'F', 'S', 'C', '1'};
+
+namespace {
+
+// Decodes one raw LZ4 block. The format alternates runs of literals with
+// back-references into the already produced output: a token byte carries the
+// literal and match lengths (15 in a nibble means continuation bytes follow),
+// a match is a little-endian 16 bit backwards offset plus a length with an
+// implicit base of 4, and the final sequence is literals only. Every read and
+// write is bounds checked so malformed input fails instead of overrunning.
+// Returns false unless the block decodes to exactly |dst_size| bytes.
+bool Lz4BlockDecode(const uint8_t* src,
+                    size_t src_size,
+                    uint8_t* dst,
+                    size_t dst_size) {
+  const uint8_t* src_end = src + src_size;
+  uint8_t* out = dst;
+  uint8_t* dst_end = dst + dst_size;
+
+  while (src < src_end) {
+    const uint8_t token = *src++;
+
+    size_t literal_length = token >> 4;
+    if (literal_length == 15) {
+      uint8_t continuation = 0;
+      do {
+        if (src >= src_end) {
+          return false;
+        }
+        continuation = *src++;
+        literal_length += continuation;
+      } while (continuation == 255);
+    }
+    if (literal_length > static_cast<size_t>(src_end - src) ||
+        literal_length > static_cast<size_t>(dst_end - out)) {
+      return false;
+    }
+    memcpy(out, src, literal_length);
+    out += literal_length;
+    src += literal_length;
+
+    if (src >= src_end) {
+      // The final sequence carries no match.
+      break;
+    }
+
+    if (src_end - src < 2) {
+      return false;
+    }
+    const size_t offset = static_cast<size_t>(src[0]) |
+                          (static_cast<size_t>(src[1]) << 8);
+    src += 2;
+    if (offset == 0 || offset > static_cast<size_t>(out - dst)) {
+      return false;
+    }
+
+    size_t match_length = token & 0xF;
+    if (match_length == 15) {
+      uint8_t continuation = 0;
+      do {
+        if (src >= src_end) {
+          return false;
+        }
+        continuation = *src++;
+        match_length += continuation;
+      } while (continuation == 255);
+    }
+    match_length += 4;
+    if (match_length > static_cast<size_t>(dst_end - out)) {
+      return false;
+    }
+
+    // Matches may overlap their own output (offset < length repeats a
+    // pattern), so copy forward a byte at a time.
+    const uint8_t* match = out - offset;
+    for (size_t i = 0; i < match_length; i++) {
+      out[i] = match[i];
+    }
+    out += match_length;
+  }
+
+  return out == dst_end;
+}
+
+bool DecodeChunk(SnapshotCodec codec,
+                 const uint8_t* src,
+                 size_t src_size,
+                 uint8_t* dst,
+                 size_t dst_size) {
+  switch (codec) {
+    case SnapshotCodec::kStore:
+      if (src_size != dst_size) {
+        return false;
+      }
+      memcpy(dst, src, src_size);
+      return true;
+    case SnapshotCodec::kLz4Block:
+      return Lz4BlockDecode(src, src_size, dst, dst_size);
+  }
+  return false;
+}
+
+}  // namespace
+
+bool IsCompressedSnapshot(const fml::Mapping* mapping) {
+  return mapping != nullptr &&
+         mapping->GetSize() >= sizeof(SnapshotContainerHeader) &&
+         memcmp(mapping->GetMapping(), kSnapshotContainerMagic,
+                sizeof(kSnapshotContainerMagic)) == 0;
+}
+
+std::shared_ptr<const fml::Mapping> DecompressSnapshotIfNeeded(
+    std::shared_ptr<const fml::Mapping> mapping) {
+  if (!IsCompressedSnapshot(mapping.get())) {
+    return mapping;
+  }
+
+  TRACE_EVENT0("flutter", "DecompressSnapshot");
+
+  SnapshotContainerHeader header;
+  memcpy(&header, mapping->GetMapping(), sizeof(header));
+
+  if (header.version != kSnapshotContainerVersion) {
+    FML_LOG(ERROR) << "Unsupported snapshot container version: "
+                   << header.version;
+    return nullptr;
+  }
+  const auto codec = static_cast<SnapshotCodec>(header.codec);
+  if (codec != SnapshotCodec::kStore && codec != SnapshotCodec::kLz4Block) {
+    FML_LOG(ERROR) << "Unsupported snapshot container codec: " << header.codec;
+    return nullptr;
+  }
+  if (header.chunk_count == 0 || header.chunk_size == 0 ||
+      header.uncompressed_size == 0 ||
+      header.uncompressed_size >
+          static_cast<uint64_t>(header.chunk_size) * header.chunk_count ||
+      header.uncompressed_size <=
+          static_cast<uint64_t>(header.chunk_size) * (header.chunk_count - 1)) {
+    FML_LOG(ERROR) << "Inconsistent snapshot container header.";
+    return nullptr;
+  }
+
+  const uint8_t* cursor = mapping->GetMapping() + sizeof(header);
+  size_t remaining = mapping->GetSize() - sizeof(header);
+
+  const size_t table_size = sizeof(uint32_t) * header.chunk_count;
+  if (remaining < table_size) {
+    FML_LOG(ERROR) << "Truncated snapshot container chunk table.";
+    return nullptr;
+  }
+  std::vector<uint32_t> compressed_sizes(header.chunk_count);
+  memcpy(compressed_sizes.data(), cursor, table_size);
+  cursor += table_size;
+  remaining -= table_size;
+
+  struct Chunk {
+    const uint8_t* src;
+    size_t src_size;
+    uint8_t* dst;
+    size_t dst_size;
+  };
+
+  std::vector<uint8_t> output(header.uncompressed_size);
+  std::vector<Chunk> chunks(header.chunk_count);
+  uint64_t produced = 0;
+  for (uint32_t i = 0; i < header.chunk_count; i++) {
+    const size_t src_size = compressed_sizes[i];
+    if (src_size > remaining) {
+      FML_LOG(ERROR) << "Truncated snapshot container payload.";
+      return nullptr;
+    }
+    const size_t dst_size = std::min<uint64_t>(
+        header.chunk_size, header.uncompressed_size - produced);
+    chunks[i] = {cursor, src_size, output.data() + produced, dst_size};
+    cursor += src_size;
+    remaining -= src_size;
+    produced += dst_size;
+  }
+
+  std::atomic_bool valid{true};
+  if (chunks.size() == 1) {
+    valid = DecodeChunk(codec, chunks[0].src, chunks[0].src_size,
+                        chunks[0].dst, chunks[0].dst_size);
+  } else {
+    // Chunks are independent; spread them over a worker pool so the decode
+    // completes in a fraction of the single threaded time during startup.
+    auto loop = fml::ConcurrentMessageLoop::Create();
+    auto task_runner = loop->GetTaskRunner();
+    fml::CountDownLatch latch(chunks.size());
+    for (const auto& chunk : chunks) {
+      task_runner->PostTask([codec, chunk, &valid, &latch]() {
+        if (!DecodeChunk(codec, chunk.src, chunk.src_size, chunk.dst,
+                         chunk.dst_size)) {
+          valid = false;
+        }
+        latch.CountDown();
+      });
+    }
+    latch.Wait();
+  }
+
+  if (!valid) {
+    FML_LOG(ERROR) << "Snapshot container payload failed to decompress.";
+    return nullptr;
+  }
+
+  return std::make_shared<fml::DataMapping>(std::move(output));
+}
+
+}  // namespace flutter
@@ -0,0 +1,65 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_RUNTIME_DART_SNAPSHOT_COMPRESSION_H_
+#define FLUTTER_RUNTIME_DART_SNAPSHOT_COMPRESSION_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+// Snapshot data blobs may optionally ship inside a compressed container to
+// cut application download size. Only the heap data sections are eligible;
+// instruction sections must stay uncompressed so they can be mapped and
+// executed in place. The container stores the payload as a sequence of
+// independently compressed chunks so decompression parallelizes across
+// worker threads during startup.
+//
+// Layout, all fields in host byte order:
+//   SnapshotContainerHeader
+//   uint32_t compressed_sizes[chunk_count]
+//   chunk payloads, back to back, in chunk order
+//
+// Every chunk decodes to exactly |chunk_size| bytes except the last, which
+// decodes to the remainder of |uncompressed_size|.
+
+enum class SnapshotCodec : uint32_t {
+  // Chunks are stored verbatim. Useful for tooling and tests; detection and
+  // chunking still work without a compressor.
+  kStore = 0,
+  // Chunks are raw LZ4 blocks (no frame header or checksums).
+  kLz4Block = 1,
+};
+
+struct SnapshotContainerHeader {
+  char magic[4];  // kSnapshotContainerMagic
+  uint32_t version;
+  uint32_t codec;  // One of |SnapshotCodec|.
+  uint32_t chunk_size;
+  uint32_t chunk_count;
+  uint64_t uncompressed_size;
+};
+
+extern const char kSnapshotContainerMagic[4];
+
+constexpr uint32_t kSnapshotContainerVersion = 1;
+
+// Returns true if the mapping begins with a snapshot container header. Plain
+// snapshot blobs never do; the Dart snapshot magic differs.
+bool IsCompressedSnapshot(const fml::Mapping* mapping);
+
+// Returns the mapping unchanged if it is not a container. Otherwise decodes
+// the payload into an anonymous in-memory mapping, spreading chunks across a
+// concurrent worker pool, and returns that. Returns nullptr if the container
+// is malformed; handing compressed bytes to the VM would only defer the
+// failure to a less debuggable spot.
+std::shared_ptr<const fml::Mapping> DecompressSnapshotIfNeeded(
+    std::shared_ptr<const fml::Mapping> mapping);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_RUNTIME_DART_SNAPSHOT_COMPRESSION_H_
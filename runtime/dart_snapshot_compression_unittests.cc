@@ -0,0 +1,181 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/dart_snapshot_compression.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+// Encodes one LZ4 block as a single literals-only sequence. Such a block is
+// valid (the final sequence of any block is literals only) and exercises the
+// real decoder without needing a full compressor.
+static std::vector<uint8_t> Lz4EncodeLiterals(const uint8_t* data,
+                                              size_t size) {
+  std::vector<uint8_t> out;
+  const size_t token_length = std::min<size_t>(size, 15);
+  out.push_back(static_cast<uint8_t>(token_length << 4));
+  if (token_length == 15) {
+    size_t rest = size - 15;
+    while (rest >= 255) {
+      out.push_back(255);
+      rest -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(rest));
+  }
+  out.insert(out.end(), data, data + size);
+  return out;
+}
+
+static std::vector<uint8_t> BuildContainer(SnapshotCodec codec,
+                                           uint32_t chunk_size,
+                                           const std::vector<uint8_t>& payload,
+                                           uint32_t version) {
+  std::vector<std::vector<uint8_t>> chunks;
+  for (size_t offset = 0; offset < payload.size(); offset += chunk_size) {
+    const size_t length = std::min<size_t>(chunk_size, payload.size() - offset);
+    if (codec == SnapshotCodec::kLz4Block) {
+      chunks.push_back(Lz4EncodeLiterals(payload.data() + offset, length));
+    } else {
+      chunks.emplace_back(payload.begin() + offset,
+                          payload.begin() + offset + length);
+    }
+  }
+
+  SnapshotContainerHeader header = {};
+  memcpy(header.magic, kSnapshotContainerMagic, sizeof(header.magic));
+  header.version = version;
+  header.codec = static_cast<uint32_t>(codec);
+  header.chunk_size = chunk_size;
+  header.chunk_count = chunks.size();
+  header.uncompressed_size = payload.size();
+
+  std::vector<uint8_t> container(sizeof(header));
+  memcpy(container.data(), &header, sizeof(header));
+  for (const auto& chunk : chunks) {
+    const uint32_t compressed_size = chunk.size();
+    const uint8_t* size_bytes =
+        reinterpret_cast<const uint8_t*>(&compressed_size);
+    container.insert(container.end(), size_bytes,
+                     size_bytes + sizeof(compressed_size));
+  }
+  for (const auto& chunk : chunks) {
+    container.insert(container.end(), chunk.begin(), chunk.end());
+  }
+  return container;
+}
+
+static std::vector<uint8_t> MakePayload(size_t size) {
+  std::vector<uint8_t> payload(size);
+  for (size_t i = 0; i < size; i++) {
+    payload[i] = static_cast<uint8_t>(i * 31 + i / 7);
+  }
+  return payload;
+}
+
+static bool MappingEquals(const fml::Mapping& mapping,
+                          const std::vector<uint8_t>& expected) {
+  return mapping.GetSize() == expected.size() &&
+         memcmp(mapping.GetMapping(), expected.data(), expected.size()) == 0;
+}
+
+TEST(DartSnapshotCompression, PassesPlainMappingsThroughUntouched) {
+  auto mapping = std::make_shared<fml::DataMapping>(
+      std::string{"not a container, just snapshot bytes"});
+  ASSERT_FALSE(IsCompressedSnapshot(mapping.get()));
+  ASSERT_EQ(DecompressSnapshotIfNeeded(mapping).get(), mapping.get());
+  ASSERT_EQ(DecompressSnapshotIfNeeded(nullptr), nullptr);
+}
+
+TEST(DartSnapshotCompression, RoundTripsStoredChunks) {
+  const auto payload = MakePayload(10000);
+  auto container = std::make_shared<fml::DataMapping>(
+      BuildContainer(SnapshotCodec::kStore, 4096, payload,
+                     kSnapshotContainerVersion));
+  ASSERT_TRUE(IsCompressedSnapshot(container.get()));
+
+  auto decompressed = DecompressSnapshotIfNeeded(container);
+  ASSERT_NE(decompressed, nullptr);
+  ASSERT_TRUE(MappingEquals(*decompressed, payload));
+}
+
+TEST(DartSnapshotCompression, RoundTripsLz4Chunks) {
+  const auto payload = MakePayload(3000);
+  auto container = std::make_shared<fml::DataMapping>(
+      BuildContainer(SnapshotCodec::kLz4Block, 1024, payload,
+                     kSnapshotContainerVersion));
+
+  auto decompressed = DecompressSnapshotIfNeeded(container);
+  ASSERT_NE(decompressed, nullptr);
+  ASSERT_TRUE(MappingEquals(*decompressed, payload));
+}
+
+TEST(DartSnapshotCompression, DecodesLz4MatchSequences) {
+  // "abcd" as literals, then a match of length 8 at offset 4: "abcdabcdabcd".
+  const std::vector<uint8_t> block = {0x44, 'a', 'b', 'c', 'd', 0x04, 0x00};
+  const std::string expected = "abcdabcdabcd";
+
+  SnapshotContainerHeader header = {};
+  memcpy(header.magic, kSnapshotContainerMagic, sizeof(header.magic));
+  header.version = kSnapshotContainerVersion;
+  header.codec = static_cast<uint32_t>(SnapshotCodec::kLz4Block);
+  header.chunk_size = expected.size();
+  header.chunk_count = 1;
+  header.uncompressed_size = expected.size();
+
+  std::vector<uint8_t> container(sizeof(header));
+  memcpy(container.data(), &header, sizeof(header));
+  const uint32_t compressed_size = block.size();
+  const uint8_t* size_bytes =
+      reinterpret_cast<const uint8_t*>(&compressed_size);
+  container.insert(container.end(), size_bytes,
+                   size_bytes + sizeof(compressed_size));
+  container.insert(container.end(), block.begin(), block.end());
+
+  auto decompressed = DecompressSnapshotIfNeeded(
+      std::make_shared<fml::DataMapping>(std::move(container)));
+  ASSERT_NE(decompressed, nullptr);
+  ASSERT_TRUE(MappingEquals(
+      *decompressed,
+      std::vector<uint8_t>{expected.begin(), expected.end()}));
+}
+
+TEST(DartSnapshotCompression, RejectsMalformedContainers) {
+  const auto payload = MakePayload(5000);
+  auto container = BuildContainer(SnapshotCodec::kStore, 2048, payload,
+                                  kSnapshotContainerVersion);
+
+  // A truncated payload must fail instead of producing short data.
+  std::vector<uint8_t> truncated(container.begin(), container.end() - 100);
+  ASSERT_EQ(DecompressSnapshotIfNeeded(
+                std::make_shared<fml::DataMapping>(std::move(truncated))),
+            nullptr);
+
+  // An unknown version must fail.
+  auto wrong_version = BuildContainer(SnapshotCodec::kStore, 2048, payload,
+                                      kSnapshotContainerVersion + 1);
+  ASSERT_EQ(DecompressSnapshotIfNeeded(
+                std::make_shared<fml::DataMapping>(std::move(wrong_version))),
+            nullptr);
+
+  // Garbage LZ4 bytes must fail instead of overrunning buffers.
+  auto garbage = BuildContainer(SnapshotCodec::kStore, 2048, payload,
+                                kSnapshotContainerVersion);
+  SnapshotContainerHeader header;
+  memcpy(&header, garbage.data(), sizeof(header));
+  header.codec = static_cast<uint32_t>(SnapshotCodec::kLz4Block);
+  memcpy(garbage.data(), &header, sizeof(header));
+  ASSERT_EQ(DecompressSnapshotIfNeeded(
+                std::make_shared<fml::DataMapping>(std::move(garbage))),
+            nullptr);
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -12,6 +12,7 @@
 
 #include "flutter/common/settings.h"
 #include "flutter/fml/compiler_specific.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/mapping.h"
@@ -87,6 +88,10 @@ static const char* kDartStartPausedArgs[]{
     "--pause_isolates_on_start",
 };
 
+static const char* kDartIsolateGroupsArgs[]{
+    "--enable-isolate-groups",
+};
+
 static const char* kDartDisableServiceAuthCodesArgs[]{
     "--disable-service-auth-codes",
 };
@@ -262,7 +267,10 @@ size_t DartVM::GetVMLaunchCount() {
 DartVM::DartVM(std::shared_ptr<const DartVMData> vm_data,
                std::shared_ptr<IsolateNameServer> isolate_name_server)
     : settings_(vm_data->GetSettings()),
-      concurrent_message_loop_(fml::ConcurrentMessageLoop::Create()),
+      concurrent_message_loop_(fml::ConcurrentMessageLoop::Create(
+          settings_.concurrent_worker_count > 0
+              ? settings_.concurrent_worker_count
+              : std::thread::hardware_concurrency())),
       skia_concurrent_executor_(
           [runner = concurrent_message_loop_->GetTaskRunner()](
               fml::closure work) { runner->PostTask(work); }),
@@ -347,6 +355,11 @@ DartVM::DartVM(std::shared_ptr<const DartVMData> vm_data,
     PushBackAll(&args, kDartStartPausedArgs, fml::size(kDartStartPausedArgs));
   }
 
+  if (settings_.enable_isolate_groups) {
+    PushBackAll(&args, kDartIsolateGroupsArgs,
+                fml::size(kDartIsolateGroupsArgs));
+  }
+
   if (settings_.disable_service_auth_codes) {
     PushBackAll(&args, kDartDisableServiceAuthCodesArgs,
                 fml::size(kDartDisableServiceAuthCodesArgs));
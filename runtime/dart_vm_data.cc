@@ -4,12 +4,30 @@
 
 #include "flutter/runtime/dart_vm_data.h"
 
+#include <future>
+
 namespace flutter {
 
 std::shared_ptr<const DartVMData> DartVMData::Create(
     Settings settings,
     fml::RefPtr<DartSnapshot> vm_snapshot,
     fml::RefPtr<DartSnapshot> isolate_snapshot) {
+  // Inferring a snapshot means probing the file system, opening native
+  // libraries and setting up mappings. When both snapshots must be inferred,
+  // resolve the isolate snapshot on a worker while the VM snapshot is
+  // resolved on this thread instead of paying for the two serially. The VM
+  // worker pool does not exist yet at this point, so a one-shot async task is
+  // used. The settings are only read by both resolutions.
+  std::future<fml::RefPtr<DartSnapshot>> isolate_snapshot_future;
+  const bool infer_isolate_snapshot =
+      !isolate_snapshot || !isolate_snapshot->IsValid();
+  if (infer_isolate_snapshot) {
+    isolate_snapshot_future =
+        std::async(std::launch::async, [&settings]() {
+          return DartSnapshot::IsolateSnapshotFromSettings(settings);
+        });
+  }
+
   if (!vm_snapshot || !vm_snapshot->IsValid()) {
     // Caller did not provide a valid VM snapshot. Attempt to infer one
     // from the settings.
@@ -17,14 +35,15 @@ std::shared_ptr<const DartVMData> DartVMData::Create(
     if (!vm_snapshot) {
       FML_LOG(ERROR)
           << "VM snapshot invalid and could not be inferred from settings.";
+      if (infer_isolate_snapshot) {
+        isolate_snapshot_future.wait();
+      }
       return {};
     }
   }
 
-  if (!isolate_snapshot || !isolate_snapshot->IsValid()) {
-    // Caller did not provide a valid isolate snapshot. Attempt to infer one
-    // from the settings.
-    isolate_snapshot = DartSnapshot::IsolateSnapshotFromSettings(settings);
+  if (infer_isolate_snapshot) {
+    isolate_snapshot = isolate_snapshot_future.get();
     if (!isolate_snapshot) {
       FML_LOG(ERROR) << "Isolate snapshot invalid and could not be inferred "
                         "from settings.";
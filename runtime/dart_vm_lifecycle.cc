@@ -4,7 +4,9 @@
 
 #include "flutter/runtime/dart_vm_lifecycle.h"
 
+#include <chrono>
 #include <mutex>
+#include <thread>
 
 namespace flutter {
 
@@ -15,6 +17,40 @@ static std::mutex gVMMutex;
 static std::weak_ptr<DartVM> gVM;
 static std::shared_ptr<DartVM>* gVMLeak;
 
+// An extra strong reference held while |vm_keep_alive_seconds| asks the VM to
+// outlive the last shell, so re-entering within the window reuses the running
+// VM instead of rebooting it. The generation counter invalidates a pending
+// collection when a newer acquire/release cycle supersedes its window. All
+// three are guarded by |gVMMutex|.
+static std::shared_ptr<DartVM>* gVMKeepAlive;
+static uint64_t gVMKeepAliveGeneration = 0;
+static int64_t gVMKeepAliveSeconds = 0;
+
+// Must be called with |gVMMutex| held. If the keep-alive reference has just
+// become the sole owner of the VM, starts the countdown after which the VM is
+// collected unless a shell re-references it first.
+static void ScheduleVMKeepAliveCollection() {
+  if (!gVMKeepAlive || gVMKeepAlive->use_count() != 1) {
+    return;
+  }
+  const uint64_t generation = ++gVMKeepAliveGeneration;
+  const int64_t seconds = gVMKeepAliveSeconds;
+  // A detached thread rather than a task runner: no engine message loop is
+  // guaranteed to outlive the last shell. The thread holds no VM reference,
+  // so it cannot extend the VM lifetime past the window it implements.
+  std::thread([generation, seconds]() {
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    std::scoped_lock lifecycle_lock(gVMMutex);
+    if (generation != gVMKeepAliveGeneration) {
+      return;
+    }
+    if (gVMKeepAlive && gVMKeepAlive->use_count() == 1) {
+      delete gVMKeepAlive;
+      gVMKeepAlive = nullptr;
+    }
+  }).detach();
+}
+
 // We are going to be modifying more than just the control blocks of the
 // following weak pointers (in the |Create| case where an old VM could not be
 // reused). Ideally, we would use |std::atomic<std::weak_ptr<T>>| specialization
@@ -27,8 +63,23 @@ static std::weak_ptr<IsolateNameServer> gVMIsolateNameServer;
 
 DartVMRef::DartVMRef(std::shared_ptr<DartVM> vm) : vm_(vm) {}
 
+DartVMRef::DartVMRef() : vm_(nullptr) {}
+
 DartVMRef::DartVMRef(DartVMRef&& other) = default;
 
+DartVMRef& DartVMRef::operator=(DartVMRef&& other) {
+  if (vm_) {
+    // Dropping a valid reference may collect the VM; that must happen in the
+    // lifecycle critical section, just like in the destructor.
+    std::scoped_lock lifecycle_lock(gVMMutex);
+    vm_ = std::move(other.vm_);
+    ScheduleVMKeepAliveCollection();
+  } else {
+    vm_ = std::move(other.vm_);
+  }
+  return *this;
+}
+
 DartVMRef::~DartVMRef() {
   if (!vm_) {
     // If there is no valid VM (possible via a move), there is no way that the
@@ -39,6 +90,7 @@ DartVMRef::~DartVMRef() {
   }
   std::scoped_lock lifecycle_lock(gVMMutex);
   vm_.reset();
+  ScheduleVMKeepAliveCollection();
 }
 
 DartVMRef DartVMRef::Create(Settings settings,
@@ -73,6 +125,8 @@ DartVMRef DartVMRef::Create(Settings settings,
 
   // If there is no VM in the process. Initialize one, hold the weak reference
   // and pass a strong reference to the caller.
+  const bool leak_vm = settings.leak_vm;
+  const int64_t keep_alive_seconds = settings.vm_keep_alive_seconds;
   auto isolate_name_server = std::make_shared<IsolateNameServer>();
   auto vm = DartVM::Create(std::move(settings),          //
                            std::move(vm_snapshot),       //
@@ -90,8 +144,11 @@ DartVMRef DartVMRef::Create(Settings settings,
   gVMIsolateNameServer = isolate_name_server;
   gVM = vm;
 
-  if (settings.leak_vm) {
+  if (leak_vm) {
     gVMLeak = new std::shared_ptr<DartVM>(vm);
+  } else if (keep_alive_seconds > 0) {
+    gVMKeepAliveSeconds = keep_alive_seconds;
+    gVMKeepAlive = new std::shared_ptr<DartVM>(vm);
   }
 
   return DartVMRef{std::move(vm)};
@@ -102,6 +159,17 @@ bool DartVMRef::IsInstanceRunning() {
   return !gVM.expired();
 }
 
+void DartVMRef::CollectKeepAliveVM() {
+  std::scoped_lock lifecycle_lock(gVMMutex);
+  // Invalidate any pending countdown so it cannot race with a VM launched
+  // after this collection.
+  gVMKeepAliveGeneration++;
+  if (gVMKeepAlive) {
+    delete gVMKeepAlive;
+    gVMKeepAlive = nullptr;
+  }
+}
+
 std::shared_ptr<const DartVMData> DartVMRef::GetVMData() {
   std::scoped_lock lock(gVMDependentsMutex);
   return gVMData.lock();
@@ -31,8 +31,15 @@ class DartVMRef {
       fml::RefPtr<DartSnapshot> vm_snapshot = nullptr,
       fml::RefPtr<DartSnapshot> isolate_snapshot = nullptr);
 
+  // An empty reference that evaluates to false. Used by clients that can
+  // only acquire their VM reference after construction, such as the shell
+  // during parallel startup.
+  DartVMRef();
+
   DartVMRef(DartVMRef&&);
 
+  DartVMRef& operator=(DartVMRef&&);
+
   ~DartVMRef();
 
   // This is an inherently racy way to check if a VM instance is running and
@@ -40,6 +47,14 @@ class DartVMRef {
   // model.
   static bool IsInstanceRunning();
 
+  // Drops the keep-alive reference installed by a launch whose settings
+  // asked for |vm_keep_alive_seconds|. If the keep-alive reference is the
+  // last one, the VM is collected immediately; otherwise shells keep the VM
+  // alive as usual but no keep-alive window applies once they are gone.
+  // Called in response to memory pressure; may be called from any thread,
+  // with or without a running VM.
+  static void CollectKeepAliveVM();
+
   static std::shared_ptr<const DartVMData> GetVMData();
 
   static std::shared_ptr<ServiceProtocol> GetServiceProtocol();
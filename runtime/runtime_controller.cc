@@ -128,9 +128,22 @@ std::unique_ptr<RuntimeController> RuntimeController::Clone() const {
       ));
 }
 
+bool RuntimeController::InheritWindowData(const RuntimeController& other) {
+  window_data_ = other.window_data_;
+  return FlushRuntimeStateToIsolate();
+}
+
 bool RuntimeController::FlushRuntimeStateToIsolate() {
-  return SetViewportMetrics(window_data_.viewport_metrics) &&
-         SetLocales(window_data_.locale_data) &&
+  // The full flush only happens when an isolate starts (or restarts); deliver
+  // the metrics immediately rather than waiting for the first frame since the
+  // isolate reads the window dimensions during its initial build.
+  viewport_metrics_pending_ = true;
+  if (auto* window = GetWindowIfAvailable()) {
+    PushPendingViewportMetrics(window);
+  } else {
+    return false;
+  }
+  return SetLocales(window_data_.locale_data) &&
          SetPlatformResolvedLocale(
              window_data_.platform_resolved_locale_data) &&
          SetSemanticsEnabled(window_data_.semantics_enabled) &&
@@ -142,18 +155,31 @@ bool RuntimeController::FlushRuntimeStateToIsolate() {
 bool RuntimeController::SetViewportMetrics(const ViewportMetrics& metrics) {
   window_data_.viewport_metrics = metrics;
 
-  if (auto* window = GetWindowIfAvailable()) {
-    window->UpdateWindowMetrics(metrics);
+  if (GetWindowIfAvailable()) {
+    // Latest wins: the update is delivered at the top of the next frame (the
+    // engine schedules one for every metrics change) or alongside the next
+    // window data update, so resize storms cross into Dart at most once per
+    // frame.
+    viewport_metrics_pending_ = true;
     return true;
   }
   return false;
 }
 
+void RuntimeController::PushPendingViewportMetrics(Window* window) {
+  if (!viewport_metrics_pending_) {
+    return;
+  }
+  viewport_metrics_pending_ = false;
+  window->UpdateWindowMetrics(window_data_.viewport_metrics);
+}
+
 bool RuntimeController::SetLocales(
     const std::vector<std::string>& locale_data) {
   window_data_.locale_data = locale_data;
 
   if (auto* window = GetWindowIfAvailable()) {
+    PushPendingViewportMetrics(window);
     window->UpdateLocales(locale_data);
     return true;
   }
@@ -166,6 +192,7 @@ bool RuntimeController::SetPlatformResolvedLocale(
   window_data_.platform_resolved_locale_data = locale_data;
 
   if (auto* window = GetWindowIfAvailable()) {
+    PushPendingViewportMetrics(window);
     window->UpdatePlatformResolvedLocale(locale_data);
     return true;
   }
@@ -177,6 +204,7 @@ bool RuntimeController::SetUserSettingsData(const std::string& data) {
   window_data_.user_settings_data = data;
 
   if (auto* window = GetWindowIfAvailable()) {
+    PushPendingViewportMetrics(window);
     window->UpdateUserSettingsData(window_data_.user_settings_data);
     return true;
   }
@@ -188,6 +216,7 @@ bool RuntimeController::SetLifecycleState(const std::string& data) {
   window_data_.lifecycle_state = data;
 
   if (auto* window = GetWindowIfAvailable()) {
+    PushPendingViewportMetrics(window);
     window->UpdateLifecycleState(window_data_.lifecycle_state);
     return true;
   }
@@ -219,6 +248,7 @@ bool RuntimeController::SetAccessibilityFeatures(int32_t flags) {
 
 bool RuntimeController::BeginFrame(fml::TimePoint frame_time) {
   if (auto* window = GetWindowIfAvailable()) {
+    PushPendingViewportMetrics(window);
     window->BeginFrame(frame_time);
     return true;
   }
@@ -318,6 +348,13 @@ void RuntimeController::HandlePlatformMessage(
   client_.HandlePlatformMessage(std::move(message));
 }
 
+// |WindowClient|
+void RuntimeController::RegisterBackgroundPlatformChannel(
+    const std::string& name,
+    Dart_Port port) {
+  client_.RegisterBackgroundPlatformChannel(name, port);
+}
+
 // |WindowClient|
 FontCollection& RuntimeController::GetFontCollection() {
   return client_.GetFontCollection();
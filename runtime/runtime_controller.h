@@ -135,14 +135,37 @@ class RuntimeController final : public WindowClient {
   ///
   std::unique_ptr<RuntimeController> Clone() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Replace the window state accumulated by this runtime
+  ///             controller with that of another instance and flush it to the
+  ///             root isolate. Used when a runtime controller that was cloned
+  ///             ahead of time is promoted to be the active instance during a
+  ///             cold restart and must catch up on window state that changed
+  ///             after it was cloned.
+  ///
+  /// @param[in]  other  The runtime controller whose window data to adopt.
+  ///
+  /// @return     If the window data was flushed to the root isolate.
+  ///
+  bool InheritWindowData(const RuntimeController& other);
+
   //----------------------------------------------------------------------------
   /// @brief      Forward the specified window metrics to the running isolate.
   ///             If the isolate is not running, these metrics will be saved and
   ///             flushed to the isolate when it starts.
   ///
+  ///             Metrics updates are coalesced: the latest metrics are
+  ///             delivered to the isolate at most once per frame (just before
+  ///             the frame begins) or along with the next locale, user
+  ///             settings or lifecycle update, whichever comes first.
+  ///             Interactive window resizes can produce dozens of metrics
+  ///             changes per frame and only the last one can affect what is
+  ///             drawn.
+  ///
   /// @param[in]  metrics  The metrics.
   ///
-  /// @return     If the window metrics were forwarded to the running isolate.
+  /// @return     If the window metrics were accepted for delivery to the
+  ///             running isolate.
   ///
   bool SetViewportMetrics(const ViewportMetrics& metrics);
 
@@ -269,10 +292,11 @@ class RuntimeController final : public WindowClient {
   ///
   /// @see        `Engine::ReportTimings`, `FrameTiming`
   ///
-  /// @param[in]  timings  Collection of `FrameTiming::kCount` * `n` timestamps
-  ///                      for `n` frames whose timings have not been reported
-  ///                      yet. A collection of integers is reported here for
-  ///                      easier conversions to Dart objects. The timestamps
+  /// @param[in]  timings  Collection of `FrameTiming::kStatisticsCount` * `n`
+  ///                      values for `n` frames whose timings have not been
+  ///                      reported yet. A collection of integers is reported
+  ///                      here for easier conversions to Dart objects. The
+  ///                      timestamps
   ///                      are measured against the system monotonic clock
   ///                      measured in microseconds.
   ///
@@ -490,10 +514,19 @@ class RuntimeController final : public WindowClient {
   const fml::closure isolate_shutdown_callback_;
   std::shared_ptr<const fml::Mapping> persistent_isolate_data_;
 
+  // Whether |window_data_.viewport_metrics| has changed since metrics were
+  // last delivered to the isolate.
+  bool viewport_metrics_pending_ = false;
+
   Window* GetWindowIfAvailable();
 
   bool FlushRuntimeStateToIsolate();
 
+  // Delivers coalesced viewport metrics to the window if an update is
+  // pending. Called before any other window data is pushed so the isolate
+  // observes updates in the order the platform reported them.
+  void PushPendingViewportMetrics(Window* window);
+
   // |WindowClient|
   std::string DefaultRouteName() override;
 
@@ -509,6 +542,10 @@ class RuntimeController final : public WindowClient {
   // |WindowClient|
   void HandlePlatformMessage(fml::RefPtr<PlatformMessage> message) override;
 
+  // |WindowClient|
+  void RegisterBackgroundPlatformChannel(const std::string& name,
+                                         Dart_Port port) override;
+
   // |WindowClient|
   FontCollection& GetFontCollection() override;
 
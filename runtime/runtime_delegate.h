@@ -30,6 +30,9 @@ class RuntimeDelegate {
 
   virtual void HandlePlatformMessage(fml::RefPtr<PlatformMessage> message) = 0;
 
+  virtual void RegisterBackgroundPlatformChannel(const std::string& name,
+                                                 Dart_Port port) = 0;
+
   virtual FontCollection& GetFontCollection() = 0;
 
   virtual void UpdateIsolateDescription(const std::string isolate_name,
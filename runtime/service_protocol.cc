@@ -10,9 +10,11 @@
 
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "flutter/fml/closure.h"
 #include "flutter/fml/posix_wrappers.h"
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "rapidjson/stringbuffer.h"
@@ -35,6 +37,20 @@ const std::string_view ServiceProtocol::kGetDisplayRefreshRateExtensionName =
     "_flutter.getDisplayRefreshRate";
 const std::string_view ServiceProtocol::kGetSkSLsExtensionName =
     "_flutter.getSkSLs";
+const std::string_view ServiceProtocol::kGetWarmUpTimingsExtensionName =
+    "_flutter.getWarmUpTimings";
+const std::string_view ServiceProtocol::kGetMemoryUsageExtensionName =
+    "_flutter.getMemoryUsage";
+const std::string_view ServiceProtocol::kStartProfilingExtensionName =
+    "_flutter.startProfiling";
+const std::string_view ServiceProtocol::kStopProfilingExtensionName =
+    "_flutter.stopProfiling";
+const std::string_view ServiceProtocol::kGetProfilerSamplesExtensionName =
+    "_flutter.getProfilerSamples";
+const std::string_view ServiceProtocol::kGetFrameStatisticsExtensionName =
+    "_flutter.getFrameStatistics";
+const std::string_view ServiceProtocol::kGetRasterCacheStatsExtensionName =
+    "_flutter.getRasterCacheStats";
 
 static constexpr std::string_view kViewIdPrefx = "_flutterView/";
 static constexpr std::string_view kListViewsExtensionName =
@@ -53,8 +69,15 @@ ServiceProtocol::ServiceProtocol()
           kSetAssetBundlePathExtensionName,
           kGetDisplayRefreshRateExtensionName,
           kGetSkSLsExtensionName,
+          kGetWarmUpTimingsExtensionName,
+          kGetMemoryUsageExtensionName,
+          kStartProfilingExtensionName,
+          kStopProfilingExtensionName,
+          kGetProfilerSamplesExtensionName,
+          kGetFrameStatisticsExtensionName,
+          kGetRasterCacheStatsExtensionName,
       }),
-      handlers_mutex_(fml::SharedMutex::Create()) {}
+      handlers_(std::make_shared<HandlerMap>()) {}
 
 ServiceProtocol::~ServiceProtocol() {
   ToggleHooks(false);
@@ -62,21 +85,38 @@ ServiceProtocol::~ServiceProtocol() {
 
 void ServiceProtocol::AddHandler(Handler* handler,
                                  Handler::Description description) {
-  fml::UniqueLock lock(*handlers_mutex_);
-  handlers_.emplace(handler, description);
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  auto new_handlers =
+      std::make_shared<HandlerMap>(*std::atomic_load(&handlers_));
+  (*new_handlers)[handler] =
+      std::make_shared<HandlerDescriptionSlot>(std::move(description));
+  std::atomic_store(&handlers_,
+                    std::shared_ptr<const HandlerMap>(std::move(new_handlers)));
 }
 
 void ServiceProtocol::RemoveHandler(Handler* handler) {
-  fml::UniqueLock lock(*handlers_mutex_);
-  handlers_.erase(handler);
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  auto new_handlers =
+      std::make_shared<HandlerMap>(*std::atomic_load(&handlers_));
+  new_handlers->erase(handler);
+  std::atomic_store(&handlers_,
+                    std::shared_ptr<const HandlerMap>(std::move(new_handlers)));
+  // Dispatches that snapshotted an older map may still reference the
+  // handler; wait for them to drain before the caller tears it down.
+  while (inflight_dispatches_.load(std::memory_order_acquire) > 0) {
+    std::this_thread::yield();
+  }
 }
 
 void ServiceProtocol::SetHandlerDescription(Handler* handler,
                                             Handler::Description description) {
-  fml::SharedLock lock(*handlers_mutex_);
-  auto it = handlers_.find(handler);
-  if (it != handlers_.end())
-    it->second.Store(description);
+  // Called on every isolate lifecycle event. Updating the per-handler slot
+  // leaves the published map untouched, so concurrent isolate spawns never
+  // serialize on the registry.
+  auto handlers = std::atomic_load(&handlers_);
+  auto it = handlers->find(handler);
+  if (it != handlers->end())
+    it->second->Store(description);
 }
 
 void ServiceProtocol::ToggleHooks(bool set) {
@@ -183,9 +223,14 @@ bool ServiceProtocol::HandleMessage(std::string_view method,
     return HandleListViewsMethod(response);
   }
 
-  fml::SharedLock lock(*handlers_mutex_);
+  inflight_dispatches_.fetch_add(1, std::memory_order_acq_rel);
+  fml::ScopedCleanupClosure unpin([this]() {
+    inflight_dispatches_.fetch_sub(1, std::memory_order_acq_rel);
+  });
+
+  auto handlers = std::atomic_load(&handlers_);
 
-  if (handlers_.size() == 0) {
+  if (handlers->size() == 0) {
     WriteServerErrorResponse(response,
                              "There are no running service protocol handlers.");
     return false;
@@ -196,8 +241,8 @@ bool ServiceProtocol::HandleMessage(std::string_view method,
   if (view_id_param_found != params.end()) {
     auto* handler = reinterpret_cast<Handler*>(std::stoull(
         view_id_param_found->second.data() + kViewIdPrefx.size(), nullptr, 16));
-    auto handler_found = handlers_.find(handler);
-    if (handler_found != handlers_.end()) {
+    auto handler_found = handlers->find(handler);
+    if (handler_found != handlers->end()) {
       return HandleMessageOnHandler(handler, method, params, response);
     }
   }
@@ -208,7 +253,7 @@ bool ServiceProtocol::HandleMessage(std::string_view method,
   if (method == kScreenshotExtensionName ||
       method == kScreenshotSkpExtensionName ||
       method == kFlushUIThreadTasksExtensionName) {
-    return HandleMessageOnHandler(handlers_.begin()->first, method, params,
+    return HandleMessageOnHandler(handlers->begin()->first, method, params,
                                   response);
   }
 
@@ -254,11 +299,11 @@ void ServiceProtocol::Handler::Description::Write(
 
 bool ServiceProtocol::HandleListViewsMethod(
     rapidjson::Document& response) const {
-  fml::SharedLock lock(*handlers_mutex_);
+  auto handlers = std::atomic_load(&handlers_);
   std::vector<std::pair<intptr_t, Handler::Description>> descriptions;
-  for (const auto& handler : handlers_) {
+  for (const auto& handler : *handlers) {
     descriptions.emplace_back(reinterpret_cast<intptr_t>(handler.first),
-                              handler.second.Load());
+                              handler.second->Load());
   }
 
   auto& allocator = response.GetAllocator();
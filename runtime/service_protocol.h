@@ -5,7 +5,10 @@
 #ifndef FLUTTER_RUNTIME_SERVICE_PROTOCOL_H_
 #define FLUTTER_RUNTIME_SERVICE_PROTOCOL_H_
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <string_view>
@@ -13,7 +16,6 @@
 #include "flutter/fml/compiler_specific.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/synchronization/atomic_object.h"
-#include "flutter/fml/synchronization/shared_mutex.h"
 #include "flutter/fml/task_runner.h"
 #include "rapidjson/document.h"
 
@@ -28,6 +30,13 @@ class ServiceProtocol {
   static const std::string_view kSetAssetBundlePathExtensionName;
   static const std::string_view kGetDisplayRefreshRateExtensionName;
   static const std::string_view kGetSkSLsExtensionName;
+  static const std::string_view kGetWarmUpTimingsExtensionName;
+  static const std::string_view kGetMemoryUsageExtensionName;
+  static const std::string_view kStartProfilingExtensionName;
+  static const std::string_view kStopProfilingExtensionName;
+  static const std::string_view kGetProfilerSamplesExtensionName;
+  static const std::string_view kGetFrameStatisticsExtensionName;
+  static const std::string_view kGetRasterCacheStatsExtensionName;
 
   class Handler {
    public:
@@ -73,9 +82,21 @@ class ServiceProtocol {
                              Handler::Description description);
 
  private:
+  using HandlerDescriptionSlot = fml::AtomicObject<Handler::Description>;
+  using HandlerMap = std::map<Handler*, std::shared_ptr<HandlerDescriptionSlot>>;
+
   const std::set<std::string_view> endpoints_;
-  std::unique_ptr<fml::SharedMutex> handlers_mutex_;
-  std::map<Handler*, fml::AtomicObject<Handler::Description>> handlers_;
+  // The handler registry is read-copy-update: writers copy the current map,
+  // mutate the copy under |write_mutex_| and publish it with an atomic
+  // store, so readers on arbitrary service protocol threads take lock-free
+  // snapshots. Isolate lifecycle notifications only update the per-handler
+  // description slot and never copy the map.
+  std::shared_ptr<const HandlerMap> handlers_;
+  std::mutex write_mutex_;
+  // The number of message dispatches currently running against a snapshot.
+  // |RemoveHandler| waits for this to drain so a handler is never called
+  // after its removal returns (the RCU grace period).
+  mutable std::atomic<size_t> inflight_dispatches_ = {0};
 
   [[nodiscard]] static bool HandleMessage(const char* method,
                                           const char** param_keys,
@@ -8,8 +8,24 @@
 
 namespace flutter {
 
+namespace {
+
+// Depth of nested FrameCriticalScopes on the current thread. Tasks added
+// while this is nonzero go to the frame critical lane.
+thread_local size_t tls_frame_critical_depth = 0;
+
+}  // namespace
+
+SkiaConcurrentExecutor::FrameCriticalScope::FrameCriticalScope() {
+  tls_frame_critical_depth++;
+}
+
+SkiaConcurrentExecutor::FrameCriticalScope::~FrameCriticalScope() {
+  tls_frame_critical_depth--;
+}
+
 SkiaConcurrentExecutor::SkiaConcurrentExecutor(const OnWorkCallback& on_work)
-    : on_work_(on_work) {}
+    : on_work_(on_work), lanes_(std::make_shared<TaskLanes>()) {}
 
 SkiaConcurrentExecutor::~SkiaConcurrentExecutor() = default;
 
@@ -17,10 +33,68 @@ void SkiaConcurrentExecutor::add(fml::closure work) {
   if (!work) {
     return;
   }
-  on_work_([work]() {
-    TRACE_EVENT0("flutter", "SkiaExecutor");
-    work();
+  {
+    std::scoped_lock lock(lanes_->mutex);
+    if (tls_frame_critical_depth > 0) {
+      lanes_->frame_critical.push_back(std::move(work));
+    } else {
+      lanes_->background.push_back(std::move(work));
+    }
+  }
+  // Wrappers are not bound to the task they were scheduled for: each one
+  // runs whatever is most urgent by the time a worker picks it up, which is
+  // how frame critical tasks overtake background tasks that were added
+  // earlier.
+  on_work_([lanes = lanes_, on_work = on_work_]() {
+    RunNextTask(lanes, on_work);
   });
 }
 
+void SkiaConcurrentExecutor::RunNextTask(
+    const std::shared_ptr<TaskLanes>& lanes,
+    const OnWorkCallback& on_work) {
+  fml::closure task;
+  bool is_background = false;
+  {
+    std::scoped_lock lock(lanes->mutex);
+    if (!lanes->frame_critical.empty()) {
+      task = std::move(lanes->frame_critical.front());
+      lanes->frame_critical.pop_front();
+    } else if (!lanes->background.empty() &&
+               lanes->background_running < kMaxConcurrentBackgroundTasks) {
+      task = std::move(lanes->background.front());
+      lanes->background.pop_front();
+      lanes->background_running++;
+      is_background = true;
+    } else {
+      // Either an earlier wrapper already claimed this wrapper's task, or
+      // the background lane is at its concurrency cap. Deferred background
+      // tasks are rescheduled below when a running one completes.
+      return;
+    }
+  }
+
+  if (is_background) {
+    TRACE_EVENT0("flutter", "SkiaExecutorBackground");
+    task();
+  } else {
+    TRACE_EVENT0("flutter", "SkiaExecutor");
+    task();
+  }
+
+  if (!is_background) {
+    return;
+  }
+
+  bool reschedule = false;
+  {
+    std::scoped_lock lock(lanes->mutex);
+    lanes->background_running--;
+    reschedule = !lanes->background.empty();
+  }
+  if (reschedule) {
+    on_work([lanes, on_work]() { RunNextTask(lanes, on_work); });
+  }
+}
+
 }  // namespace flutter
@@ -5,6 +5,10 @@
 #ifndef FLUTTER_RUNTIME_SKIA_CONCURRENT_EXECUTOR_H_
 #define FLUTTER_RUNTIME_SKIA_CONCURRENT_EXECUTOR_H_
 
+#include <deque>
+#include <memory>
+#include <mutex>
+
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
 #include "third_party/skia/include/core/SkExecutor.h"
@@ -24,6 +28,13 @@ namespace flutter {
 ///             worker pool is held next to the process global Dart VM instance.
 ///             The Skia executor is wired up there as well.
 ///
+///             Tasks are split into two priority lanes. Tasks added while a
+///             |FrameCriticalScope| is alive on the adding thread (the helper
+///             jobs Skia spawns mid flush, e.g. path mask generation and SkSL
+///             compilation) run before any queued background task, and the
+///             number of background tasks executing at once is capped so a
+///             batch of them cannot occupy every worker in the shared pool.
+///
 class SkiaConcurrentExecutor : public SkExecutor {
  public:
   //----------------------------------------------------------------------------
@@ -32,6 +43,23 @@ class SkiaConcurrentExecutor : public SkExecutor {
   ///
   using OnWorkCallback = std::function<void(fml::closure work)>;
 
+  //----------------------------------------------------------------------------
+  /// @brief      While an instance is alive on a thread, tasks added to any
+  ///             executor from that thread are frame critical: they jump the
+  ///             queue of pending background tasks instead of lining up
+  ///             behind them. The rasterizer holds one for the duration of a
+  ///             frame.
+  ///
+  class FrameCriticalScope {
+   public:
+    FrameCriticalScope();
+
+    ~FrameCriticalScope();
+
+   private:
+    FML_DISALLOW_COPY_AND_ASSIGN(FrameCriticalScope);
+  };
+
   //----------------------------------------------------------------------------
   /// @brief      Create a new instance of the executor.
   ///
@@ -46,7 +74,32 @@ class SkiaConcurrentExecutor : public SkExecutor {
   void add(fml::closure work) override;
 
  private:
+  // The two priority lanes. Shared with the wrappers scheduled on the
+  // worker pool so that in-flight wrappers stay safe if the executor is
+  // torn down before they run.
+  struct TaskLanes {
+    std::mutex mutex;
+    std::deque<fml::closure> frame_critical;
+    std::deque<fml::closure> background;
+    // The number of background tasks currently executing on workers.
+    size_t background_running = 0;
+  };
+
+  // At most this many background tasks may occupy workers at once; the
+  // rest of the pool stays available for frame critical work (and for
+  // clients that post to the concurrent loop directly, such as image
+  // decoding).
+  static constexpr size_t kMaxConcurrentBackgroundTasks = 2;
+
+  // Runs the most urgent pending task, if any may run. Each wrapper
+  // scheduled on the pool executes at most one task; background tasks
+  // deferred by the concurrency cap are rescheduled when a running
+  // background task completes.
+  static void RunNextTask(const std::shared_ptr<TaskLanes>& lanes,
+                          const OnWorkCallback& on_work);
+
   OnWorkCallback on_work_;
+  std::shared_ptr<TaskLanes> lanes_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(SkiaConcurrentExecutor);
 };
@@ -0,0 +1,106 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/runtime/skia_concurrent_executor.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+// Collects the wrappers an executor schedules instead of running them so
+// tests can drain them deterministically on the current thread.
+class WrapperQueue {
+ public:
+  SkiaConcurrentExecutor::OnWorkCallback Callback() {
+    return [this](fml::closure work) { wrappers_.push_back(work); };
+  }
+
+  // Runs queued wrappers in FIFO order, including any scheduled while
+  // draining. Safe to call from within a wrapper: a nested drain consumes
+  // the remaining wrappers and the outer drain resumes after them.
+  void Drain() {
+    while (next_ < wrappers_.size()) {
+      wrappers_[next_++]();
+    }
+  }
+
+ private:
+  std::vector<fml::closure> wrappers_;
+  size_t next_ = 0;
+};
+
+TEST(SkiaConcurrentExecutor, FrameCriticalTasksRunBeforeQueuedBackground) {
+  WrapperQueue queue;
+  SkiaConcurrentExecutor executor(queue.Callback());
+
+  std::vector<std::string> order;
+  executor.add([&order]() { order.push_back("b1"); });
+  executor.add([&order]() { order.push_back("b2"); });
+  {
+    SkiaConcurrentExecutor::FrameCriticalScope scope;
+    executor.add([&order]() { order.push_back("fc"); });
+  }
+
+  queue.Drain();
+
+  // The frame critical task overtakes both background tasks that were added
+  // before it.
+  ASSERT_EQ(order, (std::vector<std::string>{"fc", "b1", "b2"}));
+}
+
+TEST(SkiaConcurrentExecutor, ScopeOnlyAffectsItsOwnLifetime) {
+  WrapperQueue queue;
+  SkiaConcurrentExecutor executor(queue.Callback());
+
+  std::vector<std::string> order;
+  {
+    SkiaConcurrentExecutor::FrameCriticalScope scope;
+    executor.add([&order]() { order.push_back("fc"); });
+  }
+  executor.add([&order]() { order.push_back("b1"); });
+
+  queue.Drain();
+
+  ASSERT_EQ(order, (std::vector<std::string>{"fc", "b1"}));
+}
+
+TEST(SkiaConcurrentExecutor, CapsConcurrentBackgroundTasks) {
+  WrapperQueue queue;
+  SkiaConcurrentExecutor executor(queue.Callback());
+
+  // Each background task drains the remaining wrappers while it is still
+  // running, simulating the rest of the pool picking them up concurrently.
+  std::vector<std::string> order;
+  size_t running = 0;
+  size_t max_running = 0;
+  auto background_task = [&](const std::string& name) {
+    return [&, name]() {
+      running++;
+      max_running = std::max(max_running, running);
+      queue.Drain();
+      order.push_back(name);
+      running--;
+    };
+  };
+
+  executor.add(background_task("b1"));
+  executor.add(background_task("b2"));
+  executor.add(background_task("b3"));
+  executor.add(background_task("b4"));
+
+  queue.Drain();
+
+  // No more than two background tasks were in flight at once, but every
+  // deferred task still ran exactly once after a completion freed a slot.
+  ASSERT_EQ(max_running, 2u);
+  ASSERT_EQ(order, (std::vector<std::string>{"b2", "b3", "b4", "b1"}));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -4,6 +4,8 @@
 
 #include "flutter/shell/common/animator.h"
 
+#include <algorithm>
+
 #include "flutter/fml/trace_event.h"
 #include "third_party/dart/runtime/include/dart_tools_api.h"
 
@@ -17,29 +19,53 @@ namespace {
 constexpr fml::TimeDelta kNotifyIdleTaskWaitTime =
     fml::TimeDelta::FromMilliseconds(51);
 
+// The number of consecutive cheap frames the pacing governor requires before
+// reducing the frame cadence. Speeding back up is immediate.
+constexpr uint32_t kCheapFrameStreakThreshold = 8;
+
+// The governor never reduces the delivered frame rate below this.
+constexpr float kMinGovernedFrameRate = 30.0f;
+
+// How far the raster stage may run behind, in display periods, before the
+// animator stops building layer trees that would only queue up behind it.
+constexpr float kRasterBackpressureFrameThreshold = 1.5f;
+
+// The lag estimate only refreshes when the raster stage finishes a frame, so
+// a build is forced through periodically to keep the estimate from going
+// stale and throttling forever.
+constexpr uint32_t kMaxConsecutiveBackpressureSkips = 2;
+
+uint32_t DefaultPipelineDepth(const TaskRunners& task_runners) {
+#if FLUTTER_SHELL_ENABLE_METAL
+  return 2;
+#else   // FLUTTER_SHELL_ENABLE_METAL
+  // TODO(dnfield): We should remove this logic and set the pipeline depth
+  // back to 2 in this case. See
+  // https://github.com/flutter/engine/pull/9132 for discussion.
+  return task_runners.GetPlatformTaskRunner() ==
+                 task_runners.GetRasterTaskRunner()
+             ? 1
+             : 2;
+#endif  // FLUTTER_SHELL_ENABLE_METAL
+}
+
 }  // namespace
 
 Animator::Animator(Delegate& delegate,
                    TaskRunners task_runners,
-                   std::unique_ptr<VsyncWaiter> waiter)
+                   std::unique_ptr<VsyncWaiter> waiter,
+                   uint32_t pipeline_depth,
+                   PipelineConsumeMode pipeline_consume_mode)
     : delegate_(delegate),
       task_runners_(std::move(task_runners)),
       waiter_(std::move(waiter)),
       last_frame_begin_time_(),
       last_frame_target_time_(),
       dart_frame_deadline_(0),
-#if FLUTTER_SHELL_ENABLE_METAL
-      layer_tree_pipeline_(fml::MakeRefCounted<LayerTreePipeline>(2)),
-#else   // FLUTTER_SHELL_ENABLE_METAL
-      // TODO(dnfield): We should remove this logic and set the pipeline depth
-      // back to 2 in this case. See
-      // https://github.com/flutter/engine/pull/9132 for discussion.
       layer_tree_pipeline_(fml::MakeRefCounted<LayerTreePipeline>(
-          task_runners.GetPlatformTaskRunner() ==
-                  task_runners.GetRasterTaskRunner()
-              ? 1
-              : 2)),
-#endif  // FLUTTER_SHELL_ENABLE_METAL
+          pipeline_depth > 0 ? pipeline_depth
+                             : DefaultPipelineDepth(task_runners_),
+          pipeline_consume_mode)),
       pending_frame_semaphore_(1),
       frame_number_(1),
       paused_(false),
@@ -56,6 +82,10 @@ float Animator::GetDisplayRefreshRate() const {
   return waiter_->GetDisplayRefreshRate();
 }
 
+int Animator::GetPipelineInflightDepth() const {
+  return layer_tree_pipeline_->GetInflightDepth();
+}
+
 void Animator::Stop() {
   paused_ = true;
 }
@@ -114,6 +144,19 @@ void Animator::BeginFrame(fml::TimePoint frame_start_time,
   regenerate_layer_tree_ = false;
   pending_frame_semaphore_.Signal();
 
+  if (ShouldSkipBeginFrameForBackpressure() &&
+      backpressure_skip_streak_ < kMaxConsecutiveBackpressureSkips) {
+    // The raster stage is running well over a display period behind. A tree
+    // built now would either park in the pipeline or be dropped, so skip the
+    // build entirely and leave the UI thread free; try again at the next
+    // frame interval.
+    backpressure_skip_streak_++;
+    TRACE_EVENT_INSTANT0("flutter", "AnimatorBackpressureSkip");
+    RequestFrame();
+    return;
+  }
+  backpressure_skip_streak_ = 0;
+
   if (!producer_continuation_) {
     // We may already have a valid pipeline continuation in case a previous
     // begin frame did not result in an Animation::Render. Simply reuse that
@@ -134,8 +177,17 @@ void Animator::BeginFrame(fml::TimePoint frame_start_time,
   FML_DCHECK(producer_continuation_);
 
   last_frame_begin_time_ = frame_start_time;
+  last_frame_build_start_time_ = fml::TimePoint::Now();
   last_frame_target_time_ = frame_target_time;
   dart_frame_deadline_ = FxlToDartOrEarlier(frame_target_time);
+
+  // Let the raster side overlap its per-frame preparation with the build
+  // below. Frames are almost always the same size as the previous one; a
+  // resize just wastes the preparation.
+  if (!last_layer_tree_size_.isEmpty()) {
+    delegate_.OnAnimatorPrepareFrame(last_layer_tree_size_);
+  }
+
   {
     TRACE_EVENT2("flutter", "Framework Workload", "mode", "basic", "frame",
                  FrameParity());
@@ -184,6 +236,15 @@ void Animator::Render(std::unique_ptr<flutter::LayerTree> layer_tree) {
                                 last_frame_target_time_);
   }
 
+  // Feed the wall time spent building this frame into the vsync waiter's wake
+  // time predictor. Measured from when |BeginFrame| actually ran rather than
+  // the vsync timestamp so that a deferred wake is not counted as build time.
+  if (last_frame_build_start_time_ != fml::TimePoint()) {
+    last_frame_build_duration_ =
+        fml::TimePoint::Now() - last_frame_build_start_time_;
+    waiter_->RecordFrameBuildDuration(last_frame_build_duration_);
+  }
+
   // Commit the pending continuation.
   bool result = producer_continuation_.Complete(std::move(layer_tree));
   if (!result) {
@@ -254,4 +315,142 @@ void Animator::ScheduleSecondaryVsyncCallback(const fml::closure& callback) {
   waiter_->ScheduleSecondaryCallback(callback);
 }
 
+void Animator::SetFramePacingGovernorEnabled(bool enabled) {
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners_.GetUITaskRunner(),
+      [self = weak_factory_.GetWeakPtr(), enabled] {
+        if (!self) {
+          return;
+        }
+        self->frame_pacing_governor_enabled_ = enabled;
+        self->UpdateFrameCadence();
+      });
+}
+
+void Animator::SetFrameCadenceOverride(uint32_t divisor) {
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners_.GetUITaskRunner(),
+      [self = weak_factory_.GetWeakPtr(), divisor] {
+        if (!self) {
+          return;
+        }
+        self->frame_cadence_override_ = divisor;
+        self->UpdateFrameCadence();
+      });
+}
+
+void Animator::RecordFrameRasterDuration(fml::TimeDelta raster_duration) {
+  // Backpressure tracking is unconditional; the governor below is opt-in.
+  last_raster_duration_micros_ = raster_duration.ToMicroseconds();
+
+  if (!frame_pacing_governor_enabled_ && frame_cadence_override_ == 0) {
+    return;
+  }
+  const int64_t sample =
+      (raster_duration + last_frame_build_duration_).ToMicroseconds();
+  if (sample <= 0) {
+    return;
+  }
+  // New samples contribute a quarter to the moving average, mirroring the
+  // vsync waiter's build time predictor.
+  if (average_frame_cost_micros_ == 0) {
+    average_frame_cost_micros_ = sample;
+  } else {
+    average_frame_cost_micros_ = (3 * average_frame_cost_micros_ + sample) / 4;
+  }
+  UpdateFrameCadence();
+}
+
+void Animator::RecordFramePresentationDelay(
+    fml::TimeDelta presentation_delay) {
+  last_present_delay_micros_ = presentation_delay.ToMicroseconds();
+  if (frame_pacing_governor_enabled_ && frame_cadence_override_ == 0) {
+    UpdateFrameCadence();
+  }
+}
+
+bool Animator::ShouldSkipBeginFrameForBackpressure() const {
+  const float refresh_rate = waiter_->GetDisplayRefreshRate();
+  if (refresh_rate <= 0) {
+    return false;
+  }
+  const int64_t interval_micros =
+      static_cast<int64_t>(1000000.0f / refresh_rate);
+  const int64_t threshold_micros = static_cast<int64_t>(
+      interval_micros * kRasterBackpressureFrameThreshold);
+  // Either signal indicates sustained raster overload: frames taking longer
+  // than the threshold to rasterize, or presents landing that far after
+  // submission because the compositor queue has grown.
+  return last_raster_duration_micros_ > threshold_micros ||
+         last_present_delay_micros_ > threshold_micros;
+}
+
+float Animator::GetGovernedBaseRefreshRate() {
+  const float reported = waiter_->GetDisplayRefreshRate();
+  // Rate negotiation lowers the reported rate to the granted one; govern
+  // against the fastest rate observed so a granted slowdown is not mistaken
+  // for a slower panel and the cadence can recover to the full rate.
+  if (reported > governed_base_refresh_rate_) {
+    governed_base_refresh_rate_ = reported;
+  }
+  return governed_base_refresh_rate_;
+}
+
+void Animator::UpdateFrameCadence() {
+  uint32_t cadence = 1;
+  if (frame_cadence_override_ > 0) {
+    cadence = frame_cadence_override_;
+  } else if (frame_pacing_governor_enabled_) {
+    const float refresh_rate = GetGovernedBaseRefreshRate();
+    if (refresh_rate > 0) {
+      const int64_t interval_micros =
+          static_cast<int64_t>(1000000.0f / refresh_rate);
+      uint32_t desired = 1;
+      if (average_frame_cost_micros_ * 6 < interval_micros) {
+        desired = 3;
+      } else if (average_frame_cost_micros_ * 4 < interval_micros) {
+        desired = 2;
+      }
+      while (desired > 1 && refresh_rate / desired < kMinGovernedFrameRate) {
+        desired--;
+      }
+      if (desired > applied_frame_cadence_) {
+        // Only slow down after a sustained run of cheap frames so a single
+        // quiet frame in an animation does not cause a visible rate dip.
+        if (++cheap_frame_streak_ < kCheapFrameStreakThreshold) {
+          desired = applied_frame_cadence_;
+        }
+      } else {
+        cheap_frame_streak_ = 0;
+      }
+      // Compositor backpressure: when frames are presented more than a
+      // display period after submission, producing at full rate only grows
+      // the queue (and the latency). Drop to half cadence right away - the
+      // cheap-frame streak gate does not apply to a latency fix - until the
+      // present latency recovers.
+      if (last_present_delay_micros_ > interval_micros &&
+          refresh_rate / 2 >= kMinGovernedFrameRate) {
+        desired = std::max(desired, 2u);
+      }
+      cadence = desired;
+    }
+  }
+  if (cadence != applied_frame_cadence_) {
+    applied_frame_cadence_ = cadence;
+    // Prefer negotiating the rate with the display itself: variable refresh
+    // displays settle on a granted hardware rate, which saves more power
+    // than delivering every vsync and skipping in software. When the waiter
+    // takes the hint, the software cadence stays at one so the two
+    // mechanisms cannot compound.
+    const float refresh_rate = GetGovernedBaseRefreshRate();
+    if (refresh_rate > 0 &&
+        waiter_->SetDesiredFrameInterval(fml::TimeDelta::FromMicroseconds(
+            static_cast<int64_t>(1000000.0f / refresh_rate) * cadence))) {
+      waiter_->SetFrameCadence(1);
+    } else {
+      waiter_->SetFrameCadence(cadence);
+    }
+  }
+}
+
 }  // namespace flutter
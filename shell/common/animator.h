@@ -32,6 +32,12 @@ class Animator final {
    public:
     virtual void OnAnimatorBeginFrame(fml::TimePoint frame_target_time) = 0;
 
+    // Notifies the delegate that a frame of the given expected physical size
+    // is about to be built, so the raster side may start per-frame
+    // preparation (such as speculative frame acquisition) concurrently with
+    // the build.
+    virtual void OnAnimatorPrepareFrame(SkISize expected_frame_size) = 0;
+
     virtual void OnAnimatorNotifyIdle(int64_t deadline) = 0;
 
     virtual void OnAnimatorDraw(
@@ -41,14 +47,24 @@ class Animator final {
     virtual void OnAnimatorDrawLastLayerTree() = 0;
   };
 
+  // |pipeline_depth| of zero selects the platform default depth;
+  // see |Settings::frame_pipeline_depth|.
   Animator(Delegate& delegate,
            TaskRunners task_runners,
-           std::unique_ptr<VsyncWaiter> waiter);
+           std::unique_ptr<VsyncWaiter> waiter,
+           uint32_t pipeline_depth = 0,
+           PipelineConsumeMode pipeline_consume_mode =
+               PipelineConsumeMode::kOldestFirst);
 
   ~Animator();
 
   float GetDisplayRefreshRate() const;
 
+  // The number of frames currently owned by the rendering pipeline - being
+  // built, queued, or rasterized. Non-zero means a pipeline slot can free
+  // at an upcoming vsync and re-engage the UI thread.
+  int GetPipelineInflightDepth() const;
+
   void RequestFrame(bool regenerate_layer_tree = true);
 
   void Render(std::unique_ptr<flutter::LayerTree> layer_tree);
@@ -70,6 +86,38 @@ class Animator final {
   /// @see      `PointerDataDispatcher::ScheduleSecondaryVsyncCallback`.
   void ScheduleSecondaryVsyncCallback(const fml::closure& callback);
 
+  //--------------------------------------------------------------------------
+  /// @brief    Enable the frame pacing governor. When enabled, the animator
+  ///           tracks the combined UI build and raster cost of recent frames
+  ///           and asks the |VsyncWaiter| for half or third cadence when
+  ///           frames are cheap relative to the display period, skipping
+  ///           no-op vsyncs on high refresh rate panels to save power.
+  ///
+  /// @see      `Settings::frame_pacing_governor`.
+  void SetFramePacingGovernorEnabled(bool enabled);
+
+  //--------------------------------------------------------------------------
+  /// @brief    Embedder override for the frame cadence. A divisor greater
+  ///           than zero pins the cadence (one renders at display rate, two
+  ///           at half rate and so on) and bypasses the governor; zero
+  ///           returns control to the governor. May be called on any thread.
+  void SetFrameCadenceOverride(uint32_t divisor);
+
+  //--------------------------------------------------------------------------
+  /// @brief    Feed the raster duration of the last rasterized frame into
+  ///           the frame pacing governor. Called by the shell from the
+  ///           raster thread via the UI task runner.
+  void RecordFrameRasterDuration(fml::TimeDelta raster_duration);
+
+  //--------------------------------------------------------------------------
+  /// @brief    Feed the submit-to-present latency observed for a recently
+  ///           presented frame into the frame pacing governor. When the
+  ///           compositor falls behind (presentation more than a display
+  ///           period after submission), the governor drops to half cadence
+  ///           instead of queueing more frames into the backlog. Called by
+  ///           the shell from the raster thread via the UI task runner.
+  void RecordFramePresentationDelay(fml::TimeDelta presentation_delay);
+
   void Start();
 
   void Stop();
@@ -91,6 +139,17 @@ class Animator final {
 
   void AwaitVSync();
 
+  void UpdateFrameCadence();
+
+  // The display rate the pacing governor reasons against. Tracks the fastest
+  // rate the waiter has reported, so granted slowdowns from frame rate
+  // negotiation do not feed back into the governor.
+  float GetGovernedBaseRefreshRate();
+
+  // Whether the raster stage is far enough behind that building another
+  // layer tree would be wasted UI-thread work.
+  bool ShouldSkipBeginFrameForBackpressure() const;
+
   const char* FrameParity();
 
   Delegate& delegate_;
@@ -98,6 +157,7 @@ class Animator final {
   std::shared_ptr<VsyncWaiter> waiter_;
 
   fml::TimePoint last_frame_begin_time_;
+  fml::TimePoint last_frame_build_start_time_;
   fml::TimePoint last_frame_target_time_;
   int64_t dart_frame_deadline_;
   fml::RefPtr<LayerTreePipeline> layer_tree_pipeline_;
@@ -112,6 +172,20 @@ class Animator final {
   SkISize last_layer_tree_size_;
   std::deque<uint64_t> trace_flow_ids_;
 
+  // Frame pacing governor state; only touched on the UI thread.
+  bool frame_pacing_governor_enabled_ = false;
+  uint32_t frame_cadence_override_ = 0;
+  uint32_t applied_frame_cadence_ = 1;
+  float governed_base_refresh_rate_ = 0.0f;
+  uint32_t cheap_frame_streak_ = 0;
+  int64_t average_frame_cost_micros_ = 0;
+  int64_t last_present_delay_micros_ = -1;
+  fml::TimeDelta last_frame_build_duration_;
+
+  // Raster backpressure state; only touched on the UI thread.
+  int64_t last_raster_duration_micros_ = 0;
+  uint32_t backpressure_skip_streak_ = 0;
+
   fml::WeakPtrFactory<Animator> weak_factory_;
 
   friend class testing::ShellTest;
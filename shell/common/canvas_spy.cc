@@ -8,20 +8,17 @@ namespace flutter {
 
 CanvasSpy::CanvasSpy(SkCanvas* target_canvas) {
   SkISize canvas_size = target_canvas->getBaseLayerSize();
-  n_way_canvas_ =
-      std::make_unique<SkNWayCanvas>(canvas_size.width(), canvas_size.height());
   did_draw_canvas_ = std::make_unique<DidDrawCanvas>(canvas_size.width(),
                                                      canvas_size.height());
-  n_way_canvas_->addCanvas(target_canvas);
-  n_way_canvas_->addCanvas(did_draw_canvas_.get());
+  did_draw_canvas_->addCanvas(target_canvas);
 }
 
 SkCanvas* CanvasSpy::GetSpyingCanvas() {
-  return n_way_canvas_.get();
+  return did_draw_canvas_.get();
 }
 
 DidDrawCanvas::DidDrawCanvas(int width, int height)
-    : SkCanvasVirtualEnforcer<SkNoDrawCanvas>(width, height) {}
+    : SkNWayCanvas(width, height) {}
 
 DidDrawCanvas::~DidDrawCanvas() {}
 
@@ -38,49 +35,14 @@ bool DidDrawCanvas::DidDrawIntoCanvas() {
   return did_draw_;
 }
 
-void DidDrawCanvas::willSave() {}
-
-SkCanvas::SaveLayerStrategy DidDrawCanvas::getSaveLayerStrategy(
-    const SaveLayerRec& rec) {
-  return kNoLayer_SaveLayerStrategy;
-}
-
-bool DidDrawCanvas::onDoSaveBehind(const SkRect* bounds) {
-  return false;
-}
-
-void DidDrawCanvas::willRestore() {}
-
-void DidDrawCanvas::didConcat(const SkMatrix& matrix) {}
-
-void DidDrawCanvas::didConcat44(const SkM44&) {}
-
-void DidDrawCanvas::didScale(SkScalar, SkScalar) {}
-
-void DidDrawCanvas::didTranslate(SkScalar, SkScalar) {}
-
-void DidDrawCanvas::didSetMatrix(const SkMatrix& matrix) {}
-
-void DidDrawCanvas::onClipRect(const SkRect& rect,
-                               SkClipOp op,
-                               ClipEdgeStyle edgeStyle) {}
-
-void DidDrawCanvas::onClipRRect(const SkRRect& rrect,
-                                SkClipOp op,
-                                ClipEdgeStyle edgeStyle) {}
-
-void DidDrawCanvas::onClipPath(const SkPath& path,
-                               SkClipOp op,
-                               ClipEdgeStyle edgeStyle) {}
-
-void DidDrawCanvas::onClipRegion(const SkRegion& deviceRgn, SkClipOp op) {}
-
 void DidDrawCanvas::onDrawPaint(const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawPaint(paint);
 }
 
 void DidDrawCanvas::onDrawBehind(const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawBehind(paint);
 }
 
 void DidDrawCanvas::onDrawPoints(PointMode mode,
@@ -88,18 +50,22 @@ void DidDrawCanvas::onDrawPoints(PointMode mode,
                                  const SkPoint pts[],
                                  const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawPoints(mode, count, pts, paint);
 }
 
 void DidDrawCanvas::onDrawRect(const SkRect& rect, const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawRect(rect, paint);
 }
 
 void DidDrawCanvas::onDrawRegion(const SkRegion& region, const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawRegion(region, paint);
 }
 
 void DidDrawCanvas::onDrawOval(const SkRect& rect, const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawOval(rect, paint);
 }
 
 void DidDrawCanvas::onDrawArc(const SkRect& rect,
@@ -108,20 +74,24 @@ void DidDrawCanvas::onDrawArc(const SkRect& rect,
                               bool useCenter,
                               const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawArc(rect, startAngle, sweepAngle, useCenter, paint);
 }
 
 void DidDrawCanvas::onDrawRRect(const SkRRect& rrect, const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawRRect(rrect, paint);
 }
 
 void DidDrawCanvas::onDrawDRRect(const SkRRect& outer,
                                  const SkRRect& inner,
                                  const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawDRRect(outer, inner, paint);
 }
 
 void DidDrawCanvas::onDrawPath(const SkPath& path, const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawPath(path, paint);
 }
 
 void DidDrawCanvas::onDrawImage(const SkImage* image,
@@ -129,6 +99,7 @@ void DidDrawCanvas::onDrawImage(const SkImage* image,
                                 SkScalar top,
                                 const SkPaint* paint) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawImage(image, left, top, paint);
 }
 
 void DidDrawCanvas::onDrawImageRect(const SkImage* image,
@@ -137,6 +108,7 @@ void DidDrawCanvas::onDrawImageRect(const SkImage* image,
                                     const SkPaint* paint,
                                     SrcRectConstraint constraint) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawImageRect(image, src, dst, paint, constraint);
 }
 
 void DidDrawCanvas::onDrawImageNine(const SkImage* image,
@@ -144,6 +116,7 @@ void DidDrawCanvas::onDrawImageNine(const SkImage* image,
                                     const SkRect& dst,
                                     const SkPaint* paint) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawImageNine(image, center, dst, paint);
 }
 
 void DidDrawCanvas::onDrawImageLattice(const SkImage* image,
@@ -151,6 +124,7 @@ void DidDrawCanvas::onDrawImageLattice(const SkImage* image,
                                        const SkRect& dst,
                                        const SkPaint* paint) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawImageLattice(image, lattice, dst, paint);
 }
 
 void DidDrawCanvas::onDrawTextBlob(const SkTextBlob* blob,
@@ -158,23 +132,27 @@ void DidDrawCanvas::onDrawTextBlob(const SkTextBlob* blob,
                                    SkScalar y,
                                    const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawTextBlob(blob, x, y, paint);
 }
 
 void DidDrawCanvas::onDrawPicture(const SkPicture* picture,
                                   const SkMatrix* matrix,
                                   const SkPaint* paint) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawPicture(picture, matrix, paint);
 }
 
 void DidDrawCanvas::onDrawDrawable(SkDrawable* drawable,
                                    const SkMatrix* matrix) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawDrawable(drawable, matrix);
 }
 
 void DidDrawCanvas::onDrawVerticesObject(const SkVertices* vertices,
                                          SkBlendMode bmode,
                                          const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawVerticesObject(vertices, bmode, paint);
 }
 
 void DidDrawCanvas::onDrawPatch(const SkPoint cubics[12],
@@ -183,6 +161,7 @@ void DidDrawCanvas::onDrawPatch(const SkPoint cubics[12],
                                 SkBlendMode bmode,
                                 const SkPaint& paint) {
   MarkDrawIfNonTransparentPaint(paint);
+  SkNWayCanvas::onDrawPatch(cubics, colors, texCoords, bmode, paint);
 }
 
 void DidDrawCanvas::onDrawAtlas(const SkImage* image,
@@ -194,17 +173,21 @@ void DidDrawCanvas::onDrawAtlas(const SkImage* image,
                                 const SkRect* cull,
                                 const SkPaint* paint) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawAtlas(image, xform, tex, colors, count, bmode, cull,
+                            paint);
 }
 
 void DidDrawCanvas::onDrawShadowRec(const SkPath& path,
                                     const SkDrawShadowRec& rec) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawShadowRec(path, rec);
 }
 
 void DidDrawCanvas::onDrawAnnotation(const SkRect& rect,
                                      const char key[],
                                      SkData* data) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawAnnotation(rect, key, data);
 }
 
 void DidDrawCanvas::onDrawEdgeAAQuad(const SkRect& rect,
@@ -213,6 +196,7 @@ void DidDrawCanvas::onDrawEdgeAAQuad(const SkRect& rect,
                                      const SkColor4f& color,
                                      SkBlendMode mode) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawEdgeAAQuad(rect, clip, aa, color, mode);
 }
 
 void DidDrawCanvas::onDrawEdgeAAImageSet(const ImageSetEntry set[],
@@ -222,8 +206,8 @@ void DidDrawCanvas::onDrawEdgeAAImageSet(const ImageSetEntry set[],
                                          const SkPaint* paint,
                                          SrcRectConstraint constraint) {
   did_draw_ = true;
+  SkNWayCanvas::onDrawEdgeAAImageSet(set, count, dstClips, preViewMatrices,
+                                     paint, constraint);
 }
 
-void DidDrawCanvas::onFlush() {}
-
 }  // namespace flutter
@@ -5,9 +5,7 @@
 //
 #include "flutter/fml/macros.h"
 #include "third_party/skia/include/core/SkCanvas.h"
-#include "third_party/skia/include/core/SkCanvasVirtualEnforcer.h"
 #include "third_party/skia/include/utils/SkNWayCanvas.h"
-#include "third_party/skia/include/utils/SkNoDrawCanvas.h"
 
 #ifndef FLUTTER_SHELL_COMMON_CANVAS_SPY_H_
 #define FLUTTER_SHELL_COMMON_CANVAS_SPY_H_
@@ -42,13 +40,20 @@ class CanvasSpy {
   SkCanvas* GetSpyingCanvas();
 
  private:
-  std::unique_ptr<SkNWayCanvas> n_way_canvas_;
   std::unique_ptr<DidDrawCanvas> did_draw_canvas_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(CanvasSpy);
 };
 
-class DidDrawCanvas final : public SkCanvasVirtualEnforcer<SkNoDrawCanvas> {
+//------------------------------------------------------------------------------
+/// An |SkNWayCanvas| with the target canvas as its single child that notes
+/// whether a draw command was issued before forwarding it. Because the dirty
+/// flag is maintained by the overridden draw methods themselves, each
+/// operation is dispatched to the target exactly once; there is no second
+/// fan-out to a dedicated spy canvas doubling the virtual call overhead of
+/// recording. Non-draw operations (saves, clips and matrix changes) take the
+/// inherited forwarding path and never mark the canvas as drawn into.
+class DidDrawCanvas final : public SkNWayCanvas {
  public:
   DidDrawCanvas(int width, int height);
   ~DidDrawCanvas() override;
@@ -57,107 +62,89 @@ class DidDrawCanvas final : public SkCanvasVirtualEnforcer<SkNoDrawCanvas> {
  private:
   bool did_draw_ = false;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void willSave() override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  SaveLayerStrategy getSaveLayerStrategy(const SaveLayerRec&) override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  bool onDoSaveBehind(const SkRect*) override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void willRestore() override;
+  void MarkDrawIfNonTransparentPaint(const SkPaint& paint);
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void didConcat(const SkMatrix&) override;
-  void didConcat44(const SkM44&) override;
-  void didScale(SkScalar, SkScalar) override;
-  void didTranslate(SkScalar, SkScalar) override;
+  // |SkNWayCanvas|
+  void onDrawDRRect(const SkRRect&, const SkRRect&, const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void didSetMatrix(const SkMatrix&) override;
+  // |SkNWayCanvas|
+  void onDrawTextBlob(const SkTextBlob* blob,
+                      SkScalar x,
+                      SkScalar y,
+                      const SkPaint& paint) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void onDrawDRRect(const SkRRect&, const SkRRect&, const SkPaint&) override;
+  // |SkNWayCanvas|
+  void onDrawPatch(const SkPoint cubics[12],
+                   const SkColor colors[4],
+                   const SkPoint texCoords[4],
+                   SkBlendMode,
+                   const SkPaint& paint) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  virtual void onDrawTextBlob(const SkTextBlob* blob,
-                              SkScalar x,
-                              SkScalar y,
-                              const SkPaint& paint) override;
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  virtual void onDrawPatch(const SkPoint cubics[12],
-                           const SkColor colors[4],
-                           const SkPoint texCoords[4],
-                           SkBlendMode,
-                           const SkPaint& paint) override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawPaint(const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawBehind(const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawPoints(PointMode,
                     size_t count,
                     const SkPoint pts[],
                     const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawRect(const SkRect&, const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawRegion(const SkRegion&, const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawOval(const SkRect&, const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawArc(const SkRect&,
                  SkScalar,
                  SkScalar,
                  bool,
                  const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawRRect(const SkRRect&, const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawPath(const SkPath&, const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawImage(const SkImage*,
                    SkScalar left,
                    SkScalar top,
                    const SkPaint*) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawImageRect(const SkImage*,
                        const SkRect* src,
                        const SkRect& dst,
                        const SkPaint*,
                        SrcRectConstraint) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void onDrawImageLattice(const SkImage*,
-                          const Lattice&,
-                          const SkRect&,
-                          const SkPaint*) override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawImageNine(const SkImage*,
                        const SkIRect& center,
                        const SkRect& dst,
                        const SkPaint*) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
+  void onDrawImageLattice(const SkImage*,
+                          const Lattice&,
+                          const SkRect&,
+                          const SkPaint*) override;
+
+  // |SkNWayCanvas|
   void onDrawVerticesObject(const SkVertices*,
                             SkBlendMode,
                             const SkPaint&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawAtlas(const SkImage*,
                    const SkRSXform[],
                    const SkRect[],
@@ -167,40 +154,28 @@ class DidDrawCanvas final : public SkCanvasVirtualEnforcer<SkNoDrawCanvas> {
                    const SkRect*,
                    const SkPaint*) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawShadowRec(const SkPath&, const SkDrawShadowRec&) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void onClipRect(const SkRect&, SkClipOp, ClipEdgeStyle) override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void onClipRRect(const SkRRect&, SkClipOp, ClipEdgeStyle) override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void onClipPath(const SkPath&, SkClipOp, ClipEdgeStyle) override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void onClipRegion(const SkRegion&, SkClipOp) override;
-
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawPicture(const SkPicture*,
                      const SkMatrix*,
                      const SkPaint*) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawDrawable(SkDrawable*, const SkMatrix*) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawAnnotation(const SkRect&, const char[], SkData*) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawEdgeAAQuad(const SkRect&,
                         const SkPoint[4],
-                        SkCanvas::QuadAAFlags,
+                        QuadAAFlags,
                         const SkColor4f&,
                         SkBlendMode) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
+  // |SkNWayCanvas|
   void onDrawEdgeAAImageSet(const ImageSetEntry[],
                             int count,
                             const SkPoint[],
@@ -208,14 +183,9 @@ class DidDrawCanvas final : public SkCanvasVirtualEnforcer<SkNoDrawCanvas> {
                             const SkPaint*,
                             SrcRectConstraint) override;
 
-  // |SkCanvasVirtualEnforcer<SkNoDrawCanvas>|
-  void onFlush() override;
-
-  void MarkDrawIfNonTransparentPaint(const SkPaint& paint);
-
   FML_DISALLOW_COPY_AND_ASSIGN(DidDrawCanvas);
 };
 
 }  // namespace flutter
 
-#endif  // FLUTTER_SHELL_COMMON_SKIA_EVENT_TRACER_IMPL_H_
+#endif  // FLUTTER_SHELL_COMMON_CANVAS_SPY_H_
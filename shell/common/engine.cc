@@ -18,6 +18,7 @@
 #include "flutter/fml/unique_fd.h"
 #include "flutter/lib/snapshot/snapshot.h"
 #include "flutter/lib/ui/text/font_collection.h"
+#include "flutter/lib/ui/window/channel_interner.h"
 #include "flutter/shell/common/animator.h"
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/common/shell.h"
@@ -28,11 +29,9 @@
 
 namespace flutter {
 
-static constexpr char kAssetChannel[] = "flutter/assets";
-static constexpr char kLifecycleChannel[] = "flutter/lifecycle";
-static constexpr char kNavigationChannel[] = "flutter/navigation";
-static constexpr char kLocalizationChannel[] = "flutter/localization";
-static constexpr char kSettingsChannel[] = "flutter/settings";
+// Inbound messages on the engine's own channels are routed by the interned
+// channel ids in |ChannelInterner|; only channels the engine sends on still
+// need their names here.
 static constexpr char kIsolateChannel[] = "flutter/isolate";
 
 Engine::Engine(Delegate& delegate,
@@ -77,7 +76,12 @@ Engine::Engine(Delegate& delegate,
       settings_.persistent_isolate_data      // persistent isolate data
   );
 
-  pointer_data_dispatcher_ = dispatcher_maker(*this);
+  if (settings_.pointer_resampling_offset_us > 0) {
+    pointer_data_dispatcher_ = std::make_unique<ResamplingPointerDataDispatcher>(
+        *this, settings_.pointer_resampling_offset_us);
+  } else {
+    pointer_data_dispatcher_ = dispatcher_maker(*this);
+  }
 }
 
 Engine::~Engine() = default;
@@ -109,6 +113,7 @@ bool Engine::UpdateAssetManager(
 
   // Using libTXT as the text engine.
   font_collection_.RegisterFonts(asset_manager_);
+  font_collection_.StartPreloadingTypefaces(task_runners_.GetIOTaskRunner());
 
   if (settings_.use_test_fonts) {
     font_collection_.RegisterTestFonts();
@@ -124,8 +129,24 @@ bool Engine::Restart(RunConfiguration configuration) {
     return false;
   }
   delegate_.OnPreEngineRestart();
-  runtime_controller_ = runtime_controller_->Clone();
-  UpdateAssetManager(nullptr);
+  if (prewarmed_runtime_controller_) {
+    // Bind the runtime controller that was cloned during an earlier idle
+    // period instead of paying for isolate creation now. Window state that
+    // accumulated since the clone was made must be replayed onto it first.
+    if (!prewarmed_runtime_controller_->InheritWindowData(
+            *runtime_controller_)) {
+      FML_DLOG(ERROR) << "Could not setup initial isolate state.";
+    }
+    runtime_controller_ = std::move(prewarmed_runtime_controller_);
+  } else {
+    runtime_controller_ = runtime_controller_->Clone();
+  }
+  // Only Dart state was invalidated above. The asset manager (with its
+  // resolvers and the font collection built from them) stays in place until
+  // |PrepareAndLaunchIsolate| installs the incoming configuration's manager;
+  // |UpdateAssetManager| then reuses the parsed fonts when the manifest is
+  // unchanged. Decoded images on the IO manager and the persistent shader
+  // cache are never tied to the isolate and stay warm as well.
   return Run(std::move(configuration)) == Engine::RunStatus::Success;
 }
 
@@ -235,10 +256,41 @@ void Engine::ReportTimings(std::vector<int64_t> timings) {
 }
 
 void Engine::NotifyIdle(int64_t deadline) {
-  auto trace_event = std::to_string(deadline - Dart_TimelineGetMicros());
+  // During an active gesture the dispatcher holds undelivered pointer work
+  // and the next event is at most a frame away; a collection started now
+  // would pause right in the middle of a fling. Skip the notification and
+  // let the VM fall back to its allocation-driven heuristics.
+  if (pointer_data_dispatcher_ &&
+      pointer_data_dispatcher_->HasPendingPointerWork()) {
+    TRACE_EVENT0("flutter", "Engine::NotifyIdle - gesture active");
+    return;
+  }
+
+  const int64_t now = Dart_TimelineGetMicros();
+
+  // While frames are still in flight to the rasterizer, a pipeline slot can
+  // free at any vsync and re-engage this thread earlier than the wall-clock
+  // deadline suggests. Hand the VM only half the window so a sweep never
+  // straddles that wakeup.
+  if (animator_ && animator_->GetPipelineInflightDepth() > 0) {
+    deadline = now + (deadline - now) / 2;
+  }
+
+  auto idle_time = deadline - now;
+  auto trace_event = std::to_string(idle_time);
   TRACE_EVENT1("flutter", "Engine::NotifyIdle", "deadline_now_delta",
                trace_event.c_str());
   runtime_controller_->NotifyIdle(deadline);
+
+  // Isolate creation takes multiple milliseconds. Only attempt it in the
+  // large idle periods handed out when no frames are scheduled so it cannot
+  // eat into the budget of an upcoming frame.
+  constexpr int64_t kPrewarmRootIsolateHeadroomMicros = 50 * 1000;
+  if (settings_.prewarm_root_isolate && !prewarmed_runtime_controller_ &&
+      idle_time >= kPrewarmRootIsolateHeadroomMicros) {
+    TRACE_EVENT0("flutter", "Engine::PrewarmRootIsolate");
+    prewarmed_runtime_controller_ = runtime_controller_->Clone();
+  }
 }
 
 std::pair<bool, uint32_t> Engine::GetUIIsolateReturnCode() {
@@ -288,24 +340,44 @@ void Engine::SetViewportMetrics(const ViewportMetrics& metrics) {
 }
 
 void Engine::DispatchPlatformMessage(fml::RefPtr<PlatformMessage> message) {
-  if (message->channel() == kLifecycleChannel) {
-    if (HandleLifecyclePlatformMessage(message.get()))
-      return;
-  } else if (message->channel() == kLocalizationChannel) {
-    if (HandleLocalizationPlatformMessage(message.get()))
+  if (!message->hasData()) {
+    // The handlers below parse the payload; nothing to do for them without
+    // one. Let the framework decide what an empty message on its channel
+    // means.
+    if (runtime_controller_->IsRootIsolateRunning() &&
+        runtime_controller_->DispatchPlatformMessage(std::move(message))) {
       return;
-  } else if (message->channel() == kSettingsChannel) {
-    HandleSettingsPlatformMessage(message.get());
+    }
+    FML_DLOG(WARNING) << "Dropping platform message on channel: "
+                      << message->channel();
     return;
   }
 
+  // The channel id is interned once at message construction; switching on it
+  // here avoids re-comparing channel strings for every message.
+  switch (message->channel_id()) {
+    case ChannelInterner::kLifecycleChannelId:
+      if (HandleLifecyclePlatformMessage(message.get()))
+        return;
+      break;
+    case ChannelInterner::kLocalizationChannelId:
+      if (HandleLocalizationPlatformMessage(message.get()))
+        return;
+      break;
+    case ChannelInterner::kSettingsChannelId:
+      HandleSettingsPlatformMessage(message.get());
+      return;
+    default:
+      break;
+  }
+
   if (runtime_controller_->IsRootIsolateRunning() &&
       runtime_controller_->DispatchPlatformMessage(std::move(message))) {
     return;
   }
 
   // If there's no runtime_, we may still need to set the initial route.
-  if (message->channel() == kNavigationChannel) {
+  if (message->channel_id() == ChannelInterner::kNavigationChannelId) {
     HandleNavigationPlatformMessage(std::move(message));
     return;
   }
@@ -316,7 +388,8 @@ void Engine::DispatchPlatformMessage(fml::RefPtr<PlatformMessage> message) {
 
 bool Engine::HandleLifecyclePlatformMessage(PlatformMessage* message) {
   const auto& data = message->data();
-  std::string state(reinterpret_cast<const char*>(data.data()), data.size());
+  std::string state(reinterpret_cast<const char*>(data.GetMapping()),
+                    data.GetSize());
   if (state == "AppLifecycleState.paused" ||
       state == "AppLifecycleState.detached") {
     activity_running_ = false;
@@ -343,7 +416,8 @@ bool Engine::HandleNavigationPlatformMessage(
   const auto& data = message->data();
 
   rapidjson::Document document;
-  document.Parse(reinterpret_cast<const char*>(data.data()), data.size());
+  document.Parse(reinterpret_cast<const char*>(data.GetMapping()),
+                 data.GetSize());
   if (document.HasParseError() || !document.IsObject())
     return false;
   auto root = document.GetObject();
@@ -359,7 +433,8 @@ bool Engine::HandleLocalizationPlatformMessage(PlatformMessage* message) {
   const auto& data = message->data();
 
   rapidjson::Document document;
-  document.Parse(reinterpret_cast<const char*>(data.data()), data.size());
+  document.Parse(reinterpret_cast<const char*>(data.GetMapping()),
+                 data.GetSize());
   if (document.HasParseError() || !document.IsObject())
     return false;
   auto root = document.GetObject();
@@ -412,7 +487,8 @@ bool Engine::HandleLocalizationPlatformMessage(PlatformMessage* message) {
 
 void Engine::HandleSettingsPlatformMessage(PlatformMessage* message) {
   const auto& data = message->data();
-  std::string jsonData(reinterpret_cast<const char*>(data.data()), data.size());
+  std::string jsonData(reinterpret_cast<const char*>(data.GetMapping()),
+                       data.GetSize());
   if (runtime_controller_->SetUserSettingsData(std::move(jsonData)) &&
       have_surface_) {
     ScheduleFrame();
@@ -461,6 +537,18 @@ void Engine::ScheduleFrame(bool regenerate_layer_tree) {
   animator_->RequestFrame(regenerate_layer_tree);
 }
 
+void Engine::RecordFrameRasterDuration(fml::TimeDelta raster_duration) {
+  animator_->RecordFrameRasterDuration(raster_duration);
+}
+
+void Engine::RecordFramePresentationDelay(fml::TimeDelta presentation_delay) {
+  animator_->RecordFramePresentationDelay(presentation_delay);
+}
+
+void Engine::SetFrameCadenceOverride(uint32_t divisor) {
+  animator_->SetFrameCadenceOverride(divisor);
+}
+
 void Engine::Render(std::unique_ptr<flutter::LayerTree> layer_tree) {
   if (!layer_tree)
     return;
@@ -480,13 +568,18 @@ void Engine::UpdateSemantics(SemanticsNodeUpdates update,
 }
 
 void Engine::HandlePlatformMessage(fml::RefPtr<PlatformMessage> message) {
-  if (message->channel() == kAssetChannel) {
+  if (message->channel_id() == ChannelInterner::kAssetChannelId) {
     HandleAssetPlatformMessage(std::move(message));
   } else {
     delegate_.OnEngineHandlePlatformMessage(std::move(message));
   }
 }
 
+void Engine::RegisterBackgroundPlatformChannel(const std::string& name,
+                                               Dart_Port port) {
+  delegate_.OnEngineRegisterBackgroundPlatformChannel(name, port);
+}
+
 void Engine::UpdateIsolateDescription(const std::string isolate_name,
                                       int64_t isolate_port) {
   delegate_.UpdateIsolateDescription(isolate_name, isolate_port);
@@ -517,9 +610,13 @@ void Engine::HandleAssetPlatformMessage(fml::RefPtr<PlatformMessage> message) {
   if (!response) {
     return;
   }
+  if (!message->hasData()) {
+    response->CompleteEmpty();
+    return;
+  }
   const auto& data = message->data();
-  std::string asset_name(reinterpret_cast<const char*>(data.data()),
-                         data.size());
+  std::string asset_name(reinterpret_cast<const char*>(data.GetMapping()),
+                         data.GetSize());
 
   if (asset_manager_) {
     std::unique_ptr<fml::Mapping> asset_mapping =
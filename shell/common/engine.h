@@ -173,6 +173,25 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
     virtual void OnEngineHandlePlatformMessage(
         fml::RefPtr<PlatformMessage> message) = 0;
 
+    //--------------------------------------------------------------------------
+    /// @brief      Notifies the shell that the application wants incoming
+    ///             platform messages on the named channel delivered to a
+    ///             native port instead of the root isolate. The shell consults
+    ///             these registrations on the platform task runner before
+    ///             forwarding a message to the UI task runner, so messages on
+    ///             registered channels (typically high-rate sensor feeds
+    ///             handled by a worker isolate) never contend with frame
+    ///             building. Registering `ILLEGAL_PORT` removes the channel's
+    ///             registration and restores delivery to the root isolate.
+    ///
+    /// @param[in]  name  The platform channel name.
+    /// @param[in]  port  The native port of the receiving isolate, or
+    ///                   `ILLEGAL_PORT` to unregister.
+    ///
+    virtual void OnEngineRegisterBackgroundPlatformChannel(
+        const std::string& name,
+        Dart_Port port) = 0;
+
     //--------------------------------------------------------------------------
     /// @brief      Notifies the delegate that the root isolate of the
     ///             application is about to be discarded and a new isolate with
@@ -465,6 +484,13 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   ///             collection, just gives the Dart VM more hints about opportune
   ///             moments to perform collections.
   ///
+  ///             The deadline is adjusted against the state of the rendering
+  ///             pipeline before it reaches the VM: the notification is
+  ///             skipped outright while a gesture has pointer work in
+  ///             flight, and the window is halved while frames are still
+  ///             owned by the rasterizer, since either can re-engage the UI
+  ///             thread before the wall-clock deadline.
+  ///
   //  TODO(chinmaygarde): This should just use fml::TimePoint instead of having
   //  to remember that the unit is microseconds (which is no used anywhere else
   //  in the engine).
@@ -499,10 +525,11 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   //  not obvious without some sleuthing. The conversion can happen at the
   //  native interface boundary instead.
   ///
-  /// @param[in]  timings  Collection of `FrameTiming::kCount` * `n` timestamps
-  ///                      for `n` frames whose timings have not been reported
-  ///                      yet. A collection of integers is reported here for
-  ///                      easier conversions to Dart objects. The timestamps
+  /// @param[in]  timings  Collection of `FrameTiming::kStatisticsCount` * `n`
+  ///                      values for `n` frames whose timings have not been
+  ///                      reported yet. A collection of integers is reported
+  ///                      here for easier conversions to Dart objects. The
+  ///                      timestamps
   ///                      are measured against the system monotonic clock
   ///                      measured in microseconds.
   ///
@@ -710,6 +737,34 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   // |RuntimeDelegate|
   void ScheduleFrame(bool regenerate_layer_tree = true) override;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Feed the raster duration of the last rasterized frame into
+  ///             the animator's frame pacing governor. Must be called on the
+  ///             UI task runner.
+  ///
+  /// @param[in]  raster_duration  The wall time the frame spent rasterizing.
+  ///
+  void RecordFrameRasterDuration(fml::TimeDelta raster_duration);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Feed the submit-to-present latency observed for a recently
+  ///             presented frame into the animator's frame pacing governor.
+  ///             Must be called on the UI task runner.
+  ///
+  /// @param[in]  presentation_delay  The time between frame submission and
+  ///                                 the compositor presenting it.
+  ///
+  void RecordFramePresentationDelay(fml::TimeDelta presentation_delay);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Pin the frame cadence to the given vsync divisor, or hand
+  ///             control back to the frame pacing governor when the divisor
+  ///             is zero.
+  ///
+  /// @param[in]  divisor  The number of vsyncs per delivered frame.
+  ///
+  void SetFrameCadenceOverride(uint32_t divisor);
+
   // |RuntimeDelegate|
   FontCollection& GetFontCollection() override;
 
@@ -738,6 +793,11 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   std::unique_ptr<Animator> animator_;
   std::unique_ptr<RuntimeController> runtime_controller_;
 
+  // A clone of the runtime controller (with a warm root isolate) created
+  // ahead of time during idle periods. Bound as the active runtime controller
+  // on the next cold restart. See Settings::prewarm_root_isolate.
+  std::unique_ptr<RuntimeController> prewarmed_runtime_controller_;
+
   // The pointer_data_dispatcher_ depends on animator_ and runtime_controller_.
   // So it should be defined after them to ensure that pointer_data_dispatcher_
   // is destructed first.
@@ -768,6 +828,10 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   // |RuntimeDelegate|
   void HandlePlatformMessage(fml::RefPtr<PlatformMessage> message) override;
 
+  // |RuntimeDelegate|
+  void RegisterBackgroundPlatformChannel(const std::string& name,
+                                         Dart_Port port) override;
+
   // |RuntimeDelegate|
   void UpdateIsolateDescription(const std::string isolate_name,
                                 int64_t isolate_port) override;
@@ -138,3 +138,44 @@ void canDecompressImageFromAsset() {
 }
 
 List<int> getFixtureImage() native 'GetFixtureImage';
+
+@pragma('vm:entry-point')
+void replayApp() {
+  double scrollOffset = 0.0;
+
+  window.onPointerDataPacket = (PointerDataPacket packet) {
+    for (PointerData data in packet.data) {
+      if (data.change == PointerChange.move) {
+        scrollOffset += data.physicalDeltaY;
+      }
+    }
+    window.scheduleFrame();
+  };
+
+  window.onBeginFrame = (Duration beginTime) {
+    final Size size = window.physicalSize.isEmpty
+        ? const Size(800.0, 600.0)
+        : window.physicalSize;
+    final PictureRecorder recorder = PictureRecorder();
+    final Canvas canvas = Canvas(recorder);
+    final Paint paint = Paint();
+    // A column of colored rows offset by the accumulated pointer deltas,
+    // standing in for a scrolling list.
+    const double rowHeight = 48.0;
+    final int rows = size.height ~/ rowHeight + 2;
+    for (int i = 0; i < rows; i++) {
+      paint.color = Color(0xFF000000 | ((i * 0x1B4A7F) & 0x00FFFFFF));
+      final double top = i * rowHeight - (scrollOffset % rowHeight);
+      canvas.drawRect(
+          Rect.fromLTWH(0.0, top, size.width, rowHeight - 8.0), paint);
+    }
+    final Picture picture = recorder.endRecording();
+    final SceneBuilder builder = SceneBuilder();
+    builder.addPicture(Offset.zero, picture);
+    window.render(builder.build());
+    // Lets the replay harness pace itself; see shell_replay_benchmarks.cc.
+    window.sendPlatformMessage('replay/frame', null, null);
+  };
+
+  window.scheduleFrame();
+}
@@ -0,0 +1,164 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_statistics.h"
+
+#include <cstring>
+
+namespace flutter {
+
+namespace {
+
+constexpr char kExportMagic[4] = {'F', 'F', 'S', '1'};
+constexpr uint32_t kExportVersion = 1;
+
+struct ExportHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t reserved;
+  uint64_t total_frame_count;
+  uint64_t record_count;
+};
+
+static_assert(sizeof(ExportHeader) == 32, "Export header must be packed.");
+
+const char* JankCauseName(FrameStatistics::JankCause cause) {
+  switch (cause) {
+    case FrameStatistics::JankCause::kNone:
+      return "none";
+    case FrameStatistics::JankCause::kUiBound:
+      return "uiBound";
+    case FrameStatistics::JankCause::kRasterBound:
+      return "rasterBound";
+    case FrameStatistics::JankCause::kBigPictureUpload:
+      return "bigPictureUpload";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+FrameStatistics::FrameStatistics()
+    : frame_budget_(fml::TimeDelta::FromSecondsF(1.0 / 60.0)) {
+  records_.reserve(kMaxRecords);
+}
+
+FrameStatistics::~FrameStatistics() = default;
+
+void FrameStatistics::SetFrameBudget(fml::TimeDelta frame_budget) {
+  if (frame_budget <= fml::TimeDelta::Zero()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  frame_budget_ = frame_budget;
+}
+
+FrameStatistics::JankCause FrameStatistics::ClassifyLocked(
+    const FrameRecord& record) const {
+  const int64_t budget_micros = frame_budget_.ToMicroseconds();
+  if (record.build_duration_micros + record.raster_duration_micros <=
+      budget_micros) {
+    return JankCause::kNone;
+  }
+  if (record.build_duration_micros >= record.raster_duration_micros) {
+    return JankCause::kUiBound;
+  }
+  // Raster overran. When the backend measured the GPU and it accounts for
+  // the bulk of the raster time, the frame was waiting on uploads and
+  // command buffer execution rather than CPU-side recording.
+  if (record.gpu_duration_micros >= 0 &&
+      record.gpu_duration_micros * 2 >= record.raster_duration_micros) {
+    return JankCause::kBigPictureUpload;
+  }
+  return JankCause::kRasterBound;
+}
+
+void FrameStatistics::RecordFrame(const FrameTiming& timing,
+                                  size_t raster_cache_entry_count) {
+  FrameRecord record = {};
+  record.build_start_micros =
+      timing.Get(FrameTiming::kBuildStart).ToEpochDelta().ToMicroseconds();
+  record.build_duration_micros = (timing.Get(FrameTiming::kBuildFinish) -
+                                  timing.Get(FrameTiming::kBuildStart))
+                                     .ToMicroseconds();
+  record.raster_start_micros =
+      timing.Get(FrameTiming::kRasterStart).ToEpochDelta().ToMicroseconds();
+  record.raster_duration_micros = (timing.Get(FrameTiming::kRasterFinish) -
+                                   timing.Get(FrameTiming::kRasterStart))
+                                      .ToMicroseconds();
+  record.gpu_duration_micros = timing.GetGpuDuration().ToMicroseconds();
+  record.present_delay_micros = timing.GetPresentationDelay().ToMicroseconds();
+  record.raster_cache_entry_count =
+      static_cast<int64_t>(raster_cache_entry_count);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  record.jank_cause = static_cast<int32_t>(ClassifyLocked(record));
+
+  if (records_.size() < kMaxRecords) {
+    records_.push_back(record);
+  } else {
+    records_[next_record_] = record;
+    next_record_ = (next_record_ + 1) % kMaxRecords;
+  }
+  total_frame_count_++;
+  jank_cause_counts_[record.jank_cause]++;
+}
+
+void FrameStatistics::WriteToJson(rapidjson::Document& response) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& allocator = response.GetAllocator();
+
+  response.AddMember("frameBudgetMicros", frame_budget_.ToMicroseconds(),
+                     allocator);
+  response.AddMember("totalFrames", total_frame_count_, allocator);
+  response.AddMember("retainedFrames",
+                     static_cast<uint64_t>(records_.size()), allocator);
+
+  rapidjson::Value causes(rapidjson::kObjectType);
+  for (size_t i = 0; i < 4; i++) {
+    rapidjson::Value name(JankCauseName(static_cast<JankCause>(i)), allocator);
+    causes.AddMember(name, jank_cause_counts_[i], allocator);
+  }
+  response.AddMember("jankCauseCounts", causes, allocator);
+}
+
+std::unique_ptr<fml::Mapping> FrameStatistics::ExportBinary() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::vector<uint8_t> buffer(
+      sizeof(ExportHeader) + records_.size() * sizeof(FrameRecord), 0u);
+
+  ExportHeader header = {};
+  std::memcpy(header.magic, kExportMagic, sizeof(kExportMagic));
+  header.version = kExportVersion;
+  header.record_size = sizeof(FrameRecord);
+  header.total_frame_count = total_frame_count_;
+  header.record_count = records_.size();
+  std::memcpy(buffer.data(), &header, sizeof(header));
+
+  // Unroll the ring oldest first. Until the ring wraps, next_record_ is zero
+  // and the records are already in order.
+  uint8_t* cursor = buffer.data() + sizeof(ExportHeader);
+  for (size_t i = 0; i < records_.size(); i++) {
+    const size_t index = (next_record_ + i) % records_.size();
+    std::memcpy(cursor, &records_[index], sizeof(FrameRecord));
+    cursor += sizeof(FrameRecord);
+  }
+
+  return std::make_unique<fml::DataMapping>(std::move(buffer));
+}
+
+std::vector<FrameStatistics::FrameRecord> FrameStatistics::GetRecords() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<FrameRecord> records;
+  records.reserve(records_.size());
+  // Unroll the ring oldest first, as in |ExportBinary|.
+  for (size_t i = 0; i < records_.size(); i++) {
+    records.push_back(records_[(next_record_ + i) % records_.size()]);
+  }
+  return records;
+}
+
+}  // namespace flutter
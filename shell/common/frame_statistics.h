@@ -0,0 +1,132 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_FRAME_STATISTICS_H_
+#define FLUTTER_SHELL_COMMON_FRAME_STATISTICS_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/common/settings.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/time/time_delta.h"
+#include "rapidjson/document.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// A persistent record of per-frame timing statistics with automatic jank
+/// attribution. The stopwatch laps the compositor context keeps only feed the
+/// on-screen performance overlay and are overwritten every few frames; this
+/// subsystem retains a bounded ring of fixed-width frame records so janky
+/// sessions can be inspected after the fact, either over the service protocol
+/// or as a binary blob uploaded from the field.
+///
+/// The shell owns one instance, records a frame from the raster task runner
+/// whenever one is rasterized, and serves queries from the service protocol.
+/// All entry points are thread safe.
+///
+class FrameStatistics {
+ public:
+  /// Why a frame missed its budget. Values are stable: they are serialized
+  /// into the binary export and interpreted by offline tooling.
+  enum class JankCause : int32_t {
+    /// The frame fit its budget.
+    kNone = 0,
+    /// Building the layer tree on the UI thread dominated the overrun.
+    kUiBound = 1,
+    /// Rasterization dominated the overrun.
+    kRasterBound = 2,
+    /// Rasterization overran and the measured GPU time dominated it,
+    /// indicating oversized picture uploads or command buffers rather than
+    /// expensive recording on the CPU.
+    kBigPictureUpload = 3,
+  };
+
+  /// One frame in the ring and in the binary export. Fixed width, padded to
+  /// an 8 byte multiple, and written out exactly as laid out here.
+  struct FrameRecord {
+    int64_t build_start_micros;
+    int64_t build_duration_micros;
+    int64_t raster_start_micros;
+    int64_t raster_duration_micros;
+    /// Negative when the rendering backend could not measure it.
+    int64_t gpu_duration_micros;
+    /// Negative when the rendering backend could not observe presentation.
+    int64_t present_delay_micros;
+    int64_t raster_cache_entry_count;
+    int32_t jank_cause;
+    int32_t reserved;
+  };
+
+  static_assert(sizeof(FrameRecord) == 64, "Frame records must be packed.");
+
+  /// The number of frames retained; older frames only contribute to the
+  /// aggregate jank counters. 512 records is about eight seconds of frames
+  /// at 60Hz in 32KB.
+  static constexpr size_t kMaxRecords = 512;
+
+  FrameStatistics();
+
+  ~FrameStatistics();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Sets the per-frame budget used to classify overruns. Frames
+  ///             recorded before the display refresh rate is known are
+  ///             classified against a 60Hz budget.
+  ///
+  void SetFrameBudget(fml::TimeDelta frame_budget);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Records one rasterized frame and classifies it.
+  ///
+  /// @param[in]  timing                    The timing of the frame.
+  /// @param[in]  raster_cache_entry_count  The number of raster cache entries
+  ///                                       alive after the frame.
+  ///
+  void RecordFrame(const FrameTiming& timing, size_t raster_cache_entry_count);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Writes the aggregate counters and the retained records into
+  ///             the given service protocol response.
+  ///
+  void WriteToJson(rapidjson::Document& response) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Serializes the retained records behind a small header into
+  ///             a blob suitable for field upload. The layout is the "FFS1"
+  ///             magic, a uint32_t version, a uint32_t record size, a
+  ///             uint64_t total frame count, a uint64_t record count and the
+  ///             records, oldest first.
+  ///
+  std::unique_ptr<fml::Mapping> ExportBinary() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Copies the retained records, oldest first. Used by in-process
+  ///             consumers such as the replay benchmark harness; field
+  ///             tooling should prefer |ExportBinary|.
+  ///
+  std::vector<FrameRecord> GetRecords() const;
+
+ private:
+  JankCause ClassifyLocked(const FrameRecord& record) const;
+
+  mutable std::mutex mutex_;
+  fml::TimeDelta frame_budget_;
+  // Ring of the most recent kMaxRecords frames; next_record_ is the slot the
+  // next frame lands in once the ring has wrapped.
+  std::vector<FrameRecord> records_;
+  size_t next_record_ = 0;
+  uint64_t total_frame_count_ = 0;
+  uint64_t jank_cause_counts_[4] = {};
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FrameStatistics);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_FRAME_STATISTICS_H_
@@ -0,0 +1,103 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/frame_statistics.h"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+static FrameTiming MakeTiming(int64_t build_micros,
+                              int64_t raster_micros,
+                              int64_t gpu_micros = -1) {
+  FrameTiming timing;
+  auto at = [](int64_t micros) {
+    return fml::TimePoint::FromEpochDelta(
+        fml::TimeDelta::FromMicroseconds(micros));
+  };
+  timing.Set(FrameTiming::kBuildStart, at(1000));
+  timing.Set(FrameTiming::kBuildFinish, at(1000 + build_micros));
+  timing.Set(FrameTiming::kRasterStart, at(2000 + build_micros));
+  timing.Set(FrameTiming::kRasterFinish, at(2000 + build_micros +
+                                            raster_micros));
+  timing.SetGpuDuration(fml::TimeDelta::FromMicroseconds(gpu_micros));
+  return timing;
+}
+
+TEST(FrameStatisticsTest, ClassifiesJankCauses) {
+  FrameStatistics statistics;
+  statistics.SetFrameBudget(fml::TimeDelta::FromMicroseconds(16667));
+
+  // Within budget.
+  statistics.RecordFrame(MakeTiming(4000, 6000), 0u);
+  // Build dominates the overrun.
+  statistics.RecordFrame(MakeTiming(20000, 5000), 0u);
+  // Raster dominates; no GPU measurement.
+  statistics.RecordFrame(MakeTiming(2000, 25000), 0u);
+  // Raster dominates and the GPU accounts for the bulk of it.
+  statistics.RecordFrame(MakeTiming(2000, 25000, 20000), 0u);
+
+  rapidjson::Document document;
+  document.SetObject();
+  statistics.WriteToJson(document);
+
+  EXPECT_EQ(document["totalFrames"].GetUint64(), 4u);
+  const auto& causes = document["jankCauseCounts"];
+  EXPECT_EQ(causes["none"].GetUint64(), 1u);
+  EXPECT_EQ(causes["uiBound"].GetUint64(), 1u);
+  EXPECT_EQ(causes["rasterBound"].GetUint64(), 1u);
+  EXPECT_EQ(causes["bigPictureUpload"].GetUint64(), 1u);
+}
+
+TEST(FrameStatisticsTest, ExportsRecordsBehindHeader) {
+  FrameStatistics statistics;
+  statistics.SetFrameBudget(fml::TimeDelta::FromMicroseconds(16667));
+  statistics.RecordFrame(MakeTiming(3000, 5000), 7u);
+  statistics.RecordFrame(MakeTiming(20000, 5000), 8u);
+
+  auto blob = statistics.ExportBinary();
+  ASSERT_NE(blob, nullptr);
+  ASSERT_EQ(blob->GetSize(),
+            32u + 2u * sizeof(FrameStatistics::FrameRecord));
+
+  const uint8_t* data = blob->GetMapping();
+  EXPECT_EQ(std::memcmp(data, "FFS1", 4u), 0);
+
+  uint64_t record_count = 0;
+  std::memcpy(&record_count, data + 24, sizeof(record_count));
+  EXPECT_EQ(record_count, 2u);
+
+  FrameStatistics::FrameRecord record;
+  std::memcpy(&record, data + 32 + sizeof(record), sizeof(record));
+  EXPECT_EQ(record.build_duration_micros, 20000);
+  EXPECT_EQ(record.raster_cache_entry_count, 8);
+  EXPECT_EQ(record.jank_cause,
+            static_cast<int32_t>(FrameStatistics::JankCause::kUiBound));
+}
+
+TEST(FrameStatisticsTest, RingRetainsOnlyTheMostRecentRecords) {
+  FrameStatistics statistics;
+  for (size_t i = 0; i < FrameStatistics::kMaxRecords + 3; i++) {
+    statistics.RecordFrame(MakeTiming(1000, 1000), i);
+  }
+
+  auto blob = statistics.ExportBinary();
+  ASSERT_NE(blob, nullptr);
+
+  uint64_t total_frame_count = 0;
+  std::memcpy(&total_frame_count, blob->GetMapping() + 16,
+              sizeof(total_frame_count));
+  EXPECT_EQ(total_frame_count, FrameStatistics::kMaxRecords + 3);
+
+  // The oldest retained record is the fourth frame ever recorded.
+  FrameStatistics::FrameRecord record;
+  std::memcpy(&record, blob->GetMapping() + 32, sizeof(record));
+  EXPECT_EQ(record.raster_cache_entry_count, 3);
+}
+
+}  // namespace testing
+}  // namespace flutter
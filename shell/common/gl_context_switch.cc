@@ -6,6 +6,13 @@
 
 namespace flutter {
 
+namespace {
+
+// The innermost batch scope alive on the current thread, if any.
+thread_local GLContextBatchScope* tls_active_batch_scope = nullptr;
+
+}  // namespace
+
 SwitchableGLContext::SwitchableGLContext() = default;
 
 SwitchableGLContext::~SwitchableGLContext() = default;
@@ -28,7 +35,36 @@ GLContextSwitch::GLContextSwitch(std::unique_ptr<SwitchableGLContext> context)
 };
 
 GLContextSwitch::~GLContextSwitch() {
+  if (GLContextBatchScope* batch = GLContextBatchScope::GetCurrentForThread()) {
+    batch->DeferRestore(std::move(context_));
+    return;
+  }
   context_->RemoveCurrent();
 };
 
+GLContextBatchScope::GLContextBatchScope() : outer_(tls_active_batch_scope) {
+  tls_active_batch_scope = this;
+}
+
+GLContextBatchScope::~GLContextBatchScope() {
+  tls_active_batch_scope = outer_;
+  if (deferred_restore_) {
+    deferred_restore_->RemoveCurrent();
+  }
+}
+
+GLContextBatchScope* GLContextBatchScope::GetCurrentForThread() {
+  return tls_active_batch_scope;
+}
+
+void GLContextBatchScope::DeferRestore(
+    std::unique_ptr<SwitchableGLContext> context) {
+  // Only the first switch in the batch knows the context that was current
+  // when the batch began; the later switches capture intermediate states
+  // that nothing outside the batch can observe.
+  if (deferred_restore_ == nullptr) {
+    deferred_restore_ = std::move(context);
+  }
+}
+
 }  // namespace flutter
@@ -88,6 +88,45 @@ class GLContextDefaultResult : public GLContextResult {
   FML_DISALLOW_COPY_AND_ASSIGN(GLContextDefaultResult);
 };
 
+//------------------------------------------------------------------------------
+/// Defers the context restorations of the |GLContextSwitch|es constructed on
+/// the current thread until the end of the scope.
+///
+/// Use this to wrap a batch of operations that each switch to the same
+/// context (for example, all the operations of one frame). Within the scope,
+/// destroying a |GLContextSwitch| does not restore the previous context, so
+/// consecutive switches find the context already current and the platform
+/// implementations can skip the redundant makeCurrent calls. The context
+/// that was current when the batch began is restored once when the scope
+/// ends.
+///
+/// The wrapped |SwitchableGLContext| of the first switch in the batch is
+/// kept alive until the scope ends, so the scope must not outlive the owner
+/// of the gl context either.
+class GLContextBatchScope {
+ public:
+  GLContextBatchScope();
+
+  ~GLContextBatchScope();
+
+ private:
+  friend class GLContextSwitch;
+
+  //----------------------------------------------------------------------------
+  /// Returns the innermost scope alive on the current thread, or nullptr.
+  static GLContextBatchScope* GetCurrentForThread();
+
+  //----------------------------------------------------------------------------
+  /// Takes over the context of a |GLContextSwitch| destroyed within this
+  /// scope so its restoration can be performed when the scope ends.
+  void DeferRestore(std::unique_ptr<SwitchableGLContext> context);
+
+  std::unique_ptr<SwitchableGLContext> deferred_restore_;
+  GLContextBatchScope* outer_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GLContextBatchScope);
+};
+
 //------------------------------------------------------------------------------
 /// Switches the gl context to the a context that is passed in the
 /// constructor.
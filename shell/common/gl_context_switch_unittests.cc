@@ -23,5 +23,46 @@ TEST_F(GLContextSwitchTest, SwitchKeepsContextCurrentWhileInScope) {
   ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), -1);
 }
 
+TEST_F(GLContextSwitchTest, BatchScopeDefersRestorationsUntilItEnds) {
+  {
+    GLContextBatchScope batch;
+    {
+      auto context_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(0));
+      ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 0);
+    }
+    // The context stays current after the switch is destroyed instead of
+    // being restored between the operations of the batch.
+    ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 0);
+    {
+      auto context_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(1));
+      ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 1);
+    }
+    ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 1);
+  }
+  // The first switch in the batch performs the single restoration.
+  ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), -1);
+}
+
+TEST_F(GLContextSwitchTest, NestedBatchScopeRestoresWhenItEnds) {
+  GLContextBatchScope outer_batch;
+  {
+    auto context_switch =
+        GLContextSwitch(std::make_unique<TestSwitchableGLContext>(0));
+  }
+  {
+    GLContextBatchScope inner_batch;
+    {
+      auto context_switch =
+          GLContextSwitch(std::make_unique<TestSwitchableGLContext>(1));
+    }
+    ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), 1);
+  }
+  // The inner batch restored its own deferred switch without disturbing the
+  // outer batch, which is still holding the first restoration.
+  ASSERT_EQ(TestSwitchableGLContext::GetCurrentContext(), -1);
+}
+
 }  // namespace testing
 }  // namespace flutter
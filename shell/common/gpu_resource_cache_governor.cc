@@ -0,0 +1,114 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/gpu_resource_cache_governor.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace flutter {
+
+// Recomputing shares on every frame of every engine would post a steady
+// stream of redundant budget updates; drifting once a second is plenty to
+// follow foreground changes.
+static const fml::TimeDelta kRebalanceInterval =
+    fml::TimeDelta::FromSeconds(1);
+
+GpuResourceCacheGovernor& GpuResourceCacheGovernor::GetForProcess() {
+  static GpuResourceCacheGovernor* governor = new GpuResourceCacheGovernor();
+  return *governor;
+}
+
+GpuResourceCacheGovernor::GpuResourceCacheGovernor() = default;
+
+GpuResourceCacheGovernor::~GpuResourceCacheGovernor() = default;
+
+void GpuResourceCacheGovernor::RegisterContext(
+    uintptr_t context_id,
+    fml::RefPtr<fml::TaskRunner> task_runner,
+    size_t standalone_budget_bytes,
+    BudgetSetter set_budget) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ContextRecord record;
+  record.task_runner = std::move(task_runner);
+  record.standalone_budget_bytes = standalone_budget_bytes;
+  record.set_budget = std::move(set_budget);
+  record.last_use = fml::TimePoint::Now();
+  contexts_[context_id] = std::move(record);
+  RebalanceLocked();
+}
+
+void GpuResourceCacheGovernor::UnregisterContext(uintptr_t context_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (contexts_.erase(context_id) == 0) {
+    return;
+  }
+  RebalanceLocked();
+}
+
+void GpuResourceCacheGovernor::RecordContextUse(uintptr_t context_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto found = contexts_.find(context_id);
+  if (found == contexts_.end()) {
+    return;
+  }
+  auto now = fml::TimePoint::Now();
+  found->second.last_use = now;
+  // A lone context always holds its standalone budget; there is nothing to
+  // drift until a second engine shows up.
+  if (contexts_.size() < 2 || now - last_rebalance_ < kRebalanceInterval) {
+    return;
+  }
+  RebalanceLocked();
+}
+
+void GpuResourceCacheGovernor::SetGlobalBudget(size_t budget_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  global_budget_bytes_ = budget_bytes;
+  RebalanceLocked();
+}
+
+void GpuResourceCacheGovernor::RebalanceLocked() {
+  last_rebalance_ = fml::TimePoint::Now();
+
+  if (contexts_.empty()) {
+    return;
+  }
+
+  if (contexts_.size() == 1) {
+    auto& record = contexts_.begin()->second;
+    size_t budget =
+        std::min(record.standalone_budget_bytes, global_budget_bytes_);
+    record.task_runner->PostTask(
+        [set_budget = record.set_budget, budget]() { set_budget(budget); });
+    return;
+  }
+
+  // Weight each context by how recently it rendered: a context in active use
+  // gets close to full weight while one that has been idle for n seconds
+  // decays as 1/(1+n). The weights only shift shares around; the sum of all
+  // granted budgets stays within the global budget (clamping a share up to
+  // the floor or down to a standalone budget leaves the slack unspent rather
+  // than redistributing it, which is not worth the extra pass).
+  double total_weight = 0.0;
+  for (const auto& entry : contexts_) {
+    double age_seconds =
+        (last_rebalance_ - entry.second.last_use).ToSecondsF();
+    total_weight += 1.0 / (1.0 + std::max(age_seconds, 0.0));
+  }
+
+  for (auto& entry : contexts_) {
+    auto& record = entry.second;
+    double age_seconds = (last_rebalance_ - record.last_use).ToSecondsF();
+    double weight = 1.0 / (1.0 + std::max(age_seconds, 0.0));
+    auto share = static_cast<size_t>(global_budget_bytes_ *
+                                     (weight / total_weight));
+    share = std::max(share, kMinContextBudgetBytes);
+    share = std::min(share, record.standalone_budget_bytes);
+    record.task_runner->PostTask(
+        [set_budget = record.set_budget, share]() { set_budget(share); });
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,121 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_GPU_RESOURCE_CACHE_GOVERNOR_H_
+#define FLUTTER_SHELL_COMMON_GPU_RESOURCE_CACHE_GOVERNOR_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// Coordinates the Skia resource cache budgets of every GrContext in the
+/// process. Each rasterizer sizes its cache as if it were the only engine
+/// running; in add-to-app deployments with several engines those budgets are
+/// additive and the combined GPU memory footprint grows with the engine
+/// count. The governor holds a single process-wide byte budget and splits it
+/// across the registered contexts, weighting each share by how recently that
+/// context rendered a frame so a backgrounded engine yields memory to the one
+/// the user is interacting with.
+///
+/// Rasterizers register their context when a surface is set up, record a use
+/// on every frame and unregister on teardown, so the budget is rebalanced
+/// across engine lifecycle changes without any explicit coordination between
+/// shells. A context that is alone in the process keeps the budget it would
+/// have chosen for itself.
+///
+/// All entry points are thread safe; budget updates are posted to the task
+/// runner the context was registered with.
+///
+class GpuResourceCacheGovernor {
+ public:
+  /// Applies a governed byte budget to a registered context. Always invoked
+  /// on the task runner the context was registered with.
+  using BudgetSetter = std::function<void(size_t budget_bytes)>;
+
+  /// The process-wide budget split across contexts when more than one is
+  /// registered. Twice the 24MB a single OpenGL surface budgets for itself,
+  /// so two foreground engines are not starved while four uncoordinated ones
+  /// can no longer quadruple the footprint.
+  static constexpr size_t kDefaultGlobalBudgetBytes = 48 * (1 << 20);
+
+  /// No context is governed below this share regardless of how stale it is;
+  /// evicting the last few scratch surfaces only causes churn on resume.
+  static constexpr size_t kMinContextBudgetBytes = 4 * (1 << 20);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The governor shared by all shells in the process.
+  ///
+  static GpuResourceCacheGovernor& GetForProcess();
+
+  GpuResourceCacheGovernor();
+
+  ~GpuResourceCacheGovernor();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Registers a context and rebalances the global budget. The
+  ///             standalone budget is the limit the context would use if it
+  ///             were the only one in the process; a governed share never
+  ///             exceeds it.
+  ///
+  /// @param[in]  context_id         Any value that uniquely identifies the
+  ///                                context until it is unregistered.
+  /// @param[in]  task_runner        The runner budget updates are posted to.
+  /// @param[in]  standalone_budget_bytes  The context's own preferred limit.
+  /// @param[in]  set_budget         Applies a governed budget to the context.
+  ///
+  void RegisterContext(uintptr_t context_id,
+                       fml::RefPtr<fml::TaskRunner> task_runner,
+                       size_t standalone_budget_bytes,
+                       BudgetSetter set_budget);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Unregisters a context and redistributes its share. No
+  ///             further budget updates are posted for the context. Safe to
+  ///             call with an identifier that was never registered.
+  ///
+  void UnregisterContext(uintptr_t context_id);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Notes that a context just rendered a frame. Cheap enough to
+  ///             call once per frame; shares drift toward the active context
+  ///             at a throttled cadence rather than on every call.
+  ///
+  void RecordContextUse(uintptr_t context_id);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Replaces the process-wide budget and rebalances. Embedders
+  ///             on memory constrained devices may lower it at startup.
+  ///
+  void SetGlobalBudget(size_t budget_bytes);
+
+ private:
+  struct ContextRecord {
+    fml::RefPtr<fml::TaskRunner> task_runner;
+    size_t standalone_budget_bytes = 0;
+    BudgetSetter set_budget;
+    fml::TimePoint last_use;
+  };
+
+  void RebalanceLocked();
+
+  std::mutex mutex_;
+  size_t global_budget_bytes_ = kDefaultGlobalBudgetBytes;
+  std::map<uintptr_t, ContextRecord> contexts_;
+  fml::TimePoint last_rebalance_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GpuResourceCacheGovernor);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_GPU_RESOURCE_CACHE_GOVERNOR_H_
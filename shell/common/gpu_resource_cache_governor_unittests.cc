@@ -0,0 +1,85 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/gpu_resource_cache_governor.h"
+
+#include "flutter/fml/message_loop.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+TEST(GpuResourceCacheGovernorTest, LoneContextKeepsItsStandaloneBudget) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  GpuResourceCacheGovernor governor;
+
+  size_t granted = 0;
+  governor.RegisterContext(
+      1u, fml::MessageLoop::GetCurrent().GetTaskRunner(), 24u << 20,
+      [&granted](size_t budget_bytes) { granted = budget_bytes; });
+  fml::MessageLoop::GetCurrent().RunExpiredTasksNow();
+
+  EXPECT_EQ(granted, 24u << 20);
+}
+
+TEST(GpuResourceCacheGovernorTest, TwoContextsShareTheGlobalBudget) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  GpuResourceCacheGovernor governor;
+
+  size_t granted_a = 0;
+  size_t granted_b = 0;
+  auto runner = fml::MessageLoop::GetCurrent().GetTaskRunner();
+  governor.RegisterContext(
+      1u, runner, 40u << 20,
+      [&granted_a](size_t budget_bytes) { granted_a = budget_bytes; });
+  governor.RegisterContext(
+      2u, runner, 40u << 20,
+      [&granted_b](size_t budget_bytes) { granted_b = budget_bytes; });
+  fml::MessageLoop::GetCurrent().RunExpiredTasksNow();
+
+  // Both contexts registered at the same instant, so each gets half of the
+  // global budget rather than the 40MB it would have claimed alone.
+  EXPECT_LT(granted_a, 40u << 20);
+  EXPECT_LT(granted_b, 40u << 20);
+  EXPECT_LE(granted_a + granted_b,
+            GpuResourceCacheGovernor::kDefaultGlobalBudgetBytes);
+  EXPECT_GE(granted_a, GpuResourceCacheGovernor::kMinContextBudgetBytes);
+  EXPECT_GE(granted_b, GpuResourceCacheGovernor::kMinContextBudgetBytes);
+}
+
+TEST(GpuResourceCacheGovernorTest, UnregisteringRestoresTheRemainingContext) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  GpuResourceCacheGovernor governor;
+
+  size_t granted = 0;
+  auto runner = fml::MessageLoop::GetCurrent().GetTaskRunner();
+  governor.RegisterContext(
+      1u, runner, 40u << 20,
+      [&granted](size_t budget_bytes) { granted = budget_bytes; });
+  governor.RegisterContext(2u, runner, 40u << 20, [](size_t budget_bytes) {});
+  fml::MessageLoop::GetCurrent().RunExpiredTasksNow();
+  ASSERT_LT(granted, 40u << 20);
+
+  governor.UnregisterContext(2u);
+  fml::MessageLoop::GetCurrent().RunExpiredTasksNow();
+
+  EXPECT_EQ(granted, 40u << 20);
+}
+
+TEST(GpuResourceCacheGovernorTest, LoweredGlobalBudgetCapsTheLoneContext) {
+  fml::MessageLoop::EnsureInitializedForCurrentThread();
+  GpuResourceCacheGovernor governor;
+
+  size_t granted = 0;
+  governor.RegisterContext(
+      1u, fml::MessageLoop::GetCurrent().GetTaskRunner(), 24u << 20,
+      [&granted](size_t budget_bytes) { granted = budget_bytes; });
+  governor.SetGlobalBudget(8u << 20);
+  fml::MessageLoop::GetCurrent().RunExpiredTasksNow();
+
+  EXPECT_EQ(granted, 8u << 20);
+}
+
+}  // namespace testing
+}  // namespace flutter
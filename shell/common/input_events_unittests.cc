@@ -412,5 +412,77 @@ TEST_F(ShellTest, CanCorrectlySynthesizePointerPacket) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
 }
 
+TEST_F(ShellTest, ResamplesAndCoalescesFastPointerPackets) {
+  // Sets up shell with test fixture.
+  auto settings = CreateSettingsForFixture();
+  settings.pointer_resampling_offset_us = 500;
+  std::unique_ptr<Shell> shell = CreateShell(settings, true);
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("onPointerDataPacketMain");
+  // Sets up native handler.
+  fml::AutoResetWaitableEvent reportLatch;
+  std::vector<int64_t> result_sequence;
+  auto nativeOnPointerDataPacket = [&reportLatch, &result_sequence](
+                                       Dart_NativeArguments args) {
+    Dart_Handle exception = nullptr;
+    result_sequence = tonic::DartConverter<std::vector<int64_t>>::FromArguments(
+        args, 0, exception);
+    reportLatch.Signal();
+  };
+  // Starts engine.
+  AddNativeCallback("NativeOnPointerDataPacket",
+                    CREATE_NATIVE_ENTRY(nativeOnPointerDataPacket));
+  ASSERT_TRUE(configuration.IsValid());
+  RunEngine(shell.get(), std::move(configuration));
+
+  // Packets carrying phase changes pass through without waiting for a vsync.
+  auto packet = std::make_unique<PointerDataPacket>(2);
+  PointerData data;
+  CreateSimulatedPointerData(data, PointerData::Change::kAdd, 0.0, 0.0);
+  packet->SetPointerData(0, data);
+  CreateSimulatedPointerData(data, PointerData::Change::kDown, 0.0, 0.0);
+  packet->SetPointerData(1, data);
+  ShellTest::DispatchPointerData(shell.get(), std::move(packet));
+  reportLatch.Wait();
+  ASSERT_EQ(result_sequence.size(), 2u);
+  ASSERT_EQ(PointerData::Change(result_sequence[0]), PointerData::Change::kAdd);
+  ASSERT_EQ(PointerData::Change(result_sequence[1]),
+            PointerData::Change::kDown);
+
+  // Two move packets within one frame coalesce into a single resampled move.
+  packet = std::make_unique<PointerDataPacket>(1);
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 10.0, 0.0);
+  data.time_stamp = 1000;
+  packet->SetPointerData(0, data);
+  ShellTest::DispatchPointerData(shell.get(), std::move(packet));
+
+  packet = std::make_unique<PointerDataPacket>(1);
+  CreateSimulatedPointerData(data, PointerData::Change::kMove, 20.0, 0.0);
+  data.time_stamp = 2000;
+  packet->SetPointerData(0, data);
+  ShellTest::DispatchPointerData(shell.get(), std::move(packet));
+
+  bool will_draw_new_frame;
+  ShellTest::VSyncFlush(shell.get(), will_draw_new_frame);
+  reportLatch.Wait();
+  ASSERT_EQ(result_sequence.size(), 1u);
+  ASSERT_EQ(PointerData::Change(result_sequence[0]),
+            PointerData::Change::kMove);
+
+  // The newest sample is retained as the next interpolation partner and is
+  // flushed once the input stream goes quiet.
+  ShellTest::VSyncFlush(shell.get(), will_draw_new_frame);
+  reportLatch.Wait();
+  ASSERT_EQ(result_sequence.size(), 1u);
+  ASSERT_EQ(PointerData::Change(result_sequence[0]),
+            PointerData::Change::kMove);
+
+  // Cleans up shell.
+  ASSERT_TRUE(DartVMRef::IsInstanceRunning());
+  DestroyShell(std::move(shell));
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+}
+
 }  // namespace testing
 }  // namespace flutter
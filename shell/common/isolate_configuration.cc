@@ -4,6 +4,8 @@
 
 #include "flutter/shell/common/isolate_configuration.h"
 
+#include <mutex>
+
 #include "flutter/fml/make_copyable.h"
 #include "flutter/runtime/dart_vm.h"
 
@@ -46,11 +48,13 @@ class KernelIsolateConfiguration : public IsolateConfiguration {
     if (DartVM::IsRunningPrecompiledCode()) {
       return false;
     }
-    return isolate.PrepareForRunningFromKernel(std::move(kernel_));
+    // The mapping is shared (not moved) so this configuration can prepare any
+    // number of isolates from the same loaded kernel.
+    return isolate.PrepareForRunningFromKernel(kernel_);
   }
 
  private:
-  std::unique_ptr<const fml::Mapping> kernel_;
+  std::shared_ptr<const fml::Mapping> kernel_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(KernelIsolateConfiguration);
 };
@@ -68,10 +72,12 @@ class KernelListIsolateConfiguration final : public IsolateConfiguration {
       return false;
     }
 
-    for (size_t i = 0; i < kernel_pieces_.size(); i++) {
-      bool last_piece = i + 1 == kernel_pieces_.size();
+    ResolveKernelPiecesIfNecessary();
+
+    for (size_t i = 0; i < resolved_kernel_pieces_.size(); i++) {
+      bool last_piece = i + 1 == resolved_kernel_pieces_.size();
 
-      if (!isolate.PrepareForRunningFromKernel(kernel_pieces_[i].get(),
+      if (!isolate.PrepareForRunningFromKernel(resolved_kernel_pieces_[i],
                                                last_piece)) {
         return false;
       }
@@ -81,11 +87,51 @@ class KernelListIsolateConfiguration final : public IsolateConfiguration {
   }
 
  private:
+  std::mutex kernel_pieces_mutex_;
   std::vector<std::future<std::unique_ptr<const fml::Mapping>>> kernel_pieces_;
+  std::vector<std::shared_ptr<const fml::Mapping>> resolved_kernel_pieces_;
+  bool kernel_pieces_resolved_ = false;
+
+  // The futures may only be waited on once but this configuration may be
+  // asked to prepare multiple isolates. Collect the mappings on first use and
+  // share them with every subsequently prepared isolate.
+  void ResolveKernelPiecesIfNecessary() {
+    std::scoped_lock lock(kernel_pieces_mutex_);
+    if (kernel_pieces_resolved_) {
+      return;
+    }
+    kernel_pieces_resolved_ = true;
+    resolved_kernel_pieces_.reserve(kernel_pieces_.size());
+    for (auto& piece : kernel_pieces_) {
+      resolved_kernel_pieces_.emplace_back(piece.get());
+    }
+    kernel_pieces_.clear();
+  }
 
   FML_DISALLOW_COPY_AND_ASSIGN(KernelListIsolateConfiguration);
 };
 
+class SharedIsolateConfiguration final : public IsolateConfiguration {
+ public:
+  explicit SharedIsolateConfiguration(
+      std::shared_ptr<IsolateConfiguration> configuration)
+      : configuration_(std::move(configuration)) {
+    FML_DCHECK(configuration_);
+  }
+
+  // |IsolateConfiguration|
+  bool DoPrepareIsolate(DartIsolate& isolate) override {
+    // The public entry point re-checks the isolate phase, which is unchanged
+    // at this point.
+    return configuration_->PrepareIsolate(isolate);
+  }
+
+ private:
+  std::shared_ptr<IsolateConfiguration> configuration_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(SharedIsolateConfiguration);
+};
+
 static std::vector<std::string> ParseKernelListPaths(
     std::unique_ptr<fml::Mapping> kernel_list) {
   FML_DCHECK(kernel_list);
@@ -114,9 +160,11 @@ static std::vector<std::string> ParseKernelListPaths(
 }
 
 static std::vector<std::future<std::unique_ptr<const fml::Mapping>>>
-PrepareKernelMappings(std::vector<std::string> kernel_pieces_paths,
-                      std::shared_ptr<AssetManager> asset_manager,
-                      fml::RefPtr<fml::TaskRunner> io_worker) {
+PrepareKernelMappings(
+    std::vector<std::string> kernel_pieces_paths,
+    std::shared_ptr<AssetManager> asset_manager,
+    fml::RefPtr<fml::TaskRunner> io_worker,
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_pool) {
   FML_DCHECK(asset_manager);
   std::vector<std::future<std::unique_ptr<const fml::Mapping>>> fetch_futures;
 
@@ -129,9 +177,13 @@ PrepareKernelMappings(std::vector<std::string> kernel_pieces_paths,
           fetch_promise.set_value(
               asset_manager->GetAsMapping(kernel_pieces_path));
         });
-    // Fulfill the promise on the worker if one is available or the current
-    // thread if one is not.
-    if (io_worker) {
+    // Fulfill the promises on the concurrent worker pool if one is available
+    // (the pieces are independent files, so they can be mapped in parallel),
+    // falling back to the serial IO worker, or the current thread if neither
+    // is available.
+    if (worker_pool) {
+      worker_pool->PostTask(fetch_task);
+    } else if (io_worker) {
       io_worker->PostTask(fetch_task);
     } else {
       fetch_task();
@@ -144,7 +196,8 @@ PrepareKernelMappings(std::vector<std::string> kernel_pieces_paths,
 std::unique_ptr<IsolateConfiguration> IsolateConfiguration::InferFromSettings(
     const Settings& settings,
     std::shared_ptr<AssetManager> asset_manager,
-    fml::RefPtr<fml::TaskRunner> io_worker) {
+    fml::RefPtr<fml::TaskRunner> io_worker,
+    std::shared_ptr<fml::ConcurrentTaskRunner> worker_pool) {
   // Running in AOT mode.
   if (DartVM::IsRunningPrecompiledCode()) {
     return CreateForAppSnapshot();
@@ -184,8 +237,9 @@ std::unique_ptr<IsolateConfiguration> IsolateConfiguration::InferFromSettings(
       return nullptr;
     }
     auto kernel_pieces_paths = ParseKernelListPaths(std::move(kernel_list));
-    auto kernel_mappings = PrepareKernelMappings(std::move(kernel_pieces_paths),
-                                                 asset_manager, io_worker);
+    auto kernel_mappings =
+        PrepareKernelMappings(std::move(kernel_pieces_paths), asset_manager,
+                              io_worker, std::move(worker_pool));
     return CreateForKernelList(std::move(kernel_mappings));
   }
 
@@ -220,4 +274,12 @@ std::unique_ptr<IsolateConfiguration> IsolateConfiguration::CreateForKernelList(
       std::move(kernel_pieces));
 }
 
+std::unique_ptr<IsolateConfiguration> IsolateConfiguration::CreateShared(
+    std::shared_ptr<IsolateConfiguration> configuration) {
+  if (!configuration) {
+    return nullptr;
+  }
+  return std::make_unique<SharedIsolateConfiguration>(std::move(configuration));
+}
+
 }  // namespace flutter
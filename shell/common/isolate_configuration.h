@@ -12,6 +12,7 @@
 #include "flutter/assets/asset_manager.h"
 #include "flutter/assets/asset_resolver.h"
 #include "flutter/common/settings.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/memory/weak_ptr.h"
@@ -54,6 +55,14 @@ class IsolateConfiguration {
   /// @param[in]  io_worker      An optional IO worker. Specify `nullptr` is a
   ///                            worker should not be used or one is not
   ///                            available.
+  /// @param[in]  worker_pool    An optional concurrent worker pool. When one
+  ///                            is supplied, kernel pieces listed in the
+  ///                            application kernel list are fetched in
+  ///                            parallel across the pool instead of serially
+  ///                            on the IO worker. The pool must remain valid
+  ///                            till after the shell associated with the
+  ///                            engine used to launch the isolate is
+  ///                            collected.
   ///
   /// @return     An isolate configuration if one can be inferred from the
   ///             settings. If not, returns `nullptr`.
@@ -61,7 +70,8 @@ class IsolateConfiguration {
   static std::unique_ptr<IsolateConfiguration> InferFromSettings(
       const Settings& settings,
       std::shared_ptr<AssetManager> asset_manager,
-      fml::RefPtr<fml::TaskRunner> io_worker);
+      fml::RefPtr<fml::TaskRunner> io_worker,
+      std::shared_ptr<fml::ConcurrentTaskRunner> worker_pool = nullptr);
 
   //----------------------------------------------------------------------------
   /// @brief      Creates an AOT isolate configuration using snapshot symbols
@@ -120,6 +130,28 @@ class IsolateConfiguration {
   static std::unique_ptr<IsolateConfiguration> CreateForKernelList(
       std::vector<std::unique_ptr<const fml::Mapping>> kernel_pieces);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates an isolate configuration that delegates to a shared
+  ///             underlying configuration. All isolate configurations may
+  ///             prepare multiple isolates, but each `RunConfiguration` takes
+  ///             exclusive ownership of its configuration. Embedders that
+  ///             launch several engines from the same application bundle
+  ///             (multi-window desktop shells for instance) can infer the
+  ///             configuration once, wrap it in a shared pointer, and hand
+  ///             each engine a delegating configuration created by this
+  ///             method. The kernel mappings are then resolved and validated
+  ///             exactly once regardless of how many engines and isolates
+  ///             reference them.
+  ///
+  /// @param[in]  configuration  The configuration to which all prepared
+  ///                            isolates are delegated. Must not be null.
+  ///
+  /// @return     An isolate configuration sharing the underlying
+  ///             configuration.
+  ///
+  static std::unique_ptr<IsolateConfiguration> CreateShared(
+      std::shared_ptr<IsolateConfiguration> configuration);
+
   //----------------------------------------------------------------------------
   /// @brief      Create an isolate configuration. This has no threading
   /// restrictions.
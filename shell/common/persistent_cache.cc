@@ -4,7 +4,9 @@
 
 #include "flutter/shell/common/persistent_cache.h"
 
+#include <functional>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <string_view>
 
@@ -14,7 +16,6 @@
 #include "flutter/fml/base32.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/logging.h"
-#include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
@@ -50,6 +51,7 @@ bool PersistentCache::gIsReadOnly = false;
 
 std::atomic<bool> PersistentCache::cache_sksl_ = false;
 std::atomic<bool> PersistentCache::strategy_set_ = false;
+std::atomic<bool> PersistentCache::cache_program_binaries_ = false;
 
 void PersistentCache::SetCacheSkSL(bool value) {
   if (strategy_set_ && value != cache_sksl_) {
@@ -60,6 +62,39 @@ void PersistentCache::SetCacheSkSL(bool value) {
   cache_sksl_ = value;
 }
 
+void PersistentCache::SetCacheProgramBinaries(bool value) {
+  if (strategy_set_ && value != cache_program_binaries_) {
+    FML_LOG(ERROR) << "Cache program binaries can only be set before the "
+                      "GrContextOptions::fShaderCacheStrategy is set.";
+    return;
+  }
+  cache_program_binaries_ = value;
+}
+
+void PersistentCache::SetGpuFingerprint(const std::string& fingerprint) {
+  if (!IsValid()) {
+    return;
+  }
+
+  // The vendor strings are not filename safe; store entries under a hex
+  // digest of them instead.
+  std::stringstream digest_stream;
+  digest_stream << std::hex << std::hash<std::string>()(fingerprint);
+
+  program_binary_cache_directory_ = std::make_shared<fml::UniqueFD>(
+      CreateDirectory(*cache_directory_,
+                      {kProgramBinarySubdirName, digest_stream.str()},
+                      is_read_only_ ? fml::FilePermission::kRead
+                                    : fml::FilePermission::kReadWrite));
+
+  if (!program_binary_cache_directory_->is_valid()) {
+    FML_LOG(WARNING) << "Could not acquire the program binary cache "
+                        "directory. Shader caching falls back to the "
+                        "generic cache directory.";
+    program_binary_cache_directory_ = nullptr;
+  }
+}
+
 PersistentCache* PersistentCache::GetCacheForProcess() {
   std::scoped_lock lock(instance_mutex_);
   if (gPersistentCache == nullptr) {
@@ -230,7 +265,14 @@ sk_sp<SkData> PersistentCache::LoadFile(const fml::UniqueFD& dir,
   if (mapping->GetSize() == 0) {
     return nullptr;
   }
-  return SkData::MakeWithCopy(mapping->GetMapping(), mapping->GetSize());
+  // Wrap the mapping without copying its contents; the SkData keeps the
+  // mapping (and with it the pages) alive via the release proc.
+  return SkData::MakeWithProc(
+      mapping->GetMapping(), mapping->GetSize(),
+      [](const void* ptr, void* context) {
+        delete reinterpret_cast<fml::FileMapping*>(context);
+      },
+      mapping.release());
 }
 
 // |GrContextOptions::PersistentCache|
@@ -243,6 +285,19 @@ sk_sp<SkData> PersistentCache::load(const SkData& key) {
   if (file_name.size() == 0) {
     return nullptr;
   }
+  if (cache_program_binaries_ && program_binary_cache_directory_) {
+    // Under the backend-binary strategy all traffic through this cache is
+    // driver program binaries; they live in the fingerprint directory only,
+    // so entries written by a different driver revision (or a different
+    // strategy) are never handed back to Skia. A miss here makes Skia
+    // compile from source as usual.
+    auto result =
+        PersistentCache::LoadFile(*program_binary_cache_directory_, file_name);
+    if (result != nullptr) {
+      TRACE_EVENT0("flutter", "PersistentCacheLoadHit");
+    }
+    return result;
+  }
   auto result = PersistentCache::LoadFile(*cache_directory_, file_name);
   if (result != nullptr) {
     TRACE_EVENT0("flutter", "PersistentCacheLoadHit");
@@ -252,25 +307,23 @@ sk_sp<SkData> PersistentCache::load(const SkData& key) {
   return result;
 }
 
-static void PersistentCacheStore(fml::RefPtr<fml::TaskRunner> worker,
-                                 std::shared_ptr<fml::UniqueFD> cache_directory,
-                                 std::string key,
-                                 std::unique_ptr<fml::Mapping> value) {
-  auto task =
-      fml::MakeCopyable([cache_directory,             //
-                         file_name = std::move(key),  //
-                         mapping = std::move(value)   //
-  ]() mutable {
-        TRACE_EVENT0("flutter", "PersistentCacheStore");
-        if (!fml::WriteAtomically(*cache_directory,   //
-                                  file_name.c_str(),  //
-                                  *mapping)           //
-        ) {
-          FML_DLOG(WARNING)
-              << "Could not write cache contents to persistent store.";
-        }
-      });
+void PersistentCache::ScheduleWrite(std::shared_ptr<fml::UniqueFD> directory,
+                                    std::string file_name,
+                                    std::unique_ptr<fml::Mapping> mapping) {
+  {
+    std::scoped_lock lock(write_batch_->mutex);
+    write_batch_->writes.push_back(
+        {std::move(directory), std::move(file_name), std::move(mapping)});
+    if (write_batch_->flush_scheduled) {
+      // The already scheduled flush will pick this write up.
+      return;
+    }
+    write_batch_->flush_scheduled = true;
+  }
+
+  auto task = [batch = write_batch_]() { FlushWriteBatch(batch); };
 
+  auto worker = GetWorkerTaskRunner();
   if (!worker) {
     FML_LOG(WARNING)
         << "The persistent cache has no available workers. Performing the task "
@@ -282,6 +335,26 @@ static void PersistentCacheStore(fml::RefPtr<fml::TaskRunner> worker,
   }
 }
 
+void PersistentCache::FlushWriteBatch(
+    const std::shared_ptr<WriteBatch>& batch) {
+  TRACE_EVENT0("flutter", "PersistentCacheStore");
+  std::vector<PendingWrite> writes;
+  {
+    std::scoped_lock lock(batch->mutex);
+    writes.swap(batch->writes);
+    batch->flush_scheduled = false;
+  }
+  for (const auto& write : writes) {
+    if (!fml::WriteAtomically(*write.directory,         //
+                              write.file_name.c_str(),  //
+                              *write.mapping)           //
+    ) {
+      FML_DLOG(WARNING)
+          << "Could not write cache contents to persistent store.";
+    }
+  }
+}
+
 // |GrContextOptions::PersistentCache|
 void PersistentCache::store(const SkData& key, const SkData& data) {
   stored_new_shaders_ = true;
@@ -307,9 +380,75 @@ void PersistentCache::store(const SkData& key, const SkData& data) {
     return;
   }
 
-  PersistentCacheStore(GetWorkerTaskRunner(),
-                       cache_sksl_ ? sksl_cache_directory_ : cache_directory_,
-                       std::move(file_name), std::move(mapping));
+  std::shared_ptr<fml::UniqueFD> directory = cache_directory_;
+  if (cache_sksl_) {
+    directory = sksl_cache_directory_;
+  } else if (cache_program_binaries_ && program_binary_cache_directory_) {
+    directory = program_binary_cache_directory_;
+  }
+  ScheduleWrite(std::move(directory), std::move(file_name),
+                std::move(mapping));
+}
+
+namespace {
+
+std::string RasterImageFileName(uint64_t key) {
+  std::stringstream name_stream;
+  name_stream << "raster_image_" << std::hex << key;
+  return name_stream.str();
+}
+
+// Raster images can be tens of megabytes; wrap the SkData for the
+// asynchronous write instead of copying it into a DataMapping.
+class SkDataMapping final : public fml::Mapping {
+ public:
+  explicit SkDataMapping(sk_sp<SkData> data) : data_(std::move(data)) {}
+
+  size_t GetSize() const override { return data_->size(); }
+
+  const uint8_t* GetMapping() const override { return data_->bytes(); }
+
+ private:
+  sk_sp<SkData> data_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(SkDataMapping);
+};
+
+}  // namespace
+
+std::unique_ptr<fml::Mapping> PersistentCache::LoadRasterImage(
+    uint64_t key) const {
+  TRACE_EVENT0("flutter", "PersistentCacheLoadRasterImage");
+  if (!IsValid()) {
+    return nullptr;
+  }
+  auto file = fml::OpenFileReadOnly(*cache_directory_,
+                                    RasterImageFileName(key).c_str());
+  if (!file.is_valid()) {
+    return nullptr;
+  }
+  auto mapping = std::make_unique<fml::FileMapping>(file);
+  if (mapping->GetSize() == 0) {
+    return nullptr;
+  }
+  return mapping;
+}
+
+void PersistentCache::StoreRasterImage(uint64_t key, sk_sp<SkData> data) {
+  if (is_read_only_ || !IsValid() || !data || data->size() == 0) {
+    return;
+  }
+  ScheduleWrite(cache_directory_, RasterImageFileName(key),
+                std::make_unique<SkDataMapping>(std::move(data)));
+}
+
+std::unique_ptr<fml::Mapping> PersistentRasterCacheStore::Load(uint64_t key) {
+  return PersistentCache::GetCacheForProcess()->LoadRasterImage(key);
+}
+
+void PersistentRasterCacheStore::Store(uint64_t key, sk_sp<SkData> data) {
+  PersistentCache::GetCacheForProcess()->StoreRasterImage(key,
+                                                          std::move(data));
 }
 
 void PersistentCache::DumpSkp(const SkData& data) {
@@ -326,8 +465,7 @@ void PersistentCache::DumpSkp(const SkData& data) {
   FML_LOG(INFO) << "Dumping " << file_name;
   auto mapping = std::make_unique<fml::DataMapping>(
       std::vector<uint8_t>{data.bytes(), data.bytes() + data.size()});
-  PersistentCacheStore(GetWorkerTaskRunner(), cache_directory_,
-                       std::move(file_name), std::move(mapping));
+  ScheduleWrite(cache_directory_, std::move(file_name), std::move(mapping));
 }
 
 void PersistentCache::AddWorkerTaskRunner(
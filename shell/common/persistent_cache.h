@@ -8,9 +8,12 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <vector>
 
 #include "flutter/assets/asset_manager.h"
+#include "flutter/flow/raster_cache.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/fml/task_runner.h"
 #include "flutter/fml/unique_fd.h"
 #include "third_party/skia/include/gpu/GrContextOptions.h"
@@ -61,6 +64,12 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   // |GrContextOptions::PersistentCache|
   sk_sp<SkData> load(const SkData& key) override;
 
+  /// Disk tier for the raster cache (see flutter::RasterCacheStore). Entries
+  /// live alongside the shader cache in the engine cache directory and are
+  /// invalidated with it on engine or Skia version changes.
+  std::unique_ptr<fml::Mapping> LoadRasterImage(uint64_t key) const;
+  void StoreRasterImage(uint64_t key, sk_sp<SkData> data);
+
   using SkSLCache = std::pair<sk_sp<SkData>, sk_sp<SkData>>;
 
   /// Load all the SkSL shader caches in the right directory.
@@ -69,12 +78,28 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   /// Set the asset manager from which PersistentCache can load SkLSs. A nullptr
   /// can be provided to clear the asset manager.
   static void SetAssetManager(std::shared_ptr<AssetManager> value);
+  static std::shared_ptr<AssetManager> asset_manager() {
+    return asset_manager_;
+  }
 
   static bool cache_sksl() { return cache_sksl_; }
   static void SetCacheSkSL(bool value);
   static void MarkStrategySet() { strategy_set_ = true; }
 
+  static bool cache_program_binaries() { return cache_program_binaries_; }
+  static void SetCacheProgramBinaries(bool value);
+
+  /// Routes shader loads and stores through a directory dedicated to the
+  /// given driver/GPU fingerprint. Program binaries are only loadable by the
+  /// exact driver revision that produced them, so a driver update simply
+  /// starts an empty directory and Skia recompiles from source; binaries
+  /// from the previous driver are never fed back. Must be called before the
+  /// GrContext issues its first load, i.e. right after the GL context is
+  /// current and its vendor strings are readable.
+  void SetGpuFingerprint(const std::string& fingerprint);
+
   static constexpr char kSkSLSubdirName[] = "sksl";
+  static constexpr char kProgramBinarySubdirName[] = "program-binary";
   static constexpr char kAssetFileName[] = "io.flutter.shaders.json";
 
  private:
@@ -95,15 +120,50 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   // strategy_set_ becomes true.
   static std::atomic<bool> strategy_set_;
 
+  // Mirrors cache_sksl_: if true (and cache_sksl_ is not set), the GL
+  // surface selects `ShaderCacheStrategy::kBackendBinary` so Skia hands us
+  // driver program binaries instead of shader sources, skipping the driver
+  // compile and link on warm launches.
+  static std::atomic<bool> cache_program_binaries_;
+
   const bool is_read_only_;
   const std::shared_ptr<fml::UniqueFD> cache_directory_;
   const std::shared_ptr<fml::UniqueFD> sksl_cache_directory_;
+
+  // Valid only after |SetGpuFingerprint|; written on the raster thread
+  // before the GrContext performs any cache traffic.
+  std::shared_ptr<fml::UniqueFD> program_binary_cache_directory_;
   mutable std::mutex worker_task_runners_mutex_;
   std::multiset<fml::RefPtr<fml::TaskRunner>> worker_task_runners_;
 
   bool stored_new_shaders_ = false;
   bool is_dumping_skp_ = false;
 
+  // A write that has been accepted by |store| but not yet flushed to disk.
+  struct PendingWrite {
+    std::shared_ptr<fml::UniqueFD> directory;
+    std::string file_name;
+    std::unique_ptr<fml::Mapping> mapping;
+  };
+
+  // Writes accumulated between worker flushes. Shared with the in-flight
+  // flush task so that resetting the cache cannot strand it.
+  struct WriteBatch {
+    std::mutex mutex;
+    std::vector<PendingWrite> writes;
+    bool flush_scheduled = false;
+  };
+
+  std::shared_ptr<WriteBatch> write_batch_ = std::make_shared<WriteBatch>();
+
+  // Queue a write and schedule a single worker flush for the whole batch if
+  // one is not already pending.
+  void ScheduleWrite(std::shared_ptr<fml::UniqueFD> directory,
+                     std::string file_name,
+                     std::unique_ptr<fml::Mapping> mapping);
+
+  static void FlushWriteBatch(const std::shared_ptr<WriteBatch>& batch);
+
   static sk_sp<SkData> LoadFile(const fml::UniqueFD& dir,
                                 const std::string& filen_ame);
 
@@ -119,6 +179,17 @@ class PersistentCache : public GrContextOptions::PersistentCache {
   FML_DISALLOW_COPY_AND_ASSIGN(PersistentCache);
 };
 
+/// Adapts the process-wide persistent cache to the raster cache's store
+/// interface so that flow never reaches into the shell's singleton directly.
+class PersistentRasterCacheStore : public RasterCacheStore {
+ public:
+  // |RasterCacheStore|
+  std::unique_ptr<fml::Mapping> Load(uint64_t key) override;
+
+  // |RasterCacheStore|
+  void Store(uint64_t key, sk_sp<SkData> data) override;
+};
+
 }  // namespace flutter
 
 #endif  // FLUTTER_SHELL_COMMON_PERSISTENT_CACHE_H_
@@ -30,6 +30,33 @@ static void WaitForIO(Shell* shell) {
   io_task_finished.get_future().wait();
 }
 
+TEST_F(ShellTest, ProgramBinaryCacheRoutesByGpuFingerprint) {
+  fml::ScopedTemporaryDirectory dir;
+  PersistentCache::SetCacheDirectoryPath(dir.path());
+  PersistentCache::ResetCacheForProcess();
+  PersistentCache::SetCacheProgramBinaries(true);
+  ASSERT_TRUE(PersistentCache::cache_program_binaries());
+
+  auto* cache = PersistentCache::GetCacheForProcess();
+  cache->SetGpuFingerprint("VendorA\nMali-G72\nOpenGL ES 3.2 v1.r16p0\n");
+
+  auto key = SkData::MakeWithCString("program-key");
+  auto binary = SkData::MakeWithCString("program-binary-contents");
+  cache->store(*key, *binary);
+
+  auto loaded = cache->load(*key);
+  ASSERT_NE(loaded, nullptr);
+  ASSERT_TRUE(loaded->equals(binary.get()));
+
+  // Binaries written by one driver revision are invisible to another; the
+  // load misses and Skia compiles from source instead.
+  cache->SetGpuFingerprint("VendorA\nMali-G72\nOpenGL ES 3.2 v2.r20p0\n");
+  ASSERT_EQ(cache->load(*key), nullptr);
+
+  PersistentCache::SetCacheProgramBinaries(false);
+  PersistentCache::ResetCacheForProcess();
+}
+
 TEST_F(ShellTest, CacheSkSLWorks) {
   // Create a temp dir to store the persistent cache
   fml::ScopedTemporaryDirectory dir;
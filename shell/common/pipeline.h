@@ -22,6 +22,16 @@ enum class PipelineConsumeResult {
   MoreAvailable,
 };
 
+/// How |Pipeline::Consume| picks the resource handed to the consumer.
+enum class PipelineConsumeMode {
+  /// Consume resources strictly in the order they were produced.
+  kOldestFirst,
+  /// Consume the most recently produced resource and drop everything older
+  /// still in the queue. Favors latency over completeness when the consumer
+  /// falls behind the producer.
+  kLatestWins,
+};
+
 size_t GetNextPipelineTraceID();
 
 /// A thread-safe queue of resources for a single consumer and a single
@@ -90,13 +100,24 @@ class Pipeline : public fml::RefCountedThreadSafe<Pipeline<R>> {
     FML_DISALLOW_COPY_AND_ASSIGN(ProducerContinuation);
   };
 
-  explicit Pipeline(uint32_t depth)
-      : depth_(depth), empty_(depth), available_(0), inflight_(0) {}
+  explicit Pipeline(
+      uint32_t depth,
+      PipelineConsumeMode consume_mode = PipelineConsumeMode::kOldestFirst)
+      : depth_(depth),
+        consume_mode_(consume_mode),
+        empty_(depth),
+        available_(0),
+        inflight_(0) {}
 
   ~Pipeline() = default;
 
   bool IsValid() const { return empty_.IsValid() && available_.IsValid(); }
 
+  /// The number of resources currently between |Produce| and the end of
+  /// |Consume| - frames that are being built, are queued, or are being
+  /// rasterized. May be read from any thread.
+  int GetInflightDepth() const { return inflight_.load(); }
+
   ProducerContinuation Produce() {
     if (!empty_.TryWait()) {
       return {};
@@ -151,6 +172,21 @@ class Pipeline : public fml::RefCountedThreadSafe<Pipeline<R>> {
 
     {
       std::scoped_lock lock(queue_mutex_);
+      if (consume_mode_ == PipelineConsumeMode::kLatestWins) {
+        // Everything older than the most recent resource is stale; drop it
+        // without handing it to the consumer. Each dropped item releases its
+        // spot in the pipeline and the availability token this call did not
+        // claim for it.
+        while (queue_.size() > 1) {
+          const size_t dropped_trace_id = queue_.front().second;
+          queue_.pop_front();
+          available_.TryWait();
+          empty_.Signal();
+          --inflight_;
+          TRACE_FLOW_END("flutter", "PipelineItem", dropped_trace_id);
+          TRACE_EVENT_ASYNC_END0("flutter", "PipelineItem", dropped_trace_id);
+        }
+      }
       std::tie(resource, trace_id) = std::move(queue_.front());
       queue_.pop_front();
       items_count = queue_.size();
@@ -163,6 +199,11 @@ class Pipeline : public fml::RefCountedThreadSafe<Pipeline<R>> {
 
     empty_.Signal();
     --inflight_;
+    // Also reflects any items the kLatestWins drop loop released above.
+    FML_TRACE_COUNTER("flutter", "Pipeline Depth",
+                      reinterpret_cast<int64_t>(this),      //
+                      "frames in flight", inflight_.load()  //
+    );
 
     TRACE_FLOW_END("flutter", "PipelineItem", trace_id);
     TRACE_EVENT_ASYNC_END0("flutter", "PipelineItem", trace_id);
@@ -173,6 +214,7 @@ class Pipeline : public fml::RefCountedThreadSafe<Pipeline<R>> {
 
  private:
   const uint32_t depth_;
+  const PipelineConsumeMode consume_mode_;
   fml::Semaphore empty_;
   fml::Semaphore available_;
   std::atomic<int> inflight_;
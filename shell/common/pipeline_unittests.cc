@@ -130,5 +130,77 @@ TEST(PipelineTest, ProduceIfEmptySuccessfulIfQueueIsEmpty) {
   ASSERT_EQ(consume_result_1, PipelineConsumeResult::Done);
 }
 
+TEST(PipelineTest, LatestWinsConsumesNewestAndDropsOlder) {
+  const int depth = 3;
+  fml::RefPtr<IntPipeline> pipeline =
+      fml::MakeRefCounted<IntPipeline>(depth, PipelineConsumeMode::kLatestWins);
+
+  Continuation continuation_1 = pipeline->Produce();
+  Continuation continuation_2 = pipeline->Produce();
+  Continuation continuation_3 = pipeline->Produce();
+
+  const int test_val_1 = 1, test_val_2 = 2, test_val_3 = 3;
+  ASSERT_EQ(continuation_1.Complete(std::make_unique<int>(test_val_1)), true);
+  ASSERT_EQ(continuation_2.Complete(std::make_unique<int>(test_val_2)), true);
+  ASSERT_EQ(continuation_3.Complete(std::make_unique<int>(test_val_3)), true);
+
+  // Only the most recent value reaches the consumer; the older two are
+  // dropped in the same call.
+  PipelineConsumeResult consume_result_1 = pipeline->Consume(
+      [&test_val_3](std::unique_ptr<int> v) { ASSERT_EQ(*v, test_val_3); });
+  ASSERT_EQ(consume_result_1, PipelineConsumeResult::Done);
+
+  PipelineConsumeResult consume_result_2 =
+      pipeline->Consume([](std::unique_ptr<int> v) { FAIL(); });
+  ASSERT_EQ(consume_result_2, PipelineConsumeResult::NoneAvailable);
+
+  // Dropping stale items must free their spots for new producers.
+  Continuation continuation_4 = pipeline->Produce();
+  ASSERT_EQ(static_cast<bool>(continuation_4), true);
+  Continuation continuation_5 = pipeline->Produce();
+  ASSERT_EQ(static_cast<bool>(continuation_5), true);
+  Continuation continuation_6 = pipeline->Produce();
+  ASSERT_EQ(static_cast<bool>(continuation_6), true);
+}
+
+TEST(PipelineTest, InflightDepthTracksProduceAndConsume) {
+  fml::RefPtr<IntPipeline> pipeline = fml::MakeRefCounted<IntPipeline>(2);
+  ASSERT_EQ(pipeline->GetInflightDepth(), 0);
+
+  Continuation continuation_1 = pipeline->Produce();
+  ASSERT_EQ(pipeline->GetInflightDepth(), 1);
+  Continuation continuation_2 = pipeline->Produce();
+  ASSERT_EQ(pipeline->GetInflightDepth(), 2);
+
+  // Completing a continuation keeps the resource in flight until it has been
+  // consumed.
+  ASSERT_EQ(continuation_1.Complete(std::make_unique<int>(1)), true);
+  ASSERT_EQ(continuation_2.Complete(std::make_unique<int>(2)), true);
+  ASSERT_EQ(pipeline->GetInflightDepth(), 2);
+
+  PipelineConsumeResult consume_result =
+      pipeline->Consume([](std::unique_ptr<int> v) {});
+  ASSERT_EQ(consume_result, PipelineConsumeResult::MoreAvailable);
+  ASSERT_EQ(pipeline->GetInflightDepth(), 1);
+
+  consume_result = pipeline->Consume([](std::unique_ptr<int> v) {});
+  ASSERT_EQ(consume_result, PipelineConsumeResult::Done);
+  ASSERT_EQ(pipeline->GetInflightDepth(), 0);
+}
+
+TEST(PipelineTest, LatestWinsWithSingleItemBehavesLikeOldestFirst) {
+  fml::RefPtr<IntPipeline> pipeline =
+      fml::MakeRefCounted<IntPipeline>(2, PipelineConsumeMode::kLatestWins);
+
+  Continuation continuation = pipeline->Produce();
+
+  const int test_val = 1;
+  ASSERT_EQ(continuation.Complete(std::make_unique<int>(test_val)), true);
+
+  PipelineConsumeResult consume_result = pipeline->Consume(
+      [&test_val](std::unique_ptr<int> v) { ASSERT_EQ(*v, test_val); });
+  ASSERT_EQ(consume_result, PipelineConsumeResult::Done);
+}
+
 }  // namespace testing
 }  // namespace flutter
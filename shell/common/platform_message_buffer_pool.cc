@@ -0,0 +1,63 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/platform_message_buffer_pool.h"
+
+#include <mutex>
+#include <utility>
+
+namespace flutter {
+
+// Shared between the pool and outstanding buffers so that a buffer destroyed
+// after its pool can still dispose of its backing store safely.
+struct PlatformMessageBufferPool::SharedState {
+  explicit SharedState(size_t ring_size) : max_pooled_buffers(ring_size) {}
+
+  const size_t max_pooled_buffers;
+  std::mutex mutex;
+  std::vector<std::vector<uint8_t>> free_buffers;
+};
+
+PlatformMessageBufferPool::PlatformMessageBufferPool(size_t ring_size)
+    : state_(std::make_shared<SharedState>(ring_size)) {}
+
+PlatformMessageBufferPool::~PlatformMessageBufferPool() = default;
+
+std::unique_ptr<PlatformMessageBufferPool::Buffer>
+PlatformMessageBufferPool::Acquire(size_t size) {
+  std::vector<uint8_t> storage;
+  {
+    std::scoped_lock lock(state_->mutex);
+    if (!state_->free_buffers.empty()) {
+      storage = std::move(state_->free_buffers.back());
+      state_->free_buffers.pop_back();
+    }
+  }
+  if (storage.size() < size) {
+    storage.resize(size);
+  }
+  return std::unique_ptr<Buffer>(new Buffer(state_, std::move(storage), size));
+}
+
+PlatformMessageBufferPool::Buffer::Buffer(std::shared_ptr<SharedState> state,
+                                          std::vector<uint8_t> storage,
+                                          size_t size)
+    : state_(std::move(state)), storage_(std::move(storage)), size_(size) {}
+
+PlatformMessageBufferPool::Buffer::~Buffer() {
+  std::scoped_lock lock(state_->mutex);
+  if (state_->free_buffers.size() < state_->max_pooled_buffers) {
+    state_->free_buffers.push_back(std::move(storage_));
+  }
+}
+
+size_t PlatformMessageBufferPool::Buffer::GetSize() const {
+  return size_;
+}
+
+const uint8_t* PlatformMessageBufferPool::Buffer::GetMapping() const {
+  return storage_.data();
+}
+
+}  // namespace flutter
@@ -0,0 +1,95 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_PLATFORM_MESSAGE_BUFFER_POOL_H_
+#define FLUTTER_SHELL_COMMON_PLATFORM_MESSAGE_BUFFER_POOL_H_
+
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A ring of reusable payload buffers for high frequency platform
+///             message channels.
+///
+///             Streaming channels (camera previews, audio meters) push large
+///             payloads dozens of times per second, and allocating a fresh
+///             payload for every message churns the allocator on the platform
+///             thread. A buffer acquired here returns its backing store to
+///             the pool when the mapping is destroyed -- that is, once the
+///             payload has been handed off to the Dart side -- so steady
+///             state streaming cycles through the same handful of
+///             allocations.
+///
+///             The engine and the embedder share an address space, so moving
+///             the mapping through `PlatformView::DispatchPlatformMessage`
+///             is already copy-free; the pool removes the per-message
+///             allocation as well.
+///
+class PlatformMessageBufferPool {
+ public:
+  /// The number of backing stores the pool retains when buffers are
+  /// returned faster than they are acquired.
+  static constexpr size_t kDefaultRingSize = 4;
+
+ private:
+  struct SharedState;
+
+ public:
+  //----------------------------------------------------------------------------
+  /// @brief      A pooled payload buffer. Writable by the producer until it
+  ///             is moved into a `PlatformMessage`; recycles its backing
+  ///             store into the originating pool on destruction. Outliving
+  ///             the pool is safe: the backing store is then simply freed.
+  ///
+  class Buffer final : public fml::Mapping {
+   public:
+    ~Buffer() override;
+
+    // |fml::Mapping|
+    size_t GetSize() const override;
+
+    // |fml::Mapping|
+    const uint8_t* GetMapping() const override;
+
+    /// The producer writable view of the payload.
+    uint8_t* GetMutableMapping() { return storage_.data(); }
+
+   private:
+    friend class PlatformMessageBufferPool;
+
+    Buffer(std::shared_ptr<SharedState> state,
+           std::vector<uint8_t> storage,
+           size_t size);
+
+    std::shared_ptr<SharedState> state_;
+    std::vector<uint8_t> storage_;
+    size_t size_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(Buffer);
+  };
+
+  explicit PlatformMessageBufferPool(size_t ring_size = kDefaultRingSize);
+
+  ~PlatformMessageBufferPool();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Acquires a buffer of `size` bytes, reusing a pooled backing
+  ///             store when one is available. May be called from any thread.
+  ///
+  std::unique_ptr<Buffer> Acquire(size_t size);
+
+ private:
+  std::shared_ptr<SharedState> state_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PlatformMessageBufferPool);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_PLATFORM_MESSAGE_BUFFER_POOL_H_
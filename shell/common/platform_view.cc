@@ -36,6 +36,15 @@ void PlatformView::DispatchPlatformMessage(
   delegate_.OnPlatformViewDispatchPlatformMessage(std::move(message));
 }
 
+std::unique_ptr<PlatformMessageBufferPool::Buffer>
+PlatformView::AcquireMessageBuffer(const std::string& channel, size_t size) {
+  auto& pool = message_buffer_pools_[channel];
+  if (!pool) {
+    pool = std::make_unique<PlatformMessageBufferPool>();
+  }
+  return pool->Acquire(size);
+}
+
 void PlatformView::DispatchPointerDataPacket(
     std::unique_ptr<PointerDataPacket> packet) {
   delegate_.OnPlatformViewDispatchPointerDataPacket(
@@ -5,7 +5,9 @@
 #ifndef COMMON_PLATFORM_VIEW_H_
 #define COMMON_PLATFORM_VIEW_H_
 
+#include <map>
 #include <memory>
+#include <string>
 
 #include "flutter/common/task_runners.h"
 #include "flutter/flow/texture.h"
@@ -17,6 +19,7 @@
 #include "flutter/lib/ui/window/pointer_data_packet.h"
 #include "flutter/lib/ui/window/pointer_data_packet_converter.h"
 #include "flutter/lib/ui/window/viewport_metrics.h"
+#include "flutter/shell/common/platform_message_buffer_pool.h"
 #include "flutter/shell/common/pointer_data_dispatcher.h"
 #include "flutter/shell/common/surface.h"
 #include "flutter/shell/common/vsync_waiter.h"
@@ -543,6 +546,29 @@ class PlatformView {
   ///
   void MarkTextureFrameAvailable(int64_t texture_id);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Acquires a reusable payload buffer for a high frequency
+  ///             streaming channel. The buffer is writable until it is moved
+  ///             into a platform message handed to
+  ///             `DispatchPlatformMessage`, and its backing store returns to
+  ///             the channel's ring once the Dart side has consumed the
+  ///             payload. Each channel gets its own ring, created on first
+  ///             use, so steady state streaming (e.g. a camera preview
+  ///             pushing buffers every frame) reuses the same allocations
+  ///             instead of allocating and copying per message.
+  ///
+  ///             Must be called on the platform task runner, like
+  ///             `DispatchPlatformMessage` itself.
+  ///
+  /// @param[in]  channel  The channel the payload is destined for.
+  /// @param[in]  size     The payload size in bytes.
+  ///
+  /// @return     A writable mapping of exactly `size` bytes.
+  ///
+  std::unique_ptr<PlatformMessageBufferPool::Buffer> AcquireMessageBuffer(
+      const std::string& channel,
+      size_t size);
+
  protected:
   PlatformView::Delegate& delegate_;
   const TaskRunners task_runners_;
@@ -551,6 +577,11 @@ class PlatformView {
   SkISize size_;
   fml::WeakPtrFactory<PlatformView> weak_factory_;
 
+  // Lazily populated rings of reusable message payload buffers, one per
+  // streaming channel. Only accessed on the platform task runner.
+  std::map<std::string, std::unique_ptr<PlatformMessageBufferPool>>
+      message_buffer_pools_;
+
   // Unlike all other methods on the platform view, this is called on the
   // GPU task runner.
   virtual std::unique_ptr<Surface> CreateRenderingSurface();
@@ -4,11 +4,48 @@
 
 #include "flutter/shell/common/pointer_data_dispatcher.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include "flutter/fml/trace_event.h"
+
 namespace flutter {
 
+namespace {
+
+constexpr size_t kBytesPerPointerData = kPointerDataFieldCount * kBytesPerField;
+
+std::vector<PointerData> UnpackPointerPacket(const PointerDataPacket& packet) {
+  const std::vector<uint8_t>& bytes = packet.data();
+  std::vector<PointerData> result(bytes.size() / kBytesPerPointerData);
+  for (size_t i = 0; i < result.size(); i++) {
+    memcpy(&result[i], bytes.data() + i * kBytesPerPointerData,
+           sizeof(PointerData));
+  }
+  return result;
+}
+
+}  // namespace
+
 PointerDataDispatcher::~PointerDataDispatcher() = default;
 DefaultPointerDataDispatcher::~DefaultPointerDataDispatcher() = default;
 
+bool PointerDataDispatcher::HasPendingPointerWork() const {
+  // The default dispatcher forwards packets synchronously and never holds
+  // work back.
+  return false;
+}
+
+bool SmoothPointerDataDispatcher::HasPendingPointerWork() const {
+  return is_pointer_data_in_progress_ || pending_packet_ != nullptr;
+}
+
+bool ResamplingPointerDataDispatcher::HasPendingPointerWork() const {
+  // Devices with empty deques are erased eagerly, so a non-empty map means
+  // samples are waiting to be delivered at the next vsync.
+  return !buffered_samples_.empty();
+}
+
 SmoothPointerDataDispatcher::SmoothPointerDataDispatcher(Delegate& delegate)
     : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
 SmoothPointerDataDispatcher::~SmoothPointerDataDispatcher() = default;
@@ -60,4 +97,202 @@ void SmoothPointerDataDispatcher::DispatchPendingPacket() {
   ScheduleSecondaryVsyncCallback();
 }
 
+ResamplingPointerDataDispatcher::ResamplingPointerDataDispatcher(
+    Delegate& delegate,
+    uint32_t resample_offset_us)
+    : DefaultPointerDataDispatcher(delegate),
+      resample_offset_us_(resample_offset_us),
+      weak_factory_(this) {}
+
+ResamplingPointerDataDispatcher::~ResamplingPointerDataDispatcher() = default;
+
+bool ResamplingPointerDataDispatcher::IsResamplable(const PointerData& data) {
+  return data.kind == PointerData::DeviceKind::kTouch &&
+         data.signal_kind == PointerData::SignalKind::kNone &&
+         (data.change == PointerData::Change::kMove ||
+          data.change == PointerData::Change::kHover);
+}
+
+void ResamplingPointerDataDispatcher::DispatchPacket(
+    std::unique_ptr<PointerDataPacket> packet,
+    uint64_t trace_flow_id) {
+  auto samples = UnpackPointerPacket(*packet);
+
+  const bool all_resamplable =
+      !samples.empty() && std::all_of(samples.begin(), samples.end(),
+                                      [](const PointerData& data) {
+                                        return IsResamplable(data);
+                                      });
+
+  if (!all_resamplable) {
+    // Changes such as down, up, add and remove must neither be delayed nor
+    // reordered relative to buffered motion; drain the buffer first and pass
+    // the packet through untouched.
+    FlushBufferedSamples();
+    for (const auto& sample : samples) {
+      if (sample.change == PointerData::Change::kRemove) {
+        last_delivered_position_.erase(sample.device);
+      } else {
+        last_delivered_position_[sample.device] = {sample.physical_x,
+                                                   sample.physical_y};
+      }
+    }
+    last_trace_flow_id_ = trace_flow_id;
+    DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                                 trace_flow_id);
+    return;
+  }
+
+  for (const auto& sample : samples) {
+    buffered_samples_[sample.device].push_back(sample);
+  }
+  buffered_trace_flow_ids_.push_back(trace_flow_id);
+  samples_added_since_vsync_ = true;
+
+  if (!vsync_callback_scheduled_) {
+    vsync_callback_scheduled_ = true;
+    ScheduleSecondaryVsyncCallback();
+  }
+}
+
+void ResamplingPointerDataDispatcher::OnVsync() {
+  vsync_callback_scheduled_ = false;
+
+  if (buffered_samples_.empty()) {
+    return;
+  }
+
+  if (!samples_added_since_vsync_) {
+    // The input stream has stopped; deliver what is left rather than holding
+    // it for an interpolation partner that may never arrive.
+    FlushBufferedSamples();
+    return;
+  }
+  samples_added_since_vsync_ = false;
+
+  DispatchResampledPacket();
+
+  if (!buffered_samples_.empty()) {
+    vsync_callback_scheduled_ = true;
+    ScheduleSecondaryVsyncCallback();
+  }
+}
+
+void ResamplingPointerDataDispatcher::DispatchResampledPacket() {
+  FML_DCHECK(!buffered_samples_.empty());
+
+  std::vector<PointerData> resampled;
+  int64_t max_lag_us = 0;
+
+  for (auto it = buffered_samples_.begin(); it != buffered_samples_.end();) {
+    std::deque<PointerData>& samples = it->second;
+    FML_DCHECK(!samples.empty());
+
+    const PointerData& newest = samples.back();
+    const int64_t sample_time = newest.time_stamp - resample_offset_us_;
+
+    // Interpolate between the two samples straddling the sample time. If the
+    // offset reaches past the oldest sample (or is zero), the newest sample
+    // is delivered as-is instead of extrapolating.
+    PointerData sample = newest;
+    for (size_t i = 0; i + 1 < samples.size(); i++) {
+      const PointerData& before = samples[i];
+      const PointerData& after = samples[i + 1];
+      if (before.time_stamp <= sample_time &&
+          sample_time <= after.time_stamp) {
+        const double span = after.time_stamp - before.time_stamp;
+        const double t =
+            span > 0 ? (sample_time - before.time_stamp) / span : 1.0;
+        sample = after;
+        sample.physical_x =
+            before.physical_x + (after.physical_x - before.physical_x) * t;
+        sample.physical_y =
+            before.physical_y + (after.physical_y - before.physical_y) * t;
+        sample.time_stamp = sample_time;
+        break;
+      }
+    }
+
+    max_lag_us = std::max(max_lag_us, newest.time_stamp - sample.time_stamp);
+
+    // The delta must cover the motion of every dropped intermediate sample,
+    // so it is synthesized against the last delivered position.
+    auto last = last_delivered_position_.find(it->first);
+    if (last != last_delivered_position_.end()) {
+      sample.physical_delta_x = sample.physical_x - last->second.first;
+      sample.physical_delta_y = sample.physical_y - last->second.second;
+    }
+    last_delivered_position_[it->first] = {sample.physical_x,
+                                           sample.physical_y};
+    resampled.push_back(sample);
+
+    // Samples at or before the delivered time are consumed; newer ones stay
+    // buffered as interpolation partners for the next frame.
+    while (!samples.empty() &&
+           samples.front().time_stamp <= sample.time_stamp) {
+      samples.pop_front();
+    }
+    it = samples.empty() ? buffered_samples_.erase(it) : std::next(it);
+  }
+
+  auto lag_string = std::to_string(max_lag_us);
+  TRACE_EVENT1("flutter", "ResamplePointerPacket", "sample_lag_us",
+               lag_string.c_str());
+
+  auto packet = std::make_unique<PointerDataPacket>(resampled.size());
+  for (size_t i = 0; i < resampled.size(); i++) {
+    packet->SetPointerData(i, resampled[i]);
+  }
+  DispatchCoalesced(std::move(packet));
+}
+
+void ResamplingPointerDataDispatcher::FlushBufferedSamples() {
+  if (buffered_samples_.empty()) {
+    return;
+  }
+
+  size_t count = 0;
+  for (const auto& [device, samples] : buffered_samples_) {
+    count += samples.size();
+  }
+
+  auto packet = std::make_unique<PointerDataPacket>(count);
+  size_t i = 0;
+  for (const auto& [device, samples] : buffered_samples_) {
+    for (const auto& sample : samples) {
+      packet->SetPointerData(i++, sample);
+      last_delivered_position_[device] = {sample.physical_x,
+                                          sample.physical_y};
+    }
+  }
+  buffered_samples_.clear();
+
+  DispatchCoalesced(std::move(packet));
+}
+
+void ResamplingPointerDataDispatcher::DispatchCoalesced(
+    std::unique_ptr<PointerDataPacket> packet) {
+  if (!buffered_trace_flow_ids_.empty()) {
+    last_trace_flow_id_ = buffered_trace_flow_ids_.back();
+    buffered_trace_flow_ids_.pop_back();
+    // The folded packets will never be individually dispatched; end their
+    // flows here.
+    for (uint64_t trace_flow_id : buffered_trace_flow_ids_) {
+      TRACE_FLOW_END("flutter", "PointerEvent", trace_flow_id);
+    }
+    buffered_trace_flow_ids_.clear();
+  }
+  DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                               last_trace_flow_id_);
+}
+
+void ResamplingPointerDataDispatcher::ScheduleSecondaryVsyncCallback() {
+  delegate_.ScheduleSecondaryVsyncCallback(
+      [dispatcher = weak_factory_.GetWeakPtr()]() {
+        if (dispatcher) {
+          dispatcher->OnVsync();
+        }
+      });
+}
+
 }  // namespace flutter
@@ -5,6 +5,11 @@
 #ifndef POINTER_DATA_DISPATCHER_H_
 #define POINTER_DATA_DISPATCHER_H_
 
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "flutter/runtime/runtime_controller.h"
 #include "flutter/shell/common/animator.h"
 
@@ -72,6 +77,14 @@ class PointerDataDispatcher {
   virtual void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
                               uint64_t trace_flow_id) = 0;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Whether this dispatcher still holds undelivered pointer
+  ///             work: a packet whose frame has not finished, a packet
+  ///             deferred to the next vsync, or samples buffered for
+  ///             resampling. The engine consults this to suppress idle-time
+  ///             work such as GC notifications during active gestures.
+  virtual bool HasPendingPointerWork() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Default destructor.
   virtual ~PointerDataDispatcher();
@@ -142,6 +155,9 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
                       uint64_t trace_flow_id) override;
 
+  // |PointerDataDispatcher|
+  bool HasPendingPointerWork() const override;
+
   virtual ~SmoothPointerDataDispatcher();
 
  private:
@@ -162,6 +178,74 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   FML_DISALLOW_COPY_AND_ASSIGN(SmoothPointerDataDispatcher);
 };
 
+//------------------------------------------------------------------------------
+/// A dispatcher for devices that deliver touch samples at a higher rate than
+/// the display refreshes (e.g., 240Hz touch on a 120Hz panel). Forwarding
+/// every sample burns a framework pointer callback per sample for motion the
+/// screen cannot show.
+///
+/// Touch move and hover samples are buffered and, once per frame (via
+/// `ScheduleSecondaryVsyncCallback`), interpolated to a single sample at a
+/// configurable offset behind the newest buffered sample. All other changes
+/// (down, up, add, remove, ...) flush the buffer and pass through immediately
+/// so that event ordering is preserved.
+///
+/// The offset trades latency for stability: the interpolation target must
+/// stay between two real samples or motion would have to be extrapolated. The
+/// lag between the newest buffered sample and the delivered one is reported
+/// in the "ResamplePointerPacket" trace event.
+class ResamplingPointerDataDispatcher : public DefaultPointerDataDispatcher {
+ public:
+  ResamplingPointerDataDispatcher(Delegate& delegate,
+                                  uint32_t resample_offset_us);
+
+  // |PointerDataDispatcer|
+  void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                      uint64_t trace_flow_id) override;
+
+  // |PointerDataDispatcher|
+  bool HasPendingPointerWork() const override;
+
+  virtual ~ResamplingPointerDataDispatcher();
+
+ private:
+  // Undelivered resamplable samples keyed by device, oldest first.
+  std::map<int64_t, std::deque<PointerData>> buffered_samples_;
+
+  // Trace flow ids of the packets folded into the buffer and not yet
+  // delivered.
+  std::vector<uint64_t> buffered_trace_flow_ids_;
+
+  // The last position delivered per device. Used to synthesize deltas that
+  // cover the motion of dropped intermediate samples.
+  std::map<int64_t, std::pair<double, double>> last_delivered_position_;
+
+  const uint32_t resample_offset_us_;
+
+  uint64_t last_trace_flow_id_ = 0;
+
+  bool vsync_callback_scheduled_ = false;
+  bool samples_added_since_vsync_ = false;
+
+  fml::WeakPtrFactory<ResamplingPointerDataDispatcher> weak_factory_;
+
+  static bool IsResamplable(const PointerData& data);
+
+  void OnVsync();
+
+  // Deliver all buffered samples without resampling. Used when the input
+  // stream stops or a non-resamplable change must not be reordered.
+  void FlushBufferedSamples();
+
+  void DispatchResampledPacket();
+
+  void DispatchCoalesced(std::unique_ptr<PointerDataPacket> packet);
+
+  void ScheduleSecondaryVsyncCallback();
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ResamplingPointerDataDispatcher);
+};
+
 //--------------------------------------------------------------------------
 /// @brief      Signature for constructing PointerDataDispatcher.
 ///
@@ -6,12 +6,18 @@
 
 #include "flutter/shell/common/persistent_cache.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
+#include "flutter/runtime/skia_concurrent_executor.h"
+#include "flutter/shell/common/gl_context_switch.h"
+#include "flutter/shell/common/gpu_resource_cache_governor.h"
+#include "rapidjson/document.h"
 #include "third_party/skia/include/core/SkEncodedImageFormat.h"
 #include "third_party/skia/include/core/SkImageEncoder.h"
+#include "third_party/skia/include/core/SkPicture.h"
 #include "third_party/skia/include/core/SkPictureRecorder.h"
 #include "third_party/skia/include/core/SkSerialProcs.h"
 #include "third_party/skia/include/core/SkSurface.h"
@@ -55,7 +61,9 @@ Rasterizer::Rasterizer(
       compositor_context_(std::move(compositor_context)),
       user_override_resource_cache_bytes_(false),
       weak_factory_(this),
-      is_gpu_disabled_sync_switch_(is_gpu_disabled_sync_switch) {
+      is_gpu_disabled_sync_switch_(is_gpu_disabled_sync_switch),
+      last_present_latency_micros_(
+          std::make_shared<std::atomic<int64_t>>(-1)) {
   FML_DCHECK(compositor_context_);
 }
 
@@ -77,22 +85,52 @@ void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
                              user_override_resource_cache_bytes_);
   }
   compositor_context_->OnGrContextCreated();
+  if (auto standalone_budget = GetResourceCacheMaxBytes()) {
+    // Enroll this context in the process-wide budget so several engines in
+    // the same process do not stack their cache limits additively. The weak
+    // pointer is raster task runner affine, matching where budget updates
+    // are posted.
+    GpuResourceCacheGovernor::GetForProcess().RegisterContext(
+        reinterpret_cast<uintptr_t>(this),       //
+        task_runners_.GetRasterTaskRunner(),     //
+        standalone_budget.value(),               //
+        [weak = weak_factory_.GetWeakPtr()](size_t budget_bytes) {
+          if (weak) {
+            weak->ApplyGovernedResourceCacheBytes(budget_bytes);
+          }
+        });
+  }
   if (surface_->GetExternalViewEmbedder()) {
     const auto platform_id =
         task_runners_.GetPlatformTaskRunner()->GetTaskQueueId();
     const auto gpu_id = task_runners_.GetRasterTaskRunner()->GetTaskQueueId();
     raster_thread_merger_ =
         fml::MakeRefCounted<fml::RasterThreadMerger>(platform_id, gpu_id);
+    // Flush pending GPU work before the raster task runner migrates back to
+    // its own thread so deferred Skia object releases are not submitted
+    // against a context that is mid-transition. The callback only fires from
+    // this rasterizer's |DecrementLease| call, so |this| is alive.
+    raster_thread_merger_->SetPreUnmergeCallback([this]() {
+      if (surface_ && surface_->GetContext()) {
+        surface_->GetContext()->flush();
+      }
+    });
   }
 }
 
 void Rasterizer::Teardown() {
+  GpuResourceCacheGovernor::GetForProcess().UnregisterContext(
+      reinterpret_cast<uintptr_t>(this));
   compositor_context_->OnGrContextDestroyed();
+  prepared_frame_.reset();
   surface_.reset();
   last_layer_tree_.reset();
 }
 
 void Rasterizer::NotifyLowMemoryWarning() const {
+  // The raster cache holds large render targets that the GrContext considers
+  // referenced; release them first so the purge below can reclaim them.
+  compositor_context_->raster_cache().Clear();
   if (!surface_) {
     FML_DLOG(INFO) << "Rasterizer::PurgeCaches called with no surface.";
     return;
@@ -105,6 +143,30 @@ void Rasterizer::NotifyLowMemoryWarning() const {
   context->freeGpuResources();
 }
 
+void Rasterizer::NotifyModerateMemoryPressure() const {
+  if (!surface_) {
+    return;
+  }
+  auto context = surface_->GetContext();
+  if (!context) {
+    return;
+  }
+  context->purgeUnlockedResources(true /* scratch resources only */);
+}
+
+std::optional<size_t> Rasterizer::GetResourceCacheBytes() const {
+  if (!surface_) {
+    return std::nullopt;
+  }
+  GrContext* context = surface_->GetContext();
+  if (context) {
+    size_t bytes = 0;
+    context->getResourceCacheUsage(nullptr, &bytes);
+    return bytes;
+  }
+  return std::nullopt;
+}
+
 flutter::TextureRegistry* Rasterizer::GetTextureRegistry() {
   return &compositor_context_->texture_registry();
 }
@@ -117,7 +179,11 @@ void Rasterizer::DrawLastLayerTree() {
   if (!last_layer_tree_ || !surface_) {
     return;
   }
-  DrawToSurface(*last_layer_tree_);
+  // The previous frame's contents on the surface cannot be trusted here, so
+  // the whole frame is damaged.
+  DrawToSurface(*last_layer_tree_,
+                SkRect::MakeIWH(last_layer_tree_->frame_size().width(),
+                                last_layer_tree_->frame_size().height()));
 }
 
 void Rasterizer::Draw(fml::RefPtr<Pipeline<flutter::LayerTree>> pipeline) {
@@ -255,6 +321,96 @@ sk_sp<SkImage> Rasterizer::MakeRasterSnapshot(sk_sp<SkPicture> picture,
                               });
 }
 
+// static
+std::vector<SkIRect> Rasterizer::ComputeSnapshotAtlasLayout(
+    const std::vector<SkISize>& sizes,
+    int32_t max_atlas_dim,
+    SkISize* atlas_size) {
+  // The gutter keeps a slice from sampling its neighbor when the resulting
+  // image is drawn with filtering.
+  constexpr int32_t kGutter = 1;
+
+  std::vector<SkIRect> rects;
+  rects.reserve(sizes.size());
+
+  int32_t pen_x = 0;
+  int32_t pen_y = 0;
+  int32_t shelf_height = 0;
+  int32_t atlas_width = 0;
+  for (const SkISize& size : sizes) {
+    if (pen_x > 0 && pen_x + size.width() > max_atlas_dim) {
+      pen_y += shelf_height + kGutter;
+      pen_x = 0;
+      shelf_height = 0;
+    }
+    rects.push_back(
+        SkIRect::MakeXYWH(pen_x, pen_y, size.width(), size.height()));
+    pen_x += size.width() + kGutter;
+    shelf_height = std::max(shelf_height, size.height());
+    atlas_width = std::max(atlas_width, rects.back().right());
+  }
+
+  *atlas_size = SkISize::Make(atlas_width, pen_y + shelf_height);
+  return rects;
+}
+
+std::vector<sk_sp<SkImage>> Rasterizer::MakeRasterSnapshots(
+    std::vector<PictureSnapshotRequest> requests) {
+  TRACE_EVENT0("flutter", __FUNCTION__);
+  std::vector<sk_sp<SkImage>> images(requests.size());
+  if (requests.empty()) {
+    return images;
+  }
+  if (requests.size() == 1u) {
+    images[0] = MakeRasterSnapshot(std::move(requests[0].picture),
+                                   requests[0].size);
+    return images;
+  }
+
+  // Conservative enough to fit the render target limits of the GPU backends
+  // we run on.
+  constexpr int32_t kMaxAtlasDim = 4096;
+
+  std::vector<SkISize> sizes;
+  sizes.reserve(requests.size());
+  for (const auto& request : requests) {
+    sizes.push_back(request.size);
+  }
+
+  SkISize atlas_size = SkISize::MakeEmpty();
+  const auto layout =
+      ComputeSnapshotAtlasLayout(sizes, kMaxAtlasDim, &atlas_size);
+
+  sk_sp<SkImage> atlas;
+  if (atlas_size.width() <= kMaxAtlasDim &&
+      atlas_size.height() <= kMaxAtlasDim) {
+    atlas = DoMakeRasterSnapshot(atlas_size, [&requests,
+                                              &layout](SkCanvas* canvas) {
+      for (size_t i = 0; i < requests.size(); i++) {
+        SkAutoCanvasRestore save(canvas, true);
+        canvas->clipRect(SkRect::Make(layout[i]));
+        canvas->translate(layout[i].x(), layout[i].y());
+        canvas->drawPicture(requests[i].picture);
+      }
+    });
+  }
+
+  if (!atlas) {
+    // The batch did not fit in one reasonably sized render target (or the
+    // rasterization failed); snapshot each picture individually instead.
+    for (size_t i = 0; i < requests.size(); i++) {
+      images[i] =
+          MakeRasterSnapshot(std::move(requests[i].picture), requests[i].size);
+    }
+    return images;
+  }
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    images[i] = atlas->makeSubset(layout[i]);
+  }
+  return images;
+}
+
 sk_sp<SkImage> Rasterizer::ConvertToRasterImage(sk_sp<SkImage> image) {
   TRACE_EVENT0("flutter", __FUNCTION__);
 
@@ -283,6 +439,20 @@ RasterStatus Rasterizer::DoDraw(
     return RasterStatus::kFailed;
   }
 
+  GpuResourceCacheGovernor::GetForProcess().RecordContextUse(
+      reinterpret_cast<uintptr_t>(this));
+
+  // Skia parcels some raster work (path mask generation, SkSL compilation)
+  // out to the shared worker pool. Anything it spawns while this frame is
+  // drawing is latency sensitive and must not queue behind background tasks
+  // such as image decodes.
+  SkiaConcurrentExecutor::FrameCriticalScope frame_critical_scope;
+
+  // Every context switch within the frame finds the context already current
+  // and becomes a no-op; the context from before the frame is restored once
+  // when this scope ends.
+  GLContextBatchScope gl_context_batch_scope;
+
   FrameTiming timing;
 #if !defined(OS_FUCHSIA)
   const fml::TimePoint frame_target_time = layer_tree->target_time();
@@ -294,7 +464,9 @@ RasterStatus Rasterizer::DoDraw(
   PersistentCache* persistent_cache = PersistentCache::GetCacheForProcess();
   persistent_cache->ResetStoredNewShaders();
 
-  RasterStatus raster_status = DrawToSurface(*layer_tree);
+  const SkRect frame_damage = layer_tree->ComputeDamage(last_layer_tree_.get());
+
+  RasterStatus raster_status = DrawToSurface(*layer_tree, frame_damage);
   if (raster_status == RasterStatus::kSuccess) {
     last_layer_tree_ = std::move(layer_tree);
   } else if (raster_status == RasterStatus::kResubmit) {
@@ -314,6 +486,23 @@ RasterStatus Rasterizer::DoDraw(
   // for Fuchsia to capture SceneUpdateContext::ExecutePaintTasks.
   const auto raster_finish_time = fml::TimePoint::Now();
   timing.Set(FrameTiming::kRasterFinish, raster_finish_time);
+
+  // Surfaces backed by an API with timer queries report how long the GPU
+  // spent executing a recently presented frame. The readback is asynchronous,
+  // so the measurement lags the frame it describes by a frame or two.
+  if (auto gpu_duration = surface_->GetGpuFrameDuration()) {
+    compositor_context_->gpu_time().SetLapTime(*gpu_duration);
+    timing.SetGpuDuration(*gpu_duration);
+  }
+
+  // Present handlers fire after submission, so this describes a frame
+  // presented shortly before this one, just like the GPU duration above.
+  const int64_t present_latency_micros = last_present_latency_micros_->load();
+  if (present_latency_micros >= 0) {
+    timing.SetPresentationDelay(
+        fml::TimeDelta::FromMicroseconds(present_latency_micros));
+  }
+
   delegate_.OnFrameRasterized(timing);
 
 // SceneDisplayLag events are disabled on Fuchsia.
@@ -372,11 +561,34 @@ RasterStatus Rasterizer::DoDraw(
   return raster_status;
 }
 
-RasterStatus Rasterizer::DrawToSurface(flutter::LayerTree& layer_tree) {
+void Rasterizer::PrepareFrame(SkISize frame_size) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  if (!surface_ || !surface_->SupportsSpeculativeFrameAcquisition() ||
+      frame_size.isEmpty()) {
+    return;
+  }
+  if (prepared_frame_ && prepared_frame_size_ == frame_size) {
+    return;
+  }
+  TRACE_EVENT0("flutter", "Rasterizer::PrepareFrame");
+  prepared_frame_.reset();
+  prepared_frame_ = surface_->AcquireFrame(frame_size);
+  prepared_frame_size_ = frame_size;
+}
+
+RasterStatus Rasterizer::DrawToSurface(flutter::LayerTree& layer_tree,
+                                       const SkRect& damage) {
   TRACE_EVENT0("flutter", "Rasterizer::DrawToSurface");
   FML_DCHECK(surface_);
 
-  auto frame = surface_->AcquireFrame(layer_tree.frame_size());
+  std::unique_ptr<SurfaceFrame> frame;
+  if (prepared_frame_ && prepared_frame_size_ == layer_tree.frame_size()) {
+    frame = std::move(prepared_frame_);
+  } else {
+    // A stale prepared frame (from before a resize) is dropped unsubmitted.
+    prepared_frame_.reset();
+    frame = surface_->AcquireFrame(layer_tree.frame_size());
+  }
 
   if (frame == nullptr) {
     return RasterStatus::kFailed;
@@ -417,7 +629,44 @@ RasterStatus Rasterizer::DrawToSurface(flutter::LayerTree& layer_tree) {
   );
 
   if (compositor_frame) {
+    SkRect device_damage;
+    root_surface_transformation.mapRect(&device_damage, damage);
+    frame->set_submit_damage(device_damage);
+
+    // Lets backends with presentation scheduling ask the compositor to latch
+    // this frame on the vsync it was built for.
+    frame->set_target_present_time(layer_tree.target_time());
+
+    // Backends with a presentation signal report when the compositor really
+    // displayed this frame. The handler may fire on any thread, after this
+    // rasterizer is gone.
+    const fml::TimePoint submit_time = fml::TimePoint::Now();
+    frame->set_presented_callback(
+        [latency = last_present_latency_micros_,
+         submit_time](fml::TimePoint presentation_time) {
+          latency->store((presentation_time - submit_time).ToMicroseconds());
+        });
+
+    // When the backend guarantees that undamaged contents of the previous
+    // frame are preserved, painting can be clipped to the damage region and
+    // Skia quick-rejects everything outside of it. Platform view embedders
+    // composite frames out of multiple surfaces, so they always repaint in
+    // full.
+    const bool clip_to_damage =
+        frame->supports_partial_repaint() && external_view_embedder == nullptr;
+    if (clip_to_damage) {
+      // Regions of the backbuffer that are stale relative to the previous
+      // frame (reused buffers older than one frame) have to be repainted
+      // alongside the new damage.
+      SkRect repaint_region = device_damage;
+      repaint_region.join(frame->existing_damage());
+      root_surface_canvas->save();
+      root_surface_canvas->clipRect(repaint_region);
+    }
     RasterStatus raster_status = compositor_frame->Raster(layer_tree, false);
+    if (clip_to_damage) {
+      root_surface_canvas->restore();
+    }
     if (raster_status == RasterStatus::kFailed) {
       return raster_status;
     }
@@ -446,7 +695,7 @@ static sk_sp<SkData> SerializeTypeface(SkTypeface* typeface, void* ctx) {
   return typeface->serialize(SkTypeface::SerializeBehavior::kDoIncludeData);
 }
 
-static sk_sp<SkData> ScreenshotLayerTreeAsPicture(
+static sk_sp<SkPicture> RecordLayerTreeToPicture(
     flutter::LayerTree* tree,
     flutter::CompositorContext& compositor_context) {
   FML_DCHECK(tree != nullptr);
@@ -465,10 +714,18 @@ static sk_sp<SkData> ScreenshotLayerTreeAsPicture(
 
   frame->Raster(*tree, true);
 
+  return recorder.finishRecordingAsPicture();
+}
+
+static sk_sp<SkData> SerializePicture(const sk_sp<SkPicture>& picture) {
+  if (picture == nullptr) {
+    return nullptr;
+  }
+
   SkSerialProcs procs = {0};
   procs.fTypefaceProc = SerializeTypeface;
 
-  return recorder.finishRecordingAsPicture()->serialize(&procs);
+  return picture->serialize(&procs);
 }
 
 static sk_sp<SkSurface> CreateSnapshotSurface(GrContext* surface_context,
@@ -489,11 +746,10 @@ static sk_sp<SkSurface> CreateSnapshotSurface(GrContext* surface_context,
   return SkSurface::MakeRaster(image_info);
 }
 
-static sk_sp<SkData> ScreenshotLayerTreeAsImage(
+static sk_sp<SkImage> RasterizeLayerTreeToImage(
     flutter::LayerTree* tree,
     flutter::CompositorContext& compositor_context,
-    GrContext* surface_context,
-    bool compressed) {
+    GrContext* surface_context) {
   // Attempt to create a snapshot surface depending on whether we have access to
   // a valid GPU rendering context.
   auto snapshot_surface =
@@ -537,6 +793,15 @@ static sk_sp<SkData> ScreenshotLayerTreeAsImage(
     return nullptr;
   }
 
+  return cpu_snapshot;
+}
+
+static sk_sp<SkData> EncodeRasterImage(const sk_sp<SkImage>& cpu_snapshot,
+                                       bool compressed) {
+  if (cpu_snapshot == nullptr) {
+    return nullptr;
+  }
+
   // If the caller want the pixels to be compressed, there is a Skia utility to
   // compress to PNG. Use that.
   if (compressed) {
@@ -553,6 +818,13 @@ static sk_sp<SkData> ScreenshotLayerTreeAsImage(
   return SkData::MakeWithCopy(pixmap.addr32(), pixmap.computeByteSize());
 }
 
+static sk_sp<SkData> Base64EncodeData(const sk_sp<SkData>& data) {
+  size_t b64_size = SkBase64::Encode(data->data(), data->size(), nullptr);
+  auto b64_data = SkData::MakeUninitialized(b64_size);
+  SkBase64::Encode(data->data(), data->size(), b64_data->writable_data());
+  return b64_data;
+}
+
 Rasterizer::Screenshot Rasterizer::ScreenshotLastLayerTree(
     Rasterizer::ScreenshotType type,
     bool base64_encode) {
@@ -568,15 +840,20 @@ Rasterizer::Screenshot Rasterizer::ScreenshotLastLayerTree(
 
   switch (type) {
     case ScreenshotType::SkiaPicture:
-      data = ScreenshotLayerTreeAsPicture(layer_tree, *compositor_context_);
+      data = SerializePicture(
+          RecordLayerTreeToPicture(layer_tree, *compositor_context_));
       break;
     case ScreenshotType::UncompressedImage:
-      data = ScreenshotLayerTreeAsImage(layer_tree, *compositor_context_,
-                                        surface_context, false);
+      data = EncodeRasterImage(
+          RasterizeLayerTreeToImage(layer_tree, *compositor_context_,
+                                    surface_context),
+          false);
       break;
     case ScreenshotType::CompressedImage:
-      data = ScreenshotLayerTreeAsImage(layer_tree, *compositor_context_,
-                                        surface_context, true);
+      data = EncodeRasterImage(
+          RasterizeLayerTreeToImage(layer_tree, *compositor_context_,
+                                    surface_context),
+          true);
       break;
   }
 
@@ -586,15 +863,155 @@ Rasterizer::Screenshot Rasterizer::ScreenshotLastLayerTree(
   }
 
   if (base64_encode) {
-    size_t b64_size = SkBase64::Encode(data->data(), data->size(), nullptr);
-    auto b64_data = SkData::MakeUninitialized(b64_size);
-    SkBase64::Encode(data->data(), data->size(), b64_data->writable_data());
-    return Rasterizer::Screenshot{b64_data, layer_tree->frame_size()};
+    return Rasterizer::Screenshot{Base64EncodeData(data),
+                                  layer_tree->frame_size()};
   }
 
   return Rasterizer::Screenshot{data, layer_tree->frame_size()};
 }
 
+void Rasterizer::ScreenshotLastLayerTreeAsync(Rasterizer::ScreenshotType type,
+                                              bool base64_encode,
+                                              ScreenshotCallback callback) {
+  FML_DCHECK(callback);
+
+  auto* layer_tree = GetLastLayerTree();
+  if (layer_tree == nullptr) {
+    FML_LOG(ERROR) << "Last layer tree was null when screenshotting.";
+    task_runners_.GetIOTaskRunner()->PostTask(
+        [callback = std::move(callback)]() { callback({}); });
+    return;
+  }
+
+  const auto frame_size = layer_tree->frame_size();
+
+  // Pull a thread safe intermediate representation of the last layer tree off
+  // the raster thread. Recording a picture or resolving the tree to a CPU
+  // backed image is cheap compared to the encoding steps that follow, which
+  // are the ones that block frame production when done synchronously.
+  sk_sp<SkPicture> picture;
+  sk_sp<SkImage> cpu_snapshot;
+  switch (type) {
+    case ScreenshotType::SkiaPicture:
+      picture = RecordLayerTreeToPicture(layer_tree, *compositor_context_);
+      break;
+    case ScreenshotType::UncompressedImage:
+    case ScreenshotType::CompressedImage:
+      cpu_snapshot = RasterizeLayerTreeToImage(
+          layer_tree, *compositor_context_,
+          surface_ ? surface_->GetContext() : nullptr);
+      break;
+  }
+
+  task_runners_.GetIOTaskRunner()->PostTask(
+      [type, base64_encode, frame_size, picture = std::move(picture),
+       cpu_snapshot = std::move(cpu_snapshot),
+       callback = std::move(callback)]() {
+        sk_sp<SkData> data;
+        switch (type) {
+          case ScreenshotType::SkiaPicture:
+            data = SerializePicture(picture);
+            break;
+          case ScreenshotType::UncompressedImage:
+            data = EncodeRasterImage(cpu_snapshot, false);
+            break;
+          case ScreenshotType::CompressedImage:
+            data = EncodeRasterImage(cpu_snapshot, true);
+            break;
+        }
+
+        if (data == nullptr) {
+          FML_LOG(ERROR) << "Screenshot data was null.";
+          callback({});
+          return;
+        }
+
+        if (base64_encode) {
+          data = Base64EncodeData(data);
+        }
+
+        callback(Rasterizer::Screenshot{data, frame_size});
+      });
+}
+
+void Rasterizer::DrawWarmUpPictures(
+    std::shared_ptr<AssetManager> asset_manager) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  TRACE_EVENT0("flutter", "Rasterizer::DrawWarmUpPictures");
+
+  warm_up_timings_.clear();
+
+  if (asset_manager == nullptr) {
+    return;
+  }
+
+  auto manifest = asset_manager->GetAsMapping(kWarmUpManifestName);
+  if (manifest == nullptr) {
+    FML_LOG(INFO) << "No warm-up manifest found. Skipping SkP warm-up.";
+    return;
+  }
+
+  rapidjson::Document json_doc;
+  rapidjson::ParseResult parse_result =
+      json_doc.Parse(reinterpret_cast<const char*>(manifest->GetMapping()),
+                     manifest->GetSize());
+  if (parse_result != rapidjson::ParseErrorCode::kParseErrorNone ||
+      !json_doc.HasMember("skps") || !json_doc["skps"].IsArray()) {
+    FML_LOG(ERROR) << "Failed to parse warm-up manifest: "
+                   << kWarmUpManifestName;
+    return;
+  }
+
+  GrContext* surface_context = surface_ ? surface_->GetContext() : nullptr;
+
+  for (const auto& entry : json_doc["skps"].GetArray()) {
+    if (!entry.IsString()) {
+      continue;
+    }
+    const std::string skp_name = entry.GetString();
+    auto mapping = asset_manager->GetAsMapping(skp_name);
+    if (mapping == nullptr) {
+      FML_LOG(ERROR) << "Could not find warm-up recording: " << skp_name;
+      continue;
+    }
+
+    auto data = SkData::MakeWithCopy(mapping->GetMapping(), mapping->GetSize());
+    auto picture = SkPicture::MakeFromData(data.get());
+    if (picture == nullptr) {
+      FML_LOG(ERROR) << "Could not deserialize warm-up recording: " << skp_name;
+      continue;
+    }
+
+    TRACE_EVENT1("flutter", "DrawWarmUpPicture", "name", skp_name.c_str());
+    const auto start_time = fml::TimePoint::Now();
+
+    const SkRect cull_rect = picture->cullRect();
+    const auto size =
+        SkISize::Make(std::max(1, SkScalarCeilToInt(cull_rect.width())),
+                      std::max(1, SkScalarCeilToInt(cull_rect.height())));
+    auto snapshot_surface = CreateSnapshotSurface(surface_context, size);
+    if (snapshot_surface == nullptr) {
+      FML_LOG(ERROR) << "Could not create warm-up surface for: " << skp_name;
+      continue;
+    }
+
+    auto* canvas = snapshot_surface->getCanvas();
+    canvas->clear(SK_ColorTRANSPARENT);
+    canvas->drawPicture(picture);
+    canvas->flush();
+
+    warm_up_timings_.push_back({skp_name, fml::TimePoint::Now() - start_time});
+  }
+
+  FML_LOG(INFO) << "Replayed " << warm_up_timings_.size()
+                << " warm-up recording(s).";
+}
+
+const std::vector<Rasterizer::WarmUpTiming>& Rasterizer::GetWarmUpTimings()
+    const {
+  return warm_up_timings_;
+}
+
 void Rasterizer::SetNextFrameCallback(const fml::closure& callback) {
   next_frame_callback_ = callback;
 }
@@ -631,6 +1048,23 @@ void Rasterizer::SetResourceCacheMaxBytes(size_t max_bytes, bool from_user) {
   }
 }
 
+void Rasterizer::ApplyGovernedResourceCacheBytes(size_t max_bytes) {
+  if (user_override_resource_cache_bytes_) {
+    // An explicit budget from user code over the flutter/skia channel wins
+    // over the governor's share.
+    return;
+  }
+  if (!surface_) {
+    return;
+  }
+  GrContext* context = surface_->GetContext();
+  if (context) {
+    int max_resources;
+    context->getResourceCacheLimits(&max_resources, nullptr);
+    context->setResourceCacheLimits(max_resources, max_bytes);
+  }
+}
+
 std::optional<size_t> Rasterizer::GetResourceCacheMaxBytes() const {
   if (!surface_) {
     return std::nullopt;
@@ -5,9 +5,13 @@
 #ifndef SHELL_COMMON_RASTERIZER_H_
 #define SHELL_COMMON_RASTERIZER_H_
 
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
+#include "flutter/assets/asset_manager.h"
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/flow/compositor_context.h"
@@ -192,6 +196,19 @@ class Rasterizer final : public SnapshotDelegate {
   ///
   void NotifyLowMemoryWarning() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Notifies the rasterizer of moderate memory pressure: only
+  ///             scratch GPU resources, which no live image references, are
+  ///             purged, so the next frame renders at full speed.
+  ///
+  void NotifyModerateMemoryPressure() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The bytes currently held by the Skia resource cache of the
+  ///             onscreen rendering context, if a surface is present.
+  ///
+  std::optional<size_t> GetResourceCacheBytes() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Gets a weak pointer to the rasterizer. The rasterizer may only
   ///             be accessed on the GPU task runner.
@@ -274,6 +291,21 @@ class Rasterizer final : public SnapshotDelegate {
   ///
   void Draw(fml::RefPtr<Pipeline<flutter::LayerTree>> pipeline);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Speculatively acquires the frame for an upcoming draw while
+  ///             the UI thread is still building the layer tree, overlapping
+  ///             frame acquisition (context switches and render target setup)
+  ///             with the build. Only surfaces that opt in via
+  ///             `Surface::SupportsSpeculativeFrameAcquisition` participate.
+  ///             The prepared frame is consumed by the next draw when the
+  ///             frame size matches and discarded otherwise, so a wrong
+  ///             guess costs nothing beyond the wasted acquisition. Must be
+  ///             called on the raster task runner.
+  ///
+  /// @param[in]  frame_size  The expected physical size of the next frame.
+  ///
+  void PrepareFrame(SkISize frame_size);
+
   //----------------------------------------------------------------------------
   /// @brief      The type of the screenshot to obtain of the previously
   ///             rendered layer tree.
@@ -365,6 +397,71 @@ class Rasterizer final : public SnapshotDelegate {
   ///
   Screenshot ScreenshotLastLayerTree(ScreenshotType type, bool base64_encode);
 
+  //----------------------------------------------------------------------------
+  /// The callback invoked with the result of an asynchronous screenshot
+  /// capture. Invoked on the IO task runner with an empty screenshot if the
+  /// capture failed.
+  ///
+  using ScreenshotCallback = std::function<void(Screenshot screenshot)>;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Variant of |ScreenshotLastLayerTree| that only performs the
+  ///             rasterization of the last layer tree on the GPU task runner.
+  ///             The expensive encoding steps (Skia picture serialization, PNG
+  ///             compression and Base 64 encoding) are performed on the IO
+  ///             task runner so that frame production is not blocked while
+  ///             they run. Must be invoked on the GPU task runner.
+  ///
+  /// @param[in]  type           The type of the screenshot to gather.
+  /// @param[in]  base64_encode  Whether Base 64 encoding must be applied to
+  ///                            the data after a screenshot has been captured.
+  /// @param[in]  callback       Invoked on the IO task runner with the
+  ///                            captured screenshot.
+  ///
+  void ScreenshotLastLayerTreeAsync(ScreenshotType type,
+                                    bool base64_encode,
+                                    ScreenshotCallback callback);
+
+  //----------------------------------------------------------------------------
+  /// The asset listing the SkPicture recordings replayed by
+  /// |DrawWarmUpPictures|. The manifest is a JSON object whose "skps" member
+  /// is an array of asset names of serialized pictures.
+  ///
+  static constexpr char kWarmUpManifestName[] = "io.flutter.warmup.json";
+
+  //----------------------------------------------------------------------------
+  /// The wall time spent replaying one warm-up recording.
+  ///
+  struct WarmUpTiming {
+    std::string skp_name;
+    fml::TimeDelta duration;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Replays the bundled warm-up recordings listed in the
+  ///             |kWarmUpManifestName| asset into an offscreen surface so that
+  ///             the shaders they reference are compiled (and stored in the
+  ///             persistent cache) before the first real frame needs them.
+  ///             Meant to run on the GPU task runner right after surface
+  ///             setup, while the platform is still showing its splash
+  ///             screen. Recordings cannot seed the `RasterCache` because its
+  ///             keys are picture identifiers generated at runtime.
+  ///
+  ///             Timings for each recording are retained and surfaced through
+  ///             the service protocol.
+  ///
+  /// @param[in]  asset_manager  The asset manager holding the manifest and
+  ///                            the recordings. May be null, in which case
+  ///                            the warm-up is skipped.
+  ///
+  void DrawWarmUpPictures(std::shared_ptr<AssetManager> asset_manager);
+
+  //----------------------------------------------------------------------------
+  /// @brief      The timings gathered by the last |DrawWarmUpPictures| run.
+  ///             Only safe to access on the GPU task runner.
+  ///
+  const std::vector<WarmUpTiming>& GetWarmUpTimings() const;
+
   //----------------------------------------------------------------------------
   /// @brief      Sets a callback that will be executed when the next layer tree
   ///             in rendered to the on-screen surface. This is used by
@@ -430,6 +527,27 @@ class Rasterizer final : public SnapshotDelegate {
   ///
   std::optional<size_t> GetResourceCacheMaxBytes() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Computes the placement of each snapshot request within the
+  ///             shared atlas used by batched raster snapshots. Requests are
+  ///             shelf packed in submission order with a one pixel gutter so
+  ///             slices never sample a neighbor. Exposed for testing.
+  ///
+  /// @param[in]  sizes          The dimensions of each request.
+  /// @param[in]  max_atlas_dim  The widest shelf the packer may lay out. An
+  ///                            entry wider than this gets its own shelf and
+  ///                            the resulting atlas overflows the limit; the
+  ///                            caller is expected to check the atlas size
+  ///                            and fall back to unbatched snapshots.
+  /// @param[out] atlas_size     The dimensions of the packed atlas.
+  ///
+  /// @return     The atlas rect of each request, by index.
+  ///
+  static std::vector<SkIRect> ComputeSnapshotAtlasLayout(
+      const std::vector<SkISize>& sizes,
+      int32_t max_atlas_dim,
+      SkISize* atlas_size);
+
  private:
   Delegate& delegate_;
   TaskRunners task_runners_;
@@ -442,16 +560,31 @@ class Rasterizer final : public SnapshotDelegate {
   // thread configuration. This will be inserted to the front of the pipeline.
   std::unique_ptr<flutter::LayerTree> resubmitted_layer_tree_;
   fml::closure next_frame_callback_;
+  std::vector<WarmUpTiming> warm_up_timings_;
+  // A frame acquired ahead of the draw by |PrepareFrame|, valid only for
+  // draws whose layer tree matches |prepared_frame_size_|.
+  std::unique_ptr<SurfaceFrame> prepared_frame_;
+  SkISize prepared_frame_size_ = SkISize::MakeEmpty();
   bool user_override_resource_cache_bytes_;
   std::optional<size_t> max_cache_bytes_;
   fml::TaskRunnerAffineWeakPtrFactory<Rasterizer> weak_factory_;
   fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger_;
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
 
+  // The submit-to-present latency of the most recently presented frame in
+  // microseconds, or -1 when no backend has reported presentation yet.
+  // Written by present handlers from arbitrary threads; shared so handlers
+  // that outlive the rasterizer stay safe.
+  std::shared_ptr<std::atomic<int64_t>> last_present_latency_micros_;
+
   // |SnapshotDelegate|
   sk_sp<SkImage> MakeRasterSnapshot(sk_sp<SkPicture> picture,
                                     SkISize picture_size) override;
 
+  // |SnapshotDelegate|
+  std::vector<sk_sp<SkImage>> MakeRasterSnapshots(
+      std::vector<PictureSnapshotRequest> requests) override;
+
   // |SnapshotDelegate|
   sk_sp<SkImage> ConvertToRasterImage(sk_sp<SkImage> image) override;
 
@@ -461,10 +594,18 @@ class Rasterizer final : public SnapshotDelegate {
 
   RasterStatus DoDraw(std::unique_ptr<flutter::LayerTree> layer_tree);
 
-  RasterStatus DrawToSurface(flutter::LayerTree& layer_tree);
+  RasterStatus DrawToSurface(flutter::LayerTree& layer_tree,
+                             const SkRect& damage);
 
   void FireNextFrameCallbackIfPresent();
 
+  // Applies a share of the process-wide budget handed out by the
+  // `GpuResourceCacheGovernor`. Unlike `SetResourceCacheMaxBytes`, this does
+  // not update `max_cache_bytes_`, so the platform's own preference survives
+  // surface re-acquisition and the governor re-applies on top of it. Budgets
+  // set explicitly by user code still win.
+  void ApplyGovernedResourceCacheBytes(size_t max_bytes);
+
   FML_DISALLOW_COPY_AND_ASSIGN(Rasterizer);
 };
 
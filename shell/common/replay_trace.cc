@@ -0,0 +1,124 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/replay_trace.h"
+
+#include <cstring>
+
+namespace flutter {
+
+namespace {
+
+constexpr uint32_t kReplayTraceMagic = 0x52545246;  // 'FRTR' little-endian.
+constexpr uint32_t kReplayTraceVersion = 1;
+
+template <typename T>
+void Append(std::vector<uint8_t>& buffer, const T& value) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+// Copies a T out of the mapping at the cursor, advancing it. Returns false
+// on truncation.
+template <typename T>
+bool Read(const fml::Mapping& mapping, size_t& cursor, T* value) {
+  if (mapping.GetSize() - cursor < sizeof(T)) {
+    return false;
+  }
+  ::memcpy(value, mapping.GetMapping() + cursor, sizeof(T));
+  cursor += sizeof(T);
+  return true;
+}
+
+bool ReadBytes(const fml::Mapping& mapping,
+               size_t& cursor,
+               size_t length,
+               std::vector<uint8_t>* bytes) {
+  if (mapping.GetSize() - cursor < length) {
+    return false;
+  }
+  bytes->assign(mapping.GetMapping() + cursor,
+                mapping.GetMapping() + cursor + length);
+  cursor += length;
+  return true;
+}
+
+}  // namespace
+
+ReplayTrace::ReplayTrace() = default;
+
+ReplayTrace::~ReplayTrace() = default;
+
+ReplayTrace::ReplayTrace(ReplayTrace&&) = default;
+
+ReplayTrace& ReplayTrace::operator=(ReplayTrace&&) = default;
+
+void ReplayTrace::AddEvent(Event event) {
+  events_.emplace_back(std::move(event));
+}
+
+const std::vector<ReplayTrace::Event>& ReplayTrace::GetEvents() const {
+  return events_;
+}
+
+std::vector<uint8_t> ReplayTrace::Serialize() const {
+  std::vector<uint8_t> buffer;
+  Append(buffer, kReplayTraceMagic);
+  Append(buffer, kReplayTraceVersion);
+  Append(buffer, static_cast<uint64_t>(events_.size()));
+  for (const auto& event : events_) {
+    Append(buffer, static_cast<uint32_t>(event.kind));
+    Append(buffer, event.timestamp_micros);
+    Append(buffer, static_cast<uint64_t>(event.channel.size()));
+    buffer.insert(buffer.end(), event.channel.begin(), event.channel.end());
+    Append(buffer, static_cast<uint64_t>(event.data.size()));
+    buffer.insert(buffer.end(), event.data.begin(), event.data.end());
+  }
+  return buffer;
+}
+
+std::optional<ReplayTrace> ReplayTrace::Deserialize(
+    const fml::Mapping& mapping) {
+  size_t cursor = 0;
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  uint64_t event_count = 0;
+  if (!Read(mapping, cursor, &magic) || magic != kReplayTraceMagic ||
+      !Read(mapping, cursor, &version) || version != kReplayTraceVersion ||
+      !Read(mapping, cursor, &event_count)) {
+    return std::nullopt;
+  }
+
+  ReplayTrace trace;
+  for (uint64_t i = 0; i < event_count; i++) {
+    Event event;
+    uint32_t kind = 0;
+    uint64_t channel_length = 0;
+    uint64_t data_length = 0;
+    if (!Read(mapping, cursor, &kind) ||
+        !Read(mapping, cursor, &event.timestamp_micros) ||
+        !Read(mapping, cursor, &channel_length)) {
+      return std::nullopt;
+    }
+    std::vector<uint8_t> channel_bytes;
+    if (!ReadBytes(mapping, cursor, channel_length, &channel_bytes) ||
+        !Read(mapping, cursor, &data_length) ||
+        !ReadBytes(mapping, cursor, data_length, &event.data)) {
+      return std::nullopt;
+    }
+    switch (kind) {
+      case static_cast<uint32_t>(EventKind::kPointerPacket):
+      case static_cast<uint32_t>(EventKind::kPlatformMessage):
+        event.kind = static_cast<EventKind>(kind);
+        break;
+      default:
+        return std::nullopt;
+    }
+    event.channel.assign(channel_bytes.begin(), channel_bytes.end());
+    trace.AddEvent(std::move(event));
+  }
+  return trace;
+}
+
+}  // namespace flutter
@@ -0,0 +1,84 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_REPLAY_TRACE_H_
+#define FLUTTER_SHELL_COMMON_REPLAY_TRACE_H_
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A recorded stream of frame inputs - pointer packets and
+///             platform messages - captured from a live session so the
+///             replay benchmark harness can feed them back through a real
+///             |Shell|.
+///
+///             The serialized form is a small binary container: the "FRTR"
+///             magic, a uint32_t format version, a uint64_t event count and
+///             the events in capture order. Integers are stored in host
+///             byte order; traces are captured and replayed on the same
+///             class of machine.
+///
+/// @see        `shell_replay_benchmarks.cc`
+///
+class ReplayTrace {
+ public:
+  enum class EventKind : uint32_t {
+    kPointerPacket = 1,
+    kPlatformMessage = 2,
+  };
+
+  /// One captured input. Pointer packet events carry the raw |PointerData|
+  /// buffer handed to |PlatformView::DispatchPointerDataPacket|; platform
+  /// message events carry the channel name and the message bytes.
+  struct Event {
+    EventKind kind = EventKind::kPointerPacket;
+    /// Capture time relative to the start of the session. Replay at max
+    /// speed ignores this, but it is retained so paced replay can be added
+    /// without a format revision.
+    int64_t timestamp_micros = 0;
+    /// Only set for |kPlatformMessage| events.
+    std::string channel;
+    std::vector<uint8_t> data;
+  };
+
+  ReplayTrace();
+
+  ~ReplayTrace();
+
+  ReplayTrace(ReplayTrace&&);
+
+  ReplayTrace& operator=(ReplayTrace&&);
+
+  void AddEvent(Event event);
+
+  const std::vector<Event>& GetEvents() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Serializes the trace into the binary container format.
+  ///
+  std::vector<uint8_t> Serialize() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Parses a serialized trace. Returns std::nullopt when the
+  ///             mapping is not a trace, is of an unknown version, or is
+  ///             truncated.
+  ///
+  static std::optional<ReplayTrace> Deserialize(const fml::Mapping& mapping);
+
+ private:
+  std::vector<Event> events_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ReplayTrace);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_REPLAY_TRACE_H_
@@ -0,0 +1,64 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/replay_trace.h"
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+static ReplayTrace MakeTestTrace() {
+  ReplayTrace trace;
+
+  ReplayTrace::Event pointer_event;
+  pointer_event.kind = ReplayTrace::EventKind::kPointerPacket;
+  pointer_event.timestamp_micros = 16667;
+  pointer_event.data = {1, 2, 3, 4};
+  trace.AddEvent(std::move(pointer_event));
+
+  ReplayTrace::Event message_event;
+  message_event.kind = ReplayTrace::EventKind::kPlatformMessage;
+  message_event.timestamp_micros = 33333;
+  message_event.channel = "flutter/lifecycle";
+  message_event.data = {'r', 'e', 's', 'u', 'm', 'e', 'd'};
+  trace.AddEvent(std::move(message_event));
+
+  return trace;
+}
+
+TEST(ReplayTraceTest, RoundTripsThroughSerialization) {
+  const auto trace = MakeTestTrace();
+  const auto buffer = trace.Serialize();
+
+  auto parsed = ReplayTrace::Deserialize(
+      fml::DataMapping(std::vector<uint8_t>(buffer)));
+  ASSERT_TRUE(parsed.has_value());
+  ASSERT_EQ(parsed->GetEvents().size(), 2u);
+
+  const auto& pointer_event = parsed->GetEvents()[0];
+  ASSERT_EQ(pointer_event.kind, ReplayTrace::EventKind::kPointerPacket);
+  ASSERT_EQ(pointer_event.timestamp_micros, 16667);
+  ASSERT_EQ(pointer_event.channel, "");
+  ASSERT_EQ(pointer_event.data, (std::vector<uint8_t>{1, 2, 3, 4}));
+
+  const auto& message_event = parsed->GetEvents()[1];
+  ASSERT_EQ(message_event.kind, ReplayTrace::EventKind::kPlatformMessage);
+  ASSERT_EQ(message_event.channel, "flutter/lifecycle");
+  ASSERT_EQ(message_event.data.size(), 7u);
+}
+
+TEST(ReplayTraceTest, RejectsGarbageAndTruncation) {
+  ASSERT_FALSE(ReplayTrace::Deserialize(
+                   fml::DataMapping(std::vector<uint8_t>{'n', 'o', 'p', 'e'}))
+                   .has_value());
+
+  auto buffer = MakeTestTrace().Serialize();
+  buffer.resize(buffer.size() / 2);
+  ASSERT_FALSE(ReplayTrace::Deserialize(fml::DataMapping(std::move(buffer)))
+                   .has_value());
+}
+
+}  // namespace testing
+}  // namespace flutter
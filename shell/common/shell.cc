@@ -5,11 +5,13 @@
 #define RAPIDJSON_HAS_STDSTRING 1
 #include "flutter/shell/common/shell.h"
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <vector>
 
 #include "flutter/assets/directory_asset_bundle.h"
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/icu_util.h"
 #include "flutter/fml/log_settings.h"
@@ -19,6 +21,7 @@
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/fml/unique_fd.h"
+#include "flutter/lib/ui/window/channel_interner.h"
 #include "flutter/runtime/dart_vm.h"
 #include "flutter/shell/common/engine.h"
 #include "flutter/shell/common/persistent_cache.h"
@@ -27,6 +30,7 @@
 #include "flutter/shell/common/vsync_waiter.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
+#include "third_party/dart/runtime/include/dart_native_api.h"
 #include "third_party/dart/runtime/include/dart_tools_api.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/skia/include/utils/SkBase64.h"
@@ -34,26 +38,32 @@
 
 namespace flutter {
 
-constexpr char kSkiaChannel[] = "flutter/skia";
+// Inbound skia channel traffic is matched by its interned id; see
+// |ChannelInterner|.
 constexpr char kSystemChannel[] = "flutter/system";
 constexpr char kTypeKey[] = "type";
 constexpr char kFontChange[] = "fontsChange";
 
 std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
-    DartVMRef vm,
+    std::future<DartVMRef> vm_future,
     TaskRunners task_runners,
     const WindowData window_data,
     Settings settings,
-    fml::RefPtr<const DartSnapshot> isolate_snapshot,
+    std::future<fml::RefPtr<const DartSnapshot>> isolate_snapshot_future,
     const Shell::CreateCallback<PlatformView>& on_create_platform_view,
-    const Shell::CreateCallback<Rasterizer>& on_create_rasterizer) {
+    const Shell::CreateCallback<Rasterizer>& on_create_rasterizer,
+    const Shell* spawned_from) {
   if (!task_runners.IsValid()) {
     FML_LOG(ERROR) << "Task runners to run the shell were invalid.";
     return nullptr;
   }
 
-  auto shell =
-      std::unique_ptr<Shell>(new Shell(std::move(vm), task_runners, settings));
+  const auto setup_start = fml::TimePoint::Now();
+
+  // The VM may still be initializing on the UI task runner at this point. The
+  // shell is created without it so that the GPU, platform and IO subsystems
+  // (none of which need the VM) can boot concurrently with VM startup.
+  auto shell = std::unique_ptr<Shell>(new Shell(task_runners, settings));
 
   // Create the rasterizer on the raster thread.
   std::promise<std::unique_ptr<Rasterizer>> rasterizer_promise;
@@ -64,16 +74,35 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
       task_runners.GetRasterTaskRunner(), [&rasterizer_promise,  //
                                            &snapshot_delegate_promise,
                                            on_create_rasterizer,  //
-                                           shell = shell.get()    //
+                                           shell = shell.get(),   //
+                                           spawned_from           //
   ]() {
         TRACE_EVENT0("flutter", "ShellSetupGPUSubsystem");
         std::unique_ptr<Rasterizer> rasterizer(on_create_rasterizer(*shell));
+        if (shell->GetSettings().enable_parallel_rasterization) {
+          rasterizer->compositor_context()->EnableParallelRaster();
+        }
+        if (spawned_from) {
+          // The spawning shell rasters on this very thread, so its cache can
+          // be adopted directly. Any persistent store and byte budget the
+          // parent configured ride along with the shared cache.
+          rasterizer->compositor_context()->ShareRasterCache(
+              spawned_from->rasterizer_->compositor_context()
+                  ->shared_raster_cache());
+        } else if (shell->GetSettings().enable_persistent_raster_cache) {
+          rasterizer->compositor_context()->raster_cache().SetPersistentStore(
+              std::make_shared<PersistentRasterCacheStore>());
+        }
         snapshot_delegate_promise.set_value(rasterizer->GetSnapshotDelegate());
         rasterizer_promise.set_value(std::move(rasterizer));
       });
 
   // Create the platform view on the platform thread (this thread).
-  auto platform_view = on_create_platform_view(*shell.get());
+  std::unique_ptr<PlatformView> platform_view;
+  {
+    TRACE_EVENT0("flutter", "ShellSetupPlatformView");
+    platform_view = on_create_platform_view(*shell.get());
+  }
   if (!platform_view || !platform_view->GetWeakPtr()) {
     return nullptr;
   }
@@ -89,7 +118,7 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   // first because it has state that the other subsystems depend on. It must
   // first be booted and the necessary references obtained to initialize the
   // other subsystems.
-  std::promise<std::unique_ptr<ShellIOManager>> io_manager_promise;
+  std::promise<std::shared_ptr<ShellIOManager>> io_manager_promise;
   auto io_manager_future = io_manager_promise.get_future();
   std::promise<fml::WeakPtr<ShellIOManager>> weak_io_manager_promise;
   auto weak_io_manager_future = weak_io_manager_promise.get_future();
@@ -105,14 +134,27 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   // https://github.com/flutter/flutter/issues/42948
   fml::TaskRunner::RunNowOrPostTask(
       io_task_runner,
-      [&io_manager_promise,                                               //
-       &weak_io_manager_promise,                                          //
-       &unref_queue_promise,                                              //
-       platform_view = platform_view->GetWeakPtr(),                       //
-       io_task_runner,                                                    //
-       is_backgrounded_sync_switch = shell->GetIsGpuDisabledSyncSwitch()  //
-  ]() {
+      [&io_manager_promise,                                                //
+       &weak_io_manager_promise,                                           //
+       &unref_queue_promise,                                               //
+       platform_view = platform_view->GetWeakPtr(),                        //
+       io_task_runner,                                                     //
+       is_backgrounded_sync_switch = shell->GetIsGpuDisabledSyncSwitch(),  //
+       shared_io_manager = spawned_from ? spawned_from->io_manager_
+                                        : std::shared_ptr<ShellIOManager>()
+  ]() mutable {
         TRACE_EVENT0("flutter", "ShellSetupIOSubsystem");
+        if (shared_io_manager) {
+          // A spawned shell shares its parent's IO manager: one resource
+          // GrContext, Skia unref queue and set of decoded image caches
+          // serve every view. The platform view's resource context is left
+          // untouched; the shared manager already owns one.
+          weak_io_manager_promise.set_value(shared_io_manager->GetWeakPtr());
+          unref_queue_promise.set_value(
+              shared_io_manager->GetSkiaUnrefQueue());
+          io_manager_promise.set_value(std::move(shared_io_manager));
+          return;
+        }
         auto io_manager = std::make_unique<ShellIOManager>(
             platform_view.getUnsafe()->CreateResourceContext(),
             is_backgrounded_sync_switch, io_task_runner);
@@ -125,41 +167,63 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
   // platform_view set until Shell::Setup is called later.
   auto dispatcher_maker = platform_view->GetDispatcherMaker();
 
+  // Join the VM setup phase. All subsystems that can make progress without the
+  // VM have been kicked off by now; the engine (created next) is the first one
+  // that needs it.
+  {
+    TRACE_EVENT0("flutter", "ShellWaitForVM");
+    shell->vm_ = vm_future.get();
+  }
+  if (!shell->vm_) {
+    FML_LOG(ERROR) << "Must be able to initialize the VM.";
+    return nullptr;
+  }
+
   // Create the engine on the UI thread.
   std::promise<std::unique_ptr<Engine>> engine_promise;
   auto engine_future = engine_promise.get_future();
   fml::TaskRunner::RunNowOrPostTask(
       shell->GetTaskRunners().GetUITaskRunner(),
-      fml::MakeCopyable([&engine_promise,                                 //
-                         shell = shell.get(),                             //
-                         &dispatcher_maker,                               //
-                         &window_data,                                    //
-                         isolate_snapshot = std::move(isolate_snapshot),  //
-                         vsync_waiter = std::move(vsync_waiter),          //
-                         &weak_io_manager_future,                         //
-                         &snapshot_delegate_future,                       //
-                         &unref_queue_future                              //
+      fml::MakeCopyable([&engine_promise,        //
+                         shell = shell.get(),    //
+                         &dispatcher_maker,      //
+                         &window_data,           //
+                         isolate_snapshot_future =
+                             std::move(isolate_snapshot_future),  //
+                         vsync_waiter = std::move(vsync_waiter),  //
+                         &weak_io_manager_future,                 //
+                         &snapshot_delegate_future,               //
+                         &unref_queue_future                      //
   ]() mutable {
         TRACE_EVENT0("flutter", "ShellSetupUISubsystem");
         const auto& task_runners = shell->GetTaskRunners();
 
         // The animator is owned by the UI thread but it gets its vsync pulses
         // from the platform.
-        auto animator = std::make_unique<Animator>(*shell, task_runners,
-                                                   std::move(vsync_waiter));
+        const auto& settings = shell->GetSettings();
+        vsync_waiter->SetPredictiveSchedulingEnabled(
+            settings.predictive_vsync_wake);
+        auto animator = std::make_unique<Animator>(
+            *shell, task_runners, std::move(vsync_waiter),
+            settings.frame_pipeline_depth,
+            settings.frame_pipeline_latest_wins
+                ? PipelineConsumeMode::kLatestWins
+                : PipelineConsumeMode::kOldestFirst);
+        animator->SetFramePacingGovernorEnabled(
+            settings.frame_pacing_governor);
 
         engine_promise.set_value(std::make_unique<Engine>(
-            *shell,                         //
-            dispatcher_maker,               //
-            *shell->GetDartVM(),            //
-            std::move(isolate_snapshot),    //
-            task_runners,                   //
-            window_data,                    //
-            shell->GetSettings(),           //
-            std::move(animator),            //
-            weak_io_manager_future.get(),   //
-            unref_queue_future.get(),       //
-            snapshot_delegate_future.get()  //
+            *shell,                          //
+            dispatcher_maker,                //
+            *shell->GetDartVM(),             //
+            isolate_snapshot_future.get(),   //
+            task_runners,                    //
+            window_data,                     //
+            shell->GetSettings(),            //
+            std::move(animator),             //
+            weak_io_manager_future.get(),    //
+            unref_queue_future.get(),        //
+            snapshot_delegate_future.get()   //
             ));
       }));
 
@@ -171,6 +235,11 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
     return nullptr;
   }
 
+  // Report how long shell setup took alongside the "FlutterEngineMainEnter"
+  // event derived from Settings::engine_start_timestamp.
+  fml::tracing::TraceEventAsyncComplete("flutter", "ShellSetup", setup_start,
+                                        fml::TimePoint::Now());
+
   return shell;
 }
 
@@ -226,7 +295,11 @@ static void PerformInitializationTasks(Settings& settings) {
 
     if (settings.icu_initialization_required) {
       if (settings.icu_data_path.size() != 0) {
-        fml::icu::InitializeICU(settings.icu_data_path);
+        // Only map the data file here; the table registration is warmed up
+        // on a concurrent worker once the VM is up and joined at first text
+        // use, keeping roughly 10ms of udata_setCommonData work off the
+        // launch critical path.
+        fml::icu::InitializeICULazily(settings.icu_data_path);
       } else if (settings.icu_mapper) {
         fml::icu::InitializeICUFromMapping(settings.icu_mapper());
       } else {
@@ -257,21 +330,49 @@ std::unique_ptr<Shell> Shell::Create(
     Shell::CreateCallback<Rasterizer> on_create_rasterizer) {
   PerformInitializationTasks(settings);
   PersistentCache::SetCacheSkSL(settings.cache_sksl);
+  PersistentCache::SetCacheProgramBinaries(settings.cache_gl_program_binaries);
 
   TRACE_EVENT0("flutter", "Shell::Create");
 
-  auto vm = DartVMRef::Create(settings);
-  FML_CHECK(vm) << "Must be able to initialize the VM.";
+  if (!task_runners.IsValid()) {
+    return nullptr;
+  }
 
-  auto vm_data = vm->GetVMData();
+  // Kick off VM initialization (including loading the isolate snapshot) on
+  // the UI task runner so it overlaps with platform view, rasterizer and IO
+  // manager setup on their respective threads. The promises are owned by the
+  // task; the consuming futures are joined in |CreateShellOnPlatformThread|.
+  std::promise<DartVMRef> vm_promise;
+  auto vm_future = vm_promise.get_future();
+  std::promise<fml::RefPtr<const DartSnapshot>> isolate_snapshot_promise;
+  auto isolate_snapshot_future = isolate_snapshot_promise.get_future();
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners.GetUITaskRunner(),
+      fml::MakeCopyable([vm_promise = std::move(vm_promise),  //
+                         isolate_snapshot_promise =
+                             std::move(isolate_snapshot_promise),  //
+                         settings                                  //
+  ]() mutable {
+        TRACE_EVENT0("flutter", "ShellSetupVMSubsystem");
+        auto vm = DartVMRef::Create(settings);
+        FML_CHECK(vm) << "Must be able to initialize the VM.";
+        // Warm up any ICU initialization deferred by
+        // |PerformInitializationTasks| so that first text layout does not
+        // pay for it either.
+        vm->GetConcurrentWorkerTaskRunner()->PostTask(
+            []() { fml::icu::EnsureICUInitialized(); });
+        isolate_snapshot_promise.set_value(
+            vm->GetVMData()->GetIsolateSnapshot());
+        vm_promise.set_value(std::move(vm));
+      }));
 
-  return Shell::Create(std::move(task_runners),        //
-                       std::move(window_data),         //
-                       std::move(settings),            //
-                       vm_data->GetIsolateSnapshot(),  // isolate snapshot
-                       on_create_platform_view,        //
-                       on_create_rasterizer,           //
-                       std::move(vm)                   //
+  return Shell::Create(std::move(task_runners),             //
+                       std::move(window_data),              //
+                       std::move(settings),                 //
+                       std::move(vm_future),                //
+                       std::move(isolate_snapshot_future),  //
+                       on_create_platform_view,             //
+                       on_create_rasterizer                 //
   );
 }
 
@@ -285,9 +386,76 @@ std::unique_ptr<Shell> Shell::Create(
     DartVMRef vm) {
   PerformInitializationTasks(settings);
   PersistentCache::SetCacheSkSL(settings.cache_sksl);
+  PersistentCache::SetCacheProgramBinaries(settings.cache_gl_program_binaries);
 
   TRACE_EVENT0("flutter", "Shell::CreateWithSnapshots");
 
+  // The VM is already running here, so the deferred ICU warm-up can start
+  // right away.
+  vm->GetConcurrentWorkerTaskRunner()->PostTask(
+      []() { fml::icu::EnsureICUInitialized(); });
+
+  // The VM and snapshot are already available; wrap them in ready futures so
+  // the rest of startup takes the same concurrent path.
+  std::promise<DartVMRef> vm_promise;
+  vm_promise.set_value(std::move(vm));
+  std::promise<fml::RefPtr<const DartSnapshot>> isolate_snapshot_promise;
+  isolate_snapshot_promise.set_value(std::move(isolate_snapshot));
+
+  return Shell::Create(std::move(task_runners),                //
+                       std::move(window_data),                 //
+                       std::move(settings),                    //
+                       vm_promise.get_future(),                //
+                       isolate_snapshot_promise.get_future(),  //
+                       on_create_platform_view,                //
+                       on_create_rasterizer                    //
+  );
+}
+
+std::unique_ptr<Shell> Shell::Spawn(
+    const CreateCallback<PlatformView>& on_create_platform_view,
+    const CreateCallback<Rasterizer>& on_create_rasterizer) const {
+  FML_DCHECK(is_setup_);
+  if (!is_setup_ || !on_create_platform_view || !on_create_rasterizer) {
+    return nullptr;
+  }
+
+  TRACE_EVENT0("flutter", "Shell::Spawn");
+
+  // The VM is necessarily running while a set up shell holds its reference,
+  // so this only takes another reference to it instead of booting a second
+  // VM. The isolate snapshot comes from the shared VM data, so the spawned
+  // root isolate maps the same snapshot regions as this shell's.
+  auto vm = DartVMRef::Create(settings_);
+  FML_CHECK(vm) << "Must be able to reference the running VM.";
+
+  std::promise<DartVMRef> vm_promise;
+  std::promise<fml::RefPtr<const DartSnapshot>> isolate_snapshot_promise;
+  isolate_snapshot_promise.set_value(vm->GetVMData()->GetIsolateSnapshot());
+  vm_promise.set_value(std::move(vm));
+
+  // This shell stays alive across the synchronous creation below, which is
+  // all the time the spawned shell needs to adopt the shared components.
+  return Shell::Create(task_runners_,                          //
+                       WindowData{/* default window data */},  //
+                       settings_,                              //
+                       vm_promise.get_future(),                //
+                       isolate_snapshot_promise.get_future(),  //
+                       on_create_platform_view,                //
+                       on_create_rasterizer,                   //
+                       this                                    //
+  );
+}
+
+std::unique_ptr<Shell> Shell::Create(
+    TaskRunners task_runners,
+    const WindowData window_data,
+    Settings settings,
+    std::future<DartVMRef> vm_future,
+    std::future<fml::RefPtr<const DartSnapshot>> isolate_snapshot_future,
+    const Shell::CreateCallback<PlatformView>& on_create_platform_view,
+    const Shell::CreateCallback<Rasterizer>& on_create_rasterizer,
+    const Shell* spawned_from) {
   if (!task_runners.IsValid() || !on_create_platform_view ||
       !on_create_rasterizer) {
     return nullptr;
@@ -297,23 +465,26 @@ std::unique_ptr<Shell> Shell::Create(
   std::unique_ptr<Shell> shell;
   fml::TaskRunner::RunNowOrPostTask(
       task_runners.GetPlatformTaskRunner(),
-      fml::MakeCopyable([&latch,                                          //
-                         vm = std::move(vm),                              //
-                         &shell,                                          //
-                         task_runners = std::move(task_runners),          //
-                         window_data,                                     //
-                         settings,                                        //
-                         isolate_snapshot = std::move(isolate_snapshot),  //
-                         on_create_platform_view,                         //
-                         on_create_rasterizer                             //
+      fml::MakeCopyable([&latch,                                  //
+                         vm_future = std::move(vm_future),        //
+                         &shell,                                  //
+                         task_runners = std::move(task_runners),  //
+                         window_data,                             //
+                         settings,                                //
+                         isolate_snapshot_future =
+                             std::move(isolate_snapshot_future),  //
+                         on_create_platform_view,                 //
+                         on_create_rasterizer,                    //
+                         spawned_from                             //
   ]() mutable {
-        shell = CreateShellOnPlatformThread(std::move(vm),
-                                            std::move(task_runners),      //
-                                            window_data,                  //
-                                            settings,                     //
-                                            std::move(isolate_snapshot),  //
-                                            on_create_platform_view,      //
-                                            on_create_rasterizer          //
+        shell = CreateShellOnPlatformThread(std::move(vm_future),
+                                            std::move(task_runners),  //
+                                            window_data,              //
+                                            settings,                 //
+                                            std::move(isolate_snapshot_future),
+                                            on_create_platform_view,  //
+                                            on_create_rasterizer,     //
+                                            spawned_from              //
         );
         latch.Signal();
       }));
@@ -321,14 +492,13 @@ std::unique_ptr<Shell> Shell::Create(
   return shell;
 }
 
-Shell::Shell(DartVMRef vm, TaskRunners task_runners, Settings settings)
+Shell::Shell(TaskRunners task_runners, Settings settings)
     : task_runners_(std::move(task_runners)),
       settings_(std::move(settings)),
-      vm_(std::move(vm)),
       is_gpu_disabled_sync_switch_(new fml::SyncSwitch()),
+      frame_statistics_(std::make_unique<FrameStatistics>()),
       weak_factory_(this),
       weak_factory_gpu_(nullptr) {
-  FML_CHECK(vm_) << "Must have access to VM to create a shell.";
   FML_DCHECK(task_runners_.IsValid());
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
 
@@ -374,13 +544,58 @@ Shell::Shell(DartVMRef vm, TaskRunners task_runners, Settings settings)
       task_runners_.GetIOTaskRunner(),
       std::bind(&Shell::OnServiceProtocolGetSkSLs, this, std::placeholders::_1,
                 std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kGetWarmUpTimingsExtensionName] =
+      {task_runners_.GetRasterTaskRunner(),
+       std::bind(&Shell::OnServiceProtocolGetWarmUpTimings, this,
+                 std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kGetMemoryUsageExtensionName] = {
+      task_runners_.GetRasterTaskRunner(),
+      std::bind(&Shell::OnServiceProtocolGetMemoryUsage, this,
+                std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kStartProfilingExtensionName] = {
+      task_runners_.GetPlatformTaskRunner(),
+      std::bind(&Shell::OnServiceProtocolStartProfiling, this,
+                std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_[ServiceProtocol::kStopProfilingExtensionName] = {
+      task_runners_.GetPlatformTaskRunner(),
+      std::bind(&Shell::OnServiceProtocolStopProfiling, this,
+                std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetProfilerSamplesExtensionName] = {
+          task_runners_.GetPlatformTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetProfilerSamples, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetFrameStatisticsExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetFrameStatistics, this,
+                    std::placeholders::_1, std::placeholders::_2)};
+  service_protocol_handlers_
+      [ServiceProtocol::kGetRasterCacheStatsExtensionName] = {
+          task_runners_.GetRasterTaskRunner(),
+          std::bind(&Shell::OnServiceProtocolGetRasterCacheStats, this,
+                    std::placeholders::_1, std::placeholders::_2)};
 }
 
 Shell::~Shell() {
   PersistentCache::GetCacheForProcess()->RemoveWorkerTaskRunner(
       task_runners_.GetIOTaskRunner());
 
-  vm_->GetServiceProtocol()->RemoveHandler(this);
+  // The VM reference is only attached once startup gets far enough to need
+  // it; a shell discarded before that point never registered a handler.
+  if (vm_) {
+    vm_->GetServiceProtocol()->RemoveHandler(this);
+  }
+
+  if (torn_down_asynchronously_) {
+    // The engine, rasterizer and IO manager were already destroyed on their
+    // own threads by |TearDownAsynchronously|. The platform view (the only
+    // remaining sub-component) is collected by the member destructors on this
+    // very thread, so no cross-thread barriers are needed.
+    FML_DCHECK(
+        task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+    return;
+  }
 
   fml::AutoResetWaitableEvent ui_latch, gpu_latch, platform_latch, io_latch;
 
@@ -430,21 +645,148 @@ Shell::~Shell() {
   platform_latch.Wait();
 }
 
+// static
+void Shell::TearDownAsynchronously(std::unique_ptr<Shell> shell,
+                                   const fml::closure& on_teardown_complete) {
+  if (!shell) {
+    if (on_teardown_complete) {
+      on_teardown_complete();
+    }
+    return;
+  }
+
+  FML_DCHECK(shell->task_runners_.GetPlatformTaskRunner()
+                 ->RunsTasksOnCurrentThread());
+
+  TRACE_EVENT0("flutter", "Shell::TearDownAsynchronously");
+
+  auto task_runners = shell->task_runners_;
+
+  // The sub-components are destroyed in the same order as the synchronous
+  // destructor (engine, rasterizer, IO manager and finally the platform
+  // view), but each step is chained onto the next task runner instead of
+  // blocking the platform thread behind a latch. The final hop back to the
+  // platform task runner collects the shell itself along with the platform
+  // view, which may be holding onto platform side counterparts to resources
+  // owned by the subsystems torn down before it.
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners.GetUITaskRunner(),
+      fml::MakeCopyable([shell = std::move(shell), task_runners,
+                         on_teardown_complete]() mutable {
+        shell->engine_.reset();
+        fml::TaskRunner::RunNowOrPostTask(
+            task_runners.GetRasterTaskRunner(),
+            fml::MakeCopyable([shell = std::move(shell), task_runners,
+                               on_teardown_complete]() mutable {
+              shell->rasterizer_.reset();
+              shell->weak_factory_gpu_.reset();
+              fml::TaskRunner::RunNowOrPostTask(
+                  task_runners.GetIOTaskRunner(),
+                  fml::MakeCopyable([shell = std::move(shell), task_runners,
+                                     on_teardown_complete]() mutable {
+                    shell->io_manager_.reset();
+                    if (shell->platform_view_) {
+                      shell->platform_view_->ReleaseResourceContext();
+                    }
+                    fml::TaskRunner::RunNowOrPostTask(
+                        task_runners.GetPlatformTaskRunner(),
+                        fml::MakeCopyable([shell = std::move(shell),
+                                           on_teardown_complete]() mutable {
+                          shell->torn_down_asynchronously_ = true;
+                          shell.reset();
+                          if (on_teardown_complete) {
+                            on_teardown_complete();
+                          }
+                        }));
+                  }));
+            }));
+      }));
+}
+
 void Shell::NotifyLowMemoryWarning() const {
-  // This does not require a current isolate but does require a running VM.
-  // Since a valid shell will not be returned to the embedder without a valid
-  // DartVMRef, we can be certain that this is a safe spot to assume a VM is
-  // running.
-  ::Dart_NotifyLowMemory();
+  NotifyMemoryPressure(MemoryPressureLevel::kCritical);
+}
+
+void Shell::NotifyMemoryPressure(MemoryPressureLevel level) const {
+  TRACE_EVENT0("flutter", "Shell::NotifyMemoryPressure");
+
+  if (level == MemoryPressureLevel::kCritical) {
+    // This does not require a current isolate but does require a running VM.
+    // Since a valid shell will not be returned to the embedder without a valid
+    // DartVMRef, we can be certain that this is a safe spot to assume a VM is
+    // running.
+    ::Dart_NotifyLowMemory();
+
+    // A VM that is only warm for the sake of a keep-alive window is better
+    // collected than kept under critical pressure. This shell's own
+    // reference keeps the VM alive; only the post-shutdown window is
+    // forfeited.
+    DartVMRef::CollectKeepAliveVM();
+  }
 
   task_runners_.GetRasterTaskRunner()->PostTask(
-      [rasterizer = rasterizer_->GetWeakPtr()]() {
-        if (rasterizer) {
+      [rasterizer = rasterizer_->GetWeakPtr(), level]() {
+        if (!rasterizer) {
+          return;
+        }
+        if (level == MemoryPressureLevel::kCritical) {
           rasterizer->NotifyLowMemoryWarning();
+        } else {
+          rasterizer->NotifyModerateMemoryPressure();
         }
       });
+
   // The IO Manager uses resource cache limits of 0, so it is not necessary
-  // to purge them.
+  // to purge them. Pending unrefs, however, may be holding GPU resources
+  // until the drain delay elapses, and decoded animation frames are rebuilt
+  // within one loop of their animation; both are cheap enough to reclaim at
+  // either level.
+  task_runners_.GetIOTaskRunner()->PostTask(
+      [io_manager = io_manager_->GetWeakPtr()]() {
+        if (io_manager) {
+          if (auto frame_cache = io_manager->GetDecodedFrameCache()) {
+            frame_cache->Clear();
+          }
+          if (auto image_cache = io_manager->GetDecodedImageCache()) {
+            image_cache->Clear();
+          }
+          io_manager->GetSkiaUnrefQueue()->Drain();
+        }
+      });
+
+  std::vector<MemoryPressureListener> listeners;
+  {
+    std::scoped_lock lock(memory_pressure_mutex_);
+    listeners.reserve(memory_pressure_listeners_.size());
+    for (const auto& entry : memory_pressure_listeners_) {
+      listeners.push_back(entry.second);
+    }
+  }
+  for (const auto& listener : listeners) {
+    listener(level);
+  }
+}
+
+int64_t Shell::AddMemoryPressureListener(MemoryPressureListener listener) {
+  FML_DCHECK(listener != nullptr);
+  std::scoped_lock lock(memory_pressure_mutex_);
+  const int64_t listener_id = next_memory_pressure_listener_id_++;
+  memory_pressure_listeners_[listener_id] = std::move(listener);
+  return listener_id;
+}
+
+void Shell::RemoveMemoryPressureListener(int64_t listener_id) {
+  std::scoped_lock lock(memory_pressure_mutex_);
+  memory_pressure_listeners_.erase(listener_id);
+}
+
+void Shell::SetFrameCadenceOverride(uint32_t divisor) {
+  task_runners_.GetUITaskRunner()->PostTask(
+      [engine = weak_engine_, divisor]() {
+        if (engine) {
+          engine->SetFrameCadenceOverride(divisor);
+        }
+      });
 }
 
 void Shell::RunEngine(RunConfiguration run_configuration) {
@@ -515,6 +857,11 @@ bool Shell::EngineHasLivePorts() const {
   return weak_engine_->UIIsolateHasLivePorts();
 }
 
+void Shell::SetSamplingProfiler(std::shared_ptr<SamplingProfiler> profiler) {
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+  sampling_profiler_ = std::move(profiler);
+}
+
 bool Shell::IsSetup() const {
   return is_setup_;
 }
@@ -522,7 +869,7 @@ bool Shell::IsSetup() const {
 bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
                   std::unique_ptr<Engine> engine,
                   std::unique_ptr<Rasterizer> rasterizer,
-                  std::unique_ptr<ShellIOManager> io_manager) {
+                  std::shared_ptr<ShellIOManager> io_manager) {
   if (is_setup_) {
     return false;
   }
@@ -613,9 +960,15 @@ void Shell::OnPlatformViewCreated(std::unique_ptr<Surface> surface) {
       fml::MakeCopyable([&waiting_for_first_frame = waiting_for_first_frame_,
                          rasterizer = rasterizer_->GetWeakPtr(),  //
                          surface = std::move(surface),            //
+                         warmup_skps = settings_.warmup_skps,     //
                          &latch]() mutable {
         if (rasterizer) {
           rasterizer->Setup(std::move(surface));
+          if (warmup_skps) {
+            // Compile the shaders needed by the bundled warm-up recordings
+            // while the platform is still showing its splash screen.
+            rasterizer->DrawWarmUpPictures(PersistentCache::asset_manager());
+          }
         }
 
         waiting_for_first_frame.store(true);
@@ -793,6 +1146,12 @@ void Shell::OnPlatformViewDispatchPlatformMessage(
   FML_DCHECK(is_setup_);
   FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
 
+  // Channels claimed by a background isolate skip the UI task runner hop
+  // entirely.
+  if (PostPlatformMessageToBackgroundPort(message)) {
+    return;
+  }
+
   task_runners_.GetUITaskRunner()->PostTask(
       [engine = engine_->GetWeakPtr(), message = std::move(message)] {
         if (engine) {
@@ -801,6 +1160,50 @@ void Shell::OnPlatformViewDispatchPlatformMessage(
       });
 }
 
+bool Shell::PostPlatformMessageToBackgroundPort(
+    const fml::RefPtr<PlatformMessage>& message) {
+  Dart_Port port = ILLEGAL_PORT;
+  {
+    std::scoped_lock lock(background_platform_channels_mutex_);
+    auto found = background_platform_channels_.find(message->channel());
+    if (found == background_platform_channels_.end()) {
+      return false;
+    }
+    port = found->second;
+  }
+
+  Dart_CObject dart_object = {};
+  if (message->hasData()) {
+    const auto& data = message->data();
+    dart_object.type = Dart_CObject_kTypedData;
+    dart_object.value.as_typed_data.type = Dart_TypedData_kUint8;
+    dart_object.value.as_typed_data.length = data.GetSize();
+    dart_object.value.as_typed_data.values =
+        const_cast<uint8_t*>(data.GetMapping());
+  } else {
+    dart_object.type = Dart_CObject_kNull;
+  }
+
+  // Dart_PostCObject serializes the object before returning, so the payload
+  // need not outlive this call.
+  if (!Dart_PostCObject(port, &dart_object)) {
+    // The receive port was closed, likely because its isolate died. Drop the
+    // registration so the message (and subsequent ones) take the root
+    // isolate path.
+    std::scoped_lock lock(background_platform_channels_mutex_);
+    background_platform_channels_.erase(message->channel());
+    return false;
+  }
+
+  if (auto response = message->response()) {
+    // Background delivery is fire-and-forget; any real reply is sent as an
+    // ordinary platform message by the receiving isolate.
+    response->CompleteEmpty();
+  }
+
+  return true;
+}
+
 // |PlatformView::Delegate|
 void Shell::OnPlatformViewDispatchPointerDataPacket(
     std::unique_ptr<PointerDataPacket> packet) {
@@ -897,7 +1300,9 @@ void Shell::OnPlatformViewMarkTextureFrameAvailable(int64_t texture_id) {
 
   // Tell the rasterizer that one of its textures has a new frame available.
   task_runners_.GetRasterTaskRunner()->PostTask(
-      [rasterizer = rasterizer_->GetWeakPtr(), texture_id]() {
+      [rasterizer = rasterizer_->GetWeakPtr(),
+       io_manager = io_manager_->GetWeakPtr(),
+       io_task_runner = task_runners_.GetIOTaskRunner(), texture_id]() {
         auto* registry = rasterizer->GetTextureRegistry();
 
         if (!registry) {
@@ -911,6 +1316,25 @@ void Shell::OnPlatformViewMarkTextureFrameAvailable(int64_t texture_id) {
         }
 
         texture->MarkNewFrameAvailable();
+
+        if (!texture->SupportsAheadOfRasterUpload()) {
+          return;
+        }
+
+        // Resolve the frame on the IO context so raster only has to wait on
+        // the ready fence instead of performing the upload itself.
+        io_task_runner->PostTask([io_manager, texture]() {
+          if (!io_manager) {
+            return;
+          }
+          auto resource_context = io_manager->GetResourceContext();
+          if (!resource_context) {
+            return;
+          }
+          if (auto frame = texture->UploadFrame(resource_context.get())) {
+            texture->PublishFrame(std::move(frame));
+          }
+        });
       });
 
   // Schedule a new frame without having to rebuild the layer tree.
@@ -949,6 +1373,19 @@ void Shell::OnAnimatorBeginFrame(fml::TimePoint frame_target_time) {
   }
 }
 
+// |Animator::Delegate|
+void Shell::OnAnimatorPrepareFrame(SkISize expected_frame_size) {
+  FML_DCHECK(is_setup_);
+  FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
+
+  task_runners_.GetRasterTaskRunner()->PostTask(
+      [rasterizer = rasterizer_->GetWeakPtr(), expected_frame_size]() {
+        if (auto batch = rasterizer.GetForCurrentTask()) {
+          batch->PrepareFrame(expected_frame_size);
+        }
+      });
+}
+
 // |Animator::Delegate|
 void Shell::OnAnimatorNotifyIdle(int64_t deadline) {
   FML_DCHECK(is_setup_);
@@ -979,8 +1416,9 @@ void Shell::OnAnimatorDraw(fml::RefPtr<Pipeline<flutter::LayerTree>> pipeline,
        &waiting_for_first_frame_condition = waiting_for_first_frame_condition_,
        rasterizer = rasterizer_->GetWeakPtr(),
        pipeline = std::move(pipeline)]() {
-        if (rasterizer) {
-          rasterizer->Draw(pipeline);
+        // Validate the weak pointer once for the whole task.
+        if (auto batch = rasterizer.GetForCurrentTask()) {
+          batch->Draw(pipeline);
 
           if (waiting_for_first_frame.load()) {
             waiting_for_first_frame.store(false);
@@ -1023,7 +1461,7 @@ void Shell::OnEngineHandlePlatformMessage(
   FML_DCHECK(is_setup_);
   FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
 
-  if (message->channel() == kSkiaChannel) {
+  if (message->channel_id() == ChannelInterner::kSkiaChannelId) {
     HandleEngineSkiaMessage(std::move(message));
     return;
   }
@@ -1037,10 +1475,14 @@ void Shell::OnEngineHandlePlatformMessage(
 }
 
 void Shell::HandleEngineSkiaMessage(fml::RefPtr<PlatformMessage> message) {
+  if (!message->hasData()) {
+    return;
+  }
   const auto& data = message->data();
 
   rapidjson::Document document;
-  document.Parse(reinterpret_cast<const char*>(data.data()), data.size());
+  document.Parse(reinterpret_cast<const char*>(data.GetMapping()),
+                 data.GetSize());
   if (document.HasParseError() || !document.IsObject())
     return;
   auto root = document.GetObject();
@@ -1085,6 +1527,27 @@ void Shell::OnPreEngineRestart() {
   // This is blocking as any embedded platform views has to be flushed before
   // we re-run the Dart code.
   latch.Wait();
+
+  // The restart discards every isolate in the group, so registered receive
+  // ports are about to die with them.
+  {
+    std::scoped_lock lock(background_platform_channels_mutex_);
+    background_platform_channels_.clear();
+  }
+}
+
+// |Engine::Delegate|
+void Shell::OnEngineRegisterBackgroundPlatformChannel(const std::string& name,
+                                                      Dart_Port port) {
+  FML_DCHECK(is_setup_);
+  FML_DCHECK(task_runners_.GetUITaskRunner()->RunsTasksOnCurrentThread());
+
+  std::scoped_lock lock(background_platform_channels_mutex_);
+  if (port == ILLEGAL_PORT) {
+    background_platform_channels_.erase(name);
+  } else {
+    background_platform_channels_[name] = port;
+  }
 }
 
 // |Engine::Delegate|
@@ -1114,8 +1577,8 @@ void Shell::ReportTimings() {
 size_t Shell::UnreportedFramesCount() const {
   // Check that this is running on the raster thread to avoid race conditions.
   FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
-  FML_DCHECK(unreported_timings_.size() % FrameTiming::kCount == 0);
-  return unreported_timings_.size() / FrameTiming::kCount;
+  FML_DCHECK(unreported_timings_.size() % FrameTiming::kStatisticsCount == 0);
+  return unreported_timings_.size() / FrameTiming::kStatisticsCount;
 }
 
 void Shell::OnFrameRasterized(const FrameTiming& timing) {
@@ -1128,6 +1591,35 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
     settings_.frame_rasterized_callback(timing);
   }
 
+  if (settings_.frame_pacing_governor) {
+    const fml::TimeDelta raster_duration =
+        timing.Get(FrameTiming::kRasterFinish) -
+        timing.Get(FrameTiming::kRasterStart);
+    const fml::TimeDelta presentation_delay = timing.GetPresentationDelay();
+    task_runners_.GetUITaskRunner()->PostTask(
+        [engine = weak_engine_, raster_duration, presentation_delay]() {
+          if (engine) {
+            engine->RecordFrameRasterDuration(raster_duration);
+            if (presentation_delay >= fml::TimeDelta::Zero()) {
+              engine->RecordFramePresentationDelay(presentation_delay);
+            }
+          }
+        });
+  }
+
+  // Record the frame for jank attribution regardless of whether the Dart
+  // side asked for timings reports.
+  if (const float refresh_rate = display_refresh_rate_.load();
+      refresh_rate > 0) {
+    frame_statistics_->SetFrameBudget(
+        fml::TimeDelta::FromSecondsF(1.0 / refresh_rate));
+  }
+  frame_statistics_->RecordFrame(
+      timing, rasterizer_ ? rasterizer_->compositor_context()
+                                ->raster_cache()
+                                .GetCachedEntriesCount()
+                          : 0u);
+
   if (!needs_report_timings_) {
     return;
   }
@@ -1136,6 +1628,9 @@ void Shell::OnFrameRasterized(const FrameTiming& timing) {
     unreported_timings_.push_back(
         timing.Get(phase).ToEpochDelta().ToMicroseconds());
   }
+  // Each frame record ends with the GPU duration, negative when the surface
+  // could not measure it. See |FrameTiming::kStatisticsCount|.
+  unreported_timings_.push_back(timing.GetGpuDuration().ToMicroseconds());
 
   // In tests using iPhone 6S with profile mode, sending a batch of 1 frame or a
   // batch of 100 frames have roughly the same cost of less than 0.1ms. Sending
@@ -1401,6 +1896,242 @@ bool Shell::OnServiceProtocolGetSkSLs(
   return true;
 }
 
+bool Shell::OnServiceProtocolGetWarmUpTimings(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document& response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  auto& allocator = response.GetAllocator();
+  response.SetObject();
+  response.AddMember("type", "WarmUpTimings", allocator);
+
+  rapidjson::Value recordings_json(rapidjson::kObjectType);
+  int64_t total_micros = 0;
+  for (const auto& timing : rasterizer_->GetWarmUpTimings()) {
+    const int64_t micros = timing.duration.ToMicroseconds();
+    total_micros += micros;
+    rapidjson::Value recording_name(timing.skp_name, allocator);
+    recordings_json.AddMember(recording_name, micros, allocator);
+  }
+  response.AddMember("recordings", recordings_json, allocator);
+  response.AddMember("totalMicros", total_micros, allocator);
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolGetMemoryUsage(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document& response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  auto& allocator = response.GetAllocator();
+  response.SetObject();
+  response.AddMember("type", "MemoryUsage", allocator);
+
+  const auto& raster_cache =
+      rasterizer_->compositor_context()->raster_cache();
+  response.AddMember("rasterCacheBytes",
+                     static_cast<uint64_t>(raster_cache.GetCachedEntriesBytes()),
+                     allocator);
+  response.AddMember(
+      "rasterCachePictureCount",
+      static_cast<uint64_t>(raster_cache.GetPictureCachedEntriesCount()),
+      allocator);
+  response.AddMember(
+      "rasterCacheLayerCount",
+      static_cast<uint64_t>(raster_cache.GetLayerCachedEntriesCount()),
+      allocator);
+
+  if (auto gr_bytes = rasterizer_->GetResourceCacheBytes()) {
+    response.AddMember("grResourceCacheBytes",
+                       static_cast<uint64_t>(gr_bytes.value()), allocator);
+  }
+
+  // The decoded frame and image caches guard their own state, so reading
+  // their byte counts from the raster thread is safe.
+  if (auto frame_cache = io_manager_->GetDecodedFrameCache()) {
+    response.AddMember("decodedFrameCacheBytes",
+                       static_cast<uint64_t>(frame_cache->GetCachedBytes()),
+                       allocator);
+  }
+  if (auto image_cache = io_manager_->GetDecodedImageCache()) {
+    response.AddMember("decodedImageCacheBytes",
+                       static_cast<uint64_t>(image_cache->GetCachedBytes()),
+                       allocator);
+  }
+
+  // Worker pool utilization. Worker threads are spawned on demand up to the
+  // cap and retire when idle, so the live count reflects actual load.
+  if (auto concurrent_loop = vm_->GetConcurrentMessageLoop()) {
+    response.AddMember(
+        "workerPoolCapacity",
+        static_cast<uint64_t>(concurrent_loop->GetWorkerCount()), allocator);
+    response.AddMember(
+        "workerPoolLiveWorkers",
+        static_cast<uint64_t>(concurrent_loop->GetLiveWorkerCount()),
+        allocator);
+    response.AddMember(
+        "workerPoolIdleWorkers",
+        static_cast<uint64_t>(concurrent_loop->GetIdleWorkerCount()),
+        allocator);
+    response.AddMember(
+        "workerPoolTotalSpawned",
+        static_cast<uint64_t>(concurrent_loop->GetTotalWorkersSpawned()),
+        allocator);
+  }
+
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolStartProfiling(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document& response) {
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+  auto profiler = sampling_profiler_.lock();
+  if (!profiler) {
+    ServiceProtocolFailureError(
+        response, "No sampling profiler is attached to this shell.");
+    return false;
+  }
+  profiler->Start();
+  response.SetObject();
+  response.AddMember("type", "Success", response.GetAllocator());
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolStopProfiling(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document& response) {
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+  auto profiler = sampling_profiler_.lock();
+  if (!profiler) {
+    ServiceProtocolFailureError(
+        response, "No sampling profiler is attached to this shell.");
+    return false;
+  }
+  profiler->Stop();
+  response.SetObject();
+  response.AddMember("type", "Success", response.GetAllocator());
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolGetProfilerSamples(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document& response) {
+  FML_DCHECK(task_runners_.GetPlatformTaskRunner()->RunsTasksOnCurrentThread());
+  auto profiler = sampling_profiler_.lock();
+  if (!profiler) {
+    ServiceProtocolFailureError(
+        response, "No sampling profiler is attached to this shell.");
+    return false;
+  }
+  auto& allocator = response.GetAllocator();
+  response.SetObject();
+  response.AddMember("type", "ProfilerSamples", allocator);
+  response.AddMember("recordBytes",
+                     static_cast<uint64_t>(sizeof(RecordedProfileSample)),
+                     allocator);
+
+  auto samples = profiler->ExportSamples();
+  size_t b64_size =
+      SkBase64::Encode(samples->GetMapping(), samples->GetSize(), nullptr);
+  sk_sp<SkData> b64_data = SkData::MakeUninitialized(b64_size + 1);
+  char* b64_char = static_cast<char*>(b64_data->writable_data());
+  SkBase64::Encode(samples->GetMapping(), samples->GetSize(), b64_char);
+  b64_char[b64_size] = 0;
+  rapidjson::Value samples_value(b64_char, allocator);
+  response.AddMember("samples", samples_value, allocator);
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolGetFrameStatistics(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document& response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  auto& allocator = response.GetAllocator();
+  response.SetObject();
+  response.AddMember("type", "FrameStatistics", allocator);
+  response.AddMember(
+      "recordBytes",
+      static_cast<uint64_t>(sizeof(FrameStatistics::FrameRecord)), allocator);
+
+  frame_statistics_->WriteToJson(response);
+
+  auto records = frame_statistics_->ExportBinary();
+  size_t b64_size =
+      SkBase64::Encode(records->GetMapping(), records->GetSize(), nullptr);
+  sk_sp<SkData> b64_data = SkData::MakeUninitialized(b64_size + 1);
+  char* b64_char = static_cast<char*>(b64_data->writable_data());
+  SkBase64::Encode(records->GetMapping(), records->GetSize(), b64_char);
+  b64_char[b64_size] = 0;
+  rapidjson::Value records_value(b64_char, allocator);
+  response.AddMember("records", records_value, allocator);
+  return true;
+}
+
+// Service protocol handler
+bool Shell::OnServiceProtocolGetRasterCacheStats(
+    const ServiceProtocol::Handler::ServiceProtocolMap& params,
+    rapidjson::Document& response) {
+  FML_DCHECK(task_runners_.GetRasterTaskRunner()->RunsTasksOnCurrentThread());
+  auto& raster_cache = rasterizer_->compositor_context()->raster_cache();
+
+  if (params.count("enable") != 0) {
+    raster_cache.SetChurnInstrumentationEnabled(params.at("enable") == "true");
+  }
+
+  auto& allocator = response.GetAllocator();
+  response.SetObject();
+  response.AddMember("type", "RasterCacheStats", allocator);
+  response.AddMember("enabled", raster_cache.IsChurnInstrumentationEnabled(),
+                     allocator);
+  response.AddMember("pictureCacheLimitPerFrame",
+                     RasterCache::kDefaultPictureCacheLimitPerFrame, allocator);
+  response.AddMember(
+      "entryCount", static_cast<uint64_t>(raster_cache.GetCachedEntriesCount()),
+      allocator);
+  response.AddMember(
+      "entryBytes", static_cast<uint64_t>(raster_cache.GetCachedEntriesBytes()),
+      allocator);
+
+  auto stats = raster_cache.GetChurnStats();
+  // The pictures thrashing the cache are the interesting ones; put them
+  // first so truncated views of the response stay useful.
+  std::sort(stats.begin(), stats.end(),
+            [](const RasterCache::ChurnStats& a,
+               const RasterCache::ChurnStats& b) {
+              return a.miss_count > b.miss_count;
+            });
+
+  rapidjson::Value pictures(rapidjson::kArrayType);
+  for (const auto& entry : stats) {
+    rapidjson::Value picture(rapidjson::kObjectType);
+    picture.AddMember("pictureId", entry.picture_id, allocator);
+    picture.AddMember("opCount", entry.op_count, allocator);
+    picture.AddMember("hits", static_cast<uint64_t>(entry.hit_count),
+                      allocator);
+    picture.AddMember("misses", static_cast<uint64_t>(entry.miss_count),
+                      allocator);
+    picture.AddMember("evictions", static_cast<uint64_t>(entry.eviction_count),
+                      allocator);
+    picture.AddMember("currentMissStreak",
+                      static_cast<uint64_t>(entry.current_miss_streak),
+                      allocator);
+    picture.AddMember("longestMissStreak",
+                      static_cast<uint64_t>(entry.longest_miss_streak),
+                      allocator);
+    picture.AddMember(
+        "lastRasterDurationMicros",
+        static_cast<int64_t>(entry.last_raster_duration.ToMicroseconds()),
+        allocator);
+    pictures.PushBack(picture, allocator);
+  }
+  response.AddMember("pictures", pictures, allocator);
+  return true;
+}
+
 // Service protocol handler
 bool Shell::OnServiceProtocolSetAssetBundlePath(
     const ServiceProtocol::Handler::ServiceProtocolMap& params,
@@ -1519,4 +2250,8 @@ std::shared_ptr<fml::SyncSwitch> Shell::GetIsGpuDisabledSyncSwitch() const {
   return is_gpu_disabled_sync_switch_;
 }
 
+FrameStatistics& Shell::GetFrameStatistics() const {
+  return *frame_statistics_;
+}
+
 }  // namespace flutter
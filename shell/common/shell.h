@@ -6,6 +6,8 @@
 #define SHELL_COMMON_SHELL_H_
 
 #include <functional>
+#include <future>
+#include <map>
 #include <mutex>
 #include <string_view>
 #include <unordered_map>
@@ -30,10 +32,12 @@
 #include "flutter/runtime/service_protocol.h"
 #include "flutter/shell/common/animator.h"
 #include "flutter/shell/common/engine.h"
+#include "flutter/shell/common/frame_statistics.h"
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/shell_io_manager.h"
 #include "flutter/shell/common/surface.h"
+#include "flutter/shell/profiling/sampling_profiler.h"
 
 namespace flutter {
 
@@ -210,14 +214,71 @@ class Shell final : public PlatformView::Delegate,
       const CreateCallback<Rasterizer>& on_create_rasterizer,
       DartVMRef vm);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Creates an additional shell that shares this shell's
+  ///             expensive per-engine state instead of rebuilding it. The
+  ///             spawned shell runs on this shell's task runners and shares
+  ///             its IO manager (and with it the resource GrContext, the
+  ///             Skia unref queue and the decoded image and frame caches),
+  ///             its raster cache (cache keys are derived from
+  ///             process-global picture and layer ids and are therefore
+  ///             valid across engines) and the running VM along with its
+  ///             snapshot mappings. The per-spawn cost is thus reduced to
+  ///             roughly the root isolate, and GPU resources warmed by one
+  ///             view serve all of them.
+  ///
+  ///             Must be called on a fully set up shell. The spawned shell
+  ///             is an independent unit: it runs its own isolate and may be
+  ///             torn down before or after this shell; shared components are
+  ///             collected with the last shell referencing them.
+  ///
+  /// @param[in]  on_create_platform_view  The callback that must return a
+  ///                                      platform view. This will be called
+  ///                                      on the platform task runner before
+  ///                                      this method returns.
+  /// @param[in]  on_create_rasterizer     That callback that must provide a
+  ///                                      valid rasterizer. This will be
+  ///                                      called on the render task runner
+  ///                                      before this method returns.
+  ///
+  /// @return     A full initialized shell sharing this shell's IO manager,
+  ///             caches and VM, or nullptr if this shell is not set up or
+  ///             the callbacks are invalid.
+  ///
+  std::unique_ptr<Shell> Spawn(
+      const CreateCallback<PlatformView>& on_create_platform_view,
+      const CreateCallback<Rasterizer>& on_create_rasterizer) const;
+
   //----------------------------------------------------------------------------
   /// @brief      Destroys the shell. This is a synchronous operation and
   ///             synchronous barrier blocks are introduced on the various
   ///             threads to ensure shutdown of all shell sub-components before
-  ///             this method returns.
+  ///             this method returns. Embedders that cannot afford to block
+  ///             their platform thread for the duration of the teardown
+  ///             should use `TearDownAsynchronously` instead.
   ///
   ~Shell();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Tears down the shell without blocking the platform thread.
+  ///             The engine, rasterizer and IO manager are drained and
+  ///             destroyed on their own task runners in sequence and the
+  ///             shell itself (along with the platform view) is collected on
+  ///             the platform task runner once they are gone. Embedders
+  ///             should detach the rendering surface (via the platform view's
+  ///             `NotifyDestroyed`) before calling this method.
+  ///
+  ///             Must be called on the platform task runner.
+  ///
+  /// @param[in]  shell                 The shell to tear down.
+  /// @param[in]  on_teardown_complete  An optional callback invoked on the
+  ///                                   platform task runner after the last
+  ///                                   shell sub-component has been
+  ///                                   destroyed.
+  ///
+  static void TearDownAsynchronously(std::unique_ptr<Shell> shell,
+                                     const fml::closure& on_teardown_complete);
+
   //----------------------------------------------------------------------------
   /// @brief      Starts an isolate for the given RunConfiguration.
   ///
@@ -274,6 +335,13 @@ class Shell final : public PlatformView::Delegate,
   ///
   fml::WeakPtr<PlatformView> GetPlatformView();
 
+  //----------------------------------------------------------------------------
+  /// @brief      The per-frame timing records collected by this shell. May be
+  ///             accessed from any thread; the statistics object outlives
+  ///             every subsystem that feeds it.
+  ///
+  FrameStatistics& GetFrameStatistics() const;
+
   // Embedders should call this under low memory conditions to free up
   // internal caches used.
   //
@@ -286,6 +354,60 @@ class Shell final : public PlatformView::Delegate,
   ///             the rasterizer cache is purged.
   void NotifyLowMemoryWarning() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The tiers of memory pressure the shell responds to.
+  ///             Moderate pressure trims only what can be rebuilt without
+  ///             affecting the next frame: scratch GPU resources, pending
+  ///             Skia unrefs and decoded animation frames. Critical pressure
+  ///             additionally drops the raster cache, frees all unlocked GPU
+  ///             resources and asks the Dart VM to collect.
+  enum class MemoryPressureLevel {
+    kModerate,
+    kCritical,
+  };
+
+  using MemoryPressureListener = std::function<void(MemoryPressureLevel)>;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Central entry point for platform memory signals (Android
+  ///             trim notifications, iOS memory warnings, the embedder API).
+  ///             Shrinks the engine caches in order of rebuild cost for the
+  ///             given level and then invokes registered listeners. May be
+  ///             called on any thread. |NotifyLowMemoryWarning| forwards
+  ///             here with the critical level.
+  void NotifyMemoryPressure(MemoryPressureLevel level) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Registers a listener run after the engine's own caches have
+  ///             been shrunk, on the thread reporting the pressure. Lets
+  ///             embedders and auxiliary caches participate in the tiered
+  ///             response.
+  ///
+  /// @return     An identifier to pass to |RemoveMemoryPressureListener|.
+  int64_t AddMemoryPressureListener(MemoryPressureListener listener);
+
+  void RemoveMemoryPressureListener(int64_t listener_id);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Used by embedders to pin the frame cadence to the given
+  ///             vsync divisor (one renders at display rate, two at half
+  ///             rate, three at a third), bypassing the frame pacing
+  ///             governor. A divisor of zero returns control to the
+  ///             governor. May be called on any thread.
+  void SetFrameCadenceOverride(uint32_t divisor);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Attaches the sampling profiler servicing this shell so the
+  ///             `_flutter.startProfiling`, `_flutter.stopProfiling` and
+  ///             `_flutter.getProfilerSamples` service protocol extensions can
+  ///             control it. The shell only keeps a weak reference; the
+  ///             embedder retains ownership of the profiler. Must be called on
+  ///             the platform task runner.
+  ///
+  /// @param[in]  profiler  The sampling profiler servicing this shell.
+  ///
+  void SetSamplingProfiler(std::shared_ptr<SamplingProfiler> profiler);
+
   //----------------------------------------------------------------------------
   /// @brief      Used by embedders to check if all shell subcomponents are
   ///             initialized. It is the embedder's responsibility to make this
@@ -375,7 +497,10 @@ class Shell final : public PlatformView::Delegate,
   std::unique_ptr<PlatformView> platform_view_;  // on platform task runner
   std::unique_ptr<Engine> engine_;               // on UI task runner
   std::unique_ptr<Rasterizer> rasterizer_;       // on GPU task runner
-  std::unique_ptr<ShellIOManager> io_manager_;   // on IO task runner
+  // On the IO task runner. Shared so that shells created through |Spawn| can
+  // reference their parent's IO manager; it is collected on the IO task
+  // runner with the last shell referencing it.
+  std::shared_ptr<ShellIOManager> io_manager_;
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
 
   fml::WeakPtr<Engine> weak_engine_;  // to be shared across threads
@@ -391,8 +516,29 @@ class Shell final : public PlatformView::Delegate,
                      >
       service_protocol_handlers_;
   bool is_setup_ = false;
+  // Set on the platform task runner by |TearDownAsynchronously| once the
+  // engine, rasterizer and IO manager have been destroyed on their own
+  // threads, letting the destructor skip the synchronous thread barriers.
+  bool torn_down_asynchronously_ = false;
   uint64_t next_pointer_flow_id_ = 0;
 
+  // Only accessed on the platform task runner. The embedder owns the
+  // profiler; the service protocol handlers bail out gracefully once it is
+  // collected.
+  std::weak_ptr<SamplingProfiler> sampling_profiler_;
+
+  // Guards the channel registry below; written on the UI task runner via the
+  // engine delegate and read on the platform task runner for every incoming
+  // platform message.
+  mutable std::mutex background_platform_channels_mutex_;
+  std::map<std::string, Dart_Port> background_platform_channels_;
+
+  // Guards the listener registry; listeners themselves run outside the lock
+  // on the thread reporting the pressure.
+  mutable std::mutex memory_pressure_mutex_;
+  mutable std::map<int64_t, MemoryPressureListener> memory_pressure_listeners_;
+  mutable int64_t next_memory_pressure_listener_id_ = 1;
+
   bool first_frame_rasterized_ = false;
   std::atomic<bool> waiting_for_first_frame_ = true;
   std::mutex waiting_for_first_frame_mutex_;
@@ -406,11 +552,16 @@ class Shell final : public PlatformView::Delegate,
   // ui.Window.onReportTimings.
   bool frame_timings_report_scheduled_ = false;
 
-  // Vector of FrameTiming::kCount * n timestamps for n frames whose timings
-  // have not been reported yet. Vector of ints instead of FrameTiming is stored
-  // here for easier conversions to Dart objects.
+  // Vector of FrameTiming::kStatisticsCount * n values for n frames whose
+  // timings have not been reported yet. Vector of ints instead of FrameTiming
+  // is stored here for easier conversions to Dart objects.
   std::vector<int64_t> unreported_timings_;
 
+  // Per-frame timing records with jank attribution, written from the raster
+  // thread as frames are rasterized and read by the service protocol. The
+  // subsystem is internally thread safe.
+  std::unique_ptr<FrameStatistics> frame_statistics_;
+
   // A cache of `Engine::GetDisplayRefreshRate` (only callable in the UI thread)
   // so we can access it from `Rasterizer` (in the raster thread).
   //
@@ -421,21 +572,40 @@ class Shell final : public PlatformView::Delegate,
   // How many frames have been timed since last report.
   size_t UnreportedFramesCount() const;
 
-  Shell(DartVMRef vm, TaskRunners task_runners, Settings settings);
+  // The VM reference is assigned by |CreateShellOnPlatformThread| once the
+  // VM setup phase joins, before any subsystem that needs it is created.
+  Shell(TaskRunners task_runners, Settings settings);
+
+  // Boots the shell's subsystems concurrently on their respective task
+  // runners: the VM (and with it the isolate snapshot) may still be
+  // initializing when the other phases start, and is joined through the
+  // futures only where needed. When `spawned_from` is set, the new shell
+  // adopts that shell's IO manager and raster cache instead of creating its
+  // own; the spawning shell must stay alive until this call returns.
+  static std::unique_ptr<Shell> Create(
+      TaskRunners task_runners,
+      const WindowData window_data,
+      Settings settings,
+      std::future<DartVMRef> vm_future,
+      std::future<fml::RefPtr<const DartSnapshot>> isolate_snapshot_future,
+      const CreateCallback<PlatformView>& on_create_platform_view,
+      const CreateCallback<Rasterizer>& on_create_rasterizer,
+      const Shell* spawned_from = nullptr);
 
   static std::unique_ptr<Shell> CreateShellOnPlatformThread(
-      DartVMRef vm,
+      std::future<DartVMRef> vm_future,
       TaskRunners task_runners,
       const WindowData window_data,
       Settings settings,
-      fml::RefPtr<const DartSnapshot> isolate_snapshot,
+      std::future<fml::RefPtr<const DartSnapshot>> isolate_snapshot_future,
       const Shell::CreateCallback<PlatformView>& on_create_platform_view,
-      const Shell::CreateCallback<Rasterizer>& on_create_rasterizer);
+      const Shell::CreateCallback<Rasterizer>& on_create_rasterizer,
+      const Shell* spawned_from = nullptr);
 
   bool Setup(std::unique_ptr<PlatformView> platform_view,
              std::unique_ptr<Engine> engine,
              std::unique_ptr<Rasterizer> rasterizer,
-             std::unique_ptr<ShellIOManager> io_manager);
+             std::shared_ptr<ShellIOManager> io_manager);
 
   void ReportTimings();
 
@@ -485,6 +655,9 @@ class Shell final : public PlatformView::Delegate,
   // |Animator::Delegate|
   void OnAnimatorBeginFrame(fml::TimePoint frame_target_time) override;
 
+  // |Animator::Delegate|
+  void OnAnimatorPrepareFrame(SkISize expected_frame_size) override;
+
   // |Animator::Delegate|
   void OnAnimatorNotifyIdle(int64_t deadline) override;
 
@@ -504,8 +677,19 @@ class Shell final : public PlatformView::Delegate,
   void OnEngineHandlePlatformMessage(
       fml::RefPtr<PlatformMessage> message) override;
 
+  // |Engine::Delegate|
+  void OnEngineRegisterBackgroundPlatformChannel(const std::string& name,
+                                                 Dart_Port port) override;
+
   void HandleEngineSkiaMessage(fml::RefPtr<PlatformMessage> message);
 
+  // Posts |message| to the native port registered for its channel, if any.
+  // Returns false when the channel has no registration or its port has been
+  // closed, in which case the caller should take the regular root isolate
+  // path. Called on the platform task runner.
+  bool PostPlatformMessageToBackgroundPort(
+      const fml::RefPtr<PlatformMessage>& message);
+
   // |Engine::Delegate|
   void OnPreEngineRestart() override;
 
@@ -576,6 +760,58 @@ class Shell final : public PlatformView::Delegate,
       const ServiceProtocol::Handler::ServiceProtocolMap& params,
       rapidjson::Document& response);
 
+  // Service protocol handler
+  //
+  // Reports the per-recording wall times (in microseconds) of the last SkP
+  // warm-up run. See |Rasterizer::DrawWarmUpPictures|.
+  bool OnServiceProtocolGetWarmUpTimings(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document& response);
+
+  // Service protocol handler
+  //
+  // Reports the bytes held by each engine cache: the raster cache, the
+  // onscreen Skia resource cache and the decoded animation frame cache.
+  bool OnServiceProtocolGetMemoryUsage(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document& response);
+
+  // Service protocol handler
+  bool OnServiceProtocolStartProfiling(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document& response);
+
+  // Service protocol handler
+  bool OnServiceProtocolStopProfiling(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document& response);
+
+  // Service protocol handler
+  //
+  // The samples are the profiler's binary export, base64 encoded. See
+  // |SamplingProfiler::ExportSamples| for the record layout.
+  bool OnServiceProtocolGetProfilerSamples(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document& response);
+
+  // Service protocol handler
+  //
+  // Reports aggregate jank-cause counters plus the retained frame records
+  // as a base64 encoded binary blob. See |FrameStatistics::ExportBinary|
+  // for the record layout.
+  bool OnServiceProtocolGetFrameStatistics(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document& response);
+
+  // Service protocol handler
+  //
+  // Reports per picture raster cache hit/miss/eviction statistics. The
+  // optional "enable" parameter ("true"/"false") toggles the underlying
+  // churn instrumentation; statistics accumulate while it is enabled.
+  bool OnServiceProtocolGetRasterCacheStats(
+      const ServiceProtocol::Handler::ServiceProtocolMap& params,
+      rapidjson::Document& response);
+
   fml::WeakPtrFactory<Shell> weak_factory_;
 
   // For accessing the Shell via the raster thread, necessary for various
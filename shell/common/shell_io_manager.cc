@@ -65,7 +65,9 @@ ShellIOManager::ShellIOManager(
           fml::TimeDelta::FromMilliseconds(8),
           GetResourceContext())),
       weak_factory_(this),
-      is_gpu_disabled_sync_switch_(is_gpu_disabled_sync_switch) {
+      is_gpu_disabled_sync_switch_(is_gpu_disabled_sync_switch),
+      decoded_frame_cache_(std::make_shared<DecodedFrameCache>()),
+      decoded_image_cache_(std::make_shared<DecodedImageCache>()) {
   if (!resource_context_) {
 #ifndef OS_FUCHSIA
     FML_DLOG(WARNING) << "The IO manager was initialized without a resource "
@@ -93,6 +95,10 @@ void ShellIOManager::NotifyResourceContextAvailable(
 }
 
 void ShellIOManager::UpdateResourceContext(sk_sp<GrContext> resource_context) {
+  // Cached frame and still images were uploaded with the outgoing context and
+  // must not outlive it.
+  decoded_frame_cache_->Clear();
+  decoded_image_cache_->Clear();
   resource_context_ = std::move(resource_context);
   resource_context_weak_factory_ =
       resource_context_ ? std::make_unique<fml::WeakPtrFactory<GrContext>>(
@@ -126,4 +132,14 @@ std::shared_ptr<fml::SyncSwitch> ShellIOManager::GetIsGpuDisabledSyncSwitch() {
   return is_gpu_disabled_sync_switch_;
 }
 
+// |IOManager|
+std::shared_ptr<DecodedFrameCache> ShellIOManager::GetDecodedFrameCache() {
+  return decoded_frame_cache_;
+}
+
+// |IOManager|
+std::shared_ptr<DecodedImageCache> ShellIOManager::GetDecodedImageCache() {
+  return decoded_image_cache_;
+}
+
 }  // namespace flutter
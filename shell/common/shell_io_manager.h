@@ -11,6 +11,8 @@
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/lib/ui/io_manager.h"
+#include "flutter/lib/ui/painting/decoded_frame_cache.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "third_party/skia/include/gpu/GrContext.h"
 
 namespace flutter {
@@ -55,6 +57,12 @@ class ShellIOManager final : public IOManager {
   // |IOManager|
   std::shared_ptr<fml::SyncSwitch> GetIsGpuDisabledSyncSwitch() override;
 
+  // |IOManager|
+  std::shared_ptr<DecodedFrameCache> GetDecodedFrameCache() override;
+
+  // |IOManager|
+  std::shared_ptr<DecodedImageCache> GetDecodedImageCache() override;
+
  private:
   // Resource context management.
   sk_sp<GrContext> resource_context_;
@@ -68,6 +76,10 @@ class ShellIOManager final : public IOManager {
 
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
 
+  std::shared_ptr<DecodedFrameCache> decoded_frame_cache_;
+
+  std::shared_ptr<DecodedImageCache> decoded_image_cache_;
+
   FML_DISALLOW_COPY_AND_ASSIGN(ShellIOManager);
 };
 
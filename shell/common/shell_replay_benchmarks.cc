@@ -0,0 +1,326 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/make_copyable.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/lib/ui/window/pointer_data_packet.h"
+#include "flutter/runtime/dart_vm.h"
+#include "flutter/shell/common/replay_trace.h"
+#include "flutter/shell/common/run_configuration.h"
+#include "flutter/shell/common/shell.h"
+#include "flutter/shell/common/thread_host.h"
+#include "flutter/shell/gpu/gpu_surface_software.h"
+#include "flutter/testing/elf_loader.h"
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+
+namespace {
+
+// Fires the frame callback as soon as a frame is requested so the replay
+// runs at the speed of the engine rather than of a display.
+class ImmediateVsyncWaiter final : public VsyncWaiter {
+ public:
+  explicit ImmediateVsyncWaiter(TaskRunners task_runners)
+      : VsyncWaiter(std::move(task_runners)) {}
+
+ private:
+  // |VsyncWaiter|
+  void AwaitVSync() override {
+    const auto frame_start = fml::TimePoint::Now();
+    FireCallback(frame_start,
+                 frame_start + fml::TimeDelta::FromMicroseconds(16667));
+  }
+};
+
+// Renders to an in-memory software surface and reports each scene build
+// back to the harness via the "replay/frame" platform message sent by the
+// replayApp fixture.
+class ReplayPlatformView final : public PlatformView,
+                                 public GPUSurfaceSoftwareDelegate {
+ public:
+  ReplayPlatformView(PlatformView::Delegate& delegate,
+                     TaskRunners task_runners,
+                     fml::closure on_frame_built)
+      : PlatformView(delegate, std::move(task_runners)),
+        on_frame_built_(std::move(on_frame_built)) {}
+
+  // |PlatformView|
+  std::unique_ptr<Surface> CreateRenderingSurface() override {
+    return std::make_unique<GPUSurfaceSoftware>(this, true);
+  }
+
+  // |PlatformView|
+  std::unique_ptr<VsyncWaiter> CreateVSyncWaiter() override {
+    return std::make_unique<ImmediateVsyncWaiter>(task_runners_);
+  }
+
+  // |PlatformView|
+  void HandlePlatformMessage(fml::RefPtr<PlatformMessage> message) override {
+    if (message->channel() == "replay/frame" && on_frame_built_) {
+      on_frame_built_();
+    }
+  }
+
+  // |GPUSurfaceSoftwareDelegate|
+  sk_sp<SkSurface> AcquireBackingStore(const SkISize& size) override {
+    if (!backing_store_ ||
+        SkISize::Make(backing_store_->width(), backing_store_->height()) !=
+            size) {
+      backing_store_ =
+          SkSurface::MakeRasterN32Premul(size.width(), size.height());
+    }
+    return backing_store_;
+  }
+
+  // |GPUSurfaceSoftwareDelegate|
+  bool PresentBackingStore(sk_sp<SkSurface> backing_store) override {
+    return true;
+  }
+
+ private:
+  fml::closure on_frame_built_;
+  sk_sp<SkSurface> backing_store_;
+};
+
+// A synthetic 120 frame fling standing in for a captured session so the
+// benchmark produces numbers out of the box. Real traces are supplied via
+// the FLUTTER_REPLAY_TRACE environment variable.
+ReplayTrace MakeSyntheticScrollTrace() {
+  ReplayTrace trace;
+  constexpr int kFrames = 120;
+  constexpr int64_t kFramePeriodMicros = 16667;
+
+  auto add_pointer_event = [&trace](PointerData::Change change, double y,
+                                    double delta_y, int64_t timestamp_micros) {
+    PointerData data = {};
+    data.time_stamp = timestamp_micros;
+    data.change = change;
+    data.kind = PointerData::DeviceKind::kTouch;
+    data.signal_kind = PointerData::SignalKind::kNone;
+    data.physical_x = 400.0;
+    data.physical_y = y;
+    data.physical_delta_y = delta_y;
+
+    PointerDataPacket packet(1);
+    packet.SetPointerData(0, data);
+
+    ReplayTrace::Event event;
+    event.kind = ReplayTrace::EventKind::kPointerPacket;
+    event.timestamp_micros = timestamp_micros;
+    event.data = packet.data();
+    trace.AddEvent(std::move(event));
+  };
+
+  double y = 500.0;
+  add_pointer_event(PointerData::Change::kDown, y, 0.0, 0);
+  for (int i = 0; i < kFrames; i++) {
+    // Decaying fling velocity.
+    const double delta = -24.0 * (kFrames - i) / kFrames;
+    y += delta;
+    add_pointer_event(PointerData::Change::kMove, y, delta,
+                      (i + 1) * kFramePeriodMicros);
+  }
+  add_pointer_event(PointerData::Change::kUp, y, 0.0,
+                    (kFrames + 1) * kFramePeriodMicros);
+  return trace;
+}
+
+ReplayTrace LoadReplayTrace() {
+  if (const char* trace_path = std::getenv("FLUTTER_REPLAY_TRACE")) {
+    auto mapping = fml::FileMapping::CreateReadOnly(trace_path);
+    if (mapping) {
+      if (auto trace = ReplayTrace::Deserialize(*mapping)) {
+        return std::move(trace.value());
+      }
+    }
+    FML_LOG(ERROR) << "Could not load replay trace at " << trace_path
+                   << "; falling back to the synthetic scroll trace.";
+  }
+  return MakeSyntheticScrollTrace();
+}
+
+// Sorted input; interpolation-free nearest-rank percentile.
+int64_t Percentile(const std::vector<int64_t>& sorted_values, double rank) {
+  if (sorted_values.empty()) {
+    return 0;
+  }
+  const size_t index = std::min(
+      sorted_values.size() - 1,
+      static_cast<size_t>(rank * static_cast<double>(sorted_values.size())));
+  return sorted_values[index];
+}
+
+}  // namespace
+
+static void BM_ShellTraceReplay(benchmark::State& state) {
+  const ReplayTrace trace = LoadReplayTrace();
+
+  auto assets_dir = fml::OpenDirectory(testing::GetFixturesPath(), false,
+                                       fml::FilePermission::kRead);
+  std::unique_ptr<Shell> shell;
+  std::unique_ptr<ThreadHost> thread_host;
+  testing::ELFAOTSymbols aot_symbols;
+  fml::AutoResetWaitableEvent frame_built_latch;
+
+  // All of the setup - threads, shell, isolate launch and the fixture's
+  // first frame - happens before the first KeepRunning call, so only the
+  // replay itself is timed.
+  {
+    Settings settings = {};
+    settings.task_observer_add = [](intptr_t, fml::closure) {};
+    settings.task_observer_remove = [](intptr_t) {};
+    settings.assets_path = testing::GetFixturesPath();
+
+    if (DartVM::IsRunningPrecompiledCode()) {
+      aot_symbols = testing::LoadELFSymbolFromFixturesIfNeccessary();
+      FML_CHECK(
+          testing::PrepareSettingsForAOTWithSymbols(settings, aot_symbols))
+          << "Could not setup settings with AOT symbols.";
+    } else {
+      settings.application_kernels = [&]() {
+        std::vector<std::unique_ptr<const fml::Mapping>> kernel_mappings;
+        kernel_mappings.emplace_back(
+            fml::FileMapping::CreateReadOnly(assets_dir, "kernel_blob.bin"));
+        return kernel_mappings;
+      };
+    }
+
+    thread_host = std::make_unique<ThreadHost>(
+        "io.flutter.bench.", ThreadHost::Type::Platform |
+                                 ThreadHost::Type::GPU | ThreadHost::Type::IO |
+                                 ThreadHost::Type::UI);
+
+    TaskRunners task_runners("replay",
+                             thread_host->platform_thread->GetTaskRunner(),
+                             thread_host->raster_thread->GetTaskRunner(),
+                             thread_host->ui_thread->GetTaskRunner(),
+                             thread_host->io_thread->GetTaskRunner());
+
+    shell = Shell::Create(
+        std::move(task_runners), settings,
+        [&frame_built_latch](Shell& shell) {
+          return std::make_unique<ReplayPlatformView>(
+              shell, shell.GetTaskRunners(),
+              [&frame_built_latch]() { frame_built_latch.Signal(); });
+        },
+        [](Shell& shell) {
+          return std::make_unique<Rasterizer>(
+              shell, shell.GetTaskRunners(),
+              shell.GetIsGpuDisabledSyncSwitch());
+        });
+    FML_CHECK(shell);
+
+    auto configuration = RunConfiguration::InferFromSettings(settings);
+    configuration.SetEntrypoint("replayApp");
+
+    fml::AutoResetWaitableEvent engine_run_latch;
+    fml::TaskRunner::RunNowOrPostTask(
+        shell->GetTaskRunners().GetPlatformTaskRunner(),
+        fml::MakeCopyable([&shell, &engine_run_latch,
+                           configuration = std::move(configuration)]() mutable {
+          shell->RunEngine(std::move(configuration),
+                           [&engine_run_latch](Engine::RunStatus status) {
+                             FML_CHECK(status != Engine::RunStatus::Failure)
+                                 << "Could not launch the replay fixture.";
+                             engine_run_latch.Signal();
+                           });
+          shell->GetPlatformView()->NotifyCreated();
+        }));
+    engine_run_latch.Wait();
+
+    // The fixture schedules one warmup frame at launch; consume it so the
+    // measured region starts from a settled shell.
+    frame_built_latch.Wait();
+  }
+
+  const auto platform_task_runner =
+      shell->GetTaskRunners().GetPlatformTaskRunner();
+
+  while (state.KeepRunning()) {
+    for (const auto& event : trace.GetEvents()) {
+      switch (event.kind) {
+        case ReplayTrace::EventKind::kPointerPacket: {
+          fml::TaskRunner::RunNowOrPostTask(
+              platform_task_runner, [&shell, &event]() {
+                auto packet = std::make_unique<PointerDataPacket>(
+                    const_cast<uint8_t*>(event.data.data()),
+                    event.data.size());
+                shell->GetPlatformView()->DispatchPointerDataPacket(
+                    std::move(packet));
+              });
+          // Each pointer packet schedules a frame in the fixture; pace the
+          // replay on scene builds so the pipeline works at full depth
+          // without the trace running ahead of the app.
+          frame_built_latch.Wait();
+          break;
+        }
+        case ReplayTrace::EventKind::kPlatformMessage: {
+          fml::TaskRunner::RunNowOrPostTask(
+              platform_task_runner, [&shell, &event]() {
+                shell->GetPlatformView()->DispatchPlatformMessage(
+                    fml::MakeRefCounted<PlatformMessage>(event.channel,
+                                                         event.data, nullptr));
+              });
+          break;
+        }
+      }
+    }
+  }
+
+  // Scene builds outpace rasterization; drain the raster thread before
+  // reading the frame statistics so the last frames are accounted for.
+  {
+    fml::AutoResetWaitableEvent raster_latch;
+    shell->GetTaskRunners().GetRasterTaskRunner()->PostTask(
+        [&raster_latch]() { raster_latch.Signal(); });
+    raster_latch.Wait();
+  }
+
+  {
+    const auto records = shell->GetFrameStatistics().GetRecords();
+    std::vector<int64_t> raster_micros;
+    std::vector<int64_t> build_micros;
+    for (const auto& record : records) {
+      raster_micros.push_back(record.raster_duration_micros);
+      build_micros.push_back(record.build_duration_micros);
+    }
+    std::sort(raster_micros.begin(), raster_micros.end());
+    std::sort(build_micros.begin(), build_micros.end());
+
+    state.counters["frames"] = records.size();
+    state.counters["build_p50_us"] = Percentile(build_micros, 0.5);
+    state.counters["build_p99_us"] = Percentile(build_micros, 0.99);
+    state.counters["raster_p50_us"] = Percentile(raster_micros, 0.5);
+    state.counters["raster_p90_us"] = Percentile(raster_micros, 0.9);
+    state.counters["raster_p99_us"] = Percentile(raster_micros, 0.99);
+    state.counters["raster_max_us"] =
+        raster_micros.empty() ? 0 : raster_micros.back();
+  }
+
+  {
+    // Shutdown must occur synchronously on the platform thread; the timer
+    // has already stopped once KeepRunning returns false.
+    fml::AutoResetWaitableEvent shutdown_latch;
+    fml::TaskRunner::RunNowOrPostTask(platform_task_runner,
+                                      [&shell, &shutdown_latch]() mutable {
+                                        shell.reset();
+                                        shutdown_latch.Signal();
+                                      });
+    shutdown_latch.Wait();
+    thread_host.reset();
+  }
+}
+
+BENCHMARK(BM_ShellTraceReplay);
+
+}  // namespace flutter
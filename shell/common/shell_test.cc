@@ -302,6 +302,37 @@ std::unique_ptr<Shell> ShellTest::CreateShell(
                                             shell.GetIsGpuDisabledSyncSwitch());
       });
 }
+
+std::unique_ptr<Shell> ShellTest::SpawnShell(Shell* shell) {
+  const auto vsync_clock = std::make_shared<ShellTestVsyncClock>();
+  TaskRunners task_runners = shell->GetTaskRunners();
+  CreateVsyncWaiter create_vsync_waiter = [task_runners]() {
+    return static_cast<std::unique_ptr<VsyncWaiter>>(
+        std::make_unique<VsyncWaiterFallback>(task_runners));
+  };
+  return shell->Spawn(
+      [vsync_clock, create_vsync_waiter](Shell& spawned) {
+        return ShellTestPlatformView::Create(
+            spawned, spawned.GetTaskRunners(), vsync_clock,
+            create_vsync_waiter,
+            ShellTestPlatformView::BackendType::kDefaultBackend, nullptr);
+      },
+      [](Shell& spawned) {
+        return std::make_unique<Rasterizer>(
+            spawned, spawned.GetTaskRunners(),
+            spawned.GetIsGpuDisabledSyncSwitch());
+      });
+}
+
+bool ShellTest::ShellsShareIOManager(Shell* a, Shell* b) {
+  return a->io_manager_ != nullptr && a->io_manager_ == b->io_manager_;
+}
+
+bool ShellTest::ShellsShareRasterCache(Shell* a, Shell* b) {
+  return a->rasterizer_->compositor_context()->shared_raster_cache() ==
+         b->rasterizer_->compositor_context()->shared_raster_cache();
+}
+
 void ShellTest::DestroyShell(std::unique_ptr<Shell> shell) {
   DestroyShell(std::move(shell), GetTaskRunnersForFixture());
 }
@@ -43,6 +43,15 @@ class ShellTest : public ThreadTest {
   void DestroyShell(std::unique_ptr<Shell> shell, TaskRunners task_runners);
   TaskRunners GetTaskRunnersForFixture();
 
+  // Spawns an additional shell from `shell` via |Shell::Spawn|, using the
+  // same test platform view and rasterizer factories as |CreateShell|.
+  std::unique_ptr<Shell> SpawnShell(Shell* shell);
+
+  // Whether both shells reference the same ShellIOManager / RasterCache.
+  // Declared here for friend access to the shells' internals.
+  static bool ShellsShareIOManager(Shell* a, Shell* b);
+  static bool ShellsShareRasterCache(Shell* a, Shell* b);
+
   fml::TimePoint GetLatestFrameTargetTime(Shell* shell) const;
 
   void SendEnginePlatformMessage(Shell* shell,
@@ -0,0 +1,169 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/shell_test_perf.h"
+
+#include <cstdlib>
+#include <sstream>
+
+#include "benchmark/benchmark_api.h"
+#include "flutter/fml/build_config.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+
+#if !defined(OS_WIN)
+#include <time.h>
+#endif
+
+namespace flutter {
+namespace testing {
+
+// Maintained by the global operator new override at the bottom of this file.
+// Outside the anonymous namespace so the override can name them.
+thread_local int64_t tls_allocated_bytes = 0;
+thread_local int64_t tls_allocation_count = 0;
+
+namespace {
+
+constexpr const char* kThreadNames[ShellTestPerfHarness::kThreadCount] = {
+    "platform",
+    "ui",
+    "raster",
+    "io",
+};
+
+fml::TimeDelta CurrentThreadCpuTime() {
+#if defined(OS_WIN)
+  return fml::TimeDelta::Zero();
+#else
+  timespec ts{};
+  if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return fml::TimeDelta::Zero();
+  }
+  return fml::TimeDelta::FromNanoseconds(
+      static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec);
+#endif
+}
+
+ThreadPerfSample SampleCurrentThread() {
+  ThreadPerfSample sample;
+  sample.cpu_time = CurrentThreadCpuTime();
+  sample.allocated_bytes = tls_allocated_bytes;
+  sample.allocation_count = tls_allocation_count;
+  return sample;
+}
+
+}  // namespace
+
+ShellTestPerfHarness::ShellTestPerfHarness(TaskRunners task_runners)
+    : task_runners_(std::move(task_runners)) {}
+
+ShellTestPerfHarness::~ShellTestPerfHarness() = default;
+
+void ShellTestPerfHarness::Sample(ThreadPerfSample samples[kThreadCount]) {
+  fml::RefPtr<fml::TaskRunner> runners[kThreadCount] = {
+      task_runners_.GetPlatformTaskRunner(),
+      task_runners_.GetUITaskRunner(),
+      task_runners_.GetRasterTaskRunner(),
+      task_runners_.GetIOTaskRunner(),
+  };
+  fml::CountDownLatch latch(kThreadCount);
+  for (int i = 0; i < kThreadCount; i++) {
+    runners[i]->PostTask([sample = &samples[i], &latch]() {
+      *sample = SampleCurrentThread();
+      latch.CountDown();
+    });
+  }
+  latch.Wait();
+}
+
+void ShellTestPerfHarness::BeginWindow() {
+  FML_DCHECK(!window_open_);
+  Sample(begin_samples_);
+  window_open_ = true;
+}
+
+void ShellTestPerfHarness::EndWindow() {
+  FML_DCHECK(window_open_);
+  ThreadPerfSample end_samples[kThreadCount];
+  Sample(end_samples);
+  for (int i = 0; i < kThreadCount; i++) {
+    window_samples_[i].cpu_time =
+        end_samples[i].cpu_time - begin_samples_[i].cpu_time;
+    window_samples_[i].allocated_bytes =
+        end_samples[i].allocated_bytes - begin_samples_[i].allocated_bytes;
+    window_samples_[i].allocation_count =
+        end_samples[i].allocation_count - begin_samples_[i].allocation_count;
+  }
+  window_open_ = false;
+}
+
+const ThreadPerfSample& ShellTestPerfHarness::GetSample(Thread thread) const {
+  FML_DCHECK(thread >= 0 && thread < kThreadCount);
+  return window_samples_[thread];
+}
+
+::testing::AssertionResult ShellTestPerfHarness::AllocatedLessThan(
+    Thread thread,
+    int64_t budget_bytes) const {
+  const ThreadPerfSample& sample = GetSample(thread);
+  if (sample.allocated_bytes < budget_bytes) {
+    return ::testing::AssertionSuccess();
+  }
+  return ::testing::AssertionFailure()
+         << kThreadNames[thread] << " thread allocated "
+         << sample.allocated_bytes << " bytes over " << sample.allocation_count
+         << " allocations against a budget of " << budget_bytes << " bytes";
+}
+
+::testing::AssertionResult ShellTestPerfHarness::CpuTimeLessThan(
+    Thread thread,
+    fml::TimeDelta budget) const {
+  const ThreadPerfSample& sample = GetSample(thread);
+  if (sample.cpu_time < budget) {
+    return ::testing::AssertionSuccess();
+  }
+  return ::testing::AssertionFailure()
+         << kThreadNames[thread] << " thread consumed "
+         << sample.cpu_time.ToMicroseconds()
+         << "us of CPU time against a budget of " << budget.ToMicroseconds()
+         << "us";
+}
+
+void ShellTestPerfHarness::ReportToBenchmark(::benchmark::State& state) const {
+  // The vendored benchmark library predates user counters, so the samples
+  // travel on the run label instead.
+  std::stringstream label;
+  for (int i = 0; i < kThreadCount; i++) {
+    if (i > 0) {
+      label << ";";
+    }
+    label << kThreadNames[i] << "_cpu_us="
+          << window_samples_[i].cpu_time.ToMicroseconds() << ";"
+          << kThreadNames[i] << "_alloc_bytes="
+          << window_samples_[i].allocated_bytes;
+  }
+  state.SetLabel(label.str());
+}
+
+}  // namespace testing
+}  // namespace flutter
+
+// Global allocation hooks for test binaries that link the shell test fixture
+// sources. Allocations bump the calling thread's counters; frees are
+// deliberately uncounted so the counters stay monotonic and a window's delta
+// measures allocation churn. The allocations are malloc backed, which the
+// default operator delete releases, so no delete override is needed. Failure
+// returns null rather than throwing: the engine builds without exceptions.
+void* operator new(size_t size) {
+  flutter::testing::tls_allocated_bytes += static_cast<int64_t>(size);
+  flutter::testing::tls_allocation_count++;
+  return std::malloc(size ? size : 1u);
+}
+
+void* operator new[](size_t size) {
+  flutter::testing::tls_allocated_bytes += static_cast<int64_t>(size);
+  flutter::testing::tls_allocation_count++;
+  return std::malloc(size ? size : 1u);
+}
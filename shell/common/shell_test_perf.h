@@ -0,0 +1,115 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_SHELL_TEST_PERF_H_
+#define FLUTTER_SHELL_COMMON_SHELL_TEST_PERF_H_
+
+#include "flutter/common/task_runners.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "gtest/gtest.h"
+
+namespace benchmark {
+class State;
+}  // namespace benchmark
+
+namespace flutter {
+namespace testing {
+
+// Cost counters observed on one engine thread over a measurement window.
+struct ThreadPerfSample {
+  fml::TimeDelta cpu_time;
+  int64_t allocated_bytes = 0;
+  int64_t allocation_count = 0;
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Measures per-thread CPU time and heap allocations across the
+///             task runners of a shell under test, so hot-path budgets can be
+///             encoded as test assertions instead of regressing silently.
+///
+///             Allocation counters are thread local and maintained by this
+///             fixture's global operator new override, so they cover every
+///             allocation made on an instrumented thread, not just annotated
+///             call sites. Only allocations are counted; frees are ignored,
+///             making the counters monotonic and the deltas a measure of
+///             allocation churn. CPU time uses the per-thread CPU clock and
+///             reads as zero on Windows.
+///
+///             Windows are bracketed by sampling tasks posted to each runner.
+///             Since runners execute in order, work pumped between
+///             |BeginWindow| and |EndWindow| from the test thread is fully
+///             attributed to the window, and both calls drain previously
+///             posted tasks, keeping successive windows deterministic. The
+///             caller must not be running on any of the instrumented runners
+///             or the sampling tasks would deadlock against it.
+///
+class ShellTestPerfHarness {
+ public:
+  enum Thread {
+    kPlatform = 0,
+    kUI,
+    kRaster,
+    kIO,
+    kThreadCount,
+  };
+
+  explicit ShellTestPerfHarness(TaskRunners task_runners);
+
+  ~ShellTestPerfHarness();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Samples every runner's thread in place, blocking until all
+  ///             threads have executed their sampling task.
+  ///
+  void BeginWindow();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Closes the window opened by |BeginWindow| and records the
+  ///             per-thread deltas.
+  ///
+  void EndWindow();
+
+  //----------------------------------------------------------------------------
+  /// @brief      The deltas recorded by the most recently closed window.
+  ///
+  const ThreadPerfSample& GetSample(Thread thread) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Budget assertion: passes while the thread allocated fewer
+  ///             than |budget_bytes| bytes during the window. The failure
+  ///             message prints the measured cost against the budget.
+  ///
+  ::testing::AssertionResult AllocatedLessThan(Thread thread,
+                                               int64_t budget_bytes) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Budget assertion: passes while the thread consumed less CPU
+  ///             time than |budget| during the window.
+  ///
+  ::testing::AssertionResult CpuTimeLessThan(Thread thread,
+                                             fml::TimeDelta budget) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Publishes the window's samples on a google benchmark state
+  ///             label (e.g. "ui_cpu_us=120;ui_alloc_bytes=4096;...") so the
+  ///             budgets tracked by tests can also be emitted by benchmarks.
+  ///
+  void ReportToBenchmark(::benchmark::State& state) const;
+
+ private:
+  void Sample(ThreadPerfSample samples[kThreadCount]);
+
+  TaskRunners task_runners_;
+  ThreadPerfSample begin_samples_[kThreadCount];
+  ThreadPerfSample window_samples_[kThreadCount];
+  bool window_open_ = false;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ShellTestPerfHarness);
+};
+
+}  // namespace testing
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_SHELL_TEST_PERF_H_
@@ -24,6 +24,7 @@
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/shell_test.h"
 #include "flutter/shell/common/shell_test_external_view_embedder.h"
+#include "flutter/shell/common/shell_test_perf.h"
 #include "flutter/shell/common/shell_test_platform_view.h"
 #include "flutter/shell/common/switches.h"
 #include "flutter/shell/common/thread_host.h"
@@ -86,6 +87,57 @@ TEST_F(ShellTest, InitializeWithDifferentThreads) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
 }
 
+TEST_F(ShellTest, CanTearDownAsynchronously) {
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+  Settings settings = CreateSettingsForFixture();
+  ThreadHost thread_host("io.flutter.test." + GetCurrentTestName() + ".",
+                         ThreadHost::Type::Platform | ThreadHost::Type::GPU |
+                             ThreadHost::Type::IO | ThreadHost::Type::UI);
+  TaskRunners task_runners("test", thread_host.platform_thread->GetTaskRunner(),
+                           thread_host.raster_thread->GetTaskRunner(),
+                           thread_host.ui_thread->GetTaskRunner(),
+                           thread_host.io_thread->GetTaskRunner());
+  auto shell = CreateShell(std::move(settings), task_runners);
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  ASSERT_TRUE(DartVMRef::IsInstanceRunning());
+
+  fml::AutoResetWaitableEvent teardown_latch;
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners.GetPlatformTaskRunner(),
+      fml::MakeCopyable([shell = std::move(shell), &teardown_latch]() mutable {
+        Shell::TearDownAsynchronously(std::move(shell), [&teardown_latch]() {
+          teardown_latch.Signal();
+        });
+      }));
+  teardown_latch.Wait();
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+}
+
+TEST_F(ShellTest, SpawnedShellSharesIOManagerAndRasterCache) {
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+  Settings settings = CreateSettingsForFixture();
+  auto shell = CreateShell(settings);
+  ASSERT_TRUE(ValidateShell(shell.get()));
+
+  const auto launch_count = DartVM::GetVMLaunchCount();
+  auto spawned = SpawnShell(shell.get());
+  ASSERT_TRUE(ValidateShell(spawned.get()));
+
+  // The spawn referenced the running VM instead of booting another one.
+  EXPECT_EQ(DartVM::GetVMLaunchCount(), launch_count);
+  // One IO manager (resource context, unref queue, decoded image caches) and
+  // one raster cache serve both shells.
+  EXPECT_TRUE(ShellsShareIOManager(shell.get(), spawned.get()));
+  EXPECT_TRUE(ShellsShareRasterCache(shell.get(), spawned.get()));
+
+  // The shared components outlive the first shell torn down; the parent must
+  // remain fully functional after its spawn is gone.
+  DestroyShell(std::move(spawned));
+  ASSERT_TRUE(ValidateShell(shell.get()));
+  DestroyShell(std::move(shell));
+  ASSERT_FALSE(DartVMRef::IsInstanceRunning());
+}
+
 TEST_F(ShellTest, InitializeWithSingleThread) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
   Settings settings = CreateSettingsForFixture();
@@ -297,6 +349,35 @@ TEST_F(ShellTest, WhitelistedDartVMFlag) {
 #endif
 }
 
+TEST_F(ShellTest, PerfHarnessMeasuresFramePump) {
+  auto settings = CreateSettingsForFixture();
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+
+  // Create the surface needed by rasterizer
+  PlatformViewNotifyCreated(shell.get());
+
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("emptyMain");
+
+  RunEngine(shell.get(), std::move(configuration));
+
+  ShellTestPerfHarness harness(shell->GetTaskRunners());
+  harness.BeginWindow();
+  PumpOneFrame(shell.get());
+  harness.EndWindow();
+
+  // Pumping a frame must have run (and allocated) on the UI thread. The
+  // budgets asserted here are deliberately loose sanity bounds; real
+  // hot-path budgets belong in tests next to the paths they protect.
+  EXPECT_GT(harness.GetSample(ShellTestPerfHarness::kUI).allocation_count, 0);
+  EXPECT_TRUE(harness.AllocatedLessThan(ShellTestPerfHarness::kUI,
+                                        64 * 1024 * 1024));
+  EXPECT_TRUE(harness.CpuTimeLessThan(ShellTestPerfHarness::kUI,
+                                      fml::TimeDelta::FromSeconds(5)));
+
+  DestroyShell(std::move(shell));
+}
+
 TEST_F(ShellTest, NoNeedToReportTimingsByDefault) {
   auto settings = CreateSettingsForFixture();
   std::unique_ptr<Shell> shell = CreateShell(settings);
@@ -646,6 +727,30 @@ TEST_F(ShellTest, ReloadSystemFonts) {
   shell.reset();
 }
 
+TEST_F(ShellTest, MemoryPressureListenersAreNotifiedWithTheLevel) {
+  auto settings = CreateSettingsForFixture();
+  std::unique_ptr<Shell> shell = CreateShell(settings);
+
+  std::vector<Shell::MemoryPressureLevel> levels;
+  auto listener_id = shell->AddMemoryPressureListener(
+      [&levels](Shell::MemoryPressureLevel level) { levels.push_back(level); });
+
+  shell->NotifyMemoryPressure(Shell::MemoryPressureLevel::kModerate);
+  ASSERT_EQ(levels.size(), 1u);
+  ASSERT_EQ(levels.back(), Shell::MemoryPressureLevel::kModerate);
+
+  // The legacy warning maps to the critical tier.
+  shell->NotifyLowMemoryWarning();
+  ASSERT_EQ(levels.size(), 2u);
+  ASSERT_EQ(levels.back(), Shell::MemoryPressureLevel::kCritical);
+
+  shell->RemoveMemoryPressureListener(listener_id);
+  shell->NotifyMemoryPressure(Shell::MemoryPressureLevel::kCritical);
+  ASSERT_EQ(levels.size(), 2u);
+
+  DestroyShell(std::move(shell));
+}
+
 TEST_F(ShellTest, WaitForFirstFrame) {
   auto settings = CreateSettingsForFixture();
   std::unique_ptr<Shell> shell = CreateShell(settings);
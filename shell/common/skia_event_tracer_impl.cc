@@ -5,6 +5,10 @@
 #include "flutter/shell/common/skia_event_tracer_impl.h"
 
 #define TRACE_EVENT_HIDE_MACROS
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "flutter/fml/logging.h"
@@ -51,7 +55,88 @@ inline T BitCast(const U& u) {
   memcpy(&t, &u, sizeof(t));
   return t;
 }
-#endif
+#else  // defined(OS_FUCHSIA)
+
+// A fixed-size record handed from the thread running Skia to the drain
+// thread. Skia trace names are string literals with stable addresses, so the
+// pointer itself acts as the interned name id; no copies are made on the hot
+// path.
+struct SkiaTraceRecord {
+  int64_t timestamp_micros;
+  uint64_t id;
+  const char* name;
+  char phase;
+};
+
+// A bounded lock-free queue of trace records with a single consumer (the
+// drain thread). Multiple threads may run Skia, so producers claim slots with
+// a fetch-add and publish them via per-slot sequence numbers. Records are
+// dropped (counted, never blocked on) when the queue is full; stalling the
+// raster thread to preserve trace events would defeat the purpose.
+class SkiaTraceQueue {
+ public:
+  SkiaTraceQueue() {
+    for (size_t i = 0; i < kCapacity; i++) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bool Push(const SkiaTraceRecord& record) {
+    size_t position = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot& slot = slots_[position & kMask];
+      size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == position) {
+        if (head_.compare_exchange_weak(position, position + 1,
+                                        std::memory_order_relaxed)) {
+          slot.record = record;
+          slot.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (sequence < position) {
+        // The slot still holds a record the consumer has not drained.
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        position = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool Pop(SkiaTraceRecord& record) {
+    Slot& slot = slots_[tail_ & kMask];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != tail_ + 1) {
+      return false;
+    }
+    record = slot.record;
+    slot.sequence.store(tail_ + kCapacity, std::memory_order_release);
+    tail_++;
+    return true;
+  }
+
+  uint64_t dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr size_t kCapacity = 4096;
+  static constexpr size_t kMask = kCapacity - 1;
+  static_assert((kCapacity & kMask) == 0, "Capacity must be a power of two.");
+
+  struct Slot {
+    std::atomic_size_t sequence;
+    SkiaTraceRecord record;
+  };
+
+  Slot slots_[kCapacity];
+  std::atomic_size_t head_ = {0};
+  // Only touched by the consumer.
+  size_t tail_ = 0;
+  std::atomic_uint64_t dropped_ = {0};
+};
+
+#endif  // defined(OS_FUCHSIA)
 
 }  // namespace
 
@@ -61,7 +146,13 @@ class FlutterEventTracer : public SkEventTracer {
   static constexpr uint8_t kYes = 1;
   static constexpr uint8_t kNo = 0;
 
-  FlutterEventTracer(bool enabled) : enabled_(enabled ? kYes : kNo){};
+  FlutterEventTracer(bool enabled) : enabled_(enabled ? kYes : kNo) {
+#if !defined(OS_FUCHSIA)
+    if (enabled) {
+      StartDrainThread();
+    }
+#endif
+  };
 
   SkEventTracer::Handle addTraceEvent(char phase,
                                       const uint8_t* category_enabled_flag,
@@ -184,26 +275,10 @@ class FlutterEventTracer : public SkEventTracer {
     trace_release_context(trace_context);
 
 #else   // defined(OS_FUCHSIA)
-    switch (phase) {
-      case TRACE_EVENT_PHASE_BEGIN:
-      case TRACE_EVENT_PHASE_COMPLETE:
-        fml::tracing::TraceEvent0(kSkiaTag, name);
-        break;
-      case TRACE_EVENT_PHASE_END:
-        fml::tracing::TraceEventEnd(name);
-        break;
-      case TRACE_EVENT_PHASE_INSTANT:
-        fml::tracing::TraceEventInstant0(kSkiaTag, name);
-        break;
-      case TRACE_EVENT_PHASE_ASYNC_BEGIN:
-        fml::tracing::TraceEventAsyncBegin0(kSkiaTag, name, id);
-        break;
-      case TRACE_EVENT_PHASE_ASYNC_END:
-        fml::tracing::TraceEventAsyncEnd0(kSkiaTag, name, id);
-        break;
-      default:
-        break;
-    }
+    // Record the timestamp here but emit the timeline event from the drain
+    // thread; the Dart timeline write is far more expensive than the queue
+    // push and would otherwise perturb the very workload being traced.
+    queue_.Push({Dart_TimelineGetMicros(), id, name, phase});
 #endif  // defined(OS_FUCHSIA)
     return 0;
   }
@@ -216,7 +291,7 @@ class FlutterEventTracer : public SkEventTracer {
 #if defined(OS_FUCHSIA)
     TRACE_DURATION_END(kSkiaTag, name);
 #else
-    fml::tracing::TraceEventEnd(name);
+    queue_.Push({Dart_TimelineGetMicros(), 0, name, TRACE_EVENT_PHASE_END});
 #endif
   }
 
@@ -229,10 +304,72 @@ class FlutterEventTracer : public SkEventTracer {
     return kSkiaTag;
   }
 
-  void enable() { enabled_ = kYes; }
+  void enable() {
+    enabled_ = kYes;
+#if !defined(OS_FUCHSIA)
+    StartDrainThread();
+#endif
+  }
 
  private:
   uint8_t enabled_;
+#if !defined(OS_FUCHSIA)
+  SkiaTraceQueue queue_;
+  std::mutex drain_thread_mutex_;
+  std::thread drain_thread_;
+
+  void StartDrainThread() {
+    std::scoped_lock lock(drain_thread_mutex_);
+    if (drain_thread_.joinable()) {
+      return;
+    }
+    // The tracer is intentionally leaked (see InitSkiaEventTracer), so the
+    // drain thread runs for the remainder of the process.
+    drain_thread_ = std::thread([this]() { DrainLoop(); });
+  }
+
+  void DrainLoop() {
+    SkiaTraceRecord record;
+    for (;;) {
+      if (!queue_.Pop(record)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        continue;
+      }
+      switch (record.phase) {
+        case TRACE_EVENT_PHASE_BEGIN:
+        case TRACE_EVENT_PHASE_COMPLETE:
+          fml::tracing::TraceTimelineEvent(kSkiaTag, record.name,
+                                           record.timestamp_micros, 0,
+                                           Dart_Timeline_Event_Begin, {}, {});
+          break;
+        case TRACE_EVENT_PHASE_END:
+          fml::tracing::TraceTimelineEvent(kSkiaTag, record.name,
+                                           record.timestamp_micros, 0,
+                                           Dart_Timeline_Event_End, {}, {});
+          break;
+        case TRACE_EVENT_PHASE_INSTANT:
+          fml::tracing::TraceTimelineEvent(kSkiaTag, record.name,
+                                           record.timestamp_micros, 0,
+                                           Dart_Timeline_Event_Instant, {},
+                                           {});
+          break;
+        case TRACE_EVENT_PHASE_ASYNC_BEGIN:
+          fml::tracing::TraceTimelineEvent(
+              kSkiaTag, record.name, record.timestamp_micros, record.id,
+              Dart_Timeline_Event_Async_Begin, {}, {});
+          break;
+        case TRACE_EVENT_PHASE_ASYNC_END:
+          fml::tracing::TraceTimelineEvent(
+              kSkiaTag, record.name, record.timestamp_micros, record.id,
+              Dart_Timeline_Event_Async_End, {}, {});
+          break;
+        default:
+          break;
+      }
+    }
+  }
+#endif  // !defined(OS_FUCHSIA)
+
   FML_DISALLOW_COPY_AND_ASSIGN(FlutterEventTracer);
 };
 
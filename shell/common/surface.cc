@@ -18,4 +18,12 @@ std::unique_ptr<GLContextResult> Surface::MakeRenderContextCurrent() {
   return std::make_unique<GLContextDefaultResult>(true);
 }
 
+std::optional<fml::TimeDelta> Surface::GetGpuFrameDuration() {
+  return std::nullopt;
+}
+
+bool Surface::SupportsSpeculativeFrameAcquisition() const {
+  return false;
+}
+
 }  // namespace flutter
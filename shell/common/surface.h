@@ -6,8 +6,10 @@
 #define FLUTTER_SHELL_COMMON_SURFACE_H_
 
 #include <memory>
+#include <optional>
 
 #include "flutter/flow/compositor_context.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/flow/embedded_views.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/common/surface_frame.h"
@@ -33,6 +35,22 @@ class Surface {
 
   virtual std::unique_ptr<GLContextResult> MakeRenderContextCurrent();
 
+  // Returns the time the GPU spent executing the command buffers of a
+  // recently presented frame, if the backing API exposes timer queries.
+  // Results are read back asynchronously, so the measurement usually lags
+  // the presented frame by one or more frames. The default implementation
+  // reports no measurement.
+  virtual std::optional<fml::TimeDelta> GetGpuFrameDuration();
+
+  // Whether a frame may be acquired before the layer tree for it has been
+  // built and held until the draw arrives. This lets the rasterizer overlap
+  // frame acquisition with the UI thread's build. Only surfaces whose frames
+  // are plain render target wrappers may opt in; surfaces that hand out
+  // finite swapchain images must refuse, since an unsubmitted image held
+  // across a skipped frame can starve the swapchain. The default
+  // implementation refuses.
+  virtual bool SupportsSpeculativeFrameAcquisition() const;
+
  private:
   FML_DISALLOW_COPY_AND_ASSIGN(Surface);
 };
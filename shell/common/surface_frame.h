@@ -6,8 +6,10 @@
 #define FLUTTER_SHELL_COMMON_SURFACE_FRAME_H_
 
 #include <memory>
+#include <optional>
 
 #include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/shell/common/gl_context_switch.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkSurface.h"
@@ -21,6 +23,9 @@ class SurfaceFrame {
   using SubmitCallback =
       std::function<bool(const SurfaceFrame& surface_frame, SkCanvas* canvas)>;
 
+  using PresentedCallback =
+      std::function<void(fml::TimePoint presentation_time)>;
+
   SurfaceFrame(sk_sp<SkSurface> surface,
                bool supports_readback,
                const SubmitCallback& submit_callback);
@@ -42,11 +47,74 @@ class SurfaceFrame {
 
   bool supports_readback() { return supports_readback_; }
 
+  // True if the target keeps the contents of the previously submitted frame
+  // outside the submitted damage region (e.g. EGL_EXT_buffer_age with an age
+  // of one). Backends that can make this guarantee opt in after acquiring
+  // the frame; the rasterizer only clips painting to the damage region when
+  // they do.
+  void set_supports_partial_repaint(bool supports_partial_repaint) {
+    supports_partial_repaint_ = supports_partial_repaint;
+  }
+
+  bool supports_partial_repaint() const { return supports_partial_repaint_; }
+
+  // The area of this frame that differs from the previously submitted frame,
+  // in root surface coordinates. Set by the rasterizer before submission so
+  // that submit callbacks can hand it to swap-with-damage extensions such as
+  // KHR_partial_update. Unset if the damage was not computed, in which case
+  // the whole frame must be assumed dirty.
+  void set_submit_damage(const SkRect& damage) { submit_damage_ = damage; }
+
+  const std::optional<SkRect>& submit_damage() const { return submit_damage_; }
+
+  // The region of this frame's backing store that is stale relative to the
+  // last presented frame, in the same coordinate space as the submitted
+  // damage. Surfaces that hand out backbuffers more than one frame old (an
+  // EGL buffer age greater than one) populate this before returning the
+  // frame; the rasterizer repaints it in addition to its own damage. Empty
+  // when the backing store already matches the previous frame.
+  void set_existing_damage(const SkRect& damage) { existing_damage_ = damage; }
+
+  const SkRect& existing_damage() const { return existing_damage_; }
+
+  // The vsync deadline this frame is expected to be displayed at, taken
+  // from the layer tree that produced it. Set by the rasterizer before
+  // submission; backends that can schedule presentation (such as
+  // eglPresentationTimeANDROID) pass it to the compositor so it latches the
+  // frame on the intended vsync instead of guessing. Unset when the frame
+  // was not produced against a vsync (e.g. service protocol screenshots).
+  void set_target_present_time(fml::TimePoint time) {
+    target_present_time_ = time;
+  }
+
+  const std::optional<fml::TimePoint>& target_present_time() const {
+    return target_present_time_;
+  }
+
+  // Set by the rasterizer before submission. Backends that can observe the
+  // compositor actually displaying this frame (a Metal presented handler,
+  // EGL frame timestamps) copy this out of the frame in their submit
+  // callback and invoke it at most once, from any thread, when presentation
+  // happens. Backends without a presentation signal leave it alone and the
+  // rasterizer treats the submit itself as the presentation.
+  void set_presented_callback(const PresentedCallback& callback) {
+    presented_callback_ = callback;
+  }
+
+  const PresentedCallback& presented_callback() const {
+    return presented_callback_;
+  }
+
  private:
   bool submitted_ = false;
   sk_sp<SkSurface> surface_;
   bool supports_readback_;
+  bool supports_partial_repaint_ = false;
+  std::optional<SkRect> submit_damage_;
+  std::optional<fml::TimePoint> target_present_time_;
+  SkRect existing_damage_ = SkRect::MakeEmpty();
   SubmitCallback submit_callback_;
+  PresentedCallback presented_callback_;
   std::unique_ptr<GLContextResult> context_result_;
 
   bool PerformSubmit();
@@ -6,9 +6,12 @@
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
+#include "flutter/fml/logging.h"
 #include "flutter/fml/native_library.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/size.h"
@@ -30,7 +33,7 @@ struct SwitchDesc {
 #undef DEF_SWITCHES_END
 
 // clang-format off
-#define DEF_SWITCHES_START static const struct SwitchDesc gSwitchDescs[] = {
+#define DEF_SWITCHES_START static constexpr SwitchDesc gSwitchDescs[] = {
 #define DEF_SWITCH(p_swtch, p_flag, p_help) \
   { flutter::Switch:: p_swtch, p_flag, p_help },
 #define DEF_SWITCHES_END };
@@ -140,12 +143,15 @@ void PrintUsage(const std::string& executable_name) {
 }
 
 const std::string_view FlagForSwitch(Switch swtch) {
-  for (uint32_t i = 0; i < static_cast<uint32_t>(Switch::Sentinel); i++) {
-    if (gSwitchDescs[i].sw == swtch) {
-      return gSwitchDescs[i].flag;
-    }
+  const uint32_t index = static_cast<uint32_t>(swtch);
+  if (index >= static_cast<uint32_t>(Switch::Sentinel)) {
+    return std::string_view();
   }
-  return std::string_view();
+  // The table above is generated from the same DEF_SWITCH list that defines
+  // the enum, so it is indexed by the switch value itself; the linear scan
+  // this replaces ran for every settings lookup.
+  FML_DCHECK(gSwitchDescs[index].sw == swtch);
+  return gSwitchDescs[index].flag;
 }
 
 static bool IsWhitelistedDartVMFlag(const std::string& flag) {
@@ -208,7 +214,8 @@ std::unique_ptr<fml::Mapping> GetSymbolMapping(std::string symbol_prefix,
   return std::make_unique<fml::NonOwnedMapping>(mapping, size);
 }
 
-Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
+static Settings ComputeSettingsFromCommandLine(
+    const fml::CommandLine& command_line) {
   Settings settings = {};
 
   // Enable Observatory
@@ -237,6 +244,10 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
     }
   }
 
+  // Defer the observatory HTTP server startup until a client asks for it.
+  settings.lazy_observatory =
+      command_line.HasOption(FlagForSwitch(Switch::LazyObservatory));
+
   settings.disable_http =
       command_line.HasOption(FlagForSwitch(Switch::DisableHttp));
 
@@ -281,6 +292,12 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
   settings.trace_systrace =
       command_line.HasOption(FlagForSwitch(Switch::TraceSystrace));
 
+  GetSwitchValue(command_line, Switch::ConcurrentWorkerCount,
+                 &settings.concurrent_worker_count);
+
+  settings.prefer_reduced_color_depth =
+      command_line.HasOption(FlagForSwitch(Switch::PreferReducedColorDepth));
+
   settings.skia_deterministic_rendering_on_cpu =
       command_line.HasOption(FlagForSwitch(Switch::SkiaDeterministicRendering));
 
@@ -380,6 +397,34 @@ Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
   settings.cache_sksl =
       command_line.HasOption(FlagForSwitch(Switch::CacheSkSL));
 
+  settings.cache_gl_program_binaries =
+      command_line.HasOption(FlagForSwitch(Switch::CacheGLProgramBinaries));
+
+  return settings;
+}
+
+Settings SettingsFromCommandLine(const fml::CommandLine& command_line) {
+  // Add-to-app embedders create engines repeatedly with identical flags;
+  // remember the last parse so those launches skip the option conversions.
+  static std::mutex settings_cache_mutex;
+  static fml::CommandLine cached_command_line;
+  static std::unique_ptr<Settings> cached_settings;
+
+  {
+    std::scoped_lock lock(settings_cache_mutex);
+    if (cached_settings && command_line == cached_command_line) {
+      return *cached_settings;
+    }
+  }
+
+  Settings settings = ComputeSettingsFromCommandLine(command_line);
+
+  {
+    std::scoped_lock lock(settings_cache_mutex);
+    cached_command_line = command_line;
+    cached_settings = std::make_unique<Settings>(settings);
+  }
+
   return settings;
 }
 
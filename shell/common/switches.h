@@ -79,6 +79,11 @@ DEF_SWITCH(DisableObservatory,
            "disable-observatory",
            "Disable the Dart Observatory. The observatory is never available "
            "in release mode.")
+DEF_SWITCH(LazyObservatory,
+           "lazy-observatory",
+           "Defer starting the Dart Observatory HTTP server until a client "
+           "requests it. The service protocol remains enabled; only the "
+           "server startup is taken off the application launch path.")
 DEF_SWITCH(IPv6,
            "ipv6",
            "Bind to the IPv6 localhost address for the Dart Observatory. "
@@ -98,6 +103,18 @@ DEF_SWITCH(EnableSoftwareRendering,
            "Enable rendering using the Skia software backend. This is useful "
            "when testing Flutter on emulators. By default, Flutter will "
            "attempt to either use OpenGL or Vulkan.")
+DEF_SWITCH(ConcurrentWorkerCount,
+           "concurrent-worker-count",
+           "Maximum number of threads in the shared concurrent worker pool. "
+           "Defaults to one per hardware thread. Worker threads are started "
+           "on demand and exit when idle, so this bounds the pool rather "
+           "than sizing it.")
+DEF_SWITCH(PreferReducedColorDepth,
+           "prefer-reduced-color-depth",
+           "Prefer a 16 bit (RGB565) onscreen framebuffer over the default "
+           "32 bit one when the rendering backend offers such a "
+           "configuration. Trades color depth for framebuffer bandwidth on "
+           "memory constrained devices.")
 DEF_SWITCH(SkiaDeterministicRendering,
            "skia-deterministic-rendering",
            "Skips the call to SkGraphics::Init(), thus avoiding swapping out "
@@ -145,6 +162,13 @@ DEF_SWITCH(CacheSkSL,
            "should only be used during development phases. The generated SkSLs "
            "can later be used in the release build for shader precompilation "
            "at launch in order to eliminate the shader-compile jank.")
+DEF_SWITCH(CacheGLProgramBinaries,
+           "cache-gl-program-binaries",
+           "Persist linked GL program binaries instead of shader sources on "
+           "backends that support glProgramBinary. Warm launches then skip "
+           "the driver compile and link entirely. Binaries are keyed by a "
+           "fingerprint of the driver and GPU, so a driver update falls back "
+           "to compiling from source. Ignored when cache-sksl is set.")
 DEF_SWITCH(
     TraceSystrace,
     "trace-systrace",
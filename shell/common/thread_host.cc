@@ -6,29 +6,47 @@
 
 namespace flutter {
 
+ThreadHost::ThreadHostConfig ThreadHost::MakeDefaultConfig(
+    const std::string& name_prefix) {
+  ThreadHostConfig config;
+  config.platform_config = fml::ThreadConfig(name_prefix + ".platform",
+                                             fml::ThreadPriority::kDisplay);
+  config.ui_config =
+      fml::ThreadConfig(name_prefix + ".ui", fml::ThreadPriority::kDisplay);
+  config.raster_config =
+      fml::ThreadConfig(name_prefix + ".raster", fml::ThreadPriority::kRaster);
+  config.io_config = fml::ThreadConfig(name_prefix + ".io");
+  config.profiler_config = fml::ThreadConfig(name_prefix + ".profiler",
+                                             fml::ThreadPriority::kBackground);
+  return config;
+}
+
 ThreadHost::ThreadHost() = default;
 
 ThreadHost::ThreadHost(ThreadHost&&) = default;
 
-ThreadHost::ThreadHost(std::string name_prefix, uint64_t mask) {
+ThreadHost::ThreadHost(std::string name_prefix, uint64_t mask)
+    : ThreadHost(MakeDefaultConfig(name_prefix), mask) {}
+
+ThreadHost::ThreadHost(const ThreadHostConfig& config, uint64_t mask) {
   if (mask & ThreadHost::Type::Platform) {
-    platform_thread = std::make_unique<fml::Thread>(name_prefix + ".platform");
+    platform_thread = std::make_unique<fml::Thread>(config.platform_config);
   }
 
   if (mask & ThreadHost::Type::UI) {
-    ui_thread = std::make_unique<fml::Thread>(name_prefix + ".ui");
+    ui_thread = std::make_unique<fml::Thread>(config.ui_config);
   }
 
   if (mask & ThreadHost::Type::GPU) {
-    raster_thread = std::make_unique<fml::Thread>(name_prefix + ".raster");
+    raster_thread = std::make_unique<fml::Thread>(config.raster_config);
   }
 
   if (mask & ThreadHost::Type::IO) {
-    io_thread = std::make_unique<fml::Thread>(name_prefix + ".io");
+    io_thread = std::make_unique<fml::Thread>(config.io_config);
   }
 
   if (mask & ThreadHost::Type::Profiler) {
-    profiler_thread = std::make_unique<fml::Thread>(name_prefix + ".profiler");
+    profiler_thread = std::make_unique<fml::Thread>(config.profiler_config);
   }
 }
 
@@ -22,6 +22,24 @@ struct ThreadHost {
     Profiler = 1 << 4,
   };
 
+  /// The per-thread configurations used to create the threads of the host.
+  /// Embedders may override individual entries (for example to pin the
+  /// raster thread to the big cores of a big.LITTLE SoC) before passing the
+  /// config to the |ThreadHost| constructor, and may rebalance a running
+  /// thread later via |fml::Thread::UpdateConfig|.
+  struct ThreadHostConfig {
+    fml::ThreadConfig platform_config;
+    fml::ThreadConfig ui_config;
+    fml::ThreadConfig raster_config;
+    fml::ThreadConfig io_config;
+    fml::ThreadConfig profiler_config;
+  };
+
+  /// The default configuration: the UI and platform threads run at display
+  /// priority, the raster thread at raster priority and the profiler thread
+  /// in the background. No affinity masks are set.
+  static ThreadHostConfig MakeDefaultConfig(const std::string& name_prefix);
+
   std::unique_ptr<fml::Thread> platform_thread;
   std::unique_ptr<fml::Thread> ui_thread;
   std::unique_ptr<fml::Thread> raster_thread;
@@ -36,6 +54,8 @@ struct ThreadHost {
 
   ThreadHost(std::string name_prefix, uint64_t type_mask);
 
+  ThreadHost(const ThreadHostConfig& config, uint64_t type_mask);
+
   ~ThreadHost();
 
   void Reset();
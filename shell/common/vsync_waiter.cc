@@ -11,6 +11,11 @@ namespace flutter {
 
 static constexpr const char* kVsyncFlowName = "VsyncFlow";
 
+// Scheduling jitter headroom subtracted from the predicted slack before
+// deferring the frame callback.
+static constexpr fml::TimeDelta kPredictiveWakeMargin =
+    fml::TimeDelta::FromMilliseconds(1);
+
 #if defined(OS_FUCHSIA)
 //  ________  _________  ________  ________
 // |\   ____\|\___   ___\\   __  \|\   __  \
@@ -92,13 +97,41 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
                                fml::TimePoint frame_target_time) {
   Callback callback;
   fml::closure secondary_callback;
+  bool skipped_for_cadence = false;
 
   {
     std::scoped_lock lock(callback_mutex_);
-    callback = std::move(callback_);
+    const uint32_t divisor =
+        frame_cadence_divisor_.load(std::memory_order_relaxed);
+    if (callback_ && divisor > 1 && ++vsyncs_since_callback_ < divisor) {
+      // Leave the primary callback armed; this vsync is skipped to honor the
+      // reduced cadence.
+      skipped_for_cadence = true;
+    } else {
+      vsyncs_since_callback_ = 0;
+      callback = std::move(callback_);
+      if (divisor > 1) {
+        // Stretch the target over the periods this frame covers so that
+        // animation timestamps keep advancing at wall clock rate.
+        frame_target_time =
+            frame_target_time +
+            fml::TimeDelta::FromMicroseconds(
+                (frame_target_time - frame_start_time).ToMicroseconds() *
+                (divisor - 1));
+      }
+    }
     secondary_callback = std::move(secondary_callback_);
   }
 
+  if (skipped_for_cadence) {
+    if (secondary_callback) {
+      task_runners_.GetUITaskRunner()->PostTaskForTime(
+          std::move(secondary_callback), frame_start_time);
+    }
+    AwaitVSync();
+    return;
+  }
+
   if (!callback && !secondary_callback) {
     // This means that the vsync waiter implementation fired a callback for a
     // request we did not make. This is a paranoid check but we still want to
@@ -110,6 +143,11 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
   if (callback) {
     auto flow_identifier = fml::tracing::TraceNonce();
 
+    fml::TimePoint callback_time = frame_start_time;
+    if (predictive_scheduling_enabled_) {
+      callback_time = PredictWakeTime(frame_start_time, frame_target_time);
+    }
+
     // The base trace ensures that flows have a root to begin from if one does
     // not exist. The trace viewer will ignore traces that have no base event
     // trace. While all our message loops insert a base trace trace
@@ -128,7 +166,7 @@ void VsyncWaiter::FireCallback(fml::TimePoint frame_start_time,
           callback(frame_start_time, frame_target_time);
           TRACE_FLOW_END("flutter", kVsyncFlowName, flow_identifier);
         },
-        frame_start_time);
+        callback_time);
   }
 
   if (secondary_callback) {
@@ -141,4 +179,69 @@ float VsyncWaiter::GetDisplayRefreshRate() const {
   return kUnknownRefreshRateFPS;
 }
 
+void VsyncWaiter::SetFrameCadence(uint32_t divisor) {
+  frame_cadence_divisor_.store(divisor == 0 ? 1 : divisor,
+                               std::memory_order_relaxed);
+}
+
+bool VsyncWaiter::SetDesiredFrameInterval(fml::TimeDelta interval) {
+  // Backends without rate negotiation rely on |SetFrameCadence| skipping.
+  return false;
+}
+
+void VsyncWaiter::SetPredictiveSchedulingEnabled(bool enabled) {
+  predictive_scheduling_enabled_ = enabled;
+}
+
+void VsyncWaiter::RecordFrameBuildDuration(fml::TimeDelta build_duration) {
+  if (!predictive_scheduling_enabled_) {
+    return;
+  }
+  const int64_t sample = build_duration.ToMicroseconds();
+  if (sample <= 0) {
+    return;
+  }
+  const int64_t average =
+      predicted_build_time_micros_.load(std::memory_order_relaxed);
+  // New samples contribute a quarter to the moving average so that one
+  // unusually fast frame does not erase the headroom a slow one needs.
+  predicted_build_time_micros_.store(
+      average == 0 ? sample : (3 * average + sample) / 4,
+      std::memory_order_relaxed);
+}
+
+fml::TimePoint VsyncWaiter::PredictWakeTime(
+    fml::TimePoint frame_start_time,
+    fml::TimePoint frame_target_time) const {
+  const int64_t predicted_build_micros =
+      predicted_build_time_micros_.load(std::memory_order_relaxed);
+  const fml::TimeDelta frame_interval = frame_target_time - frame_start_time;
+  if (predicted_build_micros <= 0 ||
+      frame_interval <= fml::TimeDelta::Zero()) {
+    return frame_start_time;
+  }
+
+  fml::TimeDelta slack =
+      frame_interval -
+      fml::TimeDelta::FromMicroseconds(predicted_build_micros) -
+      kPredictiveWakeMargin;
+  if (slack < fml::TimeDelta::Zero()) {
+    slack = fml::TimeDelta::Zero();
+  }
+  // Never defer past half the period so that a misprediction overshoots the
+  // deadline by a bounded amount.
+  if (slack > frame_interval / 2) {
+    slack = frame_interval / 2;
+  }
+
+#if !FLUTTER_RELEASE
+  FML_TRACE_COUNTER("flutter", "VsyncWakeSlack",
+                    reinterpret_cast<int64_t>(this),  //
+                    "SlackMicros", slack.ToMicroseconds(),
+                    "PredictedBuildMicros", predicted_build_micros);
+#endif  // !FLUTTER_RELEASE
+
+  return frame_start_time + slack;
+}
+
 }  // namespace flutter
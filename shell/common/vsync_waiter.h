@@ -5,6 +5,7 @@
 #ifndef FLUTTER_SHELL_COMMON_VSYNC_WAITER_H_
 #define FLUTTER_SHELL_COMMON_VSYNC_WAITER_H_
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -36,6 +37,37 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
   // Return kUnknownRefreshRateFPS if the refresh rate is unknown.
   virtual float GetDisplayRefreshRate() const;
 
+  /// When enabled, the frame callback is woken late within the vsync period
+  /// if recent frames indicate that UI frame construction will comfortably
+  /// finish before the frame target anyway. Building later means input is
+  /// sampled closer to presentation, which lowers input-to-photon latency.
+  ///
+  /// See also |Settings::predictive_vsync_wake|.
+  void SetPredictiveSchedulingEnabled(bool enabled);
+
+  /// Feed an observed UI frame build duration into the wake time predictor.
+  /// Called by the animator after each frame it builds. Has no effect unless
+  /// predictive scheduling is enabled.
+  void RecordFrameBuildDuration(fml::TimeDelta build_duration);
+
+  /// Deliver the frame callback only on every Nth vsync. A divisor of one
+  /// (the default) renders at the display rate, two at half rate and three
+  /// at a third. Skipped vsyncs immediately re-arm the wait so the cadence
+  /// stays aligned with the display; secondary callbacks still fire on every
+  /// vsync. On delivered frames, the frame target time is stretched to cover
+  /// the skipped periods so animation timestamps advance correctly. Thread
+  /// safe.
+  void SetFrameCadence(uint32_t divisor);
+
+  /// Hint the platform vsync source to pace callbacks near the given frame
+  /// interval. Backends driving variable refresh rate displays lower the
+  /// hardware rate itself instead of skipping vsyncs, which saves power and
+  /// keeps |GetDisplayRefreshRate| reporting the granted rate. Returns
+  /// whether the backend honors the hint; callers should fall back to
+  /// |SetFrameCadence| when it does not. The base implementation ignores
+  /// the hint. Thread safe.
+  virtual bool SetDesiredFrameInterval(fml::TimeDelta interval);
+
  protected:
   // On some backends, the |FireCallback| needs to be made from a static C
   // method.
@@ -59,6 +91,19 @@ class VsyncWaiter : public std::enable_shared_from_this<VsyncWaiter> {
   std::mutex callback_mutex_;
   Callback callback_;
 
+  std::atomic<uint32_t> frame_cadence_divisor_ = {1};
+  // The number of vsyncs skipped since the last delivered frame callback.
+  // Only touched under |callback_mutex_|.
+  uint32_t vsyncs_since_callback_ = 0;
+
+  std::atomic<bool> predictive_scheduling_enabled_ = {false};
+  // Exponential moving average of UI frame build durations. Written on the UI
+  // thread, read on the thread delivering vsync pulses.
+  std::atomic<int64_t> predicted_build_time_micros_ = {0};
+
+  fml::TimePoint PredictWakeTime(fml::TimePoint frame_start_time,
+                                 fml::TimePoint frame_target_time) const;
+
   std::mutex secondary_callback_mutex_;
   fml::closure secondary_callback_;
 
@@ -5,10 +5,20 @@
 #include "flutter/shell/common/vsync_waiter_fallback.h"
 
 #include "flutter/fml/logging.h"
+#include "flutter/fml/task_runner.h"
 
 namespace flutter {
 namespace {
 
+static constexpr fml::TimeDelta kDefaultFrameInterval =
+    fml::TimeDelta::FromSecondsF(1.0 / 60.0);
+
+// The fraction of the measured lateness folded back into the phase each
+// period. A small gain keeps the loop stable in the face of one-off
+// scheduling hiccups while still converging on the host's actual wake-up
+// cadence within a handful of frames.
+static constexpr int64_t kPhaseCorrectionDivisor = 8;
+
 static fml::TimePoint SnapToNextTick(fml::TimePoint value,
                                      fml::TimePoint tick_phase,
                                      fml::TimeDelta tick_interval) {
@@ -21,19 +31,75 @@ static fml::TimePoint SnapToNextTick(fml::TimePoint value,
 }  // namespace
 
 VsyncWaiterFallback::VsyncWaiterFallback(TaskRunners task_runners)
-    : VsyncWaiter(std::move(task_runners)), phase_(fml::TimePoint::Now()) {}
+    : VsyncWaiter(std::move(task_runners)),
+      phase_(fml::TimePoint::Now()),
+      frame_interval_(kDefaultFrameInterval) {}
 
 VsyncWaiterFallback::~VsyncWaiterFallback() = default;
 
+// |VsyncWaiter|
+bool VsyncWaiterFallback::SetDesiredFrameInterval(fml::TimeDelta interval) {
+  if (interval <= fml::TimeDelta::Zero()) {
+    return false;
+  }
+  std::scoped_lock lock(mutex_);
+  frame_interval_ = interval;
+  return true;
+}
+
+// |VsyncWaiter|
+float VsyncWaiterFallback::GetDisplayRefreshRate() const {
+  std::scoped_lock lock(mutex_);
+  return 1e9 / frame_interval_.ToNanosecondsF();
+}
+
+void VsyncWaiterFallback::SetClockSource(ClockSource clock_source) {
+  std::scoped_lock lock(mutex_);
+  clock_source_ = std::move(clock_source);
+}
+
+fml::TimePoint VsyncWaiterFallback::Now() const {
+  ClockSource clock_source;
+  {
+    std::scoped_lock lock(mutex_);
+    clock_source = clock_source_;
+  }
+  return clock_source ? clock_source() : fml::TimePoint::Now();
+}
+
 // |VsyncWaiter|
 void VsyncWaiterFallback::AwaitVSync() {
-  constexpr fml::TimeDelta kSingleFrameInterval =
-      fml::TimeDelta::FromSecondsF(1.0 / 60.0);
+  fml::TimePoint next;
+  fml::TimeDelta interval;
+  {
+    const fml::TimePoint now = Now();
+    std::scoped_lock lock(mutex_);
+    interval = frame_interval_;
+    next = SnapToNextTick(now, phase_, interval);
+  }
 
-  auto next =
-      SnapToNextTick(fml::TimePoint::Now(), phase_, kSingleFrameInterval);
+  std::weak_ptr<VsyncWaiterFallback> weak_this =
+      std::static_pointer_cast<VsyncWaiterFallback>(shared_from_this());
 
-  FireCallback(next, next + kSingleFrameInterval);
+  task_runners_.GetUITaskRunner()->PostTaskForTime(
+      [weak_this, next, interval]() {
+        auto self = weak_this.lock();
+        if (!self) {
+          return;
+        }
+        // Phase-locked loop: fold a fraction of the measured lateness back
+        // into the phase so the synthetic grid tracks when the host actually
+        // delivers our wake-ups rather than the times we asked for.
+        const fml::TimeDelta error = self->Now() - next;
+        if (error > fml::TimeDelta::Zero() && error < interval) {
+          std::scoped_lock lock(self->mutex_);
+          self->phase_ = self->phase_ +
+                         fml::TimeDelta::FromNanoseconds(
+                             error.ToNanoseconds() / kPhaseCorrectionDivisor);
+        }
+        self->FireCallback(next, next + interval);
+      },
+      next);
 }
 
 }  // namespace flutter
@@ -5,6 +5,9 @@
 #ifndef FLUTTER_SHELL_COMMON_VSYNC_WAITER_FALLBACK_H_
 #define FLUTTER_SHELL_COMMON_VSYNC_WAITER_FALLBACK_H_
 
+#include <functional>
+#include <mutex>
+
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/fml/time/time_point.h"
@@ -12,15 +15,44 @@
 
 namespace flutter {
 
-/// A |VsyncWaiter| that will fire at 60 fps irrespective of the vsync.
+/// A |VsyncWaiter| that synthesizes vsync pulses for platforms without a real
+/// vsync signal, such as headless CI runs and VM-hosted deployments.
+///
+/// The synthetic tick grid is phase-locked: the waiter measures when each
+/// scheduled pulse actually fired and applies a first order phase correction,
+/// so accumulated scheduling error does not make the grid beat against the
+/// host compositor and produce periodic double-frames. The refresh rate
+/// defaults to 60 fps and can be changed via |SetDesiredFrameInterval|; an
+/// external clock source can be supplied for deployments whose frame timing
+/// follows a virtualized or host-provided time base.
 class VsyncWaiterFallback final : public VsyncWaiter {
  public:
+  using ClockSource = std::function<fml::TimePoint(void)>;
+
   VsyncWaiterFallback(TaskRunners task_runners);
 
   ~VsyncWaiterFallback() override;
 
+  // |VsyncWaiter|
+  bool SetDesiredFrameInterval(fml::TimeDelta interval) override;
+
+  // |VsyncWaiter|
+  float GetDisplayRefreshRate() const override;
+
+  /// Replaces the system monotonic clock as the time base for the synthetic
+  /// tick grid. The source must be cheap to invoke and callable from any
+  /// thread. Passing a null source restores the system clock.
+  void SetClockSource(ClockSource clock_source);
+
  private:
+  // Guards the phase, interval and clock source, which are written on
+  // whichever thread configures the waiter and read on the UI thread.
+  mutable std::mutex mutex_;
   fml::TimePoint phase_;
+  fml::TimeDelta frame_interval_;
+  ClockSource clock_source_;
+
+  fml::TimePoint Now() const;
 
   // |VsyncWaiter|
   void AwaitVSync() override;
@@ -21,6 +21,13 @@
 #define GPU_GL_RGBA8 0x8058
 #define GPU_GL_RGBA4 0x8056
 #define GPU_GL_RGB565 0x8D62
+#define GPU_GL_VENDOR 0x1F00
+#define GPU_GL_RENDERER 0x1F01
+#define GPU_GL_VERSION 0x1F02
+#define GPU_GL_TIME_ELAPSED 0x88BF
+#define GPU_GL_QUERY_RESULT 0x8866
+#define GPU_GL_QUERY_RESULT_AVAILABLE 0x8867
+#define GPU_GL_GPU_DISJOINT 0x8FBB
 
 namespace flutter {
 
@@ -51,10 +58,31 @@ GPUSurfaceGL::GPUSurfaceGL(GPUSurfaceGLDelegate* delegate,
   if (PersistentCache::cache_sksl()) {
     FML_LOG(INFO) << "Cache SkSL";
     options.fShaderCacheStrategy = GrContextOptions::ShaderCacheStrategy::kSkSL;
+  } else if (PersistentCache::cache_program_binaries()) {
+    FML_LOG(INFO) << "Cache GL program binaries";
+    options.fShaderCacheStrategy =
+        GrContextOptions::ShaderCacheStrategy::kBackendBinary;
   }
   PersistentCache::MarkStrategySet();
   options.fPersistentCache = PersistentCache::GetCacheForProcess();
 
+  if (!PersistentCache::cache_sksl() &&
+      PersistentCache::cache_program_binaries()) {
+    // Program binaries are only loadable by the driver revision that wrote
+    // them; segregate the cache by a fingerprint of the GL vendor strings
+    // so a driver or GPU change starts from an empty directory instead of
+    // feeding stale binaries back to the driver.
+    const auto& gl = delegate_->GetGLInterface()->fFunctions;
+    std::string fingerprint;
+    for (auto name : {GPU_GL_VENDOR, GPU_GL_RENDERER, GPU_GL_VERSION}) {
+      if (const auto* value = gl.fGetString(name)) {
+        fingerprint += reinterpret_cast<const char*>(value);
+        fingerprint += '\n';
+      }
+    }
+    PersistentCache::GetCacheForProcess()->SetGpuFingerprint(fingerprint);
+  }
+
   options.fAvoidStencilBuffers = true;
 
   // To get video playback on the widest range of devices, we limit Skia to
@@ -89,6 +117,8 @@ GPUSurfaceGL::GPUSurfaceGL(GPUSurfaceGLDelegate* delegate,
   FML_LOG(INFO) << "Found " << caches.size() << " SkSL shaders; precompiled "
                 << compiled_count;
 
+  SetupGpuTimerQueries();
+
   delegate_->GLContextClearCurrent();
 }
 
@@ -106,6 +136,8 @@ GPUSurfaceGL::GPUSurfaceGL(sk_sp<GrContext> gr_context,
     return;
   }
 
+  SetupGpuTimerQueries();
+
   delegate_->GLContextClearCurrent();
 
   valid_ = true;
@@ -123,6 +155,13 @@ GPUSurfaceGL::~GPUSurfaceGL() {
     return;
   }
 
+  if (gpu_timer_supported_) {
+    const auto& gl = delegate_->GetGLInterface()->fFunctions;
+    if (gl.fDeleteQueries) {
+      gl.fDeleteQueries(kGpuTimerQueryCount, gpu_timer_queries_);
+    }
+  }
+
   onscreen_surface_ = nullptr;
   if (context_owner_) {
     context_->releaseResourcesAndAbandonContext();
@@ -138,12 +177,25 @@ bool GPUSurfaceGL::IsValid() {
 }
 
 static SkColorType FirstSupportedColorType(GrContext* context,
-                                           GrGLenum* format) {
+                                           GrGLenum* format,
+                                           SkColorType preferred) {
 #define RETURN_IF_RENDERABLE(x, y)                 \
   if (context->colorTypeSupportedAsSurface((x))) { \
     *format = (y);                                 \
     return (x);                                    \
   }
+  // The delegate knows the format of the framebuffer it negotiated; honor it
+  // first so the Skia color type matches the actual buffer.
+  switch (preferred) {
+    case kRGB_565_SkColorType:
+      RETURN_IF_RENDERABLE(kRGB_565_SkColorType, GPU_GL_RGB565);
+      break;
+    case kARGB_4444_SkColorType:
+      RETURN_IF_RENDERABLE(kARGB_4444_SkColorType, GPU_GL_RGBA4);
+      break;
+    default:
+      break;
+  }
   RETURN_IF_RENDERABLE(kRGBA_8888_SkColorType, GPU_GL_RGBA8);
   RETURN_IF_RENDERABLE(kARGB_4444_SkColorType, GPU_GL_RGBA4);
   RETURN_IF_RENDERABLE(kRGB_565_SkColorType, GPU_GL_RGB565);
@@ -152,9 +204,11 @@ static SkColorType FirstSupportedColorType(GrContext* context,
 
 static sk_sp<SkSurface> WrapOnscreenSurface(GrContext* context,
                                             const SkISize& size,
-                                            intptr_t fbo) {
+                                            intptr_t fbo,
+                                            SkColorType preferred_color_type) {
   GrGLenum format;
-  const SkColorType color_type = FirstSupportedColorType(context, &format);
+  const SkColorType color_type =
+      FirstSupportedColorType(context, &format, preferred_color_type);
 
   GrGLFramebufferInfo framebuffer_info = {};
   framebuffer_info.fFBOID = static_cast<GrGLuint>(fbo);
@@ -204,9 +258,10 @@ bool GPUSurfaceGL::CreateOrUpdateSurfaces(const SkISize& size) {
   sk_sp<SkSurface> onscreen_surface;
 
   onscreen_surface =
-      WrapOnscreenSurface(context_.get(),            // GL context
-                          size,                      // root surface size
-                          delegate_->GLContextFBO()  // window FBO ID
+      WrapOnscreenSurface(context_.get(),                  // GL context
+                          size,                            // root surface size
+                          delegate_->GLContextFBO(),       // window FBO ID
+                          delegate_->GLContextColorType()  // negotiated format
       );
 
   if (onscreen_surface == nullptr) {
@@ -257,18 +312,52 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceGL::AcquireFrame(const SkISize& size) {
   }
 
   surface->getCanvas()->setMatrix(root_surface_transformation);
+
+  BeginGpuTimerQuery();
+
   SurfaceFrame::SubmitCallback submit_callback =
       [weak = weak_factory_.GetWeakPtr()](const SurfaceFrame& surface_frame,
                                           SkCanvas* canvas) {
-        return weak ? weak->PresentSurface(canvas) : false;
+        return weak ? weak->PresentSurface(surface_frame, canvas) : false;
       };
 
-  return std::make_unique<SurfaceFrame>(
+  auto frame = std::make_unique<SurfaceFrame>(
       surface, delegate_->SurfaceSupportsReadback(), submit_callback,
       std::move(context_switch));
+
+  ConfigurePartialRepaint(frame.get());
+
+  return frame;
 }
 
-bool GPUSurfaceGL::PresentSurface(SkCanvas* canvas) {
+void GPUSurfaceGL::ConfigurePartialRepaint(SurfaceFrame* frame) {
+  if (!delegate_->GLContextSupportsPartialRepaint()) {
+    return;
+  }
+
+  const int buffer_age = delegate_->GLContextBufferAge();
+
+  // The backbuffer must hold a known earlier frame, and the damage of every
+  // frame presented since must be on record. A zero age means the buffer
+  // contents are undefined and the frame must be painted in full.
+  if (buffer_age <= 0 ||
+      static_cast<size_t>(buffer_age - 1) > damage_history_.size()) {
+    return;
+  }
+
+  // Pixels that changed between the frame in the buffer and the last
+  // presented frame are stale and must be repainted along with the new
+  // damage. An age of one leaves nothing stale.
+  SkRect existing_damage = SkRect::MakeEmpty();
+  for (int i = 0; i < buffer_age - 1; i++) {
+    existing_damage.join(damage_history_[i]);
+  }
+
+  frame->set_supports_partial_repaint(true);
+  frame->set_existing_damage(existing_damage);
+}
+
+bool GPUSurfaceGL::PresentSurface(const SurfaceFrame& frame, SkCanvas* canvas) {
   if (delegate_ == nullptr || canvas == nullptr || context_ == nullptr) {
     return false;
   }
@@ -278,10 +367,46 @@ bool GPUSurfaceGL::PresentSurface(SkCanvas* canvas) {
     onscreen_surface_->getCanvas()->flush();
   }
 
-  if (!delegate_->GLContextPresent()) {
+  EndGpuTimerQuery();
+
+  if (frame.target_present_time().has_value()) {
+    delegate_->GLContextSetPresentationTime(*frame.target_present_time());
+  }
+
+  // Handed off before the present because observers that track frames by id
+  // (EGL frame timestamps) must capture the id of the swap that carries this
+  // frame.
+  if (frame.presented_callback()) {
+    delegate_->GLContextObservePresentation(frame.presented_callback());
+  }
+
+  bool presented = false;
+  if (frame.supports_partial_repaint() && frame.submit_damage().has_value()) {
+    SkIRect damage;
+    frame.submit_damage()->roundOut(&damage);
+    presented = delegate_->GLContextPresentWithDamage(damage);
+  } else {
+    presented = delegate_->GLContextPresent();
+  }
+
+  if (!presented) {
     return false;
   }
 
+  // Record what this present changed so future buffers that come back around
+  // with a larger age know which regions are stale. A frame with unknown
+  // damage breaks the chain; partial repaint resumes once the history
+  // rebuilds.
+  if (frame.submit_damage().has_value()) {
+    damage_history_.push_front(*frame.submit_damage());
+    constexpr size_t kMaxDamageHistory = 8;
+    if (damage_history_.size() > kMaxDamageHistory) {
+      damage_history_.pop_back();
+    }
+  } else {
+    damage_history_.clear();
+  }
+
   if (delegate_->GLContextFBOResetAfterPresent()) {
     auto current_size =
         SkISize::Make(onscreen_surface_->width(), onscreen_surface_->height());
@@ -289,9 +414,10 @@ bool GPUSurfaceGL::PresentSurface(SkCanvas* canvas) {
     // The FBO has changed, ask the delegate for the new FBO and do a surface
     // re-wrap.
     auto new_onscreen_surface =
-        WrapOnscreenSurface(context_.get(),            // GL context
-                            current_size,              // root surface size
-                            delegate_->GLContextFBO()  // window FBO ID
+        WrapOnscreenSurface(context_.get(),             // GL context
+                            current_size,               // root surface size
+                            delegate_->GLContextFBO(),  // window FBO ID
+                            delegate_->GLContextColorType()  // format
         );
 
     if (!new_onscreen_surface) {
@@ -335,4 +461,112 @@ std::unique_ptr<GLContextResult> GPUSurfaceGL::MakeRenderContextCurrent() {
   return delegate_->GLContextMakeCurrent();
 }
 
+// |Surface|
+std::optional<fml::TimeDelta> GPUSurfaceGL::GetGpuFrameDuration() {
+  return last_gpu_frame_duration_;
+}
+
+// |Surface|
+bool GPUSurfaceGL::SupportsSpeculativeFrameAcquisition() const {
+  // GL frames wrap the onscreen framebuffer rather than a finite pool of
+  // swapchain images, so one may be acquired early and held until the draw
+  // without starving anything.
+  return true;
+}
+
+// Must be called with the main context current. Timer queries are optional
+// instrumentation; when the extension or any required entry point is missing,
+// the surface simply never reports a GPU frame duration.
+void GPUSurfaceGL::SetupGpuTimerQueries() {
+  auto interface = delegate_->GetGLInterface();
+  if (!interface) {
+    return;
+  }
+
+  const bool has_disjoint_timer_query =
+      interface->hasExtension("GL_EXT_disjoint_timer_query");
+  if (!has_disjoint_timer_query &&
+      !interface->hasExtension("GL_ARB_timer_query")) {
+    return;
+  }
+
+  const auto& gl = interface->fFunctions;
+  if (!gl.fGenQueries || !gl.fBeginQuery || !gl.fEndQuery ||
+      !gl.fGetQueryObjectuiv || !gl.fGetQueryObjectui64v) {
+    return;
+  }
+
+  gl.fGenQueries(kGpuTimerQueryCount, gpu_timer_queries_);
+
+  gpu_timer_supported_ = true;
+  // The disjoint flag only exists in the ES extension; desktop timer queries
+  // have no equivalent invalidation signal.
+  gpu_timer_check_disjoint_ = has_disjoint_timer_query && gl.fGetIntegerv;
+}
+
+void GPUSurfaceGL::BeginGpuTimerQuery() {
+  if (!gpu_timer_supported_ || gpu_timer_active_ ||
+      gpu_timer_query_in_flight_[gpu_timer_query_index_]) {
+    // All ring slots are awaiting results. Skip timing this frame rather
+    // than stalling for a readback.
+    return;
+  }
+
+  const auto& gl = delegate_->GetGLInterface()->fFunctions;
+  gl.fBeginQuery(GPU_GL_TIME_ELAPSED,
+                 gpu_timer_queries_[gpu_timer_query_index_]);
+  gpu_timer_active_ = true;
+}
+
+void GPUSurfaceGL::EndGpuTimerQuery() {
+  if (!gpu_timer_active_) {
+    return;
+  }
+
+  const auto& gl = delegate_->GetGLInterface()->fFunctions;
+  gl.fEndQuery(GPU_GL_TIME_ELAPSED);
+  gpu_timer_query_in_flight_[gpu_timer_query_index_] = true;
+  gpu_timer_query_index_ = (gpu_timer_query_index_ + 1) % kGpuTimerQueryCount;
+  gpu_timer_active_ = false;
+
+  HarvestGpuTimerQueries();
+}
+
+void GPUSurfaceGL::HarvestGpuTimerQueries() {
+  const auto& gl = delegate_->GetGLInterface()->fFunctions;
+
+  // When the GPU clock was disjoint (e.g. across a power state change), all
+  // pending measurements are unreliable and must be dropped.
+  bool disjoint = false;
+  if (gpu_timer_check_disjoint_) {
+    GrGLint disjoint_occurred = 0;
+    gl.fGetIntegerv(GPU_GL_GPU_DISJOINT, &disjoint_occurred);
+    disjoint = disjoint_occurred != 0;
+  }
+
+  // Walk from the oldest in-flight query; results become available in
+  // submission order, so stop at the first one still pending.
+  for (size_t i = 0; i < kGpuTimerQueryCount; i++) {
+    const size_t slot = (gpu_timer_query_index_ + i) % kGpuTimerQueryCount;
+    if (!gpu_timer_query_in_flight_[slot]) {
+      continue;
+    }
+    GrGLuint available = 0;
+    gl.fGetQueryObjectuiv(gpu_timer_queries_[slot],
+                          GPU_GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+      break;
+    }
+    gpu_timer_query_in_flight_[slot] = false;
+    if (disjoint) {
+      continue;
+    }
+    GrGLuint64 nanoseconds = 0;
+    gl.fGetQueryObjectui64v(gpu_timer_queries_[slot], GPU_GL_QUERY_RESULT,
+                            &nanoseconds);
+    last_gpu_frame_duration_ =
+        fml::TimeDelta::FromNanoseconds(static_cast<int64_t>(nanoseconds));
+  }
+}
+
 }  // namespace flutter
@@ -5,12 +5,15 @@
 #ifndef SHELL_GPU_GPU_SURFACE_GL_H_
 #define SHELL_GPU_GPU_SURFACE_GL_H_
 
+#include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "flutter/flow/embedded_views.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/shell/common/gl_context_switch.h"
 #include "flutter/shell/common/surface.h"
 #include "flutter/shell/gpu/gpu_surface_gl_delegate.h"
@@ -48,7 +51,17 @@ class GPUSurfaceGL : public Surface {
   // |Surface|
   std::unique_ptr<GLContextResult> MakeRenderContextCurrent() override;
 
+  // |Surface|
+  std::optional<fml::TimeDelta> GetGpuFrameDuration() override;
+
+  // |Surface|
+  bool SupportsSpeculativeFrameAcquisition() const override;
+
  private:
+  // A small ring of GL_EXT_disjoint_timer_query objects keeps one timing
+  // query in flight per frame without ever stalling on result readback.
+  static constexpr size_t kGpuTimerQueryCount = 4;
+
   GPUSurfaceGLDelegate* delegate_;
   sk_sp<GrContext> context_;
   sk_sp<SkSurface> onscreen_surface_;
@@ -59,6 +72,16 @@ class GPUSurfaceGL : public Surface {
   // external view embedder is present.
   const bool render_to_surface_;
   bool valid_ = false;
+  // Damage of recently presented frames, newest first. Used to compute the
+  // stale region of a backbuffer whose reported age is greater than one.
+  std::deque<SkRect> damage_history_;
+  GrGLuint gpu_timer_queries_[kGpuTimerQueryCount] = {};
+  bool gpu_timer_query_in_flight_[kGpuTimerQueryCount] = {};
+  size_t gpu_timer_query_index_ = 0;
+  bool gpu_timer_supported_ = false;
+  bool gpu_timer_check_disjoint_ = false;
+  bool gpu_timer_active_ = false;
+  std::optional<fml::TimeDelta> last_gpu_frame_duration_;
   fml::TaskRunnerAffineWeakPtrFactory<GPUSurfaceGL> weak_factory_;
 
   bool CreateOrUpdateSurfaces(const SkISize& size);
@@ -67,7 +90,17 @@ class GPUSurfaceGL : public Surface {
       const SkISize& untransformed_size,
       const SkMatrix& root_surface_transformation);
 
-  bool PresentSurface(SkCanvas* canvas);
+  void ConfigurePartialRepaint(SurfaceFrame* frame);
+
+  bool PresentSurface(const SurfaceFrame& frame, SkCanvas* canvas);
+
+  void SetupGpuTimerQueries();
+
+  void BeginGpuTimerQuery();
+
+  void EndGpuTimerQuery();
+
+  void HarvestGpuTimerQueries();
 
   FML_DISALLOW_COPY_AND_ASSIGN(GPUSurfaceGL);
 };
@@ -10,6 +10,23 @@ namespace flutter {
 
 GPUSurfaceGLDelegate::~GPUSurfaceGLDelegate() = default;
 
+bool GPUSurfaceGLDelegate::GLContextPresentWithDamage(const SkIRect& damage) {
+  return GLContextPresent();
+}
+
+void GPUSurfaceGLDelegate::GLContextSetPresentationTime(fml::TimePoint time) {}
+
+void GPUSurfaceGLDelegate::GLContextObservePresentation(
+    std::function<void(fml::TimePoint)> on_presented) {}
+
+bool GPUSurfaceGLDelegate::GLContextSupportsPartialRepaint() const {
+  return false;
+}
+
+int GPUSurfaceGLDelegate::GLContextBufferAge() const {
+  return 0;
+}
+
 bool GPUSurfaceGLDelegate::GLContextFBOResetAfterPresent() const {
   return false;
 }
@@ -18,6 +35,10 @@ bool GPUSurfaceGLDelegate::SurfaceSupportsReadback() const {
   return true;
 }
 
+SkColorType GPUSurfaceGLDelegate::GLContextColorType() const {
+  return kUnknown_SkColorType;
+}
+
 SkMatrix GPUSurfaceGLDelegate::GLContextSurfaceTransformation() const {
   SkMatrix matrix;
   matrix.setIdentity();
@@ -5,11 +5,16 @@
 #ifndef FLUTTER_SHELL_GPU_GPU_SURFACE_GL_DELEGATE_H_
 #define FLUTTER_SHELL_GPU_GPU_SURFACE_GL_DELEGATE_H_
 
+#include <functional>
+
 #include "flutter/flow/embedded_views.h"
 #include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/shell/common/gl_context_switch.h"
 #include "flutter/shell/gpu/gpu_surface_delegate.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkMatrix.h"
+#include "third_party/skia/include/core/SkRect.h"
 #include "third_party/skia/include/gpu/gl/GrGLInterface.h"
 
 namespace flutter {
@@ -32,6 +37,44 @@ class GPUSurfaceGLDelegate : public GPUSurfaceDelegate {
   // context and not any of the contexts dedicated for IO.
   virtual bool GLContextPresent() = 0;
 
+  // Called before GLContextPresent with the vsync deadline the frame being
+  // submitted was built for. Embedders whose compositor accepts a target
+  // presentation time (eglPresentationTimeANDROID) forward it so the frame
+  // is latched on the intended vsync instead of the compositor guessing.
+  // The default implementation ignores the hint.
+  virtual void GLContextSetPresentationTime(fml::TimePoint time);
+
+  // Called before GLContextPresent with a handler for the frame being
+  // submitted. Embedders that can observe the display actually showing the
+  // frame (EGL_ANDROID_get_frame_timestamps) retain the handler and invoke
+  // it at most once with the reported display time, which may be several
+  // presents later. The default implementation drops the handler, in which
+  // case the rasterizer treats the submit itself as the presentation.
+  virtual void GLContextObservePresentation(
+      std::function<void(fml::TimePoint)> on_presented);
+
+  // Called instead of GLContextPresent when the frame was rendered with
+  // partial repaint. |damage| is the region that changed since the last
+  // present, in device coordinates. Embedders that support
+  // EGL_KHR_swap_buffers_with_damage (or an equivalent swap-with-damage
+  // mechanism) should restrict the swap to this region; the default
+  // implementation ignores the region and performs a full swap via
+  // GLContextPresent().
+  virtual bool GLContextPresentWithDamage(const SkIRect& damage);
+
+  // Whether the main surface preserves the contents of previously presented
+  // buffers as described by EGL_EXT_buffer_age. When this returns true, the
+  // surface queries GLContextBufferAge() every frame and enables partial
+  // repaint whenever the age allows the undamaged region to be reused.
+  virtual bool GLContextSupportsPartialRepaint() const;
+
+  // The age of the current backbuffer as defined by EGL_EXT_buffer_age: one
+  // means the buffer holds the last presented frame, N that it is N frames
+  // old and zero that its contents are undefined. Only called with the main
+  // context current and only when GLContextSupportsPartialRepaint() returns
+  // true.
+  virtual int GLContextBufferAge() const;
+
   // The ID of the main window bound framebuffer. Typically FBO0.
   virtual intptr_t GLContextFBO() const = 0;
 
@@ -46,6 +89,14 @@ class GPUSurfaceGLDelegate : public GPUSurfaceDelegate {
   // circumstances such as a BackdropFilter.
   virtual bool SurfaceSupportsReadback() const;
 
+  // The color type of the main onscreen framebuffer the embedder negotiated,
+  // or kUnknown_SkColorType to let the GPU surface pick the first color type
+  // the context can render to. Embedders on memory-bandwidth constrained
+  // devices may negotiate a 16 bit framebuffer; the GPU surface then wraps
+  // the window FBO with the matching Skia color type, and offscreen layers
+  // inherit it through the surface characterization.
+  virtual SkColorType GLContextColorType() const;
+
   // A transformation applied to the onscreen surface before the canvas is
   // flushed.
   virtual SkMatrix GLContextSurfaceTransformation() const;
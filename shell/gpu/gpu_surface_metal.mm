@@ -99,6 +99,21 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetal::AcquireFrame(const SkISize& frame
         reinterpret_cast<id<CAMetalDrawable>>(next_drawable_));
     next_drawable_ = nullptr;
 
+    // Let the rasterizer know when the compositor actually put this frame on
+    // screen; submit-to-present latency is its backpressure signal. The handler
+    // runs on a Metal callback thread.
+    if (auto presented_callback = surface_frame.presented_callback()) {
+      if ([drawable.get() respondsToSelector:@selector(addPresentedHandler:)]) {
+        [drawable.get() addPresentedHandler:^(id<MTLDrawable> presented) {
+          const CFTimeInterval presented_time = presented.presentedTime;
+          presented_callback(presented_time > 0
+                                 ? fml::TimePoint::FromEpochDelta(
+                                       fml::TimeDelta::FromSecondsF(presented_time))
+                                 : fml::TimePoint::Now());
+        }];
+      }
+    }
+
     [command_buffer.get() commit];
     [command_buffer.get() waitUntilScheduled];
     [drawable.get() present];
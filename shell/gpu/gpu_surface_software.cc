@@ -4,11 +4,43 @@
 
 #include "flutter/shell/gpu/gpu_surface_software.h"
 
+#include <cstring>
 #include <memory>
 #include "flutter/fml/logging.h"
 
 namespace flutter {
 
+namespace {
+
+// Returns the vertical range of scanlines that differ between the two
+// pixmaps, or an empty rect when the frames are identical. The pixmaps must
+// share dimensions and color type. memcmp lowers to wide vector compares on
+// the toolchains we ship, so whole-row comparison stays cheap even for large
+// surfaces.
+SkIRect ComputeDirtyRowRange(const SkPixmap& current,
+                             const SkPixmap& previous) {
+  const size_t compare_bytes =
+      current.width() * static_cast<size_t>(current.info().bytesPerPixel());
+  int first_dirty_row = -1;
+  int last_dirty_row = -1;
+  for (int y = 0; y < current.height(); y++) {
+    if (::memcmp(current.addr(0, y), previous.addr(0, y), compare_bytes) !=
+        0) {
+      if (first_dirty_row < 0) {
+        first_dirty_row = y;
+      }
+      last_dirty_row = y;
+    }
+  }
+  if (first_dirty_row < 0) {
+    return SkIRect::MakeEmpty();
+  }
+  return SkIRect::MakeLTRB(0, first_dirty_row, current.width(),
+                           last_dirty_row + 1);
+}
+
+}  // namespace
+
 GPUSurfaceSoftware::GPUSurfaceSoftware(GPUSurfaceSoftwareDelegate* delegate,
                                        bool render_to_surface)
     : delegate_(delegate),
@@ -66,12 +98,48 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceSoftware::AcquireFrame(
 
     canvas->flush();
 
-    return self->delegate_->PresentBackingStore(surface_frame.SkiaSurface());
+    return self->PresentSurface(surface_frame.SkiaSurface());
   };
 
   return std::make_unique<SurfaceFrame>(backing_store, true, on_submit);
 }
 
+bool GPUSurfaceSoftware::PresentSurface(sk_sp<SkSurface> backing_store) {
+  SkPixmap current;
+  if (!backing_store->peekPixels(&current)) {
+    // Without direct pixel access there is nothing to diff against; present
+    // the full frame and drop any stale shadow copy.
+    previous_frame_.reset();
+    return delegate_->PresentBackingStore(std::move(backing_store));
+  }
+
+  // Unless a shadow copy of the previous frame with matching geometry is
+  // available, the whole frame counts as damaged.
+  SkIRect damage = SkIRect::MakeWH(current.width(), current.height());
+  SkPixmap previous;
+  if (previous_frame_.peekPixels(&previous) &&
+      previous.dimensions() == current.dimensions() &&
+      previous.colorType() == current.colorType()) {
+    damage = ComputeDirtyRowRange(current, previous);
+  }
+
+  // Stage this frame for the next diff. The copy is a straight memcpy, far
+  // cheaper than the full-frame encode the damage region saves downstream,
+  // and it keeps working when the delegate recycles a single backing store.
+  if (previous_frame_.dimensions() != current.dimensions() ||
+      previous_frame_.colorType() != current.colorType()) {
+    if (!previous_frame_.tryAllocPixels(current.info())) {
+      previous_frame_.reset();
+    }
+  }
+  if (!previous_frame_.isNull()) {
+    previous_frame_.writePixels(current);
+  }
+
+  return delegate_->PresentBackingStoreWithDamage(std::move(backing_store),
+                                                  damage);
+}
+
 // |Surface|
 SkMatrix GPUSurfaceSoftware::GetRootTransformation() const {
   // This backend does not currently support root surface transformations. Just
@@ -9,6 +9,7 @@
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/shell/common/surface.h"
 #include "flutter/shell/gpu/gpu_surface_software_delegate.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 
 namespace flutter {
 
@@ -35,7 +36,14 @@ class GPUSurfaceSoftware : public Surface {
   flutter::ExternalViewEmbedder* GetExternalViewEmbedder() override;
 
  private:
+  // Diffs the backing store against the previous frame so the delegate can
+  // present only the changed scanlines, then stages a copy for the next diff.
+  bool PresentSurface(sk_sp<SkSurface> backing_store);
+
   GPUSurfaceSoftwareDelegate* delegate_;
+  // Shadow copy of the last presented frame used for scanline diffing in
+  // |PresentSurface|.
+  SkBitmap previous_frame_;
   // TODO(38466): Refactor GPU surface APIs take into account the fact that an
   // external view embedder may want to render to the root surface. This is a
   // hack to make avoid allocating resources for the root surface when an
@@ -12,4 +12,11 @@ ExternalViewEmbedder* GPUSurfaceSoftwareDelegate::GetExternalViewEmbedder() {
   return nullptr;
 }
 
+bool GPUSurfaceSoftwareDelegate::PresentBackingStoreWithDamage(
+    sk_sp<SkSurface> backing_store,
+    const SkIRect& damage) {
+  // Delegates unaware of partial updates present the full frame.
+  return PresentBackingStore(std::move(backing_store));
+}
+
 }  // namespace flutter
@@ -8,6 +8,7 @@
 #include "flutter/flow/embedded_views.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/gpu/gpu_surface_delegate.h"
+#include "third_party/skia/include/core/SkRect.h"
 #include "third_party/skia/include/core/SkSurface.h"
 
 namespace flutter {
@@ -52,6 +53,27 @@ class GPUSurfaceSoftwareDelegate : public GPUSurfaceDelegate {
   ///             the screen.
   ///
   virtual bool PresentBackingStore(sk_sp<SkSurface> backing_store) = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Like |PresentBackingStore|, but names the region of the
+  ///             backing store that changed since the previous present.
+  ///             Delegates that copy or encode frames (remote displays,
+  ///             headless captures) may restrict their work to the damage
+  ///             region. An empty damage region means the frame is identical
+  ///             to the previous one.
+  ///
+  ///             The base implementation ignores the damage region and
+  ///             presents the full backing store.
+  ///
+  /// @param[in]  backing_store  The software backing store to present.
+  /// @param[in]  damage         The region that differs from the previous
+  ///                            frame, in backing store coordinates.
+  ///
+  /// @return     Returns if the platform could present the backing store onto
+  ///             the screen.
+  ///
+  virtual bool PresentBackingStoreWithDamage(sk_sp<SkSurface> backing_store,
+                                             const SkIRect& damage);
 };
 
 }  // namespace flutter
@@ -7,11 +7,52 @@
 #include <EGL/eglext.h>
 
 #include <utility>
+#include <vector>
 
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
 
+// The presentation time and frame timestamp extensions may be missing from
+// the EGL headers we build against; resolve the entry points through
+// eglGetProcAddress with local signatures and define the tokens we use.
+#ifndef EGL_TIMESTAMPS_ANDROID
+#define EGL_TIMESTAMPS_ANDROID 0x3430
+#endif
+#ifndef EGL_DISPLAY_PRESENT_TIME_ANDROID
+#define EGL_DISPLAY_PRESENT_TIME_ANDROID 0x343A
+#endif
+
+// A timestamp the compositor has not resolved yet.
+static constexpr int64_t kEglTimestampPending = -2;
+
+typedef EGLBoolean (*PFNPresentationTimeProc)(EGLDisplay, EGLSurface, int64_t);
+typedef EGLBoolean (*PFNGetNextFrameIdProc)(EGLDisplay, EGLSurface, uint64_t*);
+typedef EGLBoolean (*PFNGetFrameTimestampsProc)(EGLDisplay,
+                                                EGLSurface,
+                                                uint64_t /* frame id */,
+                                                EGLint /* timestamp count */,
+                                                const EGLint* /* timestamps */,
+                                                int64_t* /* values */);
+
+static PFNPresentationTimeProc GetPresentationTimeProc() {
+  static auto proc = reinterpret_cast<PFNPresentationTimeProc>(
+      eglGetProcAddress("eglPresentationTimeANDROID"));
+  return proc;
+}
+
+static PFNGetNextFrameIdProc GetNextFrameIdProc() {
+  static auto proc = reinterpret_cast<PFNGetNextFrameIdProc>(
+      eglGetProcAddress("eglGetNextFrameIdANDROID"));
+  return proc;
+}
+
+static PFNGetFrameTimestampsProc GetFrameTimestampsProc() {
+  static auto proc = reinterpret_cast<PFNGetFrameTimestampsProc>(
+      eglGetProcAddress("eglGetFrameTimestampsANDROID"));
+  return proc;
+}
+
 template <class T>
 using EGLResult = std::pair<bool, T>;
 
@@ -69,6 +110,61 @@ static EGLResult<EGLSurface> CreateContext(EGLDisplay display,
   return {context != EGL_NO_CONTEXT, context};
 }
 
+// Returns the config's color component size, or -1 on failure.
+static EGLint GetConfigAttribute(EGLDisplay display,
+                                 EGLConfig config,
+                                 EGLint attribute) {
+  EGLint value = -1;
+  if (eglGetConfigAttrib(display, config, attribute, &value) != EGL_TRUE) {
+    return -1;
+  }
+  return value;
+}
+
+// Finds a true 16 bit (565) window configuration. The component sizes given
+// to eglChooseConfig are only minimums and EGL sorts deeper buffers first,
+// so the returned configurations must be scanned for an exact match.
+static EGLResult<EGLConfig> ChooseReducedColorDepthEGLConfiguration(
+    EGLDisplay display) {
+  EGLint attributes[] = {
+      // clang-format off
+      EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+      EGL_SURFACE_TYPE,    EGL_WINDOW_BIT,
+      EGL_RED_SIZE,        5,
+      EGL_GREEN_SIZE,      6,
+      EGL_BLUE_SIZE,       5,
+      EGL_ALPHA_SIZE,      0,
+      EGL_DEPTH_SIZE,      0,
+      EGL_STENCIL_SIZE,    0,
+      EGL_NONE,            // termination sentinel
+      // clang-format on
+  };
+
+  EGLint config_count = 0;
+  if (eglChooseConfig(display, attributes, nullptr, 0, &config_count) !=
+          EGL_TRUE ||
+      config_count <= 0) {
+    return {false, nullptr};
+  }
+
+  std::vector<EGLConfig> configs(config_count);
+  if (eglChooseConfig(display, attributes, configs.data(), config_count,
+                      &config_count) != EGL_TRUE) {
+    return {false, nullptr};
+  }
+
+  for (EGLint i = 0; i < config_count; i++) {
+    if (GetConfigAttribute(display, configs[i], EGL_RED_SIZE) == 5 &&
+        GetConfigAttribute(display, configs[i], EGL_GREEN_SIZE) == 6 &&
+        GetConfigAttribute(display, configs[i], EGL_BLUE_SIZE) == 5 &&
+        GetConfigAttribute(display, configs[i], EGL_ALPHA_SIZE) == 0) {
+      return {true, configs[i]};
+    }
+  }
+
+  return {false, nullptr};
+}
+
 static EGLResult<EGLConfig> ChooseEGLConfiguration(EGLDisplay display) {
   EGLint attributes[] = {
       // clang-format off
@@ -122,11 +218,22 @@ bool AndroidContextGL::CreateWindowSurface(
   window_ = std::move(window);
   EGLDisplay display = environment_->Display();
 
+  // Release whatever surface the context was parked on — typically the
+  // pbuffer created along with the context. The context itself survives the
+  // swap; callers must not have it current on any thread.
+  if (!TeardownSurface(display, surface_)) {
+    FML_LOG(ERROR) << "Could not tear down the previous EGL surface.";
+    LogLastEGLError();
+  }
+  surface_ = EGL_NO_SURFACE;
+
   const EGLint attribs[] = {EGL_NONE};
 
   surface_ = eglCreateWindowSurface(
       display, config_,
       reinterpret_cast<EGLNativeWindowType>(window_->handle()), attribs);
+  frame_timestamps_enabled_ = false;
+  in_flight_frames_.clear();
   return surface_ != EGL_NO_SURFACE;
 }
 
@@ -144,7 +251,8 @@ bool AndroidContextGL::CreatePBufferSurface() {
 }
 
 AndroidContextGL::AndroidContextGL(fml::RefPtr<AndroidEnvironmentGL> env,
-                                   const AndroidContextGL* share_context)
+                                   const AndroidContextGL* share_context,
+                                   bool prefer_reduced_color_depth)
     : environment_(env),
       window_(nullptr),
       config_(nullptr),
@@ -157,9 +265,22 @@ AndroidContextGL::AndroidContextGL(fml::RefPtr<AndroidEnvironmentGL> env,
 
   bool success = false;
 
-  // Choose a valid configuration.
+  // Choose a valid configuration. When a reduced color depth was requested,
+  // try for a 565 configuration first and fall back to the standard 8888 one
+  // when the display does not expose 16 bit window surfaces.
 
-  std::tie(success, config_) = ChooseEGLConfiguration(environment_->Display());
+  if (prefer_reduced_color_depth) {
+    std::tie(success, config_) =
+        ChooseReducedColorDepthEGLConfiguration(environment_->Display());
+    if (success) {
+      color_type_ = kRGB_565_SkColorType;
+    }
+  }
+
+  if (!success) {
+    std::tie(success, config_) =
+        ChooseEGLConfiguration(environment_->Display());
+  }
 
   if (!success) {
     FML_LOG(ERROR) << "Could not choose an EGL configuration.";
@@ -236,7 +357,85 @@ bool AndroidContextGL::ClearCurrent() {
 
 bool AndroidContextGL::SwapBuffers() {
   TRACE_EVENT0("flutter", "AndroidContextGL::SwapBuffers");
-  return eglSwapBuffers(environment_->Display(), surface_);
+
+  // The frame id has to be read before the swap: eglGetNextFrameIdANDROID
+  // names the frame the next eglSwapBuffers call will carry.
+  uint64_t frame_id = 0;
+  bool track_frame = false;
+  if (pending_present_callback_ && EnsureFrameTimestampsEnabled()) {
+    track_frame = GetNextFrameIdProc()(environment_->Display(), surface_,
+                                       &frame_id) == EGL_TRUE;
+  }
+
+  const bool swapped = eglSwapBuffers(environment_->Display(), surface_);
+
+  if (swapped && track_frame) {
+    in_flight_frames_.push_back(
+        {frame_id, std::move(pending_present_callback_)});
+    // The compositor only retains timestamps for a handful of recent
+    // frames; anything older will never resolve.
+    constexpr size_t kMaxInFlightFrames = 8;
+    if (in_flight_frames_.size() > kMaxInFlightFrames) {
+      in_flight_frames_.pop_front();
+    }
+  }
+  pending_present_callback_ = nullptr;
+
+  PollFrameTimestamps();
+
+  return swapped;
+}
+
+bool AndroidContextGL::SetPresentationTime(fml::TimePoint time) {
+  auto proc = GetPresentationTimeProc();
+  if (proc == nullptr) {
+    return false;
+  }
+  return proc(environment_->Display(), surface_,
+              time.ToEpochDelta().ToNanoseconds()) == EGL_TRUE;
+}
+
+void AndroidContextGL::ObservePresentation(
+    std::function<void(fml::TimePoint)> on_presented) {
+  pending_present_callback_ = std::move(on_presented);
+}
+
+bool AndroidContextGL::EnsureFrameTimestampsEnabled() {
+  if (frame_timestamps_enabled_) {
+    return true;
+  }
+  if (GetNextFrameIdProc() == nullptr || GetFrameTimestampsProc() == nullptr) {
+    return false;
+  }
+  frame_timestamps_enabled_ =
+      eglSurfaceAttrib(environment_->Display(), surface_,
+                       EGL_TIMESTAMPS_ANDROID, EGL_TRUE) == EGL_TRUE;
+  return frame_timestamps_enabled_;
+}
+
+void AndroidContextGL::PollFrameTimestamps() {
+  auto proc = GetFrameTimestampsProc();
+  while (!in_flight_frames_.empty()) {
+    auto& frame = in_flight_frames_.front();
+    const EGLint timestamp_name = EGL_DISPLAY_PRESENT_TIME_ANDROID;
+    int64_t value = 0;
+    if (proc(environment_->Display(), surface_, frame.frame_id, 1,
+             &timestamp_name, &value) != EGL_TRUE) {
+      // The frame aged out of the compositor's history; its display time is
+      // unknowable now.
+      in_flight_frames_.pop_front();
+      continue;
+    }
+    if (value == kEglTimestampPending) {
+      // Frames resolve in submission order; the rest are pending too.
+      break;
+    }
+    if (value > 0) {
+      frame.on_presented(fml::TimePoint::FromEpochDelta(
+          fml::TimeDelta::FromNanoseconds(value)));
+    }
+    in_flight_frames_.pop_front();
+  }
 }
 
 SkISize AndroidContextGL::GetSize() {
@@ -260,8 +459,7 @@ bool AndroidContextGL::Resize(const SkISize& size) {
 
   ClearCurrent();
 
-  TeardownSurface(environment_->Display(), surface_);
-
+  // CreateWindowSurface tears down the previous surface itself.
   if (!this->CreateWindowSurface(window_)) {
     FML_LOG(ERROR) << "Unable to create EGL window surface on resize.";
     return false;
@@ -272,4 +470,8 @@ bool AndroidContextGL::Resize(const SkISize& size) {
   return true;
 }
 
+SkColorType AndroidContextGL::ColorType() const {
+  return color_type_;
+}
+
 }  // namespace flutter
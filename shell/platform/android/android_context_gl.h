@@ -5,12 +5,17 @@
 #ifndef FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_CONTEXT_GL_H_
 #define FLUTTER_SHELL_PLATFORM_ANDROID_ANDROID_CONTEXT_GL_H_
 
+#include <deque>
+#include <functional>
+
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/memory/ref_ptr.h"
+#include "flutter/fml/time/time_point.h"
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/platform/android/android_environment_gl.h"
 #include "flutter/shell/platform/android/android_native_window.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkSize.h"
 
 namespace flutter {
@@ -31,20 +36,58 @@ class AndroidContextGL : public fml::RefCountedThreadSafe<AndroidContextGL> {
 
   bool SwapBuffers();
 
+  // Tells the compositor which vsync the next swapped frame targets via
+  // eglPresentationTimeANDROID, so SurfaceFlinger latches it on that vsync
+  // instead of guessing. Returns false when the extension is unavailable.
+  bool SetPresentationTime(fml::TimePoint time);
+
+  // Registers a handler for the next swapped frame. When the device
+  // supports EGL_ANDROID_get_frame_timestamps, the handler is invoked with
+  // the display present time the compositor reports for that frame, which
+  // becomes available a couple of swaps later; otherwise it is dropped.
+  void ObservePresentation(std::function<void(fml::TimePoint)> on_presented);
+
   SkISize GetSize();
 
   bool Resize(const SkISize& size);
 
+  // The Skia color type matching the EGL configuration this context was
+  // created with. kRGB_565_SkColorType when a reduced color depth
+  // configuration was requested and available, kRGBA_8888_SkColorType
+  // otherwise.
+  SkColorType ColorType() const;
+
  private:
   fml::RefPtr<AndroidEnvironmentGL> environment_;
   fml::RefPtr<AndroidNativeWindow> window_;
   EGLConfig config_;
   EGLSurface surface_;
   EGLContext context_;
+  SkColorType color_type_ = kRGBA_8888_SkColorType;
   bool valid_;
 
+  // Frame timestamp collection must be re-enabled whenever the window
+  // surface is recreated.
+  bool frame_timestamps_enabled_ = false;
+  std::function<void(fml::TimePoint)> pending_present_callback_;
+
+  struct InFlightFrame {
+    uint64_t frame_id;
+    std::function<void(fml::TimePoint)> on_presented;
+  };
+  std::deque<InFlightFrame> in_flight_frames_;
+
+  // Enables timestamp collection on the current surface if the extension is
+  // present. Returns whether frames can be tracked.
+  bool EnsureFrameTimestampsEnabled();
+
+  // Invokes the handlers of tracked frames whose display present time the
+  // compositor has resolved.
+  void PollFrameTimestamps();
+
   AndroidContextGL(fml::RefPtr<AndroidEnvironmentGL> env,
-                   const AndroidContextGL* share_context = nullptr);
+                   const AndroidContextGL* share_context = nullptr,
+                   bool prefer_reduced_color_depth = false);
 
   ~AndroidContextGL();
 
@@ -71,7 +71,9 @@ AndroidShellHolder::AndroidShellHolder(
               shell.GetTaskRunners(),  // task runners
               java_object,             // java object handle for JNI interop
               shell.GetSettings()
-                  .enable_software_rendering  // use software rendering
+                  .enable_software_rendering,  // use software rendering
+              shell.GetSettings()
+                  .prefer_reduced_color_depth  // negotiate 565 framebuffer
           );
         }
         weak_platform_view = platform_view_android->GetWeakPtr();
@@ -168,6 +170,20 @@ void AndroidShellHolder::Launch(RunConfiguration config) {
   shell_->RunEngine(std::move(config));
 }
 
+void AndroidShellHolder::Prewarm(RunConfiguration config) {
+  if (!IsValid()) {
+    return;
+  }
+
+  // Boot the VM and run the isolate to main while the raster context warms
+  // in parallel; both otherwise stack up behind the first window attach.
+  shell_->RunEngine(std::move(config));
+
+  if (platform_view_) {
+    platform_view_->NotifyPrewarm();
+  }
+}
+
 Rasterizer::Screenshot AndroidShellHolder::Screenshot(
     Rasterizer::ScreenshotType type,
     bool base64_encode) {
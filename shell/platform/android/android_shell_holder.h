@@ -31,6 +31,12 @@ class AndroidShellHolder {
 
   void Launch(RunConfiguration configuration);
 
+  // Launches the engine and warms the rendering pipeline against an
+  // offscreen pbuffer before any Android surface exists. When the platform
+  // view later attaches, only the window bind remains on the critical path
+  // to the first frame.
+  void Prewarm(RunConfiguration configuration);
+
   const flutter::Settings& GetSettings() const;
 
   fml::WeakPtr<PlatformViewAndroid> GetPlatformView();
@@ -15,7 +15,8 @@
 namespace flutter {
 
 std::unique_ptr<AndroidSurface> AndroidSurface::Create(
-    bool use_software_rendering) {
+    bool use_software_rendering,
+    bool prefer_reduced_color_depth) {
   if (use_software_rendering) {
     auto software_surface = std::make_unique<AndroidSurfaceSoftware>();
     return software_surface->IsValid() ? std::move(software_surface) : nullptr;
@@ -24,7 +25,8 @@ std::unique_ptr<AndroidSurface> AndroidSurface::Create(
   auto vulkan_surface = std::make_unique<AndroidSurfaceVulkan>();
   return vulkan_surface->IsValid() ? std::move(vulkan_surface) : nullptr;
 #else   // SHELL_ENABLE_VULKAN
-  auto gl_surface = std::make_unique<AndroidSurfaceGL>();
+  auto gl_surface =
+      std::make_unique<AndroidSurfaceGL>(prefer_reduced_color_depth);
   return gl_surface->IsOffscreenContextValid() ? std::move(gl_surface)
                                                : nullptr;
 #endif  // SHELL_ENABLE_VULKAN
@@ -32,4 +34,8 @@ std::unique_ptr<AndroidSurface> AndroidSurface::Create(
 
 AndroidSurface::~AndroidSurface() = default;
 
+bool AndroidSurface::PrewarmRenderingContext() {
+  return false;
+}
+
 }  // namespace flutter
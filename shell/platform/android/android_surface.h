@@ -19,7 +19,9 @@ namespace flutter {
 
 class AndroidSurface {
  public:
-  static std::unique_ptr<AndroidSurface> Create(bool use_software_rendering);
+  static std::unique_ptr<AndroidSurface> Create(
+      bool use_software_rendering,
+      bool prefer_reduced_color_depth = false);
 
   virtual ~AndroidSurface();
 
@@ -36,6 +38,12 @@ class AndroidSurface {
   virtual bool ResourceContextClearCurrent() = 0;
 
   virtual bool SetNativeWindow(fml::RefPtr<AndroidNativeWindow> window) = 0;
+
+  // Sets up the onscreen rendering context against an offscreen pbuffer so
+  // the raster context and its caches can be warmed before a native window
+  // exists. Backends that cannot render without a window return false (the
+  // default); callers then fall back to warming on first attach.
+  virtual bool PrewarmRenderingContext();
 };
 
 }  // namespace flutter
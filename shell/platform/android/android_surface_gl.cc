@@ -25,7 +25,8 @@ static fml::RefPtr<AndroidContextGL> CreateResourceLoadingContext() {
   return context;
 }
 
-AndroidSurfaceGL::AndroidSurfaceGL() {
+AndroidSurfaceGL::AndroidSurfaceGL(bool prefer_reduced_color_depth)
+    : prefer_reduced_color_depth_(prefer_reduced_color_depth) {
   // Acquire the offscreen context.
   offscreen_context_ = CreateResourceLoadingContext();
 
@@ -79,7 +80,17 @@ bool AndroidSurfaceGL::ResourceContextClearCurrent() {
 
 bool AndroidSurfaceGL::SetNativeWindow(
     fml::RefPtr<AndroidNativeWindow> window) {
-  // In any case, we want to get rid of our current onscreen context.
+  // A prewarmed onscreen context is still parked on its pbuffer surface. Keep
+  // the EGL context — it carries the raster GrContext's compiled programs —
+  // and only swap the surface out for the real window.
+  if (onscreen_context_ && onscreen_context_->IsValid()) {
+    onscreen_context_->ClearCurrent();
+    if (onscreen_context_->CreateWindowSurface(std::move(window))) {
+      return true;
+    }
+    onscreen_context_ = nullptr;
+    return false;
+  }
   onscreen_context_ = nullptr;
 
   // If the offscreen context has not been setup, we dont have the sharegroup.
@@ -91,7 +102,7 @@ bool AndroidSurfaceGL::SetNativeWindow(
   // Create the onscreen context.
   onscreen_context_ = fml::MakeRefCounted<AndroidContextGL>(
       offscreen_context_->Environment(),
-      offscreen_context_.get() /* sharegroup */);
+      offscreen_context_.get() /* sharegroup */, prefer_reduced_color_depth_);
 
   if (!onscreen_context_->IsValid()) {
     onscreen_context_ = nullptr;
@@ -106,6 +117,31 @@ bool AndroidSurfaceGL::SetNativeWindow(
   return true;
 }
 
+bool AndroidSurfaceGL::PrewarmRenderingContext() {
+  if (onscreen_context_ && onscreen_context_->IsValid()) {
+    // Already set up, either by an earlier prewarm or a window attach.
+    return true;
+  }
+  onscreen_context_ = nullptr;
+
+  if (!offscreen_context_ || !offscreen_context_->IsValid()) {
+    return false;
+  }
+
+  // The context comes up bound to a 1x1 pbuffer surface, which is all the
+  // raster context needs until a native window arrives.
+  onscreen_context_ = fml::MakeRefCounted<AndroidContextGL>(
+      offscreen_context_->Environment(),
+      offscreen_context_.get() /* sharegroup */, prefer_reduced_color_depth_);
+
+  if (!onscreen_context_->IsValid()) {
+    onscreen_context_ = nullptr;
+    return false;
+  }
+
+  return true;
+}
+
 std::unique_ptr<GLContextResult> AndroidSurfaceGL::GLContextMakeCurrent() {
   FML_DCHECK(onscreen_context_ && onscreen_context_->IsValid());
   auto default_context_result = std::make_unique<GLContextDefaultResult>(
@@ -123,12 +159,31 @@ bool AndroidSurfaceGL::GLContextPresent() {
   return onscreen_context_->SwapBuffers();
 }
 
+void AndroidSurfaceGL::GLContextSetPresentationTime(fml::TimePoint time) {
+  FML_DCHECK(onscreen_context_ && onscreen_context_->IsValid());
+  onscreen_context_->SetPresentationTime(time);
+}
+
+void AndroidSurfaceGL::GLContextObservePresentation(
+    std::function<void(fml::TimePoint)> on_presented) {
+  FML_DCHECK(onscreen_context_ && onscreen_context_->IsValid());
+  onscreen_context_->ObservePresentation(std::move(on_presented));
+}
+
 intptr_t AndroidSurfaceGL::GLContextFBO() const {
   FML_DCHECK(onscreen_context_ && onscreen_context_->IsValid());
   // The default window bound framebuffer on Android.
   return 0;
 }
 
+// |GPUSurfaceGLDelegate|
+SkColorType AndroidSurfaceGL::GLContextColorType() const {
+  if (onscreen_context_ && onscreen_context_->IsValid()) {
+    return onscreen_context_->ColorType();
+  }
+  return kUnknown_SkColorType;
+}
+
 // |GPUSurfaceGLDelegate|
 ExternalViewEmbedder* AndroidSurfaceGL::GetExternalViewEmbedder() {
   return external_view_embedder_.get();
@@ -20,7 +20,7 @@ namespace flutter {
 class AndroidSurfaceGL final : public GPUSurfaceGLDelegate,
                                public AndroidSurface {
  public:
-  AndroidSurfaceGL();
+  explicit AndroidSurfaceGL(bool prefer_reduced_color_depth = false);
 
   ~AndroidSurfaceGL() override;
 
@@ -47,6 +47,9 @@ class AndroidSurfaceGL final : public GPUSurfaceGLDelegate,
   // |AndroidSurface|
   bool SetNativeWindow(fml::RefPtr<AndroidNativeWindow> window) override;
 
+  // |AndroidSurface|
+  bool PrewarmRenderingContext() override;
+
   // |GPUSurfaceGLDelegate|
   std::unique_ptr<GLContextResult> GLContextMakeCurrent() override;
 
@@ -56,13 +59,24 @@ class AndroidSurfaceGL final : public GPUSurfaceGLDelegate,
   // |GPUSurfaceGLDelegate|
   bool GLContextPresent() override;
 
+  // |GPUSurfaceGLDelegate|
+  void GLContextSetPresentationTime(fml::TimePoint time) override;
+
+  // |GPUSurfaceGLDelegate|
+  void GLContextObservePresentation(
+      std::function<void(fml::TimePoint)> on_presented) override;
+
   // |GPUSurfaceGLDelegate|
   intptr_t GLContextFBO() const override;
 
+  // |GPUSurfaceGLDelegate|
+  SkColorType GLContextColorType() const override;
+
   // |GPUSurfaceGLDelegate|
   ExternalViewEmbedder* GetExternalViewEmbedder() override;
 
  private:
+  const bool prefer_reduced_color_depth_;
   fml::RefPtr<AndroidContextGL> onscreen_context_;
   fml::RefPtr<AndroidContextGL> offscreen_context_;
   std::unique_ptr<AndroidExternalViewEmbedder> external_view_embedder_;
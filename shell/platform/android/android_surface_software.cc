@@ -96,6 +96,18 @@ sk_sp<SkSurface> AndroidSurfaceSoftware::AcquireBackingStore(
 
 bool AndroidSurfaceSoftware::PresentBackingStore(
     sk_sp<SkSurface> backing_store) {
+  if (backing_store == nullptr) {
+    return false;
+  }
+  return PresentBackingStoreWithDamage(
+      backing_store,
+      SkIRect::MakeWH(backing_store->width(), backing_store->height()));
+}
+
+// |GPUSurfaceSoftwareDelegate|
+bool AndroidSurfaceSoftware::PresentBackingStoreWithDamage(
+    sk_sp<SkSurface> backing_store,
+    const SkIRect& damage) {
   TRACE_EVENT0("flutter", "AndroidSurfaceSoftware::PresentBackingStore");
   if (!IsValid() || backing_store == nullptr) {
     return false;
@@ -106,8 +118,26 @@ bool AndroidSurfaceSoftware::PresentBackingStore(
     return false;
   }
 
+  if (damage.isEmpty()) {
+    // The frame is identical to the previous one. This surface is the
+    // window's only producer, so the front buffer already shows it and the
+    // lock, copy and post can all be skipped.
+    return true;
+  }
+
+  // Declare only the damaged region as dirty. The window swaps between
+  // multiple buffers, so the buffer handed back may hold a frame older than
+  // the previous one; the compositor accounts for that by expanding the
+  // dirty bounds to everything that must be recopied into this buffer.
+  ARect dirty_bounds;
+  dirty_bounds.left = damage.left();
+  dirty_bounds.top = damage.top();
+  dirty_bounds.right = damage.right();
+  dirty_bounds.bottom = damage.bottom();
+
   ANativeWindow_Buffer native_buffer;
-  if (ANativeWindow_lock(native_window_->handle(), &native_buffer, nullptr)) {
+  if (ANativeWindow_lock(native_window_->handle(), &native_buffer,
+                         &dirty_bounds)) {
     return false;
   }
 
@@ -124,9 +154,23 @@ bool AndroidSurfaceSoftware::PresentBackingStore(
     if (canvas) {
       SkBitmap bitmap;
       if (bitmap.installPixels(pixmap)) {
-        canvas->drawBitmapRect(
-            bitmap, SkRect::MakeIWH(native_buffer.width, native_buffer.height),
-            nullptr);
+        if (pixmap.dimensions() ==
+            SkISize::Make(native_buffer.width, native_buffer.height)) {
+          // Copy only the region the compositor reported dirty instead of
+          // the full frame.
+          const SkRect copy_rect = SkRect::Make(
+              SkIRect::MakeLTRB(dirty_bounds.left, dirty_bounds.top,
+                                dirty_bounds.right, dirty_bounds.bottom));
+          canvas->drawBitmapRect(bitmap, copy_rect, copy_rect, nullptr,
+                                 SkCanvas::kStrict_SrcRectConstraint);
+        } else {
+          // The backing store and window sizes disagree (mid-resize); damage
+          // coordinates do not map, so scale the full frame as before.
+          canvas->drawBitmapRect(
+              bitmap,
+              SkRect::MakeIWH(native_buffer.width, native_buffer.height),
+              nullptr);
+        }
       }
     }
   }
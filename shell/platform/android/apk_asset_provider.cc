@@ -1,6 +1,8 @@
+#include <sys/mman.h>
 #include <unistd.h>
 #include <algorithm>
 #include <sstream>
+#include <utility>
 
 #include "flutter/fml/logging.h"
 #include "flutter/shell/platform/android/apk_asset_provider.h"
@@ -15,7 +17,11 @@ APKAssetProvider::APKAssetProvider(JNIEnv* env,
   assetManager_ = AAssetManager_fromJava(env, jassetManager);
 }
 
-APKAssetProvider::~APKAssetProvider() = default;
+APKAssetProvider::~APKAssetProvider() {
+  if (prefetch_thread_.joinable()) {
+    prefetch_thread_.join();
+  }
+}
 
 bool APKAssetProvider::IsValid() const {
   return true;
@@ -39,8 +45,85 @@ class APKAssetMapping : public fml::Mapping {
   FML_DISALLOW_COPY_AND_ASSIGN(APKAssetMapping);
 };
 
+// Maps an uncompressed (stored) APK entry directly from the package file.
+// Unlike |AAsset_getBuffer|, no copy or inflate takes place: pages are
+// faulted in from the APK on demand, and |MADV_WILLNEED| asks the kernel to
+// queue readahead for the whole region up front.
+class APKFileRegionMapping : public fml::Mapping {
+ public:
+  static std::unique_ptr<APKFileRegionMapping> Make(int fd,
+                                                    off64_t offset,
+                                                    off64_t length) {
+    // The entry is rarely page aligned within the APK; map from the
+    // enclosing page boundary and point the data at the intra-page offset.
+    const off64_t page_size = sysconf(_SC_PAGESIZE);
+    const off64_t page_offset = offset % page_size;
+    const size_t map_size = length + page_offset;
+    void* mapping = ::mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fd,
+                           offset - page_offset);
+    if (mapping == MAP_FAILED) {
+      return nullptr;
+    }
+    ::madvise(mapping, map_size, MADV_WILLNEED);
+    return std::unique_ptr<APKFileRegionMapping>(new APKFileRegionMapping(
+        static_cast<uint8_t*>(mapping), map_size, page_offset, length));
+  }
+
+  ~APKFileRegionMapping() override { ::munmap(mapping_, map_size_); }
+
+  size_t GetSize() const override { return size_; }
+
+  const uint8_t* GetMapping() const override {
+    return mapping_ + data_offset_;
+  }
+
+ private:
+  APKFileRegionMapping(uint8_t* mapping,
+                       size_t map_size,
+                       size_t data_offset,
+                       size_t size)
+      : mapping_(mapping),
+        map_size_(map_size),
+        data_offset_(data_offset),
+        size_(size) {}
+
+  uint8_t* const mapping_;
+  const size_t map_size_;
+  const size_t data_offset_;
+  const size_t size_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(APKFileRegionMapping);
+};
+
+std::unique_ptr<fml::Mapping> APKAssetProvider::MapStoredAsset(
+    AAsset* asset) const {
+  // The file descriptor is only available when the entry is stored
+  // uncompressed in the APK; compressed entries fail here and fall back to
+  // the inflating buffer path.
+  off64_t offset = 0;
+  off64_t length = 0;
+  int fd = AAsset_openFileDescriptor64(asset, &offset, &length);
+  if (fd < 0) {
+    return nullptr;
+  }
+  auto mapping = APKFileRegionMapping::Make(fd, offset, length);
+  // The mapping holds its own reference to the underlying file.
+  ::close(fd);
+  return mapping;
+}
+
 std::unique_ptr<fml::Mapping> APKAssetProvider::GetAsMapping(
     const std::string& asset_name) const {
+  {
+    std::scoped_lock lock(prefetched_mutex_);
+    auto found = prefetched_.find(asset_name);
+    if (found != prefetched_.end()) {
+      auto mapping = std::move(found->second);
+      prefetched_.erase(found);
+      return mapping;
+    }
+  }
+
   std::stringstream ss;
   ss << directory_.c_str() << "/" << asset_name;
   AAsset* asset =
@@ -49,7 +132,56 @@ std::unique_ptr<fml::Mapping> APKAssetProvider::GetAsMapping(
     return nullptr;
   }
 
+  if (auto stored_mapping = MapStoredAsset(asset)) {
+    AAsset_close(asset);
+    return stored_mapping;
+  }
+
   return std::make_unique<APKAssetMapping>(asset);
 }
 
+void APKAssetProvider::PrefetchAssets(std::vector<std::string> asset_names) {
+  if (prefetch_thread_.joinable()) {
+    prefetch_thread_.join();
+  }
+  // Only NDK asset manager calls are made on the worker, so no JNI
+  // attachment is necessary; |java_asset_manager_| keeps the underlying
+  // Java AssetManager (and with it |assetManager_|) alive.
+  prefetch_thread_ =
+      std::thread([this, asset_names = std::move(asset_names)]() {
+        std::vector<std::pair<std::string, AAsset*>> compressed;
+
+        // First pass: open everything and map the stored entries. Each
+        // mapping issues MADV_WILLNEED as it is created, so readahead for
+        // all stored assets is in flight before any inflate below blocks
+        // this thread.
+        for (const auto& asset_name : asset_names) {
+          std::stringstream ss;
+          ss << directory_.c_str() << "/" << asset_name;
+          AAsset* asset = AAssetManager_open(assetManager_, ss.str().c_str(),
+                                             AASSET_MODE_BUFFER);
+          if (!asset) {
+            continue;
+          }
+          if (auto stored_mapping = MapStoredAsset(asset)) {
+            AAsset_close(asset);
+            std::scoped_lock lock(prefetched_mutex_);
+            prefetched_[asset_name] = std::move(stored_mapping);
+          } else {
+            compressed.emplace_back(asset_name, asset);
+          }
+        }
+
+        // Second pass: inflate the compressed entries off the engine
+        // threads. The warmed buffers are handed to the first
+        // |GetAsMapping| for each asset.
+        for (auto& entry : compressed) {
+          AAsset_getBuffer(entry.second);
+          std::scoped_lock lock(prefetched_mutex_);
+          prefetched_[entry.first] =
+              std::make_unique<APKAssetMapping>(entry.second);
+        }
+      });
+}
+
 }  // namespace flutter
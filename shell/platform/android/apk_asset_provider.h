@@ -8,6 +8,12 @@
 #include <android/asset_manager_jni.h>
 #include <jni.h>
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "flutter/assets/asset_resolver.h"
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/fml/platform/android/scoped_java_ref.h"
@@ -21,10 +27,25 @@ class APKAssetProvider final : public AssetResolver {
                             std::string directory);
   ~APKAssetProvider() override;
 
+  // Begins warming the given assets on a background thread. Stored
+  // (uncompressed) entries are mapped directly from the APK with readahead
+  // requested for all of them up front; compressed entries are inflated off
+  // the engine threads. Warmed assets are handed over to the next
+  // |GetAsMapping| call for the same name. Intended for the startup asset
+  // manifest, before the first frame needs them.
+  void PrefetchAssets(std::vector<std::string> asset_names);
+
  private:
   fml::jni::ScopedJavaGlobalRef<jobject> java_asset_manager_;
   AAssetManager* assetManager_;
   const std::string directory_;
+  std::thread prefetch_thread_;
+  mutable std::mutex prefetched_mutex_;
+  mutable std::map<std::string, std::unique_ptr<fml::Mapping>> prefetched_;
+
+  // Maps the asset directly from the APK if it is stored uncompressed.
+  // Returns nullptr for compressed entries.
+  std::unique_ptr<fml::Mapping> MapStoredAsset(AAsset* asset) const;
 
   // |flutter::AssetResolver|
   bool IsValid() const override;
@@ -39,6 +39,24 @@ std::vector<SkCanvas*> AndroidExternalViewEmbedder::GetCurrentCanvases() {
   return canvases;
 }
 
+// Fingerprints the recorded overlay content. Serializing the picture costs
+// time proportional to its op count, which for an overlay — the sliver of UI
+// drawn above a platform view — is small compared to rasterizing it. Returns
+// a non-zero value as 0 is reserved for "not fingerprinted".
+static uint64_t ComputePictureContentSignature(const SkPicture& picture) {
+  sk_sp<SkData> data = picture.serialize();
+  if (!data) {
+    return 0;
+  }
+  // FNV-1a over the serialized bytes.
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const uint8_t* bytes = data->bytes();
+  for (size_t i = 0; i < data->size(); i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
 // |ExternalViewEmbedder|
 bool AndroidExternalViewEmbedder::SubmitFrame(
     GrContext* context,
@@ -48,8 +66,25 @@ bool AndroidExternalViewEmbedder::SubmitFrame(
   TRACE_EVENT0("flutter", "AndroidExternalViewEmbedder::SubmitFrame");
   for (size_t i = 0; i < composition_order_.size(); i++) {
     int64_t view_id = composition_order_[i];
-    frame->SkiaCanvas()->drawPicture(
-        picture_recorders_[view_id]->finishRecordingAsPicture());
+    auto picture = picture_recorders_[view_id]->finishRecordingAsPicture();
+
+    OverlaySurface* overlay =
+        surface_pool_ ? surface_pool_->AcquireSurface(view_id, frame_size_)
+                      : nullptr;
+    if (overlay == nullptr) {
+      frame->SkiaCanvas()->drawPicture(picture);
+      continue;
+    }
+
+    uint64_t signature = ComputePictureContentSignature(*picture);
+    if (signature == 0 || signature != overlay->content_signature) {
+      TRACE_EVENT0("flutter", "RasterizeOverlaySurface");
+      SkCanvas* overlay_canvas = overlay->surface->getCanvas();
+      overlay_canvas->clear(SK_ColorTRANSPARENT);
+      overlay_canvas->drawPicture(picture);
+      overlay->content_signature = signature;
+    }
+    overlay->surface->draw(frame->SkiaCanvas(), 0, 0, nullptr);
   }
   return frame->Submit();
 }
@@ -86,6 +121,15 @@ void AndroidExternalViewEmbedder::CancelFrame() {
 
 // |ExternalViewEmbedder|
 void AndroidExternalViewEmbedder::EndFrame(
-    fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger) {}
+    fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger) {
+  if (surface_pool_) {
+    surface_pool_->CollectUnusedSurfaces();
+  }
+}
+
+void AndroidExternalViewEmbedder::SetOverlaySurfaceFactory(
+    OverlaySurfacePool::SurfaceFactory factory) {
+  surface_pool_ = std::make_unique<OverlaySurfacePool>(std::move(factory));
+}
 
 }  // namespace flutter
@@ -6,6 +6,7 @@
 #define FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_VIEW_EMBEDDER_H_
 
 #include "flutter/flow/embedded_views.h"
+#include "flutter/shell/platform/android/external_view_embedder/surface_pool.h"
 
 #include "third_party/skia/include/core/SkPictureRecorder.h"
 
@@ -47,6 +48,14 @@ class AndroidExternalViewEmbedder : public ExternalViewEmbedder {
   void EndFrame(
       fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger) override;
 
+  /// Installs the factory used to create overlay surfaces and enables the
+  /// overlay surface pool. Overlay content is then rasterized into pooled
+  /// surfaces, unchanged overlays skip re-rasterization entirely, and
+  /// surfaces for views that left the frame are torn down only after a grace
+  /// period. Without a factory, overlay content is drawn straight into the
+  /// root surface every frame.
+  void SetOverlaySurfaceFactory(OverlaySurfacePool::SurfaceFactory factory);
+
  private:
   // The size of the background canvas.
   SkISize frame_size_;
@@ -60,6 +69,10 @@ class AndroidExternalViewEmbedder : public ExternalViewEmbedder {
   // of the last leaf node in the layer tree.
   std::map<int64_t, std::unique_ptr<SkPictureRecorder>> picture_recorders_;
 
+  // The pool of overlay surfaces, present once an overlay surface factory has
+  // been installed.
+  std::unique_ptr<OverlaySurfacePool> surface_pool_;
+
   /// Resets the state.
   void Reset();
 };
@@ -0,0 +1,98 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/external_view_embedder/surface_pool.h"
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+static SkISize RoundUpToBucket(const SkISize& size) {
+  auto round_up = [](int32_t dimension) -> int32_t {
+    constexpr int32_t granularity = OverlaySurfacePool::kSizeBucketGranularity;
+    if (dimension <= 0) {
+      return granularity;
+    }
+    return ((dimension + granularity - 1) / granularity) * granularity;
+  };
+  return SkISize::Make(round_up(size.width()), round_up(size.height()));
+}
+
+OverlaySurfacePool::OverlaySurfacePool(SurfaceFactory factory,
+                                       int teardown_grace_frames)
+    : factory_(std::move(factory)),
+      teardown_grace_frames_(teardown_grace_frames) {
+  FML_DCHECK(factory_);
+}
+
+OverlaySurfacePool::~OverlaySurfacePool() = default;
+
+OverlaySurface* OverlaySurfacePool::AcquireSurface(int64_t view_id,
+                                                   const SkISize& size) {
+  const SkISize bucket_size = RoundUpToBucket(size);
+
+  // Prefer the surface this view rasterized into last frame so its stored
+  // content signature stays comparable against the view's new content.
+  for (auto& pooled : surfaces_) {
+    if (!pooled->used_this_frame && pooled->view_id == view_id &&
+        pooled->bucket_size == bucket_size) {
+      pooled->used_this_frame = true;
+      pooled->frames_unused = 0;
+      return &pooled->overlay;
+    }
+  }
+
+  // Any free surface in the same size bucket will do, but its contents belong
+  // to another view; invalidate the signature so they are repainted.
+  for (auto& pooled : surfaces_) {
+    if (!pooled->used_this_frame && pooled->bucket_size == bucket_size) {
+      pooled->used_this_frame = true;
+      pooled->frames_unused = 0;
+      pooled->view_id = view_id;
+      pooled->overlay.content_signature = 0;
+      return &pooled->overlay;
+    }
+  }
+
+  auto surface = factory_(bucket_size);
+  if (!surface) {
+    return nullptr;
+  }
+
+  auto pooled = std::make_unique<PooledSurface>();
+  pooled->overlay.surface = std::move(surface);
+  pooled->bucket_size = bucket_size;
+  pooled->view_id = view_id;
+  pooled->used_this_frame = true;
+  pooled->frames_unused = 0;
+  surfaces_.push_back(std::move(pooled));
+  return &surfaces_.back()->overlay;
+}
+
+void OverlaySurfacePool::CollectUnusedSurfaces() {
+  auto it = surfaces_.begin();
+  while (it != surfaces_.end()) {
+    auto& pooled = *it;
+    if (pooled->used_this_frame) {
+      pooled->used_this_frame = false;
+      pooled->frames_unused = 0;
+      it++;
+      continue;
+    }
+    // A platform view that scrolled out of the frame often scrolls right back
+    // in; keep its surface around for the grace period before tearing it
+    // down.
+    if (++pooled->frames_unused > teardown_grace_frames_) {
+      it = surfaces_.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
+
+size_t OverlaySurfacePool::GetPooledSurfaceCount() const {
+  return surfaces_.size();
+}
+
+}  // namespace flutter
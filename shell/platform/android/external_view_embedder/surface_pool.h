@@ -0,0 +1,89 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_VIEW_EMBEDDER_SURFACE_POOL_H_
+#define FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_VIEW_EMBEDDER_SURFACE_POOL_H_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+namespace flutter {
+
+/// A pooled overlay surface along with the fingerprint of the content last
+/// rasterized into it.
+struct OverlaySurface {
+  sk_sp<SkSurface> surface;
+
+  /// The signature of the overlay content last painted into the surface, or
+  /// 0 if unknown. Callers that find their current content signature already
+  /// stored here may skip re-rasterization.
+  uint64_t content_signature = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Pools the surfaces that overlay platform views so hybrid composition does
+/// not allocate and destroy a surface every time a platform view enters or
+/// leaves the frame. Surfaces are bucketed by size and torn down only after
+/// going unused for a grace period of frames.
+///
+class OverlaySurfacePool {
+ public:
+  using SurfaceFactory = std::function<sk_sp<SkSurface>(const SkISize& size)>;
+
+  /// Surface dimensions are rounded up to multiples of this many pixels so a
+  /// platform view that resizes by a few pixels during a scroll keeps
+  /// hitting the same pool bucket.
+  static constexpr int32_t kSizeBucketGranularity = 64;
+
+  /// How many frames an unused surface survives before it is torn down.
+  static constexpr int kDefaultTeardownGraceFrames = 3;
+
+  explicit OverlaySurfacePool(
+      SurfaceFactory factory,
+      int teardown_grace_frames = kDefaultTeardownGraceFrames);
+
+  ~OverlaySurfacePool();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns a surface at least as large as `size` for the given
+  ///             platform view, preferring the surface the view used last
+  ///             frame (which keeps its content signature meaningful), then
+  ///             any free surface in the same size bucket, and only then the
+  ///             factory. Returns nullptr if the factory does. The pool
+  ///             retains ownership of the surface.
+  ///
+  OverlaySurface* AcquireSurface(int64_t view_id, const SkISize& size);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Marks the end of a frame. Surfaces that were not acquired
+  ///             since the previous call age by one frame and are destroyed
+  ///             once they exceed the teardown grace period.
+  ///
+  void CollectUnusedSurfaces();
+
+  size_t GetPooledSurfaceCount() const;
+
+ private:
+  struct PooledSurface {
+    OverlaySurface overlay;
+    SkISize bucket_size;
+    int64_t view_id;
+    bool used_this_frame;
+    int frames_unused;
+  };
+
+  SurfaceFactory factory_;
+  const int teardown_grace_frames_;
+  std::vector<std::unique_ptr<PooledSurface>> surfaces_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(OverlaySurfacePool);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_ANDROID_EXTERNAL_VIEW_EMBEDDER_SURFACE_POOL_H_
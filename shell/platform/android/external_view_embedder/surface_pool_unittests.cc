@@ -0,0 +1,91 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "gtest/gtest.h"
+
+#include "flutter/shell/platform/android/external_view_embedder/surface_pool.h"
+
+namespace flutter {
+namespace testing {
+
+static OverlaySurfacePool::SurfaceFactory MakeRasterSurfaceFactory(
+    size_t* created_count = nullptr) {
+  return [created_count](const SkISize& size) {
+    if (created_count != nullptr) {
+      (*created_count)++;
+    }
+    return SkSurface::MakeRasterN32Premul(size.width(), size.height());
+  };
+}
+
+TEST(OverlaySurfacePool, ReusesSurfacesInTheSameSizeBucket) {
+  size_t created_count = 0;
+  OverlaySurfacePool pool(MakeRasterSurfaceFactory(&created_count));
+
+  auto* overlay = pool.AcquireSurface(1, SkISize::Make(100, 100));
+  ASSERT_TRUE(overlay != nullptr);
+  SkSurface* first_surface = overlay->surface.get();
+  pool.CollectUnusedSurfaces();
+
+  // Sizes within the same bucket hit the pooled surface, even for another
+  // view.
+  overlay = pool.AcquireSurface(2, SkISize::Make(90, 110));
+  ASSERT_TRUE(overlay != nullptr);
+  ASSERT_EQ(first_surface, overlay->surface.get());
+  ASSERT_EQ(1u, created_count);
+
+  // A size in a different bucket allocates a new surface.
+  auto* larger = pool.AcquireSurface(3, SkISize::Make(500, 500));
+  ASSERT_TRUE(larger != nullptr);
+  ASSERT_NE(first_surface, larger->surface.get());
+  ASSERT_EQ(2u, created_count);
+}
+
+TEST(OverlaySurfacePool, PrefersTheSurfaceTheViewUsedLastFrame) {
+  OverlaySurfacePool pool(MakeRasterSurfaceFactory());
+
+  auto* first = pool.AcquireSurface(1, SkISize::Make(100, 100));
+  first->content_signature = 42;
+  auto* second = pool.AcquireSurface(2, SkISize::Make(100, 100));
+  second->content_signature = 43;
+  pool.CollectUnusedSurfaces();
+
+  // Acquiring in the opposite order still pairs each view with its previous
+  // surface, so the stored content signatures remain meaningful.
+  ASSERT_EQ(43u, pool.AcquireSurface(2, SkISize::Make(100, 100))
+                     ->content_signature);
+  ASSERT_EQ(42u, pool.AcquireSurface(1, SkISize::Make(100, 100))
+                     ->content_signature);
+}
+
+TEST(OverlaySurfacePool, InvalidatesTheSignatureWhenSurfacesSwitchViews) {
+  OverlaySurfacePool pool(MakeRasterSurfaceFactory());
+
+  auto* overlay = pool.AcquireSurface(1, SkISize::Make(100, 100));
+  overlay->content_signature = 42;
+  pool.CollectUnusedSurfaces();
+
+  // The surface now holds view 1's pixels; view 2 must not skip painting.
+  ASSERT_EQ(0u, pool.AcquireSurface(2, SkISize::Make(100, 100))
+                    ->content_signature);
+}
+
+TEST(OverlaySurfacePool, TearsDownSurfacesAfterTheGracePeriod) {
+  OverlaySurfacePool pool(MakeRasterSurfaceFactory(),
+                          /*teardown_grace_frames=*/2);
+
+  pool.AcquireSurface(1, SkISize::Make(100, 100));
+  ASSERT_EQ(1u, pool.GetPooledSurfaceCount());
+
+  // The surface ages through the grace period before being destroyed.
+  pool.CollectUnusedSurfaces();
+  pool.CollectUnusedSurfaces();
+  pool.CollectUnusedSurfaces();
+  ASSERT_EQ(1u, pool.GetPooledSurfaceCount());
+  pool.CollectUnusedSurfaces();
+  ASSERT_EQ(0u, pool.GetPooledSurfaceCount());
+}
+
+}  // namespace testing
+}  // namespace flutter
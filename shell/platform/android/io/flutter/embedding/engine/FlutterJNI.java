@@ -25,6 +25,8 @@ import io.flutter.plugin.common.StandardMessageCodec;
 import io.flutter.view.AccessibilityBridge;
 import io.flutter.view.FlutterCallbackInformation;
 import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.Charset;
 import java.util.Set;
 import java.util.concurrent.CopyOnWriteArraySet;
 
@@ -653,6 +655,48 @@ public class FlutterJNI {
     // (https://github.com/flutter/flutter/issues/25391)
   }
 
+  // Called by native with a batch of platform messages and message responses
+  // encoded into a direct ByteBuffer whose backing store is owned by the
+  // engine. The encoding is produced by PlatformMessageBatcher and must stay
+  // in sync with it: each entry is an int32 kind (0 = message, 1 = response)
+  // followed by, for messages, an int32 channel length, the UTF-8 channel
+  // bytes, an int32 reply id and an int32 payload length (-1 for none) with
+  // the payload bytes; responses carry just the reply id and payload. All
+  // integers are in native byte order. The buffer contents are only valid for
+  // the duration of this call.
+  @SuppressWarnings("unused")
+  private void handlePlatformMessageBatch(ByteBuffer buffer, int bytes, int count) {
+    buffer.order(ByteOrder.nativeOrder());
+    buffer.position(0);
+    buffer.limit(bytes);
+    for (int i = 0; i < count; i++) {
+      int kind = buffer.getInt();
+      if (kind == 0) {
+        byte[] channelBytes = new byte[buffer.getInt()];
+        buffer.get(channelBytes);
+        String channel = new String(channelBytes, Charset.forName("UTF-8"));
+        int replyId = buffer.getInt();
+        int payloadLength = buffer.getInt();
+        byte[] message = null;
+        if (payloadLength >= 0) {
+          message = new byte[payloadLength];
+          buffer.get(message);
+        }
+        handlePlatformMessage(channel, message, replyId);
+      } else {
+        int replyId = buffer.getInt();
+        int payloadLength = buffer.getInt();
+        byte[] reply = null;
+        if (payloadLength >= 0) {
+          reply = new byte[payloadLength];
+          buffer.get(reply);
+        }
+        handlePlatformMessageResponse(replyId, reply);
+      }
+    }
+    buffer.clear();
+  }
+
   // Called by native to respond to a platform message that we sent.
   // TODO(mattcarroll): determine if reply is nonull or nullable
   @SuppressWarnings("unused")
@@ -0,0 +1,178 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/android/platform_message_batcher.h"
+
+#include <cstring>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/platform/android/jni_util.h"
+#include "flutter/shell/platform/android/platform_view_android_jni.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr size_t kInitialBufferCapacity = 16 * 1024;
+
+// Entry kinds in the encoded batch. Must match the decoder in
+// FlutterJNI.handlePlatformMessageBatch.
+constexpr int32_t kEntryKindMessage = 0;
+constexpr int32_t kEntryKindResponse = 1;
+
+// Length field value for an absent payload.
+constexpr int32_t kNoPayload = -1;
+
+void WriteInt32(uint8_t** cursor, int32_t value) {
+  // Native byte order; the Java decoder reads with ByteOrder.nativeOrder().
+  memcpy(*cursor, &value, sizeof(value));
+  *cursor += sizeof(value);
+}
+
+void WriteBytes(uint8_t** cursor, const void* data, size_t size) {
+  memcpy(*cursor, data, size);
+  *cursor += size;
+}
+
+}  // namespace
+
+PlatformMessageBatcher::PlatformMessageBatcher(
+    fml::jni::JavaObjectWeakGlobalRef java_object,
+    fml::RefPtr<fml::TaskRunner> platform_task_runner)
+    : java_object_(std::move(java_object)),
+      platform_task_runner_(std::move(platform_task_runner)) {}
+
+PlatformMessageBatcher::~PlatformMessageBatcher() = default;
+
+void PlatformMessageBatcher::EnqueueMessage(
+    fml::RefPtr<PlatformMessage> message,
+    int response_id) {
+  Entry entry;
+  entry.message = std::move(message);
+  entry.response_id = response_id;
+  pending_.push_back(std::move(entry));
+  ScheduleFlush();
+}
+
+void PlatformMessageBatcher::EnqueueResponse(
+    int response_id,
+    std::unique_ptr<fml::Mapping> data) {
+  Entry entry;
+  entry.response_data = std::move(data);
+  entry.response_id = response_id;
+  pending_.push_back(std::move(entry));
+  ScheduleFlush();
+}
+
+void PlatformMessageBatcher::ScheduleFlush() {
+  if (flush_scheduled_) {
+    return;
+  }
+  flush_scheduled_ = true;
+  // Runs at the end of the current message loop iteration, so every message
+  // enqueued by the tasks ahead of it rides along in the same batch.
+  platform_task_runner_->PostTask([weak = weak_from_this()]() {
+    if (auto batcher = weak.lock()) {
+      batcher->Flush();
+    }
+  });
+}
+
+bool PlatformMessageBatcher::EnsureBufferCapacity(JNIEnv* env,
+                                                  size_t required_bytes) {
+  if (buffer_ && buffer_capacity_ >= required_bytes) {
+    return true;
+  }
+  size_t capacity =
+      buffer_capacity_ ? buffer_capacity_ : kInitialBufferCapacity;
+  while (capacity < required_bytes) {
+    capacity *= 2;
+  }
+  auto buffer = std::make_unique<uint8_t[]>(capacity);
+  auto java_buffer = env->NewDirectByteBuffer(buffer.get(), capacity);
+  if (java_buffer == nullptr) {
+    return false;
+  }
+  buffer_ = std::move(buffer);
+  buffer_capacity_ = capacity;
+  java_buffer_.Reset(env, java_buffer);
+  env->DeleteLocalRef(java_buffer);
+  return true;
+}
+
+void PlatformMessageBatcher::Flush() {
+  flush_scheduled_ = false;
+  if (pending_.empty()) {
+    return;
+  }
+  auto entries = std::move(pending_);
+  pending_.clear();
+
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+  auto view = java_object_.get(env);
+  if (view.is_null()) {
+    // The Java object died; drop the batch on the floor.
+    return;
+  }
+
+  size_t required_bytes = 0;
+  for (const auto& entry : entries) {
+    // Kind, response id and payload length.
+    required_bytes += 3 * sizeof(int32_t);
+    if (entry.message) {
+      required_bytes += sizeof(int32_t) + entry.message->channel().size();
+      if (entry.message->hasData()) {
+        required_bytes += entry.message->data().GetSize();
+      }
+    } else if (entry.response_data) {
+      required_bytes += entry.response_data->GetSize();
+    }
+  }
+
+  if (!EnsureBufferCapacity(env, required_bytes)) {
+    FML_LOG(ERROR) << "Could not allocate the platform message batch buffer.";
+    return;
+  }
+
+  uint8_t* cursor = buffer_.get();
+  for (const auto& entry : entries) {
+    if (entry.message) {
+      WriteInt32(&cursor, kEntryKindMessage);
+      const std::string& channel = entry.message->channel();
+      WriteInt32(&cursor, channel.size());
+      WriteBytes(&cursor, channel.data(), channel.size());
+      WriteInt32(&cursor, entry.response_id);
+      if (entry.message->hasData()) {
+        const fml::Mapping& data = entry.message->data();
+        WriteInt32(&cursor, data.GetSize());
+        WriteBytes(&cursor, data.GetMapping(), data.GetSize());
+      } else {
+        WriteInt32(&cursor, kNoPayload);
+      }
+    } else {
+      WriteInt32(&cursor, kEntryKindResponse);
+      WriteInt32(&cursor, entry.response_id);
+      if (entry.response_data) {
+        WriteInt32(&cursor, entry.response_data->GetSize());
+        WriteBytes(&cursor, entry.response_data->GetMapping(),
+                   entry.response_data->GetSize());
+      } else {
+        WriteInt32(&cursor, kNoPayload);
+      }
+    }
+  }
+  FML_DCHECK(static_cast<size_t>(cursor - buffer_.get()) == required_bytes);
+
+  // The messages are released before the call since handlers can re-enter
+  // the engine; the bytes live on in the shared buffer.
+  const jint entry_count = entries.size();
+  entries.clear();
+
+  // This call can re-enter in InvokePlatformMessageXxxResponseCallback.
+  FlutterViewHandlePlatformMessageBatch(env, view.obj(), java_buffer_.obj(),
+                                        required_bytes, entry_count);
+}
+
+}  // namespace flutter
@@ -0,0 +1,80 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_ANDROID_PLATFORM_MESSAGE_BATCHER_H_
+#define FLUTTER_SHELL_PLATFORM_ANDROID_PLATFORM_MESSAGE_BATCHER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/platform/android/jni_weak_ref.h"
+#include "flutter/fml/platform/android/scoped_java_ref.h"
+#include "flutter/fml/task_runner.h"
+#include "flutter/lib/ui/window/platform_message.h"
+
+namespace flutter {
+
+// Accumulates engine-to-Java platform messages and message responses on the
+// platform thread and delivers them to Java in one JNI call per message loop
+// iteration. The payloads are encoded into a single direct ByteBuffer whose
+// backing store is owned on this side, so a batch costs one method
+// transition regardless of how many messages it carries and no per-message
+// byte[] is allocated from native code.
+//
+// All methods must be called on the platform thread.
+class PlatformMessageBatcher
+    : public std::enable_shared_from_this<PlatformMessageBatcher> {
+ public:
+  PlatformMessageBatcher(fml::jni::JavaObjectWeakGlobalRef java_object,
+                         fml::RefPtr<fml::TaskRunner> platform_task_runner);
+
+  ~PlatformMessageBatcher();
+
+  // Queues a message for delivery to Java. |response_id| is 0 when no
+  // response is expected. The message (and its payload mapping) is retained
+  // until the batch is flushed.
+  void EnqueueMessage(fml::RefPtr<PlatformMessage> message, int response_id);
+
+  // Queues the response to a message previously sent from Java. |data| may
+  // be null for an empty response.
+  void EnqueueResponse(int response_id, std::unique_ptr<fml::Mapping> data);
+
+ private:
+  struct Entry {
+    // Set for messages; null for responses.
+    fml::RefPtr<PlatformMessage> message;
+    // Null for messages and empty responses.
+    std::unique_ptr<fml::Mapping> response_data;
+    int response_id = 0;
+  };
+
+  // Posts the flush task for the end of the current message loop iteration
+  // if one is not already pending.
+  void ScheduleFlush();
+
+  // Encodes all pending entries into the shared buffer and makes the single
+  // batch call into Java.
+  void Flush();
+
+  // Grows the shared buffer (and the direct ByteBuffer wrapping it) to hold
+  // at least |required_bytes|.
+  bool EnsureBufferCapacity(JNIEnv* env, size_t required_bytes);
+
+  fml::jni::JavaObjectWeakGlobalRef java_object_;
+  fml::RefPtr<fml::TaskRunner> platform_task_runner_;
+  std::vector<Entry> pending_;
+  bool flush_scheduled_ = false;
+  std::unique_ptr<uint8_t[]> buffer_;
+  size_t buffer_capacity_ = 0;
+  fml::jni::ScopedJavaGlobalRef<jobject> java_buffer_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PlatformMessageBatcher);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_ANDROID_PLATFORM_MESSAGE_BATCHER_H_
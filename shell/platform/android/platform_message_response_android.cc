@@ -5,16 +5,15 @@
 #include "flutter/shell/platform/android/platform_message_response_android.h"
 
 #include "flutter/fml/make_copyable.h"
-#include "flutter/shell/platform/android/platform_view_android_jni.h"
 
 namespace flutter {
 
 PlatformMessageResponseAndroid::PlatformMessageResponseAndroid(
     int response_id,
-    fml::jni::JavaObjectWeakGlobalRef weak_java_object,
+    std::shared_ptr<PlatformMessageBatcher> message_batcher,
     fml::RefPtr<fml::TaskRunner> platform_task_runner)
     : response_id_(response_id),
-      weak_java_object_(weak_java_object),
+      message_batcher_(std::move(message_batcher)),
       platform_task_runner_(std::move(platform_task_runner)) {}
 
 PlatformMessageResponseAndroid::~PlatformMessageResponseAndroid() = default;
@@ -23,53 +22,22 @@ PlatformMessageResponseAndroid::~PlatformMessageResponseAndroid() = default;
 void PlatformMessageResponseAndroid::Complete(
     std::unique_ptr<fml::Mapping> data) {
   platform_task_runner_->PostTask(
-      fml::MakeCopyable([response = response_id_,               //
-                         weak_java_object = weak_java_object_,  //
-                         data = std::move(data)                 //
-  ]() {
-        // We are on the platform thread. Attempt to get the strong reference to
-        // the Java object.
-        auto* env = fml::jni::AttachCurrentThread();
-        auto java_object = weak_java_object.get(env);
-
-        if (java_object.is_null()) {
-          // The Java object was collected before this message response got to
-          // it. Drop the response on the floor.
-          return;
-        }
-
-        // Convert the vector to a Java byte array.
-        fml::jni::ScopedJavaLocalRef<jbyteArray> data_array(
-            env, env->NewByteArray(data->GetSize()));
-        env->SetByteArrayRegion(
-            data_array.obj(), 0, data->GetSize(),
-            reinterpret_cast<const jbyte*>(data->GetMapping()));
-
-        // Make the response call into Java.
-        FlutterViewHandlePlatformMessageResponse(env, java_object.obj(),
-                                                 response, data_array.obj());
+      fml::MakeCopyable([response = response_id_,          //
+                         batcher = message_batcher_,       //
+                         data = std::move(data)            //
+  ]() mutable {
+        // We are on the platform thread; the batcher folds this response
+        // into the next batch call into Java.
+        batcher->EnqueueResponse(response, std::move(data));
       }));
 }
 
 // |flutter::PlatformMessageResponse|
 void PlatformMessageResponseAndroid::CompleteEmpty() {
-  platform_task_runner_->PostTask(
-      fml::MakeCopyable([response = response_id_,              //
-                         weak_java_object = weak_java_object_  //
-  ]() {
-        // We are on the platform thread. Attempt to get the strong reference to
-        // the Java object.
-        auto* env = fml::jni::AttachCurrentThread();
-        auto java_object = weak_java_object.get(env);
-
-        if (java_object.is_null()) {
-          // The Java object was collected before this message response got to
-          // it. Drop the response on the floor.
-          return;
-        }
-        // Make the response call into Java.
-        FlutterViewHandlePlatformMessageResponse(env, java_object.obj(),
-                                                 response, nullptr);
-      }));
+  platform_task_runner_->PostTask([response = response_id_,     //
+                                   batcher = message_batcher_]() {
+    batcher->EnqueueResponse(response, nullptr);
+  });
 }
+
 }  // namespace flutter
@@ -6,9 +6,9 @@
 #define FLUTTER_SHELL_PLATFORM_ANDROID_PLATFORM_MESSAGE_RESPONSE_ANDROID_H_
 
 #include "flutter/fml/macros.h"
-#include "flutter/fml/platform/android/jni_weak_ref.h"
 #include "flutter/fml/task_runner.h"
 #include "flutter/lib/ui/window/platform_message_response.h"
+#include "flutter/shell/platform/android/platform_message_batcher.h"
 
 namespace flutter {
 
@@ -23,13 +23,13 @@ class PlatformMessageResponseAndroid : public flutter::PlatformMessageResponse {
  private:
   PlatformMessageResponseAndroid(
       int response_id,
-      fml::jni::JavaObjectWeakGlobalRef weak_java_object,
+      std::shared_ptr<PlatformMessageBatcher> message_batcher,
       fml::RefPtr<fml::TaskRunner> platform_task_runner);
 
   ~PlatformMessageResponseAndroid() override;
 
   int response_id_;
-  fml::jni::JavaObjectWeakGlobalRef weak_java_object_;
+  std::shared_ptr<PlatformMessageBatcher> message_batcher_;
   fml::RefPtr<fml::TaskRunner> platform_task_runner_;
 
   FML_FRIEND_MAKE_REF_COUNTED(PlatformMessageResponseAndroid);
@@ -22,10 +22,15 @@ PlatformViewAndroid::PlatformViewAndroid(
     PlatformView::Delegate& delegate,
     flutter::TaskRunners task_runners,
     fml::jni::JavaObjectWeakGlobalRef java_object,
-    bool use_software_rendering)
+    bool use_software_rendering,
+    bool prefer_reduced_color_depth)
     : PlatformView(delegate, std::move(task_runners)),
       java_object_(java_object),
-      android_surface_(AndroidSurface::Create(use_software_rendering)) {
+      android_surface_(AndroidSurface::Create(use_software_rendering,
+                                              prefer_reduced_color_depth)),
+      message_batcher_(std::make_shared<PlatformMessageBatcher>(
+          java_object_,
+          task_runners_.GetPlatformTaskRunner())) {
   FML_CHECK(android_surface_)
       << "Could not create an OpenGL, Vulkan or Software surface to setup "
          "rendering.";
@@ -37,7 +42,10 @@ PlatformViewAndroid::PlatformViewAndroid(
     fml::jni::JavaObjectWeakGlobalRef java_object)
     : PlatformView(delegate, std::move(task_runners)),
       java_object_(java_object),
-      android_surface_(nullptr) {}
+      android_surface_(nullptr),
+      message_batcher_(std::make_shared<PlatformMessageBatcher>(
+          java_object_,
+          task_runners_.GetPlatformTaskRunner())) {}
 
 PlatformViewAndroid::~PlatformViewAndroid() = default;
 
@@ -57,10 +65,44 @@ void PlatformViewAndroid::NotifyCreated(
     latch.Wait();
   }
 
+  if (prewarmed_rendering_) {
+    // The rasterizer was already set up against the prewarm pbuffer and the
+    // underlying EGL context survived the window bind, so announcing the
+    // view again would only tear the warm raster context down.
+    return;
+  }
+
+  PlatformView::NotifyCreated();
+}
+
+void PlatformViewAndroid::NotifyPrewarm() {
+  if (!android_surface_ || prewarmed_rendering_) {
+    return;
+  }
+
+  bool prewarmed = false;
+  fml::AutoResetWaitableEvent latch;
+  fml::TaskRunner::RunNowOrPostTask(
+      task_runners_.GetRasterTaskRunner(),
+      [&latch, &prewarmed, surface = android_surface_.get()]() {
+        prewarmed = surface->PrewarmRenderingContext();
+        latch.Signal();
+      });
+  latch.Wait();
+
+  if (!prewarmed) {
+    return;
+  }
+
+  InstallFirstFrameCallback();
+  // Set up the rasterizer now; no frames are produced until the embedder
+  // delivers viewport metrics, which cannot happen before a window attach.
   PlatformView::NotifyCreated();
+  prewarmed_rendering_ = true;
 }
 
 void PlatformViewAndroid::NotifyDestroyed() {
+  prewarmed_rendering_ = false;
   PlatformView::NotifyDestroyed();
 
   if (android_surface_) {
@@ -96,13 +138,26 @@ void PlatformViewAndroid::DispatchPlatformMessage(JNIEnv* env,
                                                   jint response_id) {
   uint8_t* message_data =
       static_cast<uint8_t*>(env->GetDirectBufferAddress(java_message_data));
-  std::vector<uint8_t> message =
-      std::vector<uint8_t>(message_data, message_data + java_message_position);
+  std::unique_ptr<fml::Mapping> message;
+  if (message_data != nullptr) {
+    // The memory of a direct buffer stays valid for as long as the Java
+    // object is strongly referenced, so a global reference lets the engine
+    // read the bytes in place instead of copying them out.
+    jobject global_buffer = env->NewGlobalRef(java_message_data);
+    message = std::make_unique<fml::NonOwnedMapping>(
+        message_data, java_message_position,
+        [global_buffer](const uint8_t* data, size_t size) {
+          JNIEnv* env = fml::jni::AttachCurrentThread();
+          env->DeleteGlobalRef(global_buffer);
+        });
+  } else {
+    message = std::make_unique<fml::DataMapping>(std::vector<uint8_t>());
+  }
 
   fml::RefPtr<flutter::PlatformMessageResponse> response;
   if (response_id) {
     response = fml::MakeRefCounted<PlatformMessageResponseAndroid>(
-        response_id, java_object_, task_runners_.GetPlatformTaskRunner());
+        response_id, message_batcher_, task_runners_.GetPlatformTaskRunner());
   }
 
   PlatformView::DispatchPlatformMessage(
@@ -116,7 +171,7 @@ void PlatformViewAndroid::DispatchEmptyPlatformMessage(JNIEnv* env,
   fml::RefPtr<flutter::PlatformMessageResponse> response;
   if (response_id) {
     response = fml::MakeRefCounted<PlatformMessageResponseAndroid>(
-        response_id, java_object_, task_runners_.GetPlatformTaskRunner());
+        response_id, message_batcher_, task_runners_.GetPlatformTaskRunner());
   }
 
   PlatformView::DispatchPlatformMessage(
@@ -160,35 +215,14 @@ void PlatformViewAndroid::InvokePlatformMessageEmptyResponseCallback(
 // |PlatformView|
 void PlatformViewAndroid::HandlePlatformMessage(
     fml::RefPtr<flutter::PlatformMessage> message) {
-  JNIEnv* env = fml::jni::AttachCurrentThread();
-  fml::jni::ScopedJavaLocalRef<jobject> view = java_object_.get(env);
-  if (view.is_null())
-    return;
-
   int response_id = 0;
   if (auto response = message->response()) {
     response_id = next_response_id_++;
     pending_responses_[response_id] = response;
   }
-  auto java_channel = fml::jni::StringToJavaString(env, message->channel());
-  if (message->hasData()) {
-    fml::jni::ScopedJavaLocalRef<jbyteArray> message_array(
-        env, env->NewByteArray(message->data().size()));
-    env->SetByteArrayRegion(
-        message_array.obj(), 0, message->data().size(),
-        reinterpret_cast<const jbyte*>(message->data().data()));
-    message = nullptr;
-
-    // This call can re-enter in InvokePlatformMessageXxxResponseCallback.
-    FlutterViewHandlePlatformMessage(env, view.obj(), java_channel.obj(),
-                                     message_array.obj(), response_id);
-  } else {
-    message = nullptr;
-
-    // This call can re-enter in InvokePlatformMessageXxxResponseCallback.
-    FlutterViewHandlePlatformMessage(env, view.obj(), java_channel.obj(),
-                                     nullptr, response_id);
-  }
+  // The batcher makes the JNI transition once per loop iteration for all
+  // messages dispatched during that iteration.
+  message_batcher_->EnqueueMessage(std::move(message), response_id);
 }
 
 // |PlatformView|
@@ -17,6 +17,7 @@
 #include "flutter/shell/common/platform_view.h"
 #include "flutter/shell/platform/android/android_native_window.h"
 #include "flutter/shell/platform/android/android_surface.h"
+#include "flutter/shell/platform/android/platform_message_batcher.h"
 
 namespace flutter {
 
@@ -34,12 +35,19 @@ class PlatformViewAndroid final : public PlatformView {
   PlatformViewAndroid(PlatformView::Delegate& delegate,
                       flutter::TaskRunners task_runners,
                       fml::jni::JavaObjectWeakGlobalRef java_object,
-                      bool use_software_rendering);
+                      bool use_software_rendering,
+                      bool prefer_reduced_color_depth = false);
 
   ~PlatformViewAndroid() override;
 
   void NotifyCreated(fml::RefPtr<AndroidNativeWindow> native_window);
 
+  // Sets up the rendering pipeline against an offscreen pbuffer before any
+  // native window exists, so the raster context and compositor caches are
+  // warm by the time NotifyCreated delivers the real window. Safe to call on
+  // views without a rendering surface, where it does nothing.
+  void NotifyPrewarm();
+
   void NotifyChanged(const SkISize& size);
 
   // |PlatformView|
@@ -76,6 +84,14 @@ class PlatformViewAndroid final : public PlatformView {
  private:
   const fml::jni::JavaObjectWeakGlobalRef java_object_;
   const std::unique_ptr<AndroidSurface> android_surface_;
+  // Messages and responses bound for Java are delivered through this in one
+  // JNI call per platform message loop iteration. Shared with the in-flight
+  // message responses.
+  std::shared_ptr<PlatformMessageBatcher> message_batcher_;
+  // Whether the rendering pipeline was prewarmed against an offscreen
+  // pbuffer and is still live, in which case NotifyCreated only rebinds the
+  // window instead of rebuilding the raster context.
+  bool prewarmed_rendering_ = false;
   // We use id 0 to mean that no response is expected.
   int next_response_id_ = 1;
   std::unordered_map<int, fml::RefPtr<flutter::PlatformMessageResponse>>
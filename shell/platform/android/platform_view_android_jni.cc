@@ -87,6 +87,17 @@ void FlutterViewHandlePlatformMessageResponse(JNIEnv* env,
   FML_CHECK(CheckException(env));
 }
 
+static jmethodID g_handle_platform_message_batch_method = nullptr;
+void FlutterViewHandlePlatformMessageBatch(JNIEnv* env,
+                                           jobject obj,
+                                           jobject buffer,
+                                           jint bytes,
+                                           jint count) {
+  env->CallVoidMethod(obj, g_handle_platform_message_batch_method, buffer,
+                      bytes, count);
+  FML_CHECK(CheckException(env));
+}
+
 static jmethodID g_update_semantics_method = nullptr;
 void FlutterViewUpdateSemantics(JNIEnv* env,
                                 jobject obj,
@@ -684,6 +695,15 @@ bool RegisterApi(JNIEnv* env) {
     return false;
   }
 
+  g_handle_platform_message_batch_method = env->GetMethodID(
+      g_flutter_jni_class->obj(), "handlePlatformMessageBatch",
+      "(Ljava/nio/ByteBuffer;II)V");
+
+  if (g_handle_platform_message_batch_method == nullptr) {
+    FML_LOG(ERROR) << "Could not locate handlePlatformMessageBatch method";
+    return false;
+  }
+
   g_update_semantics_method =
       env->GetMethodID(g_flutter_jni_class->obj(), "updateSemantics",
                        "(Ljava/nio/ByteBuffer;[Ljava/lang/String;)V");
@@ -22,6 +22,12 @@ void FlutterViewHandlePlatformMessageResponse(JNIEnv* env,
                                               jint responseId,
                                               jobject response);
 
+void FlutterViewHandlePlatformMessageBatch(JNIEnv* env,
+                                           jobject obj,
+                                           jobject buffer,
+                                           jint bytes,
+                                           jint count);
+
 void FlutterViewUpdateSemantics(JNIEnv* env,
                                 jobject obj,
                                 jobject buffer,
@@ -4,6 +4,9 @@
 
 #include "flutter/shell/platform/android/vsync_waiter_android.h"
 
+#include <dlfcn.h>
+
+#include <atomic>
 #include <cmath>
 #include <utility>
 
@@ -19,6 +22,69 @@ namespace flutter {
 static fml::jni::ScopedJavaGlobalRef<jclass>* g_vsync_waiter_class = nullptr;
 static jmethodID g_async_wait_for_vsync_method_ = nullptr;
 
+namespace {
+
+// The NDK AChoreographer saves a Java round trip on every frame, but its
+// pieces arrived across releases: frame callbacks in API 24, the 64-bit
+// variant in API 29 and refresh rate callbacks in API 30. The engine still
+// supports older devices, so the symbols are resolved at runtime and the
+// Java Choreographer remains the fallback. Only the 64-bit callback is used
+// to avoid truncated frame times on 32-bit devices.
+struct AChoreographer;
+typedef void (*AChoreographerFrameCallback64)(int64_t frame_time_nanos,
+                                              void* data);
+typedef void (*AChoreographerRefreshRateCallback)(int64_t vsync_period_nanos,
+                                                  void* data);
+
+AChoreographer* (*g_get_instance)() = nullptr;
+void (*g_post_frame_callback64)(AChoreographer*,
+                                AChoreographerFrameCallback64,
+                                void*) = nullptr;
+void (*g_register_refresh_rate_callback)(AChoreographer*,
+                                         AChoreographerRefreshRateCallback,
+                                         void*) = nullptr;
+
+// The vsync period last reported by the refresh rate callback, or 0 when
+// none has arrived (or the callback is unavailable).
+std::atomic<int64_t> g_refresh_period_nanos{0};
+
+void ResolveChoreographerSymbols() {
+  g_get_instance = reinterpret_cast<decltype(g_get_instance)>(
+      dlsym(RTLD_DEFAULT, "AChoreographer_getInstance"));
+  g_post_frame_callback64 = reinterpret_cast<decltype(g_post_frame_callback64)>(
+      dlsym(RTLD_DEFAULT, "AChoreographer_postFrameCallback64"));
+  g_register_refresh_rate_callback =
+      reinterpret_cast<decltype(g_register_refresh_rate_callback)>(
+          dlsym(RTLD_DEFAULT, "AChoreographer_registerRefreshRateCallback"));
+}
+
+bool NativeChoreographerSupported() {
+  return g_get_instance != nullptr && g_post_frame_callback64 != nullptr;
+}
+
+// Reads the refresh rate published by the Java embedding. Only consulted
+// when the native refresh rate callback has not reported a period.
+float JavaRefreshRateFPS() {
+  JNIEnv* env = fml::jni::AttachCurrentThread();
+  jfieldID fid =
+      env->GetStaticFieldID(g_vsync_waiter_class->obj(), "refreshRateFPS", "F");
+  return env->GetStaticFloatField(g_vsync_waiter_class->obj(), fid);
+}
+
+int64_t CurrentFramePeriodNanos() {
+  int64_t period = g_refresh_period_nanos.load(std::memory_order_relaxed);
+  if (period > 0) {
+    return period;
+  }
+  float fps = JavaRefreshRateFPS();
+  if (fps <= 0) {
+    fps = 60.0f;
+  }
+  return static_cast<int64_t>(1e9 / fps);
+}
+
+}  // namespace
+
 VsyncWaiterAndroid::VsyncWaiterAndroid(flutter::TaskRunners task_runners)
     : VsyncWaiter(std::move(task_runners)) {}
 
@@ -30,6 +96,27 @@ void VsyncWaiterAndroid::AwaitVSync() {
   jlong java_baton = reinterpret_cast<jlong>(weak_this);
 
   task_runners_.GetPlatformTaskRunner()->PostTask([java_baton]() {
+    if (NativeChoreographerSupported()) {
+      // The platform thread is the Android main thread, which always has a
+      // looper, so the per-thread choreographer instance is available here.
+      AChoreographer* choreographer = g_get_instance();
+
+      // Runs on the platform thread only; no synchronization required.
+      static bool refresh_rate_callback_registered = false;
+      if (!refresh_rate_callback_registered &&
+          g_register_refresh_rate_callback != nullptr) {
+        g_register_refresh_rate_callback(
+            choreographer, &VsyncWaiterAndroid::OnRefreshPeriodChanged,
+            nullptr);
+        refresh_rate_callback_registered = true;
+      }
+
+      g_post_frame_callback64(choreographer,
+                              &VsyncWaiterAndroid::OnNativeChoreographerVsync,
+                              reinterpret_cast<void*>(java_baton));
+      return;
+    }
+
     JNIEnv* env = fml::jni::AttachCurrentThread();
     env->CallStaticVoidMethod(g_vsync_waiter_class->obj(),     //
                               g_async_wait_for_vsync_method_,  //
@@ -39,6 +126,10 @@ void VsyncWaiterAndroid::AwaitVSync() {
 }
 
 float VsyncWaiterAndroid::GetDisplayRefreshRate() const {
+  int64_t period = g_refresh_period_nanos.load(std::memory_order_relaxed);
+  if (period > 0) {
+    return 1e9 / period;
+  }
   JNIEnv* env = fml::jni::AttachCurrentThread();
   if (g_vsync_waiter_class == nullptr) {
     return kUnknownRefreshRateFPS;
@@ -67,6 +158,29 @@ void VsyncWaiterAndroid::OnNativeVsync(JNIEnv* env,
   ConsumePendingCallback(java_baton, frame_time, target_time);
 }
 
+// static
+void VsyncWaiterAndroid::OnNativeChoreographerVsync(int64_t frame_time_nanos,
+                                                    void* data) {
+  TRACE_EVENT0("flutter", "VSYNC");
+
+  auto frame_time = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromNanoseconds(frame_time_nanos));
+  // The choreographer only reports the frame start; derive the target from
+  // the current vsync period like the Java delegate does.
+  auto target_time =
+      fml::TimePoint::FromEpochDelta(fml::TimeDelta::FromNanoseconds(
+          frame_time_nanos + CurrentFramePeriodNanos()));
+
+  ConsumePendingCallback(reinterpret_cast<jlong>(data), frame_time,
+                         target_time);
+}
+
+// static
+void VsyncWaiterAndroid::OnRefreshPeriodChanged(int64_t vsync_period_nanos,
+                                                void* data) {
+  g_refresh_period_nanos.store(vsync_period_nanos, std::memory_order_relaxed);
+}
+
 // static
 void VsyncWaiterAndroid::ConsumePendingCallback(
     jlong java_baton,
@@ -95,6 +209,8 @@ bool VsyncWaiterAndroid::Register(JNIEnv* env) {
     return false;
   }
 
+  ResolveChoreographerSymbols();
+
   g_vsync_waiter_class = new fml::jni::ScopedJavaGlobalRef<jclass>(env, clazz);
 
   FML_CHECK(!g_vsync_waiter_class->is_null());
@@ -34,6 +34,13 @@ class VsyncWaiterAndroid final : public VsyncWaiter {
                             jlong frameTargetTimeNanos,
                             jlong java_baton);
 
+  // Frame callback for the NDK AChoreographer path. |data| carries the same
+  // baton as the Java path.
+  static void OnNativeChoreographerVsync(int64_t frame_time_nanos, void* data);
+
+  // Refresh rate callback registered with AChoreographer on API 30+.
+  static void OnRefreshPeriodChanged(int64_t vsync_period_nanos, void* data);
+
   static void ConsumePendingCallback(jlong java_baton,
                                      fml::TimePoint frame_start_time,
                                      fml::TimePoint frame_target_time);
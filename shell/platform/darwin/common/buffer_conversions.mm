@@ -16,11 +16,21 @@ NSData* GetNSDataFromVector(const std::vector<uint8_t>& buffer) {
 }
 
 std::unique_ptr<fml::Mapping> GetMappingFromNSData(NSData* data) {
-  return std::make_unique<fml::DataMapping>(GetVectorFromNSData(data));
+  // -copy retains immutable instances instead of duplicating the bytes and
+  // insulates the mapping against callers that handed in mutable data.
+  NSData* copy = [data copy];
+  return std::make_unique<fml::NonOwnedMapping>(
+      static_cast<const uint8_t*>(copy.bytes), copy.length,
+      [copy](const uint8_t* data, size_t size) { [copy release]; });
 }
 
 NSData* GetNSDataFromMapping(std::unique_ptr<fml::Mapping> mapping) {
-  return [NSData dataWithBytes:mapping->GetMapping() length:mapping->GetSize()];
+  fml::Mapping* peer = mapping.release();
+  return [NSData dataWithBytesNoCopy:const_cast<uint8_t*>(peer->GetMapping())
+                              length:peer->GetSize()
+                         deallocator:^(void* bytes, NSUInteger length) {
+                           delete peer;
+                         }];
 }
 
 }  // namespace flutter
@@ -60,7 +60,7 @@ static constexpr int kNumProfilerSamplesPerSec = 5;
 
   std::unique_ptr<flutter::FlutterPlatformViewsController> _platformViewsController;
   std::unique_ptr<flutter::ProfilerMetricsIOS> _profiler_metrics;
-  std::unique_ptr<flutter::SamplingProfiler> _profiler;
+  std::shared_ptr<flutter::SamplingProfiler> _profiler;
 
   // Channels
   fml::scoped_nsobject<FlutterPlatformPlugin> _platformPlugin;
@@ -327,10 +327,13 @@ static constexpr int kNumProfilerSamplesPerSec = 5;
 
 - (void)startProfiler:(NSString*)threadLabel {
   _profiler_metrics = std::make_unique<flutter::ProfilerMetricsIOS>();
-  _profiler = std::make_unique<flutter::SamplingProfiler>(
+  _profiler = std::make_shared<flutter::SamplingProfiler>(
       threadLabel.UTF8String, _threadHost.profiler_thread->GetTaskRunner(),
       [self]() { return self->_profiler_metrics->GenerateSample(); }, kNumProfilerSamplesPerSec);
   _profiler->Start();
+  // Lets the start/stop and sample export service protocol extensions reach
+  // the profiler. The shell only holds a weak reference.
+  _shell->SetSamplingProfiler(_profiler);
 }
 
 // If you add a channel, be sure to also update `resetChannels`.
@@ -670,7 +673,7 @@ static constexpr int kNumProfilerSamplesPerSec = 5;
   fml::RefPtr<flutter::PlatformMessage> platformMessage =
       (message == nil) ? fml::MakeRefCounted<flutter::PlatformMessage>(channel.UTF8String, response)
                        : fml::MakeRefCounted<flutter::PlatformMessage>(
-                             channel.UTF8String, flutter::GetVectorFromNSData(message), response);
+                             channel.UTF8String, flutter::GetMappingFromNSData(message), response);
 
   _shell->GetPlatformView()->DispatchPlatformMessage(platformMessage);
 }
@@ -18,6 +18,7 @@
 #include "flutter/fml/platform/darwin/scoped_nsobject.h"
 #include "flutter/shell/common/persistent_cache.h"
 #include "flutter/shell/platform/darwin/common/framework/Headers/FlutterChannels.h"
+#include "third_party/skia/include/core/SkData.h"
 
 namespace flutter {
 
@@ -73,13 +74,16 @@ std::shared_ptr<FlutterPlatformViewLayer> FlutterPlatformViewLayerPool::GetLayer
     layers_.push_back(layer);
   }
   std::shared_ptr<FlutterPlatformViewLayer> layer = layers_[available_layer_index_];
+  layer->frames_unused = 0;
   if (gr_context != layer->gr_context) {
     layer->gr_context = gr_context;
     // The overlay already exists, but the GrContext was changed so we need to recreate
-    // the rendering surface with the new GrContext.
+    // the rendering surface with the new GrContext. The old surface's pixels are gone
+    // with it, so any recorded content fingerprint is stale.
     IOSSurface* ios_surface = layer->ios_surface.get();
     std::unique_ptr<Surface> surface = ios_surface->CreateGPUSurface(gr_context);
     layer->surface = std::move(surface);
+    layer->content_signature = 0;
   }
   available_layer_index_++;
   return layer;
@@ -89,6 +93,21 @@ void FlutterPlatformViewLayerPool::RecycleLayers() {
   available_layer_index_ = 0;
 }
 
+void FlutterPlatformViewLayerPool::CollectUnusedLayers() {
+  // The used layers sit in [0, available_layer_index_), so the unused tail can be erased
+  // without disturbing the index bookkeeping. Layers are only torn down after the grace
+  // period: interleaving changes during a scroll park and revive overlays constantly, and
+  // recreating a CAEAGLLayer/CAMetalLayer backed surface every time is expensive.
+  auto it = layers_.begin() + available_layer_index_;
+  while (it != layers_.end()) {
+    if (++((*it)->frames_unused) > kTeardownGraceFrames) {
+      it = layers_.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
+
 std::vector<std::shared_ptr<FlutterPlatformViewLayer>>
 FlutterPlatformViewLayerPool::GetUnusedLayers() {
   std::vector<std::shared_ptr<FlutterPlatformViewLayer>> results;
@@ -315,10 +334,10 @@ std::vector<SkCanvas*> FlutterPlatformViewsController::GetCurrentCanvases() {
 }
 
 int FlutterPlatformViewsController::CountClips(const MutatorsStack& mutators_stack) {
-  std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator iter = mutators_stack.Bottom();
+  std::vector<Mutator>::const_reverse_iterator iter = mutators_stack.Bottom();
   int clipCount = 0;
   while (iter != mutators_stack.Top()) {
-    if ((*iter)->IsClipType()) {
+    if (iter->IsClipType()) {
       clipCount++;
     }
     ++iter;
@@ -366,11 +385,11 @@ void FlutterPlatformViewsController::ApplyMutators(const MutatorsStack& mutators
   UIView* head = embedded_view;
   ResetAnchor(head.layer);
 
-  std::vector<std::shared_ptr<Mutator>>::const_reverse_iterator iter = mutators_stack.Bottom();
+  std::vector<Mutator>::const_reverse_iterator iter = mutators_stack.Bottom();
   while (iter != mutators_stack.Top()) {
-    switch ((*iter)->GetType()) {
+    switch (iter->GetType()) {
       case transform: {
-        CATransform3D transform = GetCATransform3DFromSkMatrix((*iter)->GetMatrix());
+        CATransform3D transform = GetCATransform3DFromSkMatrix(iter->GetMatrix());
         head.layer.transform = CATransform3DConcat(head.layer.transform, transform);
         break;
       }
@@ -379,16 +398,16 @@ void FlutterPlatformViewsController::ApplyMutators(const MutatorsStack& mutators
       case clip_path: {
         ChildClippingView* clipView = (ChildClippingView*)head.superview;
         clipView.layer.transform = CATransform3DIdentity;
-        [clipView setClip:(*iter)->GetType()
-                     rect:(*iter)->GetRect()
-                    rrect:(*iter)->GetRRect()
-                     path:(*iter)->GetPath()];
+        [clipView setClip:iter->GetType()
+                     rect:iter->GetRect()
+                    rrect:iter->GetRRect()
+                     path:iter->GetPath()];
         ResetAnchor(clipView.layer);
         head = clipView;
         break;
       }
       case opacity:
-        embedded_view.alpha = (*iter)->GetAlphaFloat() * embedded_view.alpha;
+        embedded_view.alpha = iter->GetAlphaFloat() * embedded_view.alpha;
         break;
     }
     ++iter;
@@ -468,6 +487,34 @@ SkRect FlutterPlatformViewsController::GetPlatformViewRect(int view_id) {
   );
 }
 
+// Fingerprints the Flutter content recorded above a platform view. Serialization walks the
+// picture's ops, which for the slice of UI above an embedded view is cheap next to another
+// round of rasterization and presentation. Returns 0 — reserved for "unknown" — only when
+// the picture cannot be serialized.
+static uint64_t ComputeOverlayContentSignature(const SkPicture& picture) {
+  sk_sp<SkData> data = picture.serialize();
+  if (!data) {
+    return 0;
+  }
+  // FNV-1a over the serialized bytes.
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const uint8_t* bytes = data->bytes();
+  for (size_t i = 0; i < data->size(); i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+// The overlay's pixels depend on where the rect samples the picture, not just on the picture
+// itself, so the rect is folded into the content signature.
+static uint64_t MixRectIntoSignature(uint64_t signature, const SkRect& rect) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&rect);
+  for (size_t i = 0; i < sizeof(rect); i++) {
+    signature = (signature ^ bytes[i]) * 0x100000001b3ull;
+  }
+  return signature == 0 ? 1 : signature;
+}
+
 bool FlutterPlatformViewsController::SubmitFrame(GrContext* gr_context,
                                                  std::shared_ptr<IOSContext> ios_context,
                                                  std::unique_ptr<SurfaceFrame> frame) {
@@ -505,6 +552,9 @@ bool FlutterPlatformViewsController::SubmitFrame(GrContext* gr_context,
     int64_t platform_view_id = composition_order_[i];
     sk_sp<RTree> rtree = platform_view_rtrees_[platform_view_id];
     sk_sp<SkPicture> picture = picture_recorders_[platform_view_id]->finishRecordingAsPicture();
+    // Fingerprint the picture once; every overlay cut out of it derives its own signature by
+    // folding in its rect.
+    uint64_t picture_signature = ComputeOverlayContentSignature(*picture);
 
     // Check if the current picture contains overlays that intersect with the
     // current platform view or any of the previous platform views.
@@ -552,7 +602,8 @@ bool FlutterPlatformViewsController::SubmitFrame(GrContext* gr_context,
                                                                    picture,                   //
                                                                    joined_rect,               //
                                                                    current_platform_view_id,  //
-                                                                   overlay_id                 //
+                                                                   overlay_id,                //
+                                                                   picture_signature          //
         );
         did_submit &= layer->did_submit_last_frame;
         platform_view_layers[current_platform_view_id].push_back(layer);
@@ -566,7 +617,9 @@ bool FlutterPlatformViewsController::SubmitFrame(GrContext* gr_context,
   RemoveUnusedLayers();
   // Organize the layers by their z indexes.
   BringLayersIntoView(platform_view_layers);
-  // Mark all layers as available, so they can be used in the next frame.
+  // Age the unused layers and tear down the ones idle past the grace period, then mark the
+  // rest as available for the next frame.
+  layer_pool_->CollectUnusedLayers();
   layer_pool_->RecycleLayers();
   // Reset the composition order, so next frame starts empty.
   composition_order_.clear();
@@ -616,7 +669,8 @@ std::shared_ptr<FlutterPlatformViewLayer> FlutterPlatformViewsController::GetLay
     sk_sp<SkPicture> picture,
     SkRect rect,
     int64_t view_id,
-    int64_t overlay_id) {
+    int64_t overlay_id,
+    uint64_t picture_signature) {
   std::shared_ptr<FlutterPlatformViewLayer> layer = layer_pool_->GetLayer(gr_context, ios_context);
 
   UIView* overlay_view_wrapper = layer->overlay_view_wrapper.get();
@@ -634,9 +688,21 @@ std::shared_ptr<FlutterPlatformViewLayer> FlutterPlatformViewsController::GetLay
   // This size is equal to the the device screen size.
   overlay_view.frame = flutter_view_.get().bounds;
 
+  uint64_t signature =
+      picture_signature == 0 ? 0 : MixRectIntoSignature(picture_signature, rect);
+  if (signature != 0 && signature == layer->content_signature &&
+      layer->did_submit_last_frame) {
+    // The layer's surface already holds exactly these pixels from the previous frame, and
+    // the overlay's CALayer retains its last presented contents. Scrolling a list of
+    // embedded views keeps the content above each view static most frames, so skipping the
+    // rasterization and presentation here is the common case.
+    return layer;
+  }
+
   std::unique_ptr<SurfaceFrame> frame = layer->surface->AcquireFrame(frame_size_);
   // If frame is null, AcquireFrame already printed out an error message.
   if (!frame) {
+    layer->content_signature = 0;
     return layer;
   }
   SkCanvas* overlay_canvas = frame->SkiaCanvas();
@@ -647,6 +713,8 @@ std::shared_ptr<FlutterPlatformViewLayer> FlutterPlatformViewsController::GetLay
   overlay_canvas->drawPicture(picture);
 
   layer->did_submit_last_frame = frame->Submit();
+  // Only a presented frame leaves the surface holding the fingerprinted pixels.
+  layer->content_signature = layer->did_submit_last_frame ? signature : 0;
   return layer;
 }
 
@@ -78,6 +78,16 @@ struct FlutterPlatformViewLayer {
   // We track this to know when the GrContext for the Flutter app has changed
   // so we can update the overlay with the new context.
   GrContext* gr_context;
+
+  // Fingerprint of the overlay content last rasterized into this layer's surface, or 0 if
+  // unknown. When the fingerprint of the current frame's content matches, the overlay's
+  // CALayer still holds the right pixels and rasterizing and presenting it again can be
+  // skipped.
+  uint64_t content_signature = 0;
+
+  // The number of consecutive frames this layer went unused. Maintained by
+  // FlutterPlatformViewLayerPool to implement deferred teardown.
+  int frames_unused = 0;
 };
 
 // This class isn't thread safe.
@@ -95,9 +105,19 @@ class FlutterPlatformViewLayerPool {
   // This method doesn't mark the layers as unused.
   std::vector<std::shared_ptr<FlutterPlatformViewLayer>> GetUnusedLayers();
 
+  // Ages the layers that weren't used this frame, and destroys the ones that went unused for
+  // more than `kTeardownGraceFrames` frames. Must be called before `RecycleLayers` while the
+  // used/unused partition of the pool is still valid.
+  void CollectUnusedLayers();
+
   // Marks the layers in the pool as available for reuse.
   void RecycleLayers();
 
+  // How many frames an unused layer stays in the pool before its views and surfaces are torn
+  // down. A platform view that leaves the frame during a scroll usually comes right back, so
+  // tearing the overlay down immediately would recreate its backing surface a frame later.
+  static constexpr int kTeardownGraceFrames = 3;
+
  private:
   // The index of the entry in the layers_ vector that determines the beginning of the unused
   // layers. For example, consider the following vector:
@@ -288,13 +308,16 @@ class FlutterPlatformViewsController {
   // Always resets to `false` right after the threads are merged.
   bool merge_threads_ = false;
   // Allocates a new FlutterPlatformViewLayer if needed, draws the pixels within the rect from
-  // the picture on the layer's canvas.
+  // the picture on the layer's canvas. `picture_signature` fingerprints the picture's content
+  // (0 if unknown); when the layer already holds the pixels for this picture and rect, the
+  // rasterization is skipped.
   std::shared_ptr<FlutterPlatformViewLayer> GetLayer(GrContext* gr_context,
                                                      std::shared_ptr<IOSContext> ios_context,
                                                      sk_sp<SkPicture> picture,
                                                      SkRect rect,
                                                      int64_t view_id,
-                                                     int64_t overlay_id);
+                                                     int64_t overlay_id,
+                                                     uint64_t picture_signature);
   // Removes overlay views and platform views that aren't needed in the current frame.
   // Must run on the platform thread.
   void RemoveUnusedLayers();
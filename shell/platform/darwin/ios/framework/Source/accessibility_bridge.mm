@@ -85,6 +85,12 @@ void AccessibilityBridge::UpdateSemantics(flutter::SemanticsNodeUpdates nodes,
   BOOL layoutChanged = NO;
   BOOL scrollOccured = NO;
   BOOL needsAnnouncement = NO;
+  // Whether any children array was patched this update. Nodes can only become
+  // unreachable (and the set of routes can only change shape) when this is set,
+  // which lets small updates skip the full-tree walks below.
+  BOOL childrenChanged = NO;
+  // Whether an updated node scopes a route in either its old or new state.
+  BOOL routesMayHaveChanged = NO;
   for (const auto& entry : actions) {
     const flutter::CustomAccessibilityAction& action = entry.second;
     actions_[action.id] = action;
@@ -95,6 +101,9 @@ void AccessibilityBridge::UpdateSemantics(flutter::SemanticsNodeUpdates nodes,
     layoutChanged = layoutChanged || [object nodeWillCauseLayoutChange:&node];
     scrollOccured = scrollOccured || [object nodeWillCauseScroll:&node];
     needsAnnouncement = [object nodeShouldTriggerAnnouncement:&node];
+    routesMayHaveChanged = routesMayHaveChanged ||
+                           node.HasFlag(flutter::SemanticsFlags::kScopesRoute) ||
+                           object.node.HasFlag(flutter::SemanticsFlags::kScopesRoute);
     [object setSemanticsNode:&node];
     NSUInteger newChildCount = node.childrenInTraversalOrder.size();
     NSMutableArray* newChildren =
@@ -103,7 +112,10 @@ void AccessibilityBridge::UpdateSemantics(flutter::SemanticsNodeUpdates nodes,
       SemanticsObject* child = GetOrCreateObject(node.childrenInTraversalOrder[i], nodes);
       [newChildren addObject:child];
     }
-    object.children = newChildren;
+    if (![newChildren isEqualToArray:object.children]) {
+      object.children = newChildren;
+      childrenChanged = YES;
+    }
     if (node.customAccessibilityActions.size() > 0) {
       NSMutableArray<FlutterCustomAccessibilityAction*>* accessibilityCustomActions =
           [[[NSMutableArray alloc] init] autorelease];
@@ -166,36 +178,43 @@ void AccessibilityBridge::UpdateSemantics(flutter::SemanticsNodeUpdates nodes,
     if (!view_.accessibilityElements) {
       view_.accessibilityElements = @[ [root accessibilityContainer] ];
     }
-    NSMutableArray<SemanticsObject*>* newRoutes = [[[NSMutableArray alloc] init] autorelease];
-    [root collectRoutes:newRoutes];
-    for (SemanticsObject* route in newRoutes) {
-      if (std::find(previous_routes_.begin(), previous_routes_.end(), [route uid]) !=
-          previous_routes_.end()) {
-        lastAdded = route;
+    // Only re-collect routes when the tree shape changed or an updated node
+    // scoped a route; otherwise the set of routes is unchanged.
+    if (childrenChanged || routesMayHaveChanged) {
+      NSMutableArray<SemanticsObject*>* newRoutes = [[[NSMutableArray alloc] init] autorelease];
+      [root collectRoutes:newRoutes];
+      for (SemanticsObject* route in newRoutes) {
+        if (std::find(previous_routes_.begin(), previous_routes_.end(), [route uid]) !=
+            previous_routes_.end()) {
+          lastAdded = route;
+        }
+      }
+      if (lastAdded == nil && [newRoutes count] > 0) {
+        int index = [newRoutes count] - 1;
+        lastAdded = [newRoutes objectAtIndex:index];
+      }
+      if (lastAdded != nil && [lastAdded uid] != previous_route_id_) {
+        previous_route_id_ = [lastAdded uid];
+        routeChanged = true;
+      }
+      previous_routes_.clear();
+      for (SemanticsObject* route in newRoutes) {
+        previous_routes_.push_back([route uid]);
       }
-    }
-    if (lastAdded == nil && [newRoutes count] > 0) {
-      int index = [newRoutes count] - 1;
-      lastAdded = [newRoutes objectAtIndex:index];
-    }
-    if (lastAdded != nil && [lastAdded uid] != previous_route_id_) {
-      previous_route_id_ = [lastAdded uid];
-      routeChanged = true;
-    }
-    previous_routes_.clear();
-    for (SemanticsObject* route in newRoutes) {
-      previous_routes_.push_back([route uid]);
     }
   } else {
     view_.accessibilityElements = nil;
   }
 
-  NSMutableArray<NSNumber*>* doomed_uids = [NSMutableArray arrayWithArray:[objects_.get() allKeys]];
-  if (root)
-    VisitObjectsRecursivelyAndRemove(root, doomed_uids);
-  [objects_ removeObjectsForKeys:doomed_uids];
+  if (childrenChanged || (!root && [objects_.get() count] > 0)) {
+    NSMutableArray<NSNumber*>* doomed_uids =
+        [NSMutableArray arrayWithArray:[objects_.get() allKeys]];
+    if (root)
+      VisitObjectsRecursivelyAndRemove(root, doomed_uids);
+    [objects_ removeObjectsForKeys:doomed_uids];
 
-  layoutChanged = layoutChanged || [doomed_uids count] > 0;
+    layoutChanged = layoutChanged || [doomed_uids count] > 0;
+  }
   if (routeChanged) {
     if (!ios_delegate_->IsFlutterViewControllerPresentingModalViewController(view_)) {
       NSString* routeName = [lastAdded routeName];
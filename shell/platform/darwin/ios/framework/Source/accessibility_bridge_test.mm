@@ -203,6 +203,59 @@ fml::RefPtr<fml::TaskRunner> CreateNewThread(std::string name) {
   OCMVerifyAll(mockFlutterView);
 }
 
+- (void)testLabelOnlyUpdateKeepsChildrenArray {
+  flutter::MockDelegate mock_delegate;
+  auto thread_task_runner = CreateNewThread("AccessibilityBridgeTest");
+  flutter::TaskRunners runners(/*label=*/self.name.UTF8String,
+                               /*platform=*/thread_task_runner,
+                               /*raster=*/thread_task_runner,
+                               /*ui=*/thread_task_runner,
+                               /*io=*/thread_task_runner);
+  auto platform_view = std::make_unique<flutter::PlatformViewIOS>(
+      /*delegate=*/mock_delegate,
+      /*rendering_api=*/flutter::IOSRenderingAPI::kSoftware,
+      /*task_runners=*/runners);
+  id mockFlutterView = OCMClassMock([FlutterView class]);
+
+  __block SemanticsObject* rootObject = nil;
+  OCMStub([mockFlutterView setAccessibilityElements:[OCMArg checkWithBlock:^BOOL(NSArray* value) {
+                             SemanticsObjectContainer* container = value[0];
+                             rootObject = container.semanticsObject;
+                             return YES;
+                           }]]);
+
+  __block auto bridge =
+      std::make_unique<flutter::AccessibilityBridge>(/*view=*/mockFlutterView,
+                                                     /*platform_view=*/platform_view.get(),
+                                                     /*platform_views_controller=*/nil);
+
+  flutter::CustomAccessibilityActionUpdates actions;
+  flutter::SemanticsNodeUpdates nodes;
+  flutter::SemanticsNode child_node;
+  child_node.id = 1;
+  child_node.label = "child";
+  nodes[child_node.id] = child_node;
+  flutter::SemanticsNode root_node;
+  root_node.id = kRootNodeId;
+  root_node.label = "root";
+  root_node.childrenInTraversalOrder = {1};
+  root_node.childrenInHitTestOrder = {1};
+  nodes[root_node.id] = root_node;
+  bridge->UpdateSemantics(/*nodes=*/nodes, /*actions=*/actions);
+
+  NSArray<SemanticsObject*>* children = [rootObject children];
+  XCTAssertEqual([children count], 1ul);
+
+  // An update that does not touch the root's children must patch the existing
+  // children array rather than rebuilding it.
+  flutter::SemanticsNodeUpdates label_update;
+  root_node.label = "renamed root";
+  label_update[root_node.id] = root_node;
+  bridge->UpdateSemantics(/*nodes=*/label_update, /*actions=*/actions);
+
+  XCTAssertEqual([rootObject children], children);
+}
+
 - (void)testSemanticsDeallocated {
   @autoreleasepool {
     flutter::MockDelegate mock_delegate;
@@ -20,6 +20,9 @@ class VsyncWaiterIOS final : public VsyncWaiter {
 
   ~VsyncWaiterIOS() override;
 
+  // |VsyncWaiter|
+  bool SetDesiredFrameInterval(fml::TimeDelta interval) override;
+
  private:
   fml::scoped_nsobject<VSyncClient> client_;
 
@@ -35,6 +35,18 @@
 ///
 - (float)displayRefreshRate;
 
+//------------------------------------------------------------------------------
+/// @brief      Asks the display link for the given rate. Variable refresh rate displays
+///             (ProMotion) grant a rate no higher than the panel maximum and pace callbacks at
+///             the granted rate, so the engine does not have to skip vsyncs in software. The
+///             granted rate is what |displayRefreshRate| reports afterwards.
+///
+/// @param[in]  framesPerSecond  The desired callback rate. Zero restores the display maximum.
+///
+/// @return     Whether the underlying display link supports rate negotiation.
+///
+- (BOOL)setDesiredFrameRate:(NSInteger)framesPerSecond;
+
 @end
 
 namespace flutter {
@@ -62,6 +74,16 @@ float VsyncWaiterIOS::GetDisplayRefreshRate() const {
   return [client_.get() displayRefreshRate];
 }
 
+// |VsyncWaiter|
+bool VsyncWaiterIOS::SetDesiredFrameInterval(fml::TimeDelta interval) {
+  if (interval.ToMicroseconds() <= 0) {
+    return false;
+  }
+  const NSInteger frames_per_second =
+      static_cast<NSInteger>(1000000.0 / interval.ToMicroseconds() + 0.5);
+  return [client_.get() setDesiredFrameRate:frames_per_second] == YES;
+}
+
 }  // namespace flutter
 
 @implementation VSyncClient {
@@ -113,6 +135,23 @@ float VsyncWaiterIOS::GetDisplayRefreshRate() const {
   display_link_.get().paused = NO;
 }
 
+- (BOOL)setDesiredFrameRate:(NSInteger)framesPerSecond {
+  if (@available(iOS 10.0, *)) {
+    NSInteger granted = framesPerSecond;
+    if (@available(iOS 10.3, *)) {
+      NSInteger maximum = [UIScreen mainScreen].maximumFramesPerSecond;
+      if (granted >= maximum) {
+        // Zero means "the display maximum", which keeps working if the link
+        // migrates to a faster screen.
+        granted = 0;
+      }
+    }
+    display_link_.get().preferredFramesPerSecond = granted;
+    return YES;
+  }
+  return NO;
+}
+
 - (void)onDisplayLink:(CADisplayLink*)link {
   TRACE_EVENT0("flutter", "VSYNC");
 
@@ -51,6 +51,18 @@ IOSContextMetal::IOSContextMetal() {
 
   resource_context_->setResourceCacheLimits(0u, 0u);
 
+  // Replay the shaders persisted by previous runs (the cache directory is keyed by engine and
+  // driver version) so that Metal pipeline compilation happens here at startup instead of the
+  // first time each shader is drawn with.
+  std::vector<PersistentCache::SkSLCache> caches =
+      PersistentCache::GetCacheForProcess()->LoadSkSLs();
+  int compiled_count = 0;
+  for (const auto& cache : caches) {
+    compiled_count += main_context_->precompileShader(*cache.first, *cache.second);
+  }
+  FML_DLOG(INFO) << "Found " << caches.size() << " cached shaders for the Metal context; "
+                 << "precompiled " << compiled_count;
+
   CVMetalTextureCacheRef texture_cache_raw = NULL;
   auto cv_return = CVMetalTextureCacheCreate(kCFAllocatorDefault,  // allocator
                                              NULL,           // cache attributes (NULL default)
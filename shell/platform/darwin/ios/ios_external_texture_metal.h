@@ -6,6 +6,7 @@
 #define FLUTTER_SHELL_PLATFORM_DARWIN_IOS_IOS_EXTERNAL_TEXTURE_METAL_H_
 
 #include <atomic>
+#include <vector>
 
 #import <CoreVideo/CoreVideo.h>
 
@@ -28,11 +29,28 @@ class IOSExternalTextureMetal final : public Texture {
   ~IOSExternalTextureMetal();
 
  private:
+  // An image wrapping a pixel buffer recently vended by the embedder. Camera
+  // pipelines recycle frames from a small ring of pixel buffers, so keeping
+  // the wrappers for the last few buffers alive turns the per-frame Metal
+  // texture creation into a pool lookup. Contents of a reused buffer change
+  // underneath the wrapper, which is the zero-copy behavior we want.
+  struct PooledImage {
+    fml::CFRef<CVPixelBufferRef> buffer;
+    sk_sp<SkImage> image;
+    uint64_t last_use = 0;
+  };
+
+  // Matches the triple buffering used by AVFoundation capture pipelines.
+  static constexpr size_t kImagePoolSize = 3u;
+
   fml::CFRef<CVMetalTextureCacheRef> texture_cache_;
   fml::scoped_nsobject<NSObject<FlutterTexture>> external_texture_;
   std::atomic_bool texture_frame_available_;
   fml::CFRef<CVPixelBufferRef> last_pixel_buffer_;
   sk_sp<SkImage> external_image_;
+  std::vector<PooledImage> image_pool_;
+  uint64_t image_pool_use_counter_ = 0;
+  SkISize last_frame_size_ = SkISize::MakeEmpty();
 
   // |Texture|
   void Paint(SkCanvas& canvas, const SkRect& bounds, bool freeze, GrContext* context) override;
@@ -52,6 +70,11 @@ class IOSExternalTextureMetal final : public Texture {
   sk_sp<SkImage> WrapExternalPixelBuffer(fml::CFRef<CVPixelBufferRef> pixel_buffer,
                                          GrContext* context) const;
 
+  // Returns the pooled image for |pixel_buffer|, wrapping it (and pooling the
+  // wrapper) on a miss. Returns nullptr if wrapping failed.
+  sk_sp<SkImage> GetOrWrapPixelBuffer(const fml::CFRef<CVPixelBufferRef>& pixel_buffer,
+                                      GrContext* context);
+
   FML_DISALLOW_COPY_AND_ASSIGN(IOSExternalTextureMetal);
 };
 
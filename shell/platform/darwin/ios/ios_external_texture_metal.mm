@@ -32,16 +32,20 @@ void IOSExternalTextureMetal::Paint(SkCanvas& canvas,
   if (needs_updated_texture) {
     auto pixel_buffer = fml::CFRef<CVPixelBufferRef>([external_texture_ copyPixelBuffer]);
     if (!pixel_buffer) {
-      pixel_buffer = std::move(last_pixel_buffer_);
+      pixel_buffer = last_pixel_buffer_;
     }
 
-    // If the application told us there was a texture frame available but did not provide one when
-    // asked for it, reuse the previous texture but make sure to ask again the next time around.
-    if (auto wrapped_texture = WrapExternalPixelBuffer(pixel_buffer, context)) {
+    if (pixel_buffer && pixel_buffer == last_pixel_buffer_ && external_image_) {
+      // The embedder vended the frame that is already wrapped and on screen; keep the current
+      // image and skip the texture cache round trip.
+      texture_frame_available_ = false;
+    } else if (auto wrapped_texture = GetOrWrapPixelBuffer(pixel_buffer, context)) {
       external_image_ = wrapped_texture;
       texture_frame_available_ = false;
       last_pixel_buffer_ = std::move(pixel_buffer);
     }
+    // Otherwise the application told us there was a texture frame available but did not provide
+    // one when asked for it; reuse the previous texture but ask again the next time around.
   }
 
   if (external_image_) {
@@ -54,6 +58,53 @@ void IOSExternalTextureMetal::Paint(SkCanvas& canvas,
   }
 }
 
+sk_sp<SkImage> IOSExternalTextureMetal::GetOrWrapPixelBuffer(
+    const fml::CFRef<CVPixelBufferRef>& pixel_buffer,
+    GrContext* context) {
+  if (!pixel_buffer) {
+    return nullptr;
+  }
+
+  image_pool_use_counter_++;
+  for (auto& pooled : image_pool_) {
+    if (pooled.buffer == pixel_buffer) {
+      pooled.last_use = image_pool_use_counter_;
+      return pooled.image;
+    }
+  }
+
+  auto image = WrapExternalPixelBuffer(pixel_buffer, context);
+  if (!image) {
+    return nullptr;
+  }
+
+  const auto frame_size = SkISize::Make(CVPixelBufferGetWidth(pixel_buffer),  //
+                                        CVPixelBufferGetHeight(pixel_buffer));
+  if (frame_size != last_frame_size_) {
+    // The source switched buffer pools (e.g. a camera format change); wrappers for the old pool
+    // will never be reused, so drop them and let the texture cache release their backing.
+    image_pool_.clear();
+    CVMetalTextureCacheFlush(texture_cache_, 0);
+    last_frame_size_ = frame_size;
+  }
+
+  if (image_pool_.size() >= kImagePoolSize) {
+    // The source is churning through more buffers than the pool covers. Evict the least recently
+    // used wrapper and flush so the evicted entry does not pin its Metal texture in the cache.
+    auto oldest = image_pool_.begin();
+    for (auto it = image_pool_.begin(); it != image_pool_.end(); ++it) {
+      if (it->last_use < oldest->last_use) {
+        oldest = it;
+      }
+    }
+    image_pool_.erase(oldest);
+    CVMetalTextureCacheFlush(texture_cache_, 0);
+  }
+
+  image_pool_.push_back({pixel_buffer, image, image_pool_use_counter_});
+  return image;
+}
+
 sk_sp<SkImage> IOSExternalTextureMetal::WrapExternalPixelBuffer(
     fml::CFRef<CVPixelBufferRef> pixel_buffer,
     GrContext* context) const {
@@ -138,6 +189,7 @@ void IOSExternalTextureMetal::OnGrContextDestroyed() {
   // buffer will be used to materialize the image in case the application fails to provide a new
   // one.
   external_image_.reset();
+  image_pool_.clear();
   CVMetalTextureCacheFlush(texture_cache_,  // cache
                            0                // options (must be zero)
   );
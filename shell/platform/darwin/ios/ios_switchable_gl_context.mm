@@ -14,11 +14,20 @@ bool IOSSwitchableGLContext::SetCurrent() {
   FML_DCHECK(context_ != nullptr);
   EAGLContext* current_context = EAGLContext.currentContext;
   previous_context_ = current_context;
+  if (current_context == context_) {
+    // The context is already current on this thread. This is the common case
+    // within a |GLContextBatchScope|, where intermediate restorations are
+    // deferred; a real setCurrentContext is not free even when redundant.
+    return true;
+  }
   return [EAGLContext setCurrentContext:context_];
 };
 
 bool IOSSwitchableGLContext::RemoveCurrent() {
   FML_DCHECK_CREATION_THREAD_IS_CURRENT(checker);
+  if (EAGLContext.currentContext == previous_context_) {
+    return true;
+  }
   return [EAGLContext setCurrentContext:previous_context_];
 };
 }
@@ -9,14 +9,27 @@
 
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterDartProject_Internal.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterExternalTextureGL.h"
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterRenderingBackend.h"
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterView.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterViewController_Internal.h"
 #import "flutter/shell/platform/embedder/embedder.h"
 
+#if FLUTTER_SHELL_ENABLE_METAL
+#import <Metal/Metal.h>
+#import <QuartzCore/CAMetalLayer.h>
+#endif  // FLUTTER_SHELL_ENABLE_METAL
+
 /**
  * Private interface declaration for FlutterEngine.
  */
 @interface FlutterEngine () <FlutterBinaryMessenger>
 
+/**
+ * Builds the renderer config handed to the embedder API, selecting Metal when the engine supports
+ * it and a Metal-backed view is attached, and OpenGL otherwise.
+ */
+- (FlutterRendererConfig)createRendererConfig;
+
 /**
  * Called by the engine to make the context the engine should draw into current.
  */
@@ -163,6 +176,13 @@ static bool OnAcquireExternalTexture(FlutterEngine* engine,
 
   // A mapping of textureID to internal FlutterExternalTextureGL adapter.
   NSMutableDictionary<NSNumber*, FlutterExternalTextureGL*>* _textures;
+
+#if FLUTTER_SHELL_ENABLE_METAL
+  // The device and command queue handed to the engine when rendering through Metal. Owned here so
+  // they outlive the engine run.
+  id<MTLDevice> _metalDevice;
+  id<MTLCommandQueue> _metalCommandQueue;
+#endif  // FLUTTER_SHELL_ENABLE_METAL
 }
 
 - (instancetype)initWithName:(NSString*)labelPrefix project:(FlutterDartProject*)project {
@@ -197,16 +217,7 @@ static bool OnAcquireExternalTexture(FlutterEngine* engine,
     return NO;
   }
 
-  const FlutterRendererConfig rendererConfig = {
-      .type = kOpenGL,
-      .open_gl.struct_size = sizeof(FlutterOpenGLRendererConfig),
-      .open_gl.make_current = (BoolCallback)OnMakeCurrent,
-      .open_gl.clear_current = (BoolCallback)OnClearCurrent,
-      .open_gl.present = (BoolCallback)OnPresent,
-      .open_gl.fbo_callback = (UIntCallback)OnFBO,
-      .open_gl.make_resource_current = (BoolCallback)OnMakeResourceCurrent,
-      .open_gl.gl_external_texture_frame_callback = (TextureFrameCallback)OnAcquireExternalTexture,
-  };
+  const FlutterRendererConfig rendererConfig = [self createRendererConfig];
 
   // TODO(stuartmorgan): Move internal channel registration from FlutterViewController to here.
 
@@ -273,6 +284,40 @@ static bool OnAcquireExternalTexture(FlutterEngine* engine,
   return self;
 }
 
+- (FlutterRendererConfig)createRendererConfig {
+#if FLUTTER_SHELL_ENABLE_METAL
+  CAMetalLayer* metalLayer = _viewController.flutterView.metalLayer;
+  if (flutter::GetRenderingAPIForProcess() == flutter::MacOSRenderingAPI::kMetal &&
+      metalLayer != nil) {
+    _metalDevice = MTLCreateSystemDefaultDevice();
+    _metalCommandQueue = [_metalDevice newCommandQueue];
+    metalLayer.device = _metalDevice;
+    const FlutterRendererConfig rendererConfig = {
+        .type = kMetal,
+        .metal.struct_size = sizeof(FlutterMetalRendererConfig),
+        .metal.device = (__bridge FlutterMetalDeviceHandle)_metalDevice,
+        .metal.present_command_queue = (__bridge FlutterMetalCommandQueueHandle)_metalCommandQueue,
+        .metal.layer = (__bridge FlutterMetalLayerHandle)metalLayer,
+    };
+    return rendererConfig;
+  }
+  // Headless engines have no layer to render into; fall through to OpenGL, whose contexts are
+  // created lazily on first use.
+#endif  // FLUTTER_SHELL_ENABLE_METAL
+
+  const FlutterRendererConfig rendererConfig = {
+      .type = kOpenGL,
+      .open_gl.struct_size = sizeof(FlutterOpenGLRendererConfig),
+      .open_gl.make_current = (BoolCallback)OnMakeCurrent,
+      .open_gl.clear_current = (BoolCallback)OnClearCurrent,
+      .open_gl.present = (BoolCallback)OnPresent,
+      .open_gl.fbo_callback = (UIntCallback)OnFBO,
+      .open_gl.make_resource_current = (BoolCallback)OnMakeResourceCurrent,
+      .open_gl.gl_external_texture_frame_callback = (TextureFrameCallback)OnAcquireExternalTexture,
+  };
+  return rendererConfig;
+}
+
 #pragma mark - Framework-internal methods
 
 - (BOOL)running {
@@ -0,0 +1,26 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_DARWIN_MACOS_FRAMEWORK_SOURCE_FLUTTERRENDERINGBACKEND_H_
+#define FLUTTER_SHELL_PLATFORM_DARWIN_MACOS_FRAMEWORK_SOURCE_FLUTTERRENDERINGBACKEND_H_
+
+namespace flutter {
+
+enum class MacOSRenderingAPI {
+  kOpenGL,
+  kMetal,
+};
+
+/**
+ * Returns the rendering API the macOS embedder should use for this process.
+ *
+ * Metal is selected when the engine was built with Metal support and the host
+ * exposes a usable system Metal device; otherwise rendering falls back to
+ * OpenGL. The answer does not change for the lifetime of the process.
+ */
+MacOSRenderingAPI GetRenderingAPIForProcess();
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_DARWIN_MACOS_FRAMEWORK_SOURCE_FLUTTERRENDERINGBACKEND_H_
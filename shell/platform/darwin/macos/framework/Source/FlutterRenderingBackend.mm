@@ -0,0 +1,36 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterRenderingBackend.h"
+
+#import <Foundation/Foundation.h>
+#if FLUTTER_SHELL_ENABLE_METAL
+#import <Metal/Metal.h>
+#endif  // FLUTTER_SHELL_ENABLE_METAL
+
+namespace flutter {
+
+#if FLUTTER_SHELL_ENABLE_METAL
+static bool ShouldUseMetalRenderer() {
+  // The macOS version floor was selected due to the availability of features used by Skia's Metal
+  // backend. CAMetalLayer itself is available earlier, but drives deprecated code paths.
+  bool supports_metal = false;
+  if (@available(macOS 10.14, *)) {
+    supports_metal = MTLCreateSystemDefaultDevice() != nil;
+  }
+  return supports_metal;
+}
+#endif  // FLUTTER_SHELL_ENABLE_METAL
+
+MacOSRenderingAPI GetRenderingAPIForProcess() {
+#if FLUTTER_SHELL_ENABLE_METAL
+  static bool should_use_metal = ShouldUseMetalRenderer();
+  if (should_use_metal) {
+    return MacOSRenderingAPI::kMetal;
+  }
+#endif  // FLUTTER_SHELL_ENABLE_METAL
+  return MacOSRenderingAPI::kOpenGL;
+}
+
+}  // namespace flutter
@@ -4,6 +4,8 @@
 
 #import <Cocoa/Cocoa.h>
 
+@class CAMetalLayer;
+
 /**
  * Listener for view resizing.
  */
@@ -29,6 +31,22 @@
                               reshapeListener:
                                   (nonnull id<FlutterViewReshapeListener>)reshapeListener;
 
+/**
+ * Creates a Metal-backed view. The view is layer hosted with a CAMetalLayer the engine acquires
+ * drawables from; no OpenGL context is created.
+ */
+- (nullable instancetype)initWithFrame:(NSRect)frame
+                       reshapeListener:(nonnull id<FlutterViewReshapeListener>)reshapeListener;
+
+- (nullable instancetype)initWithReshapeListener:
+    (nonnull id<FlutterViewReshapeListener>)reshapeListener;
+
+/**
+ * The layer the engine renders into when the view is Metal backed, nil when the view renders
+ * through OpenGL.
+ */
+@property(nonatomic, readonly, nullable) CAMetalLayer* metalLayer;
+
 - (nullable instancetype)initWithFrame:(NSRect)frameRect
                            pixelFormat:(nullable NSOpenGLPixelFormat*)format NS_UNAVAILABLE;
 - (nonnull instancetype)initWithFrame:(NSRect)frameRect NS_UNAVAILABLE;
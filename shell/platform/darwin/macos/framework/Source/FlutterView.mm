@@ -4,8 +4,14 @@
 
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterView.h"
 
+#import <QuartzCore/CAMetalLayer.h>
+
 @implementation FlutterView {
   __weak id<FlutterViewReshapeListener> _reshapeListener;
+
+  // Whether the view hosts a CAMetalLayer instead of rendering through the NSOpenGLView
+  // machinery. Set before wantsLayer so makeBackingLayer picks the right layer class.
+  BOOL _metalBacked;
 }
 
 - (instancetype)initWithShareContext:(NSOpenGLContext*)shareContext
@@ -26,8 +32,51 @@
   return self;
 }
 
+- (instancetype)initWithReshapeListener:(id<FlutterViewReshapeListener>)reshapeListener {
+  return [self initWithFrame:NSZeroRect reshapeListener:reshapeListener];
+}
+
+- (instancetype)initWithFrame:(NSRect)frame
+              reshapeListener:(id<FlutterViewReshapeListener>)reshapeListener {
+  self = [super initWithFrame:frame];
+  if (self) {
+    _reshapeListener = reshapeListener;
+    _metalBacked = YES;
+    self.wantsLayer = YES;
+  }
+  return self;
+}
+
+- (CAMetalLayer*)metalLayer {
+  if (!_metalBacked) {
+    return nil;
+  }
+  return static_cast<CAMetalLayer*>(self.layer);
+}
+
 #pragma mark - NSView overrides
 
+- (CALayer*)makeBackingLayer {
+  if (_metalBacked) {
+    CAMetalLayer* layer = [CAMetalLayer layer];
+    if (@available(macOS 10.13, *)) {
+      // Throttles drawable presents to the display refresh, giving vsync pacing without a
+      // CVDisplayLink.
+      layer.displaySyncEnabled = YES;
+    }
+    return layer;
+  }
+  return [super makeBackingLayer];
+}
+
+- (void)setFrameSize:(NSSize)newSize {
+  [super setFrameSize:newSize];
+  if (_metalBacked) {
+    // Layer hosted views do not go through the NSOpenGLView reshape machinery.
+    [_reshapeListener viewDidReshape:self];
+  }
+}
+
 /**
  * Declares that the view uses a flipped coordinate system, consistent with Flutter conventions.
  */
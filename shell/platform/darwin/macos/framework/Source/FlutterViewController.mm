@@ -10,6 +10,7 @@
 #import "flutter/shell/platform/darwin/macos/framework/Headers/FlutterEngine.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterEngine_Internal.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterMouseCursorPlugin.h"
+#import "flutter/shell/platform/darwin/macos/framework/Source/FlutterRenderingBackend.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterTextInputPlugin.h"
 #import "flutter/shell/platform/darwin/macos/framework/Source/FlutterView.h"
 #import "flutter/shell/platform/embedder/embedder.h"
@@ -228,13 +229,17 @@ static void CommonInit(FlutterViewController* controller) {
 }
 
 - (void)loadView {
-  NSOpenGLContext* resourceContext = _engine.resourceContext;
-  if (!resourceContext) {
-    NSLog(@"Unable to create FlutterView; no resource context available.");
-    return;
+  FlutterView* flutterView;
+  if (flutter::GetRenderingAPIForProcess() == flutter::MacOSRenderingAPI::kMetal) {
+    flutterView = [[FlutterView alloc] initWithReshapeListener:self];
+  } else {
+    NSOpenGLContext* resourceContext = _engine.resourceContext;
+    if (!resourceContext) {
+      NSLog(@"Unable to create FlutterView; no resource context available.");
+      return;
+    }
+    flutterView = [[FlutterView alloc] initWithShareContext:resourceContext reshapeListener:self];
   }
-  FlutterView* flutterView = [[FlutterView alloc] initWithShareContext:resourceContext
-                                                       reshapeListener:self];
   self.view = flutterView;
 }
 
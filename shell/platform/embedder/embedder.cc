@@ -6,6 +6,9 @@
 #define RAPIDJSON_HAS_STDSTRING 1
 
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
 
 #include "flutter/fml/build_config.h"
 #include "flutter/fml/closure.h"
@@ -111,6 +114,24 @@ static bool IsSoftwareRendererConfigValid(const FlutterRendererConfig* config) {
   return true;
 }
 
+#ifdef FLUTTER_SHELL_ENABLE_METAL
+static bool IsMetalRendererConfigValid(const FlutterRendererConfig* config) {
+  if (config->type != kMetal) {
+    return false;
+  }
+
+  const FlutterMetalRendererConfig* metal_config = &config->metal;
+
+  if (SAFE_ACCESS(metal_config, device, nullptr) == nullptr ||
+      SAFE_ACCESS(metal_config, present_command_queue, nullptr) == nullptr ||
+      SAFE_ACCESS(metal_config, layer, nullptr) == nullptr) {
+    return false;
+  }
+
+  return true;
+}
+#endif  // FLUTTER_SHELL_ENABLE_METAL
+
 static bool IsRendererValid(const FlutterRendererConfig* config) {
   if (config == nullptr) {
     return false;
@@ -121,6 +142,10 @@ static bool IsRendererValid(const FlutterRendererConfig* config) {
       return IsOpenGLRendererConfigValid(config);
     case kSoftware:
       return IsSoftwareRendererConfigValid(config);
+#ifdef FLUTTER_SHELL_ENABLE_METAL
+    case kMetal:
+      return IsMetalRendererConfigValid(config);
+#endif
     default:
       return false;
   }
@@ -212,6 +237,26 @@ InferOpenGLPlatformViewCreationCallback(
 #endif
   }
 
+  std::function<uint32_t(void)> gl_buffer_age_callback = nullptr;
+  if (SAFE_ACCESS(open_gl_config, buffer_age_callback, nullptr) != nullptr) {
+    gl_buffer_age_callback = [ptr = config->open_gl.buffer_age_callback,
+                              user_data]() { return ptr(user_data); };
+  }
+
+  std::function<bool(const SkIRect&)> gl_present_with_damage_callback = nullptr;
+  if (SAFE_ACCESS(open_gl_config, present_with_damage, nullptr) != nullptr) {
+    gl_present_with_damage_callback =
+        [ptr = config->open_gl.present_with_damage,
+         user_data](const SkIRect& damage) {
+          FlutterRect rect;
+          rect.left = damage.left();
+          rect.top = damage.top();
+          rect.right = damage.right();
+          rect.bottom = damage.bottom();
+          return ptr(user_data, &rect);
+        };
+  }
+
   bool fbo_reset_after_present =
       SAFE_ACCESS(open_gl_config, fbo_reset_after_present, false);
 
@@ -223,6 +268,8 @@ InferOpenGLPlatformViewCreationCallback(
       gl_make_resource_current_callback,   // gl_make_resource_current_callback
       gl_surface_transformation_callback,  // gl_surface_transformation_callback
       gl_proc_resolver,                    // gl_proc_resolver
+      gl_buffer_age_callback,              // gl_buffer_age_callback
+      gl_present_with_damage_callback,  // gl_present_with_damage_callback
   };
 
   return fml::MakeCopyable(
@@ -258,9 +305,12 @@ InferSoftwarePlatformViewCreationCallback(
     return ptr(user_data, allocation, row_bytes, height);
   };
 
+  const FlutterSoftwareRendererConfig* software_config = &config->software;
   flutter::EmbedderSurfaceSoftware::SoftwareDispatchTable
       software_dispatch_table = {
           software_present_backing_store,  // required
+          SAFE_ACCESS(software_config, pixel_format,
+                      kFlutterSoftwarePixelFormatNative32),  // pixel_format
       };
 
   return fml::MakeCopyable(
@@ -277,6 +327,40 @@ InferSoftwarePlatformViewCreationCallback(
       });
 }
 
+#ifdef FLUTTER_SHELL_ENABLE_METAL
+static flutter::Shell::CreateCallback<flutter::PlatformView>
+InferMetalPlatformViewCreationCallback(
+    const FlutterRendererConfig* config,
+    void* user_data,
+    flutter::PlatformViewEmbedder::PlatformDispatchTable
+        platform_dispatch_table,
+    std::unique_ptr<flutter::EmbedderExternalViewEmbedder>
+        external_view_embedder) {
+  if (config->type != kMetal) {
+    return nullptr;
+  }
+
+  flutter::EmbedderSurfaceMetal::MetalDispatchTable metal_dispatch_table = {
+      config->metal.device,                 // device
+      config->metal.present_command_queue,  // present command queue
+      config->metal.layer,                  // layer
+  };
+
+  return fml::MakeCopyable(
+      [metal_dispatch_table, platform_dispatch_table,
+       external_view_embedder =
+           std::move(external_view_embedder)](flutter::Shell& shell) mutable {
+        return std::make_unique<flutter::PlatformViewEmbedder>(
+            shell,                             // delegate
+            shell.GetTaskRunners(),            // task runners
+            metal_dispatch_table,              // embedder Metal dispatch table
+            platform_dispatch_table,           // platform dispatch table
+            std::move(external_view_embedder)  // external view embedder
+        );
+      });
+}
+#endif  // FLUTTER_SHELL_ENABLE_METAL
+
 static flutter::Shell::CreateCallback<flutter::PlatformView>
 InferPlatformViewCreationCallback(
     const FlutterRendererConfig* config,
@@ -298,6 +382,12 @@ InferPlatformViewCreationCallback(
       return InferSoftwarePlatformViewCreationCallback(
           config, user_data, platform_dispatch_table,
           std::move(external_view_embedder));
+#ifdef FLUTTER_SHELL_ENABLE_METAL
+    case kMetal:
+      return InferMetalPlatformViewCreationCallback(
+          config, user_data, platform_dispatch_table,
+          std::move(external_view_embedder));
+#endif
     default:
       return nullptr;
   }
@@ -551,8 +641,22 @@ struct _FlutterEngineAOTData {
   const uint8_t* vm_snapshot_instrs = nullptr;
   const uint8_t* vm_isolate_data = nullptr;
   const uint8_t* vm_isolate_instrs = nullptr;
+  // Dedup key into the registry below, and the number of outstanding
+  // FlutterEngineCreateAOTData calls that returned this instance. Guarded by
+  // the registry mutex.
+  std::string elf_path;
+  size_t ref_count = 1;
 };
 
+// Loading an ELF snapshot maps and relocates tens of megabytes, so repeated
+// FlutterEngineCreateAOTData calls for the same library (one per window in
+// multi-engine embedders) hand out the same refcounted instance instead.
+static std::mutex g_aot_data_registry_mutex;
+static std::map<std::string, _FlutterEngineAOTData*>& GetAOTDataRegistry() {
+  static auto* registry = new std::map<std::string, _FlutterEngineAOTData*>();
+  return *registry;
+}
+
 FlutterEngineResult FlutterEngineCreateAOTData(
     const FlutterEngineAOTDataSource* source,
     FlutterEngineAOTData* data_out) {
@@ -572,6 +676,15 @@ FlutterEngineResult FlutterEngineCreateAOTData(
                                   "Invalid ELF path specified.");
       }
 
+      std::scoped_lock lock(g_aot_data_registry_mutex);
+      auto& registry = GetAOTDataRegistry();
+      auto found = registry.find(source->elf_path);
+      if (found != registry.end()) {
+        found->second->ref_count++;
+        *data_out = found->second;
+        return kSuccess;
+      }
+
       auto aot_data = std::make_unique<_FlutterEngineAOTData>();
       const char* error = nullptr;
 
@@ -590,7 +703,9 @@ FlutterEngineResult FlutterEngineCreateAOTData(
       }
 
       aot_data->loaded_elf.reset(loaded_elf);
+      aot_data->elf_path = source->elf_path;
 
+      registry[aot_data->elf_path] = aot_data.get();
       *data_out = aot_data.release();
       return kSuccess;
     }
@@ -603,6 +718,12 @@ FlutterEngineResult FlutterEngineCreateAOTData(
 
 FlutterEngineResult FlutterEngineCollectAOTData(FlutterEngineAOTData data) {
   if (data) {
+    std::scoped_lock lock(g_aot_data_registry_mutex);
+    if (--data->ref_count > 0) {
+      // Other FlutterEngineCreateAOTData callers still hold this instance.
+      return kSuccess;
+    }
+    GetAOTDataRegistry().erase(data->elf_path);
     data->loaded_elf = nullptr;
     data->vm_snapshot_data = nullptr;
     data->vm_snapshot_instrs = nullptr;
@@ -894,8 +1015,10 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
           const FlutterPlatformMessage incoming_message = {
               sizeof(FlutterPlatformMessage),  // struct_size
               message->channel().c_str(),      // channel
-              message->data().data(),          // message
-              message->data().size(),          // message_size
+              message->hasData() ? message->data().GetMapping()
+                                 : nullptr,    // message
+              message->hasData() ? message->data().GetSize()
+                                 : 0,          // message_size
               handle,                          // response_handle
           };
           handle->message = std::move(message);
@@ -1542,6 +1665,31 @@ FlutterEngineResult FlutterEngineOnVsync(FLUTTER_API_SYMBOL(FlutterEngine)
   return kSuccess;
 }
 
+FlutterEngineResult FlutterEngineSetVsyncSchedule(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    uint64_t phase_nanos,
+    uint64_t interval_nanos) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  TRACE_EVENT0("flutter", "FlutterEngineSetVsyncSchedule");
+
+  auto phase = fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromNanoseconds(phase_nanos));
+
+  auto interval = fml::TimeDelta::FromNanoseconds(interval_nanos);
+
+  if (!reinterpret_cast<flutter::EmbedderEngine*>(engine)->SetVsyncSchedule(
+          phase, interval)) {
+    return LOG_EMBEDDER_ERROR(
+        kInternalInconsistency,
+        "Could not update the vsync schedule of the running engine instance.");
+  }
+
+  return kSuccess;
+}
+
 FlutterEngineResult FlutterEngineReloadSystemFonts(
     FLUTTER_API_SYMBOL(FlutterEngine) engine) {
   if (engine == nullptr) {
@@ -1610,6 +1758,41 @@ FlutterEngineResult FlutterEngineRunTask(FLUTTER_API_SYMBOL(FlutterEngine)
                                   "Could not run the specified task.");
 }
 
+FlutterEngineResult FlutterEngineRunTaskBatch(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterTaskBatch* batch,
+    uint64_t* next_target_time_nanos_out) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (batch == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid task batch.");
+  }
+
+  FlutterTaskBatch sanitized = {};
+  sanitized.struct_size = sizeof(FlutterTaskBatch);
+  sanitized.runner = SAFE_ACCESS(batch, runner, nullptr);
+  sanitized.tasks = SAFE_ACCESS(batch, tasks, nullptr);
+  sanitized.tasks_count = SAFE_ACCESS(batch, tasks_count, 0);
+
+  if (sanitized.runner == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Task batch specified no task runner.");
+  }
+
+  if (sanitized.tasks == nullptr && sanitized.tasks_count != 0) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Task batch specified tasks without an array.");
+  }
+
+  return reinterpret_cast<flutter::EmbedderEngine*>(engine)->RunTaskBatch(
+             &sanitized, next_target_time_nanos_out)
+             ? kSuccess
+             : LOG_EMBEDDER_ERROR(kInvalidArguments,
+                                  "Could not run the specified task batch.");
+}
+
 static bool DispatchJSONPlatformMessage(FLUTTER_API_SYMBOL(FlutterEngine)
                                             engine,
                                         rapidjson::Document document,
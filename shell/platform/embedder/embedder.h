@@ -39,6 +39,9 @@ typedef enum {
 typedef enum {
   kOpenGL,
   kSoftware,
+  /// Renders using the Metal API on Apple platforms. Only available when the
+  /// engine was built with Metal support.
+  kMetal,
 } FlutterRendererType;
 
 /// Additional accessibility features that may be enabled by the platform.
@@ -258,6 +261,13 @@ typedef struct {
   VoidCallback destruction_callback;
 } FlutterOpenGLFramebuffer;
 
+typedef struct {
+  double left;
+  double top;
+  double right;
+  double bottom;
+} FlutterRect;
+
 typedef bool (*BoolCallback)(void* /* user data */);
 typedef FlutterTransformation (*TransformationCallback)(void* /* user data */);
 typedef uint32_t (*UIntCallback)(void* /* user data */);
@@ -272,6 +282,9 @@ typedef bool (*TextureFrameCallback)(void* /* user data */,
                                      size_t /* height */,
                                      FlutterOpenGLTexture* /* texture out */);
 typedef void (*VsyncCallback)(void* /* user data */, intptr_t /* baton */);
+typedef bool (*OpenGLPresentWithDamageCallback)(
+    void* /* user data */,
+    const FlutterRect* /* damage */);
 
 typedef struct {
   /// The size of this struct. Must be sizeof(FlutterOpenGLRendererConfig).
@@ -309,23 +322,84 @@ typedef struct {
   /// that external texture details can be supplied to the engine for subsequent
   /// composition.
   TextureFrameCallback gl_external_texture_frame_callback;
+  /// This is an optional callback. If set, the engine will query it once per
+  /// frame for the age of the backbuffer it is about to render into, in the
+  /// sense of EGL_EXT_buffer_age: 1 means the buffer holds the frame presented
+  /// one swap ago, 2 the frame before that, and 0 means the contents are
+  /// undefined. Must be set for present_with_damage to take effect.
+  UIntCallback buffer_age_callback;
+  /// This is an optional callback. When both this and buffer_age_callback are
+  /// set, the engine redraws only the regions that changed since the frame
+  /// currently occupying the backbuffer and invokes this callback instead of
+  /// |present| with the bounding rectangle of those regions. The rectangle is
+  /// in physical pixels with the origin at the top left of the surface, and
+  /// can be forwarded to a damage-aware swap such as
+  /// eglSwapBuffersWithDamageKHR so the compositor only recomposites the
+  /// changed area.
+  OpenGLPresentWithDamageCallback present_with_damage;
 } FlutterOpenGLRendererConfig;
 
+/// Pixel formats the engine can convert software frames to before handing
+/// them to the embedder via `SoftwareSurfacePresentCallback`.
+typedef enum {
+  /// The native 32-bit format the engine renders into. Frames are presented
+  /// without conversion. This is the default.
+  kFlutterSoftwarePixelFormatNative32,
+  /// 32-bit BGRA, 8 bits per channel.
+  kFlutterSoftwarePixelFormatBGRA8888,
+  /// 16-bit RGB565.
+  kFlutterSoftwarePixelFormatRGB565,
+} FlutterSoftwarePixelFormat;
+
 typedef struct {
   /// The size of this struct. Must be sizeof(FlutterSoftwareRendererConfig).
   size_t struct_size;
   /// The callback presented to the embedder to present a fully populated buffer
   /// to the user. The pixel format of the buffer is the native 32-bit RGBA
-  /// format. The buffer is owned by the Flutter engine and must be copied in
-  /// this callback if needed.
+  /// format unless a different format was requested via `pixel_format`. The
+  /// buffer is owned by the Flutter engine and must be copied in this callback
+  /// if needed.
   SoftwareSurfacePresentCallback surface_present_callback;
+  /// The pixel format frames are converted to before
+  /// `surface_present_callback` is invoked. Optional; when absent or set to
+  /// `kFlutterSoftwarePixelFormatNative32`, frames are presented without
+  /// conversion. Conversion uses vectorized kernels and is limited to the
+  /// rows that changed since the previous frame. The row byte count passed to
+  /// the callback reflects the converted format.
+  FlutterSoftwarePixelFormat pixel_format;
 } FlutterSoftwareRendererConfig;
 
+/// Alias for id<MTLDevice>.
+typedef const void* FlutterMetalDeviceHandle;
+
+/// Alias for id<MTLCommandQueue>.
+typedef const void* FlutterMetalCommandQueueHandle;
+
+/// Alias for CAMetalLayer*.
+typedef const void* FlutterMetalLayerHandle;
+
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterMetalRendererConfig).
+  size_t struct_size;
+  /// Alias for id<MTLDevice> the engine renders with. The handle is retained
+  /// by the engine for the duration of the run.
+  FlutterMetalDeviceHandle device;
+  /// Alias for id<MTLCommandQueue> on which the engine commits its render
+  /// command buffers. Must have been created from `device`. The handle is
+  /// retained by the engine for the duration of the run.
+  FlutterMetalCommandQueueHandle present_command_queue;
+  /// Alias for the CAMetalLayer* the engine acquires drawables from and
+  /// presents into. The engine configures the layer's pixel format and
+  /// drawable size; the layer must outlive the engine run.
+  FlutterMetalLayerHandle layer;
+} FlutterMetalRendererConfig;
+
 typedef struct {
   FlutterRendererType type;
   union {
     FlutterOpenGLRendererConfig open_gl;
     FlutterSoftwareRendererConfig software;
+    FlutterMetalRendererConfig metal;
   };
 } FlutterRendererConfig;
 
@@ -457,13 +531,6 @@ typedef void (*FlutterDataCallback)(const uint8_t* /* data */,
                                     size_t /* size */,
                                     void* /* user data */);
 
-typedef struct {
-  double left;
-  double top;
-  double right;
-  double bottom;
-} FlutterRect;
-
 typedef struct {
   double x;
   double y;
@@ -611,6 +678,32 @@ typedef void (*FlutterTaskRunnerPostTaskCallback)(
     uint64_t /* target time nanos */,
     void* /* user data */);
 
+/// A batch of tasks that are due on an embedder managed task runner, along
+/// with the deadline of the earliest task the engine is still holding back.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterTaskBatch).
+  size_t struct_size;
+  /// The task runner on whose associated thread the tasks must be run.
+  FlutterTaskRunner runner;
+  /// Tasks that are due now, in the order they must be run. When a batch is
+  /// delivered via `FlutterTaskRunnerDescription.post_task_batch_callback`,
+  /// this array is only valid for the duration of that callback; embedders
+  /// that run the tasks later must copy it.
+  const FlutterTask* tasks;
+  size_t tasks_count;
+  /// The target time (on the system monotonic clock, in nanoseconds from
+  /// epoch) of the earliest task the engine has retained because it is not
+  /// due yet, or zero if the engine is holding no such task. Embedders should
+  /// schedule a wakeup for this time and then call
+  /// `FlutterEngineRunTaskBatch` (with a batch specifying zero tasks) to
+  /// collect the tasks that have become due.
+  uint64_t next_target_time_nanos;
+} FlutterTaskBatch;
+
+typedef void (*FlutterTaskRunnerPostTaskBatchCallback)(
+    const FlutterTaskBatch* /* batch */,
+    void* /* user data */);
+
 /// An interface used by the Flutter engine to execute tasks at the target time
 /// on a specified thread. There should be a 1-1 relationship between a thread
 /// and a task runner. It is undefined behavior to run a task on a thread that
@@ -638,6 +731,14 @@ typedef struct {
   /// A unique identifier for the task runner. If multiple task runners service
   /// tasks on the same thread, their identifiers must match.
   size_t identifier;
+  /// Optional. When set, the engine delivers tasks in batches via this
+  /// callback instead of invoking `post_task_callback` once per task. Tasks
+  /// that are not yet due are retained by the engine and summarized by the
+  /// earliest target time in the batch, so embedders integrating with epoll
+  /// or kqueue style event loops can arm a single timer instead of waking
+  /// once for every scheduled task. May be called from any thread. When this
+  /// field is set, `post_task_callback` may be NULL.
+  FlutterTaskRunnerPostTaskBatchCallback post_task_batch_callback;
 } FlutterTaskRunnerDescription;
 
 typedef struct {
@@ -653,6 +754,17 @@ typedef struct {
   /// and platform task runners. This makes the Flutter engine use the same
   /// thread for both task runners.
   const FlutterTaskRunnerDescription* render_task_runner;
+  /// Optional. When true, the engine runs its UI and IO components on the
+  /// platform task runner as well instead of creating dedicated threads for
+  /// them. The platform task runner must be specified, and the render task
+  /// runner, if specified, must share its identifier. All engine components
+  /// then service one task queue, so cross-component dispatch on the common
+  /// thread becomes a direct call with no queue round-trip. Intended for
+  /// fully single-threaded embedders such as command line tools and
+  /// low-power devices. Frame pipelining is unavailable in this mode, so
+  /// interactive embedders with a display attached will usually prefer the
+  /// default threading configuration.
+  bool merge_all_task_runners;
 } FlutterCustomTaskRunners;
 
 typedef struct {
@@ -984,6 +1096,13 @@ typedef struct _FlutterEngineAOTData* FlutterEngineAOTData;
 ///             all FlutterEngine instances launched using this data have been
 ///             terminated.
 ///
+///             The data is shareable: it may be passed to any number of engine
+///             instances, and repeated calls with the same source return a
+///             reference to the already loaded snapshot instead of mapping it
+///             again. Each successful call must be balanced by a call to
+///             `FlutterEngineCollectAOTData`; the underlying snapshot is
+///             released when the last reference is collected.
+///
 /// @param[in]  source    The source of the AOT data.
 /// @param[out] data_out  The AOT data on success. Unchanged on failure.
 ///
@@ -1567,6 +1686,45 @@ FlutterEngineResult FlutterEngineOnVsync(FLUTTER_API_SYMBOL(FlutterEngine)
                                          uint64_t frame_start_time_nanos,
                                          uint64_t frame_target_time_nanos);
 
+//------------------------------------------------------------------------------
+/// @brief      Publish a standing vsync schedule to the engine. While a
+///             schedule is in effect, the engine computes frame start and
+///             target times from its monotonic clock using the supplied phase
+///             and interval and does not invoke the vsync callback, removing
+///             the per-frame round-trip through the platform task runner.
+///             Embedders should republish the schedule whenever they observe
+///             that the display has drifted from it (for example after a
+///             refresh rate change or a display hot-swap). Passing an interval
+///             of zero clears the schedule and reverts to per-frame vsync
+///             callback invocations. Batons issued before the schedule took
+///             effect must still be returned via `FlutterEngineOnVsync`. This
+///             call has no effect unless a vsync callback was specified in
+///             `FlutterProjectArgs`. Like `FlutterEngineOnVsync`, this call
+///             must be made on the thread on which the call to
+///             `FlutterEngineRun` was made.
+///
+/// @see        FlutterEngineGetCurrentTime()
+///
+/// @attention  That the schedule timepoints are in nanoseconds.
+///
+/// @attention  The system monotonic clock is used as the timebase.
+///
+/// @param[in]  engine          A running engine instance.
+/// @param[in]  phase_nanos     A point (in the past or future) at which a
+///                             vsync occurred or will occur.
+/// @param[in]  interval_nanos  The interval between successive vsyncs. For
+///                             example, for a 60Hz display, embedders should
+///                             pass 16.6 * 1e6. A value of zero clears the
+///                             schedule.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineSetVsyncSchedule(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    uint64_t phase_nanos,
+    uint64_t interval_nanos);
+
 //------------------------------------------------------------------------------
 /// @brief      Reloads the system fonts in engine.
 ///
@@ -1661,6 +1819,33 @@ FlutterEngineResult FlutterEngineRunTask(FLUTTER_API_SYMBOL(FlutterEngine)
                                              engine,
                                          const FlutterTask* task);
 
+//------------------------------------------------------------------------------
+/// @brief      Inform the engine to run a batch of tasks delivered via the
+///             `FlutterTaskRunnerDescription.post_task_batch_callback`. The
+///             tasks are run in the order supplied; afterwards, any task the
+///             engine retained for the same runner whose target time has
+///             since expired is run as well, in target time order. This call
+///             must be made on the thread associated with the runner named in
+///             the batch. The batch may specify zero tasks: this is how an
+///             embedder that woke up for the `next_target_time_nanos`
+///             deadline of an earlier batch collects the tasks that have
+///             become due since.
+///
+/// @param[in]  engine  A running engine instance.
+/// @param[in]  batch   The batch of tasks to run.
+/// @param[out] next_target_time_nanos_out  Optional. Receives the target time
+///                                         of the earliest task the engine is
+///                                         still retaining for this runner,
+///                                         or zero if there is none.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineRunTaskBatch(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    const FlutterTaskBatch* batch,
+    uint64_t* next_target_time_nanos_out);
+
 //------------------------------------------------------------------------------
 /// @brief      Notify a running engine instance that the locale has been
 ///             updated. The preferred locale must be the first item in the list
@@ -5,6 +5,7 @@
 #include "flutter/shell/platform/embedder/embedder_engine.h"
 
 #include "flutter/fml/make_copyable.h"
+#include "flutter/shell/platform/embedder/platform_view_embedder.h"
 #include "flutter/shell/platform/embedder/vsync_waiter_embedder.h"
 
 namespace flutter {
@@ -219,6 +220,22 @@ bool EmbedderEngine::OnVsyncEvent(intptr_t baton,
                                               frame_target_time);
 }
 
+bool EmbedderEngine::SetVsyncSchedule(fml::TimePoint phase,
+                                      fml::TimeDelta interval) {
+  if (!IsValid()) {
+    return false;
+  }
+  auto platform_view = shell_->GetPlatformView();
+  if (!platform_view) {
+    return false;
+  }
+  // The shell is always set up with a platform view of this type by the
+  // embedder API.
+  static_cast<PlatformViewEmbedder*>(platform_view.get())
+      ->SetVsyncSchedule(phase, interval);
+  return true;
+}
+
 bool EmbedderEngine::ReloadSystemFonts() {
   if (!IsValid()) {
     return false;
@@ -247,6 +264,26 @@ bool EmbedderEngine::RunTask(const FlutterTask* task) {
                                 task->task);
 }
 
+bool EmbedderEngine::RunTaskBatch(const FlutterTaskBatch* batch,
+                                  uint64_t* next_target_time_nanos) {
+  // Like `RunTask`, this is deliberately usable before the shell is running
+  // so embedders can service their task runner interop during startup.
+  if (batch == nullptr || batch->runner == nullptr) {
+    return false;
+  }
+  std::vector<uint64_t> batons;
+  batons.reserve(batch->tasks_count);
+  for (size_t i = 0; i < batch->tasks_count; i++) {
+    // All tasks in a batch are destined for the same runner.
+    if (batch->tasks[i].runner != batch->runner) {
+      return false;
+    }
+    batons.push_back(batch->tasks[i].task);
+  }
+  return thread_host_->RunTaskBatch(reinterpret_cast<int64_t>(batch->runner),
+                                    batons, next_target_time_nanos);
+}
+
 bool EmbedderEngine::PostTaskOnEngineManagedNativeThreads(
     std::function<void(FlutterNativeThreadType)> closure) const {
   if (!IsValid() || closure == nullptr) {
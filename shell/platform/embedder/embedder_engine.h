@@ -74,12 +74,17 @@ class EmbedderEngine {
                     fml::TimePoint frame_start_time,
                     fml::TimePoint frame_target_time);
 
+  bool SetVsyncSchedule(fml::TimePoint phase, fml::TimeDelta interval);
+
   bool ReloadSystemFonts();
 
   bool PostRenderThreadTask(const fml::closure& task);
 
   bool RunTask(const FlutterTask* task);
 
+  bool RunTaskBatch(const FlutterTaskBatch* batch,
+                    uint64_t* next_target_time_nanos);
+
   bool PostTaskOnEngineManagedNativeThreads(
       std::function<void(FlutterNativeThreadType)> closure) const;
 
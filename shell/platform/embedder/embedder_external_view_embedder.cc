@@ -6,6 +6,7 @@
 
 #include <algorithm>
 
+#include "flutter/fml/trace_event.h"
 #include "flutter/shell/platform/embedder/embedder_layers.h"
 #include "flutter/shell/platform/embedder/embedder_render_target.h"
 #include "third_party/skia/include/gpu/GrContext.h"
@@ -16,7 +17,10 @@ EmbedderExternalViewEmbedder::EmbedderExternalViewEmbedder(
     const CreateRenderTargetCallback& create_render_target_callback,
     const PresentCallback& present_callback)
     : create_render_target_callback_(create_render_target_callback),
-      present_callback_(present_callback) {
+      present_callback_(present_callback),
+      presented_layers_pool_(pending_frame_size_,
+                             pending_device_pixel_ratio_,
+                             pending_surface_transformation_) {
   FML_DCHECK(create_render_target_callback_);
   FML_DCHECK(present_callback_);
 }
@@ -135,12 +139,14 @@ bool EmbedderExternalViewEmbedder::SubmitFrame(
   auto [matched_render_targets, pending_keys] =
       render_target_cache_.GetExistingTargetsInCache(pending_views_);
 
-  // This is where unused render targets will be collected. Control may flow to
+  // This is where stale render targets will be collected. Control may flow to
   // the embedder. Here, the embedder has the opportunity to trample on the
-  // OpenGL context.
+  // OpenGL context. Targets that went unused this frame but only recently are
+  // left pooled by the trim so that churn during a resize does not cause the
+  // embedder to re-allocate them next frame.
   //
-  // For optimum performance, we should tell the render target cache to clear
-  // its unused entries before allocating new ones. This collection step before
+  // For optimum performance, we should tell the render target cache to trim
+  // its stale entries before allocating new ones. This collection step before
   // allocating new render targets ameliorates peak memory usage within the
   // frame. But, this causes an issue in a known internal embedder. To work
   // around this issue while that embedder migrates, collection of render
@@ -148,7 +154,7 @@ bool EmbedderExternalViewEmbedder::SubmitFrame(
   //
   // @warning: Embedder may trample on our OpenGL context here.
   auto deferred_cleanup_render_targets =
-      render_target_cache_.ClearAllRenderTargetsInCache();
+      render_target_cache_.TrimStaleRenderTargets();
 
   for (const auto& pending_key : pending_keys) {
     const auto& external_view = pending_views_.at(pending_key);
@@ -219,9 +225,10 @@ bool EmbedderExternalViewEmbedder::SubmitFrame(
   //
   // @warning: Embedder may trample on our OpenGL context here.
   {
-    EmbedderLayers presented_layers(pending_frame_size_,
-                                    pending_device_pixel_ratio_,
-                                    pending_surface_transformation_);
+    EmbedderLayers& presented_layers = presented_layers_pool_;
+    presented_layers.ResetForNextFrame(pending_frame_size_,
+                                       pending_device_pixel_ratio_,
+                                       pending_surface_transformation_);
     // In composition order, submit backing stores and platform views to the
     // embedder.
     for (const auto& view_id : composition_order_) {
@@ -257,13 +264,21 @@ bool EmbedderExternalViewEmbedder::SubmitFrame(
   // @warning: Embedder may trample on our OpenGL context here.
   deferred_cleanup_render_targets.clear();
 
-  // Hold all rendered layers in the render target cache for one frame to
-  // see if they may be reused next frame.
+  // Return all rendered layers to the render target cache so that they may be
+  // reused next frame, by these views or any others that need targets of the
+  // same size.
   for (auto& render_target : matched_render_targets) {
-    render_target_cache_.CacheRenderTarget(render_target.first,
-                                           std::move(render_target.second));
+    render_target_cache_.CacheRenderTarget(std::move(render_target.second));
   }
 
+#if !FLUTTER_RELEASE
+  FML_TRACE_COUNTER(
+      "flutter", "EmbedderRenderTargetCache",
+      reinterpret_cast<int64_t>(&render_target_cache_),  //
+      "CachedCount", render_target_cache_.GetCachedTargetsCount(),
+      "HighWaterMark", render_target_cache_.GetCachedTargetsHighWaterMark());
+#endif  // !FLUTTER_RELEASE
+
   return frame->Submit();
 }
 
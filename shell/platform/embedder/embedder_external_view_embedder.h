@@ -12,6 +12,7 @@
 #include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/embedder/embedder_external_view.h"
+#include "flutter/shell/platform/embedder/embedder_layers.h"
 #include "flutter/shell/platform/embedder/embedder_render_target_cache.h"
 
 namespace flutter {
@@ -105,6 +106,9 @@ class EmbedderExternalViewEmbedder final : public ExternalViewEmbedder {
   EmbedderExternalView::PendingViews pending_views_;
   std::vector<EmbedderExternalView::ViewIdentifier> composition_order_;
   EmbedderRenderTargetCache render_target_cache_;
+  // Reused across frames so the layer and mutation structures handed to the
+  // embedder come out of retained pools instead of per-frame allocations.
+  EmbedderLayers presented_layers_pool_;
 
   void Reset();
 
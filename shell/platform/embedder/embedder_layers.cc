@@ -17,6 +17,54 @@ EmbedderLayers::EmbedderLayers(SkISize frame_size,
 
 EmbedderLayers::~EmbedderLayers() = default;
 
+void EmbedderLayers::ResetForNextFrame(SkISize frame_size,
+                                       double device_pixel_ratio,
+                                       SkMatrix root_surface_transformation) {
+  frame_size_ = frame_size;
+  device_pixel_ratio_ = device_pixel_ratio;
+  root_surface_transformation_ = root_surface_transformation;
+  // Mark all pooled entries as free and clear the per-frame arrays. None of
+  // these operations release capacity.
+  platform_views_used_ = 0;
+  mutations_used_ = 0;
+  mutations_arrays_used_ = 0;
+  presented_layers_.clear();
+  presented_layers_pointers_.clear();
+}
+
+const FlutterPlatformViewMutation* EmbedderLayers::AllocateMutation(
+    const FlutterPlatformViewMutation& mutation) {
+  if (mutations_used_ == mutations_referenced_.size()) {
+    mutations_referenced_.emplace_back(
+        std::make_unique<FlutterPlatformViewMutation>());
+  }
+  FlutterPlatformViewMutation* allocated =
+      mutations_referenced_[mutations_used_++].get();
+  *allocated = mutation;
+  return allocated;
+}
+
+const FlutterPlatformView* EmbedderLayers::AllocatePlatformView(
+    const FlutterPlatformView& view) {
+  if (platform_views_used_ == platform_views_referenced_.size()) {
+    platform_views_referenced_.emplace_back(
+        std::make_unique<FlutterPlatformView>());
+  }
+  FlutterPlatformView* allocated =
+      platform_views_referenced_[platform_views_used_++].get();
+  *allocated = view;
+  return allocated;
+}
+
+std::vector<const FlutterPlatformViewMutation*>*
+EmbedderLayers::AllocateMutationsArray() {
+  if (mutations_arrays_used_ == mutations_arrays_referenced_.size()) {
+    mutations_arrays_referenced_.emplace_back(
+        std::make_unique<std::vector<const FlutterPlatformViewMutation*>>());
+  }
+  return mutations_arrays_referenced_[mutations_arrays_used_++].get();
+}
+
 void EmbedderLayers::PushBackingStoreLayer(const FlutterBackingStore* store) {
   FlutterLayer layer = {};
 
@@ -38,23 +86,21 @@ void EmbedderLayers::PushBackingStoreLayer(const FlutterBackingStore* store) {
   presented_layers_.push_back(layer);
 }
 
-static std::unique_ptr<FlutterPlatformViewMutation> ConvertMutation(
-    double opacity) {
+static FlutterPlatformViewMutation ConvertMutation(double opacity) {
   FlutterPlatformViewMutation mutation = {};
   mutation.type = kFlutterPlatformViewMutationTypeOpacity;
   mutation.opacity = opacity;
-  return std::make_unique<FlutterPlatformViewMutation>(mutation);
+  return mutation;
 }
 
-static std::unique_ptr<FlutterPlatformViewMutation> ConvertMutation(
-    const SkRect& rect) {
+static FlutterPlatformViewMutation ConvertMutation(const SkRect& rect) {
   FlutterPlatformViewMutation mutation = {};
   mutation.type = kFlutterPlatformViewMutationTypeClipRect;
   mutation.clip_rect.left = rect.left();
   mutation.clip_rect.top = rect.top();
   mutation.clip_rect.right = rect.right();
   mutation.clip_rect.bottom = rect.bottom();
-  return std::make_unique<FlutterPlatformViewMutation>(mutation);
+  return mutation;
 }
 
 static FlutterSize VectorToSize(const SkVector& vector) {
@@ -64,8 +110,7 @@ static FlutterSize VectorToSize(const SkVector& vector) {
   return size;
 }
 
-static std::unique_ptr<FlutterPlatformViewMutation> ConvertMutation(
-    const SkRRect& rrect) {
+static FlutterPlatformViewMutation ConvertMutation(const SkRRect& rrect) {
   FlutterPlatformViewMutation mutation = {};
   mutation.type = kFlutterPlatformViewMutationTypeClipRoundedRect;
   const auto& rect = rrect.rect();
@@ -81,11 +126,10 @@ static std::unique_ptr<FlutterPlatformViewMutation> ConvertMutation(
       VectorToSize(rrect.radii(SkRRect::Corner::kLowerRight_Corner));
   mutation.clip_rounded_rect.lower_left_corner_radius =
       VectorToSize(rrect.radii(SkRRect::Corner::kLowerLeft_Corner));
-  return std::make_unique<FlutterPlatformViewMutation>(mutation);
+  return mutation;
 }
 
-static std::unique_ptr<FlutterPlatformViewMutation> ConvertMutation(
-    const SkMatrix& matrix) {
+static FlutterPlatformViewMutation ConvertMutation(const SkMatrix& matrix) {
   FlutterPlatformViewMutation mutation = {};
   mutation.type = kFlutterPlatformViewMutationTypeTransformation;
   mutation.transformation.scaleX = matrix[SkMatrix::kMScaleX];
@@ -97,87 +141,71 @@ static std::unique_ptr<FlutterPlatformViewMutation> ConvertMutation(
   mutation.transformation.pers0 = matrix[SkMatrix::kMPersp0];
   mutation.transformation.pers1 = matrix[SkMatrix::kMPersp1];
   mutation.transformation.pers2 = matrix[SkMatrix::kMPersp2];
-  return std::make_unique<FlutterPlatformViewMutation>(mutation);
+  return mutation;
 }
 
 void EmbedderLayers::PushPlatformViewLayer(
     FlutterPlatformViewIdentifier identifier,
     const EmbeddedViewParams& params) {
-  {
-    FlutterPlatformView view = {};
-    view.struct_size = sizeof(FlutterPlatformView);
-    view.identifier = identifier;
-
-    const auto& mutators = params.mutatorsStack;
-
-    std::vector<const FlutterPlatformViewMutation*> mutations_array;
-
-    for (auto i = mutators.Bottom(); i != mutators.Top(); ++i) {
-      const auto& mutator = *i;
-      switch (mutator->GetType()) {
-        case MutatorType::clip_rect: {
-          mutations_array.push_back(
-              mutations_referenced_
-                  .emplace_back(ConvertMutation(mutator->GetRect()))
-                  .get());
-        } break;
-        case MutatorType::clip_rrect: {
-          mutations_array.push_back(
-              mutations_referenced_
-                  .emplace_back(ConvertMutation(mutator->GetRRect()))
-                  .get());
-        } break;
-        case MutatorType::clip_path: {
-          // Unsupported mutation.
-        } break;
-        case MutatorType::transform: {
-          const auto& matrix = mutator->GetMatrix();
-          if (!matrix.isIdentity()) {
-            mutations_array.push_back(
-                mutations_referenced_.emplace_back(ConvertMutation(matrix))
-                    .get());
-          }
-        } break;
-        case MutatorType::opacity: {
-          const double opacity =
-              std::clamp(mutator->GetAlphaFloat(), 0.0f, 1.0f);
-          if (opacity < 1.0) {
-            mutations_array.push_back(
-                mutations_referenced_.emplace_back(ConvertMutation(opacity))
-                    .get());
-          }
-        } break;
-      }
+  FlutterPlatformView view = {};
+  view.struct_size = sizeof(FlutterPlatformView);
+  view.identifier = identifier;
+
+  const auto& mutators = params.mutatorsStack;
+
+  mutations_scratch_.clear();
+
+  for (auto i = mutators.Bottom(); i != mutators.Top(); ++i) {
+    const auto& mutator = *i;
+    switch (mutator.GetType()) {
+      case MutatorType::clip_rect: {
+        mutations_scratch_.push_back(
+            AllocateMutation(ConvertMutation(mutator.GetRect())));
+      } break;
+      case MutatorType::clip_rrect: {
+        mutations_scratch_.push_back(
+            AllocateMutation(ConvertMutation(mutator.GetRRect())));
+      } break;
+      case MutatorType::clip_path: {
+        // Unsupported mutation.
+      } break;
+      case MutatorType::transform: {
+        const auto& matrix = mutator.GetMatrix();
+        if (!matrix.isIdentity()) {
+          mutations_scratch_.push_back(
+              AllocateMutation(ConvertMutation(matrix)));
+        }
+      } break;
+      case MutatorType::opacity: {
+        const double opacity = std::clamp(mutator.GetAlphaFloat(), 0.0f, 1.0f);
+        if (opacity < 1.0) {
+          mutations_scratch_.push_back(
+              AllocateMutation(ConvertMutation(opacity)));
+        }
+      } break;
     }
+  }
 
-    if (!mutations_array.empty()) {
-      // If there are going to be any mutations, they must first take into
-      // account the root surface transformation.
-      if (!root_surface_transformation_.isIdentity()) {
-        mutations_array.push_back(
-            mutations_referenced_
-                .emplace_back(ConvertMutation(root_surface_transformation_))
-                .get());
-      }
-
-      auto mutations =
-          std::make_unique<std::vector<const FlutterPlatformViewMutation*>>(
-              mutations_array.rbegin(), mutations_array.rend());
-      mutations_arrays_referenced_.emplace_back(std::move(mutations));
-
-      view.mutations_count = mutations_array.size();
-      view.mutations = mutations_arrays_referenced_.back().get()->data();
+  if (!mutations_scratch_.empty()) {
+    // If there are going to be any mutations, they must first take into
+    // account the root surface transformation.
+    if (!root_surface_transformation_.isIdentity()) {
+      mutations_scratch_.push_back(
+          AllocateMutation(ConvertMutation(root_surface_transformation_)));
     }
 
-    platform_views_referenced_.emplace_back(
-        std::make_unique<FlutterPlatformView>(view));
+    auto* mutations = AllocateMutationsArray();
+    mutations->assign(mutations_scratch_.rbegin(), mutations_scratch_.rend());
+
+    view.mutations_count = mutations->size();
+    view.mutations = mutations->data();
   }
 
   FlutterLayer layer = {};
 
   layer.struct_size = sizeof(FlutterLayer);
   layer.type = kFlutterLayerContentTypePlatformView;
-  layer.platform_view = platform_views_referenced_.back().get();
+  layer.platform_view = AllocatePlatformView(view);
 
   const auto layer_bounds =
       SkRect::MakeXYWH(params.offsetPixels.x(),                          //
@@ -197,14 +225,13 @@ void EmbedderLayers::PushPlatformViewLayer(
   presented_layers_.push_back(layer);
 }
 
-void EmbedderLayers::InvokePresentCallback(
-    const PresentCallback& callback) const {
-  std::vector<const FlutterLayer*> presented_layers_pointers;
-  presented_layers_pointers.reserve(presented_layers_.size());
+void EmbedderLayers::InvokePresentCallback(const PresentCallback& callback) {
+  presented_layers_pointers_.clear();
+  presented_layers_pointers_.reserve(presented_layers_.size());
   for (const auto& layer : presented_layers_) {
-    presented_layers_pointers.push_back(&layer);
+    presented_layers_pointers_.push_back(&layer);
   }
-  callback(std::move(presented_layers_pointers));
+  callback(presented_layers_pointers_);
 }
 
 }  // namespace flutter
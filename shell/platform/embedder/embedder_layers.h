@@ -24,6 +24,16 @@ class EmbedderLayers {
 
   ~EmbedderLayers();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Discards the previous frame's layers and readies the pools
+  ///             for the next one. The backing allocations are retained, so a
+  ///             caller that keeps one instance alive across frames performs
+  ///             no heap allocation during steady-state composition.
+  ///
+  void ResetForNextFrame(SkISize frame_size,
+                         double device_pixel_ratio,
+                         SkMatrix root_surface_transformation);
+
   void PushBackingStoreLayer(const FlutterBackingStore* store);
 
   void PushPlatformViewLayer(FlutterPlatformViewIdentifier identifier,
@@ -31,18 +41,33 @@ class EmbedderLayers {
 
   using PresentCallback =
       std::function<bool(const std::vector<const FlutterLayer*>& layers)>;
-  void InvokePresentCallback(const PresentCallback& callback) const;
+  void InvokePresentCallback(const PresentCallback& callback);
 
  private:
-  const SkISize frame_size_;
-  const double device_pixel_ratio_;
-  const SkMatrix root_surface_transformation_;
+  SkISize frame_size_;
+  double device_pixel_ratio_;
+  SkMatrix root_surface_transformation_;
+  // The structures referenced by the layers handed to the embedder are pooled:
+  // entries below the used count are live for the current frame and the rest
+  // are free for reuse. The unique_ptr indirection keeps the addresses handed
+  // to the embedder stable while the pools grow.
   std::vector<std::unique_ptr<FlutterPlatformView>> platform_views_referenced_;
+  size_t platform_views_used_ = 0;
   std::vector<std::unique_ptr<FlutterPlatformViewMutation>>
       mutations_referenced_;
+  size_t mutations_used_ = 0;
   std::vector<std::unique_ptr<std::vector<const FlutterPlatformViewMutation*>>>
       mutations_arrays_referenced_;
+  size_t mutations_arrays_used_ = 0;
   std::vector<FlutterLayer> presented_layers_;
+  std::vector<const FlutterPlatformViewMutation*> mutations_scratch_;
+  std::vector<const FlutterLayer*> presented_layers_pointers_;
+
+  const FlutterPlatformViewMutation* AllocateMutation(
+      const FlutterPlatformViewMutation& mutation);
+  const FlutterPlatformView* AllocatePlatformView(
+      const FlutterPlatformView& view);
+  std::vector<const FlutterPlatformViewMutation*>* AllocateMutationsArray();
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderLayers);
 };
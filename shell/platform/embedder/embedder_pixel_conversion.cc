@@ -0,0 +1,173 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/embedder_pixel_conversion.h"
+
+#include <cstring>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define PIXEL_CONVERSION_HAS_SSSE3 1
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PIXEL_CONVERSION_HAS_NEON 1
+#endif
+
+namespace flutter {
+
+namespace {
+
+// Swaps bytes 0 and 2 of every 32-bit pixel, turning RGBA into BGRA (the
+// shuffle is its own inverse, so a BGRA source yields RGBA).
+void SwapRedBlueRow(const uint8_t* source, uint8_t* destination, int width) {
+  int x = 0;
+#if defined(PIXEL_CONVERSION_HAS_SSSE3)
+  const __m128i swizzle =
+      _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+  for (; x + 4 <= width; x += 4) {
+    const __m128i pixels = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(source + x * 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x * 4),
+                     _mm_shuffle_epi8(pixels, swizzle));
+  }
+#elif defined(PIXEL_CONVERSION_HAS_NEON)
+  for (; x + 16 <= width; x += 16) {
+    uint8x16x4_t pixels = vld4q_u8(source + x * 4);
+    const uint8x16_t red = pixels.val[0];
+    pixels.val[0] = pixels.val[2];
+    pixels.val[2] = red;
+    vst4q_u8(destination + x * 4, pixels);
+  }
+#endif
+  for (; x < width; x++) {
+    const uint8_t* source_pixel = source + x * 4;
+    uint8_t* destination_pixel = destination + x * 4;
+    destination_pixel[0] = source_pixel[2];
+    destination_pixel[1] = source_pixel[1];
+    destination_pixel[2] = source_pixel[0];
+    destination_pixel[3] = source_pixel[3];
+  }
+}
+
+// Packs 32-bit pixels into RGB565. The red and blue byte offsets are passed
+// in so RGBA and BGRA sources share the kernel.
+void PackRGB565Row(const uint8_t* source,
+                   uint8_t* destination,
+                   int width,
+                   int red_index,
+                   int blue_index) {
+  uint16_t* destination16 = reinterpret_cast<uint16_t*>(destination);
+  int x = 0;
+#if defined(PIXEL_CONVERSION_HAS_SSSE3)
+  const __m128i pack_low_words = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1,
+                                               -1, -1, -1, -1, -1, -1, -1);
+  for (; x + 4 <= width; x += 4) {
+    const __m128i pixels = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(source + x * 4));
+    const __m128i red = _mm_and_si128(
+        _mm_srli_epi32(pixels, red_index * 8 + 3), _mm_set1_epi32(0x1F));
+    const __m128i green =
+        _mm_and_si128(_mm_srli_epi32(pixels, 10), _mm_set1_epi32(0x3F));
+    const __m128i blue = _mm_and_si128(
+        _mm_srli_epi32(pixels, blue_index * 8 + 3), _mm_set1_epi32(0x1F));
+    const __m128i rgb =
+        _mm_or_si128(_mm_slli_epi32(red, 11),
+                     _mm_or_si128(_mm_slli_epi32(green, 5), blue));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(destination16 + x),
+                     _mm_shuffle_epi8(rgb, pack_low_words));
+  }
+#elif defined(PIXEL_CONVERSION_HAS_NEON)
+  for (; x + 8 <= width; x += 8) {
+    const uint8x8x4_t pixels = vld4_u8(source + x * 4);
+    // Shift each channel into the top byte, then insert the next channel
+    // below it with a shift-right-insert.
+    uint16x8_t packed = vshll_n_u8(pixels.val[red_index], 8);
+    packed = vsriq_n_u16(packed, vshll_n_u8(pixels.val[1], 8), 5);
+    packed = vsriq_n_u16(packed, vshll_n_u8(pixels.val[blue_index], 8), 11);
+    vst1q_u16(destination16 + x, packed);
+  }
+#endif
+  for (; x < width; x++) {
+    const uint8_t* source_pixel = source + x * 4;
+    const uint8_t red = source_pixel[red_index];
+    const uint8_t green = source_pixel[1];
+    const uint8_t blue = source_pixel[blue_index];
+    destination16[x] = static_cast<uint16_t>(((red & 0xF8) << 8) |
+                                             ((green & 0xFC) << 3) |
+                                             (blue >> 3));
+  }
+}
+
+}  // namespace
+
+size_t BytesPerConvertedSoftwarePixel(FlutterSoftwarePixelFormat format) {
+  switch (format) {
+    case kFlutterSoftwarePixelFormatBGRA8888:
+      return 4u;
+    case kFlutterSoftwarePixelFormatRGB565:
+      return 2u;
+    case kFlutterSoftwarePixelFormatNative32:
+      break;
+  }
+  return 0u;
+}
+
+bool ConvertSoftwarePixels(const SkPixmap& source,
+                           const SkIRect& damage,
+                           FlutterSoftwarePixelFormat format,
+                           uint8_t* destination,
+                           size_t destination_row_bytes) {
+  const size_t bytes_per_pixel = BytesPerConvertedSoftwarePixel(format);
+  if (destination == nullptr || bytes_per_pixel == 0u) {
+    return false;
+  }
+
+  if (damage.isEmpty()) {
+    return true;
+  }
+
+  if (!SkIRect::MakeWH(source.width(), source.height()).contains(damage)) {
+    return false;
+  }
+
+  int red_index = 0;
+  int blue_index = 2;
+  switch (source.colorType()) {
+    case kRGBA_8888_SkColorType:
+      break;
+    case kBGRA_8888_SkColorType:
+      red_index = 2;
+      blue_index = 0;
+      break;
+    default:
+      return false;
+  }
+
+  for (int y = damage.top(); y < damage.bottom(); y++) {
+    const uint8_t* source_row =
+        static_cast<const uint8_t*>(source.addr(damage.left(), y));
+    uint8_t* destination_row = destination + y * destination_row_bytes +
+                               damage.left() * bytes_per_pixel;
+    switch (format) {
+      case kFlutterSoftwarePixelFormatBGRA8888:
+        if (blue_index == 0) {
+          // The source already carries its channels in BGRA order.
+          std::memcpy(destination_row, source_row, damage.width() * 4u);
+        } else {
+          SwapRedBlueRow(source_row, destination_row, damage.width());
+        }
+        break;
+      case kFlutterSoftwarePixelFormatRGB565:
+        PackRGB565Row(source_row, destination_row, damage.width(), red_index,
+                      blue_index);
+        break;
+      case kFlutterSoftwarePixelFormatNative32:
+        return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace flutter
@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_PIXEL_CONVERSION_H_
+#define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_PIXEL_CONVERSION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "third_party/skia/include/core/SkPixmap.h"
+#include "third_party/skia/include/core/SkRect.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Returns the number of bytes one pixel occupies once converted
+///             to the given format. Zero for the native pass-through format,
+///             which involves no conversion.
+///
+size_t BytesPerConvertedSoftwarePixel(FlutterSoftwarePixelFormat format);
+
+//------------------------------------------------------------------------------
+/// @brief      Converts the rows of the source pixmap covered by the damage
+///             region from the engine's native 32-bit layout into the given
+///             format, writing the results into the destination buffer at the
+///             same row positions. Rows outside the damage region are left
+///             untouched, so a destination buffer that persists across frames
+///             stays coherent when only part of the frame changed.
+///
+///             The conversion uses NEON or SSSE3 kernels when the target
+///             architecture supports them and falls back to a scalar loop on
+///             others (and for trailing pixels a vector does not cover).
+///
+/// @param[in]  source                 The rastered frame. Must be 32-bit RGBA
+///                                    or BGRA.
+/// @param[in]  damage                 The region to convert, in source
+///                                    coordinates. May be empty, in which case
+///                                    the destination is left untouched.
+/// @param[in]  format                 The format to convert to. Must not be
+///                                    the native pass-through format.
+/// @param[in]  destination            The buffer converted rows are written
+///                                    into. Must hold at least
+///                                    `destination_row_bytes * height` bytes.
+/// @param[in]  destination_row_bytes  The stride of the destination buffer.
+///
+/// @return     If the conversion was performed.
+///
+bool ConvertSoftwarePixels(const SkPixmap& source,
+                           const SkIRect& damage,
+                           FlutterSoftwarePixelFormat format,
+                           uint8_t* destination,
+                           size_t destination_row_bytes);
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_PIXEL_CONVERSION_H_
@@ -4,6 +4,8 @@
 
 #include "flutter/shell/platform/embedder/embedder_render_target_cache.h"
 
+#include <algorithm>
+
 namespace flutter {
 
 EmbedderRenderTargetCache::EmbedderRenderTargetCache() = default;
@@ -22,28 +24,51 @@ EmbedderRenderTargetCache::GetExistingTargetsInCache(
     if (!external_view->HasEngineRenderedContents()) {
       continue;
     }
+    // Targets are pooled by size alone. A target last used by a different
+    // view is just as serviceable as one last used by this view.
     auto& compatible_targets =
-        cached_render_targets_[external_view->CreateRenderTargetDescriptor()];
-    if (compatible_targets.size() == 0) {
+        cached_render_targets_[external_view->GetRenderSurfaceSize()];
+    if (compatible_targets.empty()) {
       unmatched_identifiers.insert(view.first);
     } else {
       std::unique_ptr<EmbedderRenderTarget> target =
-          std::move(compatible_targets.top());
-      compatible_targets.pop();
+          std::move(compatible_targets.back().target);
+      compatible_targets.pop_back();
       resolved_render_targets[view.first] = std::move(target);
     }
   }
   return {std::move(resolved_render_targets), std::move(unmatched_identifiers)};
 }
 
+std::set<std::unique_ptr<EmbedderRenderTarget>>
+EmbedderRenderTargetCache::TrimStaleRenderTargets() {
+  std::set<std::unique_ptr<EmbedderRenderTarget>> trimmed_targets;
+  for (auto it = cached_render_targets_.begin();
+       it != cached_render_targets_.end();) {
+    auto& targets = it->second;
+    for (auto target = targets.begin(); target != targets.end();) {
+      if (++target->frames_unused > kMaxFramesUnused) {
+        trimmed_targets.emplace(std::move(target->target));
+        target = targets.erase(target);
+      } else {
+        ++target;
+      }
+    }
+    if (targets.empty()) {
+      it = cached_render_targets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return trimmed_targets;
+}
+
 std::set<std::unique_ptr<EmbedderRenderTarget>>
 EmbedderRenderTargetCache::ClearAllRenderTargetsInCache() {
   std::set<std::unique_ptr<EmbedderRenderTarget>> cleared_targets;
   for (auto& targets : cached_render_targets_) {
-    auto& targets_stack = targets.second;
-    while (!targets_stack.empty()) {
-      cleared_targets.emplace(std::move(targets_stack.top()));
-      targets_stack.pop();
+    for (auto& target : targets.second) {
+      cleared_targets.emplace(std::move(target.target));
     }
   }
   cached_render_targets_.clear();
@@ -51,15 +76,15 @@ EmbedderRenderTargetCache::ClearAllRenderTargetsInCache() {
 }
 
 void EmbedderRenderTargetCache::CacheRenderTarget(
-    EmbedderExternalView::ViewIdentifier view_identifier,
     std::unique_ptr<EmbedderRenderTarget> target) {
   if (target == nullptr) {
     return;
   }
   auto surface = target->GetRenderSurface();
-  auto desc = EmbedderExternalView::RenderTargetDescriptor{
-      view_identifier, SkISize::Make(surface->width(), surface->height())};
-  cached_render_targets_[desc].push(std::move(target));
+  auto size = SkISize::Make(surface->width(), surface->height());
+  cached_render_targets_[size].push_back({std::move(target), 0u});
+  cached_targets_high_water_mark_ =
+      std::max(cached_targets_high_water_mark_, GetCachedTargetsCount());
 }
 
 size_t EmbedderRenderTargetCache::GetCachedTargetsCount() const {
@@ -70,4 +95,8 @@ size_t EmbedderRenderTargetCache::GetCachedTargetsCount() const {
   return count;
 }
 
+size_t EmbedderRenderTargetCache::GetCachedTargetsHighWaterMark() const {
+  return cached_targets_high_water_mark_;
+}
+
 }  // namespace flutter
@@ -6,10 +6,10 @@
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_RENDER_TARGET_CACHE_H_
 
 #include <set>
-#include <stack>
-#include <tuple>
 #include <unordered_map>
+#include <vector>
 
+#include "flutter/fml/hash_combine.h"
 #include "flutter/fml/macros.h"
 #include "flutter/shell/platform/embedder/embedder_external_view.h"
 
@@ -17,7 +17,12 @@ namespace flutter {
 
 //------------------------------------------------------------------------------
 /// @brief      A cache used to reference render targets that are owned by the
-///             embedder but needed by th engine to render a frame.
+///             embedder but needed by th engine to render a frame. Targets are
+///             pooled by their surface size, so a target rendered for one view
+///             in a previous frame may be handed to any other view that needs
+///             a surface of the same dimensions. Targets that go unused are
+///             kept alive for a handful of frames before being trimmed, which
+///             avoids re-allocation storms when views churn during resizes.
 ///
 class EmbedderRenderTargetCache {
  public:
@@ -35,22 +40,52 @@ class EmbedderRenderTargetCache {
   GetExistingTargetsInCache(
       const EmbedderExternalView::PendingViews& pending_views);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Releases targets that have not been handed out for a few
+  ///             consecutive frames. Targets that were merely skipped this
+  ///             frame stay pooled so that transient churn (such as a window
+  ///             resize) does not force the embedder to re-allocate them.
+  ///
+  /// @return     The released targets. The caller determines when these are
+  ///             actually collected.
+  ///
+  std::set<std::unique_ptr<EmbedderRenderTarget>> TrimStaleRenderTargets();
+
   std::set<std::unique_ptr<EmbedderRenderTarget>>
   ClearAllRenderTargetsInCache();
 
-  void CacheRenderTarget(EmbedderExternalView::ViewIdentifier view_identifier,
-                         std::unique_ptr<EmbedderRenderTarget> target);
+  void CacheRenderTarget(std::unique_ptr<EmbedderRenderTarget> target);
 
   size_t GetCachedTargetsCount() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The maximum number of render targets that were pooled at any
+  ///             one time over the lifetime of this cache.
+  ///
+  size_t GetCachedTargetsHighWaterMark() const;
+
  private:
-  using CachedRenderTargets =
-      std::unordered_map<EmbedderExternalView::RenderTargetDescriptor,
-                         std::stack<std::unique_ptr<EmbedderRenderTarget>>,
-                         EmbedderExternalView::RenderTargetDescriptor::Hash,
-                         EmbedderExternalView::RenderTargetDescriptor::Equal>;
+  // The number of consecutive frames a pooled target may go unused before
+  // |TrimStaleRenderTargets| releases it.
+  static constexpr size_t kMaxFramesUnused = 3u;
+
+  struct PooledRenderTarget {
+    std::unique_ptr<EmbedderRenderTarget> target;
+    size_t frames_unused = 0u;
+  };
+
+  struct SizeHash {
+    constexpr std::size_t operator()(const SkISize& size) const {
+      return fml::HashCombine(size.width(), size.height());
+    }
+  };
+
+  using CachedRenderTargets = std::unordered_map<SkISize,
+                                                 std::vector<PooledRenderTarget>,
+                                                 SizeHash>;
 
   CachedRenderTargets cached_render_targets_;
+  size_t cached_targets_high_water_mark_ = 0u;
 
   FML_DISALLOW_COPY_AND_ASSIGN(EmbedderRenderTargetCache);
 };
@@ -49,6 +49,32 @@ bool EmbedderSurfaceGL::GLContextPresent() {
   return gl_dispatch_table_.gl_present_callback();
 }
 
+// |GPUSurfaceGLDelegate|
+bool EmbedderSurfaceGL::GLContextPresentWithDamage(const SkIRect& damage) {
+  auto callback = gl_dispatch_table_.gl_present_with_damage_callback;
+  if (!callback) {
+    return gl_dispatch_table_.gl_present_callback();
+  }
+  return callback(damage);
+}
+
+// |GPUSurfaceGLDelegate|
+bool EmbedderSurfaceGL::GLContextSupportsPartialRepaint() const {
+  // Partial repaint needs the embedder to report how stale the backbuffer is
+  // as well as forward the damage rectangle to its swap call.
+  return gl_dispatch_table_.gl_buffer_age_callback &&
+         gl_dispatch_table_.gl_present_with_damage_callback;
+}
+
+// |GPUSurfaceGLDelegate|
+int EmbedderSurfaceGL::GLContextBufferAge() const {
+  auto callback = gl_dispatch_table_.gl_buffer_age_callback;
+  if (!callback) {
+    return 0;
+  }
+  return static_cast<int>(callback());
+}
+
 // |GPUSurfaceGLDelegate|
 intptr_t EmbedderSurfaceGL::GLContextFBO() const {
   return gl_dispatch_table_.gl_fbo_callback();
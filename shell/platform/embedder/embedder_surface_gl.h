@@ -24,6 +24,9 @@ class EmbedderSurfaceGL final : public EmbedderSurface,
     std::function<SkMatrix(void)>
         gl_surface_transformation_callback;              // optional
     std::function<void*(const char*)> gl_proc_resolver;  // optional
+    std::function<uint32_t(void)> gl_buffer_age_callback;  // optional
+    std::function<bool(const SkIRect&)>
+        gl_present_with_damage_callback;  // optional
   };
 
   EmbedderSurfaceGL(
@@ -58,6 +61,15 @@ class EmbedderSurfaceGL final : public EmbedderSurface,
   // |GPUSurfaceGLDelegate|
   bool GLContextPresent() override;
 
+  // |GPUSurfaceGLDelegate|
+  bool GLContextPresentWithDamage(const SkIRect& damage) override;
+
+  // |GPUSurfaceGLDelegate|
+  bool GLContextSupportsPartialRepaint() const override;
+
+  // |GPUSurfaceGLDelegate|
+  int GLContextBufferAge() const override;
+
   // |GPUSurfaceGLDelegate|
   intptr_t GLContextFBO() const override;
 
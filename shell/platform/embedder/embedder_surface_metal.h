@@ -0,0 +1,57 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_SURFACE_METAL_H_
+#define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_SURFACE_METAL_H_
+
+#include "flutter/fml/macros.h"
+#include "flutter/shell/gpu/gpu_surface_delegate.h"
+#include "flutter/shell/platform/embedder/embedder_external_view_embedder.h"
+#include "flutter/shell/platform/embedder/embedder_surface.h"
+
+namespace flutter {
+
+// The Metal handles are passed around as opaque pointers so this header stays
+// includable from pure C++ translation units; only the implementation talks
+// to Metal.
+class EmbedderSurfaceMetal final : public EmbedderSurface,
+                                   public GPUSurfaceDelegate {
+ public:
+  struct MetalDispatchTable {
+    const void* device;                 // id<MTLDevice>, required
+    const void* present_command_queue;  // id<MTLCommandQueue>, required
+    const void* layer;                  // CAMetalLayer*, required
+  };
+
+  EmbedderSurfaceMetal(
+      MetalDispatchTable metal_dispatch_table,
+      std::unique_ptr<EmbedderExternalViewEmbedder> external_view_embedder);
+
+  ~EmbedderSurfaceMetal() override;
+
+ private:
+  bool valid_ = false;
+  MetalDispatchTable metal_dispatch_table_;
+  sk_sp<GrContext> main_context_;
+
+  std::unique_ptr<EmbedderExternalViewEmbedder> external_view_embedder_;
+
+  // |EmbedderSurface|
+  bool IsValid() const override;
+
+  // |EmbedderSurface|
+  std::unique_ptr<Surface> CreateGPUSurface() override;
+
+  // |EmbedderSurface|
+  sk_sp<GrContext> CreateResourceContext() const override;
+
+  // |GPUSurfaceDelegate|
+  ExternalViewEmbedder* GetExternalViewEmbedder() override;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(EmbedderSurfaceMetal);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_SURFACE_METAL_H_
@@ -0,0 +1,109 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/embedder/embedder_surface_metal.h"
+
+#include <Metal/Metal.h>
+#include <QuartzCore/CAMetalLayer.h>
+
+#include "flutter/fml/logging.h"
+#include "flutter/shell/common/persistent_cache.h"
+#include "flutter/shell/gpu/gpu_surface_metal.h"
+
+static_assert(!__has_feature(objc_arc), "ARC must be disabled.");
+
+namespace flutter {
+
+static GrContextOptions CreateMetalGrContextOptions() {
+  GrContextOptions options = {};
+  if (PersistentCache::cache_sksl()) {
+    options.fShaderCacheStrategy = GrContextOptions::ShaderCacheStrategy::kSkSL;
+  }
+  PersistentCache::MarkStrategySet();
+  options.fPersistentCache = PersistentCache::GetCacheForProcess();
+  return options;
+}
+
+EmbedderSurfaceMetal::EmbedderSurfaceMetal(
+    MetalDispatchTable metal_dispatch_table,
+    std::unique_ptr<EmbedderExternalViewEmbedder> external_view_embedder)
+    : metal_dispatch_table_(metal_dispatch_table),
+      external_view_embedder_(std::move(external_view_embedder)) {
+  if (metal_dispatch_table_.device == nullptr ||
+      metal_dispatch_table_.present_command_queue == nullptr ||
+      metal_dispatch_table_.layer == nullptr) {
+    return;
+  }
+
+  auto device = (id<MTLDevice>)metal_dispatch_table_.device;
+  auto command_queue = (id<MTLCommandQueue>)metal_dispatch_table_.present_command_queue;
+
+  const auto& context_options = CreateMetalGrContextOptions();
+
+  // Skia expects arguments to `MakeMetal` to transfer ownership of the
+  // references in for release later.
+  main_context_ =
+      GrContext::MakeMetal([device retain], [command_queue retain], context_options);
+
+  if (!main_context_) {
+    FML_LOG(ERROR) << "Could not create the main rendering context from the embedder supplied "
+                      "Metal device and command queue.";
+    return;
+  }
+
+  valid_ = true;
+}
+
+EmbedderSurfaceMetal::~EmbedderSurfaceMetal() = default;
+
+// |EmbedderSurface|
+bool EmbedderSurfaceMetal::IsValid() const {
+  return valid_;
+}
+
+// |EmbedderSurface|
+std::unique_ptr<Surface> EmbedderSurfaceMetal::CreateGPUSurface() {
+  if (!IsValid()) {
+    return nullptr;
+  }
+
+  fml::scoped_nsobject<CAMetalLayer> layer(
+      [(CAMetalLayer*)metal_dispatch_table_.layer retain]);
+  fml::scoped_nsprotocol<id<MTLCommandQueue>> command_queue(
+      [(id<MTLCommandQueue>)metal_dispatch_table_.present_command_queue retain]);
+
+  return std::make_unique<GPUSurfaceMetal>(this,                     // delegate
+                                           std::move(layer),         // layer
+                                           main_context_,            // context
+                                           std::move(command_queue)  // command queue
+  );
+}
+
+// |EmbedderSurface|
+sk_sp<GrContext> EmbedderSurfaceMetal::CreateResourceContext() const {
+  if (!IsValid()) {
+    return nullptr;
+  }
+
+  auto device = (id<MTLDevice>)metal_dispatch_table_.device;
+  auto command_queue = (id<MTLCommandQueue>)metal_dispatch_table_.present_command_queue;
+
+  // A second context over the same device services texture uploads on the IO
+  // thread.
+  auto context = GrContext::MakeMetal([device retain], [command_queue retain],
+                                      CreateMetalGrContextOptions());
+  if (!context) {
+    FML_LOG(ERROR) << "Could not create the Metal resource context.";
+    return nullptr;
+  }
+  context->setResourceCacheLimits(0u, 0u);
+  return context;
+}
+
+// |GPUSurfaceDelegate|
+ExternalViewEmbedder* EmbedderSurfaceMetal::GetExternalViewEmbedder() {
+  return external_view_embedder_.get();
+}
+
+}  // namespace flutter
@@ -5,6 +5,7 @@
 #include "flutter/shell/platform/embedder/embedder_surface_software.h"
 
 #include "flutter/fml/trace_event.h"
+#include "flutter/shell/platform/embedder/embedder_pixel_conversion.h"
 #include "third_party/skia/include/gpu/GrContext.h"
 
 namespace flutter {
@@ -78,6 +79,19 @@ sk_sp<SkSurface> EmbedderSurfaceSoftware::AcquireBackingStore(
 // |GPUSurfaceSoftwareDelegate|
 bool EmbedderSurfaceSoftware::PresentBackingStore(
     sk_sp<SkSurface> backing_store) {
+  // Without damage information the entire backing store counts as changed.
+  SkIRect full_damage = SkIRect::MakeEmpty();
+  if (backing_store) {
+    full_damage =
+        SkIRect::MakeWH(backing_store->width(), backing_store->height());
+  }
+  return PresentBackingStoreWithDamage(std::move(backing_store), full_damage);
+}
+
+// |GPUSurfaceSoftwareDelegate|
+bool EmbedderSurfaceSoftware::PresentBackingStoreWithDamage(
+    sk_sp<SkSurface> backing_store,
+    const SkIRect& damage) {
   if (!IsValid()) {
     FML_LOG(ERROR) << "Tried to present an invalid software surface.";
     return false;
@@ -99,10 +113,43 @@ bool EmbedderSurfaceSoftware::PresentBackingStore(
     return false;
   }
 
+  const auto pixel_format = software_dispatch_table_.pixel_format;
+
+  if (pixel_format == kFlutterSoftwarePixelFormatNative32) {
+    return software_dispatch_table_.software_present_backing_store(
+        pixmap.addr(),      //
+        pixmap.rowBytes(),  //
+        pixmap.height()     //
+    );
+  }
+
+  TRACE_EVENT0("flutter", "EmbedderSurfaceSoftware::ConvertBackingStore");
+
+  const size_t converted_row_bytes =
+      pixmap.width() * BytesPerConvertedSoftwarePixel(pixel_format);
+
+  SkIRect rows_to_convert = damage;
+  if (converted_frame_size_ != pixmap.dimensions()) {
+    // The shadow buffer does not match this frame's geometry; its contents
+    // are useless, so the full frame must be converted.
+    converted_frame_.resize(converted_row_bytes * pixmap.height());
+    converted_frame_size_ = pixmap.dimensions();
+    rows_to_convert = SkIRect::MakeWH(pixmap.width(), pixmap.height());
+  }
+
+  // Rows outside the damage region still hold the converted pixels of the
+  // previous frame and are presented as-is.
+  if (!ConvertSoftwarePixels(pixmap, rows_to_convert, pixel_format,
+                             converted_frame_.data(), converted_row_bytes)) {
+    FML_LOG(ERROR) << "Could not convert the software backing store to the "
+                      "negotiated pixel format.";
+    return false;
+  }
+
   return software_dispatch_table_.software_present_backing_store(
-      pixmap.addr(),      //
-      pixmap.rowBytes(),  //
-      pixmap.height()     //
+      converted_frame_.data(),  //
+      converted_row_bytes,      //
+      pixmap.height()           //
   );
 }
 
@@ -5,8 +5,11 @@
 #ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_SURFACE_SOFTWARE_H_
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_SURFACE_SOFTWARE_H_
 
+#include <vector>
+
 #include "flutter/fml/macros.h"
 #include "flutter/shell/gpu/gpu_surface_software.h"
+#include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/embedder/embedder_external_view_embedder.h"
 #include "flutter/shell/platform/embedder/embedder_surface.h"
 
@@ -18,6 +21,9 @@ class EmbedderSurfaceSoftware final : public EmbedderSurface,
   struct SoftwareDispatchTable {
     std::function<bool(const void* allocation, size_t row_bytes, size_t height)>
         software_present_backing_store;  // required
+    // Optional; the native 32-bit format presents frames without conversion.
+    FlutterSoftwarePixelFormat pixel_format =
+        kFlutterSoftwarePixelFormatNative32;
   };
 
   EmbedderSurfaceSoftware(
@@ -31,6 +37,11 @@ class EmbedderSurfaceSoftware final : public EmbedderSurface,
   SoftwareDispatchTable software_dispatch_table_;
   sk_sp<SkSurface> sk_surface_;
   std::unique_ptr<EmbedderExternalViewEmbedder> external_view_embedder_;
+  // Shadow buffer holding the frame converted to the negotiated pixel
+  // format. It persists across frames so presents with partial damage only
+  // re-convert the rows that changed.
+  std::vector<uint8_t> converted_frame_;
+  SkISize converted_frame_size_ = SkISize::MakeEmpty();
 
   // |EmbedderSurface|
   bool IsValid() const override;
@@ -47,6 +58,10 @@ class EmbedderSurfaceSoftware final : public EmbedderSurface,
   // |GPUSurfaceSoftwareDelegate|
   bool PresentBackingStore(sk_sp<SkSurface> backing_store) override;
 
+  // |GPUSurfaceSoftwareDelegate|
+  bool PresentBackingStoreWithDamage(sk_sp<SkSurface> backing_store,
+                                     const SkIRect& damage) override;
+
   // |GPUSurfaceSoftwareDelegate|
   ExternalViewEmbedder* GetExternalViewEmbedder() override;
 
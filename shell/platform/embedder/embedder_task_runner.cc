@@ -16,7 +16,8 @@ EmbedderTaskRunner::EmbedderTaskRunner(DispatchTable table,
       dispatch_table_(std::move(table)),
       placeholder_id_(
           fml::MessageLoopTaskQueues::GetInstance()->CreateTaskQueue()) {
-  FML_DCHECK(dispatch_table_.post_task_callback);
+  FML_DCHECK(dispatch_table_.post_task_callback ||
+             dispatch_table_.post_task_batch_callback);
   FML_DCHECK(dispatch_table_.runs_task_on_current_thread_callback);
 }
 
@@ -45,9 +46,53 @@ void EmbedderTaskRunner::PostTaskForTime(const fml::closure& task,
     pending_tasks_[baton] = task;
   }
 
+  if (dispatch_table_.post_task_batch_callback) {
+    PostTaskBatched(baton, target_time);
+    return;
+  }
+
   dispatch_table_.post_task_callback(this, baton, target_time);
 }
 
+void EmbedderTaskRunner::PostTaskBatched(uint64_t baton,
+                                         fml::TimePoint target_time) {
+  const auto now = fml::TimePoint::Now();
+  std::vector<uint64_t> due_batons;
+  fml::TimePoint next_target_time = fml::TimePoint::Max();
+
+  {
+    std::scoped_lock lock(tasks_mutex_);
+    if (target_time > now) {
+      const bool deadline_moved_up =
+          deferred_tasks_.empty() ||
+          target_time < deferred_tasks_.begin()->first;
+      deferred_tasks_.emplace(target_time, baton);
+      if (!deadline_moved_up) {
+        // The embedder already has a wakeup scheduled at an earlier deadline
+        // and this task will be swept up by the batch collected then. This is
+        // where the per-task wakeups of the unbatched contract are elided.
+        return;
+      }
+    } else {
+      // Deliver the new task along with any retained tasks that have become
+      // due in the meantime so they all ride on a single embedder wakeup.
+      due_batons.push_back(baton);
+      auto due_end = deferred_tasks_.upper_bound(now);
+      for (auto it = deferred_tasks_.begin(); it != due_end; it++) {
+        due_batons.push_back(it->second);
+      }
+      deferred_tasks_.erase(deferred_tasks_.begin(), due_end);
+    }
+    if (!deferred_tasks_.empty()) {
+      next_target_time = deferred_tasks_.begin()->first;
+    }
+
+    // Release the lock before the jump via the dispatch table.
+  }
+
+  dispatch_table_.post_task_batch_callback(this, due_batons, next_target_time);
+}
+
 void EmbedderTaskRunner::PostDelayedTask(const fml::closure& task,
                                          fml::TimeDelta delay) {
   PostTaskForTime(task, fml::TimePoint::Now() + delay);
@@ -78,6 +123,40 @@ bool EmbedderTaskRunner::PostTask(uint64_t baton) {
   return true;
 }
 
+bool EmbedderTaskRunner::RunTaskBatch(const std::vector<uint64_t>& batons,
+                                      fml::TimePoint& next_target_time) {
+  for (uint64_t baton : batons) {
+    if (!PostTask(baton)) {
+      return false;
+    }
+  }
+
+  // Sweep up retained tasks that have become due since the batch was
+  // delivered. The deadline is re-evaluated each iteration because the tasks
+  // themselves may post more work on this runner.
+  while (true) {
+    fml::closure task;
+    {
+      std::scoped_lock lock(tasks_mutex_);
+      const auto now = fml::TimePoint::Now();
+      if (deferred_tasks_.empty() || deferred_tasks_.begin()->first > now) {
+        next_target_time = deferred_tasks_.empty()
+                               ? fml::TimePoint::Max()
+                               : deferred_tasks_.begin()->first;
+        return true;
+      }
+      auto found = pending_tasks_.find(deferred_tasks_.begin()->second);
+      FML_DCHECK(found != pending_tasks_.end());
+      task = found->second;
+      pending_tasks_.erase(found);
+      deferred_tasks_.erase(deferred_tasks_.begin());
+
+      // Let go of the tasks mutex before executing the task.
+    }
+    task();
+  }
+}
+
 // |fml::TaskRunner|
 fml::TaskQueueId EmbedderTaskRunner::GetTaskQueueId() {
   return placeholder_id_;
@@ -5,8 +5,10 @@
 #ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_TASK_RUNNER_H_
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_TASK_RUNNER_H_
 
+#include <map>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/macros.h"
 #include "flutter/fml/task_runner.h"
@@ -39,6 +41,19 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
     /// thread.
     ///
     std::function<bool(void)> runs_task_on_current_thread_callback;
+    //--------------------------------------------------------------------------
+    /// Optional. When set, takes precedence over `post_task_callback` (which
+    /// may then be left unset). Tasks that are already due are delivered as a
+    /// batch of batons; tasks that are not yet due are retained by the runner
+    /// and only their earliest target time is reported (`fml::TimePoint::Max`
+    /// when there is none). The embedder runs a delivered batch with a single
+    /// `EmbedderTaskRunner::RunTaskBatch` call on the correct thread, which
+    /// also sweeps up retained tasks that have become due in the interim.
+    ///
+    std::function<void(EmbedderTaskRunner* task_runner,
+                       const std::vector<uint64_t>& due_batons,
+                       fml::TimePoint next_target_time)>
+        post_task_batch_callback;
   };
 
   //----------------------------------------------------------------------------
@@ -71,14 +86,36 @@ class EmbedderTaskRunner final : public fml::TaskRunner {
 
   bool PostTask(uint64_t baton);
 
+  //----------------------------------------------------------------------------
+  /// @brief      Runs a batch of due tasks previously delivered via the
+  ///             `post_task_batch_callback`, in the order supplied, and then
+  ///             any retained tasks whose target times have since expired, in
+  ///             target time order. Must be called on the thread serviced by
+  ///             this runner. The batch may be empty; this is how the
+  ///             embedder collects retained tasks after waking up for a
+  ///             previously reported target time.
+  ///
+  /// @param[in]  batons            The batons of the delivered due tasks.
+  /// @param[out] next_target_time  The target time of the earliest task still
+  ///                               retained by the runner, or
+  ///                               `fml::TimePoint::Max` if there is none.
+  ///
+  /// @return     If all supplied batons named known pending tasks.
+  ///
+  bool RunTaskBatch(const std::vector<uint64_t>& batons,
+                    fml::TimePoint& next_target_time);
+
  private:
   const size_t embedder_identifier_;
   DispatchTable dispatch_table_;
   std::mutex tasks_mutex_;
   uint64_t last_baton_;
   std::unordered_map<uint64_t, fml::closure> pending_tasks_;
+  std::multimap<fml::TimePoint, uint64_t> deferred_tasks_;
   fml::TaskQueueId placeholder_id_;
 
+  void PostTaskBatched(uint64_t baton, fml::TimePoint target_time);
+
   // |fml::TaskRunner|
   void PostTask(const fml::closure& task) override;
 
@@ -42,37 +42,75 @@ CreateEmbedderTaskRunner(const FlutterTaskRunnerDescription* description) {
     return {false, {}};
   }
 
-  if (SAFE_ACCESS(description, post_task_callback, nullptr) == nullptr) {
-    FML_LOG(ERROR)
-        << "FlutterTaskRunnerDescription.post_task_callback was nullptr.";
+  auto post_task_callback_c =
+      SAFE_ACCESS(description, post_task_callback, nullptr);
+  auto post_task_batch_callback_c =
+      SAFE_ACCESS(description, post_task_batch_callback, nullptr);
+
+  if (post_task_callback_c == nullptr &&
+      post_task_batch_callback_c == nullptr) {
+    FML_LOG(ERROR) << "Neither FlutterTaskRunnerDescription.post_task_callback "
+                      "nor post_task_batch_callback was set.";
     return {false, {}};
   }
 
   auto user_data = SAFE_ACCESS(description, user_data, nullptr);
 
   // ABI safety checks have been completed.
-  auto post_task_callback_c = description->post_task_callback;
   auto runs_task_on_current_thread_callback_c =
       description->runs_task_on_current_thread_callback;
 
-  EmbedderTaskRunner::DispatchTable task_runner_dispatch_table = {
-      // .post_task_callback
-      [post_task_callback_c, user_data](EmbedderTaskRunner* task_runner,
-                                        uint64_t task_baton,
-                                        fml::TimePoint target_time) -> void {
-        FlutterTask task = {
+  EmbedderTaskRunner::DispatchTable task_runner_dispatch_table;
+
+  if (post_task_callback_c != nullptr) {
+    task_runner_dispatch_table.post_task_callback =
+        [post_task_callback_c, user_data](EmbedderTaskRunner* task_runner,
+                                          uint64_t task_baton,
+                                          fml::TimePoint target_time) -> void {
+      FlutterTask task = {
+          // runner
+          reinterpret_cast<FlutterTaskRunner>(task_runner),
+          // task
+          task_baton,
+      };
+      post_task_callback_c(task, target_time.ToEpochDelta().ToNanoseconds(),
+                           user_data);
+    };
+  }
+
+  task_runner_dispatch_table.runs_task_on_current_thread_callback =
+      [runs_task_on_current_thread_callback_c, user_data]() -> bool {
+        return runs_task_on_current_thread_callback_c(user_data);
+      };
+
+  if (post_task_batch_callback_c != nullptr) {
+    task_runner_dispatch_table.post_task_batch_callback =
+        [post_task_batch_callback_c, user_data](
+            EmbedderTaskRunner* task_runner,
+            const std::vector<uint64_t>& due_batons,
+            fml::TimePoint next_target_time) -> void {
+      std::vector<FlutterTask> tasks;
+      tasks.reserve(due_batons.size());
+      for (uint64_t task_baton : due_batons) {
+        tasks.push_back({
             // runner
             reinterpret_cast<FlutterTaskRunner>(task_runner),
             // task
             task_baton,
-        };
-        post_task_callback_c(task, target_time.ToEpochDelta().ToNanoseconds(),
-                             user_data);
-      },
-      // runs_task_on_current_thread_callback
-      [runs_task_on_current_thread_callback_c, user_data]() -> bool {
-        return runs_task_on_current_thread_callback_c(user_data);
-      }};
+        });
+      }
+      FlutterTaskBatch batch = {};
+      batch.struct_size = sizeof(FlutterTaskBatch);
+      batch.runner = reinterpret_cast<FlutterTaskRunner>(task_runner);
+      batch.tasks = tasks.data();
+      batch.tasks_count = tasks.size();
+      batch.next_target_time_nanos =
+          next_target_time == fml::TimePoint::Max()
+              ? 0
+              : next_target_time.ToEpochDelta().ToNanoseconds();
+      post_task_batch_callback_c(&batch, user_data);
+    };
+  }
 
   return {true, fml::MakeRefCounted<EmbedderTaskRunner>(
                     task_runner_dispatch_table,
@@ -137,6 +175,56 @@ EmbedderThreadHost::CreateEmbedderManagedThreadHost(
     return nullptr;
   }
 
+  // Fully merged single-threaded configuration: all engine components run on
+  // the embedder supplied platform task runner and no engine threads are
+  // created at all.
+  if (SAFE_ACCESS(custom_task_runners, merge_all_task_runners, false)) {
+    if (!platform_task_runner_pair.second) {
+      FML_LOG(ERROR) << "FlutterCustomTaskRunners.merge_all_task_runners "
+                        "requires a platform task runner.";
+      return nullptr;
+    }
+    if (render_task_runner_pair.second &&
+        render_task_runner_pair.second->GetEmbedderIdentifier() !=
+            platform_task_runner_pair.second->GetEmbedderIdentifier()) {
+      FML_LOG(ERROR) << "FlutterCustomTaskRunners.merge_all_task_runners "
+                        "requires the render task runner (if specified) to "
+                        "share the platform task runner identifier.";
+      return nullptr;
+    }
+
+    auto merged_task_runner = static_cast<fml::RefPtr<fml::TaskRunner>>(
+        platform_task_runner_pair.second);
+
+    // Since all four task runner identities alias the one embedder runner,
+    // RunsTasksOnCurrentThread is true for every component on the common
+    // thread and cross-component dispatch via |fml::TaskRunner|
+    // RunNowOrPostTask becomes a direct call with no queue round-trip.
+    flutter::TaskRunners task_runners(kFlutterThreadName,
+                                      merged_task_runner,  // platform
+                                      merged_task_runner,  // raster
+                                      merged_task_runner,  // ui
+                                      merged_task_runner   // io
+    );
+
+    if (!task_runners.IsValid()) {
+      return nullptr;
+    }
+
+    std::set<fml::RefPtr<EmbedderTaskRunner>> embedder_task_runners;
+    embedder_task_runners.insert(platform_task_runner_pair.second);
+
+    auto embedder_host = std::make_unique<EmbedderThreadHost>(
+        ThreadHost(), std::move(task_runners),
+        std::move(embedder_task_runners));
+
+    if (embedder_host->IsValid()) {
+      return embedder_host;
+    }
+
+    return nullptr;
+  }
+
   // If the embedder has not supplied a GPU task runner, one needs to be
   // created.
   if (!render_task_runner_pair.second) {
@@ -270,4 +358,24 @@ bool EmbedderThreadHost::PostTask(int64_t runner, uint64_t task) const {
   return found->second->PostTask(task);
 }
 
+bool EmbedderThreadHost::RunTaskBatch(int64_t runner,
+                                      const std::vector<uint64_t>& tasks,
+                                      uint64_t* next_target_time_nanos) const {
+  auto found = runners_map_.find(runner);
+  if (found == runners_map_.end()) {
+    return false;
+  }
+  auto next_target_time = fml::TimePoint::Max();
+  if (!found->second->RunTaskBatch(tasks, next_target_time)) {
+    return false;
+  }
+  if (next_target_time_nanos != nullptr) {
+    *next_target_time_nanos =
+        next_target_time == fml::TimePoint::Max()
+            ? 0
+            : next_target_time.ToEpochDelta().ToNanoseconds();
+  }
+  return true;
+}
+
 }  // namespace flutter
@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/macros.h"
@@ -36,6 +37,10 @@ class EmbedderThreadHost {
 
   bool PostTask(int64_t runner, uint64_t task) const;
 
+  bool RunTaskBatch(int64_t runner,
+                    const std::vector<uint64_t>& tasks,
+                    uint64_t* next_target_time_nanos) const;
+
  private:
   ThreadHost host_;
   flutter::TaskRunners runners_;
@@ -18,7 +18,9 @@ PlatformViewEmbedder::PlatformViewEmbedder(
           gl_dispatch_table,
           fbo_reset_after_present,
           std::move(external_view_embedder))),
-      platform_dispatch_table_(platform_dispatch_table) {}
+      platform_dispatch_table_(platform_dispatch_table),
+      vsync_schedule_(
+          std::make_shared<VsyncWaiterEmbedder::VsyncSchedule>()) {}
 
 PlatformViewEmbedder::PlatformViewEmbedder(
     PlatformView::Delegate& delegate,
@@ -30,7 +32,25 @@ PlatformViewEmbedder::PlatformViewEmbedder(
       embedder_surface_(std::make_unique<EmbedderSurfaceSoftware>(
           software_dispatch_table,
           std::move(external_view_embedder))),
-      platform_dispatch_table_(platform_dispatch_table) {}
+      platform_dispatch_table_(platform_dispatch_table),
+      vsync_schedule_(
+          std::make_shared<VsyncWaiterEmbedder::VsyncSchedule>()) {}
+
+#ifdef FLUTTER_SHELL_ENABLE_METAL
+PlatformViewEmbedder::PlatformViewEmbedder(
+    PlatformView::Delegate& delegate,
+    flutter::TaskRunners task_runners,
+    EmbedderSurfaceMetal::MetalDispatchTable metal_dispatch_table,
+    PlatformDispatchTable platform_dispatch_table,
+    std::unique_ptr<EmbedderExternalViewEmbedder> external_view_embedder)
+    : PlatformView(delegate, std::move(task_runners)),
+      embedder_surface_(std::make_unique<EmbedderSurfaceMetal>(
+          metal_dispatch_table,
+          std::move(external_view_embedder))),
+      platform_dispatch_table_(platform_dispatch_table),
+      vsync_schedule_(
+          std::make_shared<VsyncWaiterEmbedder::VsyncSchedule>()) {}
+#endif
 
 PlatformViewEmbedder::~PlatformViewEmbedder() = default;
 
@@ -64,6 +84,11 @@ void PlatformViewEmbedder::HandlePlatformMessage(
       std::move(message));
 }
 
+void PlatformViewEmbedder::SetVsyncSchedule(fml::TimePoint phase,
+                                            fml::TimeDelta interval) {
+  vsync_schedule_->Update(phase, interval);
+}
+
 // |PlatformView|
 std::unique_ptr<Surface> PlatformViewEmbedder::CreateRenderingSurface() {
   if (embedder_surface_ == nullptr) {
@@ -90,7 +115,7 @@ std::unique_ptr<VsyncWaiter> PlatformViewEmbedder::CreateVSyncWaiter() {
   }
 
   return std::make_unique<VsyncWaiterEmbedder>(
-      platform_dispatch_table_.vsync_callback, task_runners_);
+      platform_dispatch_table_.vsync_callback, vsync_schedule_, task_runners_);
 }
 
 }  // namespace flutter
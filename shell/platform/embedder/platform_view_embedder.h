@@ -13,6 +13,9 @@
 #include "flutter/shell/platform/embedder/embedder_surface.h"
 #include "flutter/shell/platform/embedder/embedder_surface_gl.h"
 #include "flutter/shell/platform/embedder/embedder_surface_software.h"
+#ifdef FLUTTER_SHELL_ENABLE_METAL
+#include "flutter/shell/platform/embedder/embedder_surface_metal.h"
+#endif
 #include "flutter/shell/platform/embedder/vsync_waiter_embedder.h"
 
 namespace flutter {
@@ -52,6 +55,16 @@ class PlatformViewEmbedder final : public PlatformView {
       PlatformDispatchTable platform_dispatch_table,
       std::unique_ptr<EmbedderExternalViewEmbedder> external_view_embedder);
 
+#ifdef FLUTTER_SHELL_ENABLE_METAL
+  // Creates a platform view that sets up a Metal rasterizer.
+  PlatformViewEmbedder(
+      PlatformView::Delegate& delegate,
+      flutter::TaskRunners task_runners,
+      EmbedderSurfaceMetal::MetalDispatchTable metal_dispatch_table,
+      PlatformDispatchTable platform_dispatch_table,
+      std::unique_ptr<EmbedderExternalViewEmbedder> external_view_embedder);
+#endif
+
   ~PlatformViewEmbedder() override;
 
   // |PlatformView|
@@ -63,9 +76,17 @@ class PlatformViewEmbedder final : public PlatformView {
   void HandlePlatformMessage(
       fml::RefPtr<flutter::PlatformMessage> message) override;
 
+  // Publishes a standing (phase, interval) vsync schedule. While a schedule
+  // is in effect, the engine computes frame times from its monotonic clock
+  // and does not invoke the vsync callback. An interval of zero clears the
+  // schedule. Has no effect unless a vsync callback was specified. Must be
+  // called on the platform task runner.
+  void SetVsyncSchedule(fml::TimePoint phase, fml::TimeDelta interval);
+
  private:
   std::unique_ptr<EmbedderSurface> embedder_surface_;
   PlatformDispatchTable platform_dispatch_table_;
+  std::shared_ptr<VsyncWaiterEmbedder::VsyncSchedule> vsync_schedule_;
 
   // |PlatformView|
   std::unique_ptr<Surface> CreateRenderingSurface() override;
@@ -193,6 +193,12 @@ void EmbedderConfigBuilder::SetRenderTaskRunner(
   project_args_.custom_task_runners = &custom_task_runners_;
 }
 
+void EmbedderConfigBuilder::SetMergeAllTaskRunners(
+    bool merge_all_task_runners) {
+  custom_task_runners_.merge_all_task_runners = merge_all_task_runners;
+  project_args_.custom_task_runners = &custom_task_runners_;
+}
+
 void EmbedderConfigBuilder::SetPlatformMessageCallback(
     const std::function<void(const FlutterPlatformMessage*)>& callback) {
   context_.SetPlatformMessageCallback(callback);
@@ -67,6 +67,8 @@ class EmbedderConfigBuilder {
 
   void SetRenderTaskRunner(const FlutterTaskRunnerDescription* runner);
 
+  void SetMergeAllTaskRunners(bool merge_all_task_runners);
+
   void SetPlatformMessageCallback(
       const std::function<void(const FlutterPlatformMessage*)>& callback);
 
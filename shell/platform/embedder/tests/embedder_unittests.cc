@@ -4,6 +4,7 @@
 
 #define FML_USED_ON_EMBEDDER
 
+#include <cstring>
 #include <string>
 
 #include "embedder.h"
@@ -18,6 +19,7 @@
 #include "flutter/fml/synchronization/waitable_event.h"
 #include "flutter/fml/thread.h"
 #include "flutter/runtime/dart_vm.h"
+#include "flutter/shell/platform/embedder/embedder_pixel_conversion.h"
 #include "flutter/shell/platform/embedder/tests/embedder_assertions.h"
 #include "flutter/shell/platform/embedder/tests/embedder_config_builder.h"
 #include "flutter/shell/platform/embedder/tests/embedder_test.h"
@@ -237,6 +239,176 @@ TEST_F(EmbedderTest, CanSpecifyCustomPlatformTaskRunner) {
   signaled_once = false;
 }
 
+TEST_F(EmbedderTest, CanSpecifyCustomPlatformTaskRunnerWithBatchedPosting) {
+  auto& context = GetEmbedderContext();
+  fml::AutoResetWaitableEvent latch;
+
+  // Run the test on its own thread with a message loop so that it can safely
+  // pump its event loop while we wait for all the conditions to be checked.
+  auto platform_task_runner = CreateNewThread("test_platform_thread");
+  static std::mutex engine_mutex;
+  static bool batch_signaled_once = false;
+  UniqueEngine engine;
+
+  // The state threaded through the C callback of the batched task runner
+  // contract. Batches are bounced onto the real platform task runner and run
+  // with a single `FlutterEngineRunTaskBatch` call each.
+  struct BatchedTaskRunnerCaptures {
+    fml::RefPtr<fml::TaskRunner> real_task_runner;
+    std::function<void(std::vector<FlutterTask>, FlutterTaskRunner)> run_batch;
+  };
+  BatchedTaskRunnerCaptures captures;
+  captures.real_task_runner = platform_task_runner;
+  captures.run_batch = [&](std::vector<FlutterTask> tasks,
+                           FlutterTaskRunner runner) {
+    std::scoped_lock lock(engine_mutex);
+    if (!engine.is_valid()) {
+      return;
+    }
+    FlutterTaskBatch batch = {};
+    batch.struct_size = sizeof(FlutterTaskBatch);
+    batch.runner = runner;
+    batch.tasks = tasks.data();
+    batch.tasks_count = tasks.size();
+    uint64_t next_target_time_nanos = 0;
+    ASSERT_EQ(FlutterEngineRunTaskBatch(engine.get(), &batch,
+                                        &next_target_time_nanos),
+              kSuccess);
+    if (!batch_signaled_once && tasks.size() > 0u) {
+      batch_signaled_once = true;
+      latch.Signal();
+    }
+  };
+
+  FlutterTaskRunnerDescription description = {};
+  description.struct_size = sizeof(FlutterTaskRunnerDescription);
+  description.user_data = &captures;
+  description.runs_task_on_current_thread_callback =
+      [](void* user_data) -> bool {
+    return reinterpret_cast<BatchedTaskRunnerCaptures*>(user_data)
+        ->real_task_runner->RunsTasksOnCurrentThread();
+  };
+  // Out of the range handed out by `EmbedderTestTaskRunner` so the engine
+  // never considers this runner equal to one from another test.
+  description.identifier = 1 << 20;
+  description.post_task_batch_callback = [](const FlutterTaskBatch* batch,
+                                            void* user_data) -> void {
+    auto captures = reinterpret_cast<BatchedTaskRunnerCaptures*>(user_data);
+    std::vector<FlutterTask> tasks(batch->tasks,
+                                   batch->tasks + batch->tasks_count);
+    auto runner = batch->runner;
+    auto run_batch = captures->run_batch;
+    if (tasks.size() > 0u) {
+      captures->real_task_runner->PostTask(
+          [run_batch, tasks, runner]() { run_batch(tasks, runner); });
+    }
+    if (batch->next_target_time_nanos != 0) {
+      // One wakeup for the retained deadline; an empty batch collects the
+      // tasks that have become due by then.
+      auto target_time = fml::TimePoint::FromEpochDelta(
+          fml::TimeDelta::FromNanoseconds(batch->next_target_time_nanos));
+      captures->real_task_runner->PostTaskForTime(
+          [run_batch, runner]() { run_batch({}, runner); }, target_time);
+    }
+  };
+
+  platform_task_runner->PostTask([&]() {
+    EmbedderConfigBuilder builder(context);
+    builder.SetSoftwareRendererConfig();
+    builder.SetPlatformTaskRunner(&description);
+    builder.SetDartEntrypoint("invokePlatformTaskRunner");
+    std::scoped_lock lock(engine_mutex);
+    engine = builder.LaunchEngine();
+    ASSERT_TRUE(engine.is_valid());
+  });
+
+  // Signaled when a non-empty batch has been run.
+  latch.Wait();
+  ASSERT_TRUE(engine.is_valid());
+
+  // Since the engine was started on its own thread, it must be killed there as
+  // well.
+  fml::AutoResetWaitableEvent kill_latch;
+  platform_task_runner->PostTask(fml::MakeCopyable([&]() mutable {
+    std::scoped_lock lock(engine_mutex);
+    engine.reset();
+
+    // There may still be pending tasks on the platform thread that were queued
+    // by the batched task runner. Signal the latch after these tasks have been
+    // consumed.
+    platform_task_runner->PostTask([&kill_latch] { kill_latch.Signal(); });
+  }));
+  kill_latch.Wait();
+
+  ASSERT_TRUE(batch_signaled_once);
+  batch_signaled_once = false;
+}
+
+TEST_F(EmbedderTest, CanRunWithMergedTaskRunners) {
+  auto& context = GetEmbedderContext();
+  fml::AutoResetWaitableEvent latch;
+
+  // All engine components (platform, UI, raster and IO) service this single
+  // task runner when the merged configuration is requested.
+  auto merged_task_runner = CreateNewThread("test_merged_thread");
+  static std::mutex engine_mutex;
+  static bool merged_signaled_once = false;
+  UniqueEngine engine;
+
+  EmbedderTestTaskRunner test_task_runner(
+      merged_task_runner, [&](FlutterTask task) {
+        std::scoped_lock lock(engine_mutex);
+        if (!engine.is_valid()) {
+          return;
+        }
+        // There may be multiple tasks posted but we only need to check
+        // assertions once.
+        if (merged_signaled_once) {
+          FlutterEngineRunTask(engine.get(), &task);
+          return;
+        }
+
+        merged_signaled_once = true;
+        ASSERT_TRUE(engine.is_valid());
+        ASSERT_EQ(FlutterEngineRunTask(engine.get(), &task), kSuccess);
+        latch.Signal();
+      });
+
+  merged_task_runner->PostTask([&]() {
+    EmbedderConfigBuilder builder(context);
+    const auto task_runner_description =
+        test_task_runner.GetFlutterTaskRunnerDescription();
+    builder.SetSoftwareRendererConfig();
+    builder.SetPlatformTaskRunner(&task_runner_description);
+    builder.SetMergeAllTaskRunners(true);
+    builder.SetDartEntrypoint("invokePlatformTaskRunner");
+    std::scoped_lock lock(engine_mutex);
+    engine = builder.LaunchEngine();
+    ASSERT_TRUE(engine.is_valid());
+  });
+
+  // Signaled when all the assertions are checked.
+  latch.Wait();
+  ASSERT_TRUE(engine.is_valid());
+
+  // Since the engine was started on its own thread, it must be killed there as
+  // well.
+  fml::AutoResetWaitableEvent kill_latch;
+  merged_task_runner->PostTask(fml::MakeCopyable([&]() mutable {
+    std::scoped_lock lock(engine_mutex);
+    engine.reset();
+
+    // There may still be pending tasks on the merged thread that were queued
+    // by the test_task_runner. Signal the latch after these tasks have been
+    // consumed.
+    merged_task_runner->PostTask([&kill_latch] { kill_latch.Signal(); });
+  }));
+  kill_latch.Wait();
+
+  ASSERT_TRUE(merged_signaled_once);
+  merged_signaled_once = false;
+}
+
 TEST(EmbedderTestNoFixture, CanGetCurrentTimeInNanoseconds) {
   auto point1 = fml::TimePoint::FromEpochDelta(
       fml::TimeDelta::FromNanoseconds(FlutterEngineGetCurrentTime()));
@@ -245,6 +417,81 @@ TEST(EmbedderTestNoFixture, CanGetCurrentTimeInNanoseconds) {
   ASSERT_LT((point2 - point1), fml::TimeDelta::FromMilliseconds(1));
 }
 
+TEST(EmbedderTestNoFixture, ConvertsSoftwarePixelsToBGRA) {
+  // A width that is not a multiple of any vector lane count exercises both
+  // the SIMD body and the scalar tail of the kernel.
+  constexpr int width = 19;
+  constexpr int height = 2;
+  std::vector<uint8_t> source_pixels(width * height * 4);
+  for (size_t i = 0; i < source_pixels.size(); i++) {
+    source_pixels[i] = static_cast<uint8_t>(i * 7u);
+  }
+  SkPixmap source(SkImageInfo::Make(width, height, kRGBA_8888_SkColorType,
+                                    kPremul_SkAlphaType),
+                  source_pixels.data(), width * 4);
+
+  std::vector<uint8_t> converted(width * height * 4);
+  ASSERT_TRUE(ConvertSoftwarePixels(source, SkIRect::MakeWH(width, height),
+                                    kFlutterSoftwarePixelFormatBGRA8888,
+                                    converted.data(), width * 4));
+
+  for (int i = 0; i < width * height; i++) {
+    ASSERT_EQ(converted[i * 4 + 0], source_pixels[i * 4 + 2]);
+    ASSERT_EQ(converted[i * 4 + 1], source_pixels[i * 4 + 1]);
+    ASSERT_EQ(converted[i * 4 + 2], source_pixels[i * 4 + 0]);
+    ASSERT_EQ(converted[i * 4 + 3], source_pixels[i * 4 + 3]);
+  }
+}
+
+TEST(EmbedderTestNoFixture, ConvertsSoftwarePixelsToRGB565) {
+  constexpr int width = 9;
+  const uint8_t primaries[4][4] = {
+      {0xFF, 0x00, 0x00, 0xFF},  // red
+      {0x00, 0xFF, 0x00, 0xFF},  // green
+      {0x00, 0x00, 0xFF, 0xFF},  // blue
+      {0x88, 0x44, 0x22, 0xFF},  // mixed
+  };
+  const uint16_t expected[4] = {0xF800, 0x07E0, 0x001F, 0x8A24};
+
+  std::vector<uint8_t> source_pixels(width * 4);
+  for (int x = 0; x < width; x++) {
+    std::memcpy(&source_pixels[x * 4], primaries[x % 4], 4);
+  }
+  SkPixmap source(
+      SkImageInfo::Make(width, 1, kRGBA_8888_SkColorType, kPremul_SkAlphaType),
+      source_pixels.data(), width * 4);
+
+  std::vector<uint16_t> converted(width);
+  ASSERT_TRUE(ConvertSoftwarePixels(
+      source, SkIRect::MakeWH(width, 1), kFlutterSoftwarePixelFormatRGB565,
+      reinterpret_cast<uint8_t*>(converted.data()), width * 2));
+
+  for (int x = 0; x < width; x++) {
+    ASSERT_EQ(converted[x], expected[x % 4]) << "at column " << x;
+  }
+}
+
+TEST(EmbedderTestNoFixture, SoftwarePixelConversionHonorsDamage) {
+  constexpr int width = 4;
+  constexpr int height = 3;
+  std::vector<uint8_t> source_pixels(width * height * 4, 0x55);
+  SkPixmap source(SkImageInfo::Make(width, height, kRGBA_8888_SkColorType,
+                                    kPremul_SkAlphaType),
+                  source_pixels.data(), width * 4);
+
+  // Rows outside the damage region must keep their previous contents.
+  std::vector<uint8_t> converted(width * height * 4, 0xAB);
+  ASSERT_TRUE(ConvertSoftwarePixels(source, SkIRect::MakeLTRB(0, 1, width, 2),
+                                    kFlutterSoftwarePixelFormatBGRA8888,
+                                    converted.data(), width * 4));
+
+  for (int i = 0; i < width * 4; i++) {
+    ASSERT_EQ(converted[i], 0xAB);
+    ASSERT_EQ(converted[width * 4 + i], 0x55);
+    ASSERT_EQ(converted[width * 8 + i], 0xAB);
+  }
+}
+
 TEST_F(EmbedderTest, CanReloadSystemFonts) {
   auto& context = GetEmbedderContext();
   EmbedderConfigBuilder builder(context);
@@ -4292,6 +4539,32 @@ TEST_F(EmbedderTest, CanCreateAndCollectAValidElfSource) {
   ASSERT_EQ(FlutterEngineCollectAOTData(data_out), kSuccess);
 }
 
+TEST_F(EmbedderTest, AOTDataIsSharedAcrossCreateCalls) {
+  if (!DartVM::IsRunningPrecompiledCode()) {
+    GTEST_SKIP();
+    return;
+  }
+  FlutterEngineAOTDataSource data_in = {};
+  FlutterEngineAOTData first_data_out = nullptr;
+  FlutterEngineAOTData second_data_out = nullptr;
+
+  const auto elf_path =
+      fml::paths::JoinPaths({GetFixturesPath(), kAOTAppELFFileName});
+
+  data_in.type = kFlutterEngineAOTDataSourceTypeElfPath;
+  data_in.elf_path = elf_path.c_str();
+
+  // The second create call for the same source must hand out a reference to
+  // the already loaded snapshot rather than mapping the library again.
+  ASSERT_EQ(FlutterEngineCreateAOTData(&data_in, &first_data_out), kSuccess);
+  ASSERT_EQ(FlutterEngineCreateAOTData(&data_in, &second_data_out), kSuccess);
+  ASSERT_EQ(first_data_out, second_data_out);
+
+  // Each create call must be balanced by its own collect call.
+  ASSERT_EQ(FlutterEngineCollectAOTData(first_data_out), kSuccess);
+  ASSERT_EQ(FlutterEngineCollectAOTData(second_data_out), kSuccess);
+}
+
 TEST_F(EmbedderTest, CanLaunchAndShutdownWithAValidElfSource) {
   if (!DartVM::IsRunningPrecompiledCode()) {
     GTEST_SKIP();
@@ -6,9 +6,46 @@
 
 namespace flutter {
 
-VsyncWaiterEmbedder::VsyncWaiterEmbedder(const VsyncCallback& vsync_callback,
-                                         flutter::TaskRunners task_runners)
-    : VsyncWaiter(std::move(task_runners)), vsync_callback_(vsync_callback) {
+VsyncWaiterEmbedder::VsyncSchedule::VsyncSchedule() = default;
+
+VsyncWaiterEmbedder::VsyncSchedule::~VsyncSchedule() = default;
+
+void VsyncWaiterEmbedder::VsyncSchedule::Update(fml::TimePoint phase,
+                                               fml::TimeDelta interval) {
+  std::scoped_lock lock(mutex_);
+  phase_ = phase;
+  interval_ = interval;
+}
+
+bool VsyncWaiterEmbedder::VsyncSchedule::Get(fml::TimePoint* phase,
+                                             fml::TimeDelta* interval) const {
+  std::scoped_lock lock(mutex_);
+  if (interval_ == fml::TimeDelta::Zero()) {
+    return false;
+  }
+  *phase = phase_;
+  *interval = interval_;
+  return true;
+}
+
+// Advances the value to the next schedule tick at or after it.
+static fml::TimePoint SnapToNextTick(fml::TimePoint value,
+                                     fml::TimePoint tick_phase,
+                                     fml::TimeDelta tick_interval) {
+  fml::TimeDelta offset = (tick_phase - value) % tick_interval;
+  if (offset != fml::TimeDelta::Zero()) {
+    offset = offset + tick_interval;
+  }
+  return value + offset;
+}
+
+VsyncWaiterEmbedder::VsyncWaiterEmbedder(
+    const VsyncCallback& vsync_callback,
+    std::shared_ptr<VsyncSchedule> vsync_schedule,
+    flutter::TaskRunners task_runners)
+    : VsyncWaiter(std::move(task_runners)),
+      vsync_callback_(vsync_callback),
+      vsync_schedule_(std::move(vsync_schedule)) {
   FML_DCHECK(vsync_callback_);
 }
 
@@ -16,6 +53,17 @@ VsyncWaiterEmbedder::~VsyncWaiterEmbedder() = default;
 
 // |VsyncWaiter|
 void VsyncWaiterEmbedder::AwaitVSync() {
+  fml::TimePoint phase;
+  fml::TimeDelta interval;
+  if (vsync_schedule_ && vsync_schedule_->Get(&phase, &interval)) {
+    // The embedder has published a standing schedule. Self-schedule from the
+    // monotonic clock instead of bouncing a baton through the platform task
+    // runner and back.
+    const auto next = SnapToNextTick(fml::TimePoint::Now(), phase, interval);
+    FireCallback(next, next + interval);
+    return;
+  }
+
   auto* weak_waiter = new std::weak_ptr<VsyncWaiter>(shared_from_this());
   vsync_callback_(reinterpret_cast<intptr_t>(weak_waiter));
 }
@@ -5,6 +5,9 @@
 #ifndef SHELL_PLATFORM_EMBEDDER_VSYNC_WAITER_EMBEDDER_H_
 #define SHELL_PLATFORM_EMBEDDER_VSYNC_WAITER_EMBEDDER_H_
 
+#include <memory>
+#include <mutex>
+
 #include "flutter/fml/macros.h"
 #include "flutter/shell/common/vsync_waiter.h"
 
@@ -14,7 +17,40 @@ class VsyncWaiterEmbedder final : public VsyncWaiter {
  public:
   using VsyncCallback = std::function<void(intptr_t)>;
 
+  //----------------------------------------------------------------------------
+  /// @brief      A standing (phase, interval) vsync schedule published by the
+  ///             embedder. While a schedule is set, the waiter derives frame
+  ///             times from the monotonic clock instead of asking the embedder
+  ///             for each vsync, which avoids two cross-thread hops per frame.
+  ///             The embedder republishes the schedule when it observes drift
+  ///             and clears it to fall back to per-frame callbacks.
+  ///
+  ///             Instances are shared between the platform view (which
+  ///             receives schedule updates on the platform thread) and the
+  ///             waiters created for the shell. All methods are thread safe.
+  ///
+  class VsyncSchedule {
+   public:
+    VsyncSchedule();
+
+    ~VsyncSchedule();
+
+    /// Publishes a new schedule. An interval of zero clears the schedule.
+    void Update(fml::TimePoint phase, fml::TimeDelta interval);
+
+    /// Returns true and fills out the arguments if a schedule is set.
+    bool Get(fml::TimePoint* phase, fml::TimeDelta* interval) const;
+
+   private:
+    mutable std::mutex mutex_;
+    fml::TimePoint phase_;
+    fml::TimeDelta interval_ = fml::TimeDelta::Zero();
+
+    FML_DISALLOW_COPY_AND_ASSIGN(VsyncSchedule);
+  };
+
   VsyncWaiterEmbedder(const VsyncCallback& callback,
+                      std::shared_ptr<VsyncSchedule> vsync_schedule,
                       flutter::TaskRunners task_runners);
 
   ~VsyncWaiterEmbedder() override;
@@ -25,6 +61,7 @@ class VsyncWaiterEmbedder final : public VsyncWaiter {
 
  private:
   const VsyncCallback vsync_callback_;
+  const std::shared_ptr<VsyncSchedule> vsync_schedule_;
 
   // |VsyncWaiter|
   void AwaitVSync() override;
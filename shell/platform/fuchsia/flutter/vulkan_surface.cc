@@ -414,6 +414,9 @@ bool VulkanSurface::BindToImage(sk_sp<GrContext> context,
 
   vulkan_image_ = std::move(vulkan_image);
 
+  // The previous image's pixels are gone along with the image.
+  content_signature_ = 0;
+
   // Bind image memory.
   if (VK_CALL_LOG_ERROR(vulkan_provider_.vk().BindImageMemory(
           vulkan_provider_.vk_device(), vulkan_image_.vk_image, vk_memory_,
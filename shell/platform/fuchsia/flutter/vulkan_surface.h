@@ -77,6 +77,17 @@ class VulkanSurface final
   // |flutter::SceneUpdateContext::SurfaceProducerSurface|
   sk_sp<SkSurface> GetSkiaSurface() const override;
 
+  // The pixels in the |VkImage| survive recycling through the pool, so the
+  // signature stays valid until |BindToImage| swaps the image out.
+  //
+  // |flutter::SceneUpdateContext::SurfaceProducerSurface|
+  uint64_t GetContentSignature() const override { return content_signature_; }
+
+  // |flutter::SceneUpdateContext::SurfaceProducerSurface|
+  void SetContentSignature(uint64_t signature) override {
+    content_signature_ = signature;
+  }
+
   const vulkan::VulkanHandle<VkImage>& GetVkImage() {
     return vulkan_image_.vk_image;
   }
@@ -200,6 +211,7 @@ class VulkanSurface final
   std::array<SkISize, kSizeHistorySize> size_history_;
   int size_history_index_ = 0;
   size_t age_ = 0;
+  uint64_t content_signature_ = 0;
   bool valid_ = false;
 
   flutter::LayerRasterCacheKey retained_key_ = {0, SkMatrix::MakeScale(1, 1)};
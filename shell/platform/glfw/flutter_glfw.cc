@@ -12,6 +12,9 @@
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <mutex>
+#include <numeric>
+#include <vector>
 
 #include "flutter/shell/platform/common/cpp/client_wrapper/include/flutter/plugin_registrar.h"
 #include "flutter/shell/platform/common/cpp/incoming_message_dispatcher.h"
@@ -67,6 +70,22 @@ struct FlutterDesktopWindowControllerState {
   // The screen coordinates per inch on the primary monitor. Defaults to a sane
   // value based on pixel_ratio 1.0.
   double monitor_screen_coordinates_per_inch = kDpPerInch;
+
+  // Guards the latency fields below, which are written from both the platform
+  // thread (pointer events) and the engine's render thread (presents).
+  std::mutex latency_mutex;
+
+  // The engine-clock timestamp, in nanoseconds, of the most recent pointer
+  // event that has not yet been followed by a present. Zero when no input is
+  // pending.
+  uint64_t pending_input_time_ns = 0;
+
+  // Input-to-present latency samples, in milliseconds, in recording order.
+  std::vector<double> frame_latency_samples_ms;
+
+  // Whether the last synthetic pointer event injected through
+  // FlutterDesktopInjectPointerEvent had the primary button down.
+  bool injected_button_down = false;
 };
 
 // Opaque reference for the GLFW window itself. This is separate from the
@@ -307,6 +326,13 @@ static void SendPointerEventWithData(GLFWwindow* window,
 
   FlutterEngineSendPointerEvent(controller->engine->flutter_engine, &event, 1);
 
+  // Mark the time of the most recent input so the next present can record an
+  // input-to-present latency sample.
+  {
+    std::lock_guard<std::mutex> lock(controller->latency_mutex);
+    controller->pending_input_time_ns = FlutterEngineGetCurrentTime();
+  }
+
   if (event_data.phase == FlutterPointerPhase::kAdd) {
     controller->pointer_currently_added = true;
   } else if (event_data.phase == FlutterPointerPhase::kRemove) {
@@ -527,6 +553,17 @@ static bool EnginePresent(void* user_data) {
     return false;
   }
   glfwSwapBuffers(window_controller->window.get());
+
+  // The swap has completed, so any pending input is now visible on screen.
+  {
+    std::lock_guard<std::mutex> lock(window_controller->latency_mutex);
+    if (window_controller->pending_input_time_ns != 0) {
+      uint64_t now_ns = FlutterEngineGetCurrentTime();
+      window_controller->frame_latency_samples_ms.push_back(
+          (now_ns - window_controller->pending_input_time_ns) / 1e6);
+      window_controller->pending_input_time_ns = 0;
+    }
+  }
   return true;
 }
 
@@ -900,6 +937,73 @@ bool FlutterDesktopRunWindowEventLoopWithTimeout(
   return !glfwWindowShouldClose(controller->window.get());
 }
 
+bool FlutterDesktopGetFrameLatencyStats(
+    FlutterDesktopWindowControllerRef controller,
+    FlutterDesktopFrameLatencyStats* stats) {
+  std::vector<double> samples;
+  {
+    std::lock_guard<std::mutex> lock(controller->latency_mutex);
+    samples = controller->frame_latency_samples_ms;
+  }
+  if (samples.empty()) {
+    return false;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&samples](double fraction) {
+    size_t index = static_cast<size_t>(fraction * (samples.size() - 1));
+    return samples[index];
+  };
+
+  stats->sample_count = samples.size();
+  stats->average_ms =
+      std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+  stats->p50_ms = percentile(0.5);
+  stats->p90_ms = percentile(0.9);
+  stats->p99_ms = percentile(0.99);
+  stats->max_ms = samples.back();
+  return true;
+}
+
+size_t FlutterDesktopCopyFrameLatencySamples(
+    FlutterDesktopWindowControllerRef controller,
+    double* samples_ms,
+    size_t capacity) {
+  std::lock_guard<std::mutex> lock(controller->latency_mutex);
+  size_t count =
+      std::min(capacity, controller->frame_latency_samples_ms.size());
+  std::copy_n(controller->frame_latency_samples_ms.begin(), count, samples_ms);
+  return count;
+}
+
+void FlutterDesktopResetFrameLatencyStats(
+    FlutterDesktopWindowControllerRef controller) {
+  std::lock_guard<std::mutex> lock(controller->latency_mutex);
+  controller->frame_latency_samples_ms.clear();
+  controller->pending_input_time_ns = 0;
+}
+
+void FlutterDesktopInjectPointerEvent(
+    FlutterDesktopWindowControllerRef controller,
+    double x,
+    double y,
+    bool button_down) {
+  FlutterPointerEvent event = {};
+  event.x = x;
+  event.y = y;
+  if (button_down) {
+    event.phase = controller->injected_button_down
+                      ? FlutterPointerPhase::kMove
+                      : FlutterPointerPhase::kDown;
+  } else {
+    event.phase = controller->injected_button_down
+                      ? FlutterPointerPhase::kUp
+                      : FlutterPointerPhase::kHover;
+  }
+  controller->injected_button_down = button_down;
+  SendPointerEventWithData(controller->window.get(), event);
+}
+
 FlutterDesktopWindowRef FlutterDesktopGetWindow(
     FlutterDesktopWindowControllerRef controller) {
   // Currently, one registrar acts as the registrar for all plugins, so the
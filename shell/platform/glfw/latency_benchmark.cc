@@ -0,0 +1,149 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Macro-benchmark for the GLFW embedder that measures end-to-end
+// input-to-present latency. It runs a Flutter application, injects a
+// synthetic pointer sweep while the event loop spins, and reports a
+// histogram plus summary statistics of the time between sending a pointer
+// event to the engine and the buffer swap that follows it.
+//
+// Usage: glfw_latency_benchmark <assets_path> <icu_data_path> [seconds]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "flutter/shell/platform/glfw/public/flutter_glfw.h"
+
+namespace {
+
+constexpr int32_t kWindowWidth = 800;
+constexpr int32_t kWindowHeight = 600;
+
+// How long to wait for events each iteration; roughly one frame at 60Hz.
+constexpr uint32_t kFrameTimeoutMilliseconds = 16;
+
+constexpr int kHistogramBuckets = 12;
+constexpr int kHistogramBarWidth = 50;
+
+void PrintHistogram(const std::vector<double>& samples_ms) {
+  double max_ms = *std::max_element(samples_ms.begin(), samples_ms.end());
+  double bucket_width_ms = max_ms / kHistogramBuckets;
+  if (bucket_width_ms <= 0.0) {
+    bucket_width_ms = 1.0;
+  }
+
+  std::vector<size_t> buckets(kHistogramBuckets, 0);
+  for (double sample : samples_ms) {
+    int bucket = std::min(static_cast<int>(sample / bucket_width_ms),
+                          kHistogramBuckets - 1);
+    buckets[bucket]++;
+  }
+  size_t largest_bucket = *std::max_element(buckets.begin(), buckets.end());
+
+  std::cout << "Input-to-present latency histogram:" << std::endl;
+  for (int i = 0; i < kHistogramBuckets; ++i) {
+    double lower = i * bucket_width_ms;
+    double upper = (i + 1) * bucket_width_ms;
+    int bar = largest_bucket == 0
+                  ? 0
+                  : static_cast<int>(std::lround(
+                        kHistogramBarWidth *
+                        (static_cast<double>(buckets[i]) / largest_bucket)));
+    printf("  %7.2f-%7.2f ms | %-*s %zu\n", lower, upper, kHistogramBarWidth,
+           std::string(bar, '#').c_str(), buckets[i]);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0]
+              << " <assets_path> <icu_data_path> [seconds]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string assets_path = argv[1];
+  const std::string icu_data_path = argv[2];
+  const int duration_seconds = argc > 3 ? std::atoi(argv[3]) : 10;
+
+  if (!FlutterDesktopInit()) {
+    std::cerr << "Could not initialize GLFW." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  FlutterDesktopWindowProperties window_properties = {};
+  window_properties.title = "Latency benchmark";
+  window_properties.width = kWindowWidth;
+  window_properties.height = kWindowHeight;
+  window_properties.prevent_resize = true;
+
+  FlutterDesktopEngineProperties engine_properties = {};
+  engine_properties.assets_path = assets_path.c_str();
+  engine_properties.icu_data_path = icu_data_path.c_str();
+
+  FlutterDesktopWindowControllerRef controller =
+      FlutterDesktopCreateWindow(window_properties, engine_properties);
+  if (!controller) {
+    std::cerr << "Could not launch the Flutter application." << std::endl;
+    FlutterDesktopTerminate();
+    return EXIT_FAILURE;
+  }
+
+  // Let the application settle before measuring so that startup jank does
+  // not pollute the samples.
+  auto warmup_end = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (std::chrono::steady_clock::now() < warmup_end) {
+    if (!FlutterDesktopRunWindowEventLoopWithTimeout(
+            controller, kFrameTimeoutMilliseconds)) {
+      break;
+    }
+  }
+  FlutterDesktopResetFrameLatencyStats(controller);
+
+  // Sweep the pointer back and forth across the window, one step per frame.
+  auto benchmark_end = std::chrono::steady_clock::now() +
+                       std::chrono::seconds(duration_seconds);
+  int step = 0;
+  while (std::chrono::steady_clock::now() < benchmark_end) {
+    double fraction = (step % 100) / 100.0;
+    if ((step / 100) % 2 == 1) {
+      fraction = 1.0 - fraction;
+    }
+    FlutterDesktopInjectPointerEvent(controller, fraction * kWindowWidth,
+                                     kWindowHeight / 2.0,
+                                     /*button_down=*/false);
+    step++;
+    if (!FlutterDesktopRunWindowEventLoopWithTimeout(
+            controller, kFrameTimeoutMilliseconds)) {
+      break;
+    }
+  }
+
+  FlutterDesktopFrameLatencyStats stats = {};
+  if (!FlutterDesktopGetFrameLatencyStats(controller, &stats)) {
+    std::cerr << "No latency samples were recorded." << std::endl;
+    FlutterDesktopDestroyWindow(controller);
+    FlutterDesktopTerminate();
+    return EXIT_FAILURE;
+  }
+
+  std::vector<double> samples_ms(stats.sample_count);
+  samples_ms.resize(FlutterDesktopCopyFrameLatencySamples(
+      controller, samples_ms.data(), samples_ms.size()));
+
+  PrintHistogram(samples_ms);
+  std::cout << "Samples: " << stats.sample_count << std::endl;
+  printf("Average: %.2f ms\n", stats.average_ms);
+  printf("p50: %.2f ms  p90: %.2f ms  p99: %.2f ms  max: %.2f ms\n",
+         stats.p50_ms, stats.p90_ms, stats.p99_ms, stats.max_ms);
+
+  FlutterDesktopDestroyWindow(controller);
+  FlutterDesktopTerminate();
+  return EXIT_SUCCESS;
+}
@@ -116,6 +116,56 @@ FLUTTER_EXPORT bool FlutterDesktopRunWindowEventLoopWithTimeout(
     FlutterDesktopWindowControllerRef controller,
     uint32_t timeout_milliseconds);
 
+// Summary statistics over recorded input-to-present latency samples.
+//
+// A sample is recorded every time a frame is presented to the window after a
+// pointer event was sent to the engine; it measures the time between sending
+// the event and completing the buffer swap.
+typedef struct {
+  // The number of samples the other fields summarize.
+  size_t sample_count;
+  // The mean latency, in milliseconds.
+  double average_ms;
+  // Latency percentiles, in milliseconds.
+  double p50_ms;
+  double p90_ms;
+  double p99_ms;
+  // The worst recorded latency, in milliseconds.
+  double max_ms;
+} FlutterDesktopFrameLatencyStats;
+
+// Populates |stats| with a summary of the input-to-present latency samples
+// recorded since the window was created or the samples were last reset.
+//
+// Returns false if no samples have been recorded yet.
+FLUTTER_EXPORT bool FlutterDesktopGetFrameLatencyStats(
+    FlutterDesktopWindowControllerRef controller,
+    FlutterDesktopFrameLatencyStats* stats);
+
+// Copies up to |capacity| recorded input-to-present latency samples, in
+// milliseconds and in recording order, into |samples_ms|.
+//
+// Returns the number of samples copied.
+FLUTTER_EXPORT size_t FlutterDesktopCopyFrameLatencySamples(
+    FlutterDesktopWindowControllerRef controller,
+    double* samples_ms,
+    size_t capacity);
+
+// Discards all recorded input-to-present latency samples.
+FLUTTER_EXPORT void FlutterDesktopResetFrameLatencyStats(
+    FlutterDesktopWindowControllerRef controller);
+
+// Sends a synthetic pointer event at the given window coordinates, as if the
+// mouse had moved there with the primary button up or down per |button_down|.
+//
+// Intended for automated input and latency testing; interactive use should
+// rely on the events GLFW generates.
+FLUTTER_EXPORT void FlutterDesktopInjectPointerEvent(
+    FlutterDesktopWindowControllerRef controller,
+    double x,
+    double y,
+    bool button_down);
+
 // Returns the window handle for the window associated with
 // FlutterDesktopWindowControllerRef.
 //
@@ -107,6 +107,25 @@ static bool fl_engine_gl_present(void* user_data) {
   return result;
 }
 
+static uint32_t fl_engine_gl_get_buffer_age(void* user_data) {
+  FlEngine* self = static_cast<FlEngine*>(user_data);
+  return fl_renderer_get_buffer_age(self->renderer);
+}
+
+static bool fl_engine_gl_present_with_damage(void* user_data,
+                                             const FlutterRect* damage) {
+  FlEngine* self = static_cast<FlEngine*>(user_data);
+  g_autoptr(GError) error = nullptr;
+  gboolean result = fl_renderer_present_with_damage(
+      self->renderer, static_cast<gint>(damage->left),
+      static_cast<gint>(damage->top),
+      static_cast<gint>(damage->right - damage->left),
+      static_cast<gint>(damage->bottom - damage->top), &error);
+  if (!result)
+    g_warning("%s", error->message);
+  return result;
+}
+
 // Called by the engine to determine if it is on the GTK thread.
 static bool fl_engine_runs_task_on_current_thread(void* user_data) {
   FlEngine* self = static_cast<FlEngine*>(user_data);
@@ -213,6 +232,8 @@ gboolean fl_engine_start(FlEngine* self, GError** error) {
   config.open_gl.clear_current = fl_engine_gl_clear_current;
   config.open_gl.fbo_callback = fl_engine_gl_get_fbo;
   config.open_gl.present = fl_engine_gl_present;
+  config.open_gl.buffer_age_callback = fl_engine_gl_get_buffer_age;
+  config.open_gl.present_with_damage = fl_engine_gl_present_with_damage;
 
   FlutterTaskRunnerDescription platform_task_runner = {};
   platform_task_runner.struct_size = sizeof(FlutterTaskRunnerDescription);
@@ -4,14 +4,35 @@
 
 #include "fl_renderer.h"
 
+#include <string.h>
+
 #include "flutter/shell/platform/embedder/embedder.h"
 
+// From EGL_EXT_buffer_age, which may be missing from the EGL headers in use.
+#ifndef EGL_BUFFER_AGE_EXT
+#define EGL_BUFFER_AGE_EXT 0x313D
+#endif
+
+// From EGL_KHR_swap_buffers_with_damage / EGL_EXT_swap_buffers_with_damage.
+typedef EGLBoolean (*FlSwapBuffersWithDamageProc)(EGLDisplay display,
+                                                  EGLSurface surface,
+                                                  const EGLint* rects,
+                                                  EGLint n_rects);
+
 G_DEFINE_QUARK(fl_renderer_error_quark, fl_renderer_error)
 
 typedef struct {
   EGLDisplay egl_display;
   EGLSurface egl_surface;
   EGLContext egl_context;
+
+  // TRUE if the EGL implementation can report how many swaps ago the
+  // backbuffer contents were last presented (EGL_EXT_buffer_age).
+  gboolean has_buffer_age;
+
+  // Swap function that takes damage rectangles, or %NULL if neither
+  // EGL_KHR_swap_buffers_with_damage nor the EXT variant is available.
+  FlSwapBuffersWithDamageProc swap_buffers_with_damage;
 } FlRendererPrivate;
 
 G_DEFINE_TYPE_WITH_PRIVATE(FlRenderer, fl_renderer, G_TYPE_OBJECT)
@@ -75,6 +96,23 @@ static gboolean fl_renderer_real_start(FlRenderer* self, GError** error) {
   eglQueryContext(priv->egl_display, priv->egl_context,
                   EGL_CONTEXT_CLIENT_VERSION, &value);
 
+  // Probe for the extensions that let frames be presented with damage
+  // rectangles so the compositor only recomposites the regions that changed.
+  const char* extensions = eglQueryString(priv->egl_display, EGL_EXTENSIONS);
+  if (extensions != nullptr) {
+    priv->has_buffer_age = strstr(extensions, "EGL_EXT_buffer_age") != nullptr;
+    if (strstr(extensions, "EGL_KHR_swap_buffers_with_damage") != nullptr) {
+      priv->swap_buffers_with_damage =
+          reinterpret_cast<FlSwapBuffersWithDamageProc>(
+              eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+    } else if (strstr(extensions, "EGL_EXT_swap_buffers_with_damage") !=
+               nullptr) {
+      priv->swap_buffers_with_damage =
+          reinterpret_cast<FlSwapBuffersWithDamageProc>(
+              eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+    }
+  }
+
   return TRUE;
 }
 
@@ -125,6 +163,21 @@ guint32 fl_renderer_get_fbo(FlRenderer* self) {
   return 0;
 }
 
+guint32 fl_renderer_get_buffer_age(FlRenderer* self) {
+  FlRendererPrivate* priv =
+      static_cast<FlRendererPrivate*>(fl_renderer_get_instance_private(self));
+
+  if (!priv->has_buffer_age)
+    return 0;
+
+  EGLint age = 0;
+  if (!eglQuerySurface(priv->egl_display, priv->egl_surface,
+                       EGL_BUFFER_AGE_EXT, &age))
+    return 0;
+
+  return age;
+}
+
 gboolean fl_renderer_present(FlRenderer* self, GError** error) {
   FlRendererPrivate* priv =
       static_cast<FlRendererPrivate*>(fl_renderer_get_instance_private(self));
@@ -137,3 +190,31 @@ gboolean fl_renderer_present(FlRenderer* self, GError** error) {
 
   return TRUE;
 }
+
+gboolean fl_renderer_present_with_damage(FlRenderer* self,
+                                         gint x,
+                                         gint y,
+                                         gint width,
+                                         gint height,
+                                         GError** error) {
+  FlRendererPrivate* priv =
+      static_cast<FlRendererPrivate*>(fl_renderer_get_instance_private(self));
+
+  if (priv->swap_buffers_with_damage == nullptr)
+    return fl_renderer_present(self, error);
+
+  // EGL damage rectangles use surface coordinates with the origin at the
+  // bottom left, while the supplied damage has its origin at the top left.
+  EGLint surface_height = 0;
+  eglQuerySurface(priv->egl_display, priv->egl_surface, EGL_HEIGHT,
+                  &surface_height);
+  EGLint rect[4] = {x, surface_height - y - height, width, height};
+  if (!priv->swap_buffers_with_damage(priv->egl_display, priv->egl_surface,
+                                      rect, 1)) {
+    g_set_error(error, fl_renderer_error_quark(), FL_RENDERER_ERROR_FAILED,
+                "Failed to swap EGL buffers with damage");
+    return FALSE;
+  }
+
+  return TRUE;
+}
@@ -102,6 +102,19 @@ gboolean fl_renderer_clear_current(FlRenderer* renderer, GError** error);
  */
 guint32 fl_renderer_get_fbo(FlRenderer* renderer);
 
+/**
+ * fl_renderer_get_buffer_age:
+ * @renderer: an #FlRenderer.
+ *
+ * Gets the age of the current backbuffer as defined by EGL_EXT_buffer_age:
+ * 1 means it holds the frame presented one swap ago, 2 the frame before
+ * that, and 0 means its contents are undefined or the extension is not
+ * available.
+ *
+ * Returns: the buffer age in swaps, or 0 if unknown.
+ */
+guint32 fl_renderer_get_buffer_age(FlRenderer* renderer);
+
 /**
  * fl_renderer_present:
  * @renderer: an #FlRenderer.
@@ -114,6 +127,31 @@ guint32 fl_renderer_get_fbo(FlRenderer* renderer);
  */
 gboolean fl_renderer_present(FlRenderer* renderer, GError** error);
 
+/**
+ * fl_renderer_present_with_damage:
+ * @renderer: an #FlRenderer.
+ * @x: left edge of the damage rectangle, in pixels from the left of the
+ * surface.
+ * @y: top edge of the damage rectangle, in pixels from the top of the
+ * surface.
+ * @width: width of the damage rectangle in pixels.
+ * @height: height of the damage rectangle in pixels.
+ * @error: (allow-none): #GError location to store the error occurring, or %NULL
+ * to ignore.
+ *
+ * Presents the current frame, hinting to the compositor that only the given
+ * rectangle changed since the last present. Falls back to presenting the
+ * whole surface if the EGL implementation cannot swap with damage.
+ *
+ * Returns %TRUE if successful.
+ */
+gboolean fl_renderer_present_with_damage(FlRenderer* renderer,
+                                         gint x,
+                                         gint y,
+                                         gint width,
+                                         gint height,
+                                         GError** error);
+
 G_END_DECLS
 
 #endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_RENDERER_H_
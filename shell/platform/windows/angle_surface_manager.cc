@@ -4,8 +4,31 @@
 
 #include "flutter/shell/platform/windows/angle_surface_manager.h"
 
+#include <d3d11.h>
+#include <dxgi.h>
+
+#include <cstring>
+
+// ANGLE extension tokens not present in all eglext.h revisions.
+#ifndef EGL_EXPERIMENTAL_PRESENT_PATH_ANGLE
+#define EGL_EXPERIMENTAL_PRESENT_PATH_ANGLE 0x33A4
+#define EGL_EXPERIMENTAL_PRESENT_PATH_FAST_ANGLE 0x33A9
+#endif
+#ifndef EGL_D3D11_DEVICE_ANGLE
+#define EGL_D3D11_DEVICE_ANGLE 0x33A1
+#endif
+
 namespace flutter {
 
+namespace {
+
+bool HasEglExtension(EGLDisplay display, const char* extension) {
+  const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+  return extensions != nullptr && strstr(extensions, extension) != nullptr;
+}
+
+}  // namespace
+
 AngleSurfaceManager::AngleSurfaceManager()
     : egl_config_(nullptr),
       egl_display_(EGL_NO_DISPLAY),
@@ -134,9 +157,54 @@ bool AngleSurfaceManager::Initialize() {
     return false;
   }
 
+  if (HasEglExtension(egl_display_, "EGL_KHR_swap_buffers_with_damage")) {
+    swap_buffers_with_damage_ =
+        reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+            eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+  }
+  supports_flip_present_ =
+      HasEglExtension(egl_display_, "EGL_ANGLE_experimental_present_path");
+
+  LimitFrameLatency();
+
   return true;
 }
 
+void AngleSurfaceManager::LimitFrameLatency() {
+  if (!HasEglExtension(egl_display_, "EGL_EXT_device_query")) {
+    return;
+  }
+  auto query_display_attrib =
+      reinterpret_cast<PFNEGLQUERYDISPLAYATTRIBEXTPROC>(
+          eglGetProcAddress("eglQueryDisplayAttribEXT"));
+  auto query_device_attrib = reinterpret_cast<PFNEGLQUERYDEVICEATTRIBEXTPROC>(
+      eglGetProcAddress("eglQueryDeviceAttribEXT"));
+  if (!query_display_attrib || !query_device_attrib) {
+    return;
+  }
+
+  EGLAttrib egl_device = 0;
+  if (query_display_attrib(egl_display_, EGL_DEVICE_EXT, &egl_device) !=
+      EGL_TRUE) {
+    return;
+  }
+  EGLAttrib d3d_device = 0;
+  if (query_device_attrib(reinterpret_cast<EGLDeviceEXT>(egl_device),
+                          EGL_D3D11_DEVICE_ANGLE, &d3d_device) != EGL_TRUE) {
+    return;
+  }
+
+  IDXGIDevice1* dxgi_device = nullptr;
+  if (reinterpret_cast<ID3D11Device*>(d3d_device)->QueryInterface(
+          IID_PPV_ARGS(&dxgi_device)) == S_OK) {
+    // Allow at most one queued frame: Present blocks once a frame is already
+    // in flight, so a busy compositor throttles the raster thread instead of
+    // growing a latency queue behind the swapchain.
+    dxgi_device->SetMaximumFrameLatency(1);
+    dxgi_device->Release();
+  }
+}
+
 void AngleSurfaceManager::CleanUp() {
   EGLBoolean result = EGL_FALSE;
 
@@ -172,11 +240,17 @@ EGLSurface AngleSurfaceManager::CreateSurface(HWND window) {
 
   EGLSurface surface = EGL_NO_SURFACE;
 
+  // When available, ask ANGLE for its "fast" present path, which backs the
+  // surface with a flip-model swapchain (DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL)
+  // and presents without an intermediate copy.
+  const EGLint flipSurfaceAttributes[] = {
+      EGL_EXPERIMENTAL_PRESENT_PATH_ANGLE,
+      EGL_EXPERIMENTAL_PRESENT_PATH_FAST_ANGLE, EGL_NONE};
   const EGLint surfaceAttributes[] = {EGL_NONE};
 
-  surface = eglCreateWindowSurface(egl_display_, egl_config_,
-                                   static_cast<EGLNativeWindowType>(window),
-                                   surfaceAttributes);
+  surface = eglCreateWindowSurface(
+      egl_display_, egl_config_, static_cast<EGLNativeWindowType>(window),
+      supports_flip_present_ ? flipSurfaceAttributes : surfaceAttributes);
   if (surface == EGL_NO_SURFACE) {
     OutputDebugString(L"Surface creation failed.");
   }
@@ -217,4 +291,15 @@ EGLBoolean AngleSurfaceManager::SwapBuffers(const EGLSurface surface) {
   return (eglSwapBuffers(egl_display_, surface));
 }
 
+EGLBoolean AngleSurfaceManager::SwapBuffersWithDamage(const EGLSurface surface,
+                                                      const EGLint* rects,
+                                                      EGLint n_rects) {
+  if (swap_buffers_with_damage_ == nullptr || n_rects == 0) {
+    return SwapBuffers(surface);
+  }
+  // The extension takes a mutable pointer but does not modify the rects.
+  return swap_buffers_with_damage_(egl_display_, surface,
+                                   const_cast<EGLint*>(rects), n_rects);
+}
+
 }  // namespace flutter
@@ -54,10 +54,23 @@ class AngleSurfaceManager {
   // not null.
   EGLBoolean SwapBuffers(const EGLSurface surface);
 
+  // Like SwapBuffers, but limits the present to the given damage rectangles
+  // (quads of x, y, width, height in surface coordinates). ANGLE forwards the
+  // rectangles to IDXGISwapChain1::Present1 as dirty rects, letting the
+  // compositor re-process only the changed region. Falls back to a full swap
+  // when EGL_KHR_swap_buffers_with_damage is unavailable or |n_rects| is 0.
+  EGLBoolean SwapBuffersWithDamage(const EGLSurface surface,
+                                   const EGLint* rects,
+                                   EGLint n_rects);
+
  private:
   bool Initialize();
   void CleanUp();
 
+  // Caps the number of queued presents on the backing DXGI device so that a
+  // slow compositor throttles rendering instead of accumulating latency.
+  void LimitFrameLatency();
+
  private:
   // EGL representation of native display.
   EGLDisplay egl_display_;
@@ -75,6 +88,14 @@ class AngleSurfaceManager {
   // State representing success or failure of display initialization used when
   // creating surfaces.
   bool initialize_succeeded_;
+
+  // eglSwapBuffersWithDamageKHR, when the display supports
+  // EGL_KHR_swap_buffers_with_damage; nullptr otherwise.
+  PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC swap_buffers_with_damage_ = nullptr;
+
+  // Whether the display supports EGL_ANGLE_experimental_present_path, used to
+  // request a flip-model swapchain at surface creation.
+  bool supports_flip_present_ = false;
 };
 
 }  // namespace flutter
@@ -240,6 +240,45 @@ uint64_t FlutterDesktopProcessMessages(
   return controller->engine_state->task_runner->ProcessTasks().count();
 }
 
+bool FlutterDesktopRunMessageLoopWithTimeout(
+    FlutterDesktopViewControllerRef controller,
+    uint32_t timeout_milliseconds) {
+  flutter::Win32TaskRunner* task_runner =
+      controller->engine_state->task_runner.get();
+
+  // Drain expired engine tasks; this also arms the runner's waitable timer
+  // for the next delayed task.
+  std::chrono::nanoseconds wait_duration = task_runner->ProcessTasks();
+
+  MSG message;
+  while (PeekMessage(&message, nullptr, 0, 0, PM_REMOVE)) {
+    if (message.message == WM_QUIT) {
+      return false;
+    }
+    TranslateMessage(&message);
+    DispatchMessage(&message);
+  }
+
+  // Cap the wait at the caller's timeout and at the next engine task. The
+  // latter is a backstop for the case where the waitable timer could not be
+  // created; when the timer exists it wakes the wait at the exact deadline.
+  DWORD wait_milliseconds = timeout_milliseconds;
+  if (wait_duration < std::chrono::nanoseconds::max()) {
+    const auto wait_truncated =
+        std::chrono::duration_cast<std::chrono::milliseconds>(wait_duration);
+    const uint64_t wait_rounded_up_milliseconds =
+        static_cast<uint64_t>(wait_truncated.count()) + 1;
+    wait_milliseconds = static_cast<DWORD>(std::min<uint64_t>(
+        wait_milliseconds, wait_rounded_up_milliseconds));
+  }
+
+  HANDLE task_timer = task_runner->task_timer();
+  const DWORD handle_count = task_timer == nullptr ? 0 : 1;
+  MsgWaitForMultipleObjectsEx(handle_count, &task_timer, wait_milliseconds,
+                              QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+  return true;
+}
+
 void FlutterDesktopDestroyViewController(
     FlutterDesktopViewControllerRef controller) {
   FlutterEngineShutdown(controller->engine_state->engine);
@@ -103,6 +103,22 @@ FlutterDesktopGetView(FlutterDesktopViewControllerRef controller);
 FLUTTER_EXPORT uint64_t
 FlutterDesktopProcessMessages(FlutterDesktopViewControllerRef controller);
 
+// Runs one iteration of the message loop: processes pending engine tasks,
+// dispatches any queued Windows messages, and then blocks until new input
+// arrives, the next engine task comes due, or |timeout_milliseconds| elapses
+// (pass UINT32_MAX to wait indefinitely).
+//
+// The wait is driven by a high-resolution waitable timer armed for the next
+// engine task, so delayed tasks fire at their actual deadline rather than on
+// the system's default timer quantum, without busy-waiting in between.
+//
+// Returns false when the loop should stop because WM_QUIT was received;
+// callers should exit their `while (FlutterDesktopRunMessageLoopWithTimeout(
+// controller, ...))` loop at that point.
+FLUTTER_EXPORT bool FlutterDesktopRunMessageLoopWithTimeout(
+    FlutterDesktopViewControllerRef controller,
+    uint32_t timeout_milliseconds);
+
 // Return backing HWND for manipulation in host application.
 FLUTTER_EXPORT HWND FlutterDesktopViewGetHWND(FlutterDesktopViewRef view);
 
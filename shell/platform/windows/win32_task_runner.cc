@@ -7,62 +7,100 @@
 #include <atomic>
 #include <utility>
 
+// Not defined by older SDKs; supported since Windows 10 1803 and silently
+// ignored by CreateWaitableTimerEx before that.
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
 namespace flutter {
 
 Win32TaskRunner::Win32TaskRunner(DWORD main_thread_id,
                                  const TaskExpiredCallback& on_task_expired)
     : main_thread_id_(main_thread_id),
-      on_task_expired_(std::move(on_task_expired)) {}
+      on_task_expired_(std::move(on_task_expired)) {
+  // Prefer a high-resolution timer so delayed tasks (vsync callbacks in
+  // particular) are not rounded up to the default 15.6ms timer quantum.
+  task_timer_ = CreateWaitableTimerEx(
+      nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+      TIMER_ALL_ACCESS);
+  if (task_timer_ == nullptr) {
+    task_timer_ = CreateWaitableTimerEx(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+  }
+}
 
-Win32TaskRunner::~Win32TaskRunner() = default;
+Win32TaskRunner::~Win32TaskRunner() {
+  if (task_timer_ != nullptr) {
+    CloseHandle(task_timer_);
+  }
+}
+
+void Win32TaskRunner::ArmTaskTimer(TaskTimePoint now, TaskTimePoint fire_time) {
+  if (task_timer_ == nullptr) {
+    return;
+  }
+  const auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::max(fire_time - now, TaskTimePoint::duration::zero()));
+  // Negative due times are relative, in 100ns units.
+  LARGE_INTEGER due_time;
+  due_time.QuadPart = -static_cast<LONGLONG>((delay.count() + 99) / 100);
+  SetWaitableTimer(task_timer_, &due_time, 0, nullptr, nullptr, FALSE);
+}
 
 bool Win32TaskRunner::RunsTasksOnCurrentThread() const {
   return GetCurrentThreadId() == main_thread_id_;
 }
 
 std::chrono::nanoseconds Win32TaskRunner::ProcessTasks() {
-  const TaskTimePoint now = TaskTimePoint::clock::now();
-
-  std::vector<FlutterTask> expired_tasks;
-
-  // Process expired tasks.
-  {
-    std::lock_guard<std::mutex> lock(task_queue_mutex_);
-    while (!task_queue_.empty()) {
-      const auto& top = task_queue_.top();
-      // If this task (and all tasks after this) has not yet expired, there is
-      // nothing more to do. Quit iterating.
-      if (top.fire_time > now) {
-        break;
+  // Drain in batches: tasks fired below may post immediate follow-up tasks,
+  // which should run in this call rather than after another loop wake.
+  for (;;) {
+    const TaskTimePoint now = TaskTimePoint::clock::now();
+
+    std::vector<FlutterTask> expired_tasks;
+
+    // Process expired tasks.
+    {
+      std::lock_guard<std::mutex> lock(task_queue_mutex_);
+      while (!task_queue_.empty()) {
+        const auto& top = task_queue_.top();
+        // If this task (and all tasks after this) has not yet expired, there
+        // is nothing more to do. Quit iterating.
+        if (top.fire_time > now) {
+          break;
+        }
+
+        // Make a record of the expired task. Do NOT service the task here
+        // because we are still holding onto the task queue mutex. We don't
+        // want other threads to block on posting tasks onto this thread till
+        // we are done processing expired tasks.
+        expired_tasks.push_back(task_queue_.top().task);
+
+        // Remove the tasks from the delayed tasks queue.
+        task_queue_.pop();
       }
+    }
 
-      // Make a record of the expired task. Do NOT service the task here
-      // because we are still holding onto the task queue mutex. We don't want
-      // other threads to block on posting tasks onto this thread till we are
-      // done processing expired tasks.
-      expired_tasks.push_back(task_queue_.top().task);
-
-      // Remove the tasks from the delayed tasks queue.
-      task_queue_.pop();
+    if (expired_tasks.empty()) {
+      // Calculate duration to sleep for on next iteration, and arm the task
+      // timer so a wait on it wakes exactly when the next task is due.
+      std::lock_guard<std::mutex> lock(task_queue_mutex_);
+      if (task_queue_.empty()) {
+        if (task_timer_ != nullptr) {
+          CancelWaitableTimer(task_timer_);
+        }
+        return std::chrono::nanoseconds::max();
+      }
+      const auto next_wake = task_queue_.top().fire_time;
+      ArmTaskTimer(now, next_wake);
+      return std::min(next_wake - now, std::chrono::nanoseconds::max());
     }
-  }
 
-  // Fire expired tasks.
-  {
-    // Flushing tasks here without holing onto the task queue mutex.
+    // Fire expired tasks without holding onto the task queue mutex.
     for (const auto& task : expired_tasks) {
       on_task_expired_(&task);
     }
   }
-
-  // Calculate duration to sleep for on next iteration.
-  {
-    std::lock_guard<std::mutex> lock(task_queue_mutex_);
-    const auto next_wake = task_queue_.empty() ? TaskTimePoint::max()
-                                               : task_queue_.top().fire_time;
-
-    return std::min(next_wake - now, std::chrono::nanoseconds::max());
-  }
 }
 
 Win32TaskRunner::TaskTimePoint Win32TaskRunner::TimePointFromFlutterTime(
@@ -82,9 +120,11 @@ void Win32TaskRunner::PostTask(FlutterTask flutter_task,
   task.fire_time = TimePointFromFlutterTime(flutter_target_time_nanos);
   task.task = flutter_task;
 
+  bool is_earliest = false;
   {
     std::lock_guard<std::mutex> lock(task_queue_mutex_);
     task_queue_.push(task);
+    is_earliest = task_queue_.top().order == task.order;
 
     // Make sure the queue mutex is unlocked before waking up the loop. In case
     // the wake causes this thread to be descheduled for the primary thread to
@@ -92,8 +132,17 @@ void Win32TaskRunner::PostTask(FlutterTask flutter_task,
     // the lock here momentarily till the end of the scope is a pessimization.
   }
 
-  if (!PostThreadMessage(main_thread_id_, WM_NULL, 0, 0)) {
-    OutputDebugString(L"Failed to post message to main thread.");
+  const TaskTimePoint now = TaskTimePoint::clock::now();
+  if (task.fire_time <= now || task_timer_ == nullptr) {
+    // Wake the loop immediately for tasks that are already due (or when the
+    // timer could not be created and a message is the only wakeup available).
+    if (!PostThreadMessage(main_thread_id_, WM_NULL, 0, 0)) {
+      OutputDebugString(L"Failed to post message to main thread.");
+    }
+  } else if (is_earliest) {
+    // A delayed task that comes due before anything already queued: pull the
+    // task timer in so a loop blocked on it wakes at the new deadline.
+    ArmTaskTimer(now, task.fire_time);
   }
 }
 
@@ -37,6 +37,12 @@ class Win32TaskRunner {
   // Post a Flutter engine tasks to the event loop for delayed execution.
   void PostTask(FlutterTask flutter_task, uint64_t flutter_target_time_nanos);
 
+  // A waitable timer that is armed to fire when the next delayed task comes
+  // due. Waiting on this handle (e.g. with MsgWaitForMultipleObjectsEx) wakes
+  // the loop at the task's actual deadline instead of the next tick of the
+  // default 15.6ms timer quantum.
+  HANDLE task_timer() const { return task_timer_; }
+
  private:
   using TaskTimePoint = std::chrono::steady_clock::time_point;
   struct Task {
@@ -57,6 +63,7 @@ class Win32TaskRunner {
   TaskExpiredCallback on_task_expired_;
   std::mutex task_queue_mutex_;
   std::priority_queue<Task, std::deque<Task>, Task::Comparer> task_queue_;
+  HANDLE task_timer_ = nullptr;
 
   Win32TaskRunner(const Win32TaskRunner&) = delete;
 
@@ -64,6 +71,10 @@ class Win32TaskRunner {
 
   static TaskTimePoint TimePointFromFlutterTime(
       uint64_t flutter_target_time_nanos);
+
+  // Arms |task_timer_| to fire when |fire_time| is reached, or immediately if
+  // it has already passed.
+  void ArmTaskTimer(TaskTimePoint now, TaskTimePoint fire_time);
 };
 
 }  // namespace flutter
@@ -4,8 +4,31 @@
 
 #include "flutter/shell/profiling/sampling_profiler.h"
 
+#include <cstring>
+
+#include "flutter/fml/time/time_point.h"
+
 namespace flutter {
 
+namespace {
+
+// At the default 1Hz telemetry rate this covers a little over an hour of
+// samples in ~192KB, allocated once up front.
+constexpr size_t kRingBufferCapacity = 4096;
+
+// How many sampler ticks apart records of a metric are, given its rate.
+uint64_t StrideForRate(uint32_t samples_per_sec, uint32_t ticks_per_sec) {
+  if (samples_per_sec == 0) {
+    return 0;  // Disabled.
+  }
+  if (samples_per_sec >= ticks_per_sec) {
+    return 1;
+  }
+  return ticks_per_sec / samples_per_sec;
+}
+
+}  // namespace
+
 SamplingProfiler::SamplingProfiler(
     const char* thread_label,
     fml::RefPtr<fml::TaskRunner> profiler_task_runner,
@@ -14,51 +37,155 @@ SamplingProfiler::SamplingProfiler(
     : thread_label_(thread_label),
       profiler_task_runner_(profiler_task_runner),
       sampler_(std::move(sampler)),
-      num_samples_per_sec_(num_samples_per_sec) {}
+      num_samples_per_sec_(num_samples_per_sec),
+      rates_{num_samples_per_sec_, num_samples_per_sec_,
+             num_samples_per_sec_} {
+  ring_.resize(kRingBufferCapacity);
+}
 
-void SamplingProfiler::Start() const {
+SamplingProfiler::~SamplingProfiler() {
+  Stop();
+}
+
+void SamplingProfiler::SetMetricRates(const MetricRates& rates) {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  rates_ = rates;
+}
+
+void SamplingProfiler::Start() {
   if (!profiler_task_runner_) {
     return;
   }
   FML_CHECK(num_samples_per_sec_ > 0)
       << "number of samples must be a positive integer, got: "
       << num_samples_per_sec_;
+  uint64_t generation = 0;
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (is_running_) {
+      return;
+    }
+    is_running_ = true;
+    tick_count_ = 0;
+    generation = ++generation_;
+  }
   double delay_between_samples = 1.0 / num_samples_per_sec_;
   auto task_delay = fml::TimeDelta::FromSecondsF(delay_between_samples);
   UpdateObservatoryThreadName();
-  SampleRepeatedly(task_delay);
+  SampleRepeatedly(task_delay, generation);
+}
+
+void SamplingProfiler::Stop() {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  is_running_ = false;
+  generation_++;
+}
+
+bool SamplingProfiler::IsRunning() const {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  return is_running_;
 }
 
-void SamplingProfiler::SampleRepeatedly(fml::TimeDelta task_delay) const {
+void SamplingProfiler::SampleRepeatedly(fml::TimeDelta task_delay,
+                                        uint64_t generation) {
   profiler_task_runner_->PostDelayedTask(
-      [profiler = this, task_delay = task_delay, sampler = sampler_]() {
-        // TODO(kaushikiska): consider buffering these every n seconds to
-        // avoid spamming the trace buffer.
-        const ProfileSample usage = sampler();
-        if (usage.cpu_usage) {
-          const auto& cpu_usage = usage.cpu_usage;
-          std::string total_cpu_usage =
-              std::to_string(cpu_usage->total_cpu_usage);
-          std::string num_threads = std::to_string(cpu_usage->num_threads);
-          TRACE_EVENT_INSTANT2("flutter::profiling", "CpuUsage",
-                               "total_cpu_usage", total_cpu_usage.c_str(),
-                               "num_threads", num_threads.c_str());
-        }
-        if (usage.memory_usage) {
-          std::string dirty_memory_usage =
-              std::to_string(usage.memory_usage->dirty_memory_usage);
-          std::string owned_shared_memory_usage =
-              std::to_string(usage.memory_usage->owned_shared_memory_usage);
-          TRACE_EVENT_INSTANT2("flutter::profiling", "MemoryUsage",
-                               "dirty_memory_usage", dirty_memory_usage.c_str(),
-                               "owned_shared_memory_usage",
-                               owned_shared_memory_usage.c_str());
+      [profiler = this, task_delay, generation, sampler = sampler_]() {
+        {
+          std::lock_guard<std::mutex> lock(profiler->state_mutex_);
+          if (profiler->generation_ != generation) {
+            // The profiler was stopped (and possibly restarted) after this
+            // task was queued.
+            return;
+          }
         }
-        profiler->SampleRepeatedly(task_delay);
+        const ProfileSample usage = sampler();
+        profiler->RecordSample(usage);
+        profiler->SampleRepeatedly(task_delay, generation);
       },
       task_delay);
 }
 
+void SamplingProfiler::RecordSample(const ProfileSample& usage) {
+  RecordedProfileSample record = {};
+  record.timestamp_micros =
+      fml::TimePoint::Now().ToEpochDelta().ToMicroseconds();
+
+  uint64_t cpu_stride = 0;
+  uint64_t memory_stride = 0;
+  uint64_t gpu_stride = 0;
+  uint64_t tick = 0;
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    cpu_stride = StrideForRate(rates_.cpu_samples_per_sec,
+                               num_samples_per_sec_);
+    memory_stride = StrideForRate(rates_.memory_samples_per_sec,
+                                  num_samples_per_sec_);
+    gpu_stride = StrideForRate(rates_.gpu_samples_per_sec,
+                               num_samples_per_sec_);
+    tick = tick_count_++;
+  }
+
+  if (usage.cpu_usage && cpu_stride != 0 && tick % cpu_stride == 0) {
+    const auto& cpu_usage = usage.cpu_usage;
+    record.metrics |= RecordedProfileSample::kCpuMetric;
+    record.num_threads = cpu_usage->num_threads;
+    record.total_cpu_usage = cpu_usage->total_cpu_usage;
+    std::string total_cpu_usage = std::to_string(cpu_usage->total_cpu_usage);
+    std::string num_threads = std::to_string(cpu_usage->num_threads);
+    TRACE_EVENT_INSTANT2("flutter::profiling", "CpuUsage", "total_cpu_usage",
+                         total_cpu_usage.c_str(), "num_threads",
+                         num_threads.c_str());
+  }
+  if (usage.memory_usage && memory_stride != 0 && tick % memory_stride == 0) {
+    record.metrics |= RecordedProfileSample::kMemoryMetric;
+    record.dirty_memory_usage = usage.memory_usage->dirty_memory_usage;
+    record.owned_shared_memory_usage =
+        usage.memory_usage->owned_shared_memory_usage;
+    std::string dirty_memory_usage =
+        std::to_string(usage.memory_usage->dirty_memory_usage);
+    std::string owned_shared_memory_usage =
+        std::to_string(usage.memory_usage->owned_shared_memory_usage);
+    TRACE_EVENT_INSTANT2("flutter::profiling", "MemoryUsage",
+                         "dirty_memory_usage", dirty_memory_usage.c_str(),
+                         "owned_shared_memory_usage",
+                         owned_shared_memory_usage.c_str());
+  }
+  if (usage.gpu_usage && gpu_stride != 0 && tick % gpu_stride == 0) {
+    record.metrics |= RecordedProfileSample::kGpuMetric;
+    record.gpu_usage = usage.gpu_usage->gpu_usage;
+    std::string gpu_usage = std::to_string(usage.gpu_usage->gpu_usage);
+    TRACE_EVENT_INSTANT1("flutter::profiling", "GpuUsage", "gpu_usage",
+                         gpu_usage.c_str());
+  }
+
+  if (record.metrics == 0) {
+    // Nothing was due this tick; don't burn a ring buffer slot on it.
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  ring_[ring_next_] = record;
+  ring_next_ = (ring_next_ + 1) % ring_.size();
+  if (ring_count_ < ring_.size()) {
+    ring_count_++;
+  }
+}
+
+std::unique_ptr<fml::Mapping> SamplingProfiler::ExportSamples() const {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  std::vector<uint8_t> buffer(ring_count_ * sizeof(RecordedProfileSample));
+  uint8_t* cursor = buffer.data();
+  // The oldest record sits at `ring_next_` once the buffer has wrapped.
+  const size_t start =
+      ring_count_ == ring_.size() ? ring_next_ : (ring_next_ - ring_count_);
+  for (size_t i = 0; i < ring_count_; i++) {
+    const auto& record = ring_[(start + i) % ring_.size()];
+    memcpy(cursor, &record, sizeof(record));
+    cursor += sizeof(record);
+  }
+  return std::make_unique<fml::DataMapping>(std::move(buffer));
+}
+
 void SamplingProfiler::UpdateObservatoryThreadName() const {
   FML_CHECK(profiler_task_runner_);
 
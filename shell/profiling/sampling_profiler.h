@@ -5,11 +5,15 @@
 #ifndef FLUTTER_SHELL_PROFILING_SAMPLING_PROFILER_H_
 #define FLUTTER_SHELL_PROFILING_SAMPLING_PROFILER_H_
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
 
+#include "flutter/fml/mapping.h"
 #include "flutter/fml/task_runner.h"
 #include "flutter/fml/trace_event.h"
 
@@ -42,16 +46,48 @@ struct MemoryUsageInfo {
   double owned_shared_memory_usage;
 };
 
+/**
+ * @brief GPU usage stats. `gpu_usage` is the percentage (between [0, 100])
+ * utilization of the GPU by the application, as reported by the platform.
+ */
+struct GpuUsageInfo {
+  double gpu_usage;
+};
+
 /**
  * @brief Container for the metrics we collect during each run of `Sampler`.
- * This currently holds `CpuUsageInfo` and `MemoryUsageInfo` but the intent
- * is to expand it to other metrics.
+ * This currently holds `CpuUsageInfo`, `MemoryUsageInfo` and `GpuUsageInfo`
+ * but the intent is to expand it to other metrics.
  *
  * @see flutter::Sampler
  */
 struct ProfileSample {
   std::optional<CpuUsageInfo> cpu_usage;
   std::optional<MemoryUsageInfo> memory_usage;
+  std::optional<GpuUsageInfo> gpu_usage;
+};
+
+/**
+ * @brief A fixed size record of one `ProfileSample` as stored in the
+ * profiler's ring buffer and written out by `ExportSamples`. `metrics` is a
+ * bitmask of the `k*Metric` constants below indicating which of the value
+ * fields were reported by the sampler; the others are zero.
+ *
+ * The exported byte stream is these records back to back, oldest first, in
+ * native byte order.
+ */
+struct RecordedProfileSample {
+  static constexpr uint32_t kCpuMetric = 1 << 0;
+  static constexpr uint32_t kMemoryMetric = 1 << 1;
+  static constexpr uint32_t kGpuMetric = 1 << 2;
+
+  int64_t timestamp_micros;
+  uint32_t metrics;
+  uint32_t num_threads;
+  double total_cpu_usage;
+  double dirty_memory_usage;
+  double owned_shared_memory_usage;
+  double gpu_usage;
 };
 
 /**
@@ -67,11 +103,25 @@ using Sampler = std::function<ProfileSample(void)>;
  * @brief a Sampling Profiler that runs peridically and calls the `Sampler`
  * which servers as a value function to gather various profiling metrics as
  * represented by `ProfileSample`. These profiling metrics are then posted to
- * the observatory timeline.
+ * the observatory timeline and recorded into a pre-allocated ring buffer of
+ * fixed size records, so steady state sampling performs no allocation and
+ * can be left enabled in release builds.
  *
  */
 class SamplingProfiler {
  public:
+  /**
+   * @brief Per metric sampling rates. The sampler itself ticks at the rate
+   * given to the constructor; each metric is recorded at most at its own
+   * rate. A rate of zero disables recording of that metric entirely. Rates
+   * higher than the tick rate are clamped to the tick rate.
+   */
+  struct MetricRates {
+    uint32_t cpu_samples_per_sec;
+    uint32_t memory_samples_per_sec;
+    uint32_t gpu_samples_per_sec;
+  };
+
   /**
    * @brief Construct a new Sampling Profiler object
    *
@@ -89,11 +139,39 @@ class SamplingProfiler {
                    Sampler sampler,
                    int num_samples_per_sec);
 
+  ~SamplingProfiler();
+
+  /**
+   * @brief Overrides the per metric sampling rates. Every metric defaults to
+   * the tick rate given to the constructor. May be called at any time; takes
+   * effect on the next sample.
+   */
+  void SetMetricRates(const MetricRates& rates);
+
   /**
    * @brief Starts the SamplingProfiler by triggering `SampleRepeatedly`.
+   * No-op when already running. May be called from any thread.
    *
    */
-  void Start() const;
+  void Start();
+
+  /**
+   * @brief Stops sampling. Pending sample tasks become no-ops. The contents
+   * of the ring buffer are retained and can still be exported. May be called
+   * from any thread.
+   */
+  void Stop();
+
+  /**
+   * @brief Whether the profiler is currently sampling.
+   */
+  bool IsRunning() const;
+
+  /**
+   * @brief Copies the recorded samples, oldest first, as tightly packed
+   * `RecordedProfileSample` records in native byte order.
+   */
+  std::unique_ptr<fml::Mapping> ExportSamples() const;
 
  private:
   const std::string thread_label_;
@@ -101,7 +179,27 @@ class SamplingProfiler {
   const Sampler sampler_;
   const uint32_t num_samples_per_sec_;
 
-  void SampleRepeatedly(fml::TimeDelta task_delay) const;
+  // Guards all the state below. Sampling happens on the profiler task
+  // runner while start/stop and export requests arrive on arbitrary
+  // threads (typically via the service protocol).
+  mutable std::mutex state_mutex_;
+  MetricRates rates_;
+  bool is_running_ = false;
+  // Incremented on every start/stop so sample tasks queued for a previous
+  // run exit instead of sampling.
+  uint64_t generation_ = 0;
+  // Pre-allocated circular buffer; `ring_next_` is the slot the next record
+  // lands in and `ring_count_` saturates at the buffer capacity.
+  std::vector<RecordedProfileSample> ring_;
+  size_t ring_next_ = 0;
+  size_t ring_count_ = 0;
+  // Number of sampler ticks since `Start`, used to derive the per metric
+  // recording strides.
+  uint64_t tick_count_ = 0;
+
+  void SampleRepeatedly(fml::TimeDelta task_delay, uint64_t generation);
+
+  void RecordSample(const ProfileSample& usage);
 
   /**
    * @brief This doesn't update the underlying OS thread name for the thread
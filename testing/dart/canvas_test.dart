@@ -287,6 +287,40 @@ void main() {
     expect(picture2.approximateBytesUsed, greaterThan(minimumExpected));
   });
 
+  test('Vertices.update overwrites a range and validates its arguments', () async {
+    final Float32List positions = Float32List.fromList(
+        <double>[0.0, 0.0, 100.0, 0.0, 0.0, 100.0, 100.0, 100.0]);
+    final Int32List colors = Int32List(4);
+    final Vertices vertices = Vertices.raw(
+      VertexMode.triangleStrip,
+      positions,
+      colors: colors,
+    );
+
+    // Overwriting the last two vertices (and their colors) succeeds and the
+    // mesh can still be drawn.
+    vertices.update(
+      2,
+      Float32List.fromList(<double>[0.0, 50.0, 100.0, 50.0]),
+      colors: Int32List.fromList(<int>[0x7F00FF00, 0x7F0000FF]),
+    );
+    testCanvas((Canvas canvas) =>
+        canvas.drawVertices(vertices, BlendMode.src, Paint()));
+
+    // The range must stay within the mesh.
+    expect(() => vertices.update(3, Float32List(4)), throwsArgumentError);
+    // Odd position lists do not describe whole vertices.
+    expect(() => vertices.update(0, Float32List(3)), throwsArgumentError);
+    // Attribute lengths must match the updated range.
+    expect(() => vertices.update(0, Float32List(4), colors: Int32List(3)),
+        throwsArgumentError);
+    // Attributes the mesh was built without cannot be introduced.
+    expect(
+        () => vertices.update(0, Float32List(4),
+            textureCoordinates: Float32List(4)),
+        throwsArgumentError);
+  });
+
   test('Path reflected in picture size for drawPath, clipPath, and drawShadow', () async {
     final PictureRecorder recorder = PictureRecorder();
     final Canvas canvas = Canvas(recorder);
@@ -59,6 +59,37 @@ void main() {
         expect(Uint8List.view(data.buffer), expected);
       });
     });
+
+    group('progress and cancellation', () {
+      test('reports monotonic progress for PNG encodes', () async {
+        final Image image = await Square4x4Image.image;
+        final List<double> progress = <double>[];
+        final ByteData data = await image.toByteData(
+          format: ImageByteFormat.png,
+          onProgress: progress.add,
+        );
+        expect(data, isNotNull);
+        expect(progress, isNotEmpty);
+        expect(progress.last, 1.0);
+        for (int i = 1; i < progress.length; i++) {
+          expect(progress[i], greaterThanOrEqualTo(progress[i - 1]));
+        }
+      });
+
+      test('canceling after completion has no effect', () async {
+        final Image image = await Square4x4Image.image;
+        final ImageEncodeCancellationToken token =
+            ImageEncodeCancellationToken();
+        final ByteData data = await image.toByteData(
+          format: ImageByteFormat.png,
+          cancellationToken: token,
+        );
+        expect(data, isNotNull);
+        expect(token.isCanceled, isFalse);
+        token.cancel();
+        expect(token.isCanceled, isTrue);
+      });
+    });
   });
 }
 
@@ -0,0 +1,215 @@
+/*
+ * Copyright 2017 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "flutter/fml/logging.h"
+#include "flutter/third_party/txt/tests/txt_test_utils.h"
+#include "third_party/benchmark/include/benchmark/benchmark_api.h"
+#include "third_party/icu/source/common/unicode/unistr.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "third_party/skia/include/core/SkColor.h"
+#include "txt/font_collection.h"
+#include "txt/paragraph.h"
+#include "txt/paragraph_builder_txt.h"
+
+namespace txt {
+
+namespace {
+
+// Script-specific corpora that measure the build, layout, and paint phases
+// separately. The corpora complement the Latin-only texts used by the other
+// paragraph benchmarks; CJK exercises dense ideographic line breaking, Arabic
+// exercises bidi resolution and shaping with joining script, and the emoji
+// corpus exercises surrogate pairs, ZWJ sequences, and color font fallback.
+
+const char* kLatinText =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+    "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim "
+    "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea "
+    "commodo consequat. Duis aute irure dolor in reprehenderit in voluptate "
+    "velit esse cillum dolore eu fugiat nulla pariatur. Excepteur sint "
+    "occaecat cupidatat non proident, sunt in culpa qui officia deserunt "
+    "mollit anim id est laborum.";
+
+const char* kCjkText =
+    "左線読設重打者撃年転聞現場独立記周。章動耳丸隠植窓害娘音民救沢楽式。"
+    "打涙広落歳設計和活理団活秋試飲変。治郎別件覧宅悩掲載独前速豪持並参。"
+    "紙訃連四住樹刻先条幅能適待術崎阪重点整。地図載権聞平美術周掲乱器科最。"
+    "観済転前輪盾軟写探復悩米夜durabilityを困輸。";
+
+const char* kArabicText =
+    "بمباركة التقليدية قام عن. تصفح يد الحدود برلين، ذلك من والنفيس "
+    "بالتوقيع، تخصص لها الأمريكية قام عن. مليون الذود لإعادة طرفاء قبل من، "
+    "دنو تحرير الأوضاع عل. بـ شدّت الأخذ الحكم حتى، وترك المشترك بل أضف. "
+    "كلّ ما يتبقّ الآلاف، بعد قد أوسع عملية، ولم بل أراض قادة.";
+
+const char* kEmojiText =
+    "😀 😃 😄 😁 😆 😅 😂 🤣 😊 😇 🙂 🙃 😉 😌 😍 some text in between 😒 "
+    "😞 😔 😟 😕 😢 😭 😤 😠 😡 🤯 😳 🥵 🥶 😱 text again 👨‍👩‍👧‍👦 "
+    "👍 👎 👊 ✊ 🤛 🤜 🤞 ✌️ 🤟 🤘 👌 👈 👉 👆 👇 ☝️ ✋ 🤚 🖐 🖖 👋";
+
+}  // namespace
+
+class CorpusFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State& state) {
+    font_collection_ = GetTestFontCollection();
+
+    bitmap_ = std::make_unique<SkBitmap>();
+    bitmap_->allocN32Pixels(1000, 1000);
+    canvas_ = std::make_unique<SkCanvas>(*bitmap_);
+    canvas_->clear(SK_ColorWHITE);
+  }
+
+  void TearDown(const benchmark::State& state) { font_collection_.reset(); }
+
+ protected:
+  static std::u16string GetU16Text(const char* text) {
+    auto icu_text = icu::UnicodeString::fromUTF8(text);
+    return std::u16string(icu_text.getBuffer(),
+                          icu_text.getBuffer() + icu_text.length());
+  }
+
+  void RunBuild(benchmark::State& state,
+                const ParagraphStyle& paragraph_style,
+                const TextStyle& text_style,
+                const char* text) {
+    std::u16string u16_text = GetU16Text(text);
+    while (state.KeepRunning()) {
+      txt::ParagraphBuilderTxt builder(paragraph_style, font_collection_);
+      builder.PushStyle(text_style);
+      builder.AddText(u16_text);
+      builder.Pop();
+      auto paragraph = builder.Build();
+    }
+  }
+
+  void RunLayout(benchmark::State& state,
+                 const ParagraphStyle& paragraph_style,
+                 const TextStyle& text_style,
+                 const char* text) {
+    auto paragraph = BuildCorpusParagraph(paragraph_style, text_style, text);
+    while (state.KeepRunning()) {
+      paragraph->SetDirty();
+      paragraph->Layout(300);
+    }
+  }
+
+  void RunPaint(benchmark::State& state,
+                const ParagraphStyle& paragraph_style,
+                const TextStyle& text_style,
+                const char* text) {
+    auto paragraph = BuildCorpusParagraph(paragraph_style, text_style, text);
+    paragraph->Layout(300);
+    size_t offset = 0;
+    while (state.KeepRunning()) {
+      // Move the paragraph every iteration to prevent the canvas from
+      // optimizing the draw away.
+      paragraph->Paint(canvas_.get(), offset % 700, 10);
+      offset++;
+    }
+  }
+
+  std::unique_ptr<ParagraphTxt> BuildCorpusParagraph(
+      const ParagraphStyle& paragraph_style,
+      const TextStyle& text_style,
+      const char* text) {
+    txt::ParagraphBuilderTxt builder(paragraph_style, font_collection_);
+    builder.PushStyle(text_style);
+    builder.AddText(GetU16Text(text));
+    builder.Pop();
+    return BuildParagraph(builder);
+  }
+
+  static TextStyle GetCorpusTextStyle(const std::string& font_family) {
+    txt::TextStyle text_style;
+    text_style.font_families = std::vector<std::string>(1, font_family);
+    text_style.color = SK_ColorBLACK;
+    return text_style;
+  }
+
+  std::shared_ptr<FontCollection> font_collection_;
+  std::unique_ptr<SkCanvas> canvas_;
+  std::unique_ptr<SkBitmap> bitmap_;
+};
+
+BENCHMARK_F(CorpusFixture, LatinBuild)(benchmark::State& state) {
+  RunBuild(state, ParagraphStyle(), GetCorpusTextStyle("Roboto"), kLatinText);
+}
+
+BENCHMARK_F(CorpusFixture, LatinLayout)(benchmark::State& state) {
+  RunLayout(state, ParagraphStyle(), GetCorpusTextStyle("Roboto"), kLatinText);
+}
+
+BENCHMARK_F(CorpusFixture, LatinPaint)(benchmark::State& state) {
+  RunPaint(state, ParagraphStyle(), GetCorpusTextStyle("Roboto"), kLatinText);
+}
+
+BENCHMARK_F(CorpusFixture, CjkBuild)(benchmark::State& state) {
+  RunBuild(state, ParagraphStyle(), GetCorpusTextStyle("Noto Sans CJK JP"),
+           kCjkText);
+}
+
+BENCHMARK_F(CorpusFixture, CjkLayout)(benchmark::State& state) {
+  RunLayout(state, ParagraphStyle(), GetCorpusTextStyle("Noto Sans CJK JP"),
+            kCjkText);
+}
+
+BENCHMARK_F(CorpusFixture, CjkPaint)(benchmark::State& state) {
+  RunPaint(state, ParagraphStyle(), GetCorpusTextStyle("Noto Sans CJK JP"),
+           kCjkText);
+}
+
+BENCHMARK_F(CorpusFixture, ArabicBuild)(benchmark::State& state) {
+  txt::ParagraphStyle paragraph_style;
+  paragraph_style.text_align = TextAlign::right;
+  paragraph_style.text_direction = TextDirection::rtl;
+  RunBuild(state, paragraph_style, GetCorpusTextStyle("Noto Naskh Arabic"),
+           kArabicText);
+}
+
+BENCHMARK_F(CorpusFixture, ArabicLayout)(benchmark::State& state) {
+  txt::ParagraphStyle paragraph_style;
+  paragraph_style.text_align = TextAlign::right;
+  paragraph_style.text_direction = TextDirection::rtl;
+  RunLayout(state, paragraph_style, GetCorpusTextStyle("Noto Naskh Arabic"),
+            kArabicText);
+}
+
+BENCHMARK_F(CorpusFixture, ArabicPaint)(benchmark::State& state) {
+  txt::ParagraphStyle paragraph_style;
+  paragraph_style.text_align = TextAlign::right;
+  paragraph_style.text_direction = TextDirection::rtl;
+  RunPaint(state, paragraph_style, GetCorpusTextStyle("Noto Naskh Arabic"),
+           kArabicText);
+}
+
+BENCHMARK_F(CorpusFixture, EmojiBuild)(benchmark::State& state) {
+  RunBuild(state, ParagraphStyle(), GetCorpusTextStyle("Noto Color Emoji"),
+           kEmojiText);
+}
+
+BENCHMARK_F(CorpusFixture, EmojiLayout)(benchmark::State& state) {
+  RunLayout(state, ParagraphStyle(), GetCorpusTextStyle("Noto Color Emoji"),
+            kEmojiText);
+}
+
+BENCHMARK_F(CorpusFixture, EmojiPaint)(benchmark::State& state) {
+  RunPaint(state, ParagraphStyle(), GetCorpusTextStyle("Noto Color Emoji"),
+           kEmojiText);
+}
+
+}  // namespace txt
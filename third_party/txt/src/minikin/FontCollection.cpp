@@ -293,11 +293,34 @@ uint32_t FontCollection::calcVariantMatchingScore(
 // the detail.
 // 3. Highest score wins, with ties resolved to the first font.
 // This method never returns nullptr.
+// Bound on the family match memo so a pathological text cannot grow it
+// without limit. Distinct (character, selector, language, variant) queries
+// are far fewer than this in practice, so the reset is rarely hit.
+static const size_t kMaxFamilyMatchCacheEntries = 4096;
+
 const std::shared_ptr<FontFamily>& FontCollection::getFamilyForChar(
     uint32_t ch,
     uint32_t vs,
     uint32_t langListId,
     int variant) const {
+  FamilyMatchKey key{ch, vs, langListId, variant};
+  auto it = mFamilyMatchCache.find(key);
+  if (it != mFamilyMatchCache.end()) {
+    return it->second;
+  }
+  const std::shared_ptr<FontFamily>& family =
+      getFamilyForCharImpl(ch, vs, langListId, variant);
+  if (mFamilyMatchCache.size() >= kMaxFamilyMatchCacheEntries) {
+    mFamilyMatchCache.clear();
+  }
+  return mFamilyMatchCache.emplace(key, family).first->second;
+}
+
+const std::shared_ptr<FontFamily>& FontCollection::getFamilyForCharImpl(
+    uint32_t ch,
+    uint32_t vs,
+    uint32_t langListId,
+    int variant) const {
   if (ch >= mMaxChar) {
     // libtxt: check if the fallback font provider can match this character
     if (mFallbackFontProvider) {
@@ -19,6 +19,7 @@
 
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -101,6 +102,13 @@ class FontCollection {
                                                       uint32_t langListId,
                                                       int variant) const;
 
+  // Scores every candidate family for the character; only called on a miss in
+  // the family match memo maintained by |getFamilyForChar|.
+  const std::shared_ptr<FontFamily>& getFamilyForCharImpl(uint32_t ch,
+                                                          uint32_t vs,
+                                                          uint32_t langListId,
+                                                          int variant) const;
+
   const std::shared_ptr<FontFamily>&
   findFallbackFont(uint32_t ch, uint32_t vs, uint32_t langListId) const;
 
@@ -157,6 +165,41 @@ class FontCollection {
   // was constructed.
   mutable std::map<std::string, std::vector<std::shared_ptr<FontFamily>>>
       mCachedFallbackFamilies;
+
+  // Key identifying one family resolution query: a character, an optional
+  // variation selector and the style inputs that affect scoring.
+  struct FamilyMatchKey {
+    uint32_t ch;
+    uint32_t vs;
+    uint32_t langListId;
+    int variant;
+
+    bool operator==(const FamilyMatchKey& other) const {
+      return ch == other.ch && vs == other.vs &&
+             langListId == other.langListId && variant == other.variant;
+    }
+  };
+
+  struct FamilyMatchKeyHasher {
+    size_t operator()(const FamilyMatchKey& key) const {
+      uint64_t hash = key.ch;
+      hash = hash * 31 + key.vs;
+      hash = hash * 31 + key.langListId;
+      hash = hash * 31 + static_cast<uint32_t>(key.variant);
+      return std::hash<uint64_t>()(hash);
+    }
+  };
+
+  // Memoized results of getFamilyForChar. Itemization consults the family
+  // match for every character that cannot extend the current run, and each
+  // miss scores every candidate family covering the character's page;
+  // mixed-script text repeats the same small set of queries constantly, so
+  // the memo removes the fonts-times-characters blowup. Guarded by
+  // gMinikinLock like mCachedFallbackFamilies.
+  mutable std::unordered_map<FamilyMatchKey,
+                             std::shared_ptr<FontFamily>,
+                             FamilyMatchKeyHasher>
+      mFamilyMatchCache;
 };
 
 }  // namespace minikin
@@ -256,4 +256,34 @@ size_t GraphemeBreak::getTextRunCursor(const float* advances,
   return offset;
 }
 
+void GraphemeBreakBitmap::build(const float* advances,
+                                const uint16_t* buf,
+                                size_t start,
+                                size_t count) {
+  start_ = start;
+  count_ = count;
+  built_ = true;
+  bits_.clear();
+  if (count < 2) {
+    return;
+  }
+  // One bit per interior offset; the range edges are handled in isBreak.
+  bits_.resize(((count - 1) + 31) / 32, 0);
+  for (size_t offset = start + 1; offset < start + count; offset++) {
+    if (GraphemeBreak::isGraphemeBreak(advances, buf, start, count, offset)) {
+      const size_t index = offset - start - 1;
+      bits_[index >> 5] |= 1u << (index & 31);
+    }
+  }
+}
+
+bool GraphemeBreakBitmap::isBreak(size_t offset) const {
+  // Rules GB1 and GB2: the edges of the range are always breaks.
+  if (offset <= start_ || offset >= start_ + count_) {
+    return true;
+  }
+  const size_t index = offset - start_ - 1;
+  return (bits_[index >> 5] >> (index & 31)) & 1;
+}
+
 }  // namespace minikin
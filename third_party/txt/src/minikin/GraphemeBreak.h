@@ -18,8 +18,11 @@
 #define MINIKIN_GRAPHEME_BREAK_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include <unicode/utf16.h>
 
+#include <vector>
+
 namespace minikin {
 
 class GraphemeBreak {
@@ -52,6 +55,37 @@ class GraphemeBreak {
                                  MoveOpt opt);
 };
 
+// Precomputed grapheme boundary bitmap for a contiguous text range.
+// isGraphemeBreak re-evaluates the break pair table on every call, which adds
+// up when layout, hit testing and cursor movement probe the same range offset
+// by offset. Building the bitmap scans the table once and turns every later
+// query into a packed-word bit lookup.
+class GraphemeBreakBitmap {
+ public:
+  GraphemeBreakBitmap() = default;
+
+  // Scans the range once and records which offsets in (start, start + count)
+  // are grapheme breaks. The advances and buffer only need to outlive the
+  // scan itself.
+  void build(const float* advances,
+             const uint16_t* buf,
+             size_t start,
+             size_t count);
+
+  bool isBuilt() const { return built_; }
+
+  // Whether the given offset is a grapheme break. Matches isGraphemeBreak on
+  // the built range, including rules GB1/GB2: offsets at or outside the range
+  // edges are breaks.
+  bool isBreak(size_t offset) const;
+
+ private:
+  bool built_ = false;
+  size_t start_ = 0;
+  size_t count_ = 0;
+  std::vector<uint32_t> bits_;
+};
+
 }  // namespace minikin
 
 #endif  // MINIKIN_GRAPHEME_BREAK_H
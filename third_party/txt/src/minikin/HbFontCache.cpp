@@ -24,15 +24,28 @@
 #include <hb-ot.h>
 #include <hb.h>
 
+#include <memory>
+#include <mutex>
+
 #include <minikin/MinikinFont.h>
 #include "MinikinInternal.h"
 
 namespace minikin {
 
+// The cache is internally synchronized and sharded by font id so that
+// concurrent lookups from multiple layout threads only contend when two
+// fonts land in the same shard. References handed out are taken under the
+// shard lock, so an eviction on another thread can never destroy a font a
+// caller is still using.
 class HbFontCache : private android::OnEntryRemoved<int32_t, hb_font_t*> {
  public:
-  HbFontCache() : mCache(kMaxEntries) {
-    mCache.setOnEntryRemovedListener(this);
+  HbFontCache() {
+    for (size_t i = 0; i < kShardCount; i++) {
+      mShards[i].cache =
+          std::make_unique<android::LruCache<int32_t, hb_font_t*>>(
+              kMaxEntries / kShardCount);
+      mShards[i].cache->setOnEntryRemovedListener(this);
+    }
   }
 
   // callback for OnEntryRemoved
@@ -40,58 +53,87 @@ class HbFontCache : private android::OnEntryRemoved<int32_t, hb_font_t*> {
     hb_font_destroy(value);
   }
 
-  hb_font_t* get(int32_t fontId) { return mCache.get(fontId); }
+  // Returns a new reference to the cached font, or nullptr on a miss.
+  hb_font_t* get(int32_t fontId) {
+    Shard& shard = shardFor(fontId);
+    std::scoped_lock lock(shard.mutex);
+    hb_font_t* font = shard.cache->get(fontId);
+    return font == nullptr ? nullptr : hb_font_reference(font);
+  }
 
-  void put(int32_t fontId, hb_font_t* font) { mCache.put(fontId, font); }
+  // Inserts |font|, taking ownership of it, and returns a new reference to
+  // the cached entry. If another thread already cached a font for |fontId|,
+  // the existing entry wins and |font| is destroyed.
+  hb_font_t* putAndGet(int32_t fontId, hb_font_t* font) {
+    Shard& shard = shardFor(fontId);
+    std::scoped_lock lock(shard.mutex);
+    hb_font_t* existing = shard.cache->get(fontId);
+    if (existing != nullptr) {
+      hb_font_destroy(font);
+      return hb_font_reference(existing);
+    }
+    shard.cache->put(fontId, font);
+    return hb_font_reference(font);
+  }
 
-  void clear() { mCache.clear(); }
+  void clear() {
+    for (size_t i = 0; i < kShardCount; i++) {
+      std::scoped_lock lock(mShards[i].mutex);
+      mShards[i].cache->clear();
+    }
+  }
 
-  void remove(int32_t fontId) { mCache.remove(fontId); }
+  void remove(int32_t fontId) {
+    Shard& shard = shardFor(fontId);
+    std::scoped_lock lock(shard.mutex);
+    shard.cache->remove(fontId);
+  }
 
  private:
-  static const size_t kMaxEntries = 100;
+  struct Shard {
+    std::mutex mutex;
+    std::unique_ptr<android::LruCache<int32_t, hb_font_t*>> cache;
+  };
+
+  Shard& shardFor(int32_t fontId) {
+    return mShards[static_cast<uint32_t>(fontId) & (kShardCount - 1)];
+  }
+
+  // Must be a power of two so the shard can be selected with a mask.
+  static const size_t kShardCount = 8;
+  static const size_t kMaxEntries = 128;
 
-  android::LruCache<int32_t, hb_font_t*> mCache;
+  Shard mShards[kShardCount];
 };
 
-HbFontCache* getFontCacheLocked() {
-  assertMinikinLocked();
-  static HbFontCache* cache = nullptr;
-  if (cache == nullptr) {
-    cache = new HbFontCache();
-  }
+static HbFontCache* getFontCache() {
+  static HbFontCache* cache = new HbFontCache();
   return cache;
 }
 
-void purgeHbFontCacheLocked() {
-  assertMinikinLocked();
-  getFontCacheLocked()->clear();
+void purgeHbFontCache() {
+  getFontCache()->clear();
 }
 
-void purgeHbFontLocked(const MinikinFont* minikinFont) {
-  assertMinikinLocked();
+void purgeHbFont(const MinikinFont* minikinFont) {
   const int32_t fontId = minikinFont->GetUniqueId();
-  getFontCacheLocked()->remove(fontId);
+  getFontCache()->remove(fontId);
 }
 
 // Returns a new reference to a hb_font_t object, caller is
 // responsible for calling hb_font_destroy() on it.
-hb_font_t* getHbFontLocked(const MinikinFont* minikinFont) {
-  assertMinikinLocked();
+hb_font_t* getHbFont(const MinikinFont* minikinFont) {
   // TODO: get rid of nullFaceFont
-  static hb_font_t* nullFaceFont = nullptr;
   if (minikinFont == nullptr) {
-    if (nullFaceFont == nullptr) {
-      nullFaceFont = hb_font_create(nullptr);
-    }
+    static hb_font_t* nullFaceFont = hb_font_create(nullptr);
     return hb_font_reference(nullFaceFont);
   }
 
-  HbFontCache* fontCache = getFontCacheLocked();
+  HbFontCache* fontCache = getFontCache();
   const int32_t fontId = minikinFont->GetUniqueId();
   hb_font_t* font = fontCache->get(fontId);
   if (font != nullptr) {
-    return hb_font_reference(font);
+    return font;
   }
 
   hb_face_t* face = minikinFont->CreateHarfBuzzFace();
@@ -110,8 +152,7 @@ hb_font_t* getHbFontLocked(const MinikinFont* minikinFont) {
   hb_font_set_variations(font, variations.data(), variations.size());
   hb_font_destroy(parent_font);
   hb_face_destroy(face);
-  fontCache->put(fontId, font);
-  return hb_font_reference(font);
+  return fontCache->putAndGet(fontId, font);
 }
 
 }  // namespace minikin
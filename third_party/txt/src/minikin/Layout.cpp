@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>  // for debugging
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -129,35 +131,103 @@ class LayoutCacheKey {
   android::hash_t computeHash() const;
 };
 
+// The cache is sharded by key hash with a lock per shard so that concurrent
+// layout from multiple threads only contends when two words land in the same
+// shard. Cache hits take just the shard lock; the global Minikin lock is only
+// acquired to shape a word on a miss, since HarfBuzz shaping still shares
+// state guarded by it.
 class LayoutCache : private android::OnEntryRemoved<LayoutCacheKey, Layout*> {
  public:
-  LayoutCache() : mCache(kMaxEntries) {
-    mCache.setOnEntryRemovedListener(this);
+  LayoutCache() {
+    for (size_t i = 0; i < kShardCount; i++) {
+      mShards[i].cache =
+          std::make_unique<android::LruCache<LayoutCacheKey, Layout*>>(
+              kMaxEntries / kShardCount);
+      mShards[i].cache->setOnEntryRemovedListener(this);
+    }
   }
 
-  void clear() { mCache.clear(); }
-
-  Layout* get(LayoutCacheKey& key,
-              LayoutContext* ctx,
-              const std::shared_ptr<FontCollection>& collection) {
-    Layout* layout = mCache.get(key);
-    if (layout == NULL) {
-      key.copyText();
-      layout = new Layout();
-      key.doLayout(layout, ctx, collection);
-      mCache.put(key, layout);
+  void clear() {
+    for (size_t i = 0; i < kShardCount; i++) {
+      std::scoped_lock lock(mShards[i].mutex);
+      mShards[i].cache->clear();
     }
-    return layout;
+  }
+
+  // Applies the layout for |key| to the output arguments, shaping and caching
+  // the word on a miss. Returns the advance of the word.
+  float getAndApply(LayoutCacheKey& key,
+                    LayoutContext* ctx,
+                    const std::shared_ptr<FontCollection>& collection,
+                    Layout* layout,
+                    float* advances,
+                    size_t bufStart,
+                    float wordSpacing) {
+    Shard& shard = mShards[key.hash() & (kShardCount - 1)];
+    {
+      std::scoped_lock lock(shard.mutex);
+      Layout* cached = shard.cache->get(key);
+      if (cached != NULL) {
+        // The cached layout may be evicted and deleted as soon as the shard
+        // lock is dropped, so it is consumed under the lock and never escapes.
+        return applyLayout(cached, layout, advances, bufStart, wordSpacing);
+      }
+    }
+
+    // Shape the word without holding the shard lock. Only one lock is held at
+    // a time, which keeps the lock order with the purge paths trivial.
+    Layout* layoutForWord = new Layout();
+    {
+      std::scoped_lock _l(gMinikinLock);
+      key.doLayout(layoutForWord, ctx, collection);
+    }
+    float advance =
+        applyLayout(layoutForWord, layout, advances, bufStart, wordSpacing);
+
+    key.copyText();
+    {
+      std::scoped_lock lock(shard.mutex);
+      if (shard.cache->get(key) != NULL) {
+        // Another thread shaped and cached the same word in the meantime.
+        key.freeText();
+        delete layoutForWord;
+      } else {
+        shard.cache->put(key, layoutForWord);
+      }
+    }
+    return advance;
   }
 
  private:
+  struct Shard {
+    std::mutex mutex;
+    std::unique_ptr<android::LruCache<LayoutCacheKey, Layout*>> cache;
+  };
+
+  static float applyLayout(Layout* layoutForWord,
+                           Layout* layout,
+                           float* advances,
+                           size_t bufStart,
+                           float wordSpacing) {
+    if (layout) {
+      layout->appendLayout(layoutForWord, bufStart, wordSpacing);
+    }
+    if (advances) {
+      layoutForWord->getAdvances(advances);
+    }
+    return layoutForWord->getAdvance();
+  }
+
   // callback for OnEntryRemoved
   void operator()(LayoutCacheKey& key, Layout*& value) {
     key.freeText();
     delete value;
   }
 
-  android::LruCache<LayoutCacheKey, Layout*> mCache;
+  // Must be a power of two so the shard can be selected with a mask.
+  static const size_t kShardCount = 16;
+
+  Shard mShards[kShardCount];
 
   // static const size_t kMaxEntries = LruCache<LayoutCacheKey,
   // Layout*>::kUnlimitedCapacity;
@@ -171,11 +241,50 @@ class LayoutEngine {
  public:
   LayoutEngine() {
     unicodeFunctions = hb_unicode_funcs_create(hb_icu_get_unicode_funcs());
-    hbBuffer = hb_buffer_create();
-    hb_buffer_set_unicode_funcs(hbBuffer, unicodeFunctions);
   }
 
-  hb_buffer_t* hbBuffer;
+  // Scoped lease on a pooled HarfBuzz buffer. Buffers keep their internal
+  // allocations across uses, so a run shaped with a pooled buffer skips the
+  // allocation and unicode-funcs setup a freshly created buffer would pay.
+  class ScopedHbBuffer {
+   public:
+    ScopedHbBuffer(ScopedHbBuffer&& other) : mBuffer(other.mBuffer) {
+      other.mBuffer = nullptr;
+    }
+
+    ~ScopedHbBuffer() {
+      if (mBuffer != nullptr) {
+        LayoutEngine::getInstance().releaseHbBuffer(mBuffer);
+      }
+    }
+
+    hb_buffer_t* get() const { return mBuffer; }
+
+    ScopedHbBuffer(const ScopedHbBuffer&) = delete;
+    ScopedHbBuffer& operator=(const ScopedHbBuffer&) = delete;
+
+   private:
+    friend class LayoutEngine;
+
+    explicit ScopedHbBuffer(hb_buffer_t* buffer) : mBuffer(buffer) {}
+
+    hb_buffer_t* mBuffer;
+  };
+
+  ScopedHbBuffer acquireHbBuffer() {
+    {
+      std::scoped_lock lock(mBufferPoolMutex);
+      if (!mFreeBuffers.empty()) {
+        hb_buffer_t* buffer = mFreeBuffers.back();
+        mFreeBuffers.pop_back();
+        return ScopedHbBuffer(buffer);
+      }
+    }
+    hb_buffer_t* buffer = hb_buffer_create();
+    hb_buffer_set_unicode_funcs(buffer, unicodeFunctions);
+    return ScopedHbBuffer(buffer);
+  }
+
   hb_unicode_funcs_t* unicodeFunctions;
   LayoutCache layoutCache;
 
@@ -183,6 +292,26 @@ class LayoutEngine {
     static LayoutEngine* instance = new LayoutEngine();
     return *instance;
   }
+
+ private:
+  // Enough for the typical depth of concurrent shapers; excess buffers are
+  // destroyed rather than pooled.
+  static const size_t kMaxPooledBuffers = 4;
+
+  void releaseHbBuffer(hb_buffer_t* buffer) {
+    hb_buffer_clear_contents(buffer);
+    {
+      std::scoped_lock lock(mBufferPoolMutex);
+      if (mFreeBuffers.size() < kMaxPooledBuffers) {
+        mFreeBuffers.push_back(buffer);
+        return;
+      }
+    }
+    hb_buffer_destroy(buffer);
+  }
+
+  std::mutex mBufferPoolMutex;
+  std::vector<hb_buffer_t*> mFreeBuffers;
 };
 
 bool LayoutCacheKey::operator==(const LayoutCacheKey& other) const {
@@ -316,7 +445,7 @@ int Layout::findFace(const FakedFont& face, LayoutContext* ctx) {
   // Note: ctx == NULL means we're copying from the cache, no need to create
   // corresponding hb_font object.
   if (ctx != NULL) {
-    hb_font_t* font = getHbFontLocked(face.font);
+    hb_font_t* font = getHbFont(face.font);
     hb_font_set_funcs(font, getHbFontFuncs(isColorBitmapFont(font)),
                       &ctx->paint, 0);
     ctx->hbFonts.push_back(font);
@@ -588,8 +717,6 @@ void Layout::doLayout(const uint16_t* buf,
                       const FontStyle& style,
                       const MinikinPaint& paint,
                       const std::shared_ptr<FontCollection>& collection) {
-  std::scoped_lock _l(gMinikinLock);
-
   LayoutContext ctx;
   ctx.style = style;
   ctx.paint = paint;
@@ -600,6 +727,7 @@ void Layout::doLayout(const uint16_t* buf,
   doLayoutRunCached(buf, start, count, bufSize, isRtl, &ctx, start, collection,
                     this, NULL);
 
+  std::scoped_lock _l(gMinikinLock);
   ctx.clearHbFonts();
 }
 
@@ -612,8 +740,6 @@ float Layout::measureText(const uint16_t* buf,
                           const MinikinPaint& paint,
                           const std::shared_ptr<FontCollection>& collection,
                           float* advances) {
-  std::scoped_lock _l(gMinikinLock);
-
   LayoutContext ctx;
   ctx.style = style;
   ctx.paint = paint;
@@ -621,6 +747,7 @@ float Layout::measureText(const uint16_t* buf,
   float advance = doLayoutRunCached(buf, start, count, bufSize, isRtl, &ctx, 0,
                                     collection, NULL, advances);
 
+  std::scoped_lock _l(gMinikinLock);
   ctx.clearHbFonts();
   return advance;
 }
@@ -711,7 +838,10 @@ float Layout::doLayoutWord(const uint16_t* buf,
   float advance;
   if (ctx->paint.skipCache()) {
     Layout layoutForWord;
-    key.doLayout(&layoutForWord, ctx, collection);
+    {
+      std::scoped_lock _l(gMinikinLock);
+      key.doLayout(&layoutForWord, ctx, collection);
+    }
     if (layout) {
       layout->appendLayout(&layoutForWord, bufStart, wordSpacing);
     }
@@ -720,14 +850,8 @@ float Layout::doLayoutWord(const uint16_t* buf,
     }
     advance = layoutForWord.getAdvance();
   } else {
-    Layout* layoutForWord = cache.get(key, ctx, collection);
-    if (layout) {
-      layout->appendLayout(layoutForWord, bufStart, wordSpacing);
-    }
-    if (advances) {
-      layoutForWord->getAdvances(advances);
-    }
-    advance = layoutForWord->getAdvance();
+    advance = cache.getAndApply(key, ctx, collection, layout, advances,
+                                bufStart, wordSpacing);
   }
 
   if (wordSpacing != 0) {
@@ -919,7 +1043,9 @@ void Layout::doLayoutRun(const uint16_t* buf,
                          bool isRtl,
                          LayoutContext* ctx,
                          const std::shared_ptr<FontCollection>& collection) {
-  hb_buffer_t* buffer = LayoutEngine::getInstance().hbBuffer;
+  LayoutEngine::ScopedHbBuffer pooledBuffer =
+      LayoutEngine::getInstance().acquireHbBuffer();
+  hb_buffer_t* buffer = pooledBuffer.get();
   std::vector<FontCollection::Run> items;
   collection->itemize(buf + start, count, ctx->style, &items);
 
@@ -1193,10 +1319,9 @@ void Layout::getBounds(MinikinRect* bounds) const {
 }
 
 void Layout::purgeCaches() {
-  std::scoped_lock _l(gMinikinLock);
   LayoutCache& layoutCache = LayoutEngine::getInstance().layoutCache;
   layoutCache.clear();
-  purgeHbFontCacheLocked();
+  purgeHbFontCache();
 }
 
 }  // namespace minikin
@@ -19,12 +19,17 @@
 #define LOG_TAG "Minikin"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
+#include <mutex>
+#include <string>
 
 #include <log/log.h>
 
 #include <minikin/Layout.h>
 #include <minikin/LineBreaker.h>
+#include <utils/JenkinsHash.h>
+#include <utils/LruCache.h>
 #include <utils/WindowsUtils.h>
 #include "LayoutUtils.h"
 
@@ -32,6 +37,125 @@ using std::vector;
 
 namespace minikin {
 
+namespace {
+
+// Key for the hyphenation cache below: a word together with the hyphenator
+// and locale that pattern-walk it. Follows the same text ownership protocol
+// as LayoutCacheKey: keys used only for lookup reference the caller's buffer,
+// and copyText() is called before a key is stored.
+class HyphenationCacheKey {
+ public:
+  HyphenationCacheKey() : mHyphenator(nullptr), mChars(nullptr), mNchars(0) {}
+
+  HyphenationCacheKey(const Hyphenator* hyphenator,
+                      const icu::Locale& locale,
+                      const uint16_t* chars,
+                      size_t nchars)
+      : mHyphenator(hyphenator),
+        mLocaleName(locale.getName()),
+        mChars(chars),
+        mNchars(nchars) {
+    mHash = computeHash();
+  }
+
+  bool operator==(const HyphenationCacheKey& other) const {
+    return mHyphenator == other.mHyphenator &&
+           mLocaleName == other.mLocaleName && mNchars == other.mNchars &&
+           memcmp(mChars, other.mChars, mNchars * sizeof(uint16_t)) == 0;
+  }
+
+  android::hash_t hash() const { return mHash; }
+
+  void copyText() {
+    uint16_t* charsCopy = new uint16_t[mNchars];
+    memcpy(charsCopy, mChars, mNchars * sizeof(uint16_t));
+    mChars = charsCopy;
+  }
+
+  void freeText() {
+    delete[] mChars;
+    mChars = nullptr;
+  }
+
+ private:
+  android::hash_t computeHash() const {
+    uint32_t hash = android::JenkinsHashMix(0, android::hash_type(mHyphenator));
+    hash = android::JenkinsHashMixBytes(
+        hash, reinterpret_cast<const uint8_t*>(mLocaleName.data()),
+        mLocaleName.size());
+    hash = android::JenkinsHashMixShorts(hash, mChars, mNchars);
+    return android::JenkinsHashWhiten(hash);
+  }
+
+  const Hyphenator* mHyphenator;
+  std::string mLocaleName;
+  const uint16_t* mChars;
+  size_t mNchars;
+  android::hash_t mHash;
+};
+
+android::hash_t hash_type(const HyphenationCacheKey& key) {
+  return key.hash();
+}
+
+// A process-wide cache of hyphenation results. Words repeat heavily within
+// and across paragraphs, so relayout of long articles mostly stops walking
+// the hyphenator's pattern trie.
+class HyphenationCache
+    : private android::OnEntryRemoved<HyphenationCacheKey,
+                                      std::vector<HyphenationType>*> {
+ public:
+  static HyphenationCache& getInstance() {
+    static HyphenationCache* instance = new HyphenationCache();
+    return *instance;
+  }
+
+  // Copies the cached result for the key into *result and returns true, or
+  // returns false on a miss.
+  bool get(const HyphenationCacheKey& key,
+           std::vector<HyphenationType>* result) {
+    std::scoped_lock lock(mMutex);
+    std::vector<HyphenationType>* value = mCache.get(key);
+    if (value == nullptr) {
+      return false;
+    }
+    *result = *value;
+    return true;
+  }
+
+  void put(HyphenationCacheKey& key,
+           const std::vector<HyphenationType>& result) {
+    std::scoped_lock lock(mMutex);
+    if (mCache.get(key) != nullptr) {
+      // Lost a race with another thread hyphenating the same word.
+      return;
+    }
+    key.copyText();
+    mCache.put(key, new std::vector<HyphenationType>(result));
+  }
+
+ private:
+  HyphenationCache() : mCache(kMaxEntries) {
+    mCache.setOnEntryRemovedListener(this);
+  }
+
+  // callback for OnEntryRemoved
+  void operator()(HyphenationCacheKey& key,
+                  std::vector<HyphenationType>*& value) {
+    key.freeText();
+    delete value;
+  }
+
+  // Words are at most LONGEST_HYPHENATED_WORD code units, so the worst-case
+  // footprint stays modest.
+  static const size_t kMaxEntries = 4096;
+
+  std::mutex mMutex;
+  android::LruCache<HyphenationCacheKey, std::vector<HyphenationType>*> mCache;
+};
+
+}  // namespace
+
 // Large scores in a hierarchy; we prefer desperate breaks to an overfull line.
 // All these constants are larger than any reasonable actual width score.
 const float SCORE_INFTY = std::numeric_limits<float>::max();
@@ -172,8 +296,14 @@ float LineBreaker::addStyleRun(MinikinPaint* paint,
           mHyphenationFrequency != kHyphenationFrequency_None &&
           wordStart >= start && wordEnd > wordStart &&
           wordEnd - wordStart <= LONGEST_HYPHENATED_WORD) {
-        mHyphenator->hyphenate(&mHyphBuf, &mTextBuf[wordStart],
-                               wordEnd - wordStart, mLocale);
+        HyphenationCacheKey hyphKey(mHyphenator, mLocale,
+                                    &mTextBuf[wordStart],
+                                    wordEnd - wordStart);
+        if (!HyphenationCache::getInstance().get(hyphKey, &mHyphBuf)) {
+          mHyphenator->hyphenate(&mHyphBuf, &mTextBuf[wordStart],
+                                 wordEnd - wordStart, mLocale);
+          HyphenationCache::getInstance().put(hyphKey, mHyphBuf);
+        }
 #if VERBOSE_DEBUG
         std::string hyphenatedString;
         for (size_t j = wordStart; j < wordEnd; j++) {
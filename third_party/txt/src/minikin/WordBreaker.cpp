@@ -21,16 +21,103 @@
 #include <minikin/Emoji.h>
 #include <minikin/Hyphenator.h>
 #include <minikin/WordBreaker.h>
+#include <utils/JenkinsHash.h>
 #include "MinikinInternal.h"
 
 #include <unicode/uchar.h>
 #include <unicode/utf16.h>
 
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
 namespace minikin {
 
 const uint32_t CHAR_SOFT_HYPHEN = 0x00AD;
 const uint32_t CHAR_ZWJ = 0x200D;
 
+namespace {
+
+// A small global cache of completed word-break sequences, keyed by locale and
+// text. Relaying out an unchanged paragraph (say, after a style change) hits
+// here and never runs the ICU break iterator. Entries own a copy of their
+// text, so a hit requires an exact match, and records are handed out as
+// shared pointers so eviction cannot invalidate an in-progress replay.
+class WordBreakCache {
+ public:
+  static WordBreakCache& getInstance() {
+    static WordBreakCache* instance = new WordBreakCache();
+    return *instance;
+  }
+
+  std::shared_ptr<const WordBreakRecord> get(const std::string& localeName,
+                                             const uint16_t* text,
+                                             size_t size) {
+    const uint32_t hash = computeHash(localeName, text, size);
+    std::scoped_lock lock(mMutex);
+    auto it = mEntries.find(hash);
+    if (it == mEntries.end() || it->second.localeName != localeName ||
+        it->second.text.size() != size ||
+        memcmp(it->second.text.data(), text, size * sizeof(uint16_t)) != 0) {
+      return nullptr;
+    }
+    it->second.lastUse = ++mUseCounter;
+    return it->second.record;
+  }
+
+  void put(const std::string& localeName,
+           const uint16_t* text,
+           size_t size,
+           std::shared_ptr<const WordBreakRecord> record) {
+    const uint32_t hash = computeHash(localeName, text, size);
+    std::scoped_lock lock(mMutex);
+    if (mEntries.size() >= kMaxEntries &&
+        mEntries.find(hash) == mEntries.end()) {
+      // Evict the least recently used entry.
+      auto oldest = mEntries.begin();
+      for (auto it = mEntries.begin(); it != mEntries.end(); ++it) {
+        if (it->second.lastUse < oldest->second.lastUse) {
+          oldest = it;
+        }
+      }
+      mEntries.erase(oldest);
+    }
+    Entry& entry = mEntries[hash];
+    entry.localeName = localeName;
+    entry.text.assign(text, text + size);
+    entry.record = std::move(record);
+    entry.lastUse = ++mUseCounter;
+  }
+
+ private:
+  struct Entry {
+    std::string localeName;
+    std::vector<uint16_t> text;
+    std::shared_ptr<const WordBreakRecord> record;
+    uint64_t lastUse = 0;
+  };
+
+  static uint32_t computeHash(const std::string& localeName,
+                              const uint16_t* text,
+                              size_t size) {
+    uint32_t hash = android::JenkinsHashMixBytes(
+        0, reinterpret_cast<const uint8_t*>(localeName.data()),
+        localeName.size());
+    hash = android::JenkinsHashMixShorts(hash, text, size);
+    return android::JenkinsHashWhiten(hash);
+  }
+
+  // Texts can be whole articles, so keep the number of retained copies small.
+  static const size_t kMaxEntries = 8;
+
+  std::mutex mMutex;
+  std::unordered_map<uint32_t, Entry> mEntries;
+  uint64_t mUseCounter = 0;
+};
+
+}  // namespace
+
 void WordBreaker::setLocale(const icu::Locale& locale) {
   UErrorCode status = U_ZERO_ERROR;
   mBreakIterator.reset(icu::BreakIterator::createLineInstance(locale, status));
@@ -39,6 +126,17 @@ void WordBreaker::setLocale(const icu::Locale& locale) {
     mBreakIterator->setText(&mUText, status);
   }
   mIteratorWasReset = true;
+
+  const std::string localeName = locale.getName();
+  if (mText != nullptr && localeName != mLocaleName) {
+    // A locale change in the middle of the text invalidates the memoized
+    // sequence: stop replaying and fall back to live iteration, and drop any
+    // recording since it would not describe a single-locale run.
+    mReplay.reset();
+    mReplayBreak = nullptr;
+    mRecording.reset();
+  }
+  mLocaleName = localeName;
 }
 
 void WordBreaker::setText(const uint16_t* data, size_t size) {
@@ -54,6 +152,15 @@ void WordBreaker::setText(const uint16_t* data, size_t size) {
                    &status);
   mBreakIterator->setText(&mUText, status);
   mBreakIterator->first();
+
+  mReplay = WordBreakCache::getInstance().get(mLocaleName, data, size);
+  mReplayIndex = 0;
+  mReplayBreak = nullptr;
+  if (mReplay == nullptr) {
+    mRecording = std::make_shared<WordBreakRecord>();
+  } else {
+    mRecording.reset();
+  }
 }
 
 ssize_t WordBreaker::current() const {
@@ -219,7 +326,38 @@ ssize_t WordBreaker::findNextBreakInEmailOrUrl() {
   return i;
 }
 
+ssize_t WordBreaker::replayNext() {
+  mLast = mCurrent;
+  if (mReplayIndex < mReplay->breaks.size()) {
+    mReplayBreak = &mReplay->breaks[mReplayIndex++];
+    mCurrent = mReplayBreak->offset;
+  } else {
+    mReplayBreak = nullptr;
+    mCurrent = -1;
+  }
+  return mCurrent;
+}
+
+void WordBreaker::recordBreak() {
+  if (mRecording == nullptr) {
+    return;
+  }
+  mRecording->breaks.push_back(
+      {mCurrent, wordStart(), wordEnd(), breakBadness()});
+  // Only a complete iteration describes the text; publish it then, and drop
+  // partial recordings when the caller stops early.
+  if (mCurrent < 0 || (size_t)mCurrent == mTextSize) {
+    WordBreakCache::getInstance().put(mLocaleName, mText, mTextSize,
+                                      mRecording);
+    mRecording.reset();
+  }
+}
+
 ssize_t WordBreaker::next() {
+  if (mReplay != nullptr) {
+    return replayNext();
+  }
+
   mLast = mCurrent;
 
   detectEmailOrUrl();
@@ -228,10 +366,14 @@ ssize_t WordBreaker::next() {
   } else {  // Business as usual
     mCurrent = (ssize_t)iteratorNext();
   }
+  recordBreak();
   return mCurrent;
 }
 
 ssize_t WordBreaker::wordStart() const {
+  if (mReplayBreak != nullptr) {
+    return mReplayBreak->wordStart;
+  }
   if (mInEmailOrUrl) {
     return mLast;
   }
@@ -252,6 +394,9 @@ ssize_t WordBreaker::wordStart() const {
 }
 
 ssize_t WordBreaker::wordEnd() const {
+  if (mReplayBreak != nullptr) {
+    return mReplayBreak->wordEnd;
+  }
   if (mInEmailOrUrl) {
     return mLast;
   }
@@ -271,11 +416,17 @@ ssize_t WordBreaker::wordEnd() const {
 }
 
 int WordBreaker::breakBadness() const {
+  if (mReplayBreak != nullptr) {
+    return mReplayBreak->badness;
+  }
   return (mInEmailOrUrl && mCurrent < mScanOffset) ? 1 : 0;
 }
 
 void WordBreaker::finish() {
   mText = nullptr;
+  mReplay.reset();
+  mReplayBreak = nullptr;
+  mRecording.reset();
   // Note: calling utext_close multiply is safe
   utext_close(&mUText);
 }
@@ -24,11 +24,26 @@
 #define MINIKIN_WORD_BREAKER_H
 
 #include <memory>
+#include <string>
+#include <vector>
 #include "unicode/brkiter.h"
 #include "utils/WindowsUtils.h"
 
 namespace minikin {
 
+// A memoized sequence of word-break results for one locale and text. Records
+// are built while iterating a text for the first time and replayed on
+// subsequent layouts of the same text, skipping ICU break iteration entirely.
+struct WordBreakRecord {
+  struct Break {
+    ssize_t offset;
+    ssize_t wordStart;
+    ssize_t wordEnd;
+    int badness;
+  };
+  std::vector<Break> breaks;
+};
+
 class WordBreaker {
  public:
   ~WordBreaker() { finish(); }
@@ -58,6 +73,8 @@ class WordBreaker {
   int32_t iteratorNext();
   void detectEmailOrUrl();
   ssize_t findNextBreakInEmailOrUrl();
+  ssize_t replayNext();
+  void recordBreak();
 
   std::unique_ptr<icu::BreakIterator> mBreakIterator;
   UText mUText = UTEXT_INITIALIZER;
@@ -70,6 +87,21 @@ class WordBreaker {
   // state for the email address / url detector
   ssize_t mScanOffset;
   bool mInEmailOrUrl;
+
+  // The name of the locale the break iterator was created for; part of the
+  // memoization key.
+  std::string mLocaleName;
+
+  // When non-null, a memoized break sequence for the current locale and text
+  // that next() replays instead of running the ICU break iterator.
+  std::shared_ptr<const WordBreakRecord> mReplay;
+  size_t mReplayIndex = 0;
+  const WordBreakRecord::Break* mReplayBreak = nullptr;
+
+  // When non-null, the break sequence being recorded for memoization. It is
+  // published once the whole text has been iterated and dropped if iteration
+  // stops early or the locale changes mid-text.
+  std::shared_ptr<WordBreakRecord> mRecording;
 };
 
 }  // namespace minikin
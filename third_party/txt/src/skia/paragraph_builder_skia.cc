@@ -141,7 +141,8 @@ ParagraphBuilderSkia::ParagraphBuilderSkia(
     : builder_(skt::ParagraphBuilder::make(
           TxtToSkia(style),
           font_collection->CreateSktFontCollection())),
-      base_style_(style.GetTextStyle()) {}
+      base_style_(style.GetTextStyle()),
+      font_collection_(std::move(font_collection)) {}
 
 ParagraphBuilderSkia::~ParagraphBuilderSkia() = default;
 
@@ -179,4 +180,14 @@ std::unique_ptr<Paragraph> ParagraphBuilderSkia::Build() {
   return std::make_unique<ParagraphSkia>(builder_->Build());
 }
 
+void ParagraphBuilderSkia::Reset(const ParagraphStyle& style) {
+  // Skia's builder does not expose a way to clear its internals in place, so
+  // a fresh one is made; the font collection binding is still reused, which
+  // avoids rebuilding the skia font collection wrapper.
+  builder_ = skt::ParagraphBuilder::make(
+      TxtToSkia(style), font_collection_->CreateSktFontCollection());
+  base_style_ = style.GetTextStyle();
+  txt_style_stack_ = std::stack<TextStyle>();
+}
+
 }  // namespace txt
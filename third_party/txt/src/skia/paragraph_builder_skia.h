@@ -37,11 +37,13 @@ class ParagraphBuilderSkia : public ParagraphBuilder {
   virtual void AddText(const std::u16string& text) override;
   virtual void AddPlaceholder(PlaceholderRun& span) override;
   virtual std::unique_ptr<Paragraph> Build() override;
+  virtual void Reset(const ParagraphStyle& style) override;
 
  private:
   std::shared_ptr<skia::textlayout::ParagraphBuilder> builder_;
   TextStyle base_style_;
   std::stack<TextStyle> txt_style_stack_;
+  std::shared_ptr<FontCollection> font_collection_;
 };
 
 }  // namespace txt
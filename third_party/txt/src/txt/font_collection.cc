@@ -29,6 +29,7 @@
 #include "font_skia.h"
 #include "txt/platform.h"
 #include "txt/text_style.h"
+#include "txt/typeface_registry.h"
 
 namespace txt {
 
@@ -82,7 +83,11 @@ class TxtFallbackFontProvider
 
 FontCollection::FontCollection() : enable_font_fallback_(true) {}
 
-FontCollection::~FontCollection() = default;
+FontCollection::~FontCollection() {
+  // Font data this collection registered stays shared while other collections
+  // still reference it; entries only this collection kept alive are dropped.
+  TypefaceRegistry::GetInstance().PurgeUnreferenced();
+}
 
 size_t FontCollection::GetFontManagersCount() const {
   return GetFontManagerOrder().size();
@@ -219,7 +224,10 @@ std::shared_ptr<minikin::FontFamily> FontCollection::CreateMinikinFontFamily(
     sk_sp<SkTypeface> skia_typeface(
         sk_sp<SkTypeface>(font_style_set->createTypeface(i)));
     if (skia_typeface != nullptr) {
-      skia_typefaces.emplace_back(std::move(skia_typeface));
+      // Collapse typefaces over identical font data onto one instance so
+      // collections in other engines share it rather than re-loading it.
+      skia_typefaces.emplace_back(TypefaceRegistry::GetInstance().Deduplicate(
+          std::move(skia_typeface)));
     }
   }
 
@@ -102,4 +102,8 @@ void PaintRecord::SetOffset(SkPoint pt) {
   offset_ = pt;
 }
 
+void PaintRecord::SetText(sk_sp<SkTextBlob> text) {
+  text_ = std::move(text);
+}
+
 }  // namespace txt
@@ -70,8 +70,13 @@ class PaintRecord {
 
   void SetOffset(SkPoint pt);
 
+  // The text blob may be null for records whose glyphs were merged into the
+  // blob of an earlier record that paints identically; such records still
+  // carry their own metrics, offsets and style for decorations and queries.
   SkTextBlob* text() const { return text_.get(); }
 
+  void SetText(sk_sp<SkTextBlob> text);
+
   const SkFontMetrics& metrics() const { return metrics_; }
 
   const TextStyle& style() const { return style_; }
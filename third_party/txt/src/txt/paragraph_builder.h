@@ -79,6 +79,11 @@ class ParagraphBuilder {
   // to a SkCanvas.
   virtual std::unique_ptr<Paragraph> Build() = 0;
 
+  // Returns the builder to the state of a freshly constructed one with the
+  // given paragraph style, retaining the font collection binding and any
+  // allocated buffers so the builder can be reused without reallocation.
+  virtual void Reset(const ParagraphStyle& style) = 0;
+
  protected:
   ParagraphBuilder() = default;
 
@@ -81,4 +81,15 @@ std::unique_ptr<Paragraph> ParagraphBuilderTxt::Build() {
   return paragraph;
 }
 
+void ParagraphBuilderTxt::Reset(const ParagraphStyle& style) {
+  // clear() keeps the capacity of the containers so a recycled builder does
+  // not pay the allocation cost of growing them again.
+  text_.clear();
+  inline_placeholders_.clear();
+  obj_replacement_char_indexes_.clear();
+  style_stack_.clear();
+  runs_.Reset();
+  SetParagraphStyle(style);
+}
+
 }  // namespace txt
@@ -35,6 +35,7 @@
 #include "minikin/LayoutUtils.h"
 #include "minikin/LineBreaker.h"
 #include "minikin/MinikinFont.h"
+#include "run_layout_cache.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkFont.h"
 #include "third_party/skia/include/core/SkFontMetrics.h"
@@ -166,6 +167,33 @@ void GetFontAndMinikinPaint(const TextStyle& style,
   paint->fontFeatureSettings = style.font_features.GetFeatureSettings();
 }
 
+// Whether two styles shape identically, i.e. they differ at most in
+// paint-only attributes such as color, decorations, shadows or backgrounds.
+// Contiguous runs whose styles shape identically can share the minikin font,
+// paint and font collection computed for the first of them, which is what
+// keeps paragraphs with many inline color spans from paying per-span shaping
+// setup.
+bool SharesShapingStyle(const TextStyle& a, const TextStyle& b) {
+  return a.font_weight == b.font_weight && a.font_style == b.font_style &&
+         a.font_size == b.font_size && a.letter_spacing == b.letter_spacing &&
+         a.word_spacing == b.word_spacing && a.locale == b.locale &&
+         a.font_families == b.font_families &&
+         a.font_features.GetFeatureSettings() ==
+             b.font_features.GetFeatureSettings();
+}
+
+// Whether two styles fill their glyphs with the same SkPaint. Records whose
+// styles paint identically (and carry no shadows, which need a blob of their
+// own) can have their glyphs merged into a single text blob and be drawn with
+// one drawTextBlob call.
+bool PaintsIdentically(const TextStyle& a, const TextStyle& b) {
+  if (a.has_foreground || b.has_foreground) {
+    return a.has_foreground && b.has_foreground &&
+           a.foreground == b.foreground;
+  }
+  return a.color == b.color;
+}
+
 void FindWords(const std::vector<uint16_t>& text,
                size_t start,
                size_t end,
@@ -297,6 +325,10 @@ bool ParagraphTxt::ComputeLineBreaks() {
 
     // Add the runs that include this line to the LineBreaker.
     double block_total_width = 0;
+    minikin::FontStyle font;
+    minikin::MinikinPaint paint;
+    std::shared_ptr<minikin::FontCollection> collection;
+    const TextStyle* shaping_style = nullptr;
     while (run_index < runs_.size()) {
       StyledRuns::Run run = runs_.GetRun(run_index);
       if (run.start >= block_end)
@@ -306,11 +338,14 @@ bool ParagraphTxt::ComputeLineBreaks() {
         continue;
       }
 
-      minikin::FontStyle font;
-      minikin::MinikinPaint paint;
-      GetFontAndMinikinPaint(run.style, &font, &paint);
-      std::shared_ptr<minikin::FontCollection> collection =
-          GetMinikinFontCollectionForStyle(run.style);
+      // Contiguous runs that shape identically (spans differing only in
+      // paint attributes) share one conversion and collection lookup.
+      if (shaping_style == nullptr ||
+          !SharesShapingStyle(*shaping_style, run.style)) {
+        GetFontAndMinikinPaint(run.style, &font, &paint);
+        collection = GetMinikinFontCollectionForStyle(run.style);
+        shaping_style = &run.style;
+      }
       if (collection == nullptr) {
         FML_LOG(INFO) << "Could not find font collection for families \""
                       << (run.style.font_families.empty()
@@ -664,6 +699,14 @@ void ParagraphTxt::Layout(double width) {
     return;
   }
 
+  if (needs_layout_) {
+    // The text, styles, or placeholders changed; nothing computed by earlier
+    // layouts is reusable.
+    cached_bidi_runs_.clear();
+    cached_bidi_runs_valid_ = false;
+    line_break_cache_.clear();
+  }
+
   width_ = rounded_width;
 
   needs_layout_ = false;
@@ -676,19 +719,44 @@ void ParagraphTxt::Layout(double width) {
   min_left_ = FLT_MAX;
   final_line_count_ = 0;
 
-  if (!ComputeLineBreaks())
-    return;
+  // For a width-only relayout, reuse memoized line breaks when this width has
+  // been laid out before.
+  bool restored_line_breaks = false;
+  for (const LineBreakResult& result : line_break_cache_) {
+    if (result.width == width_) {
+      line_metrics_ = result.line_metrics;
+      line_widths_ = result.line_widths;
+      max_intrinsic_width_ = result.max_intrinsic_width;
+      restored_line_breaks = true;
+      break;
+    }
+  }
+  if (!restored_line_breaks) {
+    if (!ComputeLineBreaks())
+      return;
+    // Snapshot the breaker output before the loop below annotates
+    // line_metrics_ with per-run metrics.
+    if (line_break_cache_.size() >= kMaxLineBreakCacheEntries) {
+      line_break_cache_.erase(line_break_cache_.begin());
+    }
+    line_break_cache_.push_back(
+        {width_, line_metrics_, line_widths_, max_intrinsic_width_});
+  }
 
-  std::vector<BidiRun> bidi_runs;
-  if (!ComputeBidiRuns(&bidi_runs))
-    return;
+  // Bidi runs are width independent and are reused across width-only
+  // relayouts.
+  if (!cached_bidi_runs_valid_) {
+    if (!ComputeBidiRuns(&cached_bidi_runs_))
+      return;
+    cached_bidi_runs_valid_ = true;
+  }
+  const std::vector<BidiRun>& bidi_runs = cached_bidi_runs_;
 
   SkFont font;
   font.setEdging(SkFont::Edging::kAntiAlias);
   font.setSubpixel(true);
   font.setHinting(SkFontHinting::kSlight);
 
-  minikin::Layout layout;
   SkTextBlobBuilder builder;
   double y_offset = 0;
   double prev_max_descent = 0;
@@ -799,17 +867,49 @@ void ParagraphTxt::Layout(double width) {
     size_t cluster_unique_id = 0;
     std::vector<PaintRecord> paint_records;
 
+    // Blob merge bookkeeping. Consecutive records on this line whose styles
+    // paint identically share a single text blob owned by the first record
+    // of the group (the "leader"); follower records keep a null blob and are
+    // skipped when the blobs are drawn. Followers' glyph positions are
+    // rebased onto the leader's offset as they are written into the shared
+    // builder. The merged blobs are built once here and reused by every
+    // subsequent Paint() until the next layout.
+    size_t merge_leader_index = 0;
+    double merge_origin_x = 0;
+    const TextStyle* merge_style = nullptr;
+    bool merge_active = false;
+    auto flush_merged_blob = [&]() {
+      if (!merge_active) {
+        return;
+      }
+      // make() also clears the builder when the group produced no records.
+      sk_sp<SkTextBlob> merged = builder.make();
+      if (merge_leader_index < paint_records.size()) {
+        paint_records[merge_leader_index].SetText(std::move(merged));
+      }
+      merge_active = false;
+    };
+
+    minikin::FontStyle minikin_font;
+    minikin::MinikinPaint minikin_paint;
+    std::shared_ptr<minikin::FontCollection> minikin_font_collection;
+    const TextStyle* shaping_style = nullptr;
+
     for (auto line_run_it = line_runs.begin(); line_run_it != line_runs.end();
          ++line_run_it) {
       const BidiRun& run = *line_run_it;
-      minikin::FontStyle minikin_font;
-      minikin::MinikinPaint minikin_paint;
-      GetFontAndMinikinPaint(run.style(), &minikin_font, &minikin_paint);
+      // Runs that shape identically to the previous one (spans differing
+      // only in paint attributes) reuse its minikin conversions and font
+      // collection lookup.
+      if (shaping_style == nullptr ||
+          !SharesShapingStyle(*shaping_style, run.style())) {
+        GetFontAndMinikinPaint(run.style(), &minikin_font, &minikin_paint);
+        minikin_font_collection =
+            GetMinikinFontCollectionForStyle(run.style());
+        shaping_style = &run.style();
+      }
       font.setSize(run.style().font_size);
 
-      std::shared_ptr<minikin::FontCollection> minikin_font_collection =
-          GetMinikinFontCollectionForStyle(run.style());
-
       // Lay out this run.
       uint16_t* text_ptr = text_.data();
       size_t text_start = run.start();
@@ -824,16 +924,16 @@ void ParagraphTxt::Layout(double width) {
           line_run_it == line_runs.end() - 1 &&
           (line_number == line_limit - 1 ||
            paragraph_style_.unlimited_lines())) {
-        float ellipsis_width = layout.measureText(
+        float ellipsis_width = minikin::Layout::measureText(
             reinterpret_cast<const uint16_t*>(ellipsis.data()), 0,
             ellipsis.length(), ellipsis.length(), run.is_rtl(), minikin_font,
             minikin_paint, minikin_font_collection, nullptr);
 
         std::vector<float> text_advances(text_count);
-        float text_width =
-            layout.measureText(text_ptr, text_start, text_count, text_.size(),
-                               run.is_rtl(), minikin_font, minikin_paint,
-                               minikin_font_collection, text_advances.data());
+        float text_width = minikin::Layout::measureText(
+            text_ptr, text_start, text_count, text_.size(), run.is_rtl(),
+            minikin_font, minikin_paint, minikin_font_collection,
+            text_advances.data());
 
         // Truncate characters from the text until the ellipsis fits.
         size_t truncate_count = 0;
@@ -863,8 +963,13 @@ void ParagraphTxt::Layout(double width) {
         }
       }
 
-      layout.doLayout(text_ptr, text_start, text_count, text_size, run.is_rtl(),
-                      minikin_font, minikin_paint, minikin_font_collection);
+      // Identical runs shaped for an earlier layout pass or for another
+      // paragraph are served from the shared run layout cache.
+      std::shared_ptr<minikin::Layout> shaped_run =
+          RunLayoutCache::GetInstance().GetOrCreateLayout(
+              text_ptr, text_start, text_count, text_size, run.is_rtl(),
+              minikin_font, minikin_paint, minikin_font_collection);
+      minikin::Layout& layout = *shaped_run;
 
       if (layout.nGlyphs() == 0)
         continue;
@@ -883,6 +988,11 @@ void ParagraphTxt::Layout(double width) {
       std::vector<float> layout_advances(text_count);
       layout.getAdvances(layout_advances.data());
 
+      // Grapheme boundaries for this run, built on first use so runs without
+      // ligatures skip the scan entirely. The ligature loop below then costs
+      // a bit lookup per offset instead of a pair table evaluation.
+      minikin::GraphemeBreakBitmap run_grapheme_breaks;
+
       // Break the layout into blobs that share the same SkPaint parameters.
       std::vector<Range<size_t>> glyph_blobs = GetLayoutTypefaceRuns(layout);
 
@@ -893,6 +1003,23 @@ void ParagraphTxt::Layout(double width) {
         std::vector<GlyphPosition> glyph_positions;
 
         GetGlyphTypeface(layout, glyph_blob.start).apply(font);
+
+        // Decide whether this record can join the currently merged blob.
+        // Placeholder records never draw their blob and shadowed records
+        // need a blob of their own for the shadow passes.
+        const bool record_mergeable =
+            !run.is_placeholder_run() && run.style().text_shadows.empty();
+        const double record_offset_x = run_x_offset + justify_x_offset;
+        if (!merge_active || !record_mergeable ||
+            !PaintsIdentically(*merge_style, run.style())) {
+          flush_merged_blob();
+          merge_active = true;
+          merge_leader_index = paint_records.size();
+          merge_origin_x = record_offset_x;
+          merge_style = &run.style();
+        }
+        const double merge_x_shift = record_offset_x - merge_origin_x;
+
         const SkTextBlobBuilder::RunBuffer& blob_buffer =
             builder.allocRunPos(font, glyph_blob.end - glyph_blob.start);
 
@@ -909,11 +1036,15 @@ void ParagraphTxt::Layout(double width) {
 
             size_t pos_index = blob_index * 2;
             blob_buffer.pos[pos_index] =
-                layout.getX(glyph_index) + justify_x_offset_delta;
+                layout.getX(glyph_index) + justify_x_offset_delta +
+                merge_x_shift;
             blob_buffer.pos[pos_index + 1] = layout.getY(glyph_index);
 
+            // Glyph positions stay relative to this record's own offset; the
+            // merge shift only applies to the shared blob.
             if (glyph_index == cluster_start_glyph_index)
-              glyph_x_offset = blob_buffer.pos[pos_index];
+              glyph_x_offset =
+                  layout.getX(glyph_index) + justify_x_offset_delta;
 
             glyph_index++;
           } while (glyph_index < glyph_blob.end &&
@@ -940,11 +1071,14 @@ void ParagraphTxt::Layout(double width) {
             // joined into this glyph and how many input code units map to
             // each grapheme.
             size_t code_unit_count = 1;
+            if (glyph_code_units.end > glyph_code_units.start + 1 &&
+                !run_grapheme_breaks.isBuilt()) {
+              run_grapheme_breaks.build(layout_advances.data(), text_ptr,
+                                        text_start, text_count);
+            }
             for (int32_t offset = glyph_code_units.start + 1;
                  offset < glyph_code_units.end; ++offset) {
-              if (minikin::GraphemeBreak::isGraphemeBreak(
-                      layout_advances.data(), text_ptr, text_start, text_count,
-                      offset)) {
+              if (run_grapheme_breaks.isBreak(offset)) {
                 grapheme_code_unit_counts.push_back(code_unit_count);
                 code_unit_count = 1;
               } else {
@@ -1019,18 +1153,23 @@ void ParagraphTxt::Layout(double width) {
         Range<double> record_x_pos(
             glyph_positions.front().x_pos.start - run_x_offset,
             glyph_positions.back().x_pos.end - run_x_offset);
+        // Records are created without a blob; the group's leader receives
+        // the merged blob when the group is flushed.
         if (run.is_placeholder_run()) {
           paint_records.emplace_back(
-              run.style(), SkPoint::Make(run_x_offset + justify_x_offset, 0),
-              builder.make(), *metrics, line_number, record_x_pos.start,
+              run.style(), SkPoint::Make(record_offset_x, 0), nullptr,
+              *metrics, line_number, record_x_pos.start,
               record_x_pos.start + run.placeholder_run()->width, run.is_ghost(),
               run.placeholder_run());
           run_x_offset += run.placeholder_run()->width;
         } else {
           paint_records.emplace_back(
-              run.style(), SkPoint::Make(run_x_offset + justify_x_offset, 0),
-              builder.make(), *metrics, line_number, record_x_pos.start,
-              record_x_pos.end, run.is_ghost());
+              run.style(), SkPoint::Make(record_offset_x, 0), nullptr,
+              *metrics, line_number, record_x_pos.start, record_x_pos.end,
+              run.is_ghost());
+        }
+        if (!record_mergeable) {
+          flush_merged_blob();
         }
         justify_x_offset += justify_x_offset_delta;
 
@@ -1077,6 +1216,8 @@ void ParagraphTxt::Layout(double width) {
       }
     }  // for each in line_runs
 
+    flush_merged_blob();
+
     // Adjust the glyph positions based on the alignment of the line.
     double line_x_offset = GetLineXOffset(run_x_offset, justify_line);
     if (line_x_offset) {
@@ -1395,7 +1536,11 @@ void ParagraphTxt::Paint(SkCanvas* canvas, double x, double y) {
     SkPoint offset = base_offset + record.offset();
     if (record.GetPlaceholderRun() == nullptr) {
       PaintShadow(canvas, record, offset);
-      canvas->drawTextBlob(record.text(), offset.x(), offset.y(), paint);
+      // Records whose glyphs were merged into an earlier record's blob have
+      // no blob of their own.
+      if (record.text() != nullptr) {
+        canvas->drawTextBlob(record.text(), offset.x(), offset.y(), paint);
+      }
     }
     PaintDecorations(canvas, record, base_offset);
   }
@@ -152,6 +152,7 @@ class ParagraphTxt : public Paragraph {
   FRIEND_TEST_LINUX_ONLY(ParagraphTest, EmojiMultiLineRectsParagraph);
   FRIEND_TEST(ParagraphTest, HyphenBreakParagraph);
   FRIEND_TEST(ParagraphTest, RepeatLayoutParagraph);
+  FRIEND_TEST(ParagraphTest, WidthBounceLayoutParagraph);
   FRIEND_TEST(ParagraphTest, Ellipsize);
   FRIEND_TEST(ParagraphTest, UnderlineShiftParagraph);
   FRIEND_TEST(ParagraphTest, WavyDecorationParagraph);
@@ -324,6 +325,25 @@ class ParagraphTxt : public Paragraph {
 
   bool needs_layout_ = true;
 
+  // Bidi runs depend only on the text, styles, and paragraph direction, so
+  // they survive relayouts that change nothing but the width. Rebuilt
+  // whenever Layout() runs with needs_layout_ raised.
+  std::vector<BidiRun> cached_bidi_runs_;
+  bool cached_bidi_runs_valid_ = false;
+
+  // Memoized ComputeLineBreaks output keyed by the rounded layout width, so
+  // that re-laying out the same content while bouncing between a handful of
+  // widths (e.g. measure passes followed by final layout) does not re-run
+  // the line breaker each time.
+  struct LineBreakResult {
+    double width;
+    std::vector<LineMetrics> line_metrics;
+    std::vector<double> line_widths;
+    double max_intrinsic_width;
+  };
+  static constexpr size_t kMaxLineBreakCacheEntries = 8;
+  std::vector<LineBreakResult> line_break_cache_;
+
   struct WaveCoordinates {
     double x_start;
     double y_start;
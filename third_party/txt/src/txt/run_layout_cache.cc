@@ -0,0 +1,136 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "run_layout_cache.h"
+
+#include <cstring>
+
+#include "utils/JenkinsHash.h"
+
+namespace txt {
+
+RunLayoutCacheKey::RunLayoutCacheKey(const uint16_t* text,
+                                     size_t start,
+                                     size_t count,
+                                     size_t text_size,
+                                     bool is_rtl,
+                                     const minikin::FontStyle& style,
+                                     const minikin::MinikinPaint& paint,
+                                     uint32_t collection_id)
+    : text_(text, text + text_size),
+      start_(start),
+      count_(count),
+      is_rtl_(is_rtl),
+      collection_id_(collection_id),
+      style_(style),
+      size_(paint.size),
+      scale_x_(paint.scaleX),
+      skew_x_(paint.skewX),
+      letter_spacing_(paint.letterSpacing),
+      word_spacing_(paint.wordSpacing),
+      paint_flags_(paint.paintFlags),
+      hyphen_(paint.hyphenEdit.getHyphen()),
+      hash_(ComputeHash()) {}
+
+bool RunLayoutCacheKey::operator==(const RunLayoutCacheKey& other) const {
+  return collection_id_ == other.collection_id_ && start_ == other.start_ &&
+         count_ == other.count_ && style_ == other.style_ &&
+         size_ == other.size_ && scale_x_ == other.scale_x_ &&
+         skew_x_ == other.skew_x_ &&
+         letter_spacing_ == other.letter_spacing_ &&
+         word_spacing_ == other.word_spacing_ &&
+         paint_flags_ == other.paint_flags_ && hyphen_ == other.hyphen_ &&
+         is_rtl_ == other.is_rtl_ && text_ == other.text_;
+}
+
+android::hash_t RunLayoutCacheKey::ComputeHash() const {
+  uint32_t hash = android::JenkinsHashMix(0, collection_id_);
+  hash = android::JenkinsHashMix(hash, start_);
+  hash = android::JenkinsHashMix(hash, count_);
+  hash = android::JenkinsHashMix(hash, minikin::hash_type(style_));
+  hash = android::JenkinsHashMix(hash, android::hash_type(size_));
+  hash = android::JenkinsHashMix(hash, android::hash_type(scale_x_));
+  hash = android::JenkinsHashMix(hash, android::hash_type(skew_x_));
+  hash = android::JenkinsHashMix(hash, android::hash_type(letter_spacing_));
+  hash = android::JenkinsHashMix(hash, android::hash_type(word_spacing_));
+  hash = android::JenkinsHashMix(hash, android::hash_type(paint_flags_));
+  hash = android::JenkinsHashMix(hash, android::hash_type(hyphen_));
+  hash = android::JenkinsHashMix(hash, android::hash_type(is_rtl_));
+  hash = android::JenkinsHashMixShorts(hash, text_.data(), text_.size());
+  return android::JenkinsHashWhiten(hash);
+}
+
+android::hash_t hash_type(const RunLayoutCacheKey& key) {
+  return key.hash();
+}
+
+RunLayoutCache::RunLayoutCache() : cache_(kMaxEntries) {}
+
+RunLayoutCache& RunLayoutCache::GetInstance() {
+  static RunLayoutCache* instance = new RunLayoutCache();
+  return *instance;
+}
+
+std::shared_ptr<minikin::Layout> RunLayoutCache::GetOrCreateLayout(
+    const uint16_t* text,
+    size_t start,
+    size_t count,
+    size_t text_size,
+    bool is_rtl,
+    const minikin::FontStyle& style,
+    const minikin::MinikinPaint& paint,
+    const std::shared_ptr<minikin::FontCollection>& collection) {
+  if (paint.skipCache()) {
+    auto layout = std::make_shared<minikin::Layout>();
+    layout->doLayout(text, start, count, text_size, is_rtl, style, paint,
+                     collection);
+    return layout;
+  }
+
+  RunLayoutCacheKey key(text, start, count, text_size, is_rtl, style, paint,
+                        collection->getId());
+  {
+    std::scoped_lock lock(mutex_);
+    std::shared_ptr<minikin::Layout> layout = cache_.get(key);
+    if (layout) {
+      return layout;
+    }
+  }
+
+  // Shape outside the lock; doLayout serializes on minikin's own global
+  // lock and can be slow for long runs.
+  auto layout = std::make_shared<minikin::Layout>();
+  layout->doLayout(text, start, count, text_size, is_rtl, style, paint,
+                   collection);
+
+  {
+    std::scoped_lock lock(mutex_);
+    cache_.put(key, layout);
+  }
+  return layout;
+}
+
+void RunLayoutCache::Clear() {
+  std::scoped_lock lock(mutex_);
+  cache_.clear();
+}
+
+size_t RunLayoutCache::size() const {
+  std::scoped_lock lock(mutex_);
+  return cache_.size();
+}
+
+}  // namespace txt
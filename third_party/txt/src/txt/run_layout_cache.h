@@ -0,0 +1,125 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LIB_TXT_SRC_RUN_LAYOUT_CACHE_H_
+#define LIB_TXT_SRC_RUN_LAYOUT_CACHE_H_
+
+#include <minikin/Layout.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "flutter/fml/macros.h"
+#include "minikin/FontCollection.h"
+#include "minikin/MinikinFont.h"
+#include "utils/LruCache.h"
+
+namespace txt {
+
+// Identifies the shaped layout of one styled bidi run. Covers every input
+// that feeds into minikin::Layout::doLayout: the text buffer (the whole
+// buffer, since shaping consults context beyond the run for word breaks and
+// joining behavior), the run range, direction, the font collection, and the
+// paint parameters derived from the run's TextStyle.
+class RunLayoutCacheKey {
+ public:
+  RunLayoutCacheKey(const uint16_t* text,
+                    size_t start,
+                    size_t count,
+                    size_t text_size,
+                    bool is_rtl,
+                    const minikin::FontStyle& style,
+                    const minikin::MinikinPaint& paint,
+                    uint32_t collection_id);
+
+  bool operator==(const RunLayoutCacheKey& other) const;
+
+  android::hash_t hash() const { return hash_; }
+
+ private:
+  std::vector<uint16_t> text_;
+  size_t start_;
+  size_t count_;
+  bool is_rtl_;
+  uint32_t collection_id_;
+  minikin::FontStyle style_;
+  float size_;
+  float scale_x_;
+  float skew_x_;
+  float letter_spacing_;
+  float word_spacing_;
+  uint32_t paint_flags_;
+  uint32_t hyphen_;
+  android::hash_t hash_;
+
+  android::hash_t ComputeHash() const;
+};
+
+android::hash_t hash_type(const RunLayoutCacheKey& key);
+
+// A process-wide LRU cache of shaped run layouts, shared across Paragraph
+// instances.
+//
+// minikin's LayoutCache memoizes shaping at word granularity, but each
+// ParagraphTxt::Layout call still pays for word segmentation, cache probes,
+// and glyph reassembly per run.  Caching whole runs lets repeated layouts of
+// identical strings -- the common case when a list view rebuilds the same
+// labels every frame -- reuse the assembled glyph data directly.  Run
+// boundaries already reflect the line breaks computed for the layout width,
+// so a width bucket is not part of the key.
+class RunLayoutCache {
+ public:
+  static RunLayoutCache& GetInstance();
+
+  // Returns the shaped layout for the given run, shaping it via
+  // minikin::Layout::doLayout on a cache miss.  The returned layout is
+  // shared and must not be mutated.  Falls back to uncached shaping when the
+  // paint carries font feature settings, matching minikin::LayoutCache.
+  std::shared_ptr<minikin::Layout> GetOrCreateLayout(
+      const uint16_t* text,
+      size_t start,
+      size_t count,
+      size_t text_size,
+      bool is_rtl,
+      const minikin::FontStyle& style,
+      const minikin::MinikinPaint& paint,
+      const std::shared_ptr<minikin::FontCollection>& collection);
+
+  // Drops all cached layouts. Cached layouts hold references to fonts in
+  // their source collections, so this must be called whenever those fonts
+  // may be purged.
+  void Clear();
+
+  size_t size() const;
+
+ private:
+  RunLayoutCache();
+
+  // Arbitrary limit; run layouts are small (tens of glyphs) so the dominant
+  // cost is the key's copy of the text buffer.
+  static const size_t kMaxEntries = 600;
+
+  mutable std::mutex mutex_;
+  android::LruCache<RunLayoutCacheKey, std::shared_ptr<minikin::Layout>>
+      cache_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(RunLayoutCache);
+};
+
+}  // namespace txt
+
+#endif  // LIB_TXT_SRC_RUN_LAYOUT_CACHE_H_
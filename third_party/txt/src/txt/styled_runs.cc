@@ -41,6 +41,11 @@ void StyledRuns::swap(StyledRuns& other) {
   runs_.swap(other.runs_);
 }
 
+void StyledRuns::Reset() {
+  styles_.clear();
+  runs_.clear();
+}
+
 size_t StyledRuns::AddStyle(const TextStyle& style) {
   const size_t style_index = styles_.size();
   styles_.push_back(style);
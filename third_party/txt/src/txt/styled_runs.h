@@ -48,6 +48,9 @@ class StyledRuns {
 
   void swap(StyledRuns& other);
 
+  // Removes all styles and runs while keeping the allocated storage.
+  void Reset();
+
   size_t AddStyle(const TextStyle& style);
 
   const TextStyle& GetStyle(size_t style_index) const;
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "txt/typeface_registry.h"
+
+#include <memory>
+
+#include "third_party/skia/include/core/SkStream.h"
+
+namespace txt {
+
+namespace {
+
+// Fingerprints the typeface's font data with FNV-1a, folding in the ttc index
+// so two faces packed in one collection file do not collide. Returns 0 if the
+// data cannot be streamed, which callers treat as "not fingerprintable".
+uint64_t ComputeDataHash(const SkTypeface& typeface) {
+  int ttc_index = 0;
+  std::unique_ptr<SkStreamAsset> stream(typeface.openStream(&ttc_index));
+  if (stream == nullptr || stream->getLength() == 0) {
+    return 0;
+  }
+  uint64_t hash = 0xcbf29ce484222325ull;
+  auto fold = [&hash](const void* data, size_t length) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++) {
+      hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+  };
+  char buffer[4096];
+  while (true) {
+    size_t read = stream->read(buffer, sizeof(buffer));
+    if (read == 0) {
+      break;
+    }
+    fold(buffer, read);
+  }
+  fold(&ttc_index, sizeof(ttc_index));
+  return hash == 0 ? 1 : hash;
+}
+
+}  // anonymous namespace
+
+TypefaceRegistry& TypefaceRegistry::GetInstance() {
+  // Deliberately leaked: the registry must outlive every engine in the
+  // process.
+  static TypefaceRegistry* registry = new TypefaceRegistry();
+  return *registry;
+}
+
+TypefaceRegistry::TypefaceRegistry() = default;
+
+TypefaceRegistry::~TypefaceRegistry() = default;
+
+sk_sp<SkTypeface> TypefaceRegistry::Deduplicate(sk_sp<SkTypeface> typeface) {
+  if (typeface == nullptr) {
+    return typeface;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (canonical_ids_.count(typeface->uniqueID()) > 0) {
+      return typeface;
+    }
+  }
+
+  // Hash outside the lock; the stream read dominates the cost of this call.
+  const uint64_t data_hash = ComputeDataHash(*typeface);
+  if (data_hash == 0) {
+    return typeface;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto found = typefaces_by_data_hash_.find(data_hash);
+  if (found != typefaces_by_data_hash_.end()) {
+    return found->second;
+  }
+  typefaces_by_data_hash_[data_hash] = typeface;
+  canonical_ids_.insert(typeface->uniqueID());
+  return typeface;
+}
+
+void TypefaceRegistry::PurgeUnreferenced() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = typefaces_by_data_hash_.begin();
+  while (it != typefaces_by_data_hash_.end()) {
+    if (it->second->unique()) {
+      canonical_ids_.erase(it->second->uniqueID());
+      it = typefaces_by_data_hash_.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
+
+size_t TypefaceRegistry::GetRegisteredTypefaceCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return typefaces_by_data_hash_.size();
+}
+
+}  // namespace txt
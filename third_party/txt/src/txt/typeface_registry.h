@@ -0,0 +1,69 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LIB_TXT_SRC_TYPEFACE_REGISTRY_H_
+#define LIB_TXT_SRC_TYPEFACE_REGISTRY_H_
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkRefCnt.h"
+#include "third_party/skia/include/core/SkTypeface.h"
+
+namespace txt {
+
+// Process-global registry that deduplicates typefaces backed by identical
+// font data. Each engine in a process builds its own FontCollection, and
+// asset font managers hand every collection a fresh SkTypeface over a private
+// copy of the font bytes; for large CJK fonts these duplicates dominate font
+// memory. The registry fingerprints the underlying data stream and hands back
+// the first typeface seen with that fingerprint, letting later copies be
+// released.
+class TypefaceRegistry {
+ public:
+  static TypefaceRegistry& GetInstance();
+
+  // Returns the canonical typeface for the given typeface's font data,
+  // registering the typeface if its data has not been seen before. Typefaces
+  // whose data cannot be streamed are returned unchanged.
+  sk_sp<SkTypeface> Deduplicate(sk_sp<SkTypeface> typeface);
+
+  // Releases registry entries whose typefaces are no longer referenced
+  // outside the registry, so a process that tears down its engines does not
+  // keep their font data pinned. Called when a FontCollection is destroyed.
+  void PurgeUnreferenced();
+
+  size_t GetRegisteredTypefaceCount() const;
+
+ private:
+  TypefaceRegistry();
+
+  ~TypefaceRegistry();
+
+  mutable std::mutex mutex_;
+  std::unordered_map<uint64_t, sk_sp<SkTypeface>> typefaces_by_data_hash_;
+  // The unique ids of the canonical typefaces, so queries for a typeface that
+  // is already canonical skip rehashing its data.
+  std::unordered_set<uint32_t> canonical_ids_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TypefaceRegistry);
+};
+
+}  // namespace txt
+
+#endif  // LIB_TXT_SRC_TYPEFACE_REGISTRY_H_
@@ -372,4 +372,36 @@ TEST(GraphemeBreak, offsets) {
   EXPECT_TRUE(GraphemeBreak::isGraphemeBreak(nullptr, string, 2, 3, 5));
 }
 
+TEST(GraphemeBreakBitmap, matchesDirectEvaluation) {
+  // Mixed content: letters, a combining mark, an emoji pair and a ZWJ
+  // sequence, exercising several pair table rules.
+  uint16_t string[] = {0x0041, 0x0301, 0x0042, 0xD83C, 0xDC31,
+                       0xD83D, 0xDC69, 0x200D, 0xD83D, 0xDCBB};
+  const size_t size = sizeof(string) / sizeof(string[0]);
+
+  GraphemeBreakBitmap bitmap;
+  EXPECT_FALSE(bitmap.isBuilt());
+  bitmap.build(nullptr, string, 0, size);
+  EXPECT_TRUE(bitmap.isBuilt());
+
+  for (size_t offset = 0; offset <= size; offset++) {
+    EXPECT_EQ(GraphemeBreak::isGraphemeBreak(nullptr, string, 0, size, offset),
+              bitmap.isBreak(offset))
+        << "offset " << offset;
+  }
+
+  // Offsets outside the built range follow rules GB1/GB2.
+  EXPECT_TRUE(bitmap.isBreak(size + 1));
+}
+
+TEST(GraphemeBreakBitmap, honorsSubrange) {
+  uint16_t string[] = {0x0041, 0x06DD, 0x0045, 0x0301, 0x0049, 0x0301};
+  GraphemeBreakBitmap bitmap;
+  bitmap.build(nullptr, string, 2, 3);
+  EXPECT_TRUE(bitmap.isBreak(2));
+  EXPECT_FALSE(bitmap.isBreak(3));
+  EXPECT_TRUE(bitmap.isBreak(4));
+  EXPECT_TRUE(bitmap.isBreak(5));
+}
+
 }  // namespace minikin
@@ -5348,6 +5348,54 @@ TEST_F(ParagraphTest, RepeatLayoutParagraph) {
   ASSERT_TRUE(Snapshot());
 }
 
+TEST_F(ParagraphTest, WidthBounceLayoutParagraph) {
+  const char* text =
+      "Sentence to layout at diff widths to get diff line counts. short words "
+      "short words short words short words short words short words short words "
+      "short words short words short words short words short words short words "
+      "end";
+  auto icu_text = icu::UnicodeString::fromUTF8(text);
+  std::u16string u16_text(icu_text.getBuffer(),
+                          icu_text.getBuffer() + icu_text.length());
+
+  txt::ParagraphStyle paragraph_style;
+  paragraph_style.break_strategy = minikin::kBreakStrategy_HighQuality;
+  txt::ParagraphBuilderTxt builder(paragraph_style, GetTestFontCollection());
+
+  txt::TextStyle text_style;
+  text_style.font_families = std::vector<std::string>(1, "Roboto");
+  text_style.font_size = 31;
+  text_style.color = SK_ColorBLACK;
+  builder.PushStyle(text_style);
+  builder.AddText(u16_text);
+  builder.Pop();
+
+  auto paragraph = BuildParagraph(builder);
+
+  // Bounce between two widths; later layouts should serve line breaks from
+  // the memoized results and reuse the cached bidi runs.
+  paragraph->Layout(300);
+  size_t narrow_line_count = paragraph->GetLineCount();
+  paragraph->Layout(600);
+  size_t wide_line_count = paragraph->GetLineCount();
+  ASSERT_GT(narrow_line_count, wide_line_count);
+  ASSERT_EQ(paragraph->line_break_cache_.size(), 2ull);
+  ASSERT_TRUE(paragraph->cached_bidi_runs_valid_);
+
+  paragraph->Layout(300);
+  ASSERT_EQ(paragraph->GetLineCount(), narrow_line_count);
+  ASSERT_EQ(paragraph->line_break_cache_.size(), 2ull);
+
+  paragraph->Layout(600);
+  ASSERT_EQ(paragraph->GetLineCount(), wide_line_count);
+
+  // A content dirty bit must flush both caches.
+  paragraph->SetDirty(true);
+  paragraph->Layout(300);
+  ASSERT_EQ(paragraph->GetLineCount(), narrow_line_count);
+  ASSERT_EQ(paragraph->line_break_cache_.size(), 1ull);
+}
+
 TEST_F(ParagraphTest, Ellipsize) {
   const char* text =
       "This is a very long sentence to test if the text will properly wrap "
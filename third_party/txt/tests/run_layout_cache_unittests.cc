@@ -0,0 +1,106 @@
+/*
+ * Copyright 2017 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "txt/run_layout_cache.h"
+#include "txt_test_utils.h"
+
+namespace txt {
+
+namespace {
+
+std::shared_ptr<minikin::FontCollection> GetRobotoCollection() {
+  return GetTestFontCollection()->GetMinikinFontCollectionForFamilies(
+      {"Roboto"}, "en");
+}
+
+minikin::MinikinPaint MakePaint(float letter_spacing = 0) {
+  minikin::MinikinPaint paint;
+  paint.size = 14;
+  paint.letterSpacing = letter_spacing;
+  return paint;
+}
+
+}  // namespace
+
+TEST(RunLayoutCache, ReturnsSameLayoutForIdenticalRuns) {
+  auto collection = GetRobotoCollection();
+  ASSERT_NE(collection, nullptr);
+  std::u16string text = u"Hello world";
+  minikin::FontStyle style;
+
+  RunLayoutCache& cache = RunLayoutCache::GetInstance();
+  cache.Clear();
+
+  auto first = cache.GetOrCreateLayout(
+      reinterpret_cast<const uint16_t*>(text.data()), 0, text.size(),
+      text.size(), false, style, MakePaint(), collection);
+  ASSERT_NE(first, nullptr);
+  ASSERT_GT(first->nGlyphs(), 0u);
+
+  auto second = cache.GetOrCreateLayout(
+      reinterpret_cast<const uint16_t*>(text.data()), 0, text.size(),
+      text.size(), false, style, MakePaint(), collection);
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(cache.size(), 1u);
+}
+
+TEST(RunLayoutCache, DistinguishesPaintParameters) {
+  auto collection = GetRobotoCollection();
+  ASSERT_NE(collection, nullptr);
+  std::u16string text = u"Hello world";
+  minikin::FontStyle style;
+
+  RunLayoutCache& cache = RunLayoutCache::GetInstance();
+  cache.Clear();
+
+  auto tight = cache.GetOrCreateLayout(
+      reinterpret_cast<const uint16_t*>(text.data()), 0, text.size(),
+      text.size(), false, style, MakePaint(0), collection);
+  auto spaced = cache.GetOrCreateLayout(
+      reinterpret_cast<const uint16_t*>(text.data()), 0, text.size(),
+      text.size(), false, style, MakePaint(2), collection);
+  ASSERT_NE(tight, spaced);
+  ASSERT_GT(spaced->getAdvance(), tight->getAdvance());
+  ASSERT_EQ(cache.size(), 2u);
+}
+
+TEST(RunLayoutCache, ClearDropsEntries) {
+  auto collection = GetRobotoCollection();
+  ASSERT_NE(collection, nullptr);
+  std::u16string text = u"Hello world";
+  minikin::FontStyle style;
+
+  RunLayoutCache& cache = RunLayoutCache::GetInstance();
+  cache.Clear();
+
+  auto first = cache.GetOrCreateLayout(
+      reinterpret_cast<const uint16_t*>(text.data()), 0, text.size(),
+      text.size(), false, style, MakePaint(), collection);
+  ASSERT_EQ(cache.size(), 1u);
+
+  cache.Clear();
+  ASSERT_EQ(cache.size(), 0u);
+
+  auto second = cache.GetOrCreateLayout(
+      reinterpret_cast<const uint16_t*>(text.data()), 0, text.size(),
+      text.size(), false, style, MakePaint(), collection);
+  ASSERT_NE(first, second);
+}
+
+}  // namespace txt
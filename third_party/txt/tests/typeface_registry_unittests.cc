@@ -0,0 +1,84 @@
+/*
+ * Copyright 2017 Google, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkStream.h"
+#include "third_party/skia/include/core/SkTypeface.h"
+#include "txt/typeface_registry.h"
+
+namespace txt {
+
+// Returns two distinct SkTypeface instances backed by identical font data, or
+// a pair of nullptrs when the default typeface cannot be streamed on this
+// platform.
+static std::pair<sk_sp<SkTypeface>, sk_sp<SkTypeface>> MakeTypefaceTwins() {
+  sk_sp<SkTypeface> source = SkTypeface::MakeDefault();
+  int ttc_index = 0;
+  std::unique_ptr<SkStreamAsset> stream(source->openStream(&ttc_index));
+  if (stream == nullptr || stream->getLength() == 0) {
+    return {nullptr, nullptr};
+  }
+  sk_sp<SkData> data = SkData::MakeFromStream(stream.get(),
+                                              stream->getLength());
+  return {SkTypeface::MakeFromData(data), SkTypeface::MakeFromData(data)};
+}
+
+TEST(TypefaceRegistry, DeduplicatesTypefacesOverIdenticalData) {
+  auto twins = MakeTypefaceTwins();
+  if (twins.first == nullptr) {
+    return;
+  }
+  ASSERT_NE(twins.first.get(), twins.second.get());
+
+  auto& registry = TypefaceRegistry::GetInstance();
+  sk_sp<SkTypeface> first = registry.Deduplicate(twins.first);
+  sk_sp<SkTypeface> second = registry.Deduplicate(twins.second);
+  ASSERT_EQ(first.get(), second.get());
+}
+
+TEST(TypefaceRegistry, CanonicalTypefaceDeduplicatesToItself) {
+  auto twins = MakeTypefaceTwins();
+  if (twins.first == nullptr) {
+    return;
+  }
+
+  auto& registry = TypefaceRegistry::GetInstance();
+  sk_sp<SkTypeface> canonical = registry.Deduplicate(twins.first);
+  ASSERT_EQ(canonical.get(), registry.Deduplicate(canonical).get());
+}
+
+TEST(TypefaceRegistry, PurgeDropsEntriesOnlyTheRegistryReferences) {
+  auto twins = MakeTypefaceTwins();
+  if (twins.first == nullptr) {
+    return;
+  }
+
+  auto& registry = TypefaceRegistry::GetInstance();
+  registry.Deduplicate(twins.first);
+  size_t count_while_referenced = registry.GetRegisteredTypefaceCount();
+
+  // While the caller holds a reference the entry must survive a purge.
+  registry.PurgeUnreferenced();
+  ASSERT_EQ(count_while_referenced, registry.GetRegisteredTypefaceCount());
+
+  twins.first.reset();
+  twins.second.reset();
+  registry.PurgeUnreferenced();
+  ASSERT_LT(registry.GetRegisteredTypefaceCount(), count_while_referenced);
+}
+
+}  // namespace txt
@@ -4,6 +4,7 @@
 
 #include "flutter/vulkan/vulkan_device.h"
 
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <vector>
@@ -312,6 +313,7 @@ int VulkanDevice::ChooseSurfaceFormat(const VulkanSurface& surface,
 }
 
 bool VulkanDevice::ChoosePresentMode(const VulkanSurface& surface,
+                                     VkPresentModeKHR desired_present_mode,
                                      VkPresentModeKHR* present_mode) const {
   if (!surface.IsValid() || present_mode == nullptr) {
     return false;
@@ -324,9 +326,28 @@ bool VulkanDevice::ChoosePresentMode(const VulkanSurface& surface,
   // powered by Vsync pulses instead of depending the submit to block.
   // However, for platforms that don't have VSync providers setup, it is better
   // to fall back to FIFO. For platforms that do have VSync providers, there
-  // should be little difference. In case there is a need for a mode other than
-  // FIFO, availability checks must be performed here before returning the
-  // result. FIFO is always present.
+  // should be little difference. Callers that do want another mode (such as
+  // mailbox, which lets submits replace the queued image instead of blocking)
+  // get it only when the surface advertises it; FIFO is the only mode the
+  // spec guarantees.
+  if (desired_present_mode != VK_PRESENT_MODE_FIFO_KHR) {
+    uint32_t mode_count = 0;
+    if (VK_CALL_LOG_ERROR(vk.GetPhysicalDeviceSurfacePresentModesKHR(
+            physical_device_, surface.Handle(), &mode_count, nullptr)) ==
+            VK_SUCCESS &&
+        mode_count > 0) {
+      std::vector<VkPresentModeKHR> modes(mode_count);
+      if (VK_CALL_LOG_ERROR(vk.GetPhysicalDeviceSurfacePresentModesKHR(
+              physical_device_, surface.Handle(), &mode_count,
+              modes.data())) == VK_SUCCESS &&
+          std::find(modes.begin(), modes.end(), desired_present_mode) !=
+              modes.end()) {
+        *present_mode = desired_present_mode;
+        return true;
+      }
+    }
+  }
+
   *present_mode = VK_PRESENT_MODE_FIFO_KHR;
   return true;
 }
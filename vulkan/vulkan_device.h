@@ -53,6 +53,7 @@ class VulkanDevice {
                                         VkSurfaceFormatKHR* format) const;
 
   [[nodiscard]] bool ChoosePresentMode(const VulkanSurface& surface,
+                                       VkPresentModeKHR desired_present_mode,
                                        VkPresentModeKHR* present_mode) const;
 
   [[nodiscard]] bool QueueSubmit(
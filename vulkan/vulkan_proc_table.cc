@@ -103,6 +103,10 @@ bool VulkanProcTable::SetupInstanceProcAddresses(
   return true;
 }
 
+// Device-level procs are resolved through vkGetDeviceProcAddr (via the
+// VulkanHandle<VkDevice> overload of AcquireProc below), so per-frame calls
+// like vkQueueSubmit and vkAcquireNextImageKHR dispatch straight into the
+// driver instead of bouncing through the loader's device trampoline.
 bool VulkanProcTable::SetupDeviceProcAddresses(
     const VulkanHandle<VkDevice>& handle) {
   ACQUIRE_PROC(AllocateCommandBuffers, handle);
@@ -4,6 +4,8 @@
 
 #include "flutter/vulkan/vulkan_swapchain.h"
 
+#include <algorithm>
+
 #include "flutter/vulkan/vulkan_backbuffer.h"
 #include "flutter/vulkan/vulkan_device.h"
 #include "flutter/vulkan/vulkan_image.h"
@@ -41,7 +43,8 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
                                  const VulkanSurface& surface,
                                  GrContext* skia_context,
                                  std::unique_ptr<VulkanSwapchain> old_swapchain,
-                                 uint32_t queue_family_index)
+                                 uint32_t queue_family_index,
+                                 VkPresentModeKHR preferred_present_mode)
     : vk(p_vk),
       device_(device),
       capabilities_(),
@@ -79,7 +82,8 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
   }
 
   VkPresentModeKHR present_mode = VK_PRESENT_MODE_FIFO_KHR;
-  if (!device_.ChoosePresentMode(surface, &present_mode)) {
+  if (!device_.ChoosePresentMode(surface, preferred_present_mode,
+                                 &present_mode)) {
     FML_DLOG(INFO) << "Could not choose present mode.";
     return;
   }
@@ -107,18 +111,32 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
 
   if (old_swapchain != nullptr && old_swapchain->IsValid()) {
     old_swapchain_handle = old_swapchain->swapchain_;
-    // The unique pointer to the swapchain will go out of scope here
-    // and its handle collected after the appropriate device wait.
+    // Keep the old backbuffers around; their synchronization primitives and
+    // command buffers do not depend on the swapchain dimensions and can be
+    // rotated into the new swapchain once the old handle is collected (which
+    // happens after the appropriate device wait when the unique pointer goes
+    // out of scope at the end of this constructor).
+    recycled_backbuffers_ = std::move(old_swapchain->backbuffers_);
   }
 
   VkSurfaceKHR surface_handle = surface.Handle();
 
+  // Prefer triple buffering so that command recording for the next frame,
+  // rendering of the current frame, and presentation of the previous frame
+  // can overlap instead of the CPU stalling on backbuffer fences.
+  uint32_t desired_image_count =
+      std::max<uint32_t>(capabilities_.minImageCount, 3u);
+  if (capabilities_.maxImageCount > 0 &&
+      desired_image_count > capabilities_.maxImageCount) {
+    desired_image_count = capabilities_.maxImageCount;
+  }
+
   const VkSwapchainCreateInfoKHR create_info = {
       .sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
       .pNext = nullptr,
       .flags = 0,
       .surface = surface_handle,
-      .minImageCount = capabilities_.minImageCount,
+      .minImageCount = desired_image_count,
       .imageFormat = surface_format_.format,
       .imageColorSpace = surface_format_.colorSpace,
       .imageExtent = capabilities_.currentExtent,
@@ -258,9 +276,22 @@ bool VulkanSwapchain::CreateSwapchainImages(GrContext* skia_context,
   const SkISize surface_size = GetSize();
 
   for (const VkImage& image : images) {
-    // Populate the backbuffer.
-    auto backbuffer = std::make_unique<VulkanBackbuffer>(
-        vk, device_.GetHandle(), device_.GetCommandPool());
+    // Populate the backbuffer, reusing one recycled from the previous
+    // swapchain when available. Any pending work on a recycled backbuffer is
+    // accounted for by the fence wait on acquisition.
+    std::unique_ptr<VulkanBackbuffer> backbuffer;
+    while (!recycled_backbuffers_.empty() && backbuffer == nullptr) {
+      backbuffer = std::move(recycled_backbuffers_.back());
+      recycled_backbuffers_.pop_back();
+      if (backbuffer == nullptr || !backbuffer->IsValid()) {
+        backbuffer = nullptr;
+      }
+    }
+
+    if (backbuffer == nullptr) {
+      backbuffer = std::make_unique<VulkanBackbuffer>(
+          vk, device_.GetHandle(), device_.GetCommandPool());
+    }
 
     if (!backbuffer->IsValid()) {
       return false;
@@ -291,6 +322,10 @@ bool VulkanSwapchain::CreateSwapchainImages(GrContext* skia_context,
   FML_DCHECK(backbuffers_.size() == images_.size());
   FML_DCHECK(images_.size() == surfaces_.size());
 
+  // Backbuffers that were not rotated into the new swapchain are no longer
+  // needed.
+  recycled_backbuffers_.clear();
+
   return true;
 }
 
@@ -30,7 +30,9 @@ class VulkanSwapchain {
                   const VulkanSurface& surface,
                   GrContext* skia_context,
                   std::unique_ptr<VulkanSwapchain> old_swapchain,
-                  uint32_t queue_family_index);
+                  uint32_t queue_family_index,
+                  VkPresentModeKHR preferred_present_mode =
+                      VK_PRESENT_MODE_FIFO_KHR);
 
   ~VulkanSwapchain();
 
@@ -68,6 +70,10 @@ class VulkanSwapchain {
   VkSurfaceFormatKHR surface_format_;
   VulkanHandle<VkSwapchainKHR> swapchain_;
   std::vector<std::unique_ptr<VulkanBackbuffer>> backbuffers_;
+  // Backbuffers harvested from the swapchain being replaced. Their fences,
+  // semaphores and command buffers are swapchain independent and are reused
+  // instead of being reallocated on every resize.
+  std::vector<std::unique_ptr<VulkanBackbuffer>> recycled_backbuffers_;
   std::vector<std::unique_ptr<VulkanImage>> images_;
   std::vector<sk_sp<SkSurface>> surfaces_;
   VkPipelineStageFlagBits current_pipeline_stage_;
@@ -11,7 +11,8 @@ VulkanSwapchain::VulkanSwapchain(const VulkanProcTable& p_vk,
                                  const VulkanSurface& surface,
                                  GrContext* skia_context,
                                  std::unique_ptr<VulkanSwapchain> old_swapchain,
-                                 uint32_t queue_family_index) {}
+                                 uint32_t queue_family_index,
+                                 VkPresentModeKHR preferred_present_mode) {}
 
 VulkanSwapchain::~VulkanSwapchain() = default;
 
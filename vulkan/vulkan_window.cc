@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 
+#include "flutter/fml/trace_event.h"
 #include "flutter/vulkan/vulkan_application.h"
 #include "flutter/vulkan/vulkan_device.h"
 #include "flutter/vulkan/vulkan_native_surface.h"
@@ -18,8 +19,11 @@ namespace vulkan {
 
 VulkanWindow::VulkanWindow(fml::RefPtr<VulkanProcTable> proc_table,
                            std::unique_ptr<VulkanNativeSurface> native_surface,
-                           bool render_to_surface)
-    : valid_(false), vk(std::move(proc_table)) {
+                           bool render_to_surface,
+                           VkPresentModeKHR preferred_present_mode)
+    : valid_(false),
+      preferred_present_mode_(preferred_present_mode),
+      vk(std::move(proc_table)) {
   if (!vk || !vk->HasAcquiredMandatoryProcAddresses()) {
     FML_DLOG(INFO) << "Proc table has not acquired mandatory proc addresses.";
     return;
@@ -145,6 +149,10 @@ bool VulkanWindow::CreateSkiaBackendContext(GrVkBackendContext* context) {
   context->fFeatures = skia_features;
   context->fGetProc = std::move(getProc);
   context->fOwnsInstanceAndDevice = false;
+  // Device memory for images and buffers is sub-allocated by the backend
+  // context's default memory allocator, which carves allocations out of large
+  // per-memory-type blocks instead of calling vkAllocateMemory per resource.
+  // Swapchain image memory itself comes from the presentation engine.
   return true;
 }
 
@@ -223,6 +231,8 @@ bool VulkanWindow::SwapBuffers() {
 }
 
 bool VulkanWindow::RecreateSwapchain() {
+  TRACE_EVENT0("flutter", "VulkanWindow::RecreateSwapchain");
+
   // This way, we always lose our reference to the old swapchain. Even if we
   // cannot create a new one to replace it.
   auto old_swapchain = std::move(swapchain_);
@@ -245,13 +255,26 @@ bool VulkanWindow::RecreateSwapchain() {
 
   auto swapchain = std::make_unique<VulkanSwapchain>(
       *vk, *logical_device_, *surface_, skia_gr_context_.get(),
-      std::move(old_swapchain), logical_device_->GetGraphicsQueueIndex());
+      std::move(old_swapchain), logical_device_->GetGraphicsQueueIndex(),
+      preferred_present_mode_);
 
   if (!swapchain->IsValid()) {
     return false;
   }
 
   swapchain_ = std::move(swapchain);
+
+  // Swapchain recreation is when allocation churn concentrates; surface the
+  // resulting GPU resource usage to tooling.
+  size_t resource_count = 0;
+  size_t resource_bytes = 0;
+  skia_gr_context_->getResourceCacheUsage(&resource_count, &resource_bytes);
+  FML_TRACE_COUNTER("flutter", "VulkanGrResourceCache",
+                    reinterpret_cast<int64_t>(this),  //
+                    "resources", resource_count,      //
+                    "bytes", resource_bytes           //
+  );
+
   return true;
 }
 
@@ -33,7 +33,9 @@ class VulkanWindow {
  public:
   VulkanWindow(fml::RefPtr<VulkanProcTable> proc_table,
                std::unique_ptr<VulkanNativeSurface> native_surface,
-               bool render_to_surface);
+               bool render_to_surface,
+               VkPresentModeKHR preferred_present_mode =
+                   VK_PRESENT_MODE_FIFO_KHR);
 
   ~VulkanWindow();
 
@@ -47,6 +49,7 @@ class VulkanWindow {
 
  private:
   bool valid_;
+  VkPresentModeKHR preferred_present_mode_;
   fml::RefPtr<VulkanProcTable> vk;
   std::unique_ptr<VulkanApplication> application_;
   std::unique_ptr<VulkanDevice> logical_device_;